@@ -295,6 +295,27 @@ IPPAPI(IppStatus, ippsSMS4_CCMEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
 IPPAPI(IppStatus, ippsSMS4_CCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsSMS4_CCMState* pCtx))
 IPPAPI(IppStatus, ippsSMS4_CCMGetTag,(Ipp8u* pTag, int tagLen, const IppsSMS4_CCMState* pCtx))
 
+/* SMS4-GCM */
+IPPAPI(IppStatus, ippsSMS4_GCMGetSize,(int* pSize))
+IPPAPI(IppStatus, ippsSMS4_GCMInit,(const Ipp8u* pKey, int keyLen, IppsSMS4_GCMState* pState, int ctxSize))
+IPPAPI(IppStatus, ippsSMS4_GCMStart,(const Ipp8u* pIV, int ivLen, const Ipp8u* pAAD, int aadLen, IppsSMS4_GCMState* pState))
+IPPAPI(IppStatus, ippsSMS4_GCMEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsSMS4_GCMState* pState))
+IPPAPI(IppStatus, ippsSMS4_GCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsSMS4_GCMState* pState))
+IPPAPI(IppStatus, ippsSMS4_GCMGetTag,(Ipp8u* pDstTag, int tagLen, const IppsSMS4_GCMState* pState))
+
+/* SMS4-XTS */
+IPPAPI(IppStatus, ippsSMS4_XTSGetSize,(int* pSize))
+IPPAPI(IppStatus, ippsSMS4_XTSInit,(const Ipp8u* pKey, int keyLen, int duBitsize,
+                                    IppsSMS4_XTSSpec* pCtx, int ctxSize))
+IPPAPI(IppStatus, ippsSMS4_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen,
+                                       const IppsSMS4_XTSSpec* pCtx,
+                                       const Ipp8u* pTweak,
+                                       int startCipherBlkNo))
+IPPAPI(IppStatus, ippsSMS4_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen,
+                                       const IppsSMS4_XTSSpec* pCtx,
+                                       const Ipp8u* pTweak,
+                                       int startCipherBlkNo))
+
 /*
 // =========================================================
 // AES based  authentication & confidence Primitives
@@ -343,6 +364,14 @@ IPPAPI(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitSiz
                                       const IppsAES_XTSSpec* pCtx,
                                       const Ipp8u* pTweak,
                                       int startCipherBlkNo))
+IPPAPI(IppStatus, ippsAES_XTSEncryptSectors,(const Ipp8u* pSrc, Ipp8u* pDst,
+                                             int sectorSize, int nSectors,
+                                             Ipp64u startSectorNo,
+                                             const IppsAES_XTSSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_XTSDecryptSectors,(const Ipp8u* pSrc, Ipp8u* pDst,
+                                             int sectorSize, int nSectors,
+                                             Ipp64u startSectorNo,
+                                             const IppsAES_XTSSpec* pCtx))
 
 /* AES-SIV (RFC 5297) */
 IPPAPI(IppStatus, ippsAES_S2V_CMAC,(const Ipp8u* pKey, int keyLen,
@@ -358,6 +387,32 @@ IPPAPI(IppStatus, ippsAES_SIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
                                       const Ipp8u* pAD[], const int pADlen[], int numAD,
                                       const Ipp8u* pSIV))
 
+/* AES-GCM-SIV (RFC 8452) */
+IPPAPI(IppStatus, ippsAES_GCMSIVEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                               Ipp8u* pTag,
+                                         const Ipp8u* pKey, int keyLen,
+                                         const Ipp8u* pNonce,
+                                         const Ipp8u* pAAD, int aadLen))
+IPPAPI(IppStatus, ippsAES_GCMSIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                         int* pAuthPassed,
+                                         const Ipp8u* pKey, int keyLen,
+                                         const Ipp8u* pNonce,
+                                         const Ipp8u* pAAD, int aadLen,
+                                         const Ipp8u* pTag))
+
+/* AES Key Wrap (RFC 3394) and AES Key Wrap with Padding (RFC 5649) */
+IPPAPI(IppStatus, ippsAES_KeyWrap,(const Ipp8u* pSrc, int len, Ipp8u* pDst, const IppsAESSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_KeyUnwrap,(const Ipp8u* pSrc, int len, Ipp8u* pDst, int* pAuthPassed,
+                                     const IppsAESSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_KeyWrapPad,(const Ipp8u* pSrc, int len, Ipp8u* pDst, const IppsAESSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_KeyUnwrapPad,(const Ipp8u* pSrc, int len, Ipp8u* pDst, int* pDstLen, int* pAuthPassed,
+                                        const IppsAESSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_KeyWrap_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pDst[],
+                                      IppStatus status[], int numBuffers, const IppsAESSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_KeyUnwrap_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pDst[],
+                                        int authPassed[], IppStatus status[], int numBuffers,
+                                        const IppsAESSpec* pCtx))
+
 /* AES-CMAC */
 IPPAPI(IppStatus, ippsAES_CMACGetSize,(int* pSize))
 IPPAPI(IppStatus, ippsAES_CMACInit,(const Ipp8u* pKey, int keyLen, IppsAES_CMACState* pState, int ctxSize))
@@ -365,6 +420,8 @@ IPPAPI(IppStatus, ippsAES_CMACInit,(const Ipp8u* pKey, int keyLen, IppsAES_CMACS
 IPPAPI(IppStatus, ippsAES_CMACUpdate,(const Ipp8u* pSrc, int len, IppsAES_CMACState* pState))
 IPPAPI(IppStatus, ippsAES_CMACFinal,(Ipp8u* pMD, int mdLen, IppsAES_CMACState* pState))
 IPPAPI(IppStatus, ippsAES_CMACGetTag,(Ipp8u* pMD, int mdLen, const IppsAES_CMACState* pState))
+IPPAPI(IppStatus, ippsAES_CMAC_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pMD[], int mdLen,
+                                   IppStatus status[], int numBuffers, const IppsAES_CMACState* pState))
 
 
 /*
@@ -619,6 +676,10 @@ IPPAPI(IppStatus, ippsMontForm,(const IppsBigNumState* pA, IppsMontState* pCtx,
 IPPAPI(IppStatus, ippsMontMul, (const IppsBigNumState* pA, const IppsBigNumState* pB, IppsMontState* m, IppsBigNumState* pR))
 IPPAPI(IppStatus, ippsMontExp, (const IppsBigNumState* pA, const IppsBigNumState* pE, IppsMontState* m, IppsBigNumState* pR))
 
+IPPAPI(IppStatus, ippsMontExpFixedBaseGetSize,(int bitSizeE, const IppsMontState* m, int* pSize))
+IPPAPI(IppStatus, ippsMontExpFixedBaseInit,(const IppsBigNumState* pA, int bitSizeE, IppsMontExpFixedBaseState* pTable, IppsMontState* m))
+IPPAPI(IppStatus, ippsMontExpFixedBase,(const IppsBigNumState* pE, const IppsMontExpFixedBaseState* pTable, IppsMontState* m, IppsBigNumState* pR))
+
 /* Pseudo-Random Number Generation */
 #define PRNG_DEPRECATED "This algorithm is considered weak since it's based on the outdated FIPS standard(FIPS 186-2). \
 The functionality remains in the library, but its implementation is not recommended for use. \
@@ -642,6 +703,15 @@ IPPAPI(IppStatus, ippsPRNGenRDRAND_BN,(IppsBigNumState* pRand, int nBits, void*
 IPPAPI(IppStatus, ippsTRNGenRDSEED,   (Ipp32u* pRand, int nBits, void* pCtx))
 IPPAPI(IppStatus, ippsTRNGenRDSEED_BN,(IppsBigNumState* pRand, int nBits, void* pCtx))
 
+/* Deterministic Random Bit Generation (SP 800-90A) */
+IPPAPI(IppStatus, ippsDRBGGetSize,(int* pSize))
+IPPAPI(IppStatus, ippsDRBGInit,   (IppDRBGAlgId alg, const Ipp8u* pPers, int persLen,
+                                   IppBitSupplier entropyFunc, void* pEntropyParam, IppsDRBGState* pCtx))
+IPPAPI(IppStatus, ippsDRBGReseed, (const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+IPPAPI(IppStatus, ippsDRBGGenerate,(Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+IPPAPI(IppStatus, ippsDRBGGen,    (Ipp32u* pRand, int nBits, void* pCtx))
+IPPAPI(IppStatus, ippsDRBGGen_BN, (IppsBigNumState* pRand, int nBits, void* pCtx))
+
 /* Probable Prime Number Generation */
 IPPAPI(IppStatus, ippsPrimeGetSize,(int nMaxBits, int* pSize))
 IPPAPI(IppStatus, ippsPrimeInit,   (int nMaxBits, IppsPrimeState* pCtx))
@@ -661,6 +731,10 @@ IPPAPI(IppStatus, ippsPrimeGet_BN,(IppsBigNumState* pPrime, const IppsPrimeState
 IPPAPI(IppStatus, ippsPrimeSet,   (const Ipp32u* pPrime, int nBits, IppsPrimeState* pCtx))
 IPPAPI(IppStatus, ippsPrimeSet_BN,(const IppsBigNumState* pPrime, IppsPrimeState* pCtx))
 
+IPPAPI(IppStatus, ippsPrimeWorkBufferSize,(int nWorkers, const IppsPrimeState* pCtx, int* pSize))
+IPPAPI(IppStatus, ippsPrimeSetWorkers,(IppTaskRunner runFunc, void* pRunParam,
+                                 int nWorkers, Ipp8u* pWorkBuffer, IppsPrimeState* pCtx))
+
 
 /*
 // =========================================================
@@ -858,6 +932,8 @@ IPPAPI( const char*, ippsDLGetResultString, (IppDLResult code))
 /* Initialization */
 IPPAPI(IppStatus, ippsDLPGetSize,(int bitSizeP, int bitSizeR, int* pSize))
 IPPAPI(IppStatus, ippsDLPInit,   (int bitSizeP, int bitSizeR, IppsDLPState* pCtx))
+IPPAPI(IppStatus, ippsDLPGetSizeStd,(IppDLPStdGroup group, int* pSize))
+IPPAPI(IppStatus, ippsDLPInitStd,   (IppDLPStdGroup group, IppsDLPState* pCtx))
 
 IPPAPI(IppStatus, ippsDLPPack,(const IppsDLPState* pCtx, Ipp8u* pBuffer))
 IPPAPI(IppStatus, ippsDLPUnpack,(const Ipp8u* pBuffer, IppsDLPState* pCtx))
@@ -921,6 +997,9 @@ IPPAPI(IppStatus, ippsDLPGenerateDH,(const IppsBigNumState* pSeedIn,
                                      IppBitSupplier rndFunc, void* pRndParam))
 IPPAPI(IppStatus, ippsDLPValidateDH,(int nTrials, IppDLResult* pResult, IppsDLPState* pCtx,
                                      IppBitSupplier rndFunc, void* pRndParam))
+IPPAPI(IppStatus, ippsDLPWorkBufferSize,(int nWorkers, const IppsDLPState* pCtx, int* pSize))
+IPPAPI(IppStatus, ippsDLPSetWorkers,(IppTaskRunner runFunc, void* pRunParam,
+                                     int nWorkers, Ipp8u* pWorkBuffer, IppsDLPState* pCtx))
 
 
 /*
@@ -943,6 +1022,7 @@ IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p256r1, (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p384r1, (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p521r1, (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p256sm2,(void) )
+IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p256k1, (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p256bn, (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_p256,   (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpMethod_pArb,   (void) )
@@ -958,6 +1038,8 @@ IPPAPI( const IppsGFpMethod*, ippsGFpxMethod_binom,       (void) )
 IPPAPI( const IppsGFpMethod*, ippsGFpxMethod_com,         (void) )
 
 IPPAPI(IppStatus, ippsGFpScratchBufferSize,(int nExponents, int ExpBitSize, const IppsGFpState* pGFp, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpMultiExpBufferSize,(int nItems, const IppsGFpState* pGFp, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpInvBatchBufferSize,(int nItems, const IppsGFpState* pGFp, int* pBufferSize))
 
 IPPAPI(IppStatus, ippsGFpElementGetSize,(const IppsGFpState* pGFp, int* pElementSize))
 IPPAPI(IppStatus, ippsGFpElementInit,   (const Ipp32u* pA, int lenA, IppsGFpElement* pR, IppsGFpState* pGFp))
@@ -979,6 +1061,7 @@ IPPAPI(IppStatus, ippsGFpIsUnityElement,(const IppsGFpElement* pA, int* pResult,
 IPPAPI(IppStatus, ippsGFpConj,(const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpNeg, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpInv, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
+IPPAPI(IppStatus, ippsGFpInv_Batch,(const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpSqrt,(const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpSqr, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpAdd, (const IppsGFpElement* pA, const IppsGFpElement* pB,  IppsGFpElement* pR, IppsGFpState* pGFp))
@@ -986,6 +1069,8 @@ IPPAPI(IppStatus, ippsGFpSub, (const IppsGFpElement* pA, const IppsGFpElement* p
 IPPAPI(IppStatus, ippsGFpMul, (const IppsGFpElement* pA, const IppsGFpElement* pB,  IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpExp, (const IppsGFpElement* pA, const IppsBigNumState* pE, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpMultiExp,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpMultiExpLarge,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpMultiExp_VT,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 
 IPPAPI(IppStatus, ippsGFpAdd_PE,(const IppsGFpElement* pA, const IppsGFpElement* pParentB, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpSub_PE,(const IppsGFpElement* pA, const IppsGFpElement* pParentB, IppsGFpElement* pR, IppsGFpState* pGFp))
@@ -1015,6 +1100,7 @@ IPPAPI(IppStatus, ippsGFpECInitStd384r1,(const IppsGFpState* pGFp, IppsGFpECStat
 IPPAPI(IppStatus, ippsGFpECInitStd521r1,(const IppsGFpState* pGFp, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECInitStdSM2,  (const IppsGFpState* pGFp, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECInitStdBN256,(const IppsGFpState* pGFp, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECInitStdSecp256k1,(const IppsGFpState* pGFp, IppsGFpECState* pEC))
 
 IPPAPI(IppStatus, ippsGFpECBindGxyTblStd192r1,(IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECBindGxyTblStd224r1,(IppsGFpECState* pEC))
@@ -1022,6 +1108,7 @@ IPPAPI(IppStatus, ippsGFpECBindGxyTblStd256r1,(IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECBindGxyTblStd384r1,(IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECBindGxyTblStd521r1,(IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECBindGxyTblStdSM2,  (IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECBindGxyTblStdSecp256k1,(IppsGFpECState* pEC))
 
 IPPAPI(IppStatus, ippsGFpECGet,(IppsGFpState** const ppGFp,
                                 IppsGFpElement* pA, IppsGFpElement* pB,
@@ -1049,10 +1136,16 @@ IPP_DEPRECATED(OBSOLETE_API) \
 IPPAPI(IppStatus, ippsGFpECSetPointHashBackCompatible,(Ipp32u hdr, const Ipp8u* pMsg, int msgLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, IppHashAlgId hashID, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpECSetPointHash_rmf,(Ipp32u hdr, const Ipp8u* pMsg, int msgLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpECSetPointHashBackCompatible_rmf,(Ipp32u hdr, const Ipp8u* pMsg, int msgLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECHashToCurve_rmf,(const Ipp8u* pMsg, int msgLen, const Ipp8u* pDST, int dstLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod))
+IPPAPI(IppStatus, ippsGFpECEncodeToCurve_rmf,(const Ipp8u* pMsg, int msgLen, const Ipp8u* pDST, int dstLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod))
+IPPAPI(IppStatus, ippsGFpECHashToCurveBatch_rmf,(const Ipp8u* const pMsg[], const int msgLen[], const Ipp8u* pDST, int dstLen, IppsGFpECPoint* const pPoint[], int nPoints, IppsGFpECState* pEC, const IppsHashMethod* pMethod))
 IPPAPI(IppStatus, ippsGFpECGetPoint,(const IppsGFpECPoint* pPoint, IppsGFpElement* pX, IppsGFpElement* pY, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECGetPointRegular,(const IppsGFpECPoint* pPoint, IppsBigNumState* pX, IppsBigNumState* pY, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECSetPointOctString,(const Ipp8u* pStr, int strLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECGetPointOctString,(const IppsGFpECPoint* pPoint, Ipp8u* pStr, int strLen, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECGetPointsBatchBufferSize,(int nPoints, const IppsGFpECState* pEC, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpECGetPoints_Batch,(const IppsGFpECPoint* const ppPoint[], IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECGetPointOctString_Batch,(const IppsGFpECPoint* const ppPoint[], Ipp8u* const ppStr[], int strLen, int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 
 IPPAPI(IppStatus, ippsGFpECTstPoint,(const IppsGFpECPoint* pP, IppECResult* pResult, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECTstPointInSubgroup,(const IppsGFpECPoint* pP, IppECResult* pResult, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
@@ -1061,6 +1154,9 @@ IPPAPI(IppStatus, ippsGFpECCmpPoint,(const IppsGFpECPoint* pP, const IppsGFpECPo
 IPPAPI(IppStatus, ippsGFpECNegPoint,(const IppsGFpECPoint* pP, IppsGFpECPoint* pR, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECAddPoint,(const IppsGFpECPoint* pP, const IppsGFpECPoint* pQ, IppsGFpECPoint* pR, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECMulPoint,(const IppsGFpECPoint* pP, const IppsBigNumState* pN, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECMultiScalarMulBufferSize,(int nPoints, const IppsGFpECState* pEC, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpECMultiScalarMul,(const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints,
+                                           IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 
 /* keys */
 IPPAPI(IppStatus, ippsGFpECPrivateKey,(IppsBigNumState* pPrivate, IppsGFpECState* pEC,
@@ -1090,6 +1186,15 @@ IPPAPI(IppStatus, ippsGFpECSignDSA, (const IppsBigNumState* pMsgDigest,
                                      IppsBigNumState* pEphPrivate,
                                      IppsBigNumState* pSignR, IppsBigNumState* pSignS,
                                      IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECSignDSA_Setup, (IppsBigNumState* pEphPrivate,
+                                           IppsBigNumState* pInvEphPrivate,
+                                           IppsBigNumState* pSignR,
+                                           IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECSignDSA_Complete, (const IppsBigNumState* pMsgDigest,
+                                              const IppsBigNumState* pRegPrivate,
+                                              IppsBigNumState* pInvEphPrivate,
+                                              const IppsBigNumState* pSignR, IppsBigNumState* pSignS,
+                                              IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECVerifyDSA, (const IppsBigNumState* pMsgDigest,
                                        const IppsGFpECPoint* pRegPublic,
                                        const IppsBigNumState* pSignR, const IppsBigNumState* pSignS,
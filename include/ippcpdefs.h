@@ -513,6 +513,10 @@ typedef struct _cpAES_XTS        IppsAES_XTSSpec;
 
 /* SMS4-CCM (authentication & confidence) */
 typedef struct _cpSMS4_CCM       IppsSMS4_CCMState;
+/* SMS4-GCM (authentication & confidence) */
+typedef struct _cpSMS4_GCM       IppsSMS4_GCMState;
+/* SMS4-XTS (confidence) */
+typedef struct _cpSMS4_XTS       IppsSMS4_XTSSpec;
 
 /*
 // =========================================================
@@ -618,12 +622,27 @@ typedef enum {
 
 typedef struct _cpBigNum      IppsBigNumState;
 typedef struct _cpMontgomery  IppsMontState;
+typedef struct _cpMontExpFixedBase IppsMontExpFixedBaseState;
 typedef struct _cpPRNG        IppsPRNGState;
+typedef struct _cpDRBG        IppsDRBGState;
 typedef struct _cpPrime       IppsPrimeState;
 
+/* SP 800-90A deterministic random bit generators */
+typedef enum {
+   ippDRBG_CTR_AES256,   /* CTR_DRBG, AES-256, no derivation function */
+   ippDRBG_Hash_SHA256   /* Hash_DRBG, SHA-256                         */
+} IppDRBGAlgId;
+
 /*  External Bit Supplier */
 typedef IppStatus (IPP_CALL *IppBitSupplier)(Ipp32u* pRand, int nBits, void* pEbsParams);
 
+/*  External Task Runner:
+//  calls pTask(pTaskParam, i) for each 0<=i<nTasks (in any order, possibly concurrently)
+//  and returns when all the tasks have been completed
+*/
+typedef void      (IPP_CALL *IppTaskFunc)(void* pTaskParam, int taskIdx);
+typedef IppStatus (IPP_CALL *IppTaskRunner)(IppTaskFunc pTask, void* pTaskParam, int nTasks, void* pRunnerParam);
+
 #define IPP_IS_EQ (0)
 #define IPP_IS_GT (1)
 #define IPP_IS_LT (2)
@@ -707,6 +726,15 @@ typedef enum {
    ippDLPkeyG = 0x04, IppDLPkeyG = 0x04
 } IppDLPKeyTag;
 
+/* RFC 7919 named groups */
+typedef enum {
+   ippDLPffdhe2048 = 1,
+   ippDLPffdhe3072,
+   ippDLPffdhe4096,
+   ippDLPffdhe6144,
+   ippDLPffdhe8192
+} IppDLPStdGroup;
+
 typedef enum {
    ippDLValid,                /* validation pass successfully  */
 
@@ -863,6 +891,27 @@ IPPAPI( IppStatus, ippcpInit,( void ))
 IPPAPI( const char*, ippcpGetStatusString, ( IppStatus StsCode ))
 IPPAPI( Ipp64u, ippcpGetCpuClocks, (void) )
 
+/*
+// Per-function instrumentation of the merged library (built with -DIPPCP_INSTRUMENTATION:BOOL=on)
+*/
+#define IPPCP_STATS_HIST_BINS (16) /* bin #i counts calls that took [2^(i+4), 2^(i+5)) cycles, the first and the last bins are open */
+
+typedef struct {
+   const char* pFuncName;  /* name of the function             */
+   const char* pCpuName;   /* dispatched code path, e.g. "l9"  */
+   Ipp64u      calls;      /* number of calls                  */
+   Ipp64u      bytes;      /* number of bytes processed        */
+   Ipp64u      cycles;     /* total number of cycles           */
+   Ipp64u      cyclesHist[IPPCP_STATS_HIST_BINS]; /* histogram of cycles per call */
+} IppcpStatsEntry;
+
+typedef void (*IppcpStatsHook)(const IppcpStatsEntry* pEntry, void* pCtx);
+
+IPPAPI( IppStatus, ippcpStatsGetNum, ( int* pNum ))
+IPPAPI( IppStatus, ippcpStatsGetSnapshot, ( IppcpStatsEntry* pEntries, int num ))
+IPPAPI( IppStatus, ippcpStatsReset, ( void ))
+IPPAPI( IppStatus, ippcpStatsExport, ( IppcpStatsHook hook, void* pCtx ))
+
 /* Threading functions are deprecated in the library */
 IPP_DEPRECATED(OBSOLETE_API) \
 IPPAPI( IppStatus, ippcpSetNumThreads, ( int numThr ))
@@ -0,0 +1,109 @@
+#=========================================================================
+# Copyright (C) 2024 Intel Corporation
+#
+# Licensed under the Apache License,  Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# 	http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law  or agreed  to  in  writing,  software
+# distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the  specific  language  governing  permissions  and
+# limitations under the License.
+#=========================================================================
+
+
+#
+# Intel(R) Cryptography Primitives Library
+#
+# Load-time (ELF IFUNC) dispatcher for the merged library on Linux* Intel(R) 64:
+# every public function is an STT_GNU_IFUNC symbol, its resolver is run by the dynamic
+# loader (or by the startup code of static executables) once, and calls to the function
+# are bound directly to the code path of the running CPU.
+#
+
+import re
+import sys
+import os
+import hashlib
+import argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('-i', '--header', action='store', required=True, help='Intel Cryptography Primitives Library dispatcher will be generated for functions in Header')
+parser.add_argument('-o', '--out-directory', action='store', required=True, help='Output folder for generated files')
+parser.add_argument('-l', '--cpu-list', action='store', required=True, help='Actual CPU list: semicolon separated string')
+parser.add_argument('-c', '--compiler', action='store', required=True, help='Compiler')
+args = parser.parse_args()
+Header = args.header
+OutDir = args.out_directory
+cpulist = args.cpu_list.split(';')
+compiler = args.compiler
+
+headerID= False      ## Header ID define to avoid multiple include like: #if !defined( __IPPCP_H__ )
+
+from gen_disp_common import readNextFunction
+
+if(compiler != "GNU" and compiler != "Clang" and compiler != "IntelLLVM"):
+    sys.exit("IFUNC dispatcher requires GNU, Clang or IntelLLVM compiler, '" + compiler + "' is used")
+
+HDR= open( Header, 'r' )
+h= HDR.readlines()
+HDR.close()
+
+## keep filename only
+(incdir, Header)= os.path.split(Header)
+
+isFunctionFound = True
+curLine = 0
+FunType = ""
+FunName = ""
+FunArg = ""
+
+while (isFunctionFound == True):
+
+    result = readNextFunction(h, curLine, headerID)
+
+    curLine         = result['curLine']
+    FunType         = result['FunType']
+    FunName         = result['FunName']
+    FunArg          = result['FunArg']
+    isFunctionFound = result['success']
+
+    if (isFunctionFound == True):
+
+        ##################################################
+        ## create dispatcher files: C file with IFUNC symbol
+        ##################################################
+        DISP= open( os.sep.join([OutDir, "jmp_"+FunName+"_" + hashlib.sha512(FunName.encode('utf-8')).hexdigest()[:8] + ".c"]), 'w' )
+
+        ## the asm dispatchers bind the preview API as well
+        DISP.write("""#define IPPCP_PREVIEW_ALL\n#include "ippcp.h"\n\n""")
+
+        DISP.write("typedef "+FunType+" (*IPP_PROC)"+FunArg+";\n\n")
+
+        ## resolvers may run before the relocations of the library are processed,
+        ## so everything they reference is bound at link time (hidden visibility)
+        DISP.write("extern __attribute__((visibility(\"hidden\"))) int owncpGetJumpIndexForMergedLibs( void );\n")
+
+        for cpu in cpulist:
+            DISP.write("extern __attribute__((visibility(\"hidden\"))) "+FunType+" "+cpu+"_"+FunName+FunArg+";\n")
+
+        DISP.write("""
+static IPP_PROC res_{FunName}( void )
+{{
+    switch( owncpGetJumpIndexForMergedLibs() ) {{
+""".format(FunName=FunName))
+
+        for idx, cpu in enumerate(cpulist[1:], start=1):
+            DISP.write("    case "+str(idx)+": return "+cpu+"_"+FunName+";\n")
+
+        DISP.write("""    default: return {cpu}_{FunName};
+    }}
+}}
+
+{FunType} {FunName}{FunArg} __attribute__((ifunc("res_{FunName}")));
+""".format(cpu=cpulist[0], FunType=FunType.strip(), FunName=FunName, FunArg=FunArg))
+
+        DISP.close()
@@ -0,0 +1,166 @@
+#=========================================================================
+# Copyright (C) 2024 Intel Corporation
+#
+# Licensed under the Apache License,  Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# 	http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law  or agreed  to  in  writing,  software
+# distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the  specific  language  governing  permissions  and
+# limitations under the License.
+#=========================================================================
+
+
+#
+# Intel(R) Cryptography Primitives Library
+#
+# Instrumented dispatcher for the merged library (IPPCP_INSTRUMENTATION build):
+# every public function dispatches to the code path of ippcpJumpIndexForMergedLibs
+# and records number of calls, bytes processed and cycles spent (see cpstats.c).
+#
+
+import re
+import sys
+import os
+import hashlib
+import argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('-i', '--header', action='store', required=True, help='Intel Cryptography Primitives Library dispatcher will be generated for functions in Header')
+parser.add_argument('-o', '--out-directory', action='store', required=True, help='Output folder for generated files')
+parser.add_argument('-l', '--cpu-list', action='store', required=True, help='Actual CPU list: semicolon separated string')
+parser.add_argument('-c', '--compiler', action='store', required=True, help='Compiler')
+args = parser.parse_args()
+Header = args.header
+OutDir = args.out_directory
+cpulist = args.cpu_list.split(';')
+compiler = args.compiler
+
+headerID= False      ## Header ID define to avoid multiple include like: #if !defined( __IPPCP_H__ )
+
+from gen_disp_common import readNextFunction
+
+if(compiler != "GNU" and compiler != "Clang" and compiler != "IntelLLVM"):
+    sys.exit("Instrumented dispatcher requires GNU, Clang or IntelLLVM compiler, '" + compiler + "' is used")
+
+## arguments treated as the size of processed data, in priority order (name, bytes per unit)
+LenArgs = [('len', 1), ('msgLen', 1), ('dataLen', 1), ('srcLen', 1), ('inpLen', 1), ('length', 1),
+           ('bitLen', 0), ('bitSizeLen', 0), ('aadLen', 1), ('adLen', 1)]
+
+def argNames(FunArg):
+    names = []
+    for arg in FunArg.strip()[1:-1].split(','):
+        arg = re.sub('\[.*\]', '', arg).strip()
+        if arg == '' or arg == 'void':
+            continue
+        names.append(re.search('(\w+)$', arg).group(1))
+    return names
+
+def bytesExpr(FunArg):
+    ## scalar (non-pointer) arguments only
+    scalars = []
+    for arg in FunArg.strip()[1:-1].split(','):
+        arg = arg.strip()
+        if '*' in arg or '[' in arg:
+            continue
+        scalars.append(arg)
+    ## the first name of LenArgs present in the list wins, whatever its position
+    for (name, unit) in LenArgs:
+        for arg in scalars:
+            if re.search('\\b' + name + '$', arg):
+                if unit == 0:
+                    return "(Ipp64u)(" + name + ">0 ? " + name + "/8 : 0)"
+                return "(Ipp64u)(" + name + ">0 ? " + name + " : 0)"
+    return "0"
+
+HDR= open( Header, 'r' )
+h= HDR.readlines()
+HDR.close()
+
+## keep filename only
+(incdir, Header)= os.path.split(Header)
+
+isFunctionFound = True
+curLine = 0
+FunType = ""
+FunName = ""
+FunArg = ""
+FunList = []
+
+while (isFunctionFound == True):
+
+    result = readNextFunction(h, curLine, headerID)
+
+    curLine         = result['curLine']
+    FunType         = result['FunType']
+    FunName         = result['FunName']
+    FunArg          = result['FunArg']
+    isFunctionFound = result['success']
+
+    if (isFunctionFound == True):
+
+        FunId = len(FunList)
+        FunList.append(FunName)
+        FunType = FunType.strip()
+        isVoid = (FunType == 'void')
+
+        ##################################################
+        ## create dispatcher files: instrumented C file
+        ##################################################
+        DISP= open( os.sep.join([OutDir, "jmp_"+FunName+"_" + hashlib.sha512(FunName.encode('utf-8')).hexdigest()[:8] + ".c"]), 'w' )
+
+        ## the asm dispatchers bind the preview API as well
+        DISP.write("""#define IPPCP_PREVIEW_ALL\n#include "ippcp.h"\n#include "cpstats.h"\n\n""")
+
+        DISP.write("typedef "+FunType+" (*IPP_PROC)"+FunArg+";\n\n")
+        DISP.write("extern int ippcpJumpIndexForMergedLibs;\n\n")
+
+        for cpu in cpulist:
+            DISP.write("extern "+FunType+" "+cpu+"_"+FunName+FunArg+";\n")
+
+        DISP.write("\nstatic const IPP_PROC arraddr[] =\n{\n")
+        DISP.write(",\n".join("    "+cpu+"_"+FunName for cpu in cpulist))
+        DISP.write("\n};\n")
+
+        ## local names are prefixed not to clash with the argument names
+        DISP.write("""
+{FunType} {FunName}{FunArg}
+{{
+    Ipp64u cpStatsClk;
+{RetDecl}    int cpStatsIdx = ippcpJumpIndexForMergedLibs;
+    if( cpStatsIdx < 0 ) {{
+        ippcpInit();
+        cpStatsIdx = ippcpJumpIndexForMergedLibs;
+    }}
+    cpStatsClk = ippcpGetCpuClocks();
+    {RetAssign}arraddr[cpStatsIdx]({ArgList});
+    owncpStatsRecord( {FunId}, cpStatsIdx, {Bytes}, ippcpGetCpuClocks()-cpStatsClk );
+{Ret}}}
+""".format(FunType=FunType, FunName=FunName, FunArg=FunArg, FunId=FunId,
+           RetDecl='' if isVoid else "    "+FunType+" cpStatsRet;\n",
+           RetAssign='' if isVoid else "cpStatsRet = ",
+           Ret='' if isVoid else "    return cpStatsRet;\n",
+           ArgList=", ".join(argNames(FunArg)), Bytes=bytesExpr(FunArg)))
+
+        DISP.close()
+
+##################################################
+## names of the instrumented functions and storage of the counters
+##################################################
+TBL= open( os.sep.join([OutDir, "cpstats_table.c"]), 'w' )
+TBL.write('#include "cpstats.h"\n\n')
+TBL.write("const int cpStatsNumFuncs = "+str(len(FunList))+";\n")
+TBL.write("const char* const cpStatsFuncName[] =\n{\n")
+TBL.write(",\n".join('    "'+name+'"' for name in FunList))
+TBL.write("\n};\n\n")
+TBL.write("const int cpStatsNumCpus = "+str(len(cpulist))+";\n")
+TBL.write("const char* const cpStatsCpuName[] =\n{\n")
+TBL.write(",\n".join('    "'+cpu+'"' for cpu in cpulist))
+TBL.write("\n};\n\n")
+TBL.write("static cpStatsCounter cpStatsStorage[CP_STATS_SHARDS*"+str(len(FunList))+"];\n")
+TBL.write("cpStatsCounter* const cpStatsCounters = cpStatsStorage;\n")
+TBL.close()
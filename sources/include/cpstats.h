@@ -0,0 +1,57 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+//
+// Intel® Cryptography Primitives Library
+//
+// Per-function instrumentation of the merged library:
+// counters are updated by the instrumented dispatcher (generated by gen_disp_stats.py)
+//
+
+#ifndef __CPSTATS_H__
+#define __CPSTATS_H__
+
+#include "ippcpdefs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* threads are spread over the shards of counters to avoid contention */
+#define CP_STATS_SHARDS (32)
+
+typedef struct {
+   Ipp64u calls;
+   Ipp64u bytes;
+   Ipp64u cycles;
+   Ipp64u cyclesHist[IPPCP_STATS_HIST_BINS];
+} cpStatsCounter;
+
+/* tables generated along with the instrumented dispatcher */
+extern const int          cpStatsNumFuncs;
+extern const char* const  cpStatsFuncName[];
+extern const int          cpStatsNumCpus;
+extern const char* const  cpStatsCpuName[];
+extern cpStatsCounter* const cpStatsCounters; /* [CP_STATS_SHARDS][cpStatsNumFuncs] */
+
+void owncpStatsRecord( int funcId, int cpuIdx, Ipp64u bytes, Ipp64u cycles );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* __CPSTATS_H__ */
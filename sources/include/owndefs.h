@@ -387,7 +387,11 @@ typedef enum {
     idCtxAESXTS,
     idxCtxECES_SM2,
     idCtxGFPECKE,
-    idCtxLMS
+    idCtxLMS,
+    idCtxDRBG,
+    idCtxMontExpFixedBase,
+    idCtxSMS4GCM,
+    idCtxSMS4XTS
 } IppCtxId;
 
 
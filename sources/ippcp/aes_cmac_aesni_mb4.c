@@ -0,0 +1,109 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "aes_cmac_mb.h"
+
+#if (_IPP32E>=_IPP32E_Y8)
+
+static inline void aes_encrypt4_aesni_cmac_mb4(__m128i blocks[4], const __m128i enc_keys[15], int cipherRounds)
+{
+    blocks[0] = _mm_xor_si128(blocks[0], enc_keys[0]);
+    blocks[1] = _mm_xor_si128(blocks[1], enc_keys[0]);
+    blocks[2] = _mm_xor_si128(blocks[2], enc_keys[0]);
+    blocks[3] = _mm_xor_si128(blocks[3], enc_keys[0]);
+
+    int nr;
+
+    for (nr = 1; nr < cipherRounds; nr += 1) {
+        blocks[0] = _mm_aesenc_si128(blocks[0], enc_keys[nr]);
+        blocks[1] = _mm_aesenc_si128(blocks[1], enc_keys[nr]);
+        blocks[2] = _mm_aesenc_si128(blocks[2], enc_keys[nr]);
+        blocks[3] = _mm_aesenc_si128(blocks[3], enc_keys[nr]);
+    }
+
+    blocks[0] = _mm_aesenclast_si128(blocks[0], enc_keys[nr]);
+    blocks[1] = _mm_aesenclast_si128(blocks[1], enc_keys[nr]);
+    blocks[2] = _mm_aesenclast_si128(blocks[2], enc_keys[nr]);
+    blocks[3] = _mm_aesenclast_si128(blocks[3], enc_keys[nr]);
+}
+
+/*
+// The four CBC chains are independent, so their AES rounds are interleaved
+// to hide the latency of the AESENC instruction.
+*/
+IPP_OWN_DEFN (void, aes_cmac_aesni_mb4, (Ipp8u* const mac_pa[4], const Ipp8u* const source_pa[4], const int len[4], const int cipherRounds, const Ipp32u* enc_keys))
+{
+    const __m128i* pSrc[4];
+
+    __m128i blocks[4];
+    __m128i mac[4];
+
+    int nBlocks[4];
+
+    int maxBlocks = 0;
+
+    __m128i keySchedule[15];
+
+    for (int i = 0; i <= cipherRounds; i++) {
+        keySchedule[i] = _mm_loadu_si128((__m128i const*)enc_keys + i);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        pSrc[i] = (const __m128i*)source_pa[i];
+
+        nBlocks[i] = len[i] / MBS_RIJ128;
+        mac[i] = _mm_setzero_si128();
+
+        if (nBlocks[i] > 0) {
+            mac[i] = _mm_loadu_si128((__m128i const*)(mac_pa[i]));
+        }
+
+        if (nBlocks[i] > maxBlocks) {
+            maxBlocks = nBlocks[i];
+        }
+    }
+
+    for (int block = 0; block < maxBlocks; block++) {
+        for (int i = 0; i < 4; i++) {
+            blocks[i] = mac[i];
+            if (nBlocks[i] > 0) {
+                blocks[i] = _mm_xor_si128(blocks[i], _mm_loadu_si128(pSrc[i]));
+                pSrc[i] += 1;
+            }
+        }
+
+        aes_encrypt4_aesni_cmac_mb4(blocks, keySchedule, cipherRounds);
+
+        for (int i = 0; i < 4; i++) {
+            if (nBlocks[i] > 0) {
+                mac[i] = blocks[i];
+                nBlocks[i] -= 1;
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (len[i] >= MBS_RIJ128) {
+            _mm_storeu_si128((__m128i*)(mac_pa[i]), mac[i]);
+        }
+    }
+}
+
+#endif
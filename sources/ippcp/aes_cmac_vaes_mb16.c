@@ -0,0 +1,129 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "aes_cmac_mb.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+static inline void aes_encrypt4_vaes_cmac_mb16(__m512i blocks[4], const __m512i enc_keys[15], int num_rounds)
+{
+    blocks[0] = _mm512_xor_si512(blocks[0], enc_keys[0]);
+    blocks[1] = _mm512_xor_si512(blocks[1], enc_keys[0]);
+    blocks[2] = _mm512_xor_si512(blocks[2], enc_keys[0]);
+    blocks[3] = _mm512_xor_si512(blocks[3], enc_keys[0]);
+
+    int nr;
+
+    for (nr = 1; nr < num_rounds; nr += 1) {
+        blocks[0] = _mm512_aesenc_epi128(blocks[0], enc_keys[nr]);
+        blocks[1] = _mm512_aesenc_epi128(blocks[1], enc_keys[nr]);
+        blocks[2] = _mm512_aesenc_epi128(blocks[2], enc_keys[nr]);
+        blocks[3] = _mm512_aesenc_epi128(blocks[3], enc_keys[nr]);
+    }
+
+    blocks[0] = _mm512_aesenclast_epi128(blocks[0], enc_keys[nr]);
+    blocks[1] = _mm512_aesenclast_epi128(blocks[1], enc_keys[nr]);
+    blocks[2] = _mm512_aesenclast_epi128(blocks[2], enc_keys[nr]);
+    blocks[3] = _mm512_aesenclast_epi128(blocks[3], enc_keys[nr]);
+}
+
+/*
+// Each 512-bit register holds the CBC chains of four buffers,
+// so sixteen independent chains are in flight per AES round.
+*/
+IPP_OWN_DEFN(void, aes_cmac_vaes_mb16, (Ipp8u* const mac_pa[16], const Ipp8u* const source_pa[16], const int len[16], const int num_rounds, const Ipp32u* enc_keys))
+{
+    int i, j;
+    int maxBlocks = 0;
+    int loc_blocks[16];
+    const Ipp8u* loc_src[16];
+
+    __mmask8 mbMask128[16]  = { 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x0C, 0x30, 0xC0 };
+    __mmask8 macMask128[16];
+
+    __m512i mac512[4];
+    __m512i blocks[4];
+
+    // - Local copy of block counts and source pointers, maxBlocks calculation
+    for (i = 0; i < 16; i++) {
+        loc_src[i] = source_pa[i];
+        loc_blocks[i] = len[i] / MBS_RIJ128;
+
+        // The case of the empty input buffer
+        if (loc_blocks[i] == 0)
+            mbMask128[i] = 0;
+        macMask128[i] = mbMask128[i];
+
+        if (loc_blocks[i] > maxBlocks)
+            maxBlocks = loc_blocks[i];
+    }
+
+    // Load the chaining values
+    for (j = 0; j < 4; j++) {
+        mac512[j] = _mm512_setzero_si512();
+        mac512[j] = _mm512_mask_expandloadu_epi64(mac512[j], macMask128[4*j],     mac_pa[4*j]);
+        mac512[j] = _mm512_mask_expandloadu_epi64(mac512[j], macMask128[4*j + 1], mac_pa[4*j + 1]);
+        mac512[j] = _mm512_mask_expandloadu_epi64(mac512[j], macMask128[4*j + 2], mac_pa[4*j + 2]);
+        mac512[j] = _mm512_mask_expandloadu_epi64(mac512[j], macMask128[4*j + 3], mac_pa[4*j + 3]);
+    }
+
+    // The key is the same for all the buffers
+    __m512i keySchedule[15];
+    for (i = 0; i <= num_rounds; i++) {
+        keySchedule[i] = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const*)enc_keys + i));
+    }
+
+    for (; maxBlocks > 0; maxBlocks--) {
+        for (j = 0; j < 4; j++) {
+            blocks[j] = _mm512_setzero_si512();
+            blocks[j] = _mm512_mask_expandloadu_epi64(blocks[j], mbMask128[4*j],     loc_src[4*j]);
+            blocks[j] = _mm512_mask_expandloadu_epi64(blocks[j], mbMask128[4*j + 1], loc_src[4*j + 1]);
+            blocks[j] = _mm512_mask_expandloadu_epi64(blocks[j], mbMask128[4*j + 2], loc_src[4*j + 2]);
+            blocks[j] = _mm512_mask_expandloadu_epi64(blocks[j], mbMask128[4*j + 3], loc_src[4*j + 3]);
+            blocks[j] = _mm512_xor_si512(blocks[j], mac512[j]);
+        }
+
+        aes_encrypt4_vaes_cmac_mb16(blocks, keySchedule, num_rounds);
+
+        // Only the buffers that still have data update their chaining value
+        for (j = 0; j < 4; j++) {
+            __mmask8 activeMask = (__mmask8)(mbMask128[4*j] | mbMask128[4*j + 1] | mbMask128[4*j + 2] | mbMask128[4*j + 3]);
+            mac512[j] = _mm512_mask_mov_epi64(mac512[j], activeMask, blocks[j]);
+        }
+
+        for (i = 0; i < 16; i++) {
+            if (mbMask128[i]) {
+                loc_src[i] += MBS_RIJ128;
+                loc_blocks[i] -= 1;
+                if (loc_blocks[i] == 0)
+                    mbMask128[i] = 0;
+            }
+        }
+    }
+
+    for (j = 0; j < 4; j++) {
+        _mm512_mask_compressstoreu_epi64(mac_pa[4*j],     macMask128[4*j],     mac512[j]);
+        _mm512_mask_compressstoreu_epi64(mac_pa[4*j + 1], macMask128[4*j + 1], mac512[j]);
+        _mm512_mask_compressstoreu_epi64(mac_pa[4*j + 2], macMask128[4*j + 2], mac512[j]);
+        _mm512_mask_compressstoreu_epi64(mac_pa[4*j + 3], macMask128[4*j + 3], mac512[j]);
+    }
+}
+
+#endif
@@ -0,0 +1,205 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+#if (_IPP32E>=_IPP32E_Y8)
+
+static inline void aes_encrypt4_aesni_kw_mb4(__m128i blocks[4], const __m128i enc_keys[15], int cipherRounds)
+{
+    blocks[0] = _mm_xor_si128(blocks[0], enc_keys[0]);
+    blocks[1] = _mm_xor_si128(blocks[1], enc_keys[0]);
+    blocks[2] = _mm_xor_si128(blocks[2], enc_keys[0]);
+    blocks[3] = _mm_xor_si128(blocks[3], enc_keys[0]);
+
+    int nr;
+
+    for (nr = 1; nr < cipherRounds; nr += 1) {
+        blocks[0] = _mm_aesenc_si128(blocks[0], enc_keys[nr]);
+        blocks[1] = _mm_aesenc_si128(blocks[1], enc_keys[nr]);
+        blocks[2] = _mm_aesenc_si128(blocks[2], enc_keys[nr]);
+        blocks[3] = _mm_aesenc_si128(blocks[3], enc_keys[nr]);
+    }
+
+    blocks[0] = _mm_aesenclast_si128(blocks[0], enc_keys[nr]);
+    blocks[1] = _mm_aesenclast_si128(blocks[1], enc_keys[nr]);
+    blocks[2] = _mm_aesenclast_si128(blocks[2], enc_keys[nr]);
+    blocks[3] = _mm_aesenclast_si128(blocks[3], enc_keys[nr]);
+}
+
+static inline void aes_decrypt4_aesni_kw_mb4(__m128i blocks[4], const __m128i dec_keys[15], int cipherRounds)
+{
+    blocks[0] = _mm_xor_si128(blocks[0], dec_keys[cipherRounds]);
+    blocks[1] = _mm_xor_si128(blocks[1], dec_keys[cipherRounds]);
+    blocks[2] = _mm_xor_si128(blocks[2], dec_keys[cipherRounds]);
+    blocks[3] = _mm_xor_si128(blocks[3], dec_keys[cipherRounds]);
+
+    int nr;
+
+    for (nr = cipherRounds - 1; nr > 0; nr -= 1) {
+        blocks[0] = _mm_aesdec_si128(blocks[0], dec_keys[nr]);
+        blocks[1] = _mm_aesdec_si128(blocks[1], dec_keys[nr]);
+        blocks[2] = _mm_aesdec_si128(blocks[2], dec_keys[nr]);
+        blocks[3] = _mm_aesdec_si128(blocks[3], dec_keys[nr]);
+    }
+
+    blocks[0] = _mm_aesdeclast_si128(blocks[0], dec_keys[0]);
+    blocks[1] = _mm_aesdeclast_si128(blocks[1], dec_keys[0]);
+    blocks[2] = _mm_aesdeclast_si128(blocks[2], dec_keys[0]);
+    blocks[3] = _mm_aesdeclast_si128(blocks[3], dec_keys[0]);
+}
+
+/*
+// Every step of the wrapping depends on the register A produced by the previous one,
+// so the four independent chains are interleaved to hide the latency of AESENC.
+// Lane k performs AESKW_NSTEPS*n[k] steps; block = A | R[idx], idx = (step mod n[k]).
+*/
+IPP_OWN_DEFN (void, aes_kw_wrap_aesni_mb4, (Ipp8u* const a_pa[4], Ipp8u* const r_pa[4], const int n[4], const int cipherRounds, const Ipp8u* enc_keys))
+{
+    __m128i blocks[4];
+    __m128i regA[4];
+
+    int nSteps[4];
+    int idx[4];
+    Ipp64u t[4];
+
+    int maxSteps = 0;
+
+    __m128i keySchedule[15];
+
+    for (int i = 0; i <= cipherRounds; i++) {
+        keySchedule[i] = _mm_loadu_si128((__m128i const*)enc_keys + i);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        nSteps[i] = AESKW_NSTEPS * n[i];
+        idx[i] = 0;
+        t[i] = 1;
+        regA[i] = _mm_setzero_si128();
+
+        if (nSteps[i] > 0) {
+            regA[i] = _mm_loadl_epi64((__m128i const*)(a_pa[i]));
+        }
+
+        if (nSteps[i] > maxSteps) {
+            maxSteps = nSteps[i];
+        }
+    }
+
+    for (int step = 0; step < maxSteps; step++) {
+        for (int i = 0; i < 4; i++) {
+            blocks[i] = regA[i];
+            if (step < nSteps[i]) {
+                blocks[i] = _mm_unpacklo_epi64(regA[i], _mm_loadl_epi64((__m128i const*)(r_pa[i] + idx[i] * AESKW_SEMIBLOCK)));
+            }
+        }
+
+        aes_encrypt4_aesni_kw_mb4(blocks, keySchedule, cipherRounds);
+
+        for (int i = 0; i < 4; i++) {
+            if (step < nSteps[i]) {
+                regA[i] = _mm_xor_si128(blocks[i], _mm_set_epi64x(0, (long long)cpAESKW_t(t[i])));
+                _mm_storel_epi64((__m128i*)(r_pa[i] + idx[i] * AESKW_SEMIBLOCK), _mm_unpackhi_epi64(blocks[i], blocks[i]));
+
+                t[i] += 1;
+                idx[i] += 1;
+                if (idx[i] == n[i]) {
+                    idx[i] = 0;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (nSteps[i] > 0) {
+            _mm_storel_epi64((__m128i*)(a_pa[i]), regA[i]);
+        }
+    }
+}
+
+/*
+// Unwrapping runs the steps of the wrapping backward:
+// block = (A ^ t) | R[idx], t = AESKW_NSTEPS*n[k] .. 1, idx = n[k]-1 .. 0 cyclically.
+*/
+IPP_OWN_DEFN (void, aes_kw_unwrap_aesni_mb4, (Ipp8u* const a_pa[4], Ipp8u* const r_pa[4], const int n[4], const int cipherRounds, const Ipp8u* dec_keys))
+{
+    __m128i blocks[4];
+    __m128i regA[4];
+
+    int nSteps[4];
+    int idx[4];
+    Ipp64u t[4];
+
+    int maxSteps = 0;
+
+    __m128i keySchedule[15];
+
+    for (int i = 0; i <= cipherRounds; i++) {
+        keySchedule[i] = _mm_loadu_si128((__m128i const*)dec_keys + i);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        nSteps[i] = AESKW_NSTEPS * n[i];
+        idx[i] = n[i] - 1;
+        t[i] = (Ipp64u)nSteps[i];
+        regA[i] = _mm_setzero_si128();
+
+        if (nSteps[i] > 0) {
+            regA[i] = _mm_loadl_epi64((__m128i const*)(a_pa[i]));
+        }
+
+        if (nSteps[i] > maxSteps) {
+            maxSteps = nSteps[i];
+        }
+    }
+
+    for (int step = 0; step < maxSteps; step++) {
+        for (int i = 0; i < 4; i++) {
+            blocks[i] = regA[i];
+            if (step < nSteps[i]) {
+                blocks[i] = _mm_xor_si128(regA[i], _mm_set_epi64x(0, (long long)cpAESKW_t(t[i])));
+                blocks[i] = _mm_unpacklo_epi64(blocks[i], _mm_loadl_epi64((__m128i const*)(r_pa[i] + idx[i] * AESKW_SEMIBLOCK)));
+            }
+        }
+
+        aes_decrypt4_aesni_kw_mb4(blocks, keySchedule, cipherRounds);
+
+        for (int i = 0; i < 4; i++) {
+            if (step < nSteps[i]) {
+                regA[i] = blocks[i];
+                _mm_storel_epi64((__m128i*)(r_pa[i] + idx[i] * AESKW_SEMIBLOCK), _mm_unpackhi_epi64(blocks[i], blocks[i]));
+
+                t[i] -= 1;
+                idx[i] -= 1;
+                if (idx[i] < 0) {
+                    idx[i] = n[i] - 1;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (nSteps[i] > 0) {
+            _mm_storel_epi64((__m128i*)(a_pa[i]), regA[i]);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,256 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+static inline void aes_encrypt4_vaes_kw_mb16(__m512i blocks[4], const __m512i enc_keys[15], int num_rounds)
+{
+    blocks[0] = _mm512_xor_si512(blocks[0], enc_keys[0]);
+    blocks[1] = _mm512_xor_si512(blocks[1], enc_keys[0]);
+    blocks[2] = _mm512_xor_si512(blocks[2], enc_keys[0]);
+    blocks[3] = _mm512_xor_si512(blocks[3], enc_keys[0]);
+
+    int nr;
+
+    for (nr = 1; nr < num_rounds; nr += 1) {
+        blocks[0] = _mm512_aesenc_epi128(blocks[0], enc_keys[nr]);
+        blocks[1] = _mm512_aesenc_epi128(blocks[1], enc_keys[nr]);
+        blocks[2] = _mm512_aesenc_epi128(blocks[2], enc_keys[nr]);
+        blocks[3] = _mm512_aesenc_epi128(blocks[3], enc_keys[nr]);
+    }
+
+    blocks[0] = _mm512_aesenclast_epi128(blocks[0], enc_keys[nr]);
+    blocks[1] = _mm512_aesenclast_epi128(blocks[1], enc_keys[nr]);
+    blocks[2] = _mm512_aesenclast_epi128(blocks[2], enc_keys[nr]);
+    blocks[3] = _mm512_aesenclast_epi128(blocks[3], enc_keys[nr]);
+}
+
+static inline void aes_decrypt4_vaes_kw_mb16(__m512i blocks[4], const __m512i dec_keys[15], int num_rounds)
+{
+    blocks[0] = _mm512_xor_si512(blocks[0], dec_keys[num_rounds]);
+    blocks[1] = _mm512_xor_si512(blocks[1], dec_keys[num_rounds]);
+    blocks[2] = _mm512_xor_si512(blocks[2], dec_keys[num_rounds]);
+    blocks[3] = _mm512_xor_si512(blocks[3], dec_keys[num_rounds]);
+
+    int nr;
+
+    for (nr = num_rounds - 1; nr > 0; nr -= 1) {
+        blocks[0] = _mm512_aesdec_epi128(blocks[0], dec_keys[nr]);
+        blocks[1] = _mm512_aesdec_epi128(blocks[1], dec_keys[nr]);
+        blocks[2] = _mm512_aesdec_epi128(blocks[2], dec_keys[nr]);
+        blocks[3] = _mm512_aesdec_epi128(blocks[3], dec_keys[nr]);
+    }
+
+    blocks[0] = _mm512_aesdeclast_epi128(blocks[0], dec_keys[0]);
+    blocks[1] = _mm512_aesdeclast_epi128(blocks[1], dec_keys[0]);
+    blocks[2] = _mm512_aesdeclast_epi128(blocks[2], dec_keys[0]);
+    blocks[3] = _mm512_aesdeclast_epi128(blocks[3], dec_keys[0]);
+}
+
+/*
+// Lane state of the wrapping, four lanes per 512-bit register.
+// Each lane occupies a pair of qwords: the even one holds the register A,
+// the odd one receives R[idx] gathered from the lane's buffer, so the pair is the AES block.
+// The counters (current R address, t and the number of remaining steps) are kept in both qwords of the pair,
+// so a lane is selected by the same 8-bit mask for every update.
+*/
+typedef struct {
+    __m512i regA[4];
+    __m512i rBeg[4];
+    __m512i rEnd[4];
+    __m512i rCur[4];
+    __m512i t[4];
+    __m512i rem[4];
+    int maxSteps;
+} aes_kw_vaes_lanes;
+
+#define KW_MASK_A (0x55) /* even qwords: register A */
+#define KW_MASK_R (0xAA) /* odd qwords:  R[idx]     */
+
+static void aes_kw_vaes_mb16_init(aes_kw_vaes_lanes* pLanes, Ipp8u* const a_pa[16], Ipp8u* const r_pa[16], const int n[16], int isWrap)
+{
+    __ALIGN64 Ipp64u a[4 * 8];
+    __ALIGN64 Ipp64u rBeg[4 * 8];
+    __ALIGN64 Ipp64u rEnd[4 * 8];
+    __ALIGN64 Ipp64u rCur[4 * 8];
+    __ALIGN64 Ipp64u t[4 * 8];
+    __ALIGN64 Ipp64u rem[4 * 8];
+
+    int i;
+
+    pLanes->maxSteps = 0;
+
+    for (i = 0; i < 16; i++) {
+        int nSteps = AESKW_NSTEPS * n[i];
+        Ipp64u beg = 0;
+        Ipp64u end = 0;
+        Ipp64u aVal = 0;
+
+        if (nSteps > 0) {
+            beg = (Ipp64u)IPP_UINT_PTR(r_pa[i]);
+            end = beg + (Ipp64u)n[i] * AESKW_SEMIBLOCK;
+            CopyBlock(a_pa[i], &aVal, AESKW_SEMIBLOCK);
+        }
+
+        a[2 * i] = a[2 * i + 1] = aVal;
+        rBeg[2 * i] = rBeg[2 * i + 1] = beg;
+        rEnd[2 * i] = rEnd[2 * i + 1] = end;
+        rCur[2 * i] = rCur[2 * i + 1] = isWrap ? beg : end - AESKW_SEMIBLOCK;
+        t[2 * i] = t[2 * i + 1] = isWrap ? 1 : (Ipp64u)nSteps;
+        rem[2 * i] = rem[2 * i + 1] = (Ipp64u)nSteps;
+
+        if (nSteps > pLanes->maxSteps) {
+            pLanes->maxSteps = nSteps;
+        }
+    }
+
+    for (i = 0; i < 4; i++) {
+        pLanes->regA[i] = _mm512_load_si512(a + 8 * i);
+        pLanes->rBeg[i] = _mm512_load_si512(rBeg + 8 * i);
+        pLanes->rEnd[i] = _mm512_load_si512(rEnd + 8 * i);
+        pLanes->rCur[i] = _mm512_load_si512(rCur + 8 * i);
+        pLanes->t[i]    = _mm512_load_si512(t + 8 * i);
+        pLanes->rem[i]  = _mm512_load_si512(rem + 8 * i);
+    }
+}
+
+static void aes_kw_vaes_mb16_final(Ipp8u* const a_pa[16], const int n[16], const aes_kw_vaes_lanes* pLanes)
+{
+    __ALIGN64 Ipp64u a[4 * 8];
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        _mm512_store_si512(a + 8 * i, pLanes->regA[i]);
+    }
+
+    for (i = 0; i < 16; i++) {
+        if (n[i] > 0) {
+            CopyBlock(&a[2 * i], a_pa[i], AESKW_SEMIBLOCK);
+        }
+    }
+
+    PurgeBlock(a, sizeof(a));
+}
+
+/*
+// Wrapping steps of sixteen buffers: block = A | R[idx], A = MSB(64, AES(block)) ^ t, R[idx] = LSB(64, AES(block))
+*/
+IPP_OWN_DEFN (void, aes_kw_wrap_vaes_mb16, (Ipp8u* const a_pa[16], Ipp8u* const r_pa[16], const int n[16], const int num_rounds, const Ipp8u* enc_keys))
+{
+    aes_kw_vaes_lanes lanes;
+    __m512i blocks[4];
+    __mmask8 active[4];
+
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i semiblock = _mm512_set1_epi64(AESKW_SEMIBLOCK);
+    const __m512i bswap64 = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    __m512i keySchedule[15];
+
+    int i, step;
+
+    for (i = 0; i <= num_rounds; i++) {
+        keySchedule[i] = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const*)enc_keys + i));
+    }
+
+    aes_kw_vaes_mb16_init(&lanes, a_pa, r_pa, n, 1);
+
+    for (step = 0; step < lanes.maxSteps; step++) {
+        for (i = 0; i < 4; i++) {
+            active[i] = _mm512_cmpgt_epi64_mask(lanes.rem[i], _mm512_setzero_si512());
+            blocks[i] = _mm512_mask_i64gather_epi64(lanes.regA[i], active[i] & KW_MASK_R, lanes.rCur[i], NULL, 1);
+        }
+
+        aes_encrypt4_vaes_kw_mb16(blocks, keySchedule, num_rounds);
+
+        for (i = 0; i < 4; i++) {
+            __mmask8 wrapped;
+
+            lanes.regA[i] = _mm512_mask_xor_epi64(lanes.regA[i], active[i] & KW_MASK_A, blocks[i], _mm512_shuffle_epi8(lanes.t[i], bswap64));
+            _mm512_mask_i64scatter_epi64(NULL, active[i] & KW_MASK_R, lanes.rCur[i], blocks[i], 1);
+
+            lanes.rCur[i] = _mm512_mask_add_epi64(lanes.rCur[i], active[i], lanes.rCur[i], semiblock);
+            wrapped = _mm512_mask_cmpeq_epu64_mask(active[i], lanes.rCur[i], lanes.rEnd[i]);
+            lanes.rCur[i] = _mm512_mask_mov_epi64(lanes.rCur[i], wrapped, lanes.rBeg[i]);
+
+            lanes.t[i] = _mm512_mask_add_epi64(lanes.t[i], active[i], lanes.t[i], one);
+            lanes.rem[i] = _mm512_mask_sub_epi64(lanes.rem[i], active[i], lanes.rem[i], one);
+        }
+    }
+
+    aes_kw_vaes_mb16_final(a_pa, n, &lanes);
+}
+
+/*
+// Unwrapping steps of sixteen buffers in backward order: block = AES-1((A ^ t) | R[idx]), A = MSB(64, block), R[idx] = LSB(64, block)
+*/
+IPP_OWN_DEFN (void, aes_kw_unwrap_vaes_mb16, (Ipp8u* const a_pa[16], Ipp8u* const r_pa[16], const int n[16], const int num_rounds, const Ipp8u* dec_keys))
+{
+    aes_kw_vaes_lanes lanes;
+    __m512i blocks[4];
+    __mmask8 active[4];
+
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i semiblock = _mm512_set1_epi64(AESKW_SEMIBLOCK);
+    const __m512i bswap64 = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    __m512i keySchedule[15];
+
+    int i, step;
+
+    for (i = 0; i <= num_rounds; i++) {
+        keySchedule[i] = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const*)dec_keys + i));
+    }
+
+    aes_kw_vaes_mb16_init(&lanes, a_pa, r_pa, n, 0);
+
+    for (step = 0; step < lanes.maxSteps; step++) {
+        for (i = 0; i < 4; i++) {
+            active[i] = _mm512_cmpgt_epi64_mask(lanes.rem[i], _mm512_setzero_si512());
+            blocks[i] = _mm512_mask_xor_epi64(lanes.regA[i], active[i] & KW_MASK_A, lanes.regA[i], _mm512_shuffle_epi8(lanes.t[i], bswap64));
+            blocks[i] = _mm512_mask_i64gather_epi64(blocks[i], active[i] & KW_MASK_R, lanes.rCur[i], NULL, 1);
+        }
+
+        aes_decrypt4_vaes_kw_mb16(blocks, keySchedule, num_rounds);
+
+        for (i = 0; i < 4; i++) {
+            __mmask8 wrapped;
+
+            lanes.regA[i] = _mm512_mask_mov_epi64(lanes.regA[i], active[i] & KW_MASK_A, blocks[i]);
+            _mm512_mask_i64scatter_epi64(NULL, active[i] & KW_MASK_R, lanes.rCur[i], blocks[i], 1);
+
+            wrapped = _mm512_mask_cmpeq_epu64_mask(active[i], lanes.rCur[i], lanes.rBeg[i]);
+            lanes.rCur[i] = _mm512_mask_sub_epi64(lanes.rCur[i], active[i], lanes.rCur[i], semiblock);
+            lanes.rCur[i] = _mm512_mask_sub_epi64(lanes.rCur[i], wrapped, lanes.rEnd[i], semiblock);
+
+            lanes.t[i] = _mm512_mask_sub_epi64(lanes.t[i], active[i], lanes.t[i], one);
+            lanes.rem[i] = _mm512_mask_sub_epi64(lanes.rem[i], active[i], lanes.rem[i], one);
+        }
+    }
+
+    aes_kw_vaes_mb16_final(a_pa, n, &lanes);
+}
+
+#undef KW_MASK_A
+#undef KW_MASK_R
+
+#endif
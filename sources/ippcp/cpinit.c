@@ -36,6 +36,7 @@ extern IPP_OWN_DECL (int,  cp_is_avx512_extension, ( void ))
 extern IPP_OWN_DECL (int,  cp_issue_avx512_instruction, ( void ))
 
 IppStatus owncpSetCpuFeaturesAndIdx( Ipp64u cpuFeatures, int* index );
+int owncpGetJumpIndexForMergedLibs( void );
 
 IPPFUN( Ipp64u, ippcpGetEnabledCpuFeatures, ( void ))
 {
@@ -413,6 +414,27 @@ IppStatus owncpSetCpuFeaturesAndIdx(Ipp64u cpuFeatures, int* index)
    return tmpStatus;
 }
 
+/*
+// Code path index for the load-time (IFUNC) dispatcher of the merged library.
+// It is called by the IFUNC resolvers while the library is being relocated,
+// so only the file-local state is used and nothing is called through the PLT.
+// The index is computed once and is not affected by ippcpSetCpuFeatures().
+*/
+int owncpGetJumpIndexForMergedLibs( void )
+{
+   static int ifuncIndex = -1;
+
+   if( ifuncIndex < 0 ) {
+      Ipp64u cpuFeatures = 0;
+      int    index = 0;
+
+      if( cpGetFeatures( &cpuFeatures ) )
+         owncpFeaturesToIdx( &cpuFeatures, &index );
+      ifuncIndex = index;
+   }
+   return ifuncIndex;
+}
+
 static struct {
    int sts;
    const char *msg;
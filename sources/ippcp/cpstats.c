@@ -0,0 +1,227 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+//
+//  Intel® Cryptography Primitives Library
+//
+//  Per-function instrumentation counters
+//
+//     Content:
+//        ippcpStatsGetNum()
+//        ippcpStatsGetSnapshot()
+//        ippcpStatsReset()
+//        ippcpStatsExport()
+//
+
+#include "owndefs.h"
+#include "ippcpdefs.h"
+
+#if defined( _IPP_DATA )
+
+#if defined( IPPCP_INSTRUMENTATION )
+#include "cpstats.h"
+
+/* shard of counters of the calling thread */
+static __thread int cpStatsShard = -1;
+static int cpStatsNextShard = 0;
+/* dispatched code path (the same for all the functions) */
+static int cpStatsCpuIdx = 0;
+
+static int cpStatsGetShard( void )
+{
+   if( cpStatsShard < 0 )
+      cpStatsShard = __atomic_fetch_add( &cpStatsNextShard, 1, __ATOMIC_RELAXED ) % CP_STATS_SHARDS;
+   return cpStatsShard;
+}
+
+static int cpStatsHistBin( Ipp64u cycles )
+{
+   int bin = 0;
+   for( cycles >>= 5; cycles && bin<IPPCP_STATS_HIST_BINS-1; cycles >>= 1 )
+      bin++;
+   return bin;
+}
+
+/*
+// called by the instrumented dispatcher after each call,
+// the counters are updated lock-free (atomic adds on the shard of the calling thread)
+*/
+void owncpStatsRecord( int funcId, int cpuIdx, Ipp64u bytes, Ipp64u cycles )
+{
+   cpStatsCounter* pCnt = cpStatsCounters + (Ipp64u)cpStatsGetShard()*(Ipp64u)cpStatsNumFuncs + (Ipp64u)funcId;
+
+   __atomic_fetch_add( &pCnt->calls, 1, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &pCnt->bytes, bytes, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &pCnt->cycles, cycles, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &pCnt->cyclesHist[cpStatsHistBin( cycles )], 1, __ATOMIC_RELAXED );
+
+   /* written once in practice, no stores to the shared line afterwards */
+   if( __atomic_load_n( &cpStatsCpuIdx, __ATOMIC_RELAXED ) != cpuIdx )
+      __atomic_store_n( &cpStatsCpuIdx, cpuIdx, __ATOMIC_RELAXED );
+}
+
+/* sum of the shards */
+static void cpStatsCollect( IppcpStatsEntry* pEntry, int funcId )
+{
+   int shard, bin;
+   int cpuIdx = __atomic_load_n( &cpStatsCpuIdx, __ATOMIC_RELAXED );
+
+   pEntry->pFuncName = cpStatsFuncName[funcId];
+   pEntry->pCpuName  = (cpuIdx < cpStatsNumCpus)? cpStatsCpuName[cpuIdx] : "";
+   pEntry->calls = pEntry->bytes = pEntry->cycles = 0;
+   for( bin = 0; bin < IPPCP_STATS_HIST_BINS; bin++ )
+      pEntry->cyclesHist[bin] = 0;
+
+   for( shard = 0; shard < CP_STATS_SHARDS; shard++ ) {
+      const cpStatsCounter* pCnt = cpStatsCounters + (Ipp64u)shard*(Ipp64u)cpStatsNumFuncs + (Ipp64u)funcId;
+      pEntry->calls  += __atomic_load_n( &pCnt->calls, __ATOMIC_RELAXED );
+      pEntry->bytes  += __atomic_load_n( &pCnt->bytes, __ATOMIC_RELAXED );
+      pEntry->cycles += __atomic_load_n( &pCnt->cycles, __ATOMIC_RELAXED );
+      for( bin = 0; bin < IPPCP_STATS_HIST_BINS; bin++ )
+         pEntry->cyclesHist[bin] += __atomic_load_n( &pCnt->cyclesHist[bin], __ATOMIC_RELAXED );
+   }
+}
+#endif /* IPPCP_INSTRUMENTATION */
+
+/*F*
+//    Name: ippcpStatsGetNum
+//
+// Purpose: Returns number of the instrumented functions
+//          (the number of entries in the snapshot).
+//
+// Returns:                      Reason:
+//    ippStsNullPtrErr              pNum == NULL
+//    ippStsNotSupportedModeErr     library is built without instrumentation
+//    ippStsNoErr                   no errors
+//
+// Parameters:
+//    pNum     pointer to the number of the instrumented functions
+//
+*F*/
+IPPFUN( IppStatus, ippcpStatsGetNum, ( int* pNum ))
+{
+   IPP_BAD_PTR1_RET( pNum );
+#if defined( IPPCP_INSTRUMENTATION )
+   *pNum = cpStatsNumFuncs;
+   return ippStsNoErr;
+#else
+   *pNum = 0;
+   return ippStsNotSupportedModeErr;
+#endif
+}
+
+/*F*
+//    Name: ippcpStatsGetSnapshot
+//
+// Purpose: Takes a snapshot of the counters of all the instrumented functions.
+//          Counters are summed over all threads, the calls running concurrently
+//          may be partially accounted.
+//
+// Returns:                      Reason:
+//    ippStsNullPtrErr              pEntries == NULL
+//    ippStsSizeErr                 num is less than returned by ippcpStatsGetNum()
+//    ippStsNotSupportedModeErr     library is built without instrumentation
+//    ippStsNoErr                   no errors
+//
+// Parameters:
+//    pEntries    pointer to the array of entries
+//    num         number of entries in the array
+//
+*F*/
+IPPFUN( IppStatus, ippcpStatsGetSnapshot, ( IppcpStatsEntry* pEntries, int num ))
+{
+   IPP_BAD_PTR1_RET( pEntries );
+#if defined( IPPCP_INSTRUMENTATION )
+   IPP_BADARG_RET( num < cpStatsNumFuncs, ippStsSizeErr );
+   {
+      int funcId;
+      for( funcId = 0; funcId < cpStatsNumFuncs; funcId++ )
+         cpStatsCollect( pEntries + funcId, funcId );
+      return ippStsNoErr;
+   }
+#else
+   IPP_UNREFERENCED_PARAMETER( num );
+   return ippStsNotSupportedModeErr;
+#endif
+}
+
+/*F*
+//    Name: ippcpStatsReset
+//
+// Purpose: Clears the counters of all the instrumented functions.
+//
+// Returns:                      Reason:
+//    ippStsNotSupportedModeErr     library is built without instrumentation
+//    ippStsNoErr                   no errors
+//
+*F*/
+IPPFUN( IppStatus, ippcpStatsReset, ( void ))
+{
+#if defined( IPPCP_INSTRUMENTATION )
+   Ipp64u n, total = (Ipp64u)CP_STATS_SHARDS*(Ipp64u)cpStatsNumFuncs;
+   for( n = 0; n < total; n++ ) {
+      cpStatsCounter* pCnt = cpStatsCounters + n;
+      int bin;
+      __atomic_store_n( &pCnt->calls, 0, __ATOMIC_RELAXED );
+      __atomic_store_n( &pCnt->bytes, 0, __ATOMIC_RELAXED );
+      __atomic_store_n( &pCnt->cycles, 0, __ATOMIC_RELAXED );
+      for( bin = 0; bin < IPPCP_STATS_HIST_BINS; bin++ )
+         __atomic_store_n( &pCnt->cyclesHist[bin], 0, __ATOMIC_RELAXED );
+   }
+   return ippStsNoErr;
+#else
+   return ippStsNotSupportedModeErr;
+#endif
+}
+
+/*F*
+//    Name: ippcpStatsExport
+//
+// Purpose: Calls the hook for each instrumented function that has been called
+//          since the last reset, e.g. to export the counters to a metrics pipeline.
+//
+// Returns:                      Reason:
+//    ippStsNullPtrErr              hook == NULL
+//    ippStsNotSupportedModeErr     library is built without instrumentation
+//    ippStsNoErr                   no errors
+//
+// Parameters:
+//    hook     callback, receives the entry of the function and pCtx
+//    pCtx     user context passed to the hook
+//
+*F*/
+IPPFUN( IppStatus, ippcpStatsExport, ( IppcpStatsHook hook, void* pCtx ))
+{
+   IPP_BAD_PTR1_RET( hook );
+#if defined( IPPCP_INSTRUMENTATION )
+   {
+      IppcpStatsEntry entry;
+      int funcId;
+      for( funcId = 0; funcId < cpStatsNumFuncs; funcId++ ) {
+         cpStatsCollect( &entry, funcId );
+         if( entry.calls )
+            hook( &entry, pCtx );
+      }
+      return ippStsNoErr;
+   }
+#else
+   IPP_UNREFERENCED_PARAMETER( pCtx );
+   return ippStsNotSupportedModeErr;
+#endif
+}
+
+#endif /* _IPP_DATA */
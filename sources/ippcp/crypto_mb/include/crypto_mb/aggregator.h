@@ -0,0 +1,159 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef AGGREGATOR_H
+#define AGGREGATOR_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+/*
+// Cross-thread request aggregator.
+//
+// Threads submit single jobs into a lock-free queue. The aggregator collects them into
+// batches and runs the multi-buffer kernel once a full batch is available, or runs a
+// partial batch once the oldest queued job has waited longer than the configured deadline.
+// The aggregator owns no threads: batches are dispatched by the threads calling
+// mbx_aggr_submit(), mbx_aggr_poll(), mbx_aggr_wait() and mbx_aggr_flush().
+// The deadline is checked only inside these calls, so an idle aggregator never fires it:
+// the application has to poll (or flush) to bound the latency of the queued jobs.
+//
+// A completed job is not accessed by the aggregator after its callback has been called,
+// so the callback may free or recycle the job. The done flag is set before the callback:
+// if the job has a callback, the callback owns the job and the waiters must not release it.
+*/
+
+#define MBX_AGGR_MAX_LANES   (16)   /* max number of jobs in a batch      */
+#define MBX_AGGR_MAX_ARGS     (8)   /* max number of per-job arguments    */
+#define MBX_AGGR_MAX_SLOTS   (16)   /* max number of batches in flight    */
+
+/*
+// Batch operations.
+// The per-job arguments arg[] are the per-lane pointers of the corresponding
+// multi-buffer API, in the order they appear in that API.
+*/
+enum MBX_AGGR_OP {
+   MBX_AGGR_RSA_PUBLIC,               /* mbx_rsa_public_mb8:             from, to, n                    */
+   MBX_AGGR_RSA_PRIVATE,              /* mbx_rsa_private_mb8:            from, to, d, n                 */
+   MBX_AGGR_RSA_PRIVATE_CRT,          /* mbx_rsa_private_crt_mb8:        from, to, p, q, dp, dq, iq     */
+   MBX_AGGR_X25519_PUBLIC_KEY,        /* mbx_x25519_public_key_mb8:      public, private                */
+   MBX_AGGR_X25519,                   /* mbx_x25519_mb8:                 shared, private, public        */
+   MBX_AGGR_ED25519_PUBLIC_KEY,       /* mbx_ed25519_public_key_mb8:     public, private                */
+   MBX_AGGR_ED25519_SIGN,             /* mbx_ed25519_sign_mb8:           r, s, msg, private, public; len */
+   MBX_AGGR_ED25519_VERIFY,           /* mbx_ed25519_verify_mb8:         r, s, msg, public; len          */
+   MBX_AGGR_NISTP256_ECPUBLIC_KEY,    /* mbx_nistp256_ecpublic_key_mb8:  x, y, z, skey                  */
+   MBX_AGGR_NISTP256_ECDH,            /* mbx_nistp256_ecdh_mb8:          shared, skey, x, y, z          */
+   MBX_AGGR_NISTP256_ECDSA_SIGN,      /* mbx_nistp256_ecdsa_sign_mb8:    r, s, msg, eph_skey, reg_skey  */
+   MBX_AGGR_NISTP256_ECDSA_VERIFY,    /* mbx_nistp256_ecdsa_verify_mb8:  r, s, msg, x, y, z             */
+   MBX_AGGR_NISTP384_ECPUBLIC_KEY,
+   MBX_AGGR_NISTP384_ECDH,
+   MBX_AGGR_NISTP384_ECDSA_SIGN,
+   MBX_AGGR_NISTP384_ECDSA_VERIFY,
+   MBX_AGGR_NISTP521_ECPUBLIC_KEY,
+   MBX_AGGR_NISTP521_ECDH,
+   MBX_AGGR_NISTP521_ECDSA_SIGN,
+   MBX_AGGR_NISTP521_ECDSA_VERIFY,
+   MBX_AGGR_SM3_MSG_DIGEST,           /* mbx_sm3_msg_digest_mb16:        msg, hash; len                 */
+   MBX_AGGR_CUSTOM                    /* user-provided batch function                                   */
+};
+
+/*
+// The Z-coordinate arguments of the EC operations are optional:
+// if z is NULL in every job of a batch, the batch is processed in affine coordinates.
+*/
+
+typedef struct _mbx_aggr_job mbx_aggr_job;
+
+/* completion callback, called by the dispatching thread */
+typedef void (*mbx_aggr_complete_func)(mbx_aggr_job* pJob);
+
+/* user batch function for MBX_AGGR_CUSTOM, returns 4-bit lane statuses */
+typedef mbx_status16 (*mbx_aggr_batch_func)(mbx_aggr_job* const pa_job[], int numJobs, void* pCtx);
+
+struct _mbx_aggr_job {
+   const void*             arg[MBX_AGGR_MAX_ARGS];  /* per-lane arguments of the batch API          */
+   int32u                  len;                     /* per-lane length (message length)            */
+   mbx_aggr_complete_func  complete;                /* completion callback (optional)              */
+   void*                   pUserData;               /* opaque user pointer                         */
+
+   /* set by the aggregator */
+   volatile int32u         done;                    /* non-zero when processed (before the callback) */
+   mbx_status              status;                  /* lane status of the job: MBX_STATUS_xxx      */
+};
+
+typedef struct {
+   enum MBX_AGGR_OP     op;              /* batch operation                                                 */
+   int                  width;           /* jobs per batch, MBX_AGGR_CUSTOM only (1..MBX_AGGR_MAX_LANES)     */
+   int                  queueSize;       /* queue capacity in jobs, power of 2                              */
+   int                  numSlots;        /* max number of batches processed concurrently (1..MBX_AGGR_MAX_SLOTS) */
+   int64u               deadline;        /* max time a job waits for a full batch, in CPU clocks            */
+   int                  rsaBitsize;      /* RSA operations only: modulus size                               */
+   mbx_aggr_batch_func  customFunc;      /* MBX_AGGR_CUSTOM only: batch function                            */
+   void*                pCustomCtx;      /* MBX_AGGR_CUSTOM only: batch function context                    */
+} mbx_aggr_config;
+
+/* fill and latency counters */
+typedef struct {
+   int64u   batches;                          /* number of dispatched batches                       */
+   int64u   jobs;                             /* number of processed jobs                           */
+   int64u   partialBatches;                   /* batches dispatched on deadline or flush            */
+   int64u   fill[MBX_AGGR_MAX_LANES+1];       /* fill[n] - number of batches carrying n jobs        */
+   int64u   waitClocks;                       /* total queue wait time of all jobs, in CPU clocks  */
+   int64u   maxWaitClocks;                    /* max queue wait time of a job, in CPU clocks       */
+} mbx_aggr_stats;
+
+typedef struct _mbx_aggregator mbx_aggregator;
+
+/*
+// Returns size of the aggregator context for the configuration, 0 if the configuration is invalid
+*/
+MBXAPI(int, mbx_aggr_get_size,(const mbx_aggr_config* pConfig))
+
+/*
+// Initializes the aggregator context in the buffer of mbx_aggr_get_size() bytes
+*/
+MBXAPI(mbx_status, mbx_aggr_init,(mbx_aggregator* pAggr, int ctxSize, const mbx_aggr_config* pConfig))
+
+/*
+// Queues the job; dispatches full batches and expired partial batches. If the queue is full, the calling thread
+// helps to drain it. The job must stay valid until it is completed: until done is set if it has no callback,
+// until the callback is called otherwise.
+*/
+MBXAPI(mbx_status, mbx_aggr_submit,(mbx_aggregator* pAggr, mbx_aggr_job* pJob))
+
+/*
+// Dispatches full batches and expired partial batches, returns number of processed jobs
+*/
+MBXAPI(int, mbx_aggr_poll,(mbx_aggregator* pAggr))
+
+/*
+// Dispatches all queued jobs regardless of the deadline, returns number of processed jobs
+*/
+MBXAPI(int, mbx_aggr_flush,(mbx_aggregator* pAggr))
+
+/*
+// Waits for completion of the job, dispatching batches meanwhile; returns the job status.
+// Not for the jobs whose callback releases them.
+*/
+MBXAPI(mbx_status, mbx_aggr_wait,(mbx_aggregator* pAggr, mbx_aggr_job* pJob))
+
+/*
+// Snapshot and reset of the fill and latency counters
+*/
+MBXAPI(mbx_status, mbx_aggr_get_stats,(const mbx_aggregator* pAggr, mbx_aggr_stats* pStats))
+MBXAPI(mbx_status, mbx_aggr_reset_stats,(mbx_aggregator* pAggr))
+
+#endif /* AGGREGATOR_H */
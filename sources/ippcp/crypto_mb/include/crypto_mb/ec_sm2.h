@@ -110,6 +110,53 @@ MBXAPI(mbx_status, mbx_sm2_ecdsa_verify_mb8,(const int8u* const pa_sign_r[8],
                                             const int64u* const pa_pubz[8],
                                                          int8u* pBuffer))
 
+/*
+// SM2 ciphertext overhead: C1 (uncompressed point, 1+2*32 bytes) and C3 (SM3 digest, 32 bytes).
+// Ciphertext is C1 || C3 || C2, C2 has the same length as the message.
+*/
+#define SM2_PKE_OVERHEAD_SIZE (1 + 2*32 + 32)
+
+/*
+// Encrypts messages with SM2 public key encryption
+// pa_ciphertext[]   array of pointers to the ciphertexts (msg_len[] + SM2_PKE_OVERHEAD_SIZE bytes each)
+// pa_msg[]          array of pointers to the messages are being encrypted
+// msg_len[]         array of messages length
+// pa_eph_skey[]     array of pointers to the ephemeral private keys
+// pa_pubx[]         array of pointers to the recipient's public keys X-coordinates
+// pa_puby[]         array of pointers to the recipient's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the recipient's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+//
+// Lane status MBX_STATUS_MISMATCH_PARAM_ERR is also set if the ephemeral key is not in (0, n)
+// or [k]Pb is the point at infinity, the ciphertext is not written then.
+*/
+MBXAPI(mbx_status, mbx_sm2_encrypt_mb8,(int8u* pa_ciphertext[8],
+                           const int8u* const pa_msg[8],
+                                    const int msg_len[8],
+                          const int64u* const pa_eph_skey[8],
+                          const int64u* const pa_pubx[8],
+                          const int64u* const pa_puby[8],
+                          const int64u* const pa_pubz[8],
+                                       int8u* pBuffer))
+
+/*
+// Decrypts SM2 ciphertexts
+// pa_msg[]          array of pointers to the decrypted messages (ct_len[] - SM2_PKE_OVERHEAD_SIZE bytes each)
+// pa_ciphertext[]   array of pointers to the ciphertexts
+// ct_len[]          array of ciphertexts length
+// pa_skey[]         array of pointers to the recipient's private keys
+// pBuffer           pointer to the scratch buffer
+//
+// Lane status MBX_STATUS_SIGNATURE_ERR means C3 check failed, the output message is zeroed.
+// Lane status MBX_STATUS_MISMATCH_PARAM_ERR is also set if the private key is not in (0, n)
+// or [dB]C1 is the point at infinity.
+*/
+MBXAPI(mbx_status, mbx_sm2_decrypt_mb8,(int8u* pa_msg[8],
+                           const int8u* const pa_ciphertext[8],
+                                    const int ct_len[8],
+                          const int64u* const pa_skey[8],
+                                       int8u* pBuffer))
+
 /*
 // OpenSSL's specific similar APIs
 */
@@ -21,6 +21,7 @@
 #define _MBX_K1 2
 
 #if defined( _L9 ) || (_K1)
+   #include "aggregator_cpuspc.h"
    #include "ec_nistp256_cpuspc.h"
    #include "ec_nistp384_cpuspc.h"
    #include "ec_nistp521_cpuspc.h"
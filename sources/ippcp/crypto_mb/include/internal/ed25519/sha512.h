@@ -173,6 +173,14 @@ void SHA512Init(SHA512State* pState);
 void SHA512Update(const int8u* pSrc, int len, SHA512State* pState);
 void SHA512Final(int8u* pMD, SHA512State* pState);
 
+/*
+// SHA512 of 8 buffers: hash_pa[n] = SHA512(prefix_pa[n] || msg_pa[n]).
+// prefixLen (< MBS_SHA512) is common for all buffers, buffers with hash_pa[n]==NULL are skipped.
+*/
+void sha512_msg_digest_mb8(int8u* hash_pa[8],
+                           const int8u* const prefix_pa[8], int prefixLen,
+                           const int8u* const msg_pa[8], const int32u msgLen[8]);
+
 #endif /* #if (_MBX>=_MBX_K1) */
 
 #endif /* SHA_512_H */
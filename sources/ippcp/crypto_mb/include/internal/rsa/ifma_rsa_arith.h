@@ -403,4 +403,12 @@ EXTERN_C void ifma_normalize_ams_52xN_mb4(void *out_mb4, const void *in_mb4, con
 
 #endif /* #if (_MBX >= _MBX_K1) */
 
+#if (_MBX == _MBX_L9)
+/* AVX2 x25519, status of the 4 buffers is returned in the low 16 bits */
+mbx_status
+   MB_FUNC_NAME(internal_avx2_x25519_)(int8u *const pa_shared_key[4], const int8u *const pa_private_key[4], const int8u *const pa_public_key[4]);
+
+mbx_status MB_FUNC_NAME(internal_avx2_x25519_public_key_)(int8u *const pa_public_key[4], const int8u *const pa_private_key[4]);
+#endif /* #if (_MBX == _MBX_L9) */
+
 #endif /* _IFMA_INTERNAL_H_ */
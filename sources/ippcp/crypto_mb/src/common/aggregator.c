@@ -0,0 +1,627 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+
+#include <crypto_mb/aggregator.h>
+#include <crypto_mb/rsa.h>
+#include <crypto_mb/x25519.h>
+#include <crypto_mb/ed25519.h>
+#include <crypto_mb/ec_nistp256.h>
+#include <crypto_mb/ec_nistp384.h>
+#include <crypto_mb/ec_nistp521.h>
+#include <crypto_mb/sm3.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+   #include <intrin.h>
+#else
+   #include <x86intrin.h>
+#endif
+
+/*
+// Atomics
+// (sequentially consistent on x86; compiler barriers keep the ordering of the plain accesses)
+*/
+#if defined(_MSC_VER) && !defined(__clang__)
+__MBX_INLINE int64u aggr_load64(const volatile int64u* p)  { int64u v = *p; _ReadWriteBarrier(); return v; }
+__MBX_INLINE void   aggr_store64(volatile int64u* p, int64u v) { _ReadWriteBarrier(); *p = v; }
+__MBX_INLINE int    aggr_cas64(volatile int64u* p, int64u expected, int64u desired)
+{ return expected == (int64u)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)desired, (__int64)expected); }
+__MBX_INLINE int64u aggr_add64(volatile int64u* p, int64u v)
+{ return (int64u)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)v); }
+__MBX_INLINE int32u aggr_load32(const volatile int32u* p)  { int32u v = *p; _ReadWriteBarrier(); return v; }
+__MBX_INLINE void   aggr_store32(volatile int32u* p, int32u v) { _ReadWriteBarrier(); *p = v; }
+__MBX_INLINE int    aggr_cas32(volatile int32u* p, int32u expected, int32u desired)
+{ return expected == (int32u)_InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected); }
+#else
+__MBX_INLINE int64u aggr_load64(const volatile int64u* p)  { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+__MBX_INLINE void   aggr_store64(volatile int64u* p, int64u v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+__MBX_INLINE int    aggr_cas64(volatile int64u* p, int64u expected, int64u desired)
+{ return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+__MBX_INLINE int64u aggr_add64(volatile int64u* p, int64u v) { return __atomic_fetch_add(p, v, __ATOMIC_RELAXED); }
+__MBX_INLINE int32u aggr_load32(const volatile int32u* p)  { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+__MBX_INLINE void   aggr_store32(volatile int32u* p, int32u v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+__MBX_INLINE int    aggr_cas32(volatile int32u* p, int32u expected, int32u desired)
+{ return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+#endif
+
+#define AGGR_ID         (0x41474752)   /* "AGGR" */
+#define AGGR_ALIGNMENT  (64)
+
+/* queue cell (bounded MPMC queue, sequence number per cell) */
+typedef struct {
+   volatile int64u   seq;
+   mbx_aggr_job*     pJob;
+   volatile int64u   stamp;      /* submit time of the job */
+} aggr_cell;
+
+typedef mbx_status16 (*aggr_run_func)(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer);
+
+struct _mbx_aggregator {
+   int32u               idCtx;
+   enum MBX_AGGR_OP     op;
+   int                  width;
+   int                  numSlots;
+   int64u               deadline;
+   int64u               mask;          /* queueSize-1 */
+   int                  rsaBitsize;
+   const mbx_RSA_Method* pRsaMethod;
+   int                  bufferSize;    /* scratch size per slot */
+   aggr_run_func        runFunc;
+   mbx_aggr_batch_func  customFunc;
+   void*                pCustomCtx;
+   aggr_cell*           pCells;
+   int8u*               pBuffers;
+
+   __ALIGN64 volatile int64u enqPos;
+   __ALIGN64 volatile int64u deqPos;
+   __ALIGN64 volatile int32u slots;    /* busy slots mask */
+
+   /* counters */
+   __ALIGN64 volatile int64u cntBatches;
+   volatile int64u      cntJobs;
+   volatile int64u      cntPartial;
+   volatile int64u      cntFill[MBX_AGGR_MAX_LANES+1];
+   volatile int64u      cntWait;
+   volatile int64u      cntMaxWait;
+};
+
+#define AGGR_VALID_ID(ctx)  ((ctx)->idCtx == (int32u)AGGR_ID)
+
+/*
+// Batch runners
+// Unused lanes are passed as NULL pointers; the multi-buffer APIs skip such lanes.
+*/
+#define LANE_ARGS(a)  (void*)pa_arg[(a)]
+
+#define GATHER_ARGS(nargs) \
+   const void* pa_arg[MBX_AGGR_MAX_ARGS][MBX_AGGR_MAX_LANES] = {{0}}; \
+   int32u lens[MBX_AGGR_MAX_LANES] = {0}; \
+   aggr_gather(pa_arg, lens, pa_job, numJobs, (nargs));
+
+static void aggr_gather(const void* pa_arg[MBX_AGGR_MAX_ARGS][MBX_AGGR_MAX_LANES], int32u lens[MBX_AGGR_MAX_LANES],
+                        mbx_aggr_job* const pa_job[], int numJobs, int numArgs)
+{
+   int lane, a;
+   for(lane=0; lane<numJobs; lane++) {
+      for(a=0; a<numArgs; a++)
+         pa_arg[a][lane] = pa_job[lane]->arg[a];
+      lens[lane] = pa_job[lane]->len;
+   }
+}
+
+/* NULL if no job of the batch provides the argument */
+static void* aggr_opt_arg(const void* pa[MBX_AGGR_MAX_LANES], int numJobs)
+{
+   int lane;
+   for(lane=0; lane<numJobs; lane++)
+      if(pa[lane]) return (void*)pa;
+   return NULL;
+}
+
+static mbx_status16 run_rsa_public(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(3)
+   MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_rsa_public_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), pAggr->rsaBitsize, pAggr->pRsaMethod, pBuffer);
+}
+
+static mbx_status16 run_rsa_private(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(4)
+   MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_rsa_private_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), LANE_ARGS(3), pAggr->rsaBitsize, pAggr->pRsaMethod, pBuffer);
+}
+
+static mbx_status16 run_rsa_private_crt(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(7)
+   MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_rsa_private_crt_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), LANE_ARGS(3), LANE_ARGS(4), LANE_ARGS(5), LANE_ARGS(6),
+                                  pAggr->rsaBitsize, pAggr->pRsaMethod, pBuffer);
+}
+
+static mbx_status16 run_x25519_public_key(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(2)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer); MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_x25519_public_key_mb8(LANE_ARGS(0), LANE_ARGS(1));
+}
+
+static mbx_status16 run_x25519(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(3)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer); MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_x25519_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2));
+}
+
+static mbx_status16 run_ed25519_public_key(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(2)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer); MBX_UNREFERENCED_PARAMETER(lens);
+   return mbx_ed25519_public_key_mb8(LANE_ARGS(0), LANE_ARGS(1));
+}
+
+static mbx_status16 run_ed25519_sign(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(5)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return mbx_ed25519_sign_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), lens, LANE_ARGS(3), LANE_ARGS(4));
+}
+
+static mbx_status16 run_ed25519_verify(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(4)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return mbx_ed25519_verify_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), lens, LANE_ARGS(3));
+}
+
+#define EC_RUNNERS(curve) \
+static mbx_status16 run_##curve##_ecpublic_key(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer) \
+{ \
+   GATHER_ARGS(4) \
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(lens); \
+   return mbx_##curve##_ecpublic_key_mb8(LANE_ARGS(0), LANE_ARGS(1), aggr_opt_arg(pa_arg[2], numJobs), LANE_ARGS(3), pBuffer); \
+} \
+static mbx_status16 run_##curve##_ecdh(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer) \
+{ \
+   GATHER_ARGS(5) \
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(lens); \
+   return mbx_##curve##_ecdh_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), LANE_ARGS(3), aggr_opt_arg(pa_arg[4], numJobs), pBuffer); \
+} \
+static mbx_status16 run_##curve##_ecdsa_sign(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer) \
+{ \
+   GATHER_ARGS(5) \
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(lens); \
+   return mbx_##curve##_ecdsa_sign_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), LANE_ARGS(3), LANE_ARGS(4), pBuffer); \
+} \
+static mbx_status16 run_##curve##_ecdsa_verify(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer) \
+{ \
+   GATHER_ARGS(6) \
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(lens); \
+   return mbx_##curve##_ecdsa_verify_mb8(LANE_ARGS(0), LANE_ARGS(1), LANE_ARGS(2), LANE_ARGS(3), LANE_ARGS(4), \
+                                         aggr_opt_arg(pa_arg[5], numJobs), pBuffer); \
+}
+
+EC_RUNNERS(nistp256)
+EC_RUNNERS(nistp384)
+EC_RUNNERS(nistp521)
+
+static mbx_status16 run_sm3_msg_digest(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   GATHER_ARGS(2)
+   MBX_UNREFERENCED_PARAMETER(pAggr); MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return mbx_sm3_msg_digest_mb16(LANE_ARGS(0), (int*)lens, LANE_ARGS(1));
+}
+
+static mbx_status16 run_custom(mbx_aggregator* pAggr, mbx_aggr_job* const pa_job[], int numJobs, int8u* pBuffer)
+{
+   MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return pAggr->customFunc(pa_job, numJobs, pAggr->pCustomCtx);
+}
+
+/* runner and batch width per operation, in the order of enum MBX_AGGR_OP */
+static const struct {
+   aggr_run_func  run;
+   int            width;
+} aggr_ops[] = {
+   { run_rsa_public,               8 },
+   { run_rsa_private,              8 },
+   { run_rsa_private_crt,          8 },
+   { run_x25519_public_key,        8 },
+   { run_x25519,                   8 },
+   { run_ed25519_public_key,       8 },
+   { run_ed25519_sign,             8 },
+   { run_ed25519_verify,           8 },
+   { run_nistp256_ecpublic_key,    8 },
+   { run_nistp256_ecdh,            8 },
+   { run_nistp256_ecdsa_sign,      8 },
+   { run_nistp256_ecdsa_verify,    8 },
+   { run_nistp384_ecpublic_key,    8 },
+   { run_nistp384_ecdh,            8 },
+   { run_nistp384_ecdsa_sign,      8 },
+   { run_nistp384_ecdsa_verify,    8 },
+   { run_nistp521_ecpublic_key,    8 },
+   { run_nistp521_ecdh,            8 },
+   { run_nistp521_ecdsa_sign,      8 },
+   { run_nistp521_ecdsa_verify,    8 },
+   { run_sm3_msg_digest,          16 },
+   { run_custom,                   0 },
+};
+
+/* RSA method of the operation (NULL for non-RSA operations) */
+static const mbx_RSA_Method* aggr_rsa_method(const mbx_aggr_config* pConfig)
+{
+   switch(pConfig->op) {
+   case MBX_AGGR_RSA_PUBLIC:      return mbx_RSA_pub65537_Method(pConfig->rsaBitsize);
+   case MBX_AGGR_RSA_PRIVATE:     return mbx_RSA_private_Method(pConfig->rsaBitsize);
+   case MBX_AGGR_RSA_PRIVATE_CRT: return mbx_RSA_private_crt_Method(pConfig->rsaBitsize);
+   default:                       return NULL;
+   }
+}
+
+/* checks the configuration, returns scratch buffer size per slot or -1 */
+static int aggr_check_config(const mbx_aggr_config* pConfig)
+{
+   int queueSize;
+   if(NULL==pConfig)
+      return -1;
+   if((int)pConfig->op<MBX_AGGR_RSA_PUBLIC || (int)pConfig->op>MBX_AGGR_CUSTOM)
+      return -1;
+
+   queueSize = pConfig->queueSize;
+   if(queueSize<=0 || (queueSize & (queueSize-1)))
+      return -1;
+   if(pConfig->numSlots<1 || pConfig->numSlots>MBX_AGGR_MAX_SLOTS)
+      return -1;
+
+   if(MBX_AGGR_CUSTOM==pConfig->op) {
+      if(NULL==pConfig->customFunc || pConfig->width<1 || pConfig->width>MBX_AGGR_MAX_LANES)
+         return -1;
+      return 0;
+   }
+   if(MBX_AGGR_RSA_PUBLIC==pConfig->op || MBX_AGGR_RSA_PRIVATE==pConfig->op || MBX_AGGR_RSA_PRIVATE_CRT==pConfig->op) {
+      const mbx_RSA_Method* m = aggr_rsa_method(pConfig);
+      if(NULL==m)
+         return -1;
+      return mbx_RSA_Method_BufSize(m);
+   }
+   return 0;
+}
+
+static int aggr_ctx_size(int bufferSize, int queueSize, int numSlots)
+{
+   bufferSize = (bufferSize + AGGR_ALIGNMENT-1) & ~(AGGR_ALIGNMENT-1);
+   return (int)sizeof(mbx_aggregator) + AGGR_ALIGNMENT-1
+        + queueSize*(int)sizeof(aggr_cell) + AGGR_ALIGNMENT-1
+        + numSlots*bufferSize;
+}
+
+DLL_PUBLIC
+int OWNAPI(mbx_aggr_get_size)(const mbx_aggr_config* pConfig)
+{
+   int bufferSize = aggr_check_config(pConfig);
+   if(bufferSize<0)
+      return 0;
+   return aggr_ctx_size(bufferSize, pConfig->queueSize, pConfig->numSlots);
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_aggr_init)(mbx_aggregator* pCtx, int ctxSize, const mbx_aggr_config* pConfig)
+{
+   mbx_aggregator* pAggr;
+   int bufferSize, n;
+   int64u i;
+
+   if(NULL==pCtx || NULL==pConfig)
+      return MBX_STATUS_NULL_PARAM_ERR;
+
+   bufferSize = aggr_check_config(pConfig);
+   if(bufferSize<0 || ctxSize<aggr_ctx_size(bufferSize, pConfig->queueSize, pConfig->numSlots))
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   pAggr = pCtx;
+   for(n=0; n<(int)sizeof(mbx_aggregator); n++)
+      ((int8u*)pAggr)[n] = 0;
+
+   pAggr->op         = pConfig->op;
+   pAggr->width      = (MBX_AGGR_CUSTOM==pConfig->op)? pConfig->width : aggr_ops[pConfig->op].width;
+   pAggr->numSlots   = pConfig->numSlots;
+   pAggr->deadline   = pConfig->deadline;
+   pAggr->mask       = (int64u)(pConfig->queueSize-1);
+   pAggr->rsaBitsize = pConfig->rsaBitsize;
+   pAggr->pRsaMethod = aggr_rsa_method(pConfig);
+   pAggr->bufferSize = (bufferSize + AGGR_ALIGNMENT-1) & ~(AGGR_ALIGNMENT-1);
+   pAggr->runFunc    = aggr_ops[pConfig->op].run;
+   pAggr->customFunc = pConfig->customFunc;
+   pAggr->pCustomCtx = pConfig->pCustomCtx;
+
+   pAggr->pCells   = (aggr_cell*)IFMA_ALIGNED_PTR((int8u*)pAggr + sizeof(mbx_aggregator), AGGR_ALIGNMENT);
+   pAggr->pBuffers = (int8u*)IFMA_ALIGNED_PTR((int8u*)(pAggr->pCells + pConfig->queueSize), AGGR_ALIGNMENT);
+
+   for(i=0; i<=pAggr->mask; i++) {
+      pAggr->pCells[i].seq   = i;
+      pAggr->pCells[i].pJob  = NULL;
+      pAggr->pCells[i].stamp = 0;
+   }
+
+   pAggr->idCtx = AGGR_ID;
+   return MBX_STATUS_OK;
+}
+
+/*
+// Queue operations
+*/
+static int aggr_enqueue(mbx_aggregator* pAggr, mbx_aggr_job* pJob)
+{
+   aggr_cell* pCell;
+   int64u pos = aggr_load64(&pAggr->enqPos);
+   for(;;) {
+      long long dif;
+      pCell = pAggr->pCells + (pos & pAggr->mask);
+      dif = (long long)(aggr_load64(&pCell->seq) - pos);
+      if(0==dif) {
+         if(aggr_cas64(&pAggr->enqPos, pos, pos+1))
+            break;
+         pos = aggr_load64(&pAggr->enqPos);
+      }
+      else if(dif<0)
+         return 0; /* full */
+      else
+         pos = aggr_load64(&pAggr->enqPos);
+   }
+   pCell->pJob = pJob;
+   aggr_store64(&pCell->stamp, __rdtsc());
+   aggr_store64(&pCell->seq, pos+1);
+   return 1;
+}
+
+static int aggr_dequeue(mbx_aggregator* pAggr, mbx_aggr_job** ppJob, int64u* pStamp)
+{
+   aggr_cell* pCell;
+   int64u pos = aggr_load64(&pAggr->deqPos);
+   for(;;) {
+      long long dif;
+      pCell = pAggr->pCells + (pos & pAggr->mask);
+      dif = (long long)(aggr_load64(&pCell->seq) - (pos+1));
+      if(0==dif) {
+         if(aggr_cas64(&pAggr->deqPos, pos, pos+1))
+            break;
+         pos = aggr_load64(&pAggr->deqPos);
+      }
+      else if(dif<0)
+         return 0; /* empty */
+      else
+         pos = aggr_load64(&pAggr->deqPos);
+   }
+   *ppJob  = pCell->pJob;
+   *pStamp = aggr_load64(&pCell->stamp);
+   aggr_store64(&pCell->seq, pos + pAggr->mask + 1);
+   return 1;
+}
+
+static int64u aggr_pending(const mbx_aggregator* pAggr)
+{
+   int64u deq = aggr_load64(&pAggr->deqPos);
+   int64u enq = aggr_load64(&pAggr->enqPos);
+   return (enq>deq)? enq-deq : 0;
+}
+
+/* non-zero if the oldest queued job has been waiting longer than the deadline */
+static int aggr_expired(mbx_aggregator* pAggr)
+{
+   int64u pos = aggr_load64(&pAggr->deqPos);
+   const aggr_cell* pCell = pAggr->pCells + (pos & pAggr->mask);
+   if(aggr_load64(&pCell->seq) != pos+1)
+      return 0;
+   return (__rdtsc() - aggr_load64(&pCell->stamp)) >= pAggr->deadline;
+}
+
+/*
+// Slots: each running batch owns a slot and its scratch buffer
+*/
+static int aggr_acquire_slot(mbx_aggregator* pAggr)
+{
+   int slot;
+   for(slot=0; slot<pAggr->numSlots; slot++) {
+      int32u busy = aggr_load32(&pAggr->slots);
+      if(busy & (1u<<slot))
+         continue;
+      if(aggr_cas32(&pAggr->slots, busy, busy | (1u<<slot)))
+         return slot;
+      slot = -1; /* mask changed, rescan */
+   }
+   return -1;
+}
+
+static void aggr_release_slot(mbx_aggregator* pAggr, int slot)
+{
+   int32u busy = aggr_load32(&pAggr->slots);
+   while(!aggr_cas32(&pAggr->slots, busy, busy & ~(1u<<slot)))
+      busy = aggr_load32(&pAggr->slots);
+}
+
+static void aggr_update_max(volatile int64u* pMax, int64u val)
+{
+   int64u cur = aggr_load64(pMax);
+   while(val>cur && !aggr_cas64(pMax, cur, val))
+      cur = aggr_load64(pMax);
+}
+
+/*
+// Dequeues up to width jobs and runs them as one batch, returns number of processed jobs
+*/
+static int aggr_dispatch(mbx_aggregator* pAggr)
+{
+   mbx_aggr_job* pa_job[MBX_AGGR_MAX_LANES];
+   int64u stamp[MBX_AGGR_MAX_LANES];
+   int64u now, wait = 0, maxWait = 0;
+   mbx_status16 status;
+   int numJobs = 0, lane;
+
+   int slot = aggr_acquire_slot(pAggr);
+   if(slot<0)
+      return 0;
+
+   while(numJobs<pAggr->width && aggr_dequeue(pAggr, &pa_job[numJobs], &stamp[numJobs]))
+      numJobs++;
+   if(0==numJobs) {
+      aggr_release_slot(pAggr, slot);
+      return 0;
+   }
+
+   now = __rdtsc();
+   for(lane=0; lane<numJobs; lane++) {
+      int64u w = (now>stamp[lane])? now-stamp[lane] : 0;
+      wait += w;
+      maxWait = (w>maxWait)? w : maxWait;
+   }
+
+   status = pAggr->runFunc(pAggr, pa_job, numJobs, pAggr->pBuffers + (int64u)slot*(int64u)pAggr->bufferSize);
+   aggr_release_slot(pAggr, slot);
+
+   aggr_add64(&pAggr->cntBatches, 1);
+   aggr_add64(&pAggr->cntJobs, (int64u)numJobs);
+   aggr_add64(&pAggr->cntFill[numJobs], 1);
+   if(numJobs<pAggr->width)
+      aggr_add64(&pAggr->cntPartial, 1);
+   aggr_add64(&pAggr->cntWait, wait);
+   aggr_update_max(&pAggr->cntMaxWait, maxWait);
+
+   /* complete jobs */
+   for(lane=0; lane<numJobs; lane++) {
+      mbx_aggr_job* pJob = pa_job[lane];
+      mbx_aggr_complete_func complete = pJob->complete;
+      pJob->status = (mbx_status)((status >> (lane*4)) & 0xF);
+      aggr_store32(&pJob->done, 1);
+      /* the callback may release the job, it is not accessed afterwards */
+      if(complete)
+         complete(pJob);
+   }
+   return numJobs;
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_aggr_submit)(mbx_aggregator* pAggr, mbx_aggr_job* pJob)
+{
+   if(NULL==pAggr || NULL==pJob)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if(!AGGR_VALID_ID(pAggr))
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   pJob->done   = 0;
+   pJob->status = MBX_STATUS_OK;
+
+   /* queue is full: help to drain it */
+   while(!aggr_enqueue(pAggr, pJob)) {
+      if(!aggr_dispatch(pAggr))
+         _mm_pause();
+   }
+
+   /* dispatch full batches, expired partial ones, or the job itself if no batching delay is allowed */
+   while(aggr_pending(pAggr) >= (int64u)pAggr->width || aggr_expired(pAggr) || (0==pAggr->deadline && aggr_pending(pAggr))) {
+      if(!aggr_dispatch(pAggr))
+         break; /* all slots busy, their owners will pick the jobs up */
+   }
+   return MBX_STATUS_OK;
+}
+
+DLL_PUBLIC
+int OWNAPI(mbx_aggr_poll)(mbx_aggregator* pAggr)
+{
+   int processed = 0;
+   if(NULL==pAggr || !AGGR_VALID_ID(pAggr))
+      return 0;
+
+   while(aggr_pending(pAggr) >= (int64u)pAggr->width || aggr_expired(pAggr)) {
+      int n = aggr_dispatch(pAggr);
+      if(!n)
+         break;
+      processed += n;
+   }
+   return processed;
+}
+
+DLL_PUBLIC
+int OWNAPI(mbx_aggr_flush)(mbx_aggregator* pAggr)
+{
+   int processed = 0;
+   if(NULL==pAggr || !AGGR_VALID_ID(pAggr))
+      return 0;
+
+   while(aggr_pending(pAggr)) {
+      int n = aggr_dispatch(pAggr);
+      if(!n) {
+         _mm_pause();
+         continue;
+      }
+      processed += n;
+   }
+   return processed;
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_aggr_wait)(mbx_aggregator* pAggr, mbx_aggr_job* pJob)
+{
+   if(NULL==pAggr || NULL==pJob)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if(!AGGR_VALID_ID(pAggr))
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   while(!aggr_load32(&pJob->done)) {
+      if(!OWNAPI(mbx_aggr_poll)(pAggr))
+         _mm_pause();
+   }
+   return pJob->status;
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_aggr_get_stats)(const mbx_aggregator* pAggr, mbx_aggr_stats* pStats)
+{
+   int n;
+   if(NULL==pAggr || NULL==pStats)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if(!AGGR_VALID_ID(pAggr))
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   pStats->batches        = aggr_load64(&pAggr->cntBatches);
+   pStats->jobs           = aggr_load64(&pAggr->cntJobs);
+   pStats->partialBatches = aggr_load64(&pAggr->cntPartial);
+   for(n=0; n<=MBX_AGGR_MAX_LANES; n++)
+      pStats->fill[n] = aggr_load64(&pAggr->cntFill[n]);
+   pStats->waitClocks     = aggr_load64(&pAggr->cntWait);
+   pStats->maxWaitClocks  = aggr_load64(&pAggr->cntMaxWait);
+   return MBX_STATUS_OK;
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_aggr_reset_stats)(mbx_aggregator* pAggr)
+{
+   int n;
+   if(NULL==pAggr)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if(!AGGR_VALID_ID(pAggr))
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   aggr_store64(&pAggr->cntBatches, 0);
+   aggr_store64(&pAggr->cntJobs, 0);
+   aggr_store64(&pAggr->cntPartial, 0);
+   for(n=0; n<=MBX_AGGR_MAX_LANES; n++)
+      aggr_store64(&pAggr->cntFill[n], 0);
+   aggr_store64(&pAggr->cntWait, 0);
+   aggr_store64(&pAggr->cntMaxWait, 0);
+   return MBX_STATUS_OK;
+}
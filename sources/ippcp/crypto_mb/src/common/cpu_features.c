@@ -262,6 +262,11 @@ int64u mbx_get_cpu_features(void)
                          | mbcpCPUID_AVXIFMA \
                          | mbcpAVX_ENABLEDBYOS)
 
+/* subset of the L9 code path available without AVX-IFMA */
+#define CRYPTO_MB_REQUIRED_CPU_FEATURES_L9_AVX2 ( \
+                           mbcpCPUID_AVX2 \
+                         | mbcpAVX_ENABLEDBYOS)
+
 int internal_is_k1_applicable(int64u cpu_features)
 {
    int64u features = cpu_features;
@@ -278,6 +283,14 @@ int internal_is_l9_applicable(int64u cpu_features)
    return (CRYPTO_MB_REQUIRED_CPU_FEATURES_L9 == (features & CRYPTO_MB_REQUIRED_CPU_FEATURES_L9));
 }
 
+static int internal_is_l9_avx2_applicable(int64u cpu_features)
+{
+   int64u features = cpu_features;
+   if(0 == features)
+      features = mbx_get_cpu_features();
+   return (CRYPTO_MB_REQUIRED_CPU_FEATURES_L9_AVX2 == (features & CRYPTO_MB_REQUIRED_CPU_FEATURES_L9_AVX2));
+}
+
 DLL_PUBLIC
 int mbx_is_crypto_mb_applicable(int64u cpu_features)
 {
@@ -322,7 +335,20 @@ static const algo_width_map arr_algo_width_l9[] = {
    { MBX_ALGO_RSA_2K,       MBX_WIDTH_MB8 },
    { MBX_ALGO_RSA_3K,       MBX_WIDTH_MB8 },
    { MBX_ALGO_RSA_4K,       MBX_WIDTH_MB8 },
-   { MBX_ALGO_X25519,       0 },
+   { MBX_ALGO_X25519,       MBX_WIDTH_MB8 },
+   { MBX_ALGO_EC_NIST_P256, 0 },
+   { MBX_ALGO_EC_NIST_P384, 0 },
+   { MBX_ALGO_EC_NIST_P521, 0 },
+   { MBX_ALGO_EC_SM2,       0 },
+   { MBX_ALGO_SM3,          0 },
+   { MBX_ALGO_SM4,          0 }
+};
+static const algo_width_map arr_algo_width_l9_avx2[] = {
+   { MBX_ALGO_RSA_1K,       0 },
+   { MBX_ALGO_RSA_2K,       0 },
+   { MBX_ALGO_RSA_3K,       0 },
+   { MBX_ALGO_RSA_4K,       0 },
+   { MBX_ALGO_X25519,       MBX_WIDTH_MB8 },
    { MBX_ALGO_EC_NIST_P256, 0 },
    { MBX_ALGO_EC_NIST_P384, 0 },
    { MBX_ALGO_EC_NIST_P521, 0 },
@@ -337,21 +363,25 @@ MBX_ALGO_INFO mbx_get_algo_info(enum MBX_ALGO algo)
 {
    const int k1_applicable = internal_is_k1_applicable(0);
    const int l9_applicable = internal_is_l9_applicable(0);
+   const int l9_avx2_applicable = internal_is_l9_avx2_applicable(0);
    const struct {
            const algo_width_map *arr_algo_width;
            unsigned num_tbl;
    } map_tbl[] = {
            {arr_algo_width_k1, (unsigned) sizeof(arr_algo_width_k1) / sizeof(algo_width_map) }, // K1 = index 0
            {arr_algo_width_l9, (unsigned) sizeof(arr_algo_width_l9) / sizeof(algo_width_map) }, // L9 = index 1
+           {arr_algo_width_l9_avx2, (unsigned) sizeof(arr_algo_width_l9_avx2) / sizeof(algo_width_map) }, // L9 without AVX-IFMA
    };
    int num_width = 0;
 
    /* check CPU feature */
-   if (0 == k1_applicable && 0 == l9_applicable)
+   if (0 == k1_applicable && 0 == l9_applicable && 0 == l9_avx2_applicable)
       return num_width;
 
    /* get selected architecture */
-   const int map_idx = *_mbx_own_get_index();
+   int map_idx = *_mbx_own_get_index();
+   if (1 == map_idx && 0 == l9_applicable)
+      map_idx = 2;
 
    if (map_idx < 0 || map_idx >= (int) (sizeof(map_tbl) / sizeof(map_tbl[0])))
            return num_width;
@@ -26,6 +26,7 @@
 #include <internal/ed25519/ifma_arith_p25519.h>
 #include <internal/ed25519/ifma_arith_n25519.h>
 #include <internal/ed25519/sha512.h>
+#include <internal/common/mem_fns.h>
 
 #if (_MBX>=_MBX_K1)
 
@@ -35,11 +36,18 @@
 
 void ed25519_expand_key(int8u* pa_secret_expand[8], const ed25519_private_key* const pa_secret_key[8])
 {
-   /* do hash of secret keys in sequence */
+   const int8u* pa_no_msg[8] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+   const int32u no_msg_len[8] = { 0 };
+   int8u* pa_hash[8];
+
+   for (int n = 0; n < 8; n++)
+      pa_hash[n] = (NULL != pa_secret_key[n]) ? pa_secret_expand[n] : NULL;
+
+   /* do hash of secret keys in parallel */
+   sha512_msg_digest_mb8(pa_hash, (const int8u* const*)pa_secret_key, sizeof(ed25519_private_key), pa_no_msg, no_msg_len);
+
    for (int n = 0; n < 8; n++) {
-      const ed25519_private_key* psecret = pa_secret_key[n];
-      if (psecret) {
-          SHA512MsgDigest(*psecret, sizeof(ed25519_private_key), pa_secret_expand[n]);
+      if (pa_secret_key[n]) {
          /* prune the buffer according to RFC8032 */
          pa_secret_expand[n][0]  &= 0xf8;
          pa_secret_expand[n][31] &= 0x7f;
@@ -97,41 +105,34 @@ mbx_status internal_avx512_ed25519_public_key_mb8(ed25519_public_key* pa_public_
 */
 static void ed25519_nonce(int8u* pa_nonce[8], int8u* pa_az[8], const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   SHA512State pState;
-
-   for(int n=0; n<8; n++) {
-      int8u* az = pa_az[n] + HASH_LENGTH/2;
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      
-      SHA512Init(&pState);
-      SHA512Update(az, 32, &pState);
-      if (msg)
-          SHA512Update(msg, mlen, &pState);
-      
-      SHA512Final(pa_nonce[n], &pState);
-   }
+   const int8u* pa_prefix[8];
+
+   for(int n=0; n<8; n++)
+      pa_prefix[n] = pa_az[n] + HASH_LENGTH/2;
+
+   sha512_msg_digest_mb8(pa_nonce, pa_prefix, HASH_LENGTH/2, pa_msg, msgLen);
 }
 
+#define R_PUB_LENGTH  (NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8) + sizeof(ed25519_public_key))
+
 static void ed25519_hash_r_pub_msg(int8u* pa_hram[8], const ed25519_sign_component* const pa_sign_r[], const ed25519_public_key* const pa_public_key[8], const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   SHA512State pState;
+   /* r_sign || public_key */
+   __ALIGN64 int8u r_pub[8][R_PUB_LENGTH] = { 0 };
+   const int8u* pa_r_pub[8];
 
    for (int n = 0; n < 8; n++) {
       const ed25519_sign_component* sign_r = pa_sign_r[n];
       const ed25519_public_key* public = pa_public_key[n];
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      SHA512Init(&pState);
 
       if(sign_r)
-          SHA512Update((const int8u*)sign_r, NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8), &pState);
+         CopyBlock(sign_r, r_pub[n], NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8));
       if(public)
-          SHA512Update((const int8u*)public, sizeof(ed25519_public_key), &pState);
-      if(msg)
-          SHA512Update(msg, mlen, &pState);
-      SHA512Final(pa_hram[n], &pState);
+         CopyBlock(public, r_pub[n] + NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8), sizeof(ed25519_public_key));
+      pa_r_pub[n] = r_pub[n];
    }
+
+   sha512_msg_digest_mb8(pa_hram, pa_r_pub, R_PUB_LENGTH, pa_msg, msgLen);
 }
 
 mbx_status MB_FUNC_NAME(internal_avx512_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
@@ -0,0 +1,212 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/ed25519/sha512.h>
+#include <internal/common/mem_fns.h>
+
+#if (_MBX>=_MBX_K1)
+
+#include <immintrin.h>
+
+/* byte order of the 64-bit words */
+static __ALIGN64 const int8u swapBytes64[] = {
+   7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+   7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+   7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+   7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8 };
+
+#define SIMD_ENDIANNESS64(x)  _mm512_shuffle_epi8((x), _mm512_loadu_si512(swapBytes64))
+
+/* SHA512 functions on 8 buffers */
+#define CH_MB8(x,y,z)   _mm512_ternarylogic_epi64((x), (y), (z), 0xCA)
+#define MAJ_MB8(x,y,z)  _mm512_ternarylogic_epi64((x), (y), (z), 0xE8)
+
+#define XOR3_MB8(x,y,z) _mm512_ternarylogic_epi64((x), (y), (z), 0x96)
+
+#define SUM0_MB8(x)     XOR3_MB8(_mm512_ror_epi64((x),28), _mm512_ror_epi64((x),34), _mm512_ror_epi64((x),39))
+#define SUM1_MB8(x)     XOR3_MB8(_mm512_ror_epi64((x),14), _mm512_ror_epi64((x),18), _mm512_ror_epi64((x),41))
+
+#define SIG0_MB8(x)     XOR3_MB8(_mm512_ror_epi64((x), 1), _mm512_ror_epi64((x), 8), _mm512_srli_epi64((x), 7))
+#define SIG1_MB8(x)     XOR3_MB8(_mm512_ror_epi64((x),19), _mm512_ror_epi64((x),61), _mm512_srli_epi64((x), 6))
+
+#define SHA512_UPDATE_MB8(i) \
+   W[(i)&15] = _mm512_add_epi64(_mm512_add_epi64(W[(i)&15], SIG1_MB8(W[((i)+14)&15])), \
+                                _mm512_add_epi64(W[((i)+9)&15], SIG0_MB8(W[((i)+1)&15])))
+
+#define SHA512_STEP_MB8(i,j) { \
+   __m512i T1; \
+   if(j) SHA512_UPDATE_MB8(i); \
+   T1 = _mm512_add_epi64(_mm512_add_epi64(v[(7-(i))&7], W[(i)&15]), _mm512_set1_epi64((long long)sha512_cnt[(i)+(j)])); \
+   T1 = _mm512_add_epi64(T1, _mm512_add_epi64(SUM1_MB8(v[(4-(i))&7]), CH_MB8(v[(4-(i))&7], v[(5-(i))&7], v[(6-(i))&7]))); \
+   v[(3-(i))&7] = _mm512_add_epi64(v[(3-(i))&7], T1); \
+   v[(7-(i))&7] = _mm512_add_epi64(T1, _mm512_add_epi64(SUM0_MB8(v[(0-(i))&7]), MAJ_MB8(v[(0-(i))&7], v[(1-(i))&7], v[(2-(i))&7]))); \
+}
+
+/*
+// Processes numBlks[n] 128-byte blocks of buffer n.
+// The buffers with numBlks[n]==0 are left unchanged.
+*/
+static void sha512_update_mb8(__m512i hash[8], const int8u* const msg_pa[8], const int numBlks[8])
+{
+   __ALIGN64 static const int8u zero_block[MBS_SHA512] = { 0 };
+
+   __m512i loc_data = _mm512_loadu_si512(msg_pa);
+   __m256i loc_blks = _mm256_loadu_si256((const __m256i*)numBlks);
+   __mmask8 mb_mask = _mm256_cmp_epi32_mask(loc_blks, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+
+   /* data of not valid buffers are read from zero block */
+   loc_data = _mm512_mask_set1_epi64(loc_data, (__mmask8)~mb_mask, (long long)zero_block);
+
+   while(mb_mask) {
+      __m512i W[16];
+      __m512i v[8];
+      int i;
+
+      /* load message block (remember about endian) */
+      for(i=0; i<16; i++) {
+         W[i] = _mm512_i64gather_epi64(_mm512_add_epi64(loc_data, _mm512_set1_epi64(i*8)), NULL, 1);
+         W[i] = SIMD_ENDIANNESS64(W[i]);
+      }
+
+      for(i=0; i<8; i++)
+         v[i] = hash[i];
+
+      for(i=0; i<80; i+=16) {
+         SHA512_STEP_MB8( 0, i)
+         SHA512_STEP_MB8( 1, i)
+         SHA512_STEP_MB8( 2, i)
+         SHA512_STEP_MB8( 3, i)
+         SHA512_STEP_MB8( 4, i)
+         SHA512_STEP_MB8( 5, i)
+         SHA512_STEP_MB8( 6, i)
+         SHA512_STEP_MB8( 7, i)
+         SHA512_STEP_MB8( 8, i)
+         SHA512_STEP_MB8( 9, i)
+         SHA512_STEP_MB8(10, i)
+         SHA512_STEP_MB8(11, i)
+         SHA512_STEP_MB8(12, i)
+         SHA512_STEP_MB8(13, i)
+         SHA512_STEP_MB8(14, i)
+         SHA512_STEP_MB8(15, i)
+      }
+
+      /* update digest of the processed buffers */
+      for(i=0; i<8; i++)
+         hash[i] = _mm512_mask_add_epi64(hash[i], mb_mask, hash[i], v[i]);
+
+      /* update pointers to data, number of blocks and mask */
+      loc_data = _mm512_mask_add_epi64(loc_data, mb_mask, loc_data, _mm512_set1_epi64(MBS_SHA512));
+      loc_blks = _mm256_mask_sub_epi32(loc_blks, mb_mask, loc_blks, _mm256_set1_epi32(1));
+      mb_mask = _mm256_cmp_epi32_mask(loc_blks, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+      loc_data = _mm512_mask_set1_epi64(loc_data, (__mmask8)~mb_mask, (long long)zero_block);
+   }
+}
+
+void sha512_msg_digest_mb8(int8u* hash_pa[8],
+                           const int8u* const prefix_pa[8], int prefixLen,
+                           const int8u* const msg_pa[8], const int32u msgLen[8])
+{
+   /* first block (prefix and head of the message) and the last blocks (tail of the message and padding) */
+   __ALIGN64 int8u head[8][MBS_SHA512];
+   __ALIGN64 int8u tail[8][MBS_SHA512*2];
+
+   const int8u* head_pa[8];
+   const int8u* body_pa[8];
+   const int8u* tail_pa[8];
+   __ALIGN64 int headBlks[8];
+   __ALIGN64 int bodyBlks[8];
+   __ALIGN64 int tailBlks[8];
+
+   __m512i hash[8];
+   int n, i;
+
+   for(n=0; n<8; n++) {
+      const int8u* msg = msg_pa[n];
+      int64u len = (NULL != msg)? msgLen[n] : 0;
+      int64u total = (int64u)prefixLen + len;
+      int tailLen;
+
+      head_pa[n] = head[n];
+      body_pa[n] = msg;
+      tail_pa[n] = tail[n];
+      headBlks[n] = bodyBlks[n] = tailBlks[n] = 0;
+
+      if(NULL == hash_pa[n])
+         continue;
+
+      if(total < MBS_SHA512) {
+         /* whole of data is in the tail */
+         CopyBlock(prefix_pa[n], tail[n], prefixLen);
+         CopyBlock(msg, tail[n] + prefixLen, (int)len);
+         tailLen = (int)total;
+      }
+      else {
+         int headMsgLen = MBS_SHA512 - prefixLen;
+         int64u bodyLen = (len - (int64u)headMsgLen) & ~(int64u)(MBS_SHA512 - 1);
+
+         CopyBlock(prefix_pa[n], head[n], prefixLen);
+         CopyBlock(msg, head[n] + prefixLen, headMsgLen);
+         headBlks[n] = 1;
+
+         body_pa[n] = msg + headMsgLen;
+         bodyBlks[n] = (int)(bodyLen / MBS_SHA512);
+
+         tailLen = (int)(len - (int64u)headMsgLen - bodyLen);
+         CopyBlock(body_pa[n] + bodyLen, tail[n], tailLen);
+      }
+
+      /* pad message */
+      {
+         int bufferLen = tailLen < (MBS_SHA512 - (int)MLR_SHA512) ? MBS_SHA512 : MBS_SHA512 * 2;
+         int64u beLenHi = ENDIANNESS64(LSR64(total, 64 - 3));
+         int64u beLenLo = ENDIANNESS64(LSL64(total, 3));
+
+         tail[n][tailLen++] = 0x80;
+         PadBlock(0, tail[n] + tailLen, bufferLen - tailLen - (int)MLR_SHA512);
+         CopyBlock(&beLenHi, &tail[n][bufferLen - 2 * sizeof(int64u)], sizeof(int64u));
+         CopyBlock(&beLenLo, &tail[n][bufferLen - 1 * sizeof(int64u)], sizeof(int64u));
+         tailBlks[n] = bufferLen / MBS_SHA512;
+      }
+   }
+
+   for(i=0; i<8; i++)
+      hash[i] = _mm512_set1_epi64((long long)sha512_iv[i]);
+
+   sha512_update_mb8(hash, head_pa, headBlks);
+   sha512_update_mb8(hash, body_pa, bodyBlks);
+   sha512_update_mb8(hash, tail_pa, tailBlks);
+
+   /* convert hash into big endian and store */
+   {
+      __ALIGN64 int64u digest[8][8];
+      for(i=0; i<8; i++)
+         _mm512_store_si512(digest[i], SIMD_ENDIANNESS64(hash[i]));
+
+      for(n=0; n<8; n++) {
+         if(NULL == hash_pa[n])
+            continue;
+         for(i=0; i<8; i++)
+            ((int64u*)hash_pa[n])[i] = digest[i][n];
+      }
+      PadBlock(0, digest, sizeof(digest));
+   }
+
+   /* clear copy of the data */
+   PadBlock(0, head, sizeof(head));
+   PadBlock(0, tail, sizeof(tail));
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,147 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+
+/*
+// Encrypts messages with SM2 public key encryption
+// pa_ciphertext[]   array of pointers to the ciphertexts (msg_len[] + SM2_PKE_OVERHEAD_SIZE bytes each)
+// pa_msg[]          array of pointers to the messages are being encrypted
+// msg_len[]         array of messages length
+// pa_eph_skey[]     array of pointers to the ephemeral private keys
+// pa_pubx[]         array of pointers to the recipient's public keys X-coordinates
+// pa_puby[]         array of pointers to the recipient's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the recipient's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_sm2_encrypt_mb8)(int8u* pa_ciphertext[8],
+                          const int8u* const pa_msg[8],
+                                   const int msg_len[8],
+                         const int64u* const pa_eph_skey[8],
+                         const int64u* const pa_pubx[8],
+                         const int64u* const pa_puby[8],
+                         const int64u* const pa_pubz[8],
+                                      int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_ciphertext || NULL==pa_msg || NULL==msg_len || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   int msg_len_checked[8];
+
+   /* check pointers and values */
+   for(int buf_no=0; buf_no<8; buf_no++) {
+      const int8u* ciph = pa_ciphertext[buf_no];
+      const int8u* msg = pa_msg[buf_no];
+      const int64u* eph_key = pa_eph_skey[buf_no];
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      msg_len_checked[buf_no] = msg_len[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==ciph || NULL==msg || NULL==eph_key || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         msg_len_checked[buf_no] = 0;
+      }
+      /* message length must fit the ciphertext length into int */
+      else if(msg_len[buf_no] < 0 || msg_len[buf_no] > (0x7FFFFFFF - SM2_PKE_OVERHEAD_SIZE)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         msg_len_checked[buf_no] = 0;
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status) )
+      return status;
+
+#if (_MBX>=_MBX_K1)
+   status = internal_avx512_sm2_encrypt_mb8(pa_ciphertext, pa_msg, msg_len_checked, pa_eph_skey, pa_pubx, pa_puby, pa_pubz, \
+                                            pBuffer, use_jproj_coords, status);
+#else
+   MBX_UNREFERENCED_PARAMETER(msg_len_checked);
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
+
+/*
+// Decrypts SM2 ciphertexts
+// pa_msg[]          array of pointers to the decrypted messages (ct_len[] - SM2_PKE_OVERHEAD_SIZE bytes each)
+// pa_ciphertext[]   array of pointers to the ciphertexts
+// ct_len[]          array of ciphertexts length
+// pa_skey[]         array of pointers to the recipient's private keys
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_sm2_decrypt_mb8)(int8u* pa_msg[8],
+                          const int8u* const pa_ciphertext[8],
+                                   const int ct_len[8],
+                         const int64u* const pa_skey[8],
+                                      int8u* pBuffer)
+{
+   mbx_status status = 0;
+
+   /* test input pointers */
+   if(NULL==pa_msg || NULL==pa_ciphertext || NULL==ct_len || NULL==pa_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   int msg_len_checked[8];
+
+   /* check pointers and values */
+   for(int buf_no=0; buf_no<8; buf_no++) {
+      const int8u* msg = pa_msg[buf_no];
+      const int8u* ciph = pa_ciphertext[buf_no];
+      const int64u* key = pa_skey[buf_no];
+
+      msg_len_checked[buf_no] = 0;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==msg || NULL==ciph || NULL==key) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+      /* ciphertext must hold C1 and C3 at least */
+      else if(ct_len[buf_no] < SM2_PKE_OVERHEAD_SIZE) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      }
+      else
+         msg_len_checked[buf_no] = ct_len[buf_no] - SM2_PKE_OVERHEAD_SIZE;
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status) )
+      return status;
+
+#if (_MBX>=_MBX_K1)
+   status = internal_avx512_sm2_decrypt_mb8(pa_msg, pa_ciphertext, msg_len_checked, pa_skey, pBuffer, status);
+#else
+   MBX_UNREFERENCED_PARAMETER(msg_len_checked);
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
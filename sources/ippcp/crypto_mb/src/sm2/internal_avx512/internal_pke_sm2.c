@@ -0,0 +1,435 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+#include <internal/sm3/sm3_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define SM3_SIZE_IN_BYTES   (SM3_SIZE_IN_BITS/8)
+
+/* ciphertext layout: C1 = 04 || x1 || y1, C3, C2 */
+#define SM2_PKE_PC          (0x04)
+#define SM2_PKE_X1_OFFSET   (1)
+#define SM2_PKE_Y1_OFFSET   (SM2_PKE_X1_OFFSET + PSM2_LEN8)
+#define SM2_PKE_C3_OFFSET   (SM2_PKE_Y1_OFFSET + PSM2_LEN8)
+#define SM2_PKE_C2_OFFSET   (SM2_PKE_C3_OFFSET + SM3_SIZE_IN_BYTES)
+
+/* number of KDF blocks computed per lane between C3 hash updates */
+#define SM2_KDF_BATCH       (8)
+#define SM2_KDF_BATCH_BYTES (SM2_KDF_BATCH*SM3_SIZE_IN_BYTES)
+
+static int len_32[8] = {REP8_DECL(PSM2_LEN8)};
+
+/*
+// Sets sttVal status for the lanes from mask, lanes already in error keep their status
+*/
+static mbx_status sm2_pke_set_sts(mbx_status status, __mb_mask mask, mbx_status sttVal)
+{
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      if(((mask >> buf_no) & 1) && MBX_STATUS_OK==MBX_GET_STS(status, buf_no))
+         status = MBX_SET_STS(status, buf_no, sttVal);
+   }
+   return status;
+}
+
+/*
+// Z = x2 || y2 is exactly one SM3 block, so every KDF block
+// Ha(ct) = SM3(Z || ct) is one compression of the padded block
+//    ct || 0x80 || 0..0 || bitlen(Z || ct)
+// on top of the state after Z. The padded block is common for all lanes.
+*/
+static void sm2_kdf_prepare_mb8(SM3_CTX_mb8* p_kdf, int8u tail[SM3_MSG_BLOCK_SIZE], const int8u* const pa_x2y2[8])
+{
+   int len_z[8] = {REP8_DECL(2*PSM2_LEN8)};
+   const int64u bit_len = (2*PSM2_LEN8 + sizeof(int32u)) * 8;
+
+   sm3_init_mb8(p_kdf);
+   sm3_avx512_mb8(HASH_VALUE(p_kdf), pa_x2y2, len_z);
+
+   pad_block(0, tail, SM3_MSG_BLOCK_SIZE);
+   tail[sizeof(int32u)] = 0x80;
+   tail[SM3_MSG_BLOCK_SIZE-2] = (int8u)(bit_len >> 8);
+   tail[SM3_MSG_BLOCK_SIZE-1] = (int8u)(bit_len);
+}
+
+/*
+// Computes KDF block with counter ct for the lanes set in mb_mask
+// pa_ks[] array of pointers to the output blocks
+*/
+static void sm2_kdf_block_mb8(int8u* pa_ks[8], int32u ct, __mmask8 mb_mask,
+                              const SM3_CTX_mb8* p_kdf, int8u tail[SM3_MSG_BLOCK_SIZE])
+{
+   const int8u* pa_tail[8] = {REP8_DECL(tail)};
+   __ALIGN64 sm3_hash_mb8 hash;
+   __ALIGN64 int len[8];
+   __m256i T[8];
+   const int32u* p_T[8] = { (int32u*)&T[0], (int32u*)&T[1], (int32u*)&T[2], (int32u*)&T[3],
+                            (int32u*)&T[4], (int32u*)&T[5], (int32u*)&T[6], (int32u*)&T[7] };
+   int i;
+
+   tail[0] = (int8u)(ct >> 24);
+   tail[1] = (int8u)(ct >> 16);
+   tail[2] = (int8u)(ct >> 8);
+   tail[3] = (int8u)(ct);
+
+   _mm256_storeu_si256((__m256i*)len, _mm256_maskz_set1_epi32(mb_mask, SM3_MSG_BLOCK_SIZE));
+   for(i = 0; i < SM3_SIZE_IN_WORDS; i++)
+      _mm256_storeu_si256((__m256i*)hash[i], _mm256_loadu_si256((__m256i*)HASH_VALUE(p_kdf)[i]));
+
+   sm3_avx512_mb8(hash, pa_tail, len);
+
+   /* convert hash into big endian and store lane by lane */
+   for(i = 0; i < SM3_SIZE_IN_WORDS; i++)
+      T[i] = SIMD_ENDIANNESS32(_mm256_loadu_si256((__m256i*)hash[i]));
+   MASK_TRANSPOSE_8X8_I32((int32u**)pa_ks, p_T, mb_mask);
+
+   /* clear stack data */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])hash, sizeof(hash)/sizeof(U64));
+   for(i = 0; i < SM3_SIZE_IN_WORDS; i++)
+      T[i] = _mm256_setzero_si256();
+}
+
+/*
+// pa_out[] = pa_inp[] (x) KDF(x2 || y2, len[])
+// pa_c3[]  = SM3(x2 || M || y2), M is pa_inp[] if hash_output==0 (encryption), pa_out[] otherwise (decryption)
+//
+// Keystream is produced SM2_KDF_BATCH blocks per lane at once, and the same chunk is xor-ed
+// and fed to the C3 hash before moving on, so the message is passed once.
+// Lanes with pa_c3[i]==NULL are skipped.
+*/
+static void sm2_kdf_xor_hash_mb8(int8u* const pa_out[8],
+                          const int8u* const pa_inp[8],
+                                   const int len[8],
+                                int8u* const pa_c3[8],
+                          const int8u* const pa_x2y2[8],
+                                         int hash_output)
+{
+   __ALIGN64 int8u ks[8][SM2_KDF_BATCH_BYTES];
+   __ALIGN64 int8u tail[SM3_MSG_BLOCK_SIZE];
+   SM3_CTX_mb8 kdf;
+   SM3_CTX_mb8 c3;
+
+   const int8u* pa_y2[8];
+   int max_len = 0;
+   int i;
+
+   for(i = 0; i < 8; i++) {
+      pa_y2[i] = pa_x2y2[i] + PSM2_LEN8;
+      if(NULL!=pa_c3[i])
+         max_len = (len[i] > max_len) ? len[i] : max_len;
+   }
+
+   sm2_kdf_prepare_mb8(&kdf, tail, pa_x2y2);
+
+   sm3_init_mb8(&c3);
+   sm3_update_mb8(pa_x2y2, len_32, &c3);
+
+   int32u ct = 1;
+   for(int offset = 0; offset < max_len; offset += SM2_KDF_BATCH_BYTES) {
+      const int8u* pa_chunk_inp[8];
+      int8u* pa_chunk_out[8];
+      int chunk_len[8];
+
+      for(i = 0; i < 8; i++) {
+         int rest = (NULL!=pa_c3[i]) ? len[i] - offset : 0;
+         chunk_len[i] = (rest > 0) ? MIN(rest, SM2_KDF_BATCH_BYTES) : 0;
+         pa_chunk_inp[i] = chunk_len[i] ? pa_inp[i] + offset : NULL;
+         pa_chunk_out[i] = chunk_len[i] ? pa_out[i] + offset : NULL;
+      }
+
+      /* keystream */
+      for(int blk = 0; blk < SM2_KDF_BATCH; blk++, ct++) {
+         int8u* pa_ks[8];
+         __mmask8 mb_mask = 0;
+         for(i = 0; i < 8; i++) {
+            pa_ks[i] = ks[i] + blk*SM3_SIZE_IN_BYTES;
+            mb_mask |= (__mmask8)((chunk_len[i] > blk*SM3_SIZE_IN_BYTES) << i);
+         }
+         if(0==mb_mask)
+            break;
+         sm2_kdf_block_mb8(pa_ks, ct, mb_mask, &kdf, tail);
+      }
+
+      /* xor and hash */
+      if(!hash_output)
+         sm3_update_mb8(pa_chunk_inp, chunk_len, &c3);
+
+      for(i = 0; i < 8; i++) {
+         for(int n = 0; n < chunk_len[i]; n++)
+            pa_chunk_out[i][n] = pa_chunk_inp[i][n] ^ ks[i][n];
+      }
+
+      if(hash_output)
+         sm3_update_mb8((const int8u* const*)pa_chunk_out, chunk_len, &c3);
+   }
+
+   sm3_update_mb8(pa_y2, len_32, &c3);
+   sm3_final_mb8((int8u**)pa_c3, &c3);
+
+   /* clear stack data */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])ks, sizeof(ks)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])HASH_VALUE(&kdf), sizeof(HASH_VALUE(&kdf))/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&c3, sizeof(c3)/sizeof(U64));
+}
+
+/*
+// Loads public keys into P (Montgomery domain) and checks them
+*/
+static mbx_status sm2_pke_load_pubkeys(SM2_POINT* P,
+                                       const int64u* const pa_pubx[8],
+                                       const int64u* const pa_puby[8],
+                                       const int64u* const pa_pubz[8],
+                                       int use_jproj_coords,
+                                       mbx_status status)
+{
+   ifma_BNU_to_mb8((int64u (*)[8])P->X, pa_pubx, PSM2_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])P->Y, pa_puby, PSM2_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BNU_to_mb8((int64u (*)[8])P->Z, pa_pubz, PSM2_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FESM2_)(P->Z, (U64*)ones);
+
+   status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   if(use_jproj_coords)
+      status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* convert to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->X, P->X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Y, P->Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Z, P->Z);
+
+   /* check if P does not belong to EC */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(P, use_jproj_coords);
+   /* set points out of EC to infinity */
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(P, not_on_curve_mask);
+   status = sm2_pke_set_sts(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   return status;
+}
+
+/*
+// Checks that the secret keys are in the range 0 < key < n
+*/
+static mbx_status sm2_pke_check_skeys(const int64u* const pa_skey[8], mbx_status status)
+{
+   __ALIGN64 U64 skey[PSM2_LEN52];
+   ifma_BNU_to_mb8((int64u (*)[8])skey, pa_skey, PSM2_BITSIZE);
+
+   status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_nsm2_)(skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])skey, sizeof(skey)/sizeof(U64));
+   return status;
+}
+
+/*
+// Computes affine (x2, y2) = [scalar]P as big endian x2 || y2,
+// returns mask of the lanes where [scalar]P is the point at infinity
+*/
+static __mb_mask sm2_pke_shared_point(int8u* const pa_x2y2[8], const SM2_POINT* P, const U64* scalar)
+{
+   int8u* pa_y2[8];
+   for(int i = 0; i < 8; i++)
+      pa_y2[i] = pa_x2y2[i] + PSM2_LEN8;
+
+   SM2_POINT R;
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&R, P, scalar);
+   __mb_mask infinity_mask = MB_FUNC_NAME(is_zero_point_cordinate_)(R.Z);
+   MB_FUNC_NAME(get_sm2_ec_affine_coords_)(R.X, R.Y, &R);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(R.X, R.X);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(R.Y, R.Y);
+
+   ifma_mb8_to_HexStr8(pa_x2y2, (const int64u (*)[8])R.X, PSM2_BITSIZE);
+   ifma_mb8_to_HexStr8(pa_y2,   (const int64u (*)[8])R.Y, PSM2_BITSIZE);
+
+   /* clear computed shared points */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+   return infinity_mask;
+}
+
+mbx_status internal_avx512_sm2_encrypt_mb8(int8u* pa_ciphertext[8],
+                              const int8u* const pa_msg[8],
+                                       const int msg_len[8],
+                             const int64u* const pa_eph_skey[8],
+                             const int64u* const pa_pubx[8],
+                             const int64u* const pa_puby[8],
+                             const int64u* const pa_pubz[8],
+                                          int8u* pBuffer, int use_jproj_coords,
+                                      mbx_status current_status)
+{
+   mbx_status status = current_status;
+   int buf_no;
+
+   /* zero padded ephemeral keys */
+   U64 scalarz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])scalarz, pa_eph_skey, PSM2_BITSIZE);
+   scalarz[PSM2_LEN64] = get_zero64();
+
+   status = sm2_pke_check_skeys(pa_eph_skey, status);
+
+   /* recipient's public keys */
+   SM2_POINT P;
+   status = sm2_pke_load_pubkeys(&P, pa_pubx, pa_puby, pa_pubz, use_jproj_coords, status);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
+      return status;
+   }
+
+   /* (x2, y2) = [k]Pb, must not be the point at infinity */
+   __ALIGN64 int8u x2y2[8][2*PSM2_LEN8];
+   int8u* pa_x2y2[8] = {x2y2[0], x2y2[1], x2y2[2], x2y2[3], x2y2[4], x2y2[5], x2y2[6], x2y2[7]};
+   status = sm2_pke_set_sts(status, sm2_pke_shared_point(pa_x2y2, &P, scalarz), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   int8u* pa_x1[8];
+   int8u* pa_y1[8];
+   int8u* pa_c3[8];
+   int8u* pa_c2[8];
+   for(buf_no = 0; buf_no < 8; buf_no++) {
+      int8u* ciph = (0==MBX_GET_STS(status, buf_no)) ? pa_ciphertext[buf_no] : NULL;
+      pa_x1[buf_no] = ciph ? ciph + SM2_PKE_X1_OFFSET : NULL;
+      pa_y1[buf_no] = ciph ? ciph + SM2_PKE_Y1_OFFSET : NULL;
+      pa_c3[buf_no] = ciph ? ciph + SM2_PKE_C3_OFFSET : NULL;
+      pa_c2[buf_no] = ciph ? ciph + SM2_PKE_C2_OFFSET : NULL;
+      if(ciph)
+         ciph[0] = SM2_PKE_PC;
+   }
+
+   /* C1 = [k]G */
+   SM2_POINT C1;
+   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(&C1, scalarz);
+   MB_FUNC_NAME(get_sm2_ec_affine_coords_)(C1.X, C1.Y, &C1);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(C1.X, C1.X);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(C1.Y, C1.Y);
+   ifma_mb8_to_HexStr8(pa_x1, (const int64u (*)[8])C1.X, PSM2_BITSIZE);
+   ifma_mb8_to_HexStr8(pa_y1, (const int64u (*)[8])C1.Y, PSM2_BITSIZE);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
+
+   /* C2 = M (x) KDF(x2 || y2, klen), C3 = SM3(x2 || M || y2) */
+   sm2_kdf_xor_hash_mb8(pa_c2, pa_msg, msg_len, pa_c3, (const int8u* const*)pa_x2y2, 0);
+
+   /* clear shared points */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])x2y2, sizeof(x2y2)/sizeof(U64));
+
+   MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return status;
+}
+
+mbx_status internal_avx512_sm2_decrypt_mb8(int8u* pa_msg[8],
+                              const int8u* const pa_ciphertext[8],
+                                       const int msg_len[8],
+                             const int64u* const pa_skey[8],
+                                          int8u* pBuffer,
+                                      mbx_status current_status)
+{
+   mbx_status status = current_status;
+   int buf_no;
+
+   /* zero padded private keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])secretz, pa_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status = sm2_pke_check_skeys(pa_skey, status);
+
+   /* C1 */
+   const int8u* pa_x1[8];
+   const int8u* pa_y1[8];
+   for(buf_no = 0; buf_no < 8; buf_no++) {
+      const int8u* ciph = (0==MBX_GET_STS(status, buf_no)) ? pa_ciphertext[buf_no] : NULL;
+      pa_x1[buf_no] = ciph ? ciph + SM2_PKE_X1_OFFSET : NULL;
+      pa_y1[buf_no] = ciph ? ciph + SM2_PKE_Y1_OFFSET : NULL;
+      if(ciph && SM2_PKE_PC!=ciph[0])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   SM2_POINT C1;
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.X, pa_x1, PSM2_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.Y, pa_y1, PSM2_BITSIZE);
+   MB_FUNC_NAME(mov_FESM2_)(C1.Z, (U64*)ones);
+
+   status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_psm2_)(C1.X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status = sm2_pke_set_sts(status, MB_FUNC_NAME(ifma_check_range_psm2_)(C1.Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.X, C1.X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Y, C1.Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Z, C1.Z);
+
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(&C1, 0);
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(&C1, not_on_curve_mask);
+   status = sm2_pke_set_sts(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+      return status;
+   }
+
+   /* (x2, y2) = [dB]C1, must not be the point at infinity */
+   __ALIGN64 int8u x2y2[8][2*PSM2_LEN8];
+   int8u* pa_x2y2[8] = {x2y2[0], x2y2[1], x2y2[2], x2y2[3], x2y2[4], x2y2[5], x2y2[6], x2y2[7]};
+   status = sm2_pke_set_sts(status, sm2_pke_shared_point(pa_x2y2, &C1, secretz), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   /* M' = C2 (x) KDF(x2 || y2, klen), u = SM3(x2 || M' || y2) */
+   __ALIGN64 int8u u[8][SM3_SIZE_IN_BYTES];
+   const int8u* pa_c2[8];
+   int8u* pa_u[8];
+   for(buf_no = 0; buf_no < 8; buf_no++) {
+      int ok = (0==MBX_GET_STS(status, buf_no));
+      pa_c2[buf_no] = ok ? pa_ciphertext[buf_no] + SM2_PKE_C2_OFFSET : NULL;
+      pa_u[buf_no]  = ok ? u[buf_no] : NULL;
+   }
+   sm2_kdf_xor_hash_mb8(pa_msg, pa_c2, msg_len, pa_u, (const int8u* const*)pa_x2y2, 1);
+
+   /* clear shared points */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])x2y2, sizeof(x2y2)/sizeof(U64));
+
+   /* check u == C3, do not release the message otherwise */
+   for(buf_no = 0; buf_no < 8; buf_no++) {
+      if(NULL==pa_u[buf_no])
+         continue;
+
+      const int8u* c3 = pa_ciphertext[buf_no] + SM2_PKE_C3_OFFSET;
+      int8u diff = 0;
+      for(int n = 0; n < SM3_SIZE_IN_BYTES; n++)
+         diff |= (int8u)(u[buf_no][n] ^ c3[n]);
+
+      if(diff) {
+         pad_block(0, pa_msg[buf_no], msg_len[buf_no]);
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_SIGNATURE_ERR);
+      }
+   }
+
+   MBX_UNREFERENCED_PARAMETER(pBuffer);
+   return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
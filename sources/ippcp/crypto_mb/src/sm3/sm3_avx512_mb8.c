@@ -216,8 +216,8 @@ void sm3_avx512_mb8(int32u hash_pa[][8], const int8u* const msg_pa[8], int len[8
         _mm256_storeu_si256((__m256i*)(hash_pa + 6), G);
         _mm256_storeu_si256((__m256i*)(hash_pa + 7), H);
  
-        /* Update pointers to data, local  lengths and mask */
-        _mm512_storeu_si512(loc_data, _mm512_mask_add_epi64(zero_buffer, (__mmask8)mb_mask, _mm512_loadu_si512(loc_data), _mm512_set1_epi64(SM3_MSG_BLOCK_SIZE)));
+        /* Update pointers to data, local  lengths and mask (finished buffers are redirected to the zero_buffer) */
+        _mm512_storeu_si512(loc_data, _mm512_mask_add_epi64(_mm512_set1_epi64((long long)&zero_buffer), (__mmask8)mb_mask, _mm512_loadu_si512(loc_data), _mm512_set1_epi64(SM3_MSG_BLOCK_SIZE)));
         loc_len_m256 = _mm256_mask_sub_epi32(_mm256_setzero_si256(), mb_mask, loc_len_m256, _mm256_set1_epi32(SM3_MSG_BLOCK_SIZE));
         mb_mask = _mm256_cmp_epi32_mask(loc_len_m256, _mm256_setzero_si256(), _MM_CMPINT_NE);
     }
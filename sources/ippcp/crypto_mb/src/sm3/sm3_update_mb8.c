@@ -91,8 +91,10 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
             /* copy from input stream to the internal buffer as match as possible */
             for (i = 0; i < SM3_NUM_BUFFERS8; i++) {
                 /* copy from input stream to the internal buffer as match as possible */
-                __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << p_proc_len[i]);
-                _mm512_storeu_si512(p_buffer[i] + p_idx[i], _mm512_mask_loadu_epi8(_mm512_loadu_si512(p_buffer[i] + p_idx[i]), mb_mask64, loc_src[i]));
+                if ((mb_mask >> i) & 0x1) {
+                    __mmask64 mb_mask64 = 0xFFFFFFFFFFFFFFFF >> (SM3_MSG_BLOCK_SIZE - p_proc_len[i]);
+                    _mm512_storeu_si512(p_buffer[i] + p_idx[i], _mm512_mask_loadu_epi8(_mm512_loadu_si512(p_buffer[i] + p_idx[i]), mb_mask64, loc_src[i]));
+                }
             }
 
             idx = _mm256_add_epi32(idx, proc_len);
@@ -103,7 +105,7 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
             _mm512_storeu_si512((void*)loc_src, loc_src_m512);
 
             processed_mask = _mm256_cmp_epi32_mask(idx, _mm256_set1_epi32(SM3_MSG_BLOCK_SIZE), _MM_CMPINT_EQ);
-            proc_len = _mm256_mask_set1_epi32(proc_len, processed_mask, SM3_MSG_BLOCK_SIZE);
+            proc_len = _mm256_maskz_set1_epi32(processed_mask, SM3_MSG_BLOCK_SIZE);
 
             /* update digest if at least one buffer is full */
             if (processed_mask) {
@@ -130,8 +132,10 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
         if (processed_mask) {
             for (i = 0; i < SM3_NUM_BUFFERS8; i++) {
                 /* copy from input stream to the internal buffer as match as possible */
-                __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
-                _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                if ((processed_mask >> i) & 0x1) {
+                    __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
+                    _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                }
             }
 
             idx = _mm256_maskz_add_epi32(0xFF, idx, loc_len);
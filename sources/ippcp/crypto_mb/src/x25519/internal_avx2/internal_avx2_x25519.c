@@ -0,0 +1,471 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX == _MBX_L9)
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+/*
+// AVX2 implementation of x25519 (4 buffers).
+//
+// No 52-bit multiplier is available, so the field elements of GF(2^255-19) are represented
+// in radix 2^25.5:
+//    a = a0 + a1*2^26 + a2*2^51 + a3*2^77 + a4*2^102 + a5*2^128 + a6*2^153 + a7*2^179 + a8*2^204 + a9*2^230
+// (even digits are 26-bit, odd digits are 25-bit) and the digit-wise products are computed
+// by 32x32->64 vpmuludq. Each U64 holds the same digit of 4 independent field elements.
+//
+// Digits of the multiplication and squaring operands are less than 2^28,
+// i.e. operands are the result of at most one addition or subtraction of reduced values.
+*/
+
+#define FE26_LEN  (10)
+
+#define MASK26    (0x3FFFFFF)
+#define MASK25    (0x1FFFFFF)
+
+#define mul32x32(a, b)  _mm256_mul_epu32((a), (b))
+#define add4x64(a, b)   _mm256_add_epi64((a), (b))
+#define sub4x64(a, b)   _mm256_sub_epi64((a), (b))
+#define MAC(h, a, b)    (h) = add4x64((h), mul32x32((a), (b)))
+
+/* 2*p in radix 2^25.5 */
+#define P2_0   (0x7FFFFDA)
+#define P2_E   (0x7FFFFFE)
+#define P2_O   (0x3FFFFFE)
+
+__MBX_INLINE void fe26mb4_copy(U64 r[], const U64 a[])
+{
+   int i;
+   for(i=0; i<FE26_LEN; i++) r[i] = a[i];
+}
+
+__MBX_INLINE void fe26mb4_set(U64 r[], int32u a)
+{
+   int i;
+   r[0] = _mm256_set1_epi64x((long long)a);
+   for(i=1; i<FE26_LEN; i++) r[i] = _mm256_setzero_si256();
+}
+
+__MBX_INLINE void fe26mb4_add(U64 r[], const U64 a[], const U64 b[])
+{
+   int i;
+   for(i=0; i<FE26_LEN; i++) r[i] = add4x64(a[i], b[i]);
+}
+
+/* r = a + 2*p - b, b is reduced */
+__MBX_INLINE void fe26mb4_sub(U64 r[], const U64 a[], const U64 b[])
+{
+   const U64 p2_0 = _mm256_set1_epi64x(P2_0);
+   const U64 p2_e = _mm256_set1_epi64x(P2_E);
+   const U64 p2_o = _mm256_set1_epi64x(P2_O);
+
+   r[0] = sub4x64(add4x64(a[0], p2_0), b[0]);
+   r[1] = sub4x64(add4x64(a[1], p2_o), b[1]);
+   r[2] = sub4x64(add4x64(a[2], p2_e), b[2]);
+   r[3] = sub4x64(add4x64(a[3], p2_o), b[3]);
+   r[4] = sub4x64(add4x64(a[4], p2_e), b[4]);
+   r[5] = sub4x64(add4x64(a[5], p2_o), b[5]);
+   r[6] = sub4x64(add4x64(a[6], p2_e), b[6]);
+   r[7] = sub4x64(add4x64(a[7], p2_o), b[7]);
+   r[8] = sub4x64(add4x64(a[8], p2_e), b[8]);
+   r[9] = sub4x64(add4x64(a[9], p2_o), b[9]);
+}
+
+__MBX_INLINE void fe26mb4_cswap(U64 a[], U64 b[], U64 mask)
+{
+   int i;
+   for(i=0; i<FE26_LEN; i++) {
+      U64 t = _mm256_and_si256(_mm256_xor_si256(a[i], b[i]), mask);
+      a[i] = _mm256_xor_si256(a[i], t);
+      b[i] = _mm256_xor_si256(b[i], t);
+   }
+}
+
+#define CARRY26(hi, lo) { \
+   (hi) = add4x64((hi), _mm256_srli_epi64((lo), 26)); \
+   (lo) = _mm256_and_si256((lo), mask26); \
+}
+#define CARRY25(hi, lo) { \
+   (hi) = add4x64((hi), _mm256_srli_epi64((lo), 25)); \
+   (lo) = _mm256_and_si256((lo), mask25); \
+}
+
+/* reduces 64-bit column sums to digits */
+static void fe26mb4_carry(U64 r[], U64 h0, U64 h1, U64 h2, U64 h3, U64 h4,
+                                   U64 h5, U64 h6, U64 h7, U64 h8, U64 h9)
+{
+   const U64 mask26 = _mm256_set1_epi64x(MASK26);
+   const U64 mask25 = _mm256_set1_epi64x(MASK25);
+
+   CARRY26(h1, h0)
+   CARRY26(h5, h4)
+   CARRY25(h2, h1)
+   CARRY25(h6, h5)
+   CARRY26(h3, h2)
+   CARRY26(h7, h6)
+   CARRY25(h4, h3)
+   CARRY25(h8, h7)
+   CARRY26(h5, h4)
+   CARRY26(h9, h8)
+
+   /* 2^255 = 19 (mod p) */
+   U64 c = _mm256_srli_epi64(h9, 25);
+   h9 = _mm256_and_si256(h9, mask25);
+   h0 = add4x64(h0, add4x64(c, add4x64(_mm256_slli_epi64(c, 1), _mm256_slli_epi64(c, 4))));
+   CARRY26(h1, h0)
+
+   r[0] = h0; r[1] = h1; r[2] = h2; r[3] = h3; r[4] = h4;
+   r[5] = h5; r[6] = h6; r[7] = h7; r[8] = h8; r[9] = h9;
+}
+
+static void fe26mb4_mul(U64 r[], const U64 a[], const U64 b[])
+{
+   const U64 n19 = _mm256_set1_epi64x(19);
+   U64 a2[FE26_LEN], b19[FE26_LEN];
+   U64 h0, h1, h2, h3, h4, h5, h6, h7, h8, h9;
+   int i;
+
+   for(i=0; i<FE26_LEN; i++) {
+      a2[i]  = add4x64(a[i], a[i]);
+      b19[i] = mul32x32(b[i], n19);
+   }
+
+   /* products of the odd digits are doubled (2^26 * 2^26 = 2 * 2^51) */
+   h0 = mul32x32(a[0], b[0]); h1 = mul32x32(a[0], b[1]); h2 = mul32x32(a[0], b[2]); h3 = mul32x32(a[0], b[3]); h4 = mul32x32(a[0], b[4]);
+   h5 = mul32x32(a[0], b[5]); h6 = mul32x32(a[0], b[6]); h7 = mul32x32(a[0], b[7]); h8 = mul32x32(a[0], b[8]); h9 = mul32x32(a[0], b[9]);
+   MAC(h1, a[1], b[0]); MAC(h2, a2[1], b[1]); MAC(h3, a[1], b[2]); MAC(h4, a2[1], b[3]); MAC(h5, a[1], b[4]);
+   MAC(h6, a2[1], b[5]); MAC(h7, a[1], b[6]); MAC(h8, a2[1], b[7]); MAC(h9, a[1], b[8]); MAC(h0, a2[1], b19[9]);
+   MAC(h2, a[2], b[0]); MAC(h3, a[2], b[1]); MAC(h4, a[2], b[2]); MAC(h5, a[2], b[3]); MAC(h6, a[2], b[4]);
+   MAC(h7, a[2], b[5]); MAC(h8, a[2], b[6]); MAC(h9, a[2], b[7]); MAC(h0, a[2], b19[8]); MAC(h1, a[2], b19[9]);
+   MAC(h3, a[3], b[0]); MAC(h4, a2[3], b[1]); MAC(h5, a[3], b[2]); MAC(h6, a2[3], b[3]); MAC(h7, a[3], b[4]);
+   MAC(h8, a2[3], b[5]); MAC(h9, a[3], b[6]); MAC(h0, a2[3], b19[7]); MAC(h1, a[3], b19[8]); MAC(h2, a2[3], b19[9]);
+   MAC(h4, a[4], b[0]); MAC(h5, a[4], b[1]); MAC(h6, a[4], b[2]); MAC(h7, a[4], b[3]); MAC(h8, a[4], b[4]);
+   MAC(h9, a[4], b[5]); MAC(h0, a[4], b19[6]); MAC(h1, a[4], b19[7]); MAC(h2, a[4], b19[8]); MAC(h3, a[4], b19[9]);
+   MAC(h5, a[5], b[0]); MAC(h6, a2[5], b[1]); MAC(h7, a[5], b[2]); MAC(h8, a2[5], b[3]); MAC(h9, a[5], b[4]);
+   MAC(h0, a2[5], b19[5]); MAC(h1, a[5], b19[6]); MAC(h2, a2[5], b19[7]); MAC(h3, a[5], b19[8]); MAC(h4, a2[5], b19[9]);
+   MAC(h6, a[6], b[0]); MAC(h7, a[6], b[1]); MAC(h8, a[6], b[2]); MAC(h9, a[6], b[3]); MAC(h0, a[6], b19[4]);
+   MAC(h1, a[6], b19[5]); MAC(h2, a[6], b19[6]); MAC(h3, a[6], b19[7]); MAC(h4, a[6], b19[8]); MAC(h5, a[6], b19[9]);
+   MAC(h7, a[7], b[0]); MAC(h8, a2[7], b[1]); MAC(h9, a[7], b[2]); MAC(h0, a2[7], b19[3]); MAC(h1, a[7], b19[4]);
+   MAC(h2, a2[7], b19[5]); MAC(h3, a[7], b19[6]); MAC(h4, a2[7], b19[7]); MAC(h5, a[7], b19[8]); MAC(h6, a2[7], b19[9]);
+   MAC(h8, a[8], b[0]); MAC(h9, a[8], b[1]); MAC(h0, a[8], b19[2]); MAC(h1, a[8], b19[3]); MAC(h2, a[8], b19[4]);
+   MAC(h3, a[8], b19[5]); MAC(h4, a[8], b19[6]); MAC(h5, a[8], b19[7]); MAC(h6, a[8], b19[8]); MAC(h7, a[8], b19[9]);
+   MAC(h9, a[9], b[0]); MAC(h0, a2[9], b19[1]); MAC(h1, a[9], b19[2]); MAC(h2, a2[9], b19[3]); MAC(h3, a[9], b19[4]);
+   MAC(h4, a2[9], b19[5]); MAC(h5, a[9], b19[6]); MAC(h6, a2[9], b19[7]); MAC(h7, a[9], b19[8]); MAC(h8, a2[9], b19[9]);
+
+   fe26mb4_carry(r, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9);
+}
+
+static void fe26mb4_sqr(U64 r[], const U64 a[])
+{
+   const U64 n19 = _mm256_set1_epi64x(19);
+   U64 a2[FE26_LEN], a4[FE26_LEN], a19[FE26_LEN];
+   U64 h0, h1, h2, h3, h4, h5, h6, h7, h8, h9;
+   int i;
+
+   for(i=0; i<FE26_LEN; i++) {
+      a2[i]  = add4x64(a[i], a[i]);
+      a4[i]  = add4x64(a2[i], a2[i]);
+      a19[i] = mul32x32(a[i], n19);
+   }
+
+   h0 = mul32x32(a[0], a[0]); h1 = mul32x32(a2[0], a[1]); h2 = mul32x32(a2[0], a[2]); h3 = mul32x32(a2[0], a[3]); h4 = mul32x32(a2[0], a[4]);
+   h5 = mul32x32(a2[0], a[5]); h6 = mul32x32(a2[0], a[6]); h7 = mul32x32(a2[0], a[7]); h8 = mul32x32(a2[0], a[8]); h9 = mul32x32(a2[0], a[9]);
+   MAC(h2, a2[1], a[1]); MAC(h3, a2[1], a[2]); MAC(h4, a4[1], a[3]); MAC(h5, a2[1], a[4]); MAC(h6, a4[1], a[5]);
+   MAC(h7, a2[1], a[6]); MAC(h8, a4[1], a[7]); MAC(h9, a2[1], a[8]); MAC(h0, a4[1], a19[9]);
+   MAC(h4, a[2], a[2]); MAC(h5, a2[2], a[3]); MAC(h6, a2[2], a[4]); MAC(h7, a2[2], a[5]); MAC(h8, a2[2], a[6]);
+   MAC(h9, a2[2], a[7]); MAC(h0, a2[2], a19[8]); MAC(h1, a2[2], a19[9]);
+   MAC(h6, a2[3], a[3]); MAC(h7, a2[3], a[4]); MAC(h8, a4[3], a[5]); MAC(h9, a2[3], a[6]); MAC(h0, a4[3], a19[7]);
+   MAC(h1, a2[3], a19[8]); MAC(h2, a4[3], a19[9]);
+   MAC(h8, a[4], a[4]); MAC(h9, a2[4], a[5]); MAC(h0, a2[4], a19[6]); MAC(h1, a2[4], a19[7]); MAC(h2, a2[4], a19[8]);
+   MAC(h3, a2[4], a19[9]);
+   MAC(h0, a2[5], a19[5]); MAC(h1, a2[5], a19[6]); MAC(h2, a4[5], a19[7]); MAC(h3, a2[5], a19[8]); MAC(h4, a4[5], a19[9]);
+   MAC(h2, a[6], a19[6]); MAC(h3, a2[6], a19[7]); MAC(h4, a2[6], a19[8]); MAC(h5, a2[6], a19[9]);
+   MAC(h4, a2[7], a19[7]); MAC(h5, a2[7], a19[8]); MAC(h6, a4[7], a19[9]);
+   MAC(h6, a[8], a19[8]); MAC(h7, a2[8], a19[9]);
+   MAC(h8, a2[9], a19[9]);
+
+   fe26mb4_carry(r, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9);
+}
+
+static void fe26mb4_sqr_times(U64 r[], const U64 a[], int n)
+{
+   fe26mb4_sqr(r, a);
+   for(n--; n>0; n--)
+      fe26mb4_sqr(r, r);
+}
+
+/* r = a*121665, (A-2)/4 = 121665 */
+static void fe26mb4_mul121665(U64 r[], const U64 a[])
+{
+   const U64 a24 = _mm256_set1_epi64x(121665);
+   fe26mb4_carry(r, mul32x32(a[0], a24), mul32x32(a[1], a24), mul32x32(a[2], a24), mul32x32(a[3], a24), mul32x32(a[4], a24),
+                    mul32x32(a[5], a24), mul32x32(a[6], a24), mul32x32(a[7], a24), mul32x32(a[8], a24), mul32x32(a[9], a24));
+}
+
+/* r = z^(p-2) = z^(2^255-21) */
+static void fe26mb4_inv_mod25519(U64 r[], const U64 z[])
+{
+   U64 t0[FE26_LEN], t1[FE26_LEN], t2[FE26_LEN], t3[FE26_LEN];
+
+   fe26mb4_sqr(t0, z);                    /* t0 = z^2                */
+   fe26mb4_sqr_times(t1, t0, 2);          /* t1 = z^8                */
+   fe26mb4_mul(t1, z, t1);                /* t1 = z^9                */
+   fe26mb4_mul(t0, t0, t1);               /* t0 = z^11               */
+   fe26mb4_sqr(t2, t0);                   /* t2 = z^22               */
+   fe26mb4_mul(t1, t1, t2);               /* t1 = z^(2^5-1)          */
+   fe26mb4_sqr_times(t2, t1, 5);
+   fe26mb4_mul(t1, t2, t1);               /* t1 = z^(2^10-1)         */
+   fe26mb4_sqr_times(t2, t1, 10);
+   fe26mb4_mul(t2, t2, t1);               /* t2 = z^(2^20-1)         */
+   fe26mb4_sqr_times(t3, t2, 20);
+   fe26mb4_mul(t2, t3, t2);               /* t2 = z^(2^40-1)         */
+   fe26mb4_sqr_times(t2, t2, 10);
+   fe26mb4_mul(t1, t2, t1);               /* t1 = z^(2^50-1)         */
+   fe26mb4_sqr_times(t2, t1, 50);
+   fe26mb4_mul(t2, t2, t1);               /* t2 = z^(2^100-1)        */
+   fe26mb4_sqr_times(t3, t2, 100);
+   fe26mb4_mul(t2, t3, t2);               /* t2 = z^(2^200-1)        */
+   fe26mb4_sqr_times(t2, t2, 50);
+   fe26mb4_mul(t1, t2, t1);               /* t1 = z^(2^250-1)        */
+   fe26mb4_sqr_times(t1, t1, 5);          /* t1 = z^(2^255-2^5)      */
+   fe26mb4_mul(r, t1, t0);                /* r  = z^(2^255-21)       */
+}
+
+/* converts 4 little-endian 256-bit strings into the radix 2^25.5 representation, bit 255 is ignored */
+static void fe26mb4_from_bytes(U64 r[], const int8u* const pa_inp[4])
+{
+   __ALIGN64 int64u t[FE26_LEN][4];
+   int buf_no, i;
+
+   for(buf_no=0; buf_no<4; buf_no++) {
+      const int64u* inp = (const int64u*)pa_inp[buf_no];
+      int64u x0 = 0, x1 = 0, x2 = 0, x3 = 0;
+
+      if(NULL != inp) {
+         x0 = inp[0]; x1 = inp[1]; x2 = inp[2]; x3 = inp[3];
+      }
+      t[0][buf_no] =  x0                 & MASK26;
+      t[1][buf_no] = (x0 >> 26)          & MASK25;
+      t[2][buf_no] = ((x0 >> 51) | (x1 << 13)) & MASK26;
+      t[3][buf_no] = (x1 >> 13)          & MASK25;
+      t[4][buf_no] = (x1 >> 38)          & MASK26;
+      t[5][buf_no] =  x2                 & MASK25;
+      t[6][buf_no] = (x2 >> 25)          & MASK26;
+      t[7][buf_no] = ((x2 >> 51) | (x3 << 13)) & MASK25;
+      t[8][buf_no] = (x3 >> 12)          & MASK26;
+      t[9][buf_no] = (x3 >> 38)          & MASK25;
+   }
+
+   for(i=0; i<FE26_LEN; i++)
+      r[i] = _mm256_load_si256((const U64*)t[i]);
+}
+
+/* fully reduces modulo p and converts into 4 little-endian 256-bit strings; returns mask of zero results */
+static int8u fe26mb4_to_bytes(int8u* const pa_out[4], const U64 a[])
+{
+   __ALIGN64 int64u t[FE26_LEN][4];
+   int8u zero_mask = 0;
+   int buf_no, i;
+
+   for(i=0; i<FE26_LEN; i++)
+      _mm256_store_si256((U64*)t[i], a[i]);
+
+   for(buf_no=0; buf_no<4; buf_no++) {
+      int64u h[FE26_LEN];
+      int64u q;
+
+      for(i=0; i<FE26_LEN; i++)
+         h[i] = t[i][buf_no];
+
+      /* normalize digits: h < 2^255 + 2^26 */
+      for(i=0; i<FE26_LEN-1; i++) {
+         int bits = (i&1)? 25 : 26;
+         h[i+1] += h[i] >> bits;
+         h[i] &= (i&1)? MASK25 : MASK26;
+      }
+      q = h[9] >> 25;
+      h[9] &= MASK25;
+      h[0] += q*19;
+
+      /* q = (h >= p) */
+      q = (h[0] + 19) >> 26;
+      for(i=1; i<FE26_LEN; i++)
+         q = (h[i] + q) >> ((i&1)? 25 : 26);
+
+      /* h = h + 19*q - 2^255*q */
+      h[0] += 19*q;
+      for(i=0; i<FE26_LEN-1; i++) {
+         int bits = (i&1)? 25 : 26;
+         h[i+1] += h[i] >> bits;
+         h[i] &= (i&1)? MASK25 : MASK26;
+      }
+      h[9] &= MASK25;
+
+      {
+         int64u x0 =  h[0]        | (h[1] << 26) | (h[2] << 51);
+         int64u x1 = (h[2] >> 13) | (h[3] << 13) | (h[4] << 38);
+         int64u x2 =  h[5]        | (h[6] << 25) | (h[7] << 51);
+         int64u x3 = (h[7] >> 13) | (h[8] << 12) | (h[9] << 38);
+         int64u* out = (int64u*)pa_out[buf_no];
+
+         zero_mask |= (int8u)((0 == (x0|x1|x2|x3)) << buf_no);
+         if(NULL != out) {
+            out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+         }
+      }
+   }
+
+   /* clear copy of the results */
+   for(i=0; i<FE26_LEN; i++)
+      _mm256_store_si256((U64*)t[i], _mm256_setzero_si256());
+
+   return zero_mask;
+}
+
+/* copies 4 private keys and decodes them into scalars according to RFC7748 */
+static void x25519_decode_scalar_mb4(int64u scalar[4][4], const int8u* const pa_private_key[4])
+{
+   int buf_no, i;
+   for(buf_no=0; buf_no<4; buf_no++) {
+      const int64u* key = (const int64u*)pa_private_key[buf_no];
+      for(i=0; i<4; i++)
+         scalar[i][buf_no] = (NULL != key)? key[i] : 0;
+      scalar[0][buf_no] &= 0xfffffffffffffff8;
+      scalar[3][buf_no] &= 0x7fffffffffffffff;
+      scalar[3][buf_no] |= 0x4000000000000000;
+   }
+}
+
+/* Montgomery ladder, RFC7748 */
+static void x25519_scalar_mul_mb4(U64 out[], const int64u scalar[4][4], const U64 point[])
+{
+   U64 x1[FE26_LEN], x2[FE26_LEN], z2[FE26_LEN], x3[FE26_LEN], z3[FE26_LEN];
+   U64 A[FE26_LEN], AA[FE26_LEN], B[FE26_LEN], BB[FE26_LEN], E[FE26_LEN];
+   U64 C[FE26_LEN], D[FE26_LEN];
+   U64 swap = _mm256_setzero_si256();
+   const U64 one = _mm256_set1_epi64x(1);
+   int bitpos;
+
+   fe26mb4_copy(x1, point);
+   fe26mb4_set(x2, 1);
+   fe26mb4_set(z2, 0);
+   fe26mb4_copy(x3, point);
+   fe26mb4_set(z3, 1);
+
+   for(bitpos=254; bitpos>=0; bitpos--) {
+      U64 e = _mm256_load_si256((const U64*)scalar[bitpos/64]);
+      U64 b = _mm256_and_si256(_mm256_srli_epi64(e, bitpos%64), one);
+      b = _mm256_sub_epi64(_mm256_setzero_si256(), b);
+
+      swap = _mm256_xor_si256(swap, b);
+      fe26mb4_cswap(x2, x3, swap);
+      fe26mb4_cswap(z2, z3, swap);
+      swap = b;
+
+      fe26mb4_add(A, x2, z2);          /* A  = x2+z2            */
+      fe26mb4_sqr(AA, A);              /* AA = A^2              */
+      fe26mb4_sub(B, x2, z2);          /* B  = x2-z2            */
+      fe26mb4_sqr(BB, B);              /* BB = B^2              */
+      fe26mb4_sub(E, AA, BB);          /* E  = AA-BB            */
+      fe26mb4_add(C, x3, z3);          /* C  = x3+z3            */
+      fe26mb4_sub(D, x3, z3);          /* D  = x3-z3            */
+      fe26mb4_mul(D, D, A);            /* DA = D*A              */
+      fe26mb4_mul(C, C, B);            /* CB = C*B              */
+      fe26mb4_add(x3, D, C);
+      fe26mb4_sqr(x3, x3);             /* x3 = (DA+CB)^2        */
+      fe26mb4_sub(z3, D, C);
+      fe26mb4_sqr(z3, z3);
+      fe26mb4_mul(z3, z3, x1);         /* z3 = x1*(DA-CB)^2     */
+      fe26mb4_mul(x2, AA, BB);         /* x2 = AA*BB            */
+      fe26mb4_mul121665(z2, E);
+      fe26mb4_add(z2, z2, AA);
+      fe26mb4_mul(z2, z2, E);          /* z2 = E*(AA + a24*E)   */
+   }
+
+   fe26mb4_cswap(x2, x3, swap);
+   fe26mb4_cswap(z2, z3, swap);
+
+   fe26mb4_inv_mod25519(z2, z2);
+   fe26mb4_mul(out, x2, z2);
+
+   /* clear the ladder state, it depends on the secret */
+   fe26mb4_set(x2, 0); fe26mb4_set(z2, 0);
+   fe26mb4_set(x3, 0); fe26mb4_set(z3, 0);
+}
+
+/* returns status of the 4 buffers in the low 16 bits */
+mbx_status MB_FUNC_NAME(internal_avx2_x25519_)(int8u* const pa_shared_key[4],
+                                              const int8u* const pa_private_key[4],
+                                              const int8u* const pa_public_key[4])
+{
+   mbx_status status = 0;
+
+   __ALIGN64 int64u scalar[4][4];
+   U64 pub[FE26_LEN];
+   U64 shared[FE26_LEN];
+
+   x25519_decode_scalar_mb4(scalar, pa_private_key);
+
+   /* RFC7748: (x25519) ... MUST mask the most significant bit in the final byte */
+   fe26mb4_from_bytes(pub, pa_public_key);
+
+   x25519_scalar_mul_mb4(shared, (const int64u (*)[4])scalar, pub);
+
+   /* all-zero output results when the input is a point of small order */
+   int8u stt_mask = fe26mb4_to_bytes(pa_shared_key, shared);
+   int buf_no;
+   for(buf_no=0; buf_no<4; buf_no++) {
+      if(NULL!=pa_shared_key[buf_no] && NULL!=pa_private_key[buf_no] && NULL!=pa_public_key[buf_no] && ((stt_mask>>buf_no)&1))
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_LOW_ORDER_ERR);
+   }
+
+   /* clear copy of the secret keys and shared keys */
+   fe26mb4_set(shared, 0);
+   for(buf_no=0; buf_no<4; buf_no++)
+      _mm256_store_si256((U64*)scalar[buf_no], _mm256_setzero_si256());
+
+   return status;
+}
+
+mbx_status MB_FUNC_NAME(internal_avx2_x25519_public_key_)(int8u* const pa_public_key[4],
+                                                         const int8u* const pa_private_key[4])
+{
+   __ALIGN64 int64u scalar[4][4];
+   U64 base[FE26_LEN];
+   U64 pub[FE26_LEN];
+   int buf_no;
+
+   x25519_decode_scalar_mb4(scalar, pa_private_key);
+
+   /* base point u = 9 */
+   fe26mb4_set(base, 9);
+   x25519_scalar_mul_mb4(pub, (const int64u (*)[4])scalar, base);
+
+   fe26mb4_to_bytes(pa_public_key, pub);
+
+   /* clear copy of the secret keys */
+   for(buf_no=0; buf_no<4; buf_no++)
+      _mm256_store_si256((U64*)scalar[buf_no], _mm256_setzero_si256());
+
+   return 0;
+}
+
+#endif /* #if (_MBX == _MBX_L9) */
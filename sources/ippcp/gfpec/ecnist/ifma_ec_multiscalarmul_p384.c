@@ -0,0 +1,149 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+
+#if (_IPP32E >= _IPP32E_K1)
+
+#include "gfpec/pcpgfpstuff.h"
+#include "gfpec/pcpgfpecstuff.h"
+
+#include "gfpec/ecnist/ifma_arith_method.h"
+#include "gfpec/ecnist/ifma_ecpoint_p384.h"
+
+/*
+// Multi-scalar multiplication, see gfec_MultiScalarMul() for the method.
+// Table entries and buckets are kept in projective radix 2^52 form:
+// ifma_ec_nistp384_add_point() is complete (infinity and equal points),
+// so no conversion into affine coordinates is needed.
+*/
+
+IPP_OWN_DEFN (int, gfec_MultiScalarMulBufferSize_nistp384_avx512, (int nPoints, const IppsGFpECState* pEC))
+{
+   return gfec_MultiScalarMulBufferSize(nPoints, (int)sizeof(P384_POINT_IFMA), ECP_ORDBITSIZE(pEC));
+}
+
+IPP_OWN_DEFN (IppsGFpECPoint*, gfec_MultiScalarMul_nistp384_avx512, (IppsGFpECPoint* pR,
+                                                                     const IppsGFpECPoint* const ppP[],
+                                                                     const IppsBigNumState* const ppN[],
+                                                                     int nPoints,
+                                                                     IppsGFpECState* pEC,
+                                                                     Ipp8u* pScratchBuffer))
+{
+   gsModEngine *pME = GFP_PMA(ECP_GFP(pEC));
+   ifmaArithMethod *pmeth = (ifmaArithMethod *)GFP_METHOD_ALT(pME);
+
+   const int scalarBitSize = ECP_ORDBITSIZE(pEC);
+   int straus;
+   const int w = gfec_MultiScalarMulWinSize(nPoints, scalarBitSize, &straus);
+   const int nDigits  = scalarBitSize/w + 1;
+   const int nEntries = 1<<(w-1);
+
+   /* scratch buffer: digits, points */
+   Ipp16s* pDigits = (Ipp16s*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+   P384_POINT_IFMA* pTable = (P384_POINT_IFMA*)( (Ipp8u*)pDigits + IPP_ALIGNED_SIZE(nPoints*nDigits*(Ipp32s)sizeof(Ipp16s), CACHE_LINE_SIZE) );
+
+   __ALIGN64 P384_POINT_IFMA R, T;
+
+   BNU_CHUNK_T *pPool = cpGFpGetPool(3, pME);
+
+   int i, j, k;
+
+   R.x = R.y = R.z = setzero_i64();
+
+   for(i=0; i<nPoints; i++)
+      gfec_MultiScalarMulRecode(pDigits + i*nDigits, nDigits, BN_NUMBER(ppN[i]), BN_SIZE(ppN[i]), w);
+
+   if(straus) {
+      /* table(i)[k] = [k+1]*P(i) */
+      for(i=0; i<nPoints; i++) {
+         P384_POINT_IFMA* pTbl = pTable + i*nEntries;
+         recode_point_to_mont52(pTbl, ECP_POINT_DATA(ppP[i]), pPool, pmeth, pME);
+         if(nEntries>1)
+            ifma_ec_nistp384_dbl_point(pTbl + 1, pTbl);
+         for(k=2; k<nEntries; k++)
+            ifma_ec_nistp384_add_point(pTbl + k, pTbl + k-1, pTbl);
+      }
+
+      for(j=nDigits-1; j>=0; j--) {
+         for(k=0; k<w; k++)
+            ifma_ec_nistp384_dbl_point(&R, &R);
+
+         for(i=0; i<nPoints; i++) {
+            int d = pDigits[i*nDigits + j];
+            if(d) {
+               const P384_POINT_IFMA* pE = pTable + i*nEntries + IPP_ABS(d)-1;
+               if(d<0) {
+                  T.x = pE->x;
+                  T.y = ifma_neg52_p384(pE->y);
+                  T.z = pE->z;
+                  pE = &T;
+               }
+               ifma_ec_nistp384_add_point(&R, &R, pE);
+            }
+         }
+      }
+   }
+
+   else {
+      P384_POINT_IFMA* pBucket = pTable + nPoints;
+      __ALIGN64 P384_POINT_IFMA Run, Sum;
+
+      for(i=0; i<nPoints; i++)
+         recode_point_to_mont52(pTable + i, ECP_POINT_DATA(ppP[i]), pPool, pmeth, pME);
+
+      for(j=nDigits-1; j>=0; j--) {
+         for(k=0; k<w; k++)
+            ifma_ec_nistp384_dbl_point(&R, &R);
+
+         /* fill buckets: bucket[|d|-1] += sign(d)*P */
+         for(k=0; k<nEntries; k++)
+            pBucket[k].x = pBucket[k].y = pBucket[k].z = setzero_i64();
+         for(i=0; i<nPoints; i++) {
+            int d = pDigits[i*nDigits + j];
+            if(d) {
+               const P384_POINT_IFMA* pE = pTable + i;
+               if(d<0) {
+                  T.x = pE->x;
+                  T.y = ifma_neg52_p384(pE->y);
+                  T.z = pE->z;
+                  pE = &T;
+               }
+               ifma_ec_nistp384_add_point(pBucket + IPP_ABS(d)-1, pBucket + IPP_ABS(d)-1, pE);
+            }
+         }
+
+         /* sum = sum(k*bucket[k-1]) by running sums */
+         Run.x = Run.y = Run.z = setzero_i64();
+         Sum.x = Sum.y = Sum.z = setzero_i64();
+         for(k=nEntries-1; k>=0; k--) {
+            ifma_ec_nistp384_add_point(&Run, &Run, pBucket + k);
+            ifma_ec_nistp384_add_point(&Sum, &Sum, &Run);
+         }
+
+         ifma_ec_nistp384_add_point(&R, &R, &Sum);
+      }
+   }
+
+   recode_point_to_mont64(pR, &R, pPool, pmeth, pME);
+
+   cpGFpReleasePool(3, pME);
+
+   ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR) ? 0 : ECP_FINITE_POINT;
+   return pR;
+}
+
+#endif // (_IPP32E >= _IPP32E_K1)
@@ -117,6 +117,13 @@ extern const BNU_CHUNK_T secp256r1_gy[];
 extern const BNU_CHUNK_T secp256r1_r[];
 extern       BNU_CHUNK_T secp256r1_h;
 
+extern const BNU_CHUNK_T secp256k1_a[];
+extern const BNU_CHUNK_T secp256k1_b[];
+extern const BNU_CHUNK_T secp256k1_gx[];
+extern const BNU_CHUNK_T secp256k1_gy[];
+extern const BNU_CHUNK_T secp256k1_r[];
+extern       BNU_CHUNK_T secp256k1_h;
+
 extern const BNU_CHUNK_T secp384r1_p[]; // 2^384 -2^128 -2^96 +2^32 -1
 extern const BNU_CHUNK_T secp384r1_a[];
 extern const BNU_CHUNK_T secp384r1_b[];
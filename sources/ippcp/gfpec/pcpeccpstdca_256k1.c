@@ -0,0 +1,57 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+/* 
+// 
+//  Purpose:
+//     Cryptography Primitive.
+//     ECC over Prime Finite Field (recommended ECC parameters)
+// 
+//  Contents:
+//     secp256k1               (* SEC 2 Koblitz curve, p = 2^256 -2^32 -977 *)
+// 
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "gfpec/pcpgfpstuff.h"
+
+#if defined( _IPP_DATA )
+
+/*
+// Recommended Parameters secp256k1
+*/
+const BNU_CHUNK_T secp256k1_p[] = { // 2^256 -2^32 -977
+   LL(0xFFFFFC2F, 0xFFFFFFFE), LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0xFFFFFFFF, 0xFFFFFFFF),
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0x0, 0x0)};
+const BNU_CHUNK_T secp256k1_a[] = {
+   LL(0x00000000, 0x00000000), LL(0x00000000, 0x00000000), LL(0x00000000, 0x00000000),
+   LL(0x00000000, 0x00000000)};
+const BNU_CHUNK_T secp256k1_b[] = {
+   LL(0x00000007, 0x00000000), LL(0x00000000, 0x00000000), LL(0x00000000, 0x00000000),
+   LL(0x00000000, 0x00000000)};
+const BNU_CHUNK_T secp256k1_gx[] = {
+   LL(0x16F81798, 0x59F2815B), LL(0x2DCE28D9, 0x029BFCDB), LL(0xCE870B07, 0x55A06295),
+   LL(0xF9DCBBAC, 0x79BE667E)};
+const BNU_CHUNK_T secp256k1_gy[] = {
+   LL(0xFB10D4B8, 0x9C47D08F), LL(0xA6855419, 0xFD17B448), LL(0x0E1108A8, 0x5DA4FBFC),
+   LL(0x26A3C465, 0x483ADA77)};
+const BNU_CHUNK_T secp256k1_r[] = {
+   LL(0xD0364141, 0xBFD25E8C), LL(0xAF48A03B, 0xBAAEDCE6), LL(0xFFFFFFFE, 0xFFFFFFFF),
+   LL(0xFFFFFFFF, 0xFFFFFFFF)};
+BNU_CHUNK_T secp256k1_h = 1;
+
+#endif /* _IPP_DATA */
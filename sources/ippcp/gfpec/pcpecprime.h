@@ -45,6 +45,11 @@ extern const BNU_CHUNK_T secp256r1_p[]; // 2^256 -2^224 +2^192 +2^96 -1
 extern const BNU_CHUNK_T secp384r1_p[]; // 2^384 -2^128 -2^96 +2^32 -1
 extern const BNU_CHUNK_T secp521r1_p[]; // 2^521 -1
 
+/*
+// Recommended (SEC 2 Koblitz) underlying EC Prime
+*/
+extern const BNU_CHUNK_T secp256k1_p[]; // 2^256 -2^32 -977
+
 extern const BNU_CHUNK_T tpmBN_p256p_p[]; // TPM BN_P256
 
 /*
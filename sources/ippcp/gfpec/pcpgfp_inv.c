@@ -30,7 +30,6 @@
 IPP_OWN_DEFN (BNU_CHUNK_T*, cpGFpInv, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFE))
 {
    GFP_METHOD(pGFE)->decode(pR, pA, pGFE);
-   /* gs_mont_inv(pR, pR, pGFE, alm_mont_inv); */
-   gs_mont_inv(pR, pR, pGFE, alm_mont_inv_ct); /* switch on CTE internal function */
+   gs_mont_inv(pR, pR, pGFE, sgcd_mont_inv_ct); /* switch on CTE internal function */
    return pR;
 }
@@ -46,7 +46,27 @@ IPP_OWN_DEFN (IppsGFpECPoint*, gfec_BasePointProduct, (IppsGFpECPoint* pR, const
       cpGFpElementCopyPad(tmpScalarG, orderLen+1, pScalarG,scalarGlen);
       cpGFpElementCopyPad(tmpScalarP, orderLen+1, pScalarP,scalarPlen);
 
-      if(ECP_PREMULBP(pEC)) {
+      /* secp256k1: GLV decomposition of the (public) scalars */
+      if(cpID_PrimeP256k1==ECP_MODULUS_ID(pEC)) {
+         if(ECP_PREMULBP(pEC)) {
+            BNU_CHUNK_T* productG = cpEcGFpGetPool(2, pEC);
+            BNU_CHUNK_T* productP = productG+ECP_POINTLEN(pEC);
+
+            gfec_base_point_mul(productG, (Ipp8u*)tmpScalarG, orderBits, pEC);
+            gfec_point_prod_p256k1(productP, NULL, NULL, ECP_POINT_X(pP), tmpScalarP, pEC, pScratchBuffer);
+            gfec_point_add(ECP_POINT_X(pR), productG, productP, pEC);
+
+            cpEcGFpReleasePool(2, pEC);
+         }
+         else {
+            gfec_point_prod_p256k1(ECP_POINT_X(pR),
+                                   ECP_G(pEC), tmpScalarG,
+                                   ECP_POINT_X(pP), tmpScalarP,
+                                   pEC, pScratchBuffer);
+         }
+      }
+
+      else if(ECP_PREMULBP(pEC)) {
          BNU_CHUNK_T* productG = cpEcGFpGetPool(2, pEC);
          BNU_CHUNK_T* productP = productG+ECP_POINTLEN(pEC);
 
@@ -0,0 +1,118 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        gfec_GetPointsBatch()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "pcpmask_ct.h"
+
+
+#if ( ECP_PROJECTIVE_COORD == JACOBIAN )
+/*
+// Copies Z coordinate of the point into pZ, unity is substituted
+// for the affine and infinite points.
+// Returns all-ones mask if the point is finite, 0 otherwise.
+*/
+static BNU_CHUNK_T batch_point_z(BNU_CHUNK_T* pZ, const IppsGFpECPoint* pPoint, const BNU_CHUNK_T* pOne, int elemLen)
+{
+   BNU_CHUNK_T zeroMask;
+
+   if( !IS_ECP_FINITE_POINT(pPoint) || IS_ECP_AFFINE_POINT(pPoint) ) {
+      cpGFpElementCopy(pZ, pOne, elemLen);
+      return IS_ECP_FINITE_POINT(pPoint)? (BNU_CHUNK_T)(-1) : 0;
+   }
+
+   /* finite point with Z==0 is treated as infinity */
+   cpGFpElementCopy(pZ, ECP_POINT_Z(pPoint), elemLen);
+   zeroMask = GFPE_IS_ZERO_CT(pZ, elemLen);
+   cpMaskedReplace_ct(pZ, pOne, elemLen, zeroMask);
+   return ~zeroMask;
+}
+
+/*
+// Converts nPoints points into affine coordinates by the single inversion
+// (Montgomery's trick). The affine (x,y) of ppPoint[n] are stored
+// at pXY + 2*n*elemLen, points at infinity become (0,0).
+// pPrefix is nPoints elements.
+//
+// Returns 1 if all points are finite, 0 otherwise.
+// Execution time does not depend on the coordinates of the points.
+*/
+IPP_OWN_DEFN (int, gfec_GetPointsBatch, (BNU_CHUNK_T* pXY, const IppsGFpECPoint* const ppPoint[], int nPoints, IppsGFpECState* pEC, BNU_CHUNK_T* pPrefix))
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   gsModEngine* pBasicGFE = cpGFpBasic(pGFE);
+   int elemLen = GFP_FELEN(pGFE);
+   int peLen = GFP_PELEN(pGFE);
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+
+   BNU_CHUNK_T* pOne = cpGFpGetPool(4, pGFE);
+   BNU_CHUNK_T* pAcc = pOne + peLen;
+   BNU_CHUNK_T* pZ = pAcc + peLen;
+   BNU_CHUNK_T* pT = pZ + peLen;
+
+   BNU_CHUNK_T allFinite = (BNU_CHUNK_T)(-1);
+   int n;
+
+   cpGFpElementCopyPad(pOne, elemLen, GFP_MNT_R(pBasicGFE), GFP_FELEN(pBasicGFE));
+
+   /* prefix[n] = z[0]*...*z[n-1] */
+   cpGFpElementCopy(pAcc, pOne, elemLen);
+   for(n=0; n<nPoints; n++) {
+      allFinite &= batch_point_z(pZ, ppPoint[n], pOne, elemLen);
+      cpGFpElementCopy(pPrefix + n*elemLen, pAcc, elemLen);
+      mulF(pAcc, pAcc, pZ, pGFE);
+   }
+
+   /* acc = 1/(z[0]*...*z[nPoints-1]), all z are non-zero */
+   cpGFpxInv(pAcc, pAcc, pGFE);
+
+   for(n=nPoints-1; n>=0; n--) {
+      const IppsGFpECPoint* pPoint = ppPoint[n];
+      BNU_CHUNK_T* pX = pXY + 2*n*elemLen;
+      BNU_CHUNK_T* pY = pX + elemLen;
+      BNU_CHUNK_T finiteMask = batch_point_z(pZ, pPoint, pOne, elemLen);
+      int i;
+
+      mulF(pPrefix + n*elemLen, pAcc, pPrefix + n*elemLen, pGFE);   /* 1/z[n] */
+      mulF(pAcc, pAcc, pZ, pGFE);                                   /* 1/(z[0]*...*z[n-1]) */
+
+      sqrF(pT, pPrefix + n*elemLen, pGFE);
+      mulF(pX, ECP_POINT_X(pPoint), pT, pGFE);
+      mulF(pT, pT, pPrefix + n*elemLen, pGFE);
+      mulF(pY, ECP_POINT_Y(pPoint), pT, pGFE);
+
+      for(i=0; i<2*elemLen; i++)
+         pX[i] &= finiteMask;
+   }
+
+   cpGFpReleasePool(4, pGFE);
+   return (int)(allFinite & 1);
+}
+#endif
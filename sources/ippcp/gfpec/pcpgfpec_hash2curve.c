@@ -0,0 +1,332 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) hashing to curve (RFC 9380)
+//
+//     Context:
+//        gfec_SSWUParams()
+//        gfec_HashToCurveInit()
+//        gfec_HashToCurve()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcptool.h"
+#include "pcpmask_ct.h"
+#include "gfpec/pcpeccp.h"
+#include "gfpec/pcpgfpech2c.h"
+
+/* supported suites: A = -3, p = 3 mod 4 */
+static const cpGFpECSSWU sswuParams[] = {
+   { secp256r1_p,   secp256r1_b,   h2c_p256r1_c2, 256, 256, -10, 48, 128 },
+   { secp384r1_p,   secp384r1_b,   h2c_p384r1_c2, 384, 384, -12, 72, 192 },
+   { secp521r1_p,   secp521r1_b,   h2c_p521r1_c2,  64, 521,  -4, 98, 256 },
+   { tpmSM2_p256_p, tpmSM2_p256_b, h2c_sm2_c2,     64, 256,  -9, 48, 128 }
+};
+
+/*
+// returns simplified SWU map parameters of the curve or NULL if curve is not supported
+*/
+IPP_OWN_DEFN (const cpGFpECSSWU*, gfec_SSWUParams, (IppsGFpECState* pEC))
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int n;
+
+   if(!GFP_IS_BASIC(pGFE))
+      return NULL;
+
+   for(n=0; n<(int)(sizeof(sswuParams)/sizeof(sswuParams[0])); n++) {
+      const cpGFpECSSWU* pSSWU = sswuParams+n;
+
+      if(GFP_FEBITLEN(pGFE)==pSSWU->modBitSize
+         && GFP_EQ(GFP_MODULUS(pGFE), pSSWU->pModulus, elemLen)) {
+         int isSupported;
+         BNU_CHUNK_T* pT = cpGFpGetPool(1, pGFE);
+
+         /* A = -3 */
+         GFP_METHOD(pGFE)->decode(pT, ECP_A(pEC), pGFE);
+         cpInc_BNU(pT, pT, elemLen, 3);
+         isSupported = GFP_EQ(pT, pSSWU->pModulus, elemLen);
+
+         /* B */
+         GFP_METHOD(pGFE)->decode(pT, ECP_B(pEC), pGFE);
+         isSupported &= GFP_EQ(pT, pSSWU->pB, elemLen);
+
+         cpGFpReleasePool(1, pGFE);
+         return isSupported? pSSWU : NULL;
+      }
+   }
+   return NULL;
+}
+
+/*
+// prepares DST_prime and the hash state after Z_pad (expand_message_xmd)
+*/
+IPP_OWN_DEFN (void, gfec_HashToCurveInit, (cpGFpECH2C* pH2C, const Ipp8u* pDST, int dstLen, const cpGFpECSSWU* pSSWU, const IppsHashMethod* pMethod))
+{
+   pH2C->pSSWU = pSSWU;
+
+   /* DST_prime = DST || I2OSP(len(DST), 1), oversized DST is replaced by its hash */
+   if(dstLen>H2C_MAX_DST_LEN) {
+      static const Ipp8u oversizePrefix[] = "H2C-OVERSIZE-DST-";
+      ippsHashInit_rmf(&pH2C->padState, pMethod);
+      ippsHashUpdate_rmf(oversizePrefix, (int)sizeof(oversizePrefix)-1, &pH2C->padState);
+      ippsHashUpdate_rmf(pDST, dstLen, &pH2C->padState);
+      ippsHashFinal_rmf(pH2C->dstPrime, &pH2C->padState);
+      dstLen = pMethod->hashLen;
+   }
+   else
+      CopyBlock(pDST, pH2C->dstPrime, dstLen);
+   pH2C->dstPrime[dstLen] = (Ipp8u)dstLen;
+   pH2C->dstPrimeLen = dstLen+1;
+
+   /* hash(Z_pad) */
+   {
+      Ipp8u zeros[MBS_HASH_MAX];
+      PadBlock(0, zeros, sizeof(zeros));
+      ippsHashInit_rmf(&pH2C->padState, pMethod);
+      ippsHashUpdate_rmf(zeros, pMethod->msgBlkSize, &pH2C->padState);
+   }
+}
+
+/*
+// expand_message_xmd(msg, DST, len)
+*/
+static void h2cExpandMessageXMD(Ipp8u* pOut, int outLen, const Ipp8u* pMsg, int msgLen, const cpGFpECH2C* pH2C)
+{
+   const IppsHashMethod* pMethod = pH2C->padState.pMethod;
+   int hashLen = pMethod->hashLen;
+
+   Ipp8u b0[IPP_SHA512_DIGEST_BITSIZE/BYTESIZE];
+   Ipp8u bi[IPP_SHA512_DIGEST_BITSIZE/BYTESIZE];
+   IppsHashState_rmf hashCtx;
+   Ipp8u lenStr[3];
+   int i, n;
+
+   /* b_0 = H(Z_pad || msg || I2OSP(len, 2) || I2OSP(0, 1) || DST_prime) */
+   lenStr[0] = (Ipp8u)(outLen>>8);
+   lenStr[1] = (Ipp8u)outLen;
+   lenStr[2] = 0;
+   ippsHashDuplicate_rmf(&pH2C->padState, &hashCtx);
+   ippsHashUpdate_rmf(pMsg, msgLen, &hashCtx);
+   ippsHashUpdate_rmf(lenStr, 3, &hashCtx);
+   ippsHashUpdate_rmf(pH2C->dstPrime, pH2C->dstPrimeLen, &hashCtx);
+   ippsHashFinal_rmf(b0, &hashCtx);
+
+   /* b_i = H(strxor(b_0, b_(i-1)) || I2OSP(i, 1) || DST_prime) */
+   PadBlock(0, bi, hashLen);
+   for(i=1; outLen>0; i++) {
+      Ipp8u idx = (Ipp8u)i;
+      for(n=0; n<hashLen; n++)
+         bi[n] ^= b0[n];
+      ippsHashInit_rmf(&hashCtx, pMethod);
+      ippsHashUpdate_rmf(bi, hashLen, &hashCtx);
+      ippsHashUpdate_rmf(&idx, 1, &hashCtx);
+      ippsHashUpdate_rmf(pH2C->dstPrime, pH2C->dstPrimeLen, &hashCtx);
+      ippsHashFinal_rmf(bi, &hashCtx);
+
+      n = IPP_MIN(hashLen, outLen);
+      CopyBlock(bi, pOut, n);
+      pOut += n;
+      outLen -= n;
+   }
+
+   PurgeBlock(b0, sizeof(b0));
+   PurgeBlock(bi, sizeof(bi));
+}
+
+/* R = A^E, E is public */
+static void h2cExpPublic(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pE, int nsE, gsModEngine* pGFE)
+{
+   int bit = BITSIZE_BNU(pE, nsE) -1;
+
+   cpGFpElementCopy(pR, pA, GFP_FELEN(pGFE));
+   for(bit--; bit>=0; bit--) {
+      GFP_METHOD(pGFE)->sqr(pR, pR, pGFE);
+      if(TST_BIT(pE, bit))
+         GFP_METHOD(pGFE)->mul(pR, pR, pA, pGFE);
+   }
+}
+
+/* sgn0(a) */
+__IPPCP_INLINE BNU_CHUNK_T h2cSgn0(const BNU_CHUNK_T* pA, BNU_CHUNK_T* pT, gsModEngine* pGFE)
+{
+   GFP_METHOD(pGFE)->decode(pT, pA, pGFE);
+   return pT[0] & 1;
+}
+
+/*
+// simplified SWU map (RFC 9380, F.2, p = 3 mod 4 sqrt_ratio).
+// The result is returned in Jacobian coordinates: (xn*xd : y*xd^3 : xd),
+// so no field inversion is required.
+*/
+static void h2cMapToCurveSSWU(IppsGFpECPoint* pR, const BNU_CHUNK_T* pU, const BNU_CHUNK_T* pC1, int nsC1,
+                              const cpGFpECSSWU* pSSWU, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+   mod_add addF = GFP_METHOD(pGFE)->add;
+   mod_sub subF = GFP_METHOD(pGFE)->sub;
+   mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+   const BNU_CHUNK_T* pA = ECP_A(pEC);
+   const BNU_CHUNK_T* pB = ECP_B(pEC);
+   const BNU_CHUNK_T* pOne = GFP_MNT_R(pGFE);
+
+   const int poolLen = 10;
+   BNU_CHUNK_T* pZ   = cpGFpGetPool(poolLen, pGFE);
+   BNU_CHUNK_T* pC2  = pZ  + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv1  = pC2 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv2  = tv1 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv3  = tv2 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv4  = tv3 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv5  = tv4 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* tv6  = tv5 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* y1   = tv6 + GFP_PELEN(pGFE);
+   BNU_CHUNK_T* y2   = y1  + GFP_PELEN(pGFE);
+
+   BNU_CHUNK_T* pX = ECP_POINT_X(pR);
+   BNU_CHUNK_T* pY = ECP_POINT_Y(pR);
+   BNU_CHUNK_T* pXd= ECP_POINT_Z(pR);
+
+   BNU_CHUNK_T mask;
+
+   /* constants: Z, c2 = sqrt(-Z) */
+   {
+      BNU_CHUNK_T z = (BNU_CHUNK_T)(-pSSWU->Z);
+      cpGFpSet(pZ, &z, 1, pGFE);
+      negF(pZ, pZ, pGFE);
+      cpGFpSet(pC2, pSSWU->pC2, BITS_BNU_CHUNK(pSSWU->c2BitSize), pGFE);
+   }
+
+   sqrF(tv1, pU, pGFE);                   /*  1. tv1 = u^2 */
+   mulF(tv1, pZ, tv1, pGFE);              /*  2. tv1 = Z * tv1 */
+   sqrF(tv2, tv1, pGFE);                  /*  3. tv2 = tv1^2 */
+   addF(tv2, tv2, tv1, pGFE);             /*  4. tv2 = tv2 + tv1 */
+   addF(tv3, tv2, pOne, pGFE);            /*  5. tv3 = tv2 + 1 */
+   mulF(tv3, pB, tv3, pGFE);              /*  6. tv3 = B * tv3 */
+   negF(tv4, tv2, pGFE);                  /*  7. tv4 = CMOV(Z, -tv2, tv2 != 0) */
+   mask = GFPE_IS_ZERO_CT(tv2, elemLen);
+   cpMaskedReplace_ct(tv4, pZ, elemLen, mask);
+   mulF(tv4, pA, tv4, pGFE);              /*  8. tv4 = A * tv4 */
+   sqrF(tv2, tv3, pGFE);                  /*  9. tv2 = tv3^2 */
+   sqrF(tv6, tv4, pGFE);                  /* 10. tv6 = tv4^2 */
+   mulF(tv5, pA, tv6, pGFE);              /* 11. tv5 = A * tv6 */
+   addF(tv2, tv2, tv5, pGFE);             /* 12. tv2 = tv2 + tv5 */
+   mulF(tv2, tv2, tv3, pGFE);             /* 13. tv2 = tv2 * tv3 */
+   mulF(tv6, tv6, tv4, pGFE);             /* 14. tv6 = tv6 * tv4 */
+   mulF(tv5, pB, tv6, pGFE);              /* 15. tv5 = B * tv6 */
+   addF(tv2, tv2, tv5, pGFE);             /* 16. tv2 = tv2 + tv5 */
+   mulF(pX, tv1, tv3, pGFE);              /* 17. x = tv1 * tv3 */
+
+   /* 18. (is_gx1_square, y1) = sqrt_ratio(tv2, tv6) */
+   sqrF(tv5, tv6, pGFE);                  /* tv1' = v^2 */
+   mulF(y2, tv2, tv6, pGFE);              /* tv2' = u * v */
+   mulF(tv5, tv5, y2, pGFE);              /* tv1' = tv1' * tv2' */
+   h2cExpPublic(y1, tv5, pC1, nsC1, pGFE);/* y1 = tv1'^c1 */
+   mulF(y1, y1, y2, pGFE);                /* y1 = y1 * tv2' */
+   mulF(y2, y1, pC2, pGFE);               /* y2 = y1 * c2 */
+   sqrF(tv5, y1, pGFE);                   /* tv3' = y1^2 */
+   mulF(tv5, tv5, tv6, pGFE);             /* tv3' = tv3' * v */
+   subF(tv5, tv5, tv2, pGFE);             /* isQR = tv3' == u */
+   mask = GFPE_IS_ZERO_CT(tv5, elemLen);
+   cpMaskedReplace_ct(y2, y1, elemLen, mask); /* y1 = CMOV(y2, y1, isQR) */
+
+   mulF(pY, tv1, pU, pGFE);               /* 19. y = tv1 * u */
+   mulF(pY, pY, y2, pGFE);                /* 20. y = y * y1 */
+   cpMaskedReplace_ct(pX, tv3, elemLen, mask); /* 21. x = CMOV(x, tv3, is_gx1_square) */
+   cpMaskedReplace_ct(pY, y2, elemLen, mask);  /* 22. y = CMOV(y, y1, is_gx1_square) */
+
+   /* 23-24. y = CMOV(-y, y, sgn0(u) == sgn0(y)) */
+   mask = cpIsEqu_ct(h2cSgn0(pU, tv5, pGFE), h2cSgn0(pY, tv5, pGFE));
+   negF(tv5, pY, pGFE);
+   cpMaskedReplace_ct(tv5, pY, elemLen, mask);
+
+   /* 25. (x, y) = (xn/xd, y) => Jacobian (xn*xd : y*xd^3 : xd) */
+   cpGFpElementCopy(pXd, tv4, elemLen);
+   mulF(pX, pX, pXd, pGFE);
+   sqrF(tv6, pXd, pGFE);
+   mulF(tv6, tv6, pXd, pGFE);
+   mulF(pY, tv5, tv6, pGFE);
+
+   ECP_POINT_FLAGS(pR) = ECP_FINITE_POINT;
+
+   cpGFpReleasePool(poolLen, pGFE);
+}
+
+/*
+// hash_to_curve (count = 2) and encode_to_curve (count = 1)
+*/
+IPP_OWN_DEFN (void, gfec_HashToCurve, (IppsGFpECPoint* pR, const Ipp8u* pMsg, int msgLen, int count, const cpGFpECH2C* pH2C, IppsGFpECState* pEC))
+{
+   const cpGFpECSSWU* pSSWU = pH2C->pSSWU;
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int L = pSSWU->L;
+
+   Ipp8u uniformBytes[2*H2C_MAX_L];
+   BNU_CHUNK_T u[BITS_BNU_CHUNK(H2C_MAX_L*BYTESIZE)+1];
+   BNU_CHUNK_T c1[BITS_BNU_CHUNK(IPP_MAX_GF_BITSIZE)];
+   cpSize nsC1;
+
+   /* c1 = (p-3)/4 */
+   nsC1 = cpLSR_BNU(c1, GFP_MODULUS(pGFE), elemLen, 2);
+
+   /* u = hash_to_field(msg, count) */
+   h2cExpandMessageXMD(uniformBytes, count*L, pMsg, msgLen, pH2C);
+
+   {
+      /* first point is computed in place */
+      IppsGFpECPoint* pQ = pR;
+      BNU_CHUNK_T* pPoolPoint = NULL;
+      cpGFPECPoint Q1;
+      int n;
+
+      for(n=0; n<count; n++) {
+         BNU_CHUNK_T* pU = cpGFpGetPool(1, pGFE);
+         cpSize nsU = cpFromOctStr_BNU(u, uniformBytes+n*L, L);
+         nsU = cpMod_BNU(u, nsU, GFP_MODULUS(pGFE), elemLen);
+         cpGFpSet(pU, u, nsU, pGFE);
+
+         if(n) {
+            pPoolPoint = cpEcGFpGetPool(1, pEC);
+            cpEcGFpInitPoint(&Q1, pPoolPoint, 0, pEC);
+            pQ = &Q1;
+         }
+         h2cMapToCurveSSWU(pQ, pU, c1, nsC1, pSSWU, pEC);
+         cpGFpReleasePool(1, pGFE);
+      }
+
+      /* R = Q0 + Q1, clear_cofactor() is identity for h = 1 curves */
+      if(count>1) {
+         gfec_AddPoint(pR, pR, pQ, pEC);
+         cpEcGFpReleasePool(1, pEC);
+      }
+   }
+
+   PurgeBlock(uniformBytes, sizeof(uniformBytes));
+   PurgeBlock(u, sizeof(u));
+}
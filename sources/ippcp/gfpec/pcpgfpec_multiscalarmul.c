@@ -0,0 +1,337 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Internal EC over GF(p^m) basic Definitions & Function Prototypes
+//
+//     Context:
+//        gfec_MultiScalarMulWinSize()
+//        gfec_MultiScalarMulBufferSize()
+//        gfec_MultiScalarMulRecode()
+//        gfec_MultiScalarMul()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcptool.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "gfpec/pcpgfpxstuff.h"
+
+/*
+// Multi-scalar multiplication R = [k0]*P0 + [k1]*P1 + ... + [kn-1]*Pn-1
+//
+// Scalars are recoded into signed w-bit digits d (-2^(w-1) <= d <= 2^(w-1)),
+// the digits are processed from the most significant one:
+//
+// Straus:    every point gets a table of [1..2^(w-1)]*P,
+//            R = [2^w]*R + sum(sign(d(i))*Table(i)[|d(i)|])
+// Pippenger: points are accumulated into 2^(w-1) buckets indexed by |d|,
+//            R = [2^w]*R + sum(j*bucket[j])
+//
+// The method and window size are chosen by estimated number of point additions,
+// doublings are counted as additions:
+//    Straus:    n*(b/w + 2^(w-1)) + b
+//    Pippenger: (b/w +1)*(n + 2^w) + b
+//
+// Variable time, for public scalars only.
+*/
+
+/* returns window size, *pStraus is set if Straus method is preferable */
+IPP_OWN_DEFN (int, gfec_MultiScalarMulWinSize, (int nPoints, int scalarBitSize, int* pStraus))
+{
+   Ipp64s b = scalarBitSize;
+   Ipp64s n = nPoints;
+   Ipp64s bestCost = IPP_MAX_64S;
+   int bestW = 0;
+   int w;
+
+   *pStraus = 0;
+
+   for(w=MSM_MIN_W; w<=MSM_MAX_STRAUS_W; w++) {
+      Ipp64s cost = n*(b/w + (1<<(w-1))) + b;
+      if(cost<bestCost) {
+         bestCost = cost;
+         bestW = w;
+         *pStraus = 1;
+      }
+   }
+   for(w=MSM_MIN_W; w<=MSM_MAX_BUCKET_W; w++) {
+      Ipp64s cost = (b/w + 1)*(n + (1<<w)) + b;
+      if(cost<bestCost) {
+         bestCost = cost;
+         bestW = w;
+         *pStraus = 0;
+      }
+   }
+   return bestW;
+}
+
+/*
+// Size (bytes) of the scratch buffer:
+//    digits of scalars,
+//    Straus:    2^(w-1) table entries per point,
+//    Pippenger: one entry per point and 2^(w-1) buckets
+// entrySize is size of point representation used by the implementation
+// (the generic one also keeps a prefix product element per entry).
+*/
+IPP_OWN_DEFN (int, gfec_MultiScalarMulBufferSize, (int nPoints, int entrySize, int scalarBitSize))
+{
+   int straus;
+   int w = gfec_MultiScalarMulWinSize(nPoints, scalarBitSize, &straus);
+   int nDigits = scalarBitSize/w + 1;
+
+   int digitsSize = IPP_ALIGNED_SIZE(nPoints*nDigits*(Ipp32s)sizeof(Ipp16s), CACHE_LINE_SIZE);
+   int nEntries = straus? nPoints*(1<<(w-1)) : nPoints + (1<<(w-1));
+
+   return digitsSize + nEntries*entrySize + CACHE_LINE_SIZE;
+}
+
+/*
+// Signed w-bit digits of the scalar, less significant first.
+// nDigits = bitsize/w + 1 is enough for the last carry.
+*/
+IPP_OWN_DEFN (void, gfec_MultiScalarMulRecode, (Ipp16s* pDigits, int nDigits, const BNU_CHUNK_T* pScalar, int scalarLen, int w))
+{
+   BNU_CHUNK_T mask = ((BNU_CHUNK_T)1<<w) -1;
+   int half = 1<<(w-1);
+   int carry = 0;
+   int n;
+
+   for(n=0; n<nDigits; n++) {
+      int nBit  = n*w;
+      int shift = nBit%BNU_CHUNK_BITS;
+      int offset= nBit/BNU_CHUNK_BITS;
+      BNU_CHUNK_T bits = 0;
+      int digit;
+
+      if(offset<scalarLen) {
+         bits = pScalar[offset] >> shift;
+         if((shift+w)>BNU_CHUNK_BITS && (offset+1)<scalarLen)
+            bits |= pScalar[offset+1] << (BNU_CHUNK_BITS-shift);
+      }
+
+      digit = (int)(bits & mask) + carry;
+      carry = digit>half;
+      if(carry)
+         digit -= 1<<w;
+
+      pDigits[n] = (Ipp16s)digit;
+   }
+}
+
+/*
+// R = R + A, affine A
+// in contrast to gfec_affine_point_add(), handles the R==A case and projective infinity R
+*/
+static void msm_add_affine(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pAdata, BNU_CHUNK_T* pTdata, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+
+   /* affine infinity is (0,0) */
+   if(GFP_IS_ZERO(pAdata, elemLen) && GFP_IS_ZERO(pAdata+elemLen, elemLen))
+      return;
+
+   if(GFP_IS_ZERO(pRdata+2*elemLen, elemLen)) {
+      cpGFpElementCopy(pRdata, pAdata, 2*elemLen);
+      cpGFpElementCopy(pRdata+2*elemLen, GFP_MNT_R(pGFE), elemLen);
+      return;
+   }
+
+   gfec_affine_point_add(pTdata, pRdata, pAdata, pEC);
+
+   /* Z3==0 means equal X: either R==A or R==-A */
+   if(GFP_IS_ZERO(pTdata+2*elemLen, elemLen)) {
+      cpGFpElementCopy(pTdata, pAdata, 2*elemLen);
+      cpGFpElementCopy(pTdata+2*elemLen, GFP_MNT_R(pGFE), elemLen);
+      gfec_point_add(pRdata, pRdata, pTdata, pEC);
+   }
+   else
+      cpGFpElementCopy(pRdata, pTdata, 3*elemLen);
+}
+
+/* R = R +/- A, affine A */
+static void msm_add_signed(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pAdata, int sign, BNU_CHUNK_T* pTdata, BNU_CHUNK_T* pNdata, IppsGFpECState* pEC)
+{
+   if(sign) {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      int elemLen = GFP_FELEN(pGFE);
+      cpGFpElementCopy(pNdata, pAdata, elemLen);
+      GFP_METHOD(pGFE)->neg(pNdata+elemLen, pAdata+elemLen, pGFE);
+      pAdata = pNdata;
+   }
+   msm_add_affine(pRdata, pAdata, pTdata, pEC);
+}
+
+/*
+// Converts projective points (stride is 3*elemLen) into affine ones in place
+// by the single inversion (Montgomery's trick). Points at infinity become (0,0).
+// pPrefix is nPoints elements.
+*/
+static void msm_batch_to_affine(BNU_CHUNK_T* pPoints, int nPoints, BNU_CHUNK_T* pPrefix, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int stride = 3*elemLen;
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+
+   BNU_CHUNK_T* pAcc = cpGFpGetPool(3, pGFE);
+   BNU_CHUNK_T* pZinv = pAcc + elemLen;
+   BNU_CHUNK_T* pT = pZinv + elemLen;
+
+   int n;
+
+   /* prefix[n] = z[0]*...*z[n-1] (zero z are skipped) */
+   cpGFpElementCopy(pAcc, GFP_MNT_R(pGFE), elemLen);
+   for(n=0; n<nPoints; n++) {
+      const BNU_CHUNK_T* pZ = pPoints + n*stride + 2*elemLen;
+      cpGFpElementCopy(pPrefix + n*elemLen, pAcc, elemLen);
+      if(!GFP_IS_ZERO(pZ, elemLen))
+         mulF(pAcc, pAcc, pZ, pGFE);
+   }
+
+   /* acc = 1/(z[0]*...*z[nPoints-1]) */
+   cpGFpxInv(pAcc, pAcc, pGFE);
+
+   for(n=nPoints-1; n>=0; n--) {
+      BNU_CHUNK_T* pX = pPoints + n*stride;
+      BNU_CHUNK_T* pY = pX + elemLen;
+      BNU_CHUNK_T* pZ = pY + elemLen;
+
+      if(GFP_IS_ZERO(pZ, elemLen)) {
+         cpGFpElementPad(pX, 2*elemLen, 0);
+         continue;
+      }
+
+      mulF(pZinv, pAcc, pPrefix + n*elemLen, pGFE);   /* 1/z[n] */
+      mulF(pAcc, pAcc, pZ, pGFE);                     /* 1/(z[0]*...*z[n-1]) */
+
+      sqrF(pT, pZinv, pGFE);
+      mulF(pX, pX, pT, pGFE);
+      mulF(pT, pT, pZinv, pGFE);
+      mulF(pY, pY, pT, pGFE);
+      cpGFpElementCopy(pZ, GFP_MNT_R(pGFE), elemLen);
+   }
+
+   cpGFpReleasePool(3, pGFE);
+}
+
+IPP_OWN_DEFN (IppsGFpECPoint*, gfec_MultiScalarMul, (IppsGFpECPoint* pR, const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int pointLen = ECP_POINTLEN(pEC);
+
+   int scalarBitSize = ECP_ORDBITSIZE(pEC);
+   int straus;
+   int w = gfec_MultiScalarMulWinSize(nPoints, scalarBitSize, &straus);
+   int nDigits = scalarBitSize/w + 1;
+   int nEntries = 1<<(w-1);
+
+   /* scratch buffer: digits, points, prefix products */
+   Ipp16s* pDigits = (Ipp16s*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+   BNU_CHUNK_T* pTable = (BNU_CHUNK_T*)( (Ipp8u*)pDigits + IPP_ALIGNED_SIZE(nPoints*nDigits*(Ipp32s)sizeof(Ipp16s), CACHE_LINE_SIZE) );
+   int nTable = straus? nPoints*nEntries : nPoints;
+   BNU_CHUNK_T* pPrefix = pTable + nTable*pointLen;
+
+   /* temporary points */
+   BNU_CHUNK_T* pAcc = cpEcGFpGetPool(3, pEC);
+   BNU_CHUNK_T* pT   = pAcc + pointLen;
+   BNU_CHUNK_T* pN   = pT + pointLen;
+
+   int i, j, k;
+
+   /* R = infinity */
+   cpGFpElementPad(pAcc, pointLen, 0);
+
+   for(i=0; i<nPoints; i++)
+      gfec_MultiScalarMulRecode(pDigits + i*nDigits, nDigits, BN_NUMBER(ppN[i]), BN_SIZE(ppN[i]), w);
+
+   if(straus) {
+      /* table(i)[k] = [k+1]*P(i) */
+      for(i=0; i<nPoints; i++) {
+         BNU_CHUNK_T* pTbl = pTable + i*nEntries*pointLen;
+         cpGFpElementCopy(pTbl, ECP_POINT_DATA(ppP[i]), pointLen);
+         if(nEntries>1)
+            gfec_point_double(pTbl + pointLen, pTbl, pEC);
+         for(k=2; k<nEntries; k++)
+            gfec_point_add(pTbl + k*pointLen, pTbl + (k-1)*pointLen, pTbl, pEC);
+      }
+      msm_batch_to_affine(pTable, nTable, pPrefix, pEC);
+
+      for(j=nDigits-1; j>=0; j--) {
+         if(!GFP_IS_ZERO(pAcc+2*elemLen, elemLen)) {
+            for(k=0; k<w; k++)
+               gfec_point_double(pAcc, pAcc, pEC);
+         }
+         for(i=0; i<nPoints; i++) {
+            int d = pDigits[i*nDigits + j];
+            if(d)
+               msm_add_signed(pAcc, pTable + (i*nEntries + IPP_ABS(d)-1)*pointLen, d<0, pT, pN, pEC);
+         }
+      }
+   }
+
+   else {
+      BNU_CHUNK_T* pBucket = pPrefix + nPoints*elemLen;
+
+      for(i=0; i<nPoints; i++)
+         cpGFpElementCopy(pTable + i*pointLen, ECP_POINT_DATA(ppP[i]), pointLen);
+      msm_batch_to_affine(pTable, nPoints, pPrefix, pEC);
+
+      for(j=nDigits-1; j>=0; j--) {
+         BNU_CHUNK_T* pRun = pT;
+         BNU_CHUNK_T* pSum = pN;
+
+         if(!GFP_IS_ZERO(pAcc+2*elemLen, elemLen)) {
+            for(k=0; k<w; k++)
+               gfec_point_double(pAcc, pAcc, pEC);
+         }
+
+         /* fill buckets: bucket[|d|-1] += sign(d)*P */
+         cpGFpElementPad(pBucket, nEntries*pointLen, 0);
+         for(i=0; i<nPoints; i++) {
+            int d = pDigits[i*nDigits + j];
+            if(d) {
+               /* pRun, pSum are used as temporary here */
+               msm_add_signed(pBucket + (IPP_ABS(d)-1)*pointLen, pTable + i*pointLen, d<0, pRun, pSum, pEC);
+            }
+         }
+
+         /* sum = sum(k*bucket[k-1]) by running sums */
+         cpGFpElementPad(pRun, pointLen, 0);
+         cpGFpElementPad(pSum, pointLen, 0);
+         for(k=nEntries-1; k>=0; k--) {
+            gfec_point_add(pRun, pRun, pBucket + k*pointLen, pEC);
+            gfec_point_add(pSum, pSum, pRun, pEC);
+         }
+
+         gfec_point_add(pAcc, pAcc, pSum, pEC);
+      }
+   }
+
+   cpGFpElementCopy(ECP_POINT_DATA(pR), pAcc, pointLen);
+   ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+   cpEcGFpReleasePool(3, pEC);
+   return pR;
+}
@@ -0,0 +1,253 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Internal EC over GF(p^m) basic Definitions & Function Prototypes
+//
+//     Context:
+//        gfec_point_prod_p256k1()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "gfpec/pcpeccp.h"
+#include "gsscramble.h"
+#include "pcpmask_ct.h"
+
+/*
+// secp256k1 admits the endomorphism phi(x,y) = (beta*x, y) = [lambda](x,y).
+// A scalar k is split into k = k1 + k2*lambda mod order with |k1|,|k2| < 2^128
+// (GLV method), so [k]P = [k1]P + [k2]phi(P) is computed with the half
+// number of doublings.
+*/
+static const BNU_CHUNK_T p256k1_beta[] = {
+   LL(0x719501EE, 0xC1396C28), LL(0x12F58995, 0x9CF04975), LL(0xAC3434E9, 0x6E64479E),
+   LL(0x657C0710, 0x7AE96A2B)};
+static const BNU_CHUNK_T p256k1_lambda[] = {
+   LL(0x1B23BD72, 0xDF02967C), LL(0x20816678, 0x122E22EA), LL(0x8812645A, 0xA5261C02),
+   LL(0xC05C30E0, 0x5363AD4C)};
+
+/*
+// Lattice basis of the decomposition {(a1,b1), (a2,b2)}, b2 = a1:
+//    g1 = round(2^384 * b2/order),  g2 = round(2^384 * (-b1)/order)
+//    mb1 = -b1,  mb2 = -b2 mod order
+*/
+static const BNU_CHUNK_T p256k1_g1[] = {
+   LL(0x45DBB031, 0xE893209A), LL(0x71E8CA7F, 0x3DAA8A14), LL(0x9284EB15, 0xE86C90E4),
+   LL(0xA7D46BCD, 0x3086D221)};
+static const BNU_CHUNK_T p256k1_g2[] = {
+   LL(0x8AC47F71, 0x1571B4AE), LL(0x9DF506C6, 0x221208AC), LL(0x0ABFE4C4, 0x6F547FA9),
+   LL(0x010E8828, 0xE4437ED6)};
+static const BNU_CHUNK_T p256k1_mb1[] = {
+   LL(0x0ABFE4C3, 0x6F547FA9), LL(0x010E8828, 0xE4437ED6)};
+static const BNU_CHUNK_T p256k1_mb2[] = {
+   LL(0x3DB1562C, 0xD765CDA8), LL(0x0774346D, 0x8A280AC5), LL(0xFFFFFFFE, 0xFFFFFFFF),
+   LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+#define LEN_P256K1      (BITS_BNU_CHUNK(256))
+#define LEN_P128K1      (BITS_BNU_CHUNK(128))
+
+/* bitsize of the half-scalars (multiple of the window size) and its buffer length */
+#define GLV_BITSIZE     (130)
+#define GLV_LEN         (BITS_BNU_CHUNK(GLV_BITSIZE)+1)
+
+#define GLV_WINDOW      (5)
+
+/* c = round(k*g / 2^384) */
+static void p256k1_glv_round(BNU_CHUNK_T* pC, const BNU_CHUNK_T* pK, const BNU_CHUNK_T* pG)
+{
+   BNU_CHUNK_T product[2*LEN_P256K1];
+   BNU_CHUNK_T roundBit;
+
+   cpMul_BNU_school(product, pK,LEN_P256K1, pG,LEN_P256K1);
+   roundBit = (product[383/BNU_CHUNK_BITS] >> (383%BNU_CHUNK_BITS)) & 1;
+   cpInc_BNU(pC, product + 384/BNU_CHUNK_BITS, LEN_P128K1, roundBit);
+}
+
+/* r = n-r if r > n/2, returns the "negative" mask */
+static BNU_CHUNK_T p256k1_glv_abs(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pOrder)
+{
+   BNU_CHUNK_T nr[LEN_P256K1];
+   cpSub_BNU(nr, pOrder, pR, LEN_P256K1);
+   if(0 < cpCmp_BNU(pR, LEN_P256K1, nr, LEN_P256K1)) {
+      COPY_BNU(pR, nr, LEN_P256K1);
+      return (BNU_CHUNK_T)(-1);
+   }
+   return 0;
+}
+
+/*
+// k = k1 + k2*lambda mod order,
+// |k1| and |k2| are returned in GLV_LEN-chunk buffers, the signs as masks
+//
+// Note: the decomposition is not constant-time,
+// it is used for the public scalars of the signature verification only.
+*/
+static void p256k1_glv_split(BNU_CHUNK_T* pK1, BNU_CHUNK_T* pNeg1,
+                             BNU_CHUNK_T* pK2, BNU_CHUNK_T* pNeg2,
+                             const BNU_CHUNK_T* pScalar, BNU_CHUNK_T* pOrder)
+{
+   BNU_CHUNK_T k[LEN_P256K1];
+   BNU_CHUNK_T c1[LEN_P128K1];
+   BNU_CHUNK_T c2[LEN_P128K1];
+   BNU_CHUNK_T r1[LEN_P256K1];
+   BNU_CHUNK_T r2[LEN_P256K1];
+   BNU_CHUNK_T t[2*LEN_P256K1];
+   BNU_CHUNK_T s[LEN_P256K1];
+   cpSize len;
+
+   /* k < order */
+   COPY_BNU(k, pScalar, LEN_P256K1);
+   if(0 <= cpCmp_BNU(k, LEN_P256K1, pOrder, LEN_P256K1))
+      cpSub_BNU(k, k, pOrder, LEN_P256K1);
+
+   p256k1_glv_round(c1, k, p256k1_g1);
+   p256k1_glv_round(c2, k, p256k1_g2);
+
+   /* r2 = c1*mb1 + c2*mb2 mod order */
+   ZEXPAND_BNU(t, 0, 2*LEN_P256K1);
+   cpMul_BNU_school(t, c2,LEN_P128K1, p256k1_mb2,LEN_P256K1);
+   cpMul_BNU_school(s, c1,LEN_P128K1, p256k1_mb1,LEN_P128K1);
+   t[LEN_P256K1+LEN_P128K1] = cpAdd_BNU(t, t, s, LEN_P256K1);
+   t[LEN_P256K1+LEN_P128K1] = cpInc_BNU(t+LEN_P256K1, t+LEN_P256K1, LEN_P128K1, t[LEN_P256K1+LEN_P128K1]);
+   len = cpMod_BNU(t, LEN_P256K1+LEN_P128K1+1, pOrder, LEN_P256K1);
+   ZEXPAND_COPY_BNU(r2, LEN_P256K1, t, len);
+
+   /* r1 = k - r2*lambda mod order */
+   cpMul_BNU_school(t, r2,LEN_P256K1, p256k1_lambda,LEN_P256K1);
+   len = cpMod_BNU(t, 2*LEN_P256K1, pOrder, LEN_P256K1);
+   ZEXPAND_COPY_BNU(s, LEN_P256K1, t, len);
+   cpModSub_BNU(r1, k, s, pOrder, LEN_P256K1, t);
+
+   *pNeg1 = p256k1_glv_abs(r1, pOrder);
+   *pNeg2 = p256k1_glv_abs(r2, pOrder);
+
+   ZEXPAND_COPY_BNU(pK1, GLV_LEN, r1, LEN_P128K1+1);
+   ZEXPAND_COPY_BNU(pK2, GLV_LEN, r2, LEN_P128K1+1);
+}
+
+/* booth window of the scalar ending at the bit */
+__IPPCP_INLINE int p256k1_glv_window(const BNU_CHUNK_T* pScalar, int bit)
+{
+   const Ipp8u* pScalar8 = (const Ipp8u*)pScalar;
+   int mask = (1<<(GLV_WINDOW+1)) -1;
+   int wvalue;
+   if(bit) {
+      wvalue = *((Ipp16u*)&pScalar8[(bit-1)/8]);
+      wvalue = (wvalue>> ((bit-1)%8)) & mask;
+   }
+   else {
+      wvalue = *((Ipp16u*)&pScalar8[0]);
+      wvalue = (wvalue << 1) & mask;
+   }
+   return wvalue;
+}
+
+/* R += (-1)^neg * [digit](phi)P, pTbl = {P, [2]P, .., [16]P} */
+static void p256k1_glv_add(BNU_CHUNK_T* pR, BNU_CHUNK_T* pH, BNU_CHUNK_T* pHy,
+                           const BNU_CHUNK_T* pTbl, int wvalue, BNU_CHUNK_T negMask,
+                           const BNU_CHUNK_T* pBeta,
+                           IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+
+   Ipp8u digit, sign;
+   booth_recode(&sign, &digit, (Ipp8u)wvalue, GLV_WINDOW);
+   gsScrambleGet_sscm(pH, ECP_POINTLEN(pEC), pTbl, digit-1, GLV_WINDOW-1);
+
+   /* phi(x,y,z) = (beta*x, y, z) */
+   if(pBeta)
+      GFP_METHOD(pGFE)->mul(pH, pH, pBeta, pGFE);
+
+   GFP_METHOD(pGFE)->neg(pHy, pH+elemLen, pGFE);
+   cpMaskedReplace_ct(pH+elemLen, pHy, elemLen, ~cpIsZero_ct(sign) ^ negMask);
+   gfec_point_add(pR, pR, pH, pEC);
+}
+
+/*
+// R = [scalarA]A + [scalarB]B, A is optional (NULL)
+// scalars are LEN_P256K1 chunks long
+*/
+IPP_OWN_DEFN (void, gfec_point_prod_p256k1, (BNU_CHUNK_T* pointR, const BNU_CHUNK_T* pointA, const BNU_CHUNK_T* pScalarA, const BNU_CHUNK_T* pointB, const BNU_CHUNK_T* pScalarB, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+{
+   IppsGFpState* pGF = ECP_GFP(pEC);
+   gsModEngine* pGFE = GFP_PMA(pGF);
+   int elemLen = GFP_FELEN(pGFE);
+   int pointLen = ECP_POINTLEN(pEC);
+   BNU_CHUNK_T* pOrder = MOD_MODULUS(ECP_MONT_R(pEC));
+
+   /* number of table entries */
+   const int tableLen = 1<<(GLV_WINDOW-1);
+
+   /* aligned pre-computed tables */
+   BNU_CHUNK_T* pTableB = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE);
+   BNU_CHUNK_T* pTableA = pTableB+pointLen*tableLen;
+
+   /* half-scalars: {B.k1, B.k2, A.k1, A.k2} */
+   BNU_CHUNK_T k[4][GLV_LEN];
+   BNU_CHUNK_T neg[4];
+   int nScalars = pointA? 4 : 2;
+
+   p256k1_glv_split(k[0], &neg[0], k[1], &neg[1], pScalarB, pOrder);
+   setupTable(pTableB, pointB, pEC);
+   if(pointA) {
+      p256k1_glv_split(k[2], &neg[2], k[3], &neg[3], pScalarA, pOrder);
+      setupTable(pTableA, pointA, pEC);
+   }
+
+   {
+      BNU_CHUNK_T* pBeta = cpGFpGetPool(2, pGFE);
+      BNU_CHUNK_T* pHy = pBeta + elemLen;
+      BNU_CHUNK_T* pTdata = cpEcGFpGetPool(2, pEC); /* points from the pool */
+      BNU_CHUNK_T* pHdata = pTdata + pointLen;
+
+      int bit, n;
+
+      ZEXPAND_COPY_BNU(pBeta, elemLen, p256k1_beta, LEN_P256K1);
+      GFP_METHOD(pGFE)->encode(pBeta, pBeta, pGFE);
+
+      /* R = O */
+      cpGFpElementPad(pTdata, pointLen, 0);
+
+      for(bit=GLV_BITSIZE; bit>=0; bit-=GLV_WINDOW) {
+         if(bit<GLV_BITSIZE) {
+            gfec_point_double(pTdata, pTdata, pEC);
+            gfec_point_double(pTdata, pTdata, pEC);
+            gfec_point_double(pTdata, pTdata, pEC);
+            gfec_point_double(pTdata, pTdata, pEC);
+            gfec_point_double(pTdata, pTdata, pEC);
+         }
+         for(n=0; n<nScalars; n++) {
+            const BNU_CHUNK_T* pTbl = (n<2)? pTableB : pTableA;
+            p256k1_glv_add(pTdata, pHdata, pHy,
+                           pTbl, p256k1_glv_window(k[n], bit), neg[n],
+                           (n&1)? pBeta : NULL,
+                           pEC);
+         }
+      }
+
+      cpGFpElementCopy(pointR, pTdata, pointLen);
+
+      cpEcGFpReleasePool(2, pEC);
+      cpGFpReleasePool(2, pGFE);
+   }
+}
@@ -0,0 +1,50 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     EC over GF(p) hashing to curve (RFC 9380)
+//
+//  Contents:
+//     simplified SWU map constants c2 = sqrt(-Z) for
+//        P-256 (Z = -10), P-384 (Z = -12), P-521 (Z = -4), SM2 (Z = -9)
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpech2c.h"
+
+#if defined( _IPP_DATA )
+
+const BNU_CHUNK_T h2c_p256r1_c2[] = {
+   LL(0xE433C47F, 0x2CCD3427), LL(0x4C55D5B6, 0x7B8D1FF8), LL(0x5180AAB2, 0xC978FC67),
+   LL(0xE1D89B99, 0xDA538E3B)};
+
+const BNU_CHUNK_T h2c_p384r1_c2[] = {
+   LL(0xF5A626B3, 0x14E2EC69), LL(0xA80F7E19, 0x3C0DE1F8), LL(0x9CCB80C5, 0x1F872FCB),
+   LL(0xD68B5387, 0x7F98E383), LL(0x83DA2FDD, 0x71F0500E), LL(0x56B0249C, 0x2ACCB4A6)};
+
+const BNU_CHUNK_T h2c_p521r1_c2[] = {
+   LL(0x00000002, 0x00000000)};
+
+const BNU_CHUNK_T h2c_sm2_c2[] = {
+   LL(0x00000003, 0x00000000)};
+
+#endif /* _IPP_DATA */
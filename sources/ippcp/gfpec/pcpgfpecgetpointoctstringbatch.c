@@ -0,0 +1,115 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECGetPointOctString_Batch()
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsGFpECGetPointOctString_Batch
+//
+// Purpose: Converts a number of points on EC into x||y octstrings
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           ppPoint == NULL / ppStr == NULL / pEC == NULL / pScratchBuffer == NULL
+//                               any ppPoint[i] == NULL / ppStr[i] == NULL
+//    ippStsContextMatchErr      pEC, ppPoint[i] invalid context
+//    ippStsBadArgErr            0>=nPoints
+//    ippStsSizeErr              strLen is not equal to double GFp element
+//    ippStsOutOfRangeErr        the point does not belong to the EC
+//    ippStsPointAtInfinity      some of the points are at infinity
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    ppPoint         array of pointers to the points
+//    ppStr           array of pointers to the strings to write to
+//    strLen          length of each string
+//    nPoints         number of the points
+//    pEC             EC ctx
+//    pScratchBuffer  pointer to the scratch buffer of ippsGFpECGetPointsBatchBufferSize() bytes
+//
+// Note:
+//    The same as nPoints calls of ippsGFpECGetPointOctString(), but the points are
+//    converted using single field inversion. The strings of the points at infinity
+//    are zeroed and ippStsPointAtInfinity is returned after all points are processed.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECGetPointOctString_Batch, (const IppsGFpECPoint* const ppPoint[],
+   Ipp8u* const ppStr[], int strLen, int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer)) {
+   IPP_BAD_PTR4_RET(ppPoint, ppStr, pEC, pScratchBuffer);
+   IPP_BADARG_RET(!VALID_ECP_ID(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET(0 >= nPoints, ippStsBadArgErr);
+
+   {
+      gsModEngine* pGFE = pEC->pGF->pGFE;
+      int elemLen = GFP_FELEN(pGFE);
+      IppsGFpInfo gfi;
+      ippsGFpGetInfo(&gfi, pEC->pGF);
+
+      {
+         int elemLenBits = gfi.basicGFdegree * gfi.basicElmBitSize;
+         int elemLenBytes = BITS2WORD8_SIZE(elemLenBits);
+         int elemLenChunks = BITS_BNU_CHUNK(elemLenBits);
+         int n;
+         IPP_BADARG_RET(strLen != elemLenBytes * 2, ippStsSizeErr);
+
+         for (n = 0; n < nPoints; n++) {
+            IPP_BAD_PTR2_RET(ppPoint[n], ppStr[n]);
+            IPP_BADARG_RET(!ECP_POINT_VALID_ID(ppPoint[n]), ippStsContextMatchErr);
+            IPP_BADARG_RET(ppPoint[n]->elementSize != elemLenChunks, ippStsOutOfRangeErr);
+         }
+
+         {
+            /* scratch buffer: affine (x,y) pairs, prefix products */
+            BNU_CHUNK_T* pXY = (BNU_CHUNK_T*)(IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE));
+            BNU_CHUNK_T* pPrefix = pXY + 2 * nPoints * elemLen;
+            int allFinite = gfec_GetPointsBatch(pXY, ppPoint, nPoints, pEC, pPrefix);
+
+            for (n = 0; n < nPoints; n++) {
+               Ipp8u* pStr = ppStr[n];
+
+               if (IS_ECP_FINITE_POINT(ppPoint[n])) {
+                  IppsGFpElement ptX, ptY;
+                  cpGFpElementConstruct(&ptX, pXY + 2 * n * elemLen, elemLenChunks);
+                  cpGFpElementConstruct(&ptY, pXY + (2 * n + 1) * elemLen, elemLenChunks);
+                  ippsGFpGetElementOctString(&ptX, pStr, elemLenBytes, pEC->pGF);
+                  pStr += elemLenBytes;
+                  ippsGFpGetElementOctString(&ptY, pStr, elemLenBytes, pEC->pGF);
+               }
+               else
+                  PadBlock(0, pStr, strLen);
+            }
+
+            /* clear the coordinates in the buffer */
+            PurgeBlock(pXY, 2 * nPoints * elemLen * (Ipp32s)sizeof(BNU_CHUNK_T));
+
+            return allFinite ? ippStsNoErr : ippStsPointAtInfinity;
+         }
+      }
+   }
+}
@@ -0,0 +1,123 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECGetPoints_Batch()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsGFpECGetPoints_Batch
+//
+// Purpose: Retrieves affine coordinates of a number of points on an elliptic curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppPoint == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   any ppPoint[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppPoint[i]->idCtx
+//                                   ppX != NULL && invalid ppX[i]->idCtx
+//                                   ppY != NULL && invalid ppY[i]->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppPoint[i])!=GFP_FELEN()
+//                                   ppX != NULL && GFPE_ROOM(ppX[i])!=GFP_FELEN()
+//                                   ppY != NULL && GFPE_ROOM(ppY[i])!=GFP_FELEN()
+//
+//    ippStsBadArgErr                0>=nPoints
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppPoint         Array of pointers to the IppsGFpECPoint contexts
+//    ppX, ppY        Arrays of pointers to the X and Y coordinates of the points (either may be NULL)
+//    nPoints         Number of the points
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpECGetPointsBatchBufferSize() bytes
+//
+// Note:
+//    The same as nPoints calls of ippsGFpECGetPoint(), but the points are converted
+//    using single field inversion. (X,Y) == (0,0) is returned for the point at infinity.
+//    Execution time does not depend on the coordinates of the points.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECGetPoints_Batch,(const IppsGFpECPoint* const ppPoint[],
+                                            IppsGFpElement* const ppX[], IppsGFpElement* const ppY[],
+                                            int nPoints,
+                                            IppsGFpECState* pEC,
+                                            Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR3_RET(ppPoint, pEC, pScratchBuffer);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nPoints, ippStsBadArgErr );
+
+   {
+      int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+      int n;
+
+      for(n=0; n<nPoints; n++) {
+         const IppsGFpECPoint* pPoint = ppPoint[n];
+         IPP_BAD_PTR1_RET(pPoint);
+         IPP_BADARG_RET( !ECP_POINT_VALID_ID(pPoint), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pPoint)!=elemLen, ippStsOutOfRangeErr );
+
+         if(ppX) {
+            IPP_BAD_PTR1_RET(ppX[n]);
+            IPP_BADARG_RET( !GFPE_VALID_ID(ppX[n]), ippStsContextMatchErr );
+            IPP_BADARG_RET( GFPE_ROOM(ppX[n])!=elemLen, ippStsOutOfRangeErr );
+         }
+         if(ppY) {
+            IPP_BAD_PTR1_RET(ppY[n]);
+            IPP_BADARG_RET( !GFPE_VALID_ID(ppY[n]), ippStsContextMatchErr );
+            IPP_BADARG_RET( GFPE_ROOM(ppY[n])!=elemLen, ippStsOutOfRangeErr );
+         }
+      }
+
+      {
+         /* scratch buffer: affine (x,y) pairs, prefix products */
+         BNU_CHUNK_T* pXY = (BNU_CHUNK_T*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+         BNU_CHUNK_T* pPrefix = pXY + 2*nPoints*elemLen;
+
+         /* returns (X,Y) == (0,0) if Point is at infinity */
+         gfec_GetPointsBatch(pXY, ppPoint, nPoints, pEC, pPrefix);
+
+         for(n=0; n<nPoints; n++) {
+            if(ppX)
+               cpGFpElementCopy(GFPE_DATA(ppX[n]), pXY + 2*n*elemLen, elemLen);
+            if(ppY)
+               cpGFpElementCopy(GFPE_DATA(ppY[n]), pXY + (2*n+1)*elemLen, elemLen);
+         }
+
+         /* clear the coordinates in the buffer */
+         PurgeBlock(pXY, 2*nPoints*elemLen*(Ipp32s)sizeof(BNU_CHUNK_T));
+         return ippStsNoErr;
+      }
+   }
+}
@@ -0,0 +1,70 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECGetPointsBatchBufferSize()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+
+/*F*
+// Name: ippsGFpECGetPointsBatchBufferSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpECGetPoints_Batch()
+//          and ippsGFpECGetPointOctString_Batch()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pBufferSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//
+//    ippStsBadArgErr                0>=nPoints
+//                                   nPoints is too big
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    nPoints         Number of the points
+//    pEC             Pointer to the context of the elliptic curve
+//    pBufferSize     Pointer to the calculated buffer size in bytes
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECGetPointsBatchBufferSize,(int nPoints, const IppsGFpECState* pEC, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pBufferSize);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nPoints, ippStsBadArgErr );
+
+   {
+      /* affine (x,y) and prefix product element per point */
+      int entrySize = 3*GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))*(Ipp32s)sizeof(BNU_CHUNK_T);
+      IPP_BADARG_RET( nPoints>(IPP_MAX_32S/2)/entrySize, ippStsBadArgErr );
+
+      *pBufferSize = (CACHE_LINE_SIZE-1) + nPoints*entrySize;
+      return ippStsNoErr;
+   }
+}
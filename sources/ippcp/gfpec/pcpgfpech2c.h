@@ -0,0 +1,75 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) hashing to curve (RFC 9380)
+//
+*/
+
+#if !defined(_CP_GFP_EC_H2C_H)
+#define _CP_GFP_EC_H2C_H
+
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "hash/pcphash_rmf.h"
+
+/*
+// simplified SWU map parameters (A = -3 curves, p = 3 mod 4)
+*/
+typedef struct _cpGFpECSSWU {
+   const BNU_CHUNK_T* pModulus;  /* field modulus      */
+   const BNU_CHUNK_T* pB;        /* curve coefficient B */
+   const BNU_CHUNK_T* pC2;       /* c2 = sqrt(-Z)      */
+   int                c2BitSize; /* bitsize of c2      */
+   int                modBitSize;/* bitsize of modulus */
+   int                Z;         /* Z (negative)       */
+   int                L;         /* hash_to_field element length (bytes) */
+   int                k;         /* target security level (bits)  */
+} cpGFpECSSWU;
+
+/* c2 = sqrt(-Z) of the supported curves */
+extern const BNU_CHUNK_T h2c_p256r1_c2[];
+extern const BNU_CHUNK_T h2c_p384r1_c2[];
+extern const BNU_CHUNK_T h2c_p521r1_c2[];
+extern const BNU_CHUNK_T h2c_sm2_c2[];
+
+/* max length of hash_to_field element (P-521: ceil((521+256)/8)) */
+#define H2C_MAX_L          (98)
+/* max length of DST */
+#define H2C_MAX_DST_LEN   (255)
+
+/*
+// hashing to curve: parameters shared by series of messages
+*/
+typedef struct _cpGFpECH2C {
+   const cpGFpECSSWU* pSSWU;     /* map parameters */
+   IppsHashState_rmf  padState;  /* hash state after Z_pad */
+   Ipp8u dstPrime[H2C_MAX_DST_LEN+1]; /* DST || I2OSP(len(DST),1) */
+   int   dstPrimeLen;
+} cpGFpECH2C;
+
+#define gfec_SSWUParams OWNAPI(gfec_SSWUParams)
+   IPP_OWN_DECL (const cpGFpECSSWU*, gfec_SSWUParams, (IppsGFpECState* pEC))
+#define gfec_HashToCurveInit OWNAPI(gfec_HashToCurveInit)
+   IPP_OWN_DECL (void, gfec_HashToCurveInit, (cpGFpECH2C* pH2C, const Ipp8u* pDST, int dstLen, const cpGFpECSSWU* pSSWU, const IppsHashMethod* pMethod))
+#define gfec_HashToCurve OWNAPI(gfec_HashToCurve)
+   IPP_OWN_DECL (void, gfec_HashToCurve, (IppsGFpECPoint* pR, const Ipp8u* pMsg, int msgLen, int count, const cpGFpECH2C* pH2C, IppsGFpECState* pEC))
+
+#endif /* _CP_GFP_EC_H2C_H */
@@ -0,0 +1,108 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECHashToCurve_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcptool.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "gfpec/pcpgfpech2c.h"
+#include "hash/pcphash_rmf.h"
+
+/*F*
+// Name: ippsGFpECHashToCurve_rmf
+//
+// Purpose: Maps the message to a point of an elliptic curve (RFC 9380 hash_to_curve,
+//          random oracle encoding, *_XMD:<hash>_SSWU_RO_ suites)
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pPoint == NULL
+//                                   pEC == NULL
+//                                   pDST == NULL
+//                                   pMethod == NULL
+//                                   (msgLen && !pMsg)
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid pPoint->idCtx
+//
+//    ippStsBadArgErr                !GFP_IS_BASIC(pGFE)
+//                                   hash output is shorter than twice the security level of the curve
+//
+//    ippStsNotSupportedModeErr      curve is not NIST P-256, P-384, P-521 or SM2
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pPoint)!=GFP_FELEN()
+//
+//    ippStsLengthErr                msgLen<0
+//                                   dstLen<1
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pMsg             Pointer to the input message
+//    msgLen           Length of the input message
+//    pDST             Pointer to the domain separation tag
+//    dstLen           Length of the domain separation tag
+//    pPoint           Pointer to the IppsGFpECPoint context
+//    pEC              Pointer to the context of the elliptic curve
+//    pMethod          Pointer to the hash method (expand_message_xmd)
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECHashToCurve_rmf,(const Ipp8u* pMsg, int msgLen,
+                                            const Ipp8u* pDST, int dstLen,
+                                            IppsGFpECPoint* pPoint, IppsGFpECState* pEC,
+                                            const IppsHashMethod* pMethod))
+{
+   const cpGFpECSSWU* pSSWU;
+
+   /* test method pointer */
+   IPP_BAD_PTR1_RET(pMethod);
+
+   /* test message and DST */
+   IPP_BADARG_RET((msgLen<0), ippStsLengthErr);
+   IPP_BADARG_RET((msgLen && !pMsg), ippStsNullPtrErr);
+   IPP_BAD_PTR1_RET(pDST);
+   IPP_BADARG_RET((dstLen<1), ippStsLengthErr);
+
+   IPP_BAD_PTR2_RET(pPoint, pEC);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( !GFP_IS_BASIC(GFP_PMA(ECP_GFP(pEC))), ippStsBadArgErr );
+   IPP_BADARG_RET( !ECP_POINT_VALID_ID(pPoint), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pPoint)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   pSSWU = gfec_SSWUParams(pEC);
+   IPP_BADARG_RET( !pSSWU, ippStsNotSupportedModeErr );
+   /* expand_message_xmd requires b >= 2*k (RFC 9380, 5.3.1) */
+   IPP_BADARG_RET( pMethod->hashLen*BYTESIZE < 2*pSSWU->k, ippStsBadArgErr );
+
+   {
+      cpGFpECH2C h2c;
+      gfec_HashToCurveInit(&h2c, pDST, dstLen, pSSWU, pMethod);
+      gfec_HashToCurve(pPoint, pMsg, msgLen, 2, &h2c, pEC);
+      PurgeBlock(&h2c, sizeof(h2c));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,122 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECHashToCurveBatch_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcptool.h"
+#include "gfpec/pcpgfpecstuff.h"
+#include "gfpec/pcpgfpech2c.h"
+#include "hash/pcphash_rmf.h"
+
+/*F*
+// Name: ippsGFpECHashToCurveBatch_rmf
+//
+// Purpose: Maps series of messages to the points of an elliptic curve
+//          (RFC 9380 hash_to_curve) under the same domain separation tag
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pMsg == NULL
+//                                   msgLen == NULL
+//                                   pPoint == NULL
+//                                   pEC == NULL
+//                                   pDST == NULL
+//                                   pMethod == NULL
+//                                   pPoint[i] == NULL
+//                                   (msgLen[i] && !pMsg[i])
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid pPoint[i]->idCtx
+//
+//    ippStsBadArgErr                !GFP_IS_BASIC(pGFE)
+//                                   hash output is shorter than twice the security level of the curve
+//                                   nPoints<1
+//
+//    ippStsNotSupportedModeErr      curve is not NIST P-256, P-384, P-521 or SM2
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pPoint[i])!=GFP_FELEN()
+//
+//    ippStsLengthErr                msgLen[i]<0
+//                                   dstLen<1
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pMsg             Array of pointers to the input messages
+//    msgLen           Array of lengths of the input messages
+//    pDST             Pointer to the domain separation tag
+//    dstLen           Length of the domain separation tag
+//    pPoint           Array of pointers to the IppsGFpECPoint contexts
+//    nPoints          Number of messages (points)
+//    pEC              Pointer to the context of the elliptic curve
+//    pMethod          Pointer to the hash method (expand_message_xmd)
+//
+// Note:
+//    Curve parameters lookup, DST_prime and hash of Z_pad are computed once
+//    and shared by all messages of the batch.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECHashToCurveBatch_rmf,(const Ipp8u* const pMsg[], const int msgLen[],
+                                                 const Ipp8u* pDST, int dstLen,
+                                                 IppsGFpECPoint* const pPoint[], int nPoints,
+                                                 IppsGFpECState* pEC, const IppsHashMethod* pMethod))
+{
+   const cpGFpECSSWU* pSSWU;
+   int n;
+
+   IPP_BAD_PTR4_RET(pMsg, msgLen, pPoint, pMethod);
+   IPP_BAD_PTR1_RET(pDST);
+   IPP_BADARG_RET((dstLen<1), ippStsLengthErr);
+   IPP_BADARG_RET((nPoints<1), ippStsBadArgErr);
+
+   IPP_BAD_PTR1_RET(pEC);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( !GFP_IS_BASIC(GFP_PMA(ECP_GFP(pEC))), ippStsBadArgErr );
+
+   /* test messages and points */
+   for(n=0; n<nPoints; n++) {
+      IPP_BADARG_RET((msgLen[n]<0), ippStsLengthErr);
+      IPP_BADARG_RET((msgLen[n] && !pMsg[n]), ippStsNullPtrErr);
+      IPP_BAD_PTR1_RET(pPoint[n]);
+      IPP_BADARG_RET( !ECP_POINT_VALID_ID(pPoint[n]), ippStsContextMatchErr );
+      IPP_BADARG_RET( ECP_POINT_FELEN(pPoint[n])!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+   }
+
+   pSSWU = gfec_SSWUParams(pEC);
+   IPP_BADARG_RET( !pSSWU, ippStsNotSupportedModeErr );
+   /* expand_message_xmd requires b >= 2*k (RFC 9380, 5.3.1) */
+   IPP_BADARG_RET( pMethod->hashLen*BYTESIZE < 2*pSSWU->k, ippStsBadArgErr );
+
+   {
+      cpGFpECH2C h2c;
+      gfec_HashToCurveInit(&h2c, pDST, dstLen, pSSWU, pMethod);
+      for(n=0; n<nPoints; n++)
+         gfec_HashToCurve(pPoint[n], pMsg[n], msgLen[n], 2, &h2c, pEC);
+      PurgeBlock(&h2c, sizeof(h2c));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,131 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECMultiScalarMul()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "gfpec/pcpgfpecstuff.h"
+
+/*F*
+// Name: ippsGFpECMultiScalarMul
+//
+// Purpose: Computes the sum of points multiplied by scalars
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppP == NULL
+//                                   ppN == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   any ppP[i] == NULL or ppN[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppP[i]->idCtx
+//                                   invalid ppN[i]->idCtx
+//                                   invalid pR->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppP[i])!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                0>=nPoints
+//                                   ppN[i] is negative
+//                                   ppN[i] > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppP             Array of pointers to the points
+//    ppN             Array of pointers to the Big Number contexts storing the scalars
+//    nPoints         Number of the points (scalars)
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpECMultiScalarMulBufferSize() bytes
+//
+//  Note:
+//    computes R = [N0]*P0 + [N1]*P1 + ... + [Nn-1]*Pn-1
+//    pR may be the same as any ppP[i]
+//
+//    The execution time depends on the scalars,
+//    use it with public scalars only (signature verification, batch verification, etc.)
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECMultiScalarMul,(const IppsGFpECPoint* const ppP[],
+                                           const IppsBigNumState* const ppN[],
+                                           int nPoints,
+                                           IppsGFpECPoint* pR,
+                                           IppsGFpECState* pEC,
+                                           Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(ppP, ppN, pR, pEC);
+   IPP_BAD_PTR1_RET(pScratchBuffer);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nPoints, ippStsBadArgErr );
+
+   IPP_BADARG_RET( !ECP_POINT_VALID_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr );
+
+   {
+      int i;
+      for(i=0; i<nPoints; i++) {
+         const IppsGFpECPoint* pP = ppP[i];
+         const IppsBigNumState* pN = ppN[i];
+
+         IPP_BAD_PTR2_RET(pP, pN);
+         IPP_BADARG_RET( !ECP_POINT_VALID_ID(pP), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr );
+
+         IPP_BADARG_RET( !BN_VALID_ID(pN), ippStsContextMatchErr );
+         IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+         IPP_BADARG_RET( 0<cpCmp_BNU(BN_NUMBER(pN), BN_SIZE(pN), MOD_MODULUS(ECP_MONT_R(pEC)), MOD_LEN(ECP_MONT_R(pEC))), ippStsBadArgErr );
+      }
+   }
+
+#if (_IPP32E >= _IPP32E_K1)
+   if (IsFeatureEnabled(ippCPUID_AVX512IFMA)) {
+      switch (ECP_MODULUS_ID(pEC)) {
+      case cpID_PrimeP256r1: {
+         gfec_MultiScalarMul_nistp256_avx512(pR, ppP, ppN, nPoints, pEC, pScratchBuffer);
+         return ippStsNoErr;
+      }
+      case cpID_PrimeP384r1: {
+         gfec_MultiScalarMul_nistp384_avx512(pR, ppP, ppN, nPoints, pEC, pScratchBuffer);
+         return ippStsNoErr;
+      }
+      case cpID_PrimeP521r1: {
+         gfec_MultiScalarMul_nistp521_avx512(pR, ppP, ppN, nPoints, pEC, pScratchBuffer);
+         return ippStsNoErr;
+      }
+      default:
+         /* Go to default implementation below */
+         break;
+      }
+   } /* no else */
+#endif // (_IPP32E >= _IPP32E_K1)
+
+   gfec_MultiScalarMul(pR, ppP, ppN, nPoints, pEC, pScratchBuffer);
+   return ippStsNoErr;
+}
@@ -0,0 +1,91 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECMultiScalarMulBufferSize()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+
+/*F*
+// Name: ippsGFpECMultiScalarMulBufferSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpECMultiScalarMul()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pBufferSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//
+//    ippStsBadArgErr                0>=nPoints
+//                                   nPoints is too big
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    nPoints         Number of the points (scalars)
+//    pEC             Pointer to the context of the elliptic curve
+//    pBufferSize     Pointer to the calculated buffer size in bytes
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECMultiScalarMulBufferSize,(int nPoints, const IppsGFpECState* pEC, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pBufferSize);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nPoints, ippStsBadArgErr );
+
+   {
+      /* point and prefix product element per entry */
+      int entrySize = (ECP_POINTLEN(pEC) + GFP_FELEN(GFP_PMA(ECP_GFP(pEC))))*(Ipp32s)sizeof(BNU_CHUNK_T);
+      int bufferSize;
+
+      /* x2 - reserve for the radix 2^52 points */
+      IPP_BADARG_RET( nPoints>(IPP_MAX_32S/4)/(entrySize<<(MSM_MAX_STRAUS_W-1)), ippStsBadArgErr );
+
+      bufferSize = gfec_MultiScalarMulBufferSize(nPoints, entrySize, ECP_ORDBITSIZE(pEC));
+
+#if (_IPP32E >= _IPP32E_K1)
+      if (IsFeatureEnabled(ippCPUID_AVX512IFMA)) {
+         switch (ECP_MODULUS_ID(pEC)) {
+         case cpID_PrimeP256r1:
+            bufferSize = IPP_MAX(bufferSize, gfec_MultiScalarMulBufferSize_nistp256_avx512(nPoints, pEC));
+            break;
+         case cpID_PrimeP384r1:
+            bufferSize = IPP_MAX(bufferSize, gfec_MultiScalarMulBufferSize_nistp384_avx512(nPoints, pEC));
+            break;
+         case cpID_PrimeP521r1:
+            bufferSize = IPP_MAX(bufferSize, gfec_MultiScalarMulBufferSize_nistp521_avx512(nPoints, pEC));
+            break;
+         default:
+            break;
+         }
+      }
+#endif // (_IPP32E >= _IPP32E_K1)
+
+      *pBufferSize = bufferSize;
+      return ippStsNoErr;
+   }
+}
@@ -219,7 +219,7 @@ IPPFUN(IppStatus, ippsGFpECSignDSA,(const IppsBigNumState* pMsgDigest,
             if(!GFP_IS_ZERO(dataD, ordLen)) {
                /* (1/ephPrivate) in Montgomery domain */
                ZEXPAND_COPY_BNU(buffT, ordLen, pEphData, ephLen);
-               gs_mont_inv(buffT, buffT, pMontR, alm_mont_inv_ct);
+               gs_mont_inv(buffT, buffT, pMontR, sgcd_mont_inv_ct);
 
                /* (1/ephPrivate)*(pMsgDigest + private*signS) */
                GFP_METHOD(pMontR)->mul(dataD, dataD, buffT, pMontR);
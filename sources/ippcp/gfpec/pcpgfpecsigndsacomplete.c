@@ -0,0 +1,208 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//
+//     Context:
+//        ippsGFpECSignDSA_Complete()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcptool.h"
+#include "gfpec/pcpeccp.h"
+#include "gfpec/pcpgfpmethod.h"
+#include "gfpec/pcpgfpstuff.h"
+
+/*F*
+//    Name: ippsGFpECSignDSA_Complete
+//
+// Purpose: DSA Signature Generation, message dependent (online) part.
+//          Completes the signature using pair (1/ephPrivate mod order, signR)
+//          computed by ippsGFpECSignDSA_Setup().
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pEC
+//                               NULL == pMsgDigest
+//                               NULL == pRegPrivate
+//                               NULL == pInvEphPrivate
+//                               NULL == pSignR
+//                               NULL == pSignS
+//
+//    ippStsContextMatchErr      illegal pEC->idCtx
+//                               pEC->subgroup == NULL
+//                               illegal pMsgDigest->idCtx
+//                               illegal pRegPrivate->idCtx
+//                               illegal pInvEphPrivate->idCtx
+//                               illegal pSignR->idCtx
+//                               illegal pSignS->idCtx
+//
+//    ippStsInvalidPrivateKey    0 >= RegPrivate
+//                               RegPrivate >= order
+//
+//    ippStsEphemeralKeyErr      0 >= InvEphPrivate
+//                               InvEphPrivate >= order
+//                               0 >= signR
+//                               signR >= order
+//                               0==signS
+//
+//    ippStsMessageErr           MsgDigest >= order
+//                               MsgDigest <  0
+//
+//    ippStsRangeErr             not enough room for signS
+//
+//    ippStsNotSupportedModeErr  pGFE->extdegree > 1
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pMsgDigest     pointer to the message representative to be signed
+//    pRegPrivate    pointer to the regular private key
+//    pInvEphPrivate pointer to the inverse of the ephemeral private key
+//    pSignR,pSignS  pointer to the signature
+//    pEC            pointer to the EC context
+//
+// Note:
+//    The inverse of the ephemeral private key is cleared on return.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECSignDSA_Complete,(const IppsBigNumState* pMsgDigest,
+                                             const IppsBigNumState* pRegPrivate,
+                                             IppsBigNumState* pInvEphPrivate,
+                                             const IppsBigNumState* pSignR, IppsBigNumState* pSignS,
+                                             IppsGFpECState* pEC))
+{
+   IppsGFpState*  pGF;
+   gsModEngine* pMontP;
+
+   /* EC context */
+   IPP_BAD_PTR1_RET(pEC);
+   IPP_BADARG_RET(!VALID_ECP_ID(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   pGF = ECP_GFP(pEC);
+   pMontP = GFP_PMA(pGF);
+   IPP_BADARG_RET(1<GFP_EXTDEGREE(pMontP), ippStsNotSupportedModeErr);
+
+   /* test message representative */
+   IPP_BAD_PTR1_RET(pMsgDigest);
+   IPP_BADARG_RET(!BN_VALID_ID(pMsgDigest), ippStsContextMatchErr);
+   IPP_BADARG_RET(BN_NEGATIVE(pMsgDigest), ippStsMessageErr);
+   /* make sure bisize(pMsgDigest) <= bitsiz(order) */
+   IPP_BADARG_RET(ECP_ORDBITSIZE(pEC) < cpBN_bitsize(pMsgDigest), ippStsMessageErr);
+
+   /* test signature */
+   IPP_BAD_PTR2_RET(pSignR, pSignS);
+   IPP_BADARG_RET(!BN_VALID_ID(pSignR), ippStsContextMatchErr);
+   IPP_BADARG_RET(!BN_VALID_ID(pSignS), ippStsContextMatchErr);
+   IPP_BADARG_RET(BN_NEGATIVE(pSignR), ippStsEphemeralKeyErr);
+   IPP_BADARG_RET((BN_ROOM(pSignS)*BITSIZE(BNU_CHUNK_T)<ECP_ORDBITSIZE(pEC)), ippStsRangeErr);
+
+   /* test private keys */
+   IPP_BAD_PTR2_RET(pRegPrivate, pInvEphPrivate);
+
+   IPP_BADARG_RET(!BN_VALID_ID(pRegPrivate), ippStsContextMatchErr);
+   IPP_BADARG_RET(BN_NEGATIVE(pRegPrivate), ippStsInvalidPrivateKey);
+
+   IPP_BADARG_RET(!BN_VALID_ID(pInvEphPrivate), ippStsContextMatchErr);
+   IPP_BADARG_RET(BN_NEGATIVE(pInvEphPrivate), ippStsEphemeralKeyErr);
+
+   {
+      gsModEngine* pMontR = ECP_MONT_R(pEC);
+      BNU_CHUNK_T* pOrder = MOD_MODULUS(pMontR);
+      int ordLen = MOD_LEN(pMontR);
+
+      BNU_CHUNK_T* dataD = BN_NUMBER(pSignS);
+      BNU_CHUNK_T* buffF = BN_BUFFER(pSignS);
+
+      BNU_CHUNK_T* pPriData = BN_NUMBER(pRegPrivate);
+      int priLen = BN_SIZE(pRegPrivate);
+
+      BNU_CHUNK_T* pInvData = BN_NUMBER(pInvEphPrivate);
+      int invLen = BN_SIZE(pInvEphPrivate);
+
+      BNU_CHUNK_T* pSignRData = BN_NUMBER(pSignR);
+      int signRLen = BN_SIZE(pSignR);
+
+      BNU_CHUNK_T* pMsgData = BN_NUMBER(pMsgDigest);
+      int msgLen = BN_SIZE(pMsgDigest);
+
+      IppStatus sts = ippStsEphemeralKeyErr;
+
+      /* test value of private keys: 0 < regPrivate < order, 0 < invEphPrivate < order */
+      IPP_BADARG_RET(cpEqu_BNU_CHUNK(pPriData, priLen, 0) ||
+                  0<=cpCmp_BNU(pPriData, priLen, pOrder, ordLen), ippStsInvalidPrivateKey);
+      IPP_BADARG_RET(cpEqu_BNU_CHUNK(pInvData, invLen, 0) ||
+                  0<=cpCmp_BNU(pInvData, invLen, pOrder, ordLen), ippStsEphemeralKeyErr);
+      /* test value of signR: 0 < signR < order */
+      IPP_BADARG_RET(cpEqu_BNU_CHUNK(pSignRData, signRLen, 0) ||
+                  0<=cpCmp_BNU(pSignRData, signRLen, pOrder, ordLen), ippStsEphemeralKeyErr);
+
+      {
+         BNU_CHUNK_T* buffR = gsModPoolAlloc(pMontR, 2);
+         BNU_CHUNK_T* buffT = buffR + MOD_LEN(pMontR);
+         int ns;
+         IPP_BAD_PTR1_RET(buffR); // buffer can be NULL, stop processing
+
+         /*
+         // signS = (1/ephPrivate)*(pMsgDigest + private*signR) (mod order)
+         */
+
+         /* copy and expand message is being signed and reduce just in case */
+         ZEXPAND_COPY_BNU(buffF, ordLen, pMsgData, msgLen);
+         cpModSub_BNU(buffF, buffF, pOrder, pOrder, ordLen, buffT);
+
+         /* private representation in Montgomery domain */
+         ZEXPAND_COPY_BNU(dataD, ordLen, pPriData, priLen);
+         GFP_METHOD(pMontR)->encode(dataD, dataD, pMontR);
+
+         /* (private*signR) in regular domain */
+         ZEXPAND_COPY_BNU(buffR, ordLen, pSignRData, signRLen);
+         GFP_METHOD(pMontR)->mul(dataD, dataD, buffR, pMontR);
+
+         /* pMsgDigest + private*signR */
+         cpModAdd_BNU(dataD, dataD, buffF, pOrder, ordLen, buffT);
+
+         if(!GFP_IS_ZERO(dataD, ordLen)) {
+            /* (1/ephPrivate) in Montgomery domain */
+            ZEXPAND_COPY_BNU(buffT, ordLen, pInvData, invLen);
+            GFP_METHOD(pMontR)->encode(buffT, buffT, pMontR);
+
+            /* (1/ephPrivate)*(pMsgDigest + private*signR) */
+            GFP_METHOD(pMontR)->mul(dataD, dataD, buffT, pMontR);
+
+            /* signS */
+            ns = ordLen;
+            FIX_BNU(dataD, ns);
+            BN_SIGN(pSignS) = ippBigNumPOS;
+            BN_SIZE(pSignS) = ns;
+
+            sts = ippStsNoErr;
+         }
+
+         PurgeBlock(buffT, ordLen*(int)sizeof(BNU_CHUNK_T));
+         gsModPoolFree(pMontR, 2);
+      }
+
+      /* clear inverse of ephemeral private key */
+      cpBN_zero(pInvEphPrivate);
+
+      return sts;
+   }
+}
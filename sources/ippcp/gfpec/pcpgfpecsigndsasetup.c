@@ -0,0 +1,176 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//
+//     Context:
+//        ippsGFpECSignDSA_Setup()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "gfpec/pcpeccp.h"
+#include "gfpec/pcpgfpmethod.h"
+#include "gfpec/pcpgfpstuff.h"
+
+/*F*
+//    Name: ippsGFpECSignDSA_Setup
+//
+// Purpose: DSA Signature Generation, message independent (offline) part.
+//          Computes pair (1/ephPrivate mod order, signR) that can be
+//          later consumed by ippsGFpECSignDSA_Complete().
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pEC
+//                               NULL == pEphPrivate
+//                               NULL == pInvEphPrivate
+//                               NULL == pSignR
+//                               NULL == pScratchBuffer
+//
+//    ippStsContextMatchErr      illegal pEC->idCtx
+//                               pEC->subgroup == NULL
+//                               illegal pEphPrivate->idCtx
+//                               illegal pInvEphPrivate->idCtx
+//                               illegal pSignR->idCtx
+//
+//    ippStsEphemeralKeyErr      0 >= EphPrivate
+//                               EphPrivate >= order
+//                               0==signR
+//
+//    ippStsRangeErr             not enough room for:
+//                               invEphPrivate
+//                               signR
+//
+//    ippStsNotSupportedModeErr  pGFE->extdegree > 1
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pEphPrivate    pointer to the ephemeral private key
+//    pInvEphPrivate pointer to the inverse of the ephemeral private key
+//    pSignR         pointer to the R component of the signature
+//    pEC            pointer to the EC context
+//    pScratchBuffer pointer to buffer (1 mul_point operation)
+//
+// Note:
+//    The ephemeral private key is cleared on return.
+//    Pair (pInvEphPrivate, pSignR) is secret and must be used to sign
+//    one message only.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECSignDSA_Setup,(IppsBigNumState* pEphPrivate,
+                                          IppsBigNumState* pInvEphPrivate,
+                                          IppsBigNumState* pSignR,
+                                          IppsGFpECState* pEC,
+                                          Ipp8u* pScratchBuffer))
+{
+   IppsGFpState*  pGF;
+   gsModEngine* pMontP;
+
+   /* EC context and buffer */
+   IPP_BAD_PTR2_RET(pEC, pScratchBuffer);
+   IPP_BADARG_RET(!VALID_ECP_ID(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   pGF = ECP_GFP(pEC);
+   pMontP = GFP_PMA(pGF);
+   IPP_BADARG_RET(1<GFP_EXTDEGREE(pMontP), ippStsNotSupportedModeErr);
+
+   /* test output */
+   IPP_BAD_PTR2_RET(pInvEphPrivate, pSignR);
+   IPP_BADARG_RET(!BN_VALID_ID(pInvEphPrivate), ippStsContextMatchErr);
+   IPP_BADARG_RET(!BN_VALID_ID(pSignR), ippStsContextMatchErr);
+   IPP_BADARG_RET((BN_ROOM(pInvEphPrivate)*BITSIZE(BNU_CHUNK_T)<ECP_ORDBITSIZE(pEC)), ippStsRangeErr);
+   IPP_BADARG_RET((BN_ROOM(pSignR)*BITSIZE(BNU_CHUNK_T)<ECP_ORDBITSIZE(pEC)), ippStsRangeErr);
+
+   /* test ephemeral key */
+   IPP_BAD_PTR1_RET(pEphPrivate);
+   IPP_BADARG_RET(!BN_VALID_ID(pEphPrivate), ippStsContextMatchErr);
+   IPP_BADARG_RET(BN_NEGATIVE(pEphPrivate), ippStsEphemeralKeyErr);
+
+   {
+      gsModEngine* pMontR = ECP_MONT_R(pEC);
+      BNU_CHUNK_T* pOrder = MOD_MODULUS(pMontR);
+      int ordLen = MOD_LEN(pMontR);
+
+      BNU_CHUNK_T* dataC = BN_NUMBER(pSignR);
+      BNU_CHUNK_T* dataK = BN_NUMBER(pInvEphPrivate);
+
+      BNU_CHUNK_T* pEphData = BN_NUMBER(pEphPrivate);
+      int ephLen = BN_SIZE(pEphPrivate);
+
+      IppStatus sts = ippStsEphemeralKeyErr;
+
+      /* test value of ephemeral key: 0 < ephPrivate < order */
+      IPP_BADARG_RET(cpEqu_BNU_CHUNK(pEphData, ephLen, 0) ||
+                  0<=cpCmp_BNU(pEphData, ephLen, pOrder, ordLen), ippStsEphemeralKeyErr);
+
+      {
+         int elmLen = GFP_FELEN(pMontP);
+         int ns;
+
+         /* compute ephemeral public key */
+         IppsGFpECPoint ephPublic;
+         cpEcGFpInitPoint(&ephPublic, cpEcGFpGetPool(1, pEC), 0, pEC);
+         gfec_MulBasePoint(&ephPublic,
+                           BN_NUMBER(pEphPrivate), BN_SIZE(pEphPrivate),
+                           pEC, pScratchBuffer);
+
+         /*
+         // signR = int(ephPublic.x) (mod order)
+         */
+         {
+            BNU_CHUNK_T* buffer = gsModPoolAlloc(pMontP, 1);
+            IPP_BAD_PTR1_RET(buffer); // buffer can be NULL, stop processing
+            gfec_GetPoint(buffer, NULL, &ephPublic, pEC);
+            GFP_METHOD(pMontP)->decode(buffer, buffer, pMontP);
+            ns = cpMod_BNU(buffer, elmLen, pOrder, ordLen);
+            cpGFpElementCopyPad(dataC, ordLen, buffer, ns);
+            gsModPoolFree(pMontP, 1);
+         }
+         cpEcGFpReleasePool(1, pEC);
+
+         if(!GFP_IS_ZERO(dataC, ordLen)) {
+            /* (1/ephPrivate) in Montgomery domain */
+            ZEXPAND_COPY_BNU(dataK, ordLen, pEphData, ephLen);
+            gs_mont_inv(dataK, dataK, pMontR, sgcd_mont_inv_ct);
+            /* (1/ephPrivate) in regular domain */
+            GFP_METHOD(pMontR)->decode(dataK, dataK, pMontR);
+
+            /* invEphPrivate */
+            ns = ordLen;
+            FIX_BNU(dataK, ns);
+            BN_SIGN(pInvEphPrivate) = ippBigNumPOS;
+            BN_SIZE(pInvEphPrivate) = ns;
+            /* signR */
+            ns = ordLen;
+            FIX_BNU(dataC, ns);
+            BN_SIGN(pSignR) = ippBigNumPOS;
+            BN_SIZE(pSignR) = ns;
+
+            sts = ippStsNoErr;
+         }
+      }
+
+      /* clear ephemeral private key */
+      cpBN_zero(pEphPrivate);
+
+      return sts;
+   }
+}
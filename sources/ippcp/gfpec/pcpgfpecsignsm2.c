@@ -195,7 +195,7 @@ IPPFUN(IppStatus, ippsGFpECSignSM2,(const IppsBigNumState* pMsgDigest,
             ZEXPAND_COPY_BNU(buffR, ordLen, pEphData, ephLen);
             cpModSub_BNU(buffR, buffR, buffS, pOrder, ordLen, buffS); /* ephPrivate-r*mont(regPrivate) */
 
-            gs_mont_inv(dataS, dataS, pMontR, alm_mont_inv_ct);      /* 1/(1+regPrivate) */
+            gs_mont_inv(dataS, dataS, pMontR, sgcd_mont_inv_ct);      /* 1/(1+regPrivate) */
             GFP_METHOD(pMontR)->mul(dataS, dataS, buffR, pMontR);
 
             if( !GFP_IS_ZERO(dataS, ordLen)) {
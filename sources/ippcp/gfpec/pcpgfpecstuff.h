@@ -173,6 +173,7 @@ typedef struct _cpGFpEC {
 #define gfpec_precom_nistP521r1_radix52_fun OWNAPI(gfpec_precom_nistP521r1_radix52_fun)
 #define gfpec_precom_sm2_fun         OWNAPI(gfpec_precom_sm2_fun)
 #define gfpec_precom_sm2_radix52_fun        OWNAPI(gfpec_precom_sm2_radix52_fun)
+#define gfpec_precom_secp256k1_fun   OWNAPI(gfpec_precom_secp256k1_fun)
 
 IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_nistP192r1_fun, (void))
 IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_nistP224r1_fun, (void))
@@ -184,6 +185,7 @@ IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_nistP521r1_fun, (void))
 IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_nistP521r1_radix52_fun, (void))
 IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_sm2_fun,        (void))
 IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_sm2_radix52_fun,        (void))
+IPP_OWN_DECL (const cpPrecompAP*, gfpec_precom_secp256k1_fun,  (void))
 
 /*
 // get/release n points from/to the pool
@@ -240,8 +242,6 @@ __IPPCP_INLINE int gfec_IsPointAtInfinity(const IppsGFpECPoint* pPoint)
    return GFP_IS_ZERO( ECP_POINT_Z(pPoint), ECP_POINT_FELEN(pPoint));
 }
 
-
-
 /* signed encode */
 __IPPCP_INLINE void booth_recode(Ipp8u* sign, Ipp8u* digit, Ipp8u in, int w)
 {
@@ -259,6 +259,7 @@ __IPPCP_INLINE void booth_recode(Ipp8u* sign, Ipp8u* digit, Ipp8u in, int w)
 #define gfec_point_double OWNAPI(gfec_point_double)
 #define gfec_point_mul OWNAPI(gfec_point_mul)
 #define gfec_point_prod OWNAPI(gfec_point_prod)
+#define gfec_point_prod_p256k1 OWNAPI(gfec_point_prod_p256k1)
 #define gfec_base_point_mul OWNAPI(gfec_base_point_mul)
 #define setupTable OWNAPI(setupTable)
 
@@ -267,9 +268,25 @@ IPP_OWN_DECL (void, gfec_affine_point_add, (BNU_CHUNK_T* pRdata, const BNU_CHUNK
 IPP_OWN_DECL (void, gfec_point_double, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, IppsGFpECState* pEC))
 IPP_OWN_DECL (void, gfec_point_mul, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const Ipp8u* pScalar8, int scalarBitSize, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPP_OWN_DECL (void, gfec_point_prod, (BNU_CHUNK_T* pointR, const BNU_CHUNK_T* pointA, const Ipp8u* pScalarA, const BNU_CHUNK_T* pointB, const Ipp8u* pScalarB, int scalarBitSize, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPP_OWN_DECL (void, gfec_point_prod_p256k1, (BNU_CHUNK_T* pointR, const BNU_CHUNK_T* pointA, const BNU_CHUNK_T* pScalarA, const BNU_CHUNK_T* pointB, const BNU_CHUNK_T* pScalarB, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPP_OWN_DECL (void, gfec_base_point_mul, (BNU_CHUNK_T* pRdata, const Ipp8u* pScalarB, int scalarBitSize, IppsGFpECState* pEC))
 IPP_OWN_DECL (void, setupTable, (BNU_CHUNK_T* pTbl, const BNU_CHUNK_T* pPdata, IppsGFpECState* pEC))
 
+/* multi-scalar multiplication (variable time), window size ranges */
+#define MSM_MIN_W          (2)
+#define MSM_MAX_STRAUS_W   (6)
+#define MSM_MAX_BUCKET_W  (14)
+
+#define gfec_MultiScalarMulWinSize OWNAPI(gfec_MultiScalarMulWinSize)
+#define gfec_MultiScalarMulBufferSize OWNAPI(gfec_MultiScalarMulBufferSize)
+#define gfec_MultiScalarMulRecode OWNAPI(gfec_MultiScalarMulRecode)
+#define gfec_MultiScalarMul OWNAPI(gfec_MultiScalarMul)
+
+IPP_OWN_DECL (int, gfec_MultiScalarMulWinSize, (int nPoints, int scalarBitSize, int* pStraus))
+IPP_OWN_DECL (int, gfec_MultiScalarMulBufferSize, (int nPoints, int entrySize, int scalarBitSize))
+IPP_OWN_DECL (void, gfec_MultiScalarMulRecode, (Ipp16s* pDigits, int nDigits, const BNU_CHUNK_T* pScalar, int scalarLen, int w))
+IPP_OWN_DECL (IppsGFpECPoint*, gfec_MultiScalarMul, (IppsGFpECPoint* pR, const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+
 
 /* size of context */
 #define cpGFpECGetSize OWNAPI(cpGFpECGetSize)
@@ -277,12 +294,14 @@ IPP_OWN_DECL (int, cpGFpECGetSize, (int deg, int basicElmBitSize))
 
 /* point operations */
 #define gfec_GetPoint OWNAPI(gfec_GetPoint)
+#define gfec_GetPointsBatch OWNAPI(gfec_GetPointsBatch)
 #define gfec_SetPoint OWNAPI(gfec_SetPoint)
 #define gfec_MakePoint OWNAPI(gfec_MakePoint)
 #define gfec_ComparePoint OWNAPI(gfec_ComparePoint)
 #define gfec_IsPointOnCurve OWNAPI(gfec_IsPointOnCurve)
 
 IPP_OWN_DECL (int, gfec_GetPoint, (BNU_CHUNK_T* pX, BNU_CHUNK_T* pY, const IppsGFpECPoint* pPoint, IppsGFpECState* pEC))
+IPP_OWN_DECL (int, gfec_GetPointsBatch, (BNU_CHUNK_T* pXY, const IppsGFpECPoint* const ppPoint[], int nPoints, IppsGFpECState* pEC, BNU_CHUNK_T* pPrefix))
 IPP_OWN_DECL (int, gfec_SetPoint, (BNU_CHUNK_T* pP, const BNU_CHUNK_T* pX, const BNU_CHUNK_T* pY, IppsGFpECState* pEC))
 IPP_OWN_DECL (int, gfec_MakePoint, (IppsGFpECPoint* pPoint, const BNU_CHUNK_T* pElm, IppsGFpECState* pEC))
 IPP_OWN_DECL (int, gfec_ComparePoint, (const IppsGFpECPoint* pP, const IppsGFpECPoint* pQ, IppsGFpECState* pEC))
@@ -365,6 +384,14 @@ IPP_OWN_DECL (void, p521r1_select_ap_w5, (BNU_CHUNK_T* pAffinePoint, const BNU_C
 #define gfec_point_on_curve_nistp521_avx512 OWNAPI(gfec_point_on_curve_nistp521_avx512)
 #define gfec_point_on_curve_sm2_avx512      OWNAPI(gfec_point_on_curve_sm2_avx512)
 
+#define gfec_MultiScalarMul_nistp256_avx512 OWNAPI(gfec_MultiScalarMul_nistp256_avx512)
+#define gfec_MultiScalarMul_nistp384_avx512 OWNAPI(gfec_MultiScalarMul_nistp384_avx512)
+#define gfec_MultiScalarMul_nistp521_avx512 OWNAPI(gfec_MultiScalarMul_nistp521_avx512)
+
+#define gfec_MultiScalarMulBufferSize_nistp256_avx512 OWNAPI(gfec_MultiScalarMulBufferSize_nistp256_avx512)
+#define gfec_MultiScalarMulBufferSize_nistp384_avx512 OWNAPI(gfec_MultiScalarMulBufferSize_nistp384_avx512)
+#define gfec_MultiScalarMulBufferSize_nistp521_avx512 OWNAPI(gfec_MultiScalarMulBufferSize_nistp521_avx512)
+
 IPP_OWN_DECL (IppStatus, gfec_SignDSA_nistp256_avx512, (const IppsBigNumState* pMsgDigest, const IppsBigNumState* pRegPrivate, IppsBigNumState* pEphPrivate, IppsBigNumState* pSignR, IppsBigNumState* pSignS, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPP_OWN_DECL (IppStatus, gfec_SignDSA_nistp384_avx512, (const IppsBigNumState* pMsgDigest, const IppsBigNumState* pRegPrivate, IppsBigNumState* pEphPrivate, IppsBigNumState* pSignR, IppsBigNumState* pSignS, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPP_OWN_DECL (IppStatus, gfec_SignDSA_nistp521_avx512, (const IppsBigNumState* pMsgDigest, const IppsBigNumState* pRegPrivate, IppsBigNumState* pEphPrivate, IppsBigNumState* pSignR, IppsBigNumState* pSignS, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
@@ -400,6 +427,14 @@ IPP_OWN_DECL (int, gfec_point_on_curve_nistp384_avx512, (const IppsGFpECPoint *p
 IPP_OWN_DECL (int, gfec_point_on_curve_nistp521_avx512, (const IppsGFpECPoint *pPoint, IppsGFpECState *pEC))
 IPP_OWN_DECL (int, gfec_point_on_curve_sm2_avx512,      (const IppsGFpECPoint *pPoint, IppsGFpECState *pEC))
 
+IPP_OWN_DECL (IppsGFpECPoint*, gfec_MultiScalarMul_nistp256_avx512, (IppsGFpECPoint* pR, const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPP_OWN_DECL (IppsGFpECPoint*, gfec_MultiScalarMul_nistp384_avx512, (IppsGFpECPoint* pR, const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPP_OWN_DECL (IppsGFpECPoint*, gfec_MultiScalarMul_nistp521_avx512, (IppsGFpECPoint* pR, const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int nPoints, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+
+IPP_OWN_DECL (int, gfec_MultiScalarMulBufferSize_nistp256_avx512, (int nPoints, const IppsGFpECState* pEC))
+IPP_OWN_DECL (int, gfec_MultiScalarMulBufferSize_nistp384_avx512, (int nPoints, const IppsGFpECState* pEC))
+IPP_OWN_DECL (int, gfec_MultiScalarMulBufferSize_nistp521_avx512, (int nPoints, const IppsGFpECState* pEC))
+
 #define gfec_CheckPrivateKey OWNAPI(gfec_CheckPrivateKey)
 IPP_OWN_DECL(int, gfec_CheckPrivateKey, (const IppsBigNumState* pPrivate, IppsGFpECState* pEC))
 
@@ -164,7 +164,7 @@ IPPFUN(IppStatus, ippsGFpECVerifyDSA,(const IppsBigNumState* pMsgDigest,
 
              /* h = d^-1, h1 = msg*h, h2 = c*h */
              ZEXPAND_COPY_BNU(h, orderLen, BN_NUMBER(pSignS), BN_SIZE(pSignS));
-             gs_mont_inv(h, h, pMontR, alm_mont_inv);
+             gs_mont_inv(h, h, pMontR, sgcd_mont_inv);
 
              cpMontMul_BNU(h1, h, h1, pMontR);
              ZEXPAND_COPY_BNU(h2, orderLen, BN_NUMBER(pSignR), BN_SIZE(pSignR));
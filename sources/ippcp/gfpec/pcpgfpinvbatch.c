@@ -0,0 +1,110 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Operations over GF(p).
+//
+//     Context:
+//        ippsGFpInv_Batch()
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "gfpec/pcpgfpstuff.h"
+#include "gfpec/pcpgfpxstuff.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsGFpInv_Batch
+//
+// Purpose: Multiplicative inverses of a number of GF elements
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pGFp
+//                               NULL == ppA
+//                               NULL == ppR
+//                               NULL == pScratchBuffer
+//                               NULL == ppA[i] or NULL == ppR[i]
+//
+//    ippStsContextMatchErr      invalid pGFp->idCtx
+//                               invalid ppA[i]->idCtx
+//                               invalid ppR[i]->idCtx
+//
+//    ippStsOutOfRangeErr        GFPE_ROOM() != GFP_FELEN()
+//
+//    ippStsBadArgErr            1>nItems
+//
+//    ippStsDivByZeroErr         any ppA[i] is zero
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    ppA             Pointer to the array of contexts of the source finite field elements.
+//    ppR             Pointer to the array of contexts of the result finite field elements.
+//    nItems          Number of elements.
+//    pGFp            Pointer to the context of the finite field.
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpInvBatchBufferSize() size.
+//
+// Note:
+//    Computes ppR[i] = 1/ppA[i] using single inversion and 3*(nItems-1)
+//    multiplications (Montgomery's trick).
+//    ppR[i] may be the same as ppA[i], other overlapping is not allowed.
+//    The ppR[] are not modified if ippStsDivByZeroErr is returned.
+//    Execution time does not depend on the values of the elements.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpInv_Batch,(const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems,
+                                    IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(ppA, ppR, pGFp, pScratchBuffer);
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( 1>nItems, ippStsBadArgErr );
+   {
+      gsModEngine* pGFE = GFP_PMA(pGFp);
+      int elemLen = GFP_FELEN(pGFE);
+      int n;
+
+      /* test all ppA[] and ppR[] pairs */
+      for(n=0; n<nItems; n++) {
+         const IppsGFpElement* pA = ppA[n];
+         const IppsGFpElement* pR = ppR[n];
+         IPP_BAD_PTR2_RET(pA, pR);
+
+         IPP_BADARG_RET( !GFPE_VALID_ID(pA), ippStsContextMatchErr );
+         IPP_BADARG_RET( !GFPE_VALID_ID(pR), ippStsContextMatchErr );
+
+         IPP_BADARG_RET( (GFPE_ROOM(pA)!=elemLen) || (GFPE_ROOM(pR)!=elemLen), ippStsOutOfRangeErr);
+      }
+
+      {
+         /* pointers to items are kept at the beginning of the buffer */
+         Ipp8u* pItems = (Ipp8u*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+         const BNU_CHUNK_T** ppAdata = (const BNU_CHUNK_T**)pItems;
+         BNU_CHUNK_T** ppRdata = (BNU_CHUNK_T**)(ppAdata + nItems);
+         BNU_CHUNK_T* pPrefix = (BNU_CHUNK_T*)(ppRdata + nItems);
+         for(n=0; n<nItems; n++) {
+            ppAdata[n] = GFPE_DATA(ppA[n]);
+            ppRdata[n] = GFPE_DATA(ppR[n]);
+         }
+
+         return cpGFpxBatchInv(ppRdata, ppAdata, nItems, pGFE, pPrefix)? ippStsNoErr : ippStsDivByZeroErr;
+      }
+   }
+}
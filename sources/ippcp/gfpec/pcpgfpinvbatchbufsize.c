@@ -0,0 +1,67 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Operations over GF(p).
+//
+//     Context:
+//        ippsGFpInvBatchBufferSize()
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "gfpec/pcpgfpstuff.h"
+#include "gfpec/pcpgfpxstuff.h"
+#include "pcptool.h"
+
+
+/*F*
+// Name: ippsGFpInvBatchBufferSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpInv_Batch()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr          pGFp == NULL
+//                              pBufferSize == NULL
+//    ippStsContextMatchErr     incorrect pGFp's context id
+//    ippStsBadArgErr           0>=nItems
+//                              nItems is too big
+//    ippStsNoErr               no error
+//
+// Parameters:
+//    nItems          Number of elements.
+//    pGFp            Pointer to the context of the finite field.
+//    pBufferSize     Pointer to the calculated buffer size in bytes.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpInvBatchBufferSize,(int nItems, const IppsGFpState* pGFp, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pGFp, pBufferSize);
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr);
+   {
+      /* pointers to A and R and prefix product element per item */
+      int itemSize = 2*(Ipp32s)sizeof(BNU_CHUNK_T*) + GFP_FELEN(GFP_PMA(pGFp))*(Ipp32s)sizeof(BNU_CHUNK_T);
+      IPP_BADARG_RET( nItems>(IPP_MAX_32S/2)/itemSize, ippStsBadArgErr);
+
+      *pBufferSize = (CACHE_LINE_SIZE-1) + nItems*itemSize;
+      return ippStsNoErr;
+   }
+}
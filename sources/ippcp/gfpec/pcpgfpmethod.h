@@ -38,6 +38,7 @@ typedef enum {
    cpID_PrimeP521r1  = cpID_Prime+10,
    cpID_PrimeTPM_SM2 = cpID_Prime+11,
    cpID_PrimeTPM_BN  = cpID_Prime+12,
+   cpID_PrimeP256k1  = cpID_Prime+13,
 
    cpID_Poly  = 0x10000000, /* id=0x10000000: general polynomial */
    cpID_Binom = 0x01000000, /* id=0x11000000: x^d+a */
@@ -0,0 +1,159 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     GF(p) methods
+//
+*/
+#include "gfpec/pcpgfpmethod_256.h"
+#include "pcpbnuarith.h"
+#include "pcpmask_ct.h"
+
+#if(_IPP32E >= _IPP32E_M7)
+
+/*
+// secp256k1 modulus p = 2^256 - c, c = 2^32 + 977.
+//
+// The Montgomery reduction takes advantage of the modulus form:
+// since p = 2^256 - c, u*p = u*2^256 - u*c and the u*c product
+// (u*c < 2^97) is computed with two 32x32-bit multiplications
+// instead of a full 64x256-bit one.
+*/
+#define P256K1_C_LO  (977)
+#define LEN_P256K1   (BITS_BNU_CHUNK(256))
+
+/* hi = (u*c) div 2^64 */
+#define P256K1_MUL_C(hi, u) { \
+   BNU_CHUNK_T __uL = (u) & 0xFFFFFFFF; \
+   BNU_CHUNK_T __uH = (u) >> 32; \
+   /* u*c = uH*2^64 + (uL + uH*977)*2^32 + uL*977 */ \
+   BNU_CHUNK_T __s  = __uL + __uH*P256K1_C_LO; \
+   BNU_CHUNK_T __x0 = __uL*P256K1_C_LO; \
+   BNU_CHUNK_T __lo = (__s<<32) + __x0; \
+   (hi) = __uH + (__s>>32) + (__lo < __x0); \
+}
+
+/* r = t/2^256 mod p, t < p*2^256 */
+static BNU_CHUNK_T* p256k1_mred(BNU_CHUNK_T* pR, BNU_CHUNK_T* t, BNU_CHUNK_T k0)
+{
+   /* pending carry of u*2^256 additions and borrow of u*c subtractions */
+   BNU_CHUNK_T carry = 0;
+   BNU_CHUNK_T borrow = 0;
+   BNU_CHUNK_T ext;
+   int i;
+
+   /*
+   // t += u*p = u*2^256 - u*c;
+   // the low word of u*c is equal to t[i], so t[i] becomes zero
+   // and only the high word of u*c is subtracted from t[i+1]
+   */
+   for(i=0; i<LEN_P256K1; i++) {
+      BNU_CHUNK_T u = t[i]*k0;
+      BNU_CHUNK_T hi;
+      P256K1_MUL_C(hi, u);
+      hi += borrow;
+      SUB_AB(borrow, t[i+1], t[i+1], hi);
+      ADD_ABC(carry, t[i+LEN_P256K1], t[i+LEN_P256K1], u, carry);
+   }
+   /* t[5..7] -= borrow, ext = carry - borrow */
+   for(i=LEN_P256K1+1; i<2*LEN_P256K1; i++) {
+      BNU_CHUNK_T b = borrow;
+      SUB_AB(borrow, t[i], t[i], b);
+   }
+   ext = carry - borrow;
+
+   /* (ext,t[4..7]) < 2p, final subtraction */
+   ext -= cpSub_BNU(pR, t+LEN_P256K1, secp256k1_p, LEN_P256K1);
+   cpMaskedReplace_ct(pR, t+LEN_P256K1, LEN_P256K1, ~cpIsZero_ct(ext));
+   return pR;
+}
+
+static BNU_CHUNK_T* p256k1_mul_montl(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, gsEngine* pGFE)
+{
+   BNU_CHUNK_T product[2*LEN_P256K1];
+   cpMul_BNU_school(product, pA,LEN_P256K1, pB,LEN_P256K1);
+   return p256k1_mred(pR, product, GFP_MNT_FACTOR(pGFE));
+}
+
+static BNU_CHUNK_T* p256k1_sqr_montl(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsEngine* pGFE)
+{
+   BNU_CHUNK_T product[2*LEN_P256K1];
+   cpSqr_BNU_school(product, pA,LEN_P256K1);
+   return p256k1_mred(pR, product, GFP_MNT_FACTOR(pGFE));
+}
+
+static BNU_CHUNK_T* p256k1_to_mont(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsEngine* pGFE)
+{
+   return p256k1_mul_montl(pR, pA, GFP_MNT_RR(pGFE), pGFE);
+}
+
+static BNU_CHUNK_T* p256k1_mont_back(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsEngine* pGFE)
+{
+   BNU_CHUNK_T product[2*LEN_P256K1];
+   ZEXPAND_COPY_BNU(product, 2*LEN_P256K1, pA, LEN_P256K1);
+   return p256k1_mred(pR, product, GFP_MNT_FACTOR(pGFE));
+}
+
+/* return specific gf p256k1 arith methods */
+static gsModMethod* gsArithGF_p256k1(void)
+{
+   static gsModMethod m = {
+      p256k1_to_mont,
+      p256k1_mont_back,
+      p256k1_mul_montl,
+      p256k1_sqr_montl,
+      NULL,
+      p256_add,
+      p256_sub,
+      p256_neg,
+      p256_div_by_2,
+      p256_mul_by_2,
+      p256_mul_by_3,
+   };
+   return &m;
+}
+#endif /* _IPP32E >= _IPP32E_M7 */
+
+/*F*
+// Name: ippsGFpMethod_p256k1
+//
+// Purpose: Returns a reference to an implementation of
+//          arithmetic operations over GF(q).
+//
+// Returns:  Pointer to a structure containing an implementation of arithmetic
+//           operations over GF(q). q = 2^256 - 2^32 - 977
+*F*/
+
+IPPFUN( const IppsGFpMethod*, ippsGFpMethod_p256k1, (void) )
+{
+   static IppsGFpMethod method = {
+      cpID_PrimeP256k1,
+      256,
+      secp256k1_p,
+      NULL,
+      NULL
+   };
+
+   #if(_IPP32E >= _IPP32E_M7)
+   method.arith = gsArithGF_p256k1();
+   #else
+   method.arith = gsArithGFp();
+   #endif
+   return &method;
+}
+
+#undef LEN_P256K1
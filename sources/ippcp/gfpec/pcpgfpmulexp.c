@@ -62,6 +62,10 @@
 //    pGFp            Pointer to the context of the finite field.
 //    pScratchBuffer  Pointer to the scratch buffer.
 //
+// Note:
+//    See ippsGFpMultiExpLarge() for more than IPP_MAX_EXPONENT_NUM items
+//    and ippsGFpMultiExp_VT() for public exponents.
+//
 *F*/
 
 IPPFUN(IppStatus, ippsGFpMultiExp,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems,
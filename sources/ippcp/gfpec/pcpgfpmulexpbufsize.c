@@ -0,0 +1,69 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Operations over GF(p).
+//
+//     Context:
+//        ippsGFpMultiExpBufferSize
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "gfpec/pcpgfpstuff.h"
+#include "gfpec/pcpgfpxstuff.h"
+#include "pcptool.h"
+
+
+/*F*
+// Name: ippsGFpMultiExpBufferSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpMultiExpLarge() and ippsGFpMultiExp_VT()
+//          for any number of exponents.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr          pGFp == NULL
+//                              pBufferSize == NULL
+//    ippStsContextMatchErr     incorrect pGFp's context id
+//    ippStsBadArgErr           0>=nItems
+//                              nItems is too big
+//    ippStsNoErr               no error
+//
+// Parameters:
+//    nItems          Number of exponents.
+//    pGFp            Pointer to the context of the finite field.
+//    pBufferSize     Pointer to the calculated buffer size in bytes.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpMultiExpBufferSize,(int nItems, const IppsGFpState* pGFp, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pGFp, pBufferSize);
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr);
+   IPP_BADARG_RET( nItems>(IPP_MAX_32S/2)/MULTIEXP_ITEMS_SIZE(1), ippStsBadArgErr);
+   {
+      int elmLen = GFP_FELEN(GFP_PMA(pGFp));
+
+      *pBufferSize = (CACHE_LINE_SIZE-1)
+                   + MULTIEXP_ITEMS_SIZE(nItems)
+                   + cpGFpxMultiExpBufferSize(nItems, elmLen);
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,117 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Operations over GF(p).
+//
+//     Context:
+//        ippsGFpMultiExpLarge()
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "gfpec/pcpgfpstuff.h"
+#include "gfpec/pcpgfpxstuff.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsGFpMultiExpLarge
+//
+// Purpose: Multiplies exponents of GF elements (any number of items)
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr              NULL == pGFp
+//                                  NULL == ppElmA
+//                                  NULL == pR
+//                                  NULL == ppE
+//                                  NULL == pScratchBuffer
+//
+//    ippStsContextMatchErr         invalid pGFp->idCtx
+//                                  invalid ppElmA[i]->idCtx
+//                                  invalid pR->idCtx
+//                                  invalid ppE[i]->idCtx
+//
+//    ippStsOutOfRangeErr           GFPE_ROOM() != GFP_FELEN()
+//
+//    ippStsBadArgErr               1>nItems
+//
+//    ippStsNoErr                   no error
+//
+// Parameters:
+//    ppElmA          Pointer to the array of contexts of the finite field elements representing the base of the exponentiation.
+//    ppE             Pointer to the array of the Big Number contexts storing the exponents.
+//    nItems          Number of exponents.
+//    pR              Pointer to the context of the resulting element of the finite field.
+//    pGFp            Pointer to the context of the finite field.
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpMultiExpBufferSize(nItems) size.
+//
+// Note:
+//    The exponents are processed in constant time: the bases are split into groups of
+//    IPP_MAX_EXPONENT_NUM items, the groups share the squarings.
+//    See ippsGFpMultiExp_VT() for public exponents.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpMultiExpLarge,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems,
+                                         IppsGFpElement* pR, IppsGFpState* pGFp,
+                                         Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR2_RET(ppElmA, ppE);
+   IPP_BAD_PTR3_RET(pR, pGFp, pScratchBuffer);
+
+   /* test number of exponents */
+   IPP_BADARG_RET(1>nItems, ippStsBadArgErr);
+
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( !GFPE_VALID_ID(pR), ippStsContextMatchErr );
+   {
+      gsModEngine* pGFE = GFP_PMA(pGFp);
+
+      /* pointers to items are kept at the beginning of the buffer */
+      Ipp8u* pItems = (Ipp8u*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+      const BNU_CHUNK_T** ppAdata = (const BNU_CHUNK_T**)pItems;
+      const BNU_CHUNK_T** ppEdata = ppAdata + nItems;
+      int* nsEdataLen = (int*)(ppEdata + nItems);
+
+      int n;
+
+      IPP_BADARG_RET( GFPE_ROOM(pR)!=GFP_FELEN(pGFE), ippStsOutOfRangeErr);
+
+      /* test all ppElmA[] and ppE[] pairs */
+      for(n=0; n<nItems; n++) {
+         const IppsGFpElement* pElmA = ppElmA[n];
+         const IppsBigNumState* pE = ppE[n];
+         IPP_BAD_PTR2_RET(pElmA, pE);
+
+         IPP_BADARG_RET( !GFPE_VALID_ID(pElmA), ippStsContextMatchErr );
+         IPP_BADARG_RET( !BN_VALID_ID(pE), ippStsContextMatchErr );
+
+         IPP_BADARG_RET( GFPE_ROOM(pElmA)!=GFP_FELEN(pGFE), ippStsOutOfRangeErr);
+      }
+
+      for(n=0; n<nItems; n++) {
+         ppAdata[n] = GFPE_DATA(ppElmA[n]);
+         ppEdata[n] = BN_NUMBER(ppE[n]);
+         nsEdataLen[n] = BN_SIZE(ppE[n]);
+      }
+
+      cpGFpxMultiExpGroups(GFPE_DATA(pR), ppAdata, ppEdata, nsEdataLen, nItems, 1, pGFE, pItems+MULTIEXP_ITEMS_SIZE(nItems));
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,74 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Internal operations over GF(p) extension.
+//
+//     Context:
+//        cpGFpxBatchInv()
+//
+*/
+
+#include "owncp.h"
+#include "gfpec/pcpgfpxstuff.h"
+#include "pcpmask_ct.h"
+
+/*
+// Computes R[i] = 1/A[i], i=0,...,nItems-1 by the single inversion
+// (Montgomery's simultaneous inversion trick): 1 inversion and 3*(nItems-1) multiplications.
+//
+// pBuffer is nItems field elements of the prefix products.
+// ppR[i] may be the same as ppA[i].
+//
+// Returns 0 if any A[i] is zero (R[] are not modified), 1 otherwise.
+// Execution time does not depend on the values of A[].
+*/
+IPP_OWN_DEFN (int, cpGFpxBatchInv, (BNU_CHUNK_T* const ppR[], const BNU_CHUNK_T* const ppA[], int nItems, gsModEngine* pGFEx, BNU_CHUNK_T* pBuffer))
+{
+   int elemLen = GFP_FELEN(pGFEx);
+   mod_mul mulF = GFP_METHOD(pGFEx)->mul;
+
+   BNU_CHUNK_T* pAcc = cpGFpGetPool(2, pGFEx);
+   BNU_CHUNK_T* pT = pAcc + GFP_PELEN(pGFEx);
+
+   int n;
+
+   /* prefix[n] = A[0]*...*A[n] */
+   cpGFpElementCopy(pBuffer, ppA[0], elemLen);
+   for(n=1; n<nItems; n++)
+      mulF(pBuffer+n*elemLen, pBuffer+(n-1)*elemLen, ppA[n], pGFEx);
+
+   /* product is zero iff any A[n] is zero */
+   if(GFPE_IS_ZERO_CT(pBuffer+(nItems-1)*elemLen, elemLen)) {
+      cpGFpReleasePool(2, pGFEx);
+      return 0;
+   }
+
+   /* acc = 1/(A[0]*...*A[nItems-1]) */
+   cpGFpxInv(pAcc, pBuffer+(nItems-1)*elemLen, pGFEx);
+
+   for(n=nItems-1; n>0; n--) {
+      cpGFpElementCopy(pT, ppA[n], elemLen);
+      mulF(ppR[n], pAcc, pBuffer+(n-1)*elemLen, pGFEx);  /* 1/A[n] */
+      mulF(pAcc, pAcc, pT, pGFEx);                       /* 1/(A[0]*...*A[n-1]) */
+   }
+   cpGFpElementCopy(ppR[0], pAcc, elemLen);
+
+   cpGFpReleasePool(2, pGFEx);
+   return 1;
+}
@@ -20,6 +20,7 @@
 //
 //     Context:
 //        cpGFpxMultiExp()
+//        cpGFpxMultiExpGroups()
 //
 */
 
@@ -48,6 +49,23 @@ static int GetIndex(const BNU_CHUNK_T* ppE[], int nItems, int nBit)
 }
 
 
+/* same as GetIndex(), but the exponents are not expanded: bits above nsE[] chunks are zero */
+static int GetIndexNS(const BNU_CHUNK_T* ppE[], const int nsE[], int nItems, int nBit)
+{
+   int shift = nBit%BNU_CHUNK_BITS;
+   int offset= nBit/BNU_CHUNK_BITS;
+   int index = 0;
+
+   int n;
+   for(n=nItems; n>0; n--) {
+      index <<= 1;
+      if(offset<nsE[n-1])
+         index += (int)((ppE[n-1][offset]>>shift) &1);
+   }
+   return index;
+}
+
+
 static void cpPrecomputeMultiExp(BNU_CHUNK_T* pTable, const BNU_CHUNK_T* ppA[], int nItems, gsModEngine* pGFEx)
 {
    gsModEngine* pBasicGFE = cpGFpBasic(pGFEx);
@@ -181,3 +199,93 @@ IPP_OWN_DEFN (BNU_CHUNK_T*, cpGFpxMultiExp, (BNU_CHUNK_T* pR, const BNU_CHUNK_T*
       return pR;
    }
 }
+
+/*
+// Multi-exponentiation of any number of items.
+//
+// The items are split into groups of IPP_MAX_EXPONENT_NUM and every group gets
+// its own 2^IPP_MAX_EXPONENT_NUM table of products, as in cpGFpxMultiExp().
+// Up to MULTIEXP_GROUP_TABLES groups are processed in a single pass and share
+// the squarings; the results of passes are multiplied together.
+//
+// sscm!=0: table entries are retrieved by gsScrambleGet_sscm() and the number of
+//          square-and-multiply steps depends on exponent lengths in chunks only,
+//          secret exponents are allowed.
+// sscm==0: variable time, for public exponents only.
+//
+// The scratch buffer holds min(nGroups, MULTIEXP_GROUP_TABLES) tables,
+// see cpGFpxMultiExpBufferSize().
+*/
+IPP_OWN_DEFN (BNU_CHUNK_T*, cpGFpxMultiExpGroups, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* ppA[], const BNU_CHUNK_T* ppE[], const int nsE[], int nItems, int sscm, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
+{
+   gsModEngine* pBasicGFE = cpGFpBasic(pGFEx);
+   mod_mul mulF = GFP_METHOD(pGFEx)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFEx)->sqr;
+   int elmLen = GFP_FELEN(pGFEx);
+
+   /* align scratch buffer */
+   BNU_CHUNK_T* pTable = (BNU_CHUNK_T*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+   int tblLen = (1<<IPP_MAX_EXPONENT_NUM) * elmLen;
+
+   /* get resource */
+   BNU_CHUNK_T* pAcc = cpGFpGetPool(3, pGFEx);
+   BNU_CHUNK_T* pT = pAcc + elmLen;
+   BNU_CHUNK_T* pX = pT + elmLen;
+   //tbcd: temporary excluded: assert(NULL!=pAcc);
+
+   int passItems = MULTIEXP_GROUP_TABLES*IPP_MAX_EXPONENT_NUM;
+   int n0;
+   for(n0=0; n0<nItems; n0+=passItems) {
+      const BNU_CHUNK_T** ppPassA = ppA + n0;
+      const BNU_CHUNK_T** ppPassE = ppE + n0;
+      const int* nsPassE = nsE + n0;
+      int nPass = IPP_MIN(nItems-n0, passItems);
+      int nGroups = (nPass + IPP_MAX_EXPONENT_NUM-1) / IPP_MAX_EXPONENT_NUM;
+      int expBitSize = 0;
+      int g, n;
+
+      /* pre-compute tables of the pass */
+      for(g=0; g<nGroups; g++) {
+         int nGrp = IPP_MIN(nPass - g*IPP_MAX_EXPONENT_NUM, IPP_MAX_EXPONENT_NUM);
+         cpPrecomputeMultiExp(pTable + g*tblLen, ppPassA + g*IPP_MAX_EXPONENT_NUM, nGrp, pGFEx);
+      }
+
+      /* number of square-and-multiply steps */
+      for(n=0; n<nPass; n++) {
+         int bitSize = sscm? nsPassE[n]*BNU_CHUNK_BITS : BITSIZE_BNU(ppPassE[n], nsPassE[n]);
+         expBitSize = IPP_MAX(expBitSize, bitSize);
+      }
+
+      /* pT = 1 */
+      cpGFpElementCopyPad(pT, elmLen, GFP_MNT_R(pBasicGFE), GFP_FELEN(pBasicGFE));
+
+      for(--expBitSize; expBitSize>=0; expBitSize--) {
+         sqrF(pT, pT, pGFEx);
+
+         for(g=0; g<nGroups; g++) {
+            int nGrp = IPP_MIN(nPass - g*IPP_MAX_EXPONENT_NUM, IPP_MAX_EXPONENT_NUM);
+            int tblIdx = GetIndexNS(ppPassE + g*IPP_MAX_EXPONENT_NUM, nsPassE + g*IPP_MAX_EXPONENT_NUM, nGrp, expBitSize);
+            if(sscm) {
+               gsScrambleGet_sscm(pX, elmLen, pTable + g*tblLen, tblIdx, nGrp);
+               mulF(pT, pT, pX, pGFEx);
+            }
+            else if(tblIdx) {
+               gsScrambleGet(pX, elmLen, pTable + g*tblLen, tblIdx, nGrp);
+               mulF(pT, pT, pX, pGFEx);
+            }
+         }
+      }
+
+      if(0==n0)
+         cpGFpElementCopy(pAcc, pT, elmLen);
+      else
+         mulF(pAcc, pAcc, pT, pGFEx);
+   }
+
+   cpGFpElementCopy(pR, pAcc, elmLen);
+
+   /* release resource */
+   cpGFpReleasePool(3, pGFEx);
+
+   return pR;
+}
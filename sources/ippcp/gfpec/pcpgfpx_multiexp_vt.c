@@ -0,0 +1,196 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Cryptography Primitives Library
+//     Internal operations over GF(p) extension.
+//
+//     Context:
+//        cpGFpxMultiExpBucketWinSize()
+//        cpGFpxMultiExpBufferSize()
+//        cpGFpxMultiExpBucket_vt()
+//
+*/
+
+#include "owncp.h"
+#include "pcpbnumisc.h"
+#include "pcptool.h"
+#include "gfpec/pcpgfpxstuff.h"
+
+/*
+// Returns window size of the bucket method if it is expected to be faster
+// than the grouped tables method (cpGFpxMultiExpGroups()), 0 otherwise.
+//
+// Estimated costs per exponent bit (in 1/64 of a multiplication):
+//    grouped tables: a squaring per pass plus a multiplication per group
+//    buckets:        a squaring plus (nItems + 2^(w+1)) multiplications per w bits
+*/
+IPP_OWN_DEFN (int, cpGFpxMultiExpBucketWinSize, (int nItems))
+{
+   Ipp64s nGroups = (nItems + IPP_MAX_EXPONENT_NUM-1) / IPP_MAX_EXPONENT_NUM;
+   Ipp64s nPasses = (nGroups + MULTIEXP_GROUP_TABLES-1) / MULTIEXP_GROUP_TABLES;
+   Ipp64s bestCost = 64*nPasses + 63*nGroups;
+   int bestW = 0;
+
+   int w;
+   for(w=1; w<=MULTIEXP_MAX_BUCKET_W; w++) {
+      Ipp64s cost = 64 + (64*((Ipp64s)nItems + (2<<w))) / w;
+      if(cost<bestCost) {
+         bestCost = cost;
+         bestW = w;
+      }
+   }
+   return bestW;
+}
+
+/*
+// Size (bytes) of the scratch buffer suitable both for cpGFpxMultiExpGroups()
+// and cpGFpxMultiExpBucket_vt()
+*/
+IPP_OWN_DEFN (int, cpGFpxMultiExpBufferSize, (int nItems, int elmLen))
+{
+   int elmDataSize = elmLen*(Ipp32s)sizeof(BNU_CHUNK_T);
+   int nGroups = (nItems + IPP_MAX_EXPONENT_NUM-1) / IPP_MAX_EXPONENT_NUM;
+
+   /* grouped tables */
+   int bufferSize = IPP_MIN(nGroups, MULTIEXP_GROUP_TABLES) * (1<<IPP_MAX_EXPONENT_NUM) * elmDataSize;
+
+   /* buckets and their "filled" flags */
+   int w = cpGFpxMultiExpBucketWinSize(nItems);
+   if(w)
+      bufferSize = IPP_MAX(bufferSize, ((1<<w)-1)*elmDataSize + (1<<w));
+
+   return bufferSize + (CACHE_LINE_SIZE-1);
+}
+
+/* w-bit digit of the exponent started from nBit */
+static int GetDigit(const BNU_CHUNK_T* pE, int nsE, int nBit, int w)
+{
+   int shift = nBit%BNU_CHUNK_BITS;
+   int offset= nBit/BNU_CHUNK_BITS;
+   BNU_CHUNK_T digit;
+
+   if(offset>=nsE)
+      return 0;
+
+   digit = pE[offset] >> shift;
+   if((shift+w)>BNU_CHUNK_BITS && (offset+1)<nsE)
+      digit |= pE[offset+1] << (BNU_CHUNK_BITS-shift);
+
+   return (int)(digit & (BNU_CHUNK_T)((1<<w)-1));
+}
+
+/*
+// Bucket (Pippenger) multi-exponentiation, variable time.
+//
+// For every w-bit window (from the most significant one) each base A[n] is
+// multiplied into the bucket indexed by its exponent digit, then the product
+// of bucket[d]^d is obtained by running products:
+//    run = bucket[2^w-1]*...*bucket[d],  sum = run(2^w-1)*...*run(1)
+// and accumulated: acc = acc^(2^w) * sum.
+//
+// Buckets are never initialized to 1: the first base of a bucket is copied
+// into it, empty buckets are skipped.
+//
+// Public exponents only.
+*/
+IPP_OWN_DEFN (BNU_CHUNK_T*, cpGFpxMultiExpBucket_vt, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* ppA[], const BNU_CHUNK_T* ppE[], const int nsE[], int nItems, int w, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
+{
+   gsModEngine* pBasicGFE = cpGFpBasic(pGFEx);
+   mod_mul mulF = GFP_METHOD(pGFEx)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFEx)->sqr;
+   int elmLen = GFP_FELEN(pGFEx);
+
+   int nBuckets = (1<<w) -1;
+   BNU_CHUNK_T* pBucket = (BNU_CHUNK_T*)( IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE) );
+   Ipp8u* pFilled = (Ipp8u*)(pBucket + nBuckets*elmLen);
+
+   /* get resource */
+   BNU_CHUNK_T* pAcc = cpGFpGetPool(3, pGFEx);
+   BNU_CHUNK_T* pRun = pAcc + elmLen;
+   BNU_CHUNK_T* pSum = pRun + elmLen;
+   //tbcd: temporary excluded: assert(NULL!=pAcc);
+
+   int accIsOne = 1;
+   int expBitSize = 0;
+   int n, nWin;
+
+   /* find out the longest exponent */
+   for(n=0; n<nItems; n++)
+      expBitSize = IPP_MAX(expBitSize, BITSIZE_BNU(ppE[n], nsE[n]));
+
+   for(nWin=(expBitSize+w-1)/w-1; nWin>=0; nWin--) {
+      int runIsOne = 1;
+      int sumIsOne = 1;
+      int d;
+
+      if(!accIsOne) {
+         for(d=0; d<w; d++)
+            sqrF(pAcc, pAcc, pGFEx);
+      }
+
+      /* fill buckets */
+      PadBlock(0, pFilled, nBuckets);
+      for(n=0; n<nItems; n++) {
+         int digit = GetDigit(ppE[n], nsE[n], nWin*w, w);
+         if(digit) {
+            BNU_CHUNK_T* pB = pBucket + (digit-1)*elmLen;
+            if(pFilled[digit-1])
+               mulF(pB, pB, ppA[n], pGFEx);
+            else {
+               cpGFpElementCopy(pB, ppA[n], elmLen);
+               pFilled[digit-1] = 1;
+            }
+         }
+      }
+
+      /* sum = prod bucket[d]^d */
+      for(d=nBuckets; d>0; d--) {
+         if(pFilled[d-1]) {
+            if(runIsOne)
+               cpGFpElementCopy(pRun, pBucket + (d-1)*elmLen, elmLen);
+            else
+               mulF(pRun, pRun, pBucket + (d-1)*elmLen, pGFEx);
+            runIsOne = 0;
+         }
+         if(!runIsOne) {
+            if(sumIsOne)
+               cpGFpElementCopy(pSum, pRun, elmLen);
+            else
+               mulF(pSum, pSum, pRun, pGFEx);
+            sumIsOne = 0;
+         }
+      }
+
+      if(!sumIsOne) {
+         if(accIsOne)
+            cpGFpElementCopy(pAcc, pSum, elmLen);
+         else
+            mulF(pAcc, pAcc, pSum, pGFEx);
+         accIsOne = 0;
+      }
+   }
+
+   if(accIsOne)
+      cpGFpElementCopyPad(pR, elmLen, GFP_MNT_R(pBasicGFE), GFP_FELEN(pBasicGFE));
+   else
+      cpGFpElementCopy(pR, pAcc, elmLen);
+
+   /* release resource */
+   cpGFpReleasePool(3, pGFEx);
+
+   return pR;
+}
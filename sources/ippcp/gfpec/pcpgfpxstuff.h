@@ -33,6 +33,13 @@
 /* address of ground field element inside expanded field element */
 #define GFPX_IDX_ELEMENT(pxe, idx, eleSize) ((pxe)+(eleSize)*(idx))
 
+/* multi-exponentiation of many items */
+#define MULTIEXP_GROUP_TABLES    (8)    /* max number of 2^IPP_MAX_EXPONENT_NUM tables in a pass */
+#define MULTIEXP_MAX_BUCKET_W   (12)    /* max window of the bucket method                      */
+
+/* ippsGFpMultiExpBufferSize() scratch buffer starts with pointers to data of items and lengths of exponents */
+#define MULTIEXP_ITEMS_SIZE(nItems)  ((nItems)*(Ipp32s)(2*sizeof(BNU_CHUNK_T*) + sizeof(int)))
+
 
 __IPPCP_INLINE int degree(const BNU_CHUNK_T* pE, const gsModEngine* pGFEx)
 {
@@ -128,12 +135,22 @@ __IPPCP_INLINE int cpGFpxCopyFromChunk(Ipp32u* pA, const BNU_CHUNK_T* pElm, cons
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxExp, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pE, int nsE, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
 #define cpGFpxMultiExp OWNAPI(cpGFpxMultiExp)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxMultiExp, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* ppA[], const BNU_CHUNK_T* ppE[], int nsE[], int nItems, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
+#define cpGFpxMultiExpGroups OWNAPI(cpGFpxMultiExpGroups)
+   IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxMultiExpGroups, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* ppA[], const BNU_CHUNK_T* ppE[], const int nsE[], int nItems, int sscm, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
+#define cpGFpxMultiExpBucket_vt OWNAPI(cpGFpxMultiExpBucket_vt)
+   IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxMultiExpBucket_vt, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* ppA[], const BNU_CHUNK_T* ppE[], const int nsE[], int nItems, int w, gsModEngine* pGFEx, Ipp8u* pScratchBuffer))
+#define cpGFpxMultiExpBucketWinSize OWNAPI(cpGFpxMultiExpBucketWinSize)
+   IPP_OWN_DECL (int, cpGFpxMultiExpBucketWinSize, (int nItems))
+#define cpGFpxMultiExpBufferSize OWNAPI(cpGFpxMultiExpBufferSize)
+   IPP_OWN_DECL (int, cpGFpxMultiExpBufferSize, (int nItems, int elmLen))
 #define cpGFpxConj OWNAPI(cpGFpxConj)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxConj, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
 #define cpGFpxNeg OWNAPI(cpGFpxNeg)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxNeg, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
 #define cpGFpxInv OWNAPI(cpGFpxInv)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxInv, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
+#define cpGFpxBatchInv OWNAPI(cpGFpxBatchInv)
+   IPP_OWN_DECL (int, cpGFpxBatchInv, (BNU_CHUNK_T* const ppR[], const BNU_CHUNK_T* const ppA[], int nItems, gsModEngine* pGFEx, BNU_CHUNK_T* pBuffer))
 #define cpGFpxHalve OWNAPI(cpGFpxHalve)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxHalve, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
 #define InitGFpxCtx OWNAPI(InitGFpxCtx)
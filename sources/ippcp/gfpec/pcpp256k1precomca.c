@@ -0,0 +1,2539 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     EC over Prime Finite Field (secp256k1 precomputed)
+//
+//
+*/
+#include "owncp.h"
+#include "gfpec/pcpgfpecstuff.h"
+
+
+#define OPERAND_BITSIZE (256)
+#define LEN_P256        (BITS_BNU_CHUNK(OPERAND_BITSIZE))
+
+/* secp256k1 affine point */
+typedef struct{
+   BNU_CHUNK_T X[LEN_P256];
+   BNU_CHUNK_T Y[LEN_P256];
+} P256K1_POINT_AFFINE;
+
+extern const __ALIGN64 P256K1_POINT_AFFINE ec_p256k1_precomputed[37][64];
+
+
+#if defined( _IPP_DATA )
+
+#if !defined(_DISABLE_ECP_256K1_HARDCODED_BP_TBL_)
+/* see ippcp_baseptbl.cpp test for generation details */
+
+const __ALIGN64 P256K1_POINT_AFFINE ec_p256k1_precomputed[37][64] = {
+/* digit=0 base_pwr=2^0 */
+{
+   {{LL(0x487e2097,0xd7362e5a),LL(0x29bc66db,0x231e2953),LL(0x33fd129c,0x979f48c0),LL(0xe9089f48,0x9981e643)}, {LL(0xd3dbabe2,0xb15ea6d2),LL(0x1f1dc64d,0x8dfc5d5d),LL(0xac19c136,0x70b6b59a),LL(0xd4a582d6,0xcf3f851f)}},
+   {{LL(0x81048d2c,0x4e0640c9),LL(0x88b285a0,0x71354afc),LL(0xe0140404,0xce0b62e1),LL(0xcba0ee23,0xf918623c)}, {LL(0xffaccfbf,0x7d12d622),LL(0x7dc75ce1,0x84fd2516),LL(0xbda2cc65,0x4b3a0f64),LL(0x157b9313,0x3c7f7712)}},
+   {{LL(0xd5fea781,0x2379d4bb),LL(0x22eb7bc4,0x066ceafb),LL(0x85985972,0x5940d073),LL(0xcdf4c0ad,0x9497730f)}, {LL(0x613f55a9,0xaf18b0b0),LL(0xc5a1f91f,0xac4964cd),LL(0x84885650,0xcc6048bd),LL(0x9215ec76,0x3ec28dcd)}},
+   {{LL(0xaf6a0bfd,0x3daa13e8),LL(0x3b9b132f,0x37571e4d),LL(0xf9b379e0,0xde9fbe79),LL(0x1ca769b7,0x1957e695)}, {LL(0x5bf5eae9,0x1372e87e),LL(0x9400d136,0x746dd1bf),LL(0x3d6a1839,0xc3e5bac2),LL(0x209e02b9,0x4c9a2dbb)}},
+   {{LL(0xbea19bc6,0x212347fc),LL(0xdc284cda,0x58d7334d),LL(0x72dd41dd,0x20ce3585),LL(0xaae7f96f,0x8ed284d3)}, {LL(0x00dfd9e7,0x9e5e7848),LL(0xaad35cc5,0x59aaa8d8),LL(0x7f8dbfd2,0x011d0b10),LL(0x583630c0,0x1fd437ae)}},
+   {{LL(0xe568f5bc,0xd409e08f),LL(0x5355fe43,0x534e4de7),LL(0x01b5b366,0x5d84dcf3),LL(0x0f91fa73,0x5c808849)}, {LL(0xc6a6b4ca,0x5dee0bf9),LL(0x82ae93be,0x7ba780ad),LL(0x97c737a7,0xb9a04117),LL(0x2060a9c3,0x0175b14f)}},
+   {{LL(0xcaa4cb22,0x07ece566),LL(0x16c087c4,0xca934f87),LL(0x4e1d6bd5,0x4da36222),LL(0xd73866e0,0x5f402433)}, {LL(0x4a77d752,0x4777d112),LL(0xf1097263,0x879d7639),LL(0x7291ab04,0xf2fd13d8),LL(0x0ba1a73b,0xc8043a67)}},
+   {{LL(0x3e0b48a5,0xf2316206),LL(0xfa606728,0x7a060c0b),LL(0xab408c8b,0x376af358),LL(0xcfa83a8c,0xc3088630)}, {LL(0x452c2cfb,0xceb03c71),LL(0xece7dd34,0x7b292c94),LL(0xf1ea48b2,0x75193c47),LL(0x79490860,0x85b43f99)}},
+   {{LL(0xeafd5a74,0x46cc6d26),LL(0x1ed7f74c,0x6edd9e7f),LL(0xf64b253d,0x8cec72c7),LL(0xf4d02a72,0x87d71c6b)}, {LL(0x268d25a4,0xb2a0d4ae),LL(0x59794d80,0xaec108c6),LL(0xe6793574,0xf0176bed),LL(0x94cef97c,0x01563390)}},
+   {{LL(0xf7784248,0x55ca2987),LL(0xbe40abcd,0x8c5126a2),LL(0xdea2464f,0x70b8c02e),LL(0xcea73b48,0xe8cf0172)}, {LL(0xe49bc235,0x6136fd68),LL(0x5d4daacc,0x46636021),LL(0xdddeea91,0x60333362),LL(0x99eddb2e,0x0d3a934a)}},
+   {{LL(0x94a7a0aa,0x04f0c78f),LL(0x93493bb8,0x349ebdf9),LL(0xbb49a3c1,0xd28558b5),LL(0xbce5a953,0x9d888be8)}, {LL(0x7beacf4c,0x434322e3),LL(0xf899acaa,0x755db980),LL(0x7b41572a,0x7cb76bd2),LL(0x7705fac8,0x0e92c06d)}},
+   {{LL(0x2095e799,0xb915e581),LL(0xb5f4abae,0x5b0037a9),LL(0xfd6bde73,0x5cc8065a),LL(0x50a32c5e,0x5a1ba916)}, {LL(0xe50a193d,0x0c75cf5b),LL(0x16ce529f,0x2a531f7e),LL(0x02c73651,0xc11a0259),LL(0x44355c42,0x61aa2860)}},
+   {{LL(0xf5989088,0xd59a06c4),LL(0x46aec93f,0xd35438e6),LL(0xa02a9988,0x5b370e50),LL(0xaff18f7b,0x7065f32b)}, {LL(0xa5d44558,0x14817536),LL(0x948a3b41,0x0f73d052),LL(0xc013f5af,0xdb37e3a6),LL(0x99b24984,0x595e4c33)}},
+   {{LL(0xd119938b,0x1e9cce5f),LL(0x078e2e49,0xf82a3045),LL(0x050c28c8,0x15e738ff),LL(0x3ed47ea2,0x8482dda7)}, {LL(0xac7e1635,0xdfeaa54c),LL(0x5309b645,0x9df244f1),LL(0x4b900c72,0xccaac108),LL(0x819b112e,0x875e4a09)}},
+   {{LL(0x18620cd4,0xd51e8da3),LL(0x3ff3bffd,0xa9b17424),LL(0xf9180a0e,0x8fe0d087),LL(0x6a78a2b1,0x329cf6f3)}, {LL(0x8cf9083a,0x364e94e6),LL(0x5ca29845,0xd97359fb),LL(0x9e703fc8,0x1442e0ed),LL(0x4965bc3e,0xf384d03b)}},
+   {{LL(0xefe247fb,0x41a38518),LL(0xcf43dec5,0x78d77162),LL(0x88f3f45a,0x952ed694),LL(0x526d9948,0xb7f2007d)}, {LL(0x37528726,0xb252bfb8),LL(0x8855c928,0x35538b90),LL(0xe631ad75,0xe6e1d02c),LL(0xf2e973c0,0xa46b9ec0)}},
+   {{LL(0x1df00c43,0xd90bb8e1),LL(0xf3b25560,0x9b182865),LL(0x22b91922,0x69d7a2a8),LL(0xf9ff59aa,0xe272a6a1)}, {LL(0x6f2a14c9,0x85352ea7),LL(0x753707e5,0x99dc58b3),LL(0xc6b65cc3,0x4e936ddc),LL(0x38a1624e,0xb9d10585)}},
+   {{LL(0xe77f7a20,0xe09aceae),LL(0x45693c50,0xcc8fbdf7),LL(0xa5dece13,0x6f3dba88),LL(0x0439349c,0xef9c5b0a)}, {LL(0xf45ad225,0xb156dbc6),LL(0x70041a77,0x001c91d6),LL(0xd27c9659,0xcf4f5d2d),LL(0x8dc35bb0,0x6eb891fd)}},
+   {{LL(0xd62a7a38,0xd78ee564),LL(0x727df8f4,0x5f8bf03a),LL(0xa3023a4a,0xd8d133ad),LL(0x4dd633a5,0xdeb7636c)}, {LL(0xe0d36289,0xdf15c738),LL(0x98b88bdc,0x91a29c61),LL(0x00dda4f2,0x7ceef096),LL(0xd07c28ea,0x444ec627)}},
+   {{LL(0xc875e295,0x8ad822b3),LL(0x82a9bbc8,0x4cef6533),LL(0x2f69b0da,0x7abf8ae6),LL(0xa3d9b51c,0xd5430d14)}, {LL(0x705ad9be,0x039a9a21),LL(0xc3bdcc0d,0x1b122f3b),LL(0x844a2b0d,0x71830200),LL(0x16f62808,0x297d11a2)}},
+   {{LL(0xf76ce60a,0x7287d563),LL(0x74eacc1d,0x6ddb2dc6),LL(0x6cb12ea3,0xe0a1107e),LL(0xa746f598,0x38d21ce5)}, {LL(0x34cae6f2,0xead831a4),LL(0x4c4c0573,0x439ddfdc),LL(0xb8025098,0xd69265ae),LL(0xaf0be6c8,0x9a760529)}},
+   {{LL(0xb73e4a91,0xe8c5c366),LL(0x5c0116b7,0x932d5bdc),LL(0x2e70a605,0x784a6da3),LL(0xdd29779e,0xfbccf5c7)}, {LL(0xf513ddd4,0x442f6ff4),LL(0xc89dc5e4,0xe71b520e),LL(0x999000c2,0xc678ca75),LL(0x3ac4df6b,0x56041ef7)}},
+   {{LL(0x7d7868e2,0x710c2491),LL(0xa66fa9a0,0xb7018dcc),LL(0x928ba6aa,0xb2bb768f),LL(0x36060918,0x34b90891)}, {LL(0x5a765cfa,0x1bb37e7d),LL(0x05d5c130,0x04e41eb8),LL(0x934fc6c9,0xfabc5a81),LL(0x956c455f,0x1ada75eb)}},
+   {{LL(0x7120202e,0xcfeb8368),LL(0xaac15990,0x4485de9f),LL(0x611eb42a,0xead011df),LL(0x85536ab6,0x553c0312)}, {LL(0x7240f1c3,0x9fbdd9e3),LL(0x0f508400,0x85f1090f),LL(0xe4385e3b,0x6e1fe9b9),LL(0x1f5941f0,0xa062a137)}},
+   {{LL(0x528eab6d,0x43a8673a),LL(0x84257eee,0xcc7c3aff),LL(0xf7fb2c09,0x826674bb),LL(0xb6487c5a,0x4f13fd3d)}, {LL(0x37027b74,0x1af88d5c),LL(0xbb5bb569,0xd788f352),LL(0xeaaa2d4c,0x315a735b),LL(0xb81ac1bd,0xdaaf22e5)}},
+   {{LL(0xbc3e0277,0xf746484e),LL(0xb88af5f1,0x5f849b69),LL(0x6e887dd7,0x2d84e9b5),LL(0xbe8af66b,0x0298e7d5)}, {LL(0xae7ba72a,0x70dd4db0),LL(0x696ecb70,0x14168780),LL(0x91c7f763,0x352e52d4),LL(0x3dcd4458,0xad00c615)}},
+   {{LL(0xdf096d18,0x4065de4b),LL(0x64c270e8,0xf732d136),LL(0xb730aeba,0x4a77f053),LL(0x65719926,0x6753e5a7)}, {LL(0x45d3e40b,0xca066881),LL(0xac9dcfb6,0x5987c3f8),LL(0xd3304a23,0xfbfcc60c),LL(0x80153d3b,0x5dace331)}},
+   {{LL(0xe3848537,0xdb27e02a),LL(0xcb3d03c0,0xbe2a99c7),LL(0x98b44128,0xe89f5c56),LL(0x969dc755,0x9e8ad8b2)}, {LL(0xb58e0b4e,0x2614d543),LL(0xe5216308,0x9dc042c8),LL(0x846a6d59,0x63337ca3),LL(0x11d0b6f6,0xeaac1ce1)}},
+   {{LL(0xbc66aebf,0x78393cc1),LL(0x1124aa09,0x66de27b3),LL(0x72cecebe,0x8c4c7f20),LL(0xd5a92b77,0x30822abd)}, {LL(0xf7cbcb31,0xa8c8e083),LL(0x72bd2977,0xcb952fa1),LL(0x1afa8c27,0x0cdb3ab3),LL(0x6535ce88,0x210ec24f)}},
+   {{LL(0xea37d02f,0xd78ad319),LL(0xa549b38e,0x4d1a8ed0),LL(0x65f6f533,0xa97f6fc8),LL(0xdfd4a7fd,0x3f731fea)}, {LL(0x9361e8f7,0xaa7392cf),LL(0xb96d7efb,0xa9b0401b),LL(0x89de9864,0x87387261),LL(0x8f2788ce,0x5df3fde8)}},
+   {{LL(0x1af2746f,0x3eeec4b2),LL(0xb2686256,0x016f76f7),LL(0x84012e67,0x730d41a4),LL(0xf74ec811,0xf12c7e23)}, {LL(0xa89357dc,0xe5694678),LL(0xca2335dd,0x10ac2b51),LL(0xe149b499,0x5e0eda4c),LL(0xbfa868aa,0x27964839)}},
+   {{LL(0x4d6a3d31,0x7c2cd2b5),LL(0x708ed243,0xacc8229d),LL(0xfe000a29,0x93e19cc4),LL(0x7be6cf23,0x98d1c0e4)}, {LL(0x553f37ee,0x7d04a29f),LL(0x341f8cab,0x7674374a),LL(0x4e530eb0,0x408bc0f9),LL(0x4359aeab,0xbd734a1a)}},
+   {{LL(0x04462042,0xc789b0d9),LL(0x7948d55c,0x83266b6f),LL(0x6ce63ae1,0x87e088c1),LL(0xa8134188,0x37b49275)}, {LL(0x2b18110c,0x55856bfe),LL(0xc499bb93,0xf698b243),LL(0x0cef8e10,0x03dbb381),LL(0x777f178a,0x79fb211f)}},
+   {{LL(0xa29092e5,0x6b48bb4d),LL(0x2b419efc,0x9e2f3006),LL(0x456abb8a,0xd1cef5e0),LL(0x95381a34,0x7d652785)}, {LL(0x2d314242,0x1bccc7a0),LL(0xd207756a,0xf82b92e1),LL(0xfdd2ba43,0x20a18ea5),LL(0x3ebf669c,0x076a9f90)}},
+   {{LL(0x23eacd0a,0x8cc030b5),LL(0xe6947cc4,0xaf885b4d),LL(0xcf667258,0xa06b283a),LL(0x6f6f64c8,0x581042a6)}, {LL(0x9265f180,0x3a31e3d7),LL(0x5eab6ebe,0x4dc9de4c),LL(0xaeabe161,0xbd0a4fad),LL(0x5b411868,0xc7ec3e2d)}},
+   {{LL(0xff5a336a,0xc86d641c),LL(0xe8476efb,0x93b20803),LL(0x1dc488e1,0x2a0d38b3),LL(0xbf9d57ee,0xedbf560d)}, {LL(0xcde9b9e5,0xc86df9d6),LL(0x3df70ec9,0xc4165b26),LL(0x86711b08,0x7ea8c8fb),LL(0xe299cf45,0xaa91e9f2)}},
+   {{LL(0x611e5431,0x574d374d),LL(0xed7e7a80,0x85755869),LL(0xd6081a8f,0x198bd86c),LL(0xb92d0518,0x621a29dd)}, {LL(0xdd9866d8,0xf231989e),LL(0xda9fddb4,0xc1be6826),LL(0xe11526fa,0x8985db78),LL(0xd67d796d,0xce9b6976)}},
+   {{LL(0x03938a1e,0x95f68adc),LL(0x2a26cf7d,0x8a389653),LL(0x313f9762,0xb70cef08),LL(0xd34822fe,0x4e6f96f1)}, {LL(0xdb7a66cd,0xd07a5a7a),LL(0xb6519ce3,0x84e15cfb),LL(0x453b87eb,0xd5ec29d7),LL(0xb4d2e26b,0x4b98ffd2)}},
+   {{LL(0x931ab84a,0x0abb6b74),LL(0x0af3d47a,0x8c686ce2),LL(0x524477f9,0x5e723a3d),LL(0x5c326551,0x77de6bba)}, {LL(0x929b6f64,0xfc5b9ec5),LL(0xe49d0496,0xaeb7c6cd),LL(0xc7aafa37,0xf5482095),LL(0xf5a3d880,0xcf35e3eb)}},
+   {{LL(0x871c4c13,0x3d45dcaa),LL(0xd3122d05,0x35eeee59),LL(0x3997035a,0x352e2ae0),LL(0x0aba4d02,0x676e0b27)}, {LL(0x07ef599c,0x0454f898),LL(0x5d3c4a70,0x2596ee91),LL(0x62dc79c0,0x88784987),LL(0x73c22f20,0x6b9a869c)}},
+   {{LL(0xf53d193c,0x0ae480b9),LL(0x0dc5b44e,0x86f719df),LL(0x89c1812d,0x146dbbc1),LL(0x67214653,0x2e2bc805)}, {LL(0xbe39d872,0xfcbb7632),LL(0x7d576c11,0x4ba332cb),LL(0x19f23c9b,0x18e6c1b2),LL(0x383240ea,0xc00969e9)}},
+   {{LL(0x6029ebec,0x790fbc07),LL(0x0f563b5f,0x00772e02),LL(0x3dcb4ab0,0x57ac0987),LL(0x45d8dacc,0x3545677c)}, {LL(0x40835633,0x884d9dd4),LL(0xc8fab0f0,0x0382e69b),LL(0xf03f9be9,0x73d62ab3),LL(0xa5dcc38d,0xa0a1827a)}},
+   {{LL(0xf83f38d0,0x5f294ba4),LL(0x66f160b7,0x3cc9b7d4),LL(0x1597f957,0xa93c9352),LL(0x65a48803,0x37c6a02e)}, {LL(0x4c8dde97,0xbe0809ba),LL(0x5b5ad049,0xd90d585c),LL(0xd45360dc,0xf3df54f6),LL(0x6bea9faa,0x962e84ea)}},
+   {{LL(0x159de74f,0x8a909a28),LL(0x0e172033,0xa010efbd),LL(0xdb217aa4,0xfa95bac4),LL(0xa42fbbb1,0x30c28068)}, {LL(0x7b539a7e,0x027c0825),LL(0x4036382f,0xf4084292),LL(0xb86e0212,0x150d4416),LL(0x5ab4d5f5,0xf1cef3f8)}},
+   {{LL(0x9efa4969,0xba368467),LL(0xd5081d8f,0xc20713ed),LL(0x42552668,0x83c92f9d),LL(0x5320b144,0x2ca518ad)}, {LL(0x90e0c05c,0x5afa94ed),LL(0xbe289c86,0x3b30690e),LL(0x2c544b3d,0x854ec810),LL(0x9e6ffca5,0x578756f2)}},
+   {{LL(0x313e1d59,0xb4ca6680),LL(0xaf1fbc90,0x1c764035),LL(0xfc9bb6cb,0x5804d5b1),LL(0xbe67cd30,0x5e61bc2a)}, {LL(0x1d38a9e9,0xf9026fda),LL(0xf53b530b,0xe1c22eb5),LL(0x9a4e1cd9,0xede7fc35),LL(0x7ba1c5ef,0x6f21c303)}},
+   {{LL(0x472adca1,0x16a6d6de),LL(0xae5cb8cf,0x86ae5c96),LL(0x4d1fb544,0x49cb0651),LL(0x1cbf1211,0x3233ef66)}, {LL(0x49e7e82b,0x3b477576),LL(0x94c7e45a,0x4fc6f539),LL(0x8ae74268,0xe4bc5f98),LL(0x0425b0d4,0x3f188c56)}},
+   {{LL(0x11b93177,0x44e91579),LL(0x98772e8e,0x4f830ca0),LL(0x9f7a0825,0xe27a77c0),LL(0x324f752b,0x67f338a8)}, {LL(0x6306576a,0x8300d984),LL(0x2a87a305,0xae275473),LL(0xae4252b8,0xd265a3ed),LL(0xc4e44cf4,0x63d34ea8)}},
+   {{LL(0xd939d060,0xdef9f1d0),LL(0xde7df977,0x7ee70afd),LL(0x4e310ef5,0x6c08f60d),LL(0x9bb97205,0xa1482a26)}, {LL(0x80d483ec,0xcdd9f40c),LL(0x769367ab,0xba1f50ed),LL(0xd8a95257,0x33364421),LL(0x2e1da593,0x6db77a1a)}},
+   {{LL(0xcd02463d,0xe9db21e6),LL(0x1b33f0e2,0x612b80e3),LL(0xf4790502,0x6e31352a),LL(0x0a75002c,0x05bc20a2)}, {LL(0xd54f33f2,0x61cc98a7),LL(0xb1c27fbb,0x394804e4),LL(0xa931198c,0x9d8fc4b9),LL(0xf7b665a8,0x08250deb)}},
+   {{LL(0xd6d499e6,0x4fba1057),LL(0x1919ed5f,0xc36b65f0),LL(0x05d0d2e9,0xead948d3),LL(0xf2d3984e,0x6e3c4f4f)}, {LL(0xd133daef,0x02b72b3f),LL(0x8a4f8771,0xc22c7b5f),LL(0x330ddbf7,0xd266f00b),LL(0x2d273a4b,0x73f7d2d3)}},
+   {{LL(0xb093df83,0xcec5ceb1),LL(0x3de6c39e,0x5f7b175f),LL(0xd1f39df5,0x7b736eec),LL(0xeb92c8a4,0xd29e7a57)}, {LL(0x0f095b53,0x08dd3ab7),LL(0xdc917e8c,0x5cb6f450),LL(0x2235ecda,0x22b0f71d),LL(0xa71f1a6c,0x7be08a79)}},
+   {{LL(0x9b4ad7c2,0x29aba0f9),LL(0xf139f8c5,0xe5fd9e62),LL(0x7d19e5a2,0xde7b34cf),LL(0xf4eb9bb7,0xaf6ceb12)}, {LL(0xd79eb786,0x980e43ac),LL(0x06865b9b,0x55c8772e),LL(0x63e0338d,0x83dadee9),LL(0xb0e45726,0xf2edddf9)}},
+   {{LL(0x75426676,0x79926586),LL(0xa4e53e47,0xd5d9503a),LL(0x98f7811a,0x1854ad9d),LL(0x466c83ee,0x2cfae1da)}, {LL(0x735c23f6,0x57c16d76),LL(0x16f569dc,0x96bcd920),LL(0xd8bc61ea,0x8b59f3ca),LL(0xe74f4390,0x127d3151)}},
+   {{LL(0x2e9be15e,0x51666ffc),LL(0x02fad43d,0x2483921e),LL(0x6c8c357e,0x8f1c07dc),LL(0x6985fced,0xc7b06ee9)}, {LL(0xc6b46c3e,0xcc6e1536),LL(0xbbb2db21,0x5528e849),LL(0x7be3572a,0xf26df73f),LL(0x910b0743,0xba398de3)}},
+   {{LL(0x3cf5332e,0x642165e0),LL(0x4aea4e1f,0x5cfc29d9),LL(0x3432dfb6,0x51d2ce62),LL(0xc4da0682,0xc4b9dbb6)}, {LL(0x924e75f4,0x5adfc3d1),LL(0x67767df4,0x581c935e),LL(0x72355b70,0x09760b40),LL(0xe70f10dd,0x42c46858)}},
+   {{LL(0xc70c9cbc,0x117a547c),LL(0xe1e6e3e4,0xb47a5180),LL(0xe040dc88,0xe4be3476),LL(0x4b0d1b30,0x3130c25b)}, {LL(0xcf2a1cef,0x040d4f07),LL(0x50d3fb9a,0x1bdbea36),LL(0xfe4216bc,0x877f57dd),LL(0x4b832e71,0xc6ea984d)}},
+   {{LL(0xe7823826,0xe8e86043),LL(0xfa42526d,0x81d1060d),LL(0xa26dafeb,0xdbdfe9e8),LL(0x7315e904,0xd482660d)}, {LL(0x0a362621,0xb112d5d0),LL(0x5610f7ca,0x208c7a53),LL(0x0572c2c9,0xe0a30f65),LL(0xc268724d,0x0dd2a3b9)}},
+   {{LL(0x23cf448a,0x8fefc574),LL(0x7761b2b0,0xa154e2bd),LL(0x25037408,0x9500ddd6),LL(0x30f720ed,0xfb31e376)}, {LL(0x0b2b3069,0xd1b65815),LL(0x6b6d0049,0x9c4d7e1a),LL(0x5b38bc15,0x4c8df8bb),LL(0xab3dfe73,0xcad37dfa)}},
+   {{LL(0xb032e04a,0x670d2378),LL(0x88f6b978,0x3d3746ff),LL(0xd4c10217,0x18142397),LL(0xf6e7f95b,0x07a26cff)}, {LL(0xe896d71a,0x19c1220e),LL(0xd1fde62e,0xb24694f8),LL(0x9704ea21,0x4062a53c),LL(0x590695f3,0x35662548)}},
+   {{LL(0xe9b540e1,0x3b75bb5d),LL(0xb549b012,0x7f125440),LL(0x8450e538,0x83f9faf0),LL(0xcd40829a,0xa2930635)}, {LL(0xdaed83c2,0x73f89d79),LL(0x4889b425,0x398e268e),LL(0xe6112ff9,0x367fdcf5),LL(0x7c885dc0,0x866090e2)}},
+   {{LL(0x27a93f61,0x69ed18cb),LL(0xa079fb0e,0x3a6bb93d),LL(0x92cdc3d3,0x6f71c199),LL(0x6b88a272,0x5197cb54)}, {LL(0xde128b56,0x630ca631),LL(0xfb176ffe,0xea75123b),LL(0x7428e8d2,0x8356e965),LL(0x33a587eb,0x28203904)}},
+   {{LL(0x639300be,0xa4d44416),LL(0xb9f7c408,0xdea61ae4),LL(0x839c0518,0xffda5b3f),LL(0xaa4356f4,0x3539752c)}, {LL(0x13bb54b7,0x037c0abf),LL(0xe367f08f,0xb3c48ffe),LL(0xd943dd47,0x56e45762),LL(0x8c07e9ee,0x4f07938a)}},
+   {{LL(0xadc5e138,0xd8c0c00b),LL(0x0a1a959c,0xad6f0e40),LL(0x350f79dc,0x317b23fa),LL(0x1f86167c,0xa48bbcf7)}, {LL(0x038d6070,0x8a4e4fb7),LL(0x11f6a91f,0xdba32df9),LL(0xde169768,0x9117a04b),LL(0x65165458,0x8c5413fb)}},
+},
+/* digit=1 base_pwr=2^7 */
+{
+   {{LL(0xec3affbc,0xeda00fa5),LL(0xa27cf329,0x24baa6dd),LL(0x831fe184,0x4de65a27),LL(0xceacef82,0x45530b36)}, {LL(0x32b46bb1,0xbee2fc9a),LL(0xa1c18ac5,0xa15e982d),LL(0x2cd58757,0x8cdaad29),LL(0x20968b2f,0x7e92c435)}},
+   {{LL(0x9f1074ec,0x4cfcb4bd),LL(0x7c2024c9,0x1835086b),LL(0x4edff79f,0xc31c9d2f),LL(0x8ff606e4,0x2579cef3)}, {LL(0xcc1b198d,0xb48c82ce),LL(0x07e10df3,0x627c2be0),LL(0x49955153,0xe023b6f0),LL(0x42dfcd74,0x1b512c3a)}},
+   {{LL(0x4b9ac0f2,0x03cd769e),LL(0xa244804b,0x0c5815eb),LL(0x2d7f8e0b,0xdf5dcee5),LL(0xcc6af4b4,0xf0393cf5)}, {LL(0x490dff4d,0xb71867a4),LL(0x244f010d,0xb18b8973),LL(0x2ed97d26,0xb16389fc),LL(0xc2a3280f,0x2da87606)}},
+   {{LL(0x4c547dfb,0x0bfe04a8),LL(0x1775f100,0x4aad02f8),LL(0x1d838e77,0x867081c6),LL(0x4713f604,0xec18b94b)}, {LL(0xaa749885,0xe154230e),LL(0xef0dd49e,0x0be67ab5),LL(0x74c34d95,0x7fe38184),LL(0x27763e71,0x331b6e9b)}},
+   {{LL(0xbf0107b0,0xc9eecb94),LL(0x64e146b9,0x1b44f852),LL(0x48920df6,0x2965808e),LL(0x45d320cb,0x5635e0b9)}, {LL(0x791d42bf,0x430c41b5),LL(0xa122243e,0x9f4cc376),LL(0x3ad2b566,0x1b1d1114),LL(0x44446eb0,0x6ce7e261)}},
+   {{LL(0x731bf60b,0xe5cdf281),LL(0x0acfb943,0xe7736e57),LL(0xfc924055,0x961e71aa),LL(0xcdb7af38,0x8b925240)}, {LL(0x370ffeb3,0xde5e8553),LL(0xa011c79e,0xec3404bf),LL(0xd90833f5,0xd87083b4),LL(0xff6b0b65,0xc3d9a1f2)}},
+   {{LL(0x9263a6ea,0xeb38ac2e),LL(0x6c5677d0,0x6e502cc8),LL(0x50de4ca1,0x7a2aa1b4),LL(0xa3f1cee0,0x74d31c1e)}, {LL(0xc609b38d,0x4f3d80b6),LL(0x38768339,0x3e39eb37),LL(0x77d44b75,0xebd917f6),LL(0xf76922d7,0x27ba4019)}},
+   {{LL(0x5bb2a131,0xadb47b9d),LL(0x68ddbbea,0x18668fe1),LL(0x86a0679a,0x9cb9f687),LL(0x4033b7e8,0xc00f5a0f)}, {LL(0xedce153c,0xc215ebe6),LL(0x293549dd,0x4f227ec0),LL(0x94db5f97,0xb6190f90),LL(0x3e4dc133,0xe50530cc)}},
+   {{LL(0x38e1f8f7,0xa4d57d11),LL(0xdaf91af4,0x4ed02858),LL(0x52683499,0x293bd80a),LL(0x0c60a924,0x7d78f019)}, {LL(0xa4b59419,0x2ff94700),LL(0x5fda453f,0x068321ea),LL(0x06b431d3,0xf2f25fa2),LL(0x49410176,0xa19e2745)}},
+   {{LL(0x9825134b,0xe8486f40),LL(0xb3565685,0x29c1817f),LL(0x04327ce7,0x2f5059ff),LL(0x296f9fed,0x78240cc1)}, {LL(0x92b4e0c2,0x40ed9b4c),LL(0xafdd2fc1,0xe4bf2e4c),LL(0x694f5d7c,0x700cdd31),LL(0xf313bb4a,0x44dbc200)}},
+   {{LL(0x307507a4,0xb12d6aef),LL(0x03d6ed01,0x4c4436c1),LL(0x9a67e06f,0x2f54a899),LL(0x6bfe293e,0x33ad29a1)}, {LL(0xd825d2e9,0x5fcace12),LL(0xd4dd9745,0x22fbb81f),LL(0x1d079fa0,0x1704716b),LL(0xfa0a993c,0x2884407e)}},
+   {{LL(0x1e2e0e15,0x0fe439c7),LL(0x52e9093b,0x8bc96487),LL(0xee097557,0x0629be5f),LL(0x8b81090b,0xc272bf6c)}, {LL(0xa661a982,0xce4b3357),LL(0xa42ebead,0x54cd9970),LL(0x6af0d229,0x155d6940),LL(0xcdc01d62,0x7f041ba0)}},
+   {{LL(0xf53bfa67,0xe409f28a),LL(0x6d06229a,0x7873b58b),LL(0x45190c8e,0x887688f4),LL(0xc21fe816,0x2333262d)}, {LL(0x8316f60e,0x4defec9c),LL(0x6ebbc2ea,0x0a808964),LL(0xd7fb7335,0xc21aab7e),LL(0x7cfcac10,0xec46f274)}},
+   {{LL(0xa605868f,0x8535f0e3),LL(0x5fdbec4d,0xe4e8eac1),LL(0x6c51d587,0x6d404563),LL(0x9385abc5,0xf84c0d82)}, {LL(0xb4db1764,0xc8ed7566),LL(0x50dc9c90,0xfe5ee68c),LL(0x3cf20ad3,0x8a43ae93),LL(0x9f57e898,0x97e50af1)}},
+   {{LL(0xde11663d,0x565c1eb9),LL(0xd8def4d2,0xa7257ae4),LL(0xd5762a32,0x4bafcff3),LL(0x96e7d699,0x551f1176)}, {LL(0x210e4896,0xd7b60395),LL(0x788a2860,0x03c7926b),LL(0x9152bf83,0x2decf6f2),LL(0x3ee4a288,0x53e71427)}},
+   {{LL(0x0f9832c2,0x7de2cebd),LL(0xaaadd62f,0x6d395846),LL(0x2b3f4371,0xa908234a),LL(0x24b2b7b7,0xf8c2f190)}, {LL(0x0f9a0344,0x52b72395),LL(0xd7adab7e,0xe11536a3),LL(0x9cbf6ea0,0x22a16502),LL(0x168e68f1,0x22dc4b14)}},
+   {{LL(0xdc82bd6b,0xfbce47e7),LL(0x25a105ee,0x59b6e59a),LL(0x26a16a1e,0x7cfaf276),LL(0xebe8f496,0x92fd2bea)}, {LL(0x35edf42e,0x6d44c1bc),LL(0x3e81964f,0x8985510c),LL(0x63385117,0x29352688),LL(0x5fd8cc08,0x96d836fc)}},
+   {{LL(0xd2977b83,0x55c46a74),LL(0x9d84ad92,0x7da3c9d9),LL(0x6802a6bc,0x87d5ec57),LL(0xf6da5450,0x997ca047)}, {LL(0x88465d09,0xd6422023),LL(0xc883afee,0x50a6c9f9),LL(0xef961766,0x81927b1e),LL(0xdaf862ab,0x42c814cc)}},
+   {{LL(0x022b6bdf,0x36fd30cd),LL(0xd449525b,0xfd349322),LL(0xaddfea20,0xf8cd3b52),LL(0x7b9507b1,0xaf675a6a)}, {LL(0x3ca12242,0x2d3706bc),LL(0x7b7bce1b,0xc93c1874),LL(0x19f7cd2c,0x3fa26bf6),LL(0x10415910,0xe780bdb0)}},
+   {{LL(0xa6175798,0x069900d3),LL(0x14842a70,0x9d02340b),LL(0x3bdbc6d9,0xfd9ade61),LL(0xb3617f76,0xd50e6a99)}, {LL(0x6b88a08d,0xe70f1c75),LL(0xe3a50b73,0x9e0d19cb),LL(0xb8ef976e,0xeb78ee59),LL(0xb9a7e043,0x5d703426)}},
+   {{LL(0xe5e1ddd3,0x964ad215),LL(0xb860be76,0xe1a35485),LL(0x22f4d57f,0x0be40cbf),LL(0x49466e4d,0x4a1ef7a9)}, {LL(0x0fba5076,0xb07356c3),LL(0x83e6f51a,0x74a670a7),LL(0x02f8b52b,0x9d9db2db),LL(0x2f6446ca,0xa7058b3a)}},
+   {{LL(0x3366927a,0x0652cbd3),LL(0x3801b7e2,0xf39ebdc5),LL(0xeddf2543,0x06944ca3),LL(0xa18bf780,0xae53ad45)}, {LL(0x902d2324,0x6831c64d),LL(0x1995eb04,0x2cf7f99e),LL(0xaa308bd0,0x096aabcc),LL(0x782c6188,0x0a945d6f)}},
+   {{LL(0x68a3560b,0x582bc94e),LL(0x0c10b208,0x14dde2f7),LL(0x9ca552a5,0x72551713),LL(0x22edb0ad,0x2ccee3cf)}, {LL(0x6304eb68,0x036dba66),LL(0x33741e82,0x559decf8),LL(0x7565186e,0xb700a98b),LL(0x1e3ac773,0x22657a52)}},
+   {{LL(0x7ab0a263,0xdc772f16),LL(0x8dd11538,0x46f341f6),LL(0x686bd6fc,0x07660582),LL(0x390fc89f,0xddcbd7c1)}, {LL(0x29ba2017,0x634a8d7f),LL(0x6745bf3f,0x198ef17d),LL(0x0347fc10,0x2a475127),LL(0xa7944c7c,0xdd0ac964)}},
+   {{LL(0xca30b577,0x374515af),LL(0xec4cecba,0xac9f9fb6),LL(0x6ea0b6de,0xaabef79c),LL(0x19477bea,0xb2d836fa)}, {LL(0x6e389ffa,0xc08e6ab2),LL(0xfc0b00a5,0x81e94637),LL(0x2f31878f,0xaef4362c),LL(0xd2b57bca,0xabdfa16f)}},
+   {{LL(0xc4a6d040,0x4d1a5a68),LL(0x5490b248,0xe0ba752d),LL(0xe80857f9,0xdd2b2e45),LL(0x61ec3176,0x4c518a1a)}, {LL(0x42d2e8ae,0xded34ca6),LL(0xe40b2886,0x9caa1812),LL(0xb196b0fc,0x491b8586),LL(0x55f1d9f9,0xbc053a12)}},
+   {{LL(0xc84dfe28,0x704e045c),LL(0x311a0c4e,0x21469dfe),LL(0x5f8bf9aa,0x1a4ba19c),LL(0x9a7c7389,0x05866035)}, {LL(0x54b7322e,0x86f4c1ac),LL(0xf233e855,0x1ef4eb04),LL(0x2447e7d0,0x28432f44),LL(0x62409422,0x0446c085)}},
+   {{LL(0xd7899f73,0x3616a439),LL(0xaa208133,0x0ef5cba3),LL(0x332b556a,0x41308bff),LL(0x0feb3c55,0x10af73a6)}, {LL(0x74b55b68,0x296c716e),LL(0x9da31010,0x051c0d41),LL(0xa1e4fa21,0x0fa1656e),LL(0x8f763afe,0xc3a65127)}},
+   {{LL(0x42d79eaa,0xbe625cc4),LL(0x4e4e4178,0xeb847697),LL(0xc1e154a4,0x32c7c0c8),LL(0xc49cafa7,0x20551084)}, {LL(0x96fd2d92,0x5855ab4d),LL(0x5a9b492d,0x945268e9),LL(0xab56dd92,0x82f8aaca),LL(0x3e12e2f6,0xf736001e)}},
+   {{LL(0x8bad8a89,0x0dd071a8),LL(0x0cdf3bee,0x5bb712ce),LL(0x7c350ccf,0xce52ee24),LL(0xfce9ec01,0x53f9baf1)}, {LL(0x0ed8f2e9,0xf8797853),LL(0xa58cb68a,0x3b644d6d),LL(0x6ac9c87c,0x8655babf),LL(0x396d37ab,0x65be63eb)}},
+   {{LL(0x51fe6d49,0x7715de67),LL(0xcd3d9c95,0x2ba58f90),LL(0x03d0648e,0xdf44e4a9),LL(0x60ceefa2,0x702e7bbf)}, {LL(0x355af117,0x6500c6c8),LL(0x9d5a3a71,0xe4aecb0d),LL(0x4c8ea219,0xa4c3fcba),LL(0x6838f60f,0xe088c018)}},
+   {{LL(0xbbc21801,0x116c7687),LL(0x834431ed,0xa001a156),LL(0x4a6e9f8a,0x919bd70b),LL(0x99755bf7,0xa09c0bde)}, {LL(0x7b90f619,0x4714b6ca),LL(0x662644c3,0xfe233422),LL(0xaad44dab,0x9658dc8d),LL(0x89bce3f5,0x14307be4)}},
+   {{LL(0x9c40650b,0x430dda7d),LL(0x17681d05,0x4f4e0647),LL(0xe130ba20,0x67710c2f),LL(0x2856c2e2,0x2d84efae)}, {LL(0x4056fcfd,0x3cfe582a),LL(0x7c883d31,0xb2e3f0d5),LL(0xa8901f6d,0xb82de5e7),LL(0x60cf6fca,0x66dcb605)}},
+   {{LL(0x1d5c23cf,0x4aa1a4ca),LL(0x92395376,0x22647ffa),LL(0x07e72351,0xe28e6a69),LL(0x984aa0a2,0x95e066ca)}, {LL(0xa328ce10,0xaa9a4fd8),LL(0x222e4031,0x02affa4d),LL(0xcf1c69e6,0xcf9543a0),LL(0x08bae4d3,0xbdc71920)}},
+   {{LL(0x8d1b1869,0xb9b92d17),LL(0xa18a5133,0x11a790e8),LL(0x40f45dc7,0x3dda8fe0),LL(0x02243608,0x73ea591d)}, {LL(0x1e368743,0x21a0a324),LL(0x55c5901d,0x53a69748),LL(0x94eaf6c8,0x974f55f2),LL(0xe8edf334,0x120b4b4b)}},
+   {{LL(0xdd026282,0x59feaee7),LL(0xa3af30aa,0x53e81905),LL(0x6b3ae562,0xd6222824),LL(0x187e880f,0x0750909d)}, {LL(0x275240c6,0x8d0e95dd),LL(0xde1ff280,0x3011c291),LL(0x992f4bdf,0x4c397ce9),LL(0xf9550ca5,0x074499bc)}},
+   {{LL(0x5c5184c6,0x6474e073),LL(0x7fa8f2f5,0x8baeba70),LL(0xb019d0ec,0x419fc7b9),LL(0x341a899b,0x953d9880)}, {LL(0xf7591292,0xcc31a675),LL(0xa843b9d3,0x86e08f33),LL(0x227e84da,0x128a197f),LL(0x463ac301,0xd4aae578)}},
+   {{LL(0x73e0ad9a,0x1e004791),LL(0x39e67254,0x36b8b59a),LL(0x12ea6c1d,0x65863848),LL(0x0438f108,0x044b7e87)}, {LL(0xe93075a3,0x1913aace),LL(0x0cdc3d0e,0x43ba698a),LL(0x2cba8331,0x4fd717a3),LL(0xdf24be8d,0xb73b8228)}},
+   {{LL(0xa8d17cdb,0x69bbf4fe),LL(0x093c66cf,0x5e38b8ce),LL(0x8baedc7a,0x3a85d776),LL(0x68de8cc5,0xda710e45)}, {LL(0x1ce81b45,0x4a3dd66b),LL(0xb9cecedb,0xe4f351ac),LL(0x96a6591d,0xfa1909be),LL(0xfc14f400,0xb255ddde)}},
+   {{LL(0x6e1de804,0x12f838ed),LL(0x91447472,0x8ab192a5),LL(0x3221b010,0xfcc20574),LL(0x8042009c,0x652ae267)}, {LL(0x06819f10,0xbd830bf9),LL(0x29fdc18a,0xd43af551),LL(0x6c7e5f2f,0x6dbba7f1),LL(0xc43d7c7d,0xe2057c4f)}},
+   {{LL(0x754f75a9,0x424c6f61),LL(0x8f86d949,0x5b727ad0),LL(0x75a60530,0x6ab718db),LL(0x95b578e5,0xe3f638ef)}, {LL(0x50366117,0x468a1fb5),LL(0x57518be1,0xeec9f41d),LL(0xfadced2d,0x12226acf),LL(0xb87c2e35,0x29c4c2a8)}},
+   {{LL(0x0bec4cd2,0x76003b25),LL(0x4e0e3e2a,0x63c9e66e),LL(0xdc9812eb,0xc565a75a),LL(0xe99e458b,0x3802cb54)}, {LL(0x92205247,0xfcb4c1f0),LL(0x1c94235a,0x68e0f034),LL(0xbf18b619,0x19d5692d),LL(0x8893006f,0xaf86beba)}},
+   {{LL(0x39a3959c,0x0b1e23f0),LL(0x2cf93019,0xd041b717),LL(0x118c230a,0x3627d89c),LL(0x4290067f,0x99ccbace)}, {LL(0x7f022ea5,0x1e32a596),LL(0x44758718,0xe456c9ca),LL(0xdcc125c4,0x9340268b),LL(0x08f8c5d5,0xfdd18887)}},
+   {{LL(0x82ab78e8,0x704962a3),LL(0x99c04424,0x4359c631),LL(0x4a76d201,0xef17c26c),LL(0x57cbbfda,0x5bc4ccd1)}, {LL(0x4e193719,0xf23f379a),LL(0x920886d9,0xcd73aac8),LL(0x879f6ebe,0x7032208f),LL(0xed36981a,0x3f20b56b)}},
+   {{LL(0x81e90e9b,0x69100fe5),LL(0x3ad8b82f,0x45ea34ea),LL(0x97261ea2,0xab14170a),LL(0x71efc069,0x0df97074)}, {LL(0xe7962053,0x24925c41),LL(0x231a1d84,0x8bdb28d8),LL(0x7bfcdeb2,0x05340d5e),LL(0x018c86ce,0x5166278c)}},
+   {{LL(0x0de35d18,0xbcc49199),LL(0x33284cdd,0xae4a71da),LL(0x4df8ddc6,0x0a895450),LL(0xf44fe5f0,0x030b7b81)}, {LL(0x82406122,0x71312960),LL(0x4bfd4001,0xc9a67718),LL(0x2826344d,0xf27b43fa),LL(0xe185d1a5,0x0c12f32c)}},
+   {{LL(0xaa4c9770,0x2e1aaa1f),LL(0xf2cd707a,0x9b7efc86),LL(0x92ec94b4,0x346df70e),LL(0x2da27a0b,0x03171554)}, {LL(0x65cfb3a3,0x217fbfd7),LL(0x2e330bde,0x4f31be47),LL(0x187ca5e6,0x8e571063),LL(0xc11800f2,0x3def006d)}},
+   {{LL(0xaa13a183,0xceacf6b8),LL(0x04e3a648,0xfea13502),LL(0x50034d10,0x8bd1f528),LL(0x40f55d93,0x69e4a0c3)}, {LL(0x75c0eb8c,0xcdef2da1),LL(0x34a3975f,0x246159ba),LL(0x8829ab4b,0x13429b74),LL(0x2f2e5053,0x76c4f2bf)}},
+   {{LL(0x3c90b8e6,0xa70e68ad),LL(0x7c2879e3,0x69a6641a),LL(0x15e9e26a,0xda4af413),LL(0x45610a37,0x81742b75)}, {LL(0xb28a1eec,0xa2948b4a),LL(0xd528c02a,0x73b4118b),LL(0x512222da,0xc8ff718c),LL(0x72f65acc,0xa900eede)}},
+   {{LL(0x9a6d46db,0xd12ae55e),LL(0xf09d0f0a,0x4036aa79),LL(0x0198dc37,0x16c7e6bb),LL(0xd8944d35,0xdf2600a4)}, {LL(0x66d7751b,0xf22af8ef),LL(0x0594c462,0x2d085ae4),LL(0xced7594b,0xa7d2be29),LL(0x52099fb3,0xe8a74d83)}},
+   {{LL(0xe88d534d,0xa4f284be),LL(0x5e1e3e0f,0xa773d622),LL(0x16731ae7,0xeaf949e3),LL(0x49a2b56b,0x219383c3)}, {LL(0x3cff9d57,0x215af273),LL(0xc4669654,0xd76c3080),LL(0xc3d28a6b,0x01219c7a),LL(0xfde6fd3e,0xf44f39b0)}},
+   {{LL(0x0747bd61,0x4d08fa8c),LL(0x4d6a86b0,0x086685ac),LL(0x24132d5b,0xec6e549e),LL(0xc3526909,0x1a6c2e8e)}, {LL(0x4b5f521a,0xaddddcad),LL(0x897b47d4,0x934371d4),LL(0xd34277b7,0x89860b61),LL(0xcdd9c83b,0xb7573111)}},
+   {{LL(0x76c42073,0x34e7119b),LL(0xad4352e0,0x50b83d47),LL(0xb8aa3a7a,0xb921e5f7),LL(0x8fba6b9e,0xcdd20293)}, {LL(0x616c729f,0x197814df),LL(0xcca7cb33,0xc5f6a609),LL(0x9f7b8273,0x876a7746),LL(0xc078c663,0x9378044a)}},
+   {{LL(0x4cda328c,0xc84b6d20),LL(0x6e0392ed,0x3697b513),LL(0xb3f9039a,0xdd7df39d),LL(0xfce33922,0x1a27091b)}, {LL(0x62adba25,0xd448afe6),LL(0xf80334cb,0xd7255daf),LL(0x3bb78b3d,0x89bb65d2),LL(0xa97820eb,0xfe59e7db)}},
+   {{LL(0xccef6ead,0xf5addd96),LL(0xadedee6d,0xae4d4200),LL(0x6cde1597,0xa5fafe57),LL(0xdce98dce,0x9633b525)}, {LL(0xb9fd4b36,0xcd465120),LL(0x8fd44f7e,0xfa5473c8),LL(0x8f8c0f44,0xd7741d1c),LL(0x6b5765aa,0x84211213)}},
+   {{LL(0xc4ae2691,0x1b184d85),LL(0xb0a8a9cf,0x132dbdb0),LL(0xfce576ee,0x7d5789bf),LL(0x12898c50,0x0a077398)}, {LL(0xd4ddbe0a,0x9fdae028),LL(0xfdcb1e2d,0xd1ab29d6),LL(0xa748809b,0x1cfbe8a0),LL(0x32371d99,0x1827ddd9)}},
+   {{LL(0x55ca5644,0x491c7f62),LL(0x79f90944,0xf2dcd763),LL(0xe0adddb4,0xa9951ff5),LL(0xad9ac065,0x25d97a8b)}, {LL(0x25c6dea7,0x31ae8e18),LL(0x28acbbee,0x75b343b0),LL(0x0ae3ea15,0x3b839ed0),LL(0x91b584c1,0x450081da)}},
+   {{LL(0xaef3e5bc,0xf98173d9),LL(0x0e6d057b,0xccec6647),LL(0xa1ba30fd,0x3764471e),LL(0x72a40e45,0xa26c45ba)}, {LL(0x99bb617c,0x88dee002),LL(0x0d9532ac,0x87d75552),LL(0x96861718,0xee2db91d),LL(0xd280dd85,0xb16f4e05)}},
+   {{LL(0x08e307f8,0x2fa86e9d),LL(0x9c664dcb,0xfd75e5c4),LL(0x22cc2393,0x015254d1),LL(0x72cc9fa8,0x0cd9e1c8)}, {LL(0xb8bdffc3,0x569eadcd),LL(0x6ce686bd,0x90811f1f),LL(0x940bac6c,0x398ab749),LL(0x19ac167c,0x355eedcc)}},
+   {{LL(0xda02860c,0x36050df7),LL(0x753af0ec,0x7dd12657),LL(0x84380479,0x153eab05),LL(0x8aa6840b,0xd3e89115)}, {LL(0x36638755,0x742c2b87),LL(0x0bc1c90a,0x1dd292a2),LL(0x9727f19e,0x5c0df8ea),LL(0x744ded77,0x9ad52eca)}},
+   {{LL(0x7b9ee962,0x9889c6c4),LL(0x4a50e8d7,0xe99ad35f),LL(0xaa9569a8,0x92bdf100),LL(0xbf0216ab,0x7fcbf0a6)}, {LL(0x06edcc75,0x38ca1a43),LL(0xfbe7b06c,0x1cfec224),LL(0x2452340f,0xb96fed52),LL(0x2929b7ce,0x169eacea)}},
+   {{LL(0x74c7725c,0xc6d0ef47),LL(0xcc70b035,0xf220d2cc),LL(0x8d7f20c1,0x21fa5407),LL(0xb3aad21b,0x28625c3f)}, {LL(0xbc6be11f,0xd993bee9),LL(0x742d18a1,0xdfb55d8f),LL(0xf14abcbf,0x66a14502),LL(0x7a9b27c4,0xdf711f36)}},
+   {{LL(0x4f02b6ef,0x853080b9),LL(0xe791ee2e,0xe4fea70a),LL(0xc860c2e8,0x685ec3b3),LL(0xfffcae54,0x6b52e566)}, {LL(0x689c5c1c,0xb0517e51),LL(0xb2e2deb1,0x1064dbb1),LL(0x5d22ed57,0x7e400ea3),LL(0xff048b1c,0x43e28faa)}},
+   {{LL(0xb3f0aae1,0x80ffeb19),LL(0xb4b720bd,0xc03325d7),LL(0xbe7b2361,0x663940c4),LL(0xe6f0c5c9,0xc35df455)}, {LL(0x2d3f13e6,0x6ca7dfd9),LL(0xf0a4cc8a,0x980cd80b),LL(0xf991aaed,0x861e5afb),LL(0xb0067652,0x5172f60d)}},
+},
+/* digit=2 base_pwr=2^14 */
+{
+   {{LL(0x6b2ac5d0,0x749f73b0),LL(0x4861c6c0,0x28d32182),LL(0xf89a609f,0x6c39f5e0),LL(0xeda196b0,0xfd624cea)}, {LL(0x37a47e15,0x875485b0),LL(0x629f2067,0x324cd765),LL(0x37aae611,0x3ab968eb),LL(0xd09ae889,0x6c2e7ce8)}},
+   {{LL(0xa6757d7a,0x6b260bbf),LL(0x1930d6a4,0x993ff46b),LL(0xb3e5216e,0xc8e8a1ed),LL(0x41ee668c,0x00d4c6a6)}, {LL(0xae8088d8,0x273938fa),LL(0xa4b5047f,0x68b15374),LL(0x874d8d54,0xfe18ecda),LL(0x04862d3e,0x508f9f78)}},
+   {{LL(0x6f804ea7,0xd66c5460),LL(0xa5af01f0,0xbe3f93ed),LL(0x2b55e53b,0x6fca63ef),LL(0x8b33de78,0xaa6b856f)}, {LL(0x632b0a94,0x0fa28a94),LL(0x5a2781fc,0xb15698c0),LL(0xf2686609,0x4a4c2248),LL(0x6a385ee7,0x291fd2c9)}},
+   {{LL(0xc233e953,0x472e3968),LL(0xfc87d728,0x1c45ee21),LL(0x7afd029c,0xb3e4b0ac),LL(0x30aecdac,0x48a5c6c2)}, {LL(0x5de465f9,0x43b7f34f),LL(0x4bc742b0,0x21a5ec7a),LL(0x2ceb7a9b,0x1f22f938),LL(0x08a0867e,0xa0ae9d22)}},
+   {{LL(0xe1aed20a,0x9bf22642),LL(0xa78d09c3,0xa05af1b3),LL(0x69ce3585,0x5a1cbcf7),LL(0x6c343b86,0x8986bf1e)}, {LL(0x663ac83d,0xabe3bd14),LL(0x2ebe732a,0xb3fc860a),LL(0xacf32546,0xa9052c5c),LL(0x566c83ef,0x8af967f9)}},
+   {{LL(0x55f75158,0x33ff1d41),LL(0x7aba8eb8,0x3df9a900),LL(0x54f64558,0x15b2f388),LL(0xa57a5ef2,0xafa61c43)}, {LL(0x3f6ed7cc,0x74c499e7),LL(0x0067e3f9,0xd4cfbdd0),LL(0x1d6f58e6,0xe5363b70),LL(0x26b246a8,0x748e72eb)}},
+   {{LL(0xfcfdeffe,0x9b524ded),LL(0xcfcb16b3,0x6f6f01d0),LL(0x82ac70d4,0xffe4b99b),LL(0x15b893d7,0x416cd050)}, {LL(0xcfe17930,0xcb7d6b48),LL(0x1fa2e915,0xc195b874),LL(0x36e6e1e5,0x76b6fe15),LL(0x181039fd,0xec2a9629)}},
+   {{LL(0x8477c0ea,0x1d910ba6),LL(0xb63549ad,0xa39fa521),LL(0x0598761b,0x097ddc65),LL(0x1fd6a297,0x62eb1f6c)}, {LL(0x0cf8b987,0x8a2ea43e),LL(0x86090af1,0xc6b0f39b),LL(0x3ff90728,0x4d8e8d73),LL(0x76e99c7a,0x6295e1cf)}},
+   {{LL(0xf340069e,0xc9e68949),LL(0xd0dab7c6,0xd9be3a01),LL(0x3a5406a2,0x23fc5e75),LL(0x60f5218c,0x2896053f)}, {LL(0x94b21825,0x1d056600),LL(0xd50e3588,0x4ce574c3),LL(0x2a867eaf,0x44028457),LL(0x719fcc1e,0x81cb1315)}},
+   {{LL(0x32817369,0x9fa8ad3a),LL(0x92aafece,0x12282da5),LL(0x05c7c1b4,0x20837741),LL(0x6dd37c24,0xbdb3a49a)}, {LL(0x1b74756b,0x4789c2cd),LL(0x770c6ae5,0x9fd04987),LL(0xc7a9605b,0x3c702703),LL(0x1a171672,0x1be083e0)}},
+   {{LL(0xad6e27ea,0x74f11224),LL(0x1cf8a83b,0x75a3a516),LL(0x18692387,0xcce57f12),LL(0x5ffdbbac,0x230c4d66)}, {LL(0x152a9fdc,0x391b56c1),LL(0xddbba4db,0x80549b55),LL(0xd52ae804,0xa759badc),LL(0x7b08d7ab,0xd6e3f0e4)}},
+   {{LL(0x81551783,0x8134a9bb),LL(0x588330c0,0x416d384f),LL(0x637f2c44,0x94876f60),LL(0x3e297d5a,0xd0bc50d2)}, {LL(0x46755d74,0xb0c308c8),LL(0xb95404bd,0xb9d36414),LL(0xdc18beb9,0xfe21d7cf),LL(0x02e57fc2,0xfee4f74a)}},
+   {{LL(0x32b376a3,0x373dbbfd),LL(0x0bfdcc48,0xf0a2c99c),LL(0x20e28b79,0xe82790f2),LL(0x7e455540,0x2f9f3156)}, {LL(0x5bfa3054,0x4f1e0cec),LL(0xa767031e,0x1c63377a),LL(0x0e6a9da0,0x8ce630f4),LL(0x11b6d46f,0x11383665)}},
+   {{LL(0xe19511d9,0x5f25351d),LL(0xeb8db2db,0xe35b7a9f),LL(0xb843b11d,0xcbded280),LL(0xab5f854b,0xf1f1aa37)}, {LL(0x87e95386,0x80dcc6a8),LL(0xfb52591e,0x30a76312),LL(0x888da08a,0xcd8c457e),LL(0x2b04f3f4,0xbe75c4b4)}},
+   {{LL(0x43c6dd9b,0x705c748f),LL(0x05d4cf70,0x51709464),LL(0x70e18f05,0xcfa2a8c0),LL(0xdf9dcaf5,0x040cb5cb)}, {LL(0x2ab6584d,0x1b99f226),LL(0x32bfbb35,0x06646d29),LL(0xd19c9b69,0x070e13b9),LL(0x86ede80f,0x4b483b48)}},
+   {{LL(0xadd553da,0x4198dc4f),LL(0xb709812c,0xb2573c15),LL(0xd467dd29,0x45eef966),LL(0x23315592,0xbde3321a)}, {LL(0x557d2333,0x57f5392e),LL(0xa05e9a82,0x9615d43e),LL(0x97e16953,0xa647d9ca),LL(0xa9add060,0xbbd3daf8)}},
+   {{LL(0xf178f54b,0x64c32334),LL(0xc27e5fcc,0xd6dead2b),LL(0x91a48cdd,0xe7e0791d),LL(0xf52c2966,0x7bc72766)}, {LL(0x06505e8a,0x5ab241b3),LL(0x4756b353,0x4de96c8f),LL(0x31926f7a,0xd5a4c984),LL(0xb9ad792f,0x03598d40)}},
+   {{LL(0x5e898a4c,0x102972f5),LL(0x6074f592,0x26724176),LL(0xfd5c7a7b,0xbbf1f2ae),LL(0xe2965ade,0xa72711e5)}, {LL(0x0c390b5f,0xa9c3d2ee),LL(0xadbf8e2f,0xd9673359),LL(0x75dd9720,0x0a8ca6d1),LL(0x134ea530,0xe958bff9)}},
+   {{LL(0xb238a3ef,0x807dfe95),LL(0x34fd2df1,0x1fddc0e9),LL(0xf27e4245,0x5407420c),LL(0x6fca95d1,0x61e57b84)}, {LL(0xd578b57e,0xa8fe5c0e),LL(0xf2ff43e5,0xabff1245),LL(0x4ae9bae3,0xe82aeccd),LL(0xab708df9,0xd3df6124)}},
+   {{LL(0x5b298d61,0x978b5385),LL(0x10acbfde,0x7cd10a2a),LL(0x328d5f02,0xe225eb45),LL(0x17114557,0x09fa229a)}, {LL(0xc753e8be,0x1ee45919),LL(0x18337823,0x6cf85045),LL(0x6da4b3cd,0xb63b8bfa),LL(0x46dd396b,0x0e08994c)}},
+   {{LL(0x20f0cc41,0x07c2c32f),LL(0x50949bf2,0x9391e58d),LL(0x60a79b69,0x9d2b9100),LL(0xe3700e66,0x5979a26d)}, {LL(0x9c8400c1,0x1ed1420b),LL(0xf5611db7,0x5258ab65),LL(0xb1390b64,0xe94fec65),LL(0x5baf632f,0x4b0abfa0)}},
+   {{LL(0x7a767a68,0x803b68f3),LL(0x3e9accfb,0x6fdeb915),LL(0xa2f4047e,0x2dfe65df),LL(0x1131156c,0x9b487df5)}, {LL(0xe7a3b1b4,0xcf022697),LL(0x5adccc21,0x042ab278),LL(0xc10725b5,0x74cb74d0),LL(0x4283a96b,0x07d68dca)}},
+   {{LL(0x9472947f,0xed5c6dc2),LL(0x1805c550,0x3915561b),LL(0x2e7fc2ec,0xd82df47a),LL(0xb046a162,0x301d4791)}, {LL(0xd24a28c0,0x31e319ad),LL(0x9074f3b8,0xf08c5118),LL(0x0a21e2a5,0x0a544482),LL(0x018d50a7,0xd7caaca4)}},
+   {{LL(0x056d818d,0x6d4aeea4),LL(0x29e743c1,0xda936f45),LL(0x3a3b0275,0x6ad0fce1),LL(0x29b4e7da,0x2253dc63)}, {LL(0x22c8e826,0xc4d53016),LL(0x865f6313,0x569c4620),LL(0xc5e341d9,0x6e4f8d02),LL(0xf14f776d,0x8170c527)}},
+   {{LL(0xfdf44b7e,0xcc612e66),LL(0x34e3cd9b,0x76f67cae),LL(0x3884dd91,0xe7bb08e3),LL(0x454a4d2e,0x7b78bbce)}, {LL(0xeb2605d2,0x40bf52b9),LL(0x5e3a452a,0x5749e106),LL(0x5f316f12,0xebfcaba2),LL(0x5300826f,0xdc7b0ec7)}},
+   {{LL(0x540b9c10,0x8d83aa5a),LL(0x328d4f03,0xdd8dee91),LL(0x8013d638,0x50c46ece),LL(0x41611475,0x237a3ad7)}, {LL(0x04392de4,0x9bd42f4c),LL(0x08010c9e,0x13028275),LL(0x335e6b02,0xb7ed5b7d),LL(0xa8502edd,0x8109fbe7)}},
+   {{LL(0x903042e7,0xed0b286b),LL(0xc51a21b6,0x56585ccb),LL(0x53d71653,0xd9d1eb74),LL(0x41ea5fbb,0x2db7d8b3)}, {LL(0xcaad67d0,0x984e0a55),LL(0xf637a22d,0x9a74b1bd),LL(0xd8b11d67,0x95fe5c0c),LL(0x399defea,0x6a442538)}},
+   {{LL(0x89b86cac,0x7f7dcb29),LL(0xcf34fe91,0x26856130),LL(0xd82cb82c,0x22065842),LL(0xb4adceb6,0x71992d80)}, {LL(0xf9d88870,0xfece4806),LL(0x3e7065a8,0x7a0a1c35),LL(0x1f77bc2a,0x51331847),LL(0x5e8ab62f,0xdb49c8ea)}},
+   {{LL(0x5db3bbdc,0x327e8803),LL(0x09934091,0xf60d398e),LL(0x599812ba,0xbdae732e),LL(0x13c4d5f0,0xbd9faa90)}, {LL(0x059097d0,0x985d5ca0),LL(0x84fd8255,0x52acc010),LL(0x3e3f3b38,0x0183f0ea),LL(0xe61502b1,0xca365027)}},
+   {{LL(0x423ded94,0x1cf44436),LL(0x15456403,0x38b89496),LL(0xce3e25b9,0x33d7eacc),LL(0x913f2fd8,0x9b0a53ce)}, {LL(0x9e6e8b26,0x5ad0c128),LL(0x8aa91d34,0x170da902),LL(0x92381e3e,0x155ccaa8),LL(0xfd0d538f,0x246e5f89)}},
+   {{LL(0x8302889c,0x843be034),LL(0xa9767e9a,0xba0054ab),LL(0x2f151e1b,0xc4212825),LL(0x772a6d9c,0x54edc4ee)}, {LL(0xc25bcbc2,0x2858dc08),LL(0x80f284a2,0x395c0b07),LL(0xf7d65019,0x959f109e),LL(0x951d7ab4,0x251cbf24)}},
+   {{LL(0xfaa8508d,0x95cdc2c6),LL(0xddc4127d,0x46e632eb),LL(0x1840794d,0xb3f1ca5e),LL(0xc579b1bd,0x0cc561e9)}, {LL(0x867f4afa,0xca6f7ed0),LL(0x4f4631f6,0x70d10628),LL(0x1b63f977,0x13a5eeac),LL(0x0ec7c8ff,0xa74227aa)}},
+   {{LL(0x7a7c8a38,0x637d521d),LL(0x02ad1a05,0xbc1314a8),LL(0xfb37b84b,0x5d66f468),LL(0xb6df2d71,0xc4f63bf6)}, {LL(0xd3943f84,0xd2aa38e0),LL(0xfd82bd0d,0x9d27ce6a),LL(0x47b76c9e,0x31771098),LL(0x1f5d5157,0xdf0d3cf3)}},
+   {{LL(0x6a63ff89,0x7193e7f9),LL(0x333ea7c4,0x9924f426),LL(0x4c57d865,0x04b34898),LL(0xf1c10c7d,0x1715bdcb)}, {LL(0x4ce42a20,0x32dfb0ab),LL(0x211db5d5,0xf0798e99),LL(0x4aa4080b,0xbf392425),LL(0x8229972d,0xd899a929)}},
+   {{LL(0x2d26f5d7,0xf9cc93be),LL(0x199bce65,0x3d593b03),LL(0x99215875,0x18dc1ba2),LL(0x7e322107,0xfa582c56)}, {LL(0xedc2090e,0x16a8a032),LL(0xbd732fad,0x2dd65450),LL(0x9ff4800f,0x7fc44f21),LL(0xc0f6c745,0x15f97798)}},
+   {{LL(0x2eb67a1a,0x1f1783c8),LL(0x1eecd75d,0x1654f8c8),LL(0xe21a0157,0x53c71934),LL(0xd7dfb719,0xefaabf6b)}, {LL(0xd8c18a37,0xfaca5796),LL(0xe104c284,0x80638fb7),LL(0xaf950e1b,0x58fe6abe),LL(0xe4f9cde5,0x1f7c81c6)}},
+   {{LL(0xa7a669a9,0xa835eddb),LL(0x72216433,0x35693521),LL(0xae2abcef,0xa3bf6508),LL(0xa65759b3,0x45a0a3b6)}, {LL(0xa51b1a9e,0x33727c85),LL(0x7179d6f9,0x759bf005),LL(0xe1f89a5b,0x4015df11),LL(0x7e7adfcd,0x7a498830)}},
+   {{LL(0xeb5e11d0,0xb4f1661f),LL(0xcec2ae2d,0x1535239b),LL(0x64120d76,0xb983a14e),LL(0xca85f1e0,0x177b18a6)}, {LL(0x345d08a2,0xb8e03158),LL(0x22db5288,0x84e7ec66),LL(0xb0e21118,0xca602f8c),LL(0x69ab856c,0x23d6237e)}},
+   {{LL(0xde17b900,0xd769758f),LL(0xe6f1bf53,0x939584a9),LL(0xd463d0d8,0xb6f55b68),LL(0x48e335c9,0xd5ed2df5)}, {LL(0x4752fd0d,0xa5447a30),LL(0xf73b5429,0xcab9a883),LL(0x1ab30760,0x60ac08aa),LL(0xdc066a7a,0xbc63917a)}},
+   {{LL(0x8ce0bfb5,0xa342fe05),LL(0xbf70983b,0x2ab3f0b2),LL(0xa39e1b63,0xadebf0bb),LL(0x830c314d,0x181f848b)}, {LL(0xbe52acc2,0x69befa44),LL(0x279c5209,0x663630b4),LL(0x55964574,0x4d629adb),LL(0x125986d6,0xed2284b7)}},
+   {{LL(0xf237bca8,0x395e4af1),LL(0x544e3959,0xb44f1aa5),LL(0x10ce18f4,0x0d949bc7),LL(0x1b4ab488,0xa6a7e2d4)}, {LL(0x42c57e15,0xff323bfb),LL(0xdfbd0152,0x751566cc),LL(0xd4db3cf3,0x763d9e92),LL(0xd3f158c8,0x84a8c241)}},
+   {{LL(0x3e52b17e,0x5b970273),LL(0x23a95f2d,0x9ba71f54),LL(0xe68305d2,0x06a684ab),LL(0x982371a1,0xc46c0ee7)}, {LL(0x9940382f,0xb5e7d0e8),LL(0x67f364ab,0x50add0f1),LL(0x7ea88c60,0x6eb3a4f5),LL(0x21caa0c9,0x5af5ce4c)}},
+   {{LL(0x6a39da42,0x6e20cb7e),LL(0x2d081b33,0x0b7be9bf),LL(0x3f96cfa4,0x3ce8e671),LL(0x2b67e250,0xd1f7c3a0)}, {LL(0xba6e20c0,0xdd710fdf),LL(0xbf151c3c,0xdb94ca25),LL(0x737fb7e2,0xb1076907),LL(0xb8d598a0,0xf37f25c3)}},
+   {{LL(0xc4365e3f,0x536f3593),LL(0xa24aa8b0,0x230ecb18),LL(0x732d6b28,0xf3eda832),LL(0x5000a3b5,0xc4a2f4ac)}, {LL(0x1349ff18,0xe4a33d97),LL(0x721e411c,0x5bf1614f),LL(0xca5a0557,0x4c50900c),LL(0x4142afb9,0x755ee1e1)}},
+   {{LL(0xc6905eb9,0x5bab573f),LL(0x83716022,0x49ffb2aa),LL(0x4fccbac6,0x95f0e7b8),LL(0x06834991,0xf1cc08ad)}, {LL(0x3714f268,0x6e54f4f0),LL(0x6172fe5e,0xa547b85f),LL(0x12ebe563,0xc98970c5),LL(0x6f19f266,0x9add18ce)}},
+   {{LL(0x73a7cc17,0x92f7d52e),LL(0x40bcc2b3,0xeb808779),LL(0x57d5db3c,0x7e8d6800),LL(0xe0131371,0xcaea7c8a)}, {LL(0x5a3bc20b,0x19605024),LL(0xb0bee3e4,0xf0c08508),LL(0xfb5897b3,0x9fc0fdcd),LL(0x1b58907d,0x37fd6c68)}},
+   {{LL(0x90f0a1aa,0xce081981),LL(0xcceacaea,0x09fa19c7),LL(0xa0ce7785,0xfa263128),LL(0xebec615d,0x863809fa)}, {LL(0xb39ef466,0x5f755a0f),LL(0x1bc2b8e4,0xee2374e7),LL(0x555d2d90,0x177fafb2),LL(0xf4f525bc,0x41e4f1a0)}},
+   {{LL(0x826b934e,0x45a7dabb),LL(0x121b67c1,0xa8e60675),LL(0x106259d9,0xcca72e57),LL(0x616241ab,0x095f6686)}, {LL(0x88994f90,0x82d27999),LL(0x669146fc,0xfd24b80d),LL(0xbc792ff6,0x2aea5542),LL(0xe2332d15,0xd436ea2e)}},
+   {{LL(0xbe9fb1d6,0x4e70e06e),LL(0x79e88b4b,0x8d5b7aa5),LL(0xa6fc1ecc,0x1b9dea99),LL(0x4c321497,0xc7f1920d)}, {LL(0x95990aa7,0x5eeb59ad),LL(0xd6d3a189,0xbd867a9c),LL(0x856f6ba8,0xa8b0f99b),LL(0xd17569f4,0x364e5841)}},
+   {{LL(0x77891293,0x64b7dc30),LL(0x39743f01,0x68dfb0d6),LL(0x84850d39,0xc958dfb2),LL(0x74f2864e,0x5ae263ab)}, {LL(0x605858b6,0x284de4c5),LL(0x066ef771,0x0b4def7d),LL(0x61f5cb5d,0x5c53ff9c),LL(0xa482ed48,0x6eada127)}},
+   {{LL(0x8c0cad0c,0xb111bf1f),LL(0x8ca03d47,0xfb6e2a70),LL(0x32b2b44c,0x77854bc9),LL(0x9f8bd186,0x5e1f3ec1)}, {LL(0x36d72f5e,0xea120fb9),LL(0xa0d68e61,0x39e3b4f9),LL(0x02a2d2cc,0x1fcc0ca4),LL(0xd94a92d3,0xf1c6e740)}},
+   {{LL(0x666575d9,0xe212c702),LL(0xa61d79e5,0x63b9c02f),LL(0x7b568f9c,0xb5b7b513),LL(0xe4e3c92b,0x33ddced3)}, {LL(0xdc608186,0x69827e76),LL(0xdfcd0d03,0x41c04a50),LL(0xb054605e,0x878c0cdc),LL(0xa0551aac,0x20ac8958)}},
+   {{LL(0xaadacfa0,0x3745eee9),LL(0xeefb7c7e,0x59ce920a),LL(0xc7a7a599,0x449f52ba),LL(0x69197886,0xef3f3640)}, {LL(0x2c8a905e,0xc1759dbe),LL(0xc9ab4a91,0xb7b3614f),LL(0x71cbfa4f,0x88839fc2),LL(0x233d5e96,0x1d2b3f9f)}},
+   {{LL(0xdcdc74f9,0xa5144b93),LL(0x53cc9c08,0x254b53ba),LL(0x8506ecb4,0x5aa96c1c),LL(0xebeb4f48,0x61bd02fd)}, {LL(0x7bfb9b41,0xbef88d00),LL(0xdf40783a,0x3af34221),LL(0x0be50698,0x4fef8128),LL(0x1f476b34,0xa4981111)}},
+   {{LL(0xc40a041e,0x25f703c5),LL(0xdd197fbd,0x06f8bb2c),LL(0x795a2acb,0x8ec52bce),LL(0x5e88b626,0x28d19733)}, {LL(0xe1f0bf8b,0x6c299871),LL(0x2a975964,0x9646ce91),LL(0x7ea5cbe7,0xec7d24b7),LL(0x85f6ce2d,0x601a2437)}},
+   {{LL(0xee742774,0xcc0cbeb2),LL(0x25b12e2b,0xb1d00686),LL(0x70620919,0x3f21afda),LL(0x7a1f5fdb,0x3b63172b)}, {LL(0x05230bbd,0x1d0e802b),LL(0x56e0af8b,0xc963d68b),LL(0xa4550a4f,0x911ae793),LL(0x02c2ac0c,0xee3817f5)}},
+   {{LL(0x65424c4e,0xa840b705),LL(0xa6594511,0xb3c68f2d),LL(0x0b5dfec0,0x9a742d1e),LL(0xbfd2f24b,0xf3c88a31)}, {LL(0xac6326d3,0x79142be1),LL(0xedb583ab,0x179da138),LL(0xd43da906,0x13a95f60),LL(0x3fb752f4,0x97bea79c)}},
+   {{LL(0x838722db,0x14e6ddc6),LL(0x15a99d5b,0x8f48debc),LL(0x8e2c39f4,0xbc866795),LL(0xa566125e,0x287f9056)}, {LL(0x1a41d7e2,0x62b157b6),LL(0xf81bcb7d,0x647ba46c),LL(0xe0c96822,0x6653015e),LL(0xb0de78a3,0x87feeb06)}},
+   {{LL(0x14f82d71,0x4e426c99),LL(0x83ab1332,0x98368559),LL(0xbce3d930,0x49f44f2d),LL(0xa66efd21,0x66ae63b4)}, {LL(0x8b3d7d1c,0xb6d49087),LL(0xe31eb1d6,0x17f8bc42),LL(0xb2faad84,0x07b58a22),LL(0x8f200e5f,0x90a65562)}},
+   {{LL(0x63b01c33,0xdd8ccd69),LL(0x56f9f077,0xd5d0241f),LL(0xd59daffa,0xdb1f6b5a),LL(0xa24893e8,0x847fdd74)}, {LL(0x78ebb3ca,0x1703e8d3),LL(0x42365233,0x0cc8e4f1),LL(0x6845a28b,0xa9e74aab),LL(0xbec4023e,0xb36433ed)}},
+   {{LL(0xf85c1f81,0x3dea877e),LL(0x3500e331,0x99b9f34b),LL(0x7068c2a0,0x13d79142),LL(0x90318544,0x7daf399d)}, {LL(0xacd5fe40,0xdee5d7ee),LL(0x1fa99619,0xeb8fc28f),LL(0x61ffaa07,0x89380f6b),LL(0x9ca560a7,0xb960b355)}},
+   {{LL(0x21af1af4,0x5b656e0e),LL(0xb101b716,0x870734df),LL(0xf16280b0,0xff077554),LL(0xadfeee03,0x037db788)}, {LL(0x52fe05c4,0x363a4e45),LL(0x2b6a54d8,0x3806fd81),LL(0xf5483d7e,0xb57ef91c),LL(0x84f34bb6,0x0b08611b)}},
+   {{LL(0xc135516a,0xf5971dda),LL(0x21248e54,0xc98efdf5),LL(0x57a3a4f1,0x93c7baba),LL(0xe5ef6bb6,0x01ba2902)}, {LL(0x2002d595,0x78bfc4b1),LL(0xa14815d6,0xc9c63ae6),LL(0xbdc8993b,0x6ce805e6),LL(0xa41bc54a,0x1beb407c)}},
+   {{LL(0x72ed7345,0xd53d5d04),LL(0x39515ff5,0xbcff12d4),LL(0xb3b5828c,0x7a4d9d08),LL(0x1bac7deb,0xf899a71b)}, {LL(0xba436c62,0x6137eef2),LL(0x5e7f89ab,0x0d85465e),LL(0xf6d34352,0x1ed24e35),LL(0xc1601124,0x6737dbe3)}},
+},
+/* digit=3 base_pwr=2^21 */
+{
+   {{LL(0xeb09f91b,0xd063ff04),LL(0xa7c4e3d6,0x1fdccac2),LL(0xa01dd4b0,0x70c880ea),LL(0xfede8ed9,0x8d6116f0)}, {LL(0xa0ac9df8,0x4f9b552c),LL(0xa609996d,0x4c40f2a9),LL(0xa732a8bf,0x34e1c988),LL(0xc1dad6a6,0xe3bf0f02)}},
+   {{LL(0x6d86153c,0xd0c2419f),LL(0xb707ee22,0x231930a8),LL(0x73b0e729,0x4bd3094f),LL(0xdd2d59c1,0x6598e204)}, {LL(0x9d72d2d3,0x3fc65a23),LL(0x28f01f75,0xd5d98254),LL(0xfe361ea7,0x57c84a68),LL(0xc8340d90,0xbfae09c8)}},
+   {{LL(0x4d510690,0x8484bd22),LL(0xed07d3e9,0x7e9df071),LL(0xe46df4e5,0xee65b114),LL(0x612542cb,0xd0a82236)}, {LL(0x1c024c5e,0xe0c848c2),LL(0xdf509289,0xf781cd2f),LL(0x2f137399,0x6da51406),LL(0x7042ee56,0xa62e8b00)}},
+   {{LL(0xff02af5f,0x078f84b0),LL(0x0f98986b,0x1cc32b8e),LL(0xa4748fbd,0x37122fcd),LL(0x8b822a9a,0x5284c624)}, {LL(0x51bb2de8,0x4477515f),LL(0x57450169,0x768b4d38),LL(0x8ea94210,0x9f1b455c),LL(0x25acf4eb,0xe1e3dfab)}},
+   {{LL(0xa0e48c92,0xde3e3f25),LL(0x9a9fb7a4,0xca9d2fbe),LL(0xe27e7e74,0x90adca97),LL(0x150140af,0xfaf15167)}, {LL(0x368a1127,0xcdfe168e),LL(0x750a1d24,0x9388282d),LL(0x5eabec7f,0x1c4699c2),LL(0xe2c684ea,0x25b2ba8e)}},
+   {{LL(0x8666b5a2,0x621e4360),LL(0x0a5661a1,0xd2739593),LL(0x743c82a5,0x31c1edba),LL(0x270b8b80,0x0fdde662)}, {LL(0x6a464324,0x1b206e3b),LL(0xb1faf7bb,0xd1000e09),LL(0x1a253721,0x614b449f),LL(0x3f5944a8,0x81c3c9fe)}},
+   {{LL(0x5af87971,0x7314e062),LL(0x003f5706,0xea6b992d),LL(0xeb1336bc,0xb8fd1401),LL(0x01344a4d,0xdd02dd83)}, {LL(0x4777a0a0,0xc4f77453),LL(0x1fa473dd,0xb4a9da24),LL(0xee9e619f,0x0736f80d),LL(0x09e1ae0e,0x2a68896e)}},
+   {{LL(0xae61cf74,0xf1f30e53),LL(0x31948505,0x11088227),LL(0xdffb9e31,0x172e66b4),LL(0xa70bfc59,0xdf9ff060)}, {LL(0x987f9994,0x4e514b1e),LL(0xb7bcb26d,0xae3d6b90),LL(0x1faa21c5,0xffbd8d2b),LL(0xb42b5e11,0x46508fb2)}},
+   {{LL(0x31b46c78,0x598d8eb9),LL(0x90b5b69c,0x368a2d9a),LL(0x4fbfffa9,0x423725a4),LL(0x91d37b5c,0xcfa3b902)}, {LL(0x5d65eddf,0x24688f03),LL(0x351e436a,0x1d794a7e),LL(0x703261dc,0xd03253a5),LL(0x07665471,0x1e26a406)}},
+   {{LL(0xc307a60c,0xd80110b1),LL(0x1ddf3095,0x40f30868),LL(0x67416b0e,0xbc17c4e0),LL(0xf4e2f553,0xe599db59)}, {LL(0xfe800b43,0x2ca038c7),LL(0x6f87d417,0x4aefeb93),LL(0x8041cbc0,0xe91eefde),LL(0xc6dd70d4,0xa1c815ad)}},
+   {{LL(0x5cd98dc0,0x0964e9a4),LL(0x2c91cc65,0x71dc1727),LL(0xe0d3055a,0xea278ccf),LL(0x500f108c,0x786e3122)}, {LL(0x2961e19c,0x73630392),LL(0x889a133a,0x0930eb44),LL(0x723037a2,0x97f4d2a9),LL(0x7bee292a,0x8b5420ee)}},
+   {{LL(0x0b827b1a,0x0e627644),LL(0x6d3d49cc,0x8b96b563),LL(0x62bcae62,0x886a4aad),LL(0xe1de8446,0x20111176)}, {LL(0xaaeb6af2,0x64a27703),LL(0x2edbcf9f,0x095b7095),LL(0xbfd6c07f,0x7c25b3c7),LL(0xeaf970e7,0x70e9825c)}},
+   {{LL(0xd434590c,0xaf5304af),LL(0x1599f441,0x6e7b00fe),LL(0x3dd65ac0,0x31bf780c),LL(0x17357f4d,0x2072163b)}, {LL(0xa08c663b,0x1cd1365b),LL(0xf3531994,0xa883f7ae),LL(0x0c543811,0x23ff250a),LL(0x0f39066c,0x55d24711)}},
+   {{LL(0x9871bab5,0x3b896e29),LL(0xa2a8ef04,0x02f1e023),LL(0x16398d80,0xeb2def83),LL(0x8e0ea7cc,0xe52041c1)}, {LL(0xa43d66e1,0x24d1d43b),LL(0xe6112160,0x17427a87),LL(0xf3643a8a,0x24a82ed3),LL(0xd3e5fbc2,0xd34d8398)}},
+   {{LL(0xa6ed1e93,0x4c12145c),LL(0xab74c4d4,0x403865cd),LL(0x1b13475d,0xb96689de),LL(0x7f8e893d,0x81eb607e)}, {LL(0x64f384e1,0xeb2dbffc),LL(0x015cef0b,0x20432be1),LL(0xb103fa38,0x668bd04a),LL(0xb75cb8fd,0x6f056e07)}},
+   {{LL(0xc8fdb1ca,0xdac9fedf),LL(0x1c023806,0x4e2372d7),LL(0xed781195,0xb6209e17),LL(0xbe645868,0xdd19cbb4)}, {LL(0x2367ec3e,0xd00d02b2),LL(0x20f5184e,0x1f153802),LL(0x5fe86666,0xd08bdaa1),LL(0xdb261a6c,0xa0aa7d33)}},
+   {{LL(0x69d509aa,0x7b3101e5),LL(0x9378c2e1,0xf2603db8),LL(0x7b7b5332,0x8881fe6a),LL(0x343298e4,0x0f856514)}, {LL(0x377b69b8,0x43669de1),LL(0xd438ac33,0x1e2f6143),LL(0x2c985994,0x2f08c854),LL(0x98455721,0xbf3811f8)}},
+   {{LL(0x60615975,0x744cb5ce),LL(0x61b3db19,0xbc4cbd0b),LL(0x9a888195,0x06f3aff1),LL(0x4af86645,0x8f9089cf)}, {LL(0x417712ff,0xe6116932),LL(0x331c383b,0x363626b0),LL(0x1bf1c603,0x9b8403ef),LL(0x68778d27,0x71ca59fb)}},
+   {{LL(0x6d40b68e,0x37d9d3ef),LL(0x254b4048,0xb0e42fe9),LL(0x48909fc8,0xc494e592),LL(0x89e916be,0xbf486cb9)}, {LL(0x74dcdc4e,0x6b044328),LL(0xca544597,0x118c2819),LL(0x1397db58,0xbae926a9),LL(0x2858b8d8,0x832445b4)}},
+   {{LL(0x236c9a35,0x1cef82b0),LL(0xdc2766fc,0xd8a61b9a),LL(0x6878f8e4,0x854e8745),LL(0xb9acdcd1,0x87e44548)}, {LL(0xc5671a30,0xea61ba6d),LL(0x7993d959,0x42aef413),LL(0x487ff493,0xbbd89cd4),LL(0x0b3c606a,0x9f55b9bd)}},
+   {{LL(0x2cfb1720,0xc32daa5e),LL(0x5a458dcd,0xdfb3a25d),LL(0xddafdbca,0x06054ef4),LL(0x20cf833b,0x724f38a9)}, {LL(0x84225e8a,0x0ab99fe0),LL(0x44a9a017,0x258a01b2),LL(0x2d854ea9,0x24f7732e),LL(0x1ea3bd81,0x567d8bdf)}},
+   {{LL(0x8655f3a6,0x81ae0fea),LL(0xed62a49e,0xf431d5bc),LL(0xf96ec825,0x65fa4121),LL(0x82ccb08d,0xa6c86698)}, {LL(0xbfdb58aa,0x2d8178b6),LL(0x5a4282d1,0xf7eb36b9),LL(0xe0e82c0c,0x9afe8cb9),LL(0x06fd8459,0x3fa015b3)}},
+   {{LL(0xf3fb3faf,0x65a88f08),LL(0x82a6b942,0x4b22e781),LL(0xfbc78e70,0xe8eaa7f0),LL(0x29f84762,0x0e17caf6)}, {LL(0x5234c726,0x167856a7),LL(0x5ffc3eb3,0x51cd2b4c),LL(0xcae5bf47,0x40b83945),LL(0xe2c3c6ff,0xa078d20e)}},
+   {{LL(0x4955d9f7,0xafb219d2),LL(0xf8b61ab0,0xc8cd02e1),LL(0x656b7953,0x0653b5e2),LL(0x53963a49,0x663fc691)}, {LL(0x9698c7f7,0x4cdd8ec8),LL(0x54d0e85d,0xf8bf9105),LL(0xb91448ed,0x09358777),LL(0xd1b78395,0x12d14331)}},
+   {{LL(0x57508aec,0x32e8b396),LL(0x453b2e16,0x137dd25e),LL(0xa71755b8,0x306241b3),LL(0x38e1506b,0x9b326741)}, {LL(0x8f27a87f,0xe5ccef87),LL(0x53ec2f93,0x20c55d37),LL(0x2e745f94,0x781dbbe4),LL(0x0dcfd15c,0x352a1d4a)}},
+   {{LL(0xcbc26c8d,0x5c61343b),LL(0xc531127b,0x13cb80a2),LL(0x985fd080,0xcd7b7e1a),LL(0x1f068c19,0x5590a95f)}, {LL(0x4d3698ed,0xa4c71bc7),LL(0x21a031d8,0xa2d86d68),LL(0xfb8d7253,0x25c5c13b),LL(0xc85631b1,0x0cb8430f)}},
+   {{LL(0xef46858b,0xd8ac3e28),LL(0x35909887,0x83b8b091),LL(0x8eb0da8b,0xe81e8039),LL(0xb61b2571,0x789a5611)}, {LL(0xc2350b72,0xb10e75d4),LL(0x779a063a,0xef1bfb74),LL(0x7f831af4,0xbf468459),LL(0x18a1ece0,0xe6350157)}},
+   {{LL(0x08db43d8,0x06cbdbb7),LL(0xd2daf8b6,0xf604bae0),LL(0x295cd85e,0x29ce6138),LL(0x38ec8ca4,0x7765f02e)}, {LL(0x1d9e8588,0xac7cf4aa),LL(0x67ca4a72,0x781f66bc),LL(0xab746e51,0x8eab645c),LL(0x6e2ec4fa,0xc7d6bce1)}},
+   {{LL(0xf75bf01a,0xa6270a57),LL(0x116902e7,0xce4347de),LL(0x2e3b3cce,0xd378a7a4),LL(0x7e1dd74b,0x96be1fde)}, {LL(0x45305660,0xa5908e46),LL(0x54fa99bc,0x374f368b),LL(0x51c9d95e,0x01fab849),LL(0x7f014edd,0xe8015def)}},
+   {{LL(0x10601157,0x24b7ec49),LL(0xda099148,0x37bbac1f),LL(0x0d7ad303,0xf86a5c11),LL(0x6f01beb1,0x96cc5602)}, {LL(0xc1bc952b,0x1d43e7af),LL(0xd5738c6b,0xf10d28a8),LL(0xd1ddfd9b,0xaf0836d8),LL(0x88873acb,0x13af0bec)}},
+   {{LL(0x37454953,0x336e56c7),LL(0xd9a7e89a,0x41b0a6e9),LL(0x24b7b20f,0xfc46fe38),LL(0x39948949,0xee566d61)}, {LL(0x44446071,0x2a354bed),LL(0x8fffb750,0x91ac505a),LL(0x75ed3ad9,0x07787a6c),LL(0x29a87d9d,0xba557711)}},
+   {{LL(0x441083ca,0x807c4992),LL(0x271f3aa8,0x2c48e9c9),LL(0x78e145c6,0x6c14a142),LL(0xc855f8ec,0x91360a8a)}, {LL(0x6bc35034,0x5aca2af7),LL(0xfe99621f,0x3e4db0f1),LL(0x3b8a239a,0x103d39c7),LL(0xdc0b1203,0x81c6b8da)}},
+   {{LL(0x950bd081,0x47af192a),LL(0xfa4c6c80,0xab20c5e2),LL(0x92456270,0xe437a275),LL(0x2381e743,0xa3fd63a7)}, {LL(0xf23f7af5,0x9b9a2248),LL(0xd3ca9fb2,0xac498b63),LL(0x9217bbf6,0xc25b30b5),LL(0xfa0376cd,0xb91c369f)}},
+   {{LL(0x64536fc6,0x0e362061),LL(0xc50ef4d8,0x1afc8760),LL(0xd61e1202,0x9b30d4b7),LL(0xd2120279,0x03cf7c66)}, {LL(0x29e3cc6a,0x21b0ee51),LL(0x436112d5,0x3e0a97f9),LL(0xdf1933f1,0xf54144e9),LL(0xed57313f,0xdad5eb94)}},
+   {{LL(0x9735f1bb,0x269e91dc),LL(0xac51acdb,0xb2b738a7),LL(0xfada51f4,0xccd1f6f3),LL(0x79d12425,0x82dedff8)}, {LL(0x4b5a72dd,0x71e7e6e6),LL(0x4ccbd0ed,0x8afb9d9a),LL(0x95e3e8ee,0x3e178f75),LL(0xae59d7b8,0x0b1700a6)}},
+   {{LL(0x860c0fd2,0x9c92b0b3),LL(0x179dbdd3,0xc39e662e),LL(0x84eb3642,0x0d0f3253),LL(0x8c1ec5e7,0x90bfebd3)}, {LL(0x423f0f71,0xac589b3e),LL(0xc06e03d4,0xdcaf1497),LL(0x8e30cdb1,0xd0047747),LL(0x5cd9ad74,0x1ca8f1aa)}},
+   {{LL(0xf0c2c7cb,0x63f37637),LL(0xc2ff96f4,0xdda8ce4a),LL(0x32c1d375,0xa84b1bf2),LL(0x601e3828,0x61448f06)}, {LL(0x38d6694b,0x478e3b2b),LL(0x0f466a53,0x42d7736c),LL(0x0ab8656d,0xd0a44485),LL(0x0faf74a1,0xa80c6576)}},
+   {{LL(0xd88583fd,0x85b4932e),LL(0xff6ebc08,0xb3a2020a),LL(0x468904b0,0x3268fdb1),LL(0x4b0c4cea,0x931dad39)}, {LL(0x7910d35c,0x4176778f),LL(0x5b49b91f,0x54fa5c53),LL(0x9debc3ec,0xde3e7569),LL(0x8640ba85,0xedeeb836)}},
+   {{LL(0x065c2e4b,0xd25dd299),LL(0x634e52a8,0xdde3bd8e),LL(0x7f061b71,0xb785fa32),LL(0xa697aa93,0x02f4abd1)}, {LL(0xbf540102,0x57235ab3),LL(0x59b7a33e,0x6d312fe7),LL(0x0ec76202,0x0807002a),LL(0xe3f80ba7,0xca8e1651)}},
+   {{LL(0xb16672e6,0xcf94d8d4),LL(0xfee90949,0xf5a613b6),LL(0x081078e0,0x00174a1e),LL(0xae9b8e33,0x47d2d003)}, {LL(0x056210c6,0x136df2a0),LL(0xd39bf6d1,0x0ff481c0),LL(0x0dbbd8cc,0x282a8301),LL(0x8533b8d6,0x52a2d355)}},
+   {{LL(0xf282227f,0x33687399),LL(0x166301f9,0x9cbb8a5c),LL(0xca782567,0x30739266),LL(0x494d97f4,0x0e627ad8)}, {LL(0xea71ac16,0x06755871),LL(0x99bffa23,0xc3e0d270),LL(0x9dae4962,0xb339b072),LL(0x3398897b,0xab089ce2)}},
+   {{LL(0xa690921b,0x49e8e910),LL(0x2fa32b8c,0xc51f51ef),LL(0x18483f66,0xd7ef436d),LL(0x36b3028c,0x535d6e5d)}, {LL(0xda086e50,0xb414f4cb),LL(0x9f46f7e4,0xaae385bd),LL(0x9480223a,0xaae72664),LL(0x7274f578,0xa380eebc)}},
+   {{LL(0xb90c8dfd,0x57a7b8a6),LL(0xd282f711,0x5ed71043),LL(0x5a8bf3f3,0x84f4c6a2),LL(0x1dfcd58e,0x983365c8)}, {LL(0x87d0c267,0x58b52002),LL(0xc33c8f12,0x76c64a90),LL(0x97666731,0xc091fc9c),LL(0x660a8e04,0xa4d84495)}},
+   {{LL(0x48320e92,0xf164beb5),LL(0x89348af3,0xa390eeb1),LL(0xc9d5a3fe,0x839362e9),LL(0x7c641bc9,0x44dc20a5)}, {LL(0x1415594c,0xdfd506cd),LL(0x389fe2b4,0xee832364),LL(0x76233ed3,0xd918fd11),LL(0x4978a2bc,0xebf4fa58)}},
+   {{LL(0xafdfee63,0x0d9635f9),LL(0x8561ce20,0x4a9a0e04),LL(0x059c5e60,0x6ee8ddaf),LL(0x1704f30e,0x8a2820ea)}, {LL(0xc65cd16d,0x8d64a6e0),LL(0x24bef3dd,0xb8fb7b0f),LL(0xcda6e938,0xad77fac3),LL(0x25afbe8f,0x13fb0171)}},
+   {{LL(0xcfec4496,0x15743b44),LL(0xcb649019,0x3a603581),LL(0x6cf6f9f1,0x87df1e4d),LL(0xa661a93f,0xe365e520)}, {LL(0x3b4ff2e7,0x60a72a52),LL(0x1887b97c,0xbd13485c),LL(0xe9e5365c,0xdef6887d),LL(0x13b86369,0x73a3511d)}},
+   {{LL(0x9dae2231,0x584e4993),LL(0x55c0856b,0x875bf968),LL(0x9102ad6b,0x89d97a20),LL(0x989d1a28,0xae04367e)}, {LL(0x1f72162a,0x2107faea),LL(0x4cb1b1b4,0xcc6d15ff),LL(0x545d4824,0xae302e5b),LL(0xb8079c19,0x121cccd9)}},
+   {{LL(0x515be081,0xe6e6cc85),LL(0x837404be,0x815d6368),LL(0xaf5874e7,0x7c65f6af),LL(0x7b41e998,0x5ebadcd5)}, {LL(0xee87df45,0x281acd43),LL(0xa7104d2a,0xbc2e5f49),LL(0x35af9348,0xccecd641),LL(0x0d76730a,0xeda93480)}},
+   {{LL(0x042b3b6d,0xdaf0953c),LL(0xb04010ec,0x31049bf8),LL(0x66e6fd8e,0x1505269f),LL(0x5abf1d21,0x2831e819)}, {LL(0xf51de857,0x9391551e),LL(0x66b10feb,0x83e174dd),LL(0x82b1323d,0x5ca7c77c),LL(0x0a54f730,0x7e06bbde)}},
+   {{LL(0x69fca668,0x0d0e8f68),LL(0x76ff0816,0xb6536b13),LL(0x1c651e5a,0xb9aae557),LL(0x73a4cabe,0x7f755c35)}, {LL(0xf9b59700,0x29d6fd83),LL(0xd2daef59,0x0f7f1274),LL(0x306e516e,0xf45625d1),LL(0x4274a4c9,0x7bb2c873)}},
+   {{LL(0x2396261b,0x1c7a85de),LL(0xf59632f4,0xa8c4d9ce),LL(0x75179faf,0x59a6e1e7),LL(0x309e679f,0xb3764d92)}, {LL(0x69b44735,0x25d3c3dd),LL(0x6f80c8a2,0x0992a93e),LL(0x6dc0e567,0xe4fc4357),LL(0x3506000f,0x74a5607a)}},
+   {{LL(0x8eac18ec,0x5e0e7a6f),LL(0xd7359928,0xbfd11565),LL(0x3b5a23d0,0x8877766b),LL(0xa71e64e9,0x606d4cff)}, {LL(0x28467c67,0x486d3f1a),LL(0xe98f3856,0x719096e3),LL(0xa76a1d46,0x98a9faa8),LL(0x1d123e8b,0x1f0ceb7d)}},
+   {{LL(0x9fbae0c1,0x020a3972),LL(0x221df580,0x681b6ffa),LL(0xd05c44a1,0x7cd0e2f3),LL(0x937d9431,0x89977b5f)}, {LL(0x5cd79778,0x3dda0f53),LL(0xb04465c1,0x6f56e1ed),LL(0xb17bdb40,0x030a00e3),LL(0x94cb0e67,0x2625b9b6)}},
+   {{LL(0x404dfc1a,0x82fc3c71),LL(0x57ae7f14,0xc7f5dbb5),LL(0x8a28d728,0x04f4cae5),LL(0xe97a70d7,0xa9dfc961)}, {LL(0x138901ed,0x7ecec078),LL(0x21722a58,0x90cd161e),LL(0x8de35e71,0x6c1c6f8b),LL(0xce8644c4,0xc940a13e)}},
+   {{LL(0xe7287019,0xdcf2a2fe),LL(0x51ac86a1,0xd56f10d2),LL(0xbc69e118,0xf3f3aad3),LL(0xdee1d31b,0x781c794d)}, {LL(0x48097dc5,0xa2f482f1),LL(0xf4c1e5f5,0xa4ccc2c7),LL(0xeb022d61,0xdddc7698),LL(0xa1e632fe,0xe35ecd9f)}},
+   {{LL(0x3cf5c5d7,0x8d2db8dd),LL(0x4a1868ea,0xb6966861),LL(0x643a45f9,0xcedc1996),LL(0x15d60e5e,0xdbf02587)}, {LL(0xf0fdbd28,0x1935ec86),LL(0x9d928044,0x56e2e4d2),LL(0x837f5585,0x65f6b107),LL(0xf6c91fd5,0xf2315214)}},
+   {{LL(0x57d2286f,0x0ebb9252),LL(0x8a9f17fa,0xa539cbb7),LL(0xc87baf54,0xfb642d3b),LL(0x44fa7238,0x242b572a)}, {LL(0x250f26e0,0xd191082a),LL(0xd3de93fc,0xc8f106c3),LL(0x8c5c90bb,0xc0c69f29),LL(0x969a342c,0x1240d15e)}},
+   {{LL(0x0804b259,0x6d5a8230),LL(0xa1ab26ec,0xd2622727),LL(0x1f239634,0xede890a5),LL(0x4cdef292,0xc3431422)}, {LL(0x591120df,0xd6a59688),LL(0x92fae3bc,0xb27dcd58),LL(0x7450240d,0x11b605a7),LL(0x2403142a,0x3b1eb8f8)}},
+   {{LL(0xa7bed0c1,0xe77c108b),LL(0x69a08751,0xd320cc7d),LL(0xacd6d253,0x67eed4c2),LL(0xee8998e5,0xc3dde80e)}, {LL(0xe8204fb9,0xd1989c38),LL(0x73242015,0xaa7bcb6f),LL(0x9cd10686,0x9f6f6cc1),LL(0x2e9f919e,0x57c08b2f)}},
+   {{LL(0x648e0f6a,0x1042d504),LL(0xb01b3cd7,0xe8af48d0),LL(0xaddfa17b,0xe51e4f1e),LL(0x3dbf69a9,0x44433a62)}, {LL(0x459a17ec,0xdf2dc47b),LL(0xfc87b0d6,0xf43cf937),LL(0x3ce3c91e,0xeedca107),LL(0x94a3cfdf,0x65b55db9)}},
+   {{LL(0xc6930bfe,0x1ee12702),LL(0x780d44b3,0x3bfdf52e),LL(0xaa14c471,0xfc7c37e8),LL(0x1d4af915,0x2bcf5233)}, {LL(0x571b5eaa,0x68005bbf),LL(0x6dc80b1a,0x37345954),LL(0xec01f664,0xac9540c4),LL(0x6c00e41e,0x3caaa2ce)}},
+   {{LL(0x4e73fb9a,0xa2dacf83),LL(0xd6ae676e,0x161cd8ce),LL(0x8c696c18,0x6c360c22),LL(0x05bcc912,0xa036ccbd)}, {LL(0x7a7ea131,0x53a34888),LL(0x2e28be88,0x782da5d7),LL(0xa5230ae2,0x37d32d00),LL(0x96e7ea65,0xf96b9387)}},
+   {{LL(0x7c427e2d,0x50b2de6b),LL(0xdcca35ff,0xd4bcde24),LL(0x69ae186b,0xe48b3671),LL(0xc332bfca,0xf672a440)}, {LL(0x2f08b6c9,0xe317ffda),LL(0x7a581f9b,0xfc1d5156),LL(0x07a732de,0x3b8d14d3),LL(0xf4643208,0xaa6db32a)}},
+   {{LL(0xe1d4cd32,0xac9e378e),LL(0xe5c66fad,0x422d0c1b),LL(0x7a2176cc,0x58ddd829),LL(0x1f2c9af3,0xd9ced3f2)}, {LL(0x017fac80,0x6a271698),LL(0xc785fadf,0xe2b707f1),LL(0x998a199c,0x604ac7f2),LL(0xe73a0fdc,0xd292efda)}},
+},
+/* digit=4 base_pwr=2^28 */
+{
+   {{LL(0x77b6e2ed,0xf4f0250d),LL(0x06ad9e0a,0xa1dcd50a),LL(0xa2d18bfa,0x5ae11d44),LL(0x955924a7,0xbd22cee0)}, {LL(0x3d232d71,0x7336db5e),LL(0x798d3edc,0xca473ec3),LL(0x25fdaf3f,0x38aa2a31),LL(0xe9f40c01,0xd1e1ad45)}},
+   {{LL(0x3eb2dbca,0xae863d1a),LL(0xc05e6183,0x119280b9),LL(0xb29a523f,0xb3636741),LL(0x83ee9338,0xcba31d04)}, {LL(0xbfc6a5d2,0xa782e9da),LL(0x9203414c,0xd3266e18),LL(0x740fdc53,0xb69c6b48),LL(0x43bc15ed,0xbec0d597)}},
+   {{LL(0x0e61e1cc,0x0e9b3d08),LL(0x3ffb2a93,0xe3adfcfd),LL(0xb800d5a0,0x555be66f),LL(0xde7ffe34,0xc910b56d)}, {LL(0x3e7d150e,0xc1f65358),LL(0x3364f59d,0x958defcb),LL(0x93d82602,0x14d6aee0),LL(0x87abe6a9,0x64e68590)}},
+   {{LL(0x22376827,0xb097726a),LL(0xaf1ba09a,0xe6b946d4),LL(0x04cc2dad,0xc023d286),LL(0x7912926a,0x4991ddae)}, {LL(0xc7f90d00,0x564db45e),LL(0x720ddc70,0xf810acca),LL(0xb4f4f9e3,0xff8ef73c),LL(0xa6474b56,0x4e72ab52)}},
+   {{LL(0xcb76d5ee,0xb441a838),LL(0x448db7e9,0x08b557fa),LL(0xd7644ed9,0x95d983ea),LL(0x79bd26ae,0x6e22a4a0)}, {LL(0xcb50cc6f,0xe8e925af),LL(0x8ad75730,0xf127bd3b),LL(0xf06da637,0x837e036b),LL(0xf414f78f,0x4bb795a7)}},
+   {{LL(0xd43b07a9,0xfad5aa9a),LL(0xf7c2d583,0x84fc5084),LL(0x20f4c9e8,0x1018af01),LL(0x3ff473ac,0xf628df2a)}, {LL(0x6d5cee38,0x7a4c4c24),LL(0x751e2f4d,0xa568ff06),LL(0x4a906a53,0x3cbee46e),LL(0xfc9f0fb3,0xf40507ee)}},
+   {{LL(0xf4ee70c8,0x40c42c0b),LL(0xd3bf850c,0x531c6c04),LL(0x5fbdd774,0xdafa1059),LL(0x12b24339,0x6c89465c)}, {LL(0x59d4b3d5,0xa98c6b42),LL(0x379c9f4e,0x91e58b84),LL(0x9fc6e446,0x2140a354),LL(0x66dfbdee,0x6d557c9c)}},
+   {{LL(0x1e7b0132,0xb4028f92),LL(0xa129b871,0x15c3ebad),LL(0x26da4ac2,0x00e771b6),LL(0x9a10d361,0xc4ba5efd)}, {LL(0xe44b597c,0x93982e79),LL(0x334b9d0e,0x2cd7fec6),LL(0x2e29b81b,0xa9030fc6),LL(0x1d621df1,0xa5132516)}},
+   {{LL(0x4857bc23,0x2f6143d7),LL(0xf85db276,0x2abde260),LL(0xd66a4ebe,0x7fb2b52d),LL(0x0777e4bd,0xc8d2b023)}, {LL(0x085bf4ef,0xdaf82eab),LL(0xe20e88c0,0xca44f3ae),LL(0x21e10f35,0x86c21795),LL(0x93b3d6e9,0xde4595ad)}},
+   {{LL(0xd1a00d3e,0x661052ca),LL(0xbd3c1d85,0x87909aae),LL(0xae5f74f1,0xc102cb31),LL(0x10c56533,0x64a07600)}, {LL(0x9dd4aa57,0xd28db59d),LL(0xf4437a7a,0x92cfabc3),LL(0xbf7e3509,0xb60cd7e7),LL(0x9b2d201b,0x8f357547)}},
+   {{LL(0x1573de27,0xa138f51e),LL(0x798a17ff,0xb0587b9f),LL(0x4a235422,0x52904df3),LL(0x739d2f59,0xa7b4aba8)}, {LL(0x4b2c145b,0x86e69ac8),LL(0xe1deab99,0x92a3bfea),LL(0x041ef0a2,0xaa8e3efa),LL(0xc37e2f3d,0xddb0d630)}},
+   {{LL(0x722e27ca,0x1ac9edb0),LL(0x2a77e573,0x9b55c43e),LL(0x33cf218a,0xe68ad58b),LL(0xff2682c9,0xb7810094)}, {LL(0x108dba84,0x64e8cf9c),LL(0x554f1c61,0x7904cce9),LL(0xd5494562,0x433ba21c),LL(0xe605f805,0x0368f033)}},
+   {{LL(0x68ca671e,0x81e89fd6),LL(0x230cccf6,0x13967993),LL(0x09ab9f6f,0x9f5da8cd),LL(0xc579dd11,0x0a54b236)}, {LL(0x2c735611,0xfb9f0635),LL(0x147eb2ad,0x9446a3cb),LL(0x6086eb02,0x3dd6598c),LL(0xe8909e3e,0xfa2c647d)}},
+   {{LL(0x543658c1,0xf5b6395d),LL(0x6384e5e2,0x93d70826),LL(0x0ae795eb,0x4fcb9603),LL(0x917bedcf,0x9b357d91)}, {LL(0xcabfe05d,0x687c881b),LL(0x3d806bd6,0xfba48ea5),LL(0x2502c1d9,0x80fe04a9),LL(0xdc49d988,0xfe506e75)}},
+   {{LL(0xc37a49ef,0x271635d9),LL(0x6c6ad4e1,0xc4d01fab),LL(0x641f5ea0,0x3f72c832),LL(0x43fbf052,0xe1b7de34)}, {LL(0xb4f626b7,0x50a77b0f),LL(0x8f220318,0xa2e0b7e4),LL(0xb87b4f2c,0x0df86ef9),LL(0xdc89ca4f,0xb694c402)}},
+   {{LL(0x47476977,0x9f30222b),LL(0x5fe1d2dd,0xaf409552),LL(0x02cd5d56,0x9ef91337),LL(0x86109b4e,0xb3b436f3)}, {LL(0xac8dc00c,0x0b4f8eba),LL(0x7619927f,0x349b5f12),LL(0xa670b81d,0x98f120c4),LL(0xc394b509,0x2f2479a7)}},
+   {{LL(0x61524f6a,0x270da2a2),LL(0xa0d5f2be,0x39413fcb),LL(0x9a3a0d08,0x048a520f),LL(0x6581aebb,0xf2405829)}, {LL(0x472ca179,0xc2a23652),LL(0x79557fee,0x98246b27),LL(0xf5728f7f,0x31e08fbf),LL(0x8ce4eb0c,0x284f1ba2)}},
+   {{LL(0x156684d8,0xa625186e),LL(0x6dae4011,0x288b0ac8),LL(0x1767e0a0,0xc6f197b4),LL(0xfcc13e7c,0xb493d8df)}, {LL(0x71c77b6b,0x1a8cee71),LL(0x1a4eeb8b,0x7732e13a),LL(0x9fdf6417,0xa49b18d6),LL(0xb70fb8f8,0x096b9fa3)}},
+   {{LL(0x85b6538c,0x8c8d02d5),LL(0xf1b0176c,0x1ba5ec33),LL(0xfcf18561,0x763a7b73),LL(0x1147becf,0x015c7fd0)}, {LL(0x87ec4e33,0x39467d92),LL(0x94f0deab,0xd1d20cde),LL(0x2d85ac48,0xf30d63c7),LL(0xe086bc46,0x3b1375b7)}},
+   {{LL(0x7aa43a10,0x93a9416e),LL(0x73cedb71,0x624e8013),LL(0x2ba7b976,0x48a18759),LL(0x4bf11460,0x9b0beaf2)}, {LL(0x862a583d,0xeefec18b),LL(0x88cdf386,0xacb601a2),LL(0x129e050d,0xbba8d65b),LL(0x7ec732d0,0xb6ab2118)}},
+   {{LL(0x4b2f60c6,0xae5641b6),LL(0x283179e8,0xa0f83c20),LL(0x1e250386,0x182acab1),LL(0x37ba0c39,0x7c117c63)}, {LL(0xacf124d9,0x260da7e7),LL(0xd4d0582b,0x8d442f5e),LL(0xc77f6d1e,0xde7fcfc0),LL(0x0b8b98c2,0x9df675c6)}},
+   {{LL(0x3795326d,0x2f9d8a13),LL(0xda05b87a,0xe1b4806c),LL(0x875ff593,0xa190e221),LL(0x7e407f62,0xd7eb9ff1)}, {LL(0x2416e093,0xc8bbe193),LL(0x0648a2af,0x54599388),LL(0x5fd8667e,0xa1eb126a),LL(0xb7d6e436,0xc96c8aa1)}},
+   {{LL(0x6d23b486,0xec2daae2),LL(0x99dd19f0,0x7ecbdcd4),LL(0xca08f4f1,0x2a5774d5),LL(0x55bbee60,0xe51d97ec)}, {LL(0x08e59b7e,0xc1ae451e),LL(0x1626d6d1,0x566a9298),LL(0xef29ca4c,0x8e63ff4c),LL(0xf8dfb93a,0xe08b5158)}},
+   {{LL(0x3a70401b,0x755e3944),LL(0x0ac8eae4,0x5889d6a4),LL(0x1b40748b,0x22a69cf8),LL(0x1ab2b519,0x68764ca3)}, {LL(0xb1fbf9a7,0xfabc8a3e),LL(0x08f9806a,0x2358ba46),LL(0xbd75fac5,0x26a728d2),LL(0xfd55743e,0xbd32519b)}},
+   {{LL(0x8efecdce,0x178881eb),LL(0x4d97a7ca,0x5d925f23),LL(0x61e8ec1d,0xf5c0c950),LL(0xaeab09c1,0x0746c08a)}, {LL(0xe8021a39,0x51e838d1),LL(0xe8ba48fa,0x394941cc),LL(0x3c05650c,0x20254a3e),LL(0x2a29900f,0x157c6d54)}},
+   {{LL(0x99a6d7c7,0x60de504b),LL(0xd0508267,0x748ff0aa),LL(0x0cc9b950,0xb1d17fde),LL(0xf0d30872,0xaf9afb47)}, {LL(0x2a302caa,0xce905cfb),LL(0x0c105022,0x47fb9ef4),LL(0xa3da670d,0xab2ac128),LL(0x3ba15ca9,0x747d7d69)}},
+   {{LL(0x0efa91c4,0xb5e41510),LL(0xdb039a8d,0xfa54e91b),LL(0xfb6a7760,0xa796deb4),LL(0xd4243f90,0x25f4a7ae)}, {LL(0xa43683a2,0x521b7b37),LL(0x71906c86,0x7317a5cd),LL(0x468946f9,0x544faa0b),LL(0x23f18c2a,0x01436248)}},
+   {{LL(0x2c35f231,0x3cd9cf9c),LL(0xaad0b513,0x8d89595b),LL(0xee1574ec,0x90a4e9a8),LL(0xc23311c0,0x84dc9a3f)}, {LL(0x48599220,0x5c284cae),LL(0x824625b1,0x17479e47),LL(0xe79c5f1b,0x46a41ef7),LL(0x195f87cb,0x8534bce9)}},
+   {{LL(0xd6e689e9,0x504fc498),LL(0x602b4cd1,0x65e6871f),LL(0x91be4e63,0xb69a86f1),LL(0x25c8ae29,0x27b100ae)}, {LL(0x6607502d,0xbc14b7a3),LL(0x826b9308,0xfd24fb15),LL(0x53e34432,0x75751e7e),LL(0x47cc930f,0x2cccbdd6)}},
+   {{LL(0xfc1606ae,0xc13fc11a),LL(0xb8646863,0xff8e3327),LL(0xb52a64f7,0x97c27e57),LL(0x57d7f363,0x8df70813)}, {LL(0xe53fefb1,0xab69c75c),LL(0xf5340fd4,0x4f1a2f88),LL(0xbc7ba962,0x5e86815e),LL(0xb9235a7b,0x0b6064aa)}},
+   {{LL(0xaafc8b8a,0x9e560869),LL(0xca841e15,0x0d049b9a),LL(0x18d2c0bf,0x93753db3),LL(0xcc372b67,0xf0ed8347)}, {LL(0x44bd6269,0xb815e316),LL(0x87ae4b92,0x9cd9388e),LL(0x3a3d86d7,0x147fc16a),LL(0x7cc3b0d9,0xd41bf799)}},
+   {{LL(0x17fb2c3f,0xf9065b18),LL(0xbb30cff5,0xbaa506d8),LL(0x16e0251d,0x4cc3fc6e),LL(0x8bff86c2,0x3f1d3f18)}, {LL(0xb78b064b,0xd33d0391),LL(0x1a233126,0xc63f1401),LL(0xb3b87f92,0x0aa7081d),LL(0x7f000171,0x62f17da7)}},
+   {{LL(0x74216073,0x014fab37),LL(0xab222b6d,0xf7f1525b),LL(0xc173d4f7,0x6bda1b53),LL(0x698ed45f,0xe6755a3f)}, {LL(0x6860bbc3,0x9124d228),LL(0x9d2e89fa,0x4bc317a9),LL(0xa5ec0176,0x61748dbb),LL(0xc5f2bccd,0x30ee3d18)}},
+   {{LL(0x068fa89e,0xda2f57b5),LL(0x644a16c4,0x041fb048),LL(0xc6702fd9,0xe6b4598c),LL(0x14f4c1b2,0x80ec223c)}, {LL(0xd6f59a36,0x4fbd3162),LL(0x2f7b35dd,0xd49e3484),LL(0xaf50bb9a,0xf7451643),LL(0xecd09d36,0x0776e7be)}},
+   {{LL(0x75475e1d,0x0da39961),LL(0x8d485b00,0x0cba53f6),LL(0x317ca1c5,0xa0ae44c3),LL(0x0e4aa9f9,0xcabec7f9)}, {LL(0x58d799c1,0x692b11d4),LL(0x7211332c,0xe7d4dfd1),LL(0xf51d455e,0x7e963028),LL(0xf128e49f,0x17ba3074)}},
+   {{LL(0x25805a67,0x9fc7ce22),LL(0xc92a9434,0x0f13cea9),LL(0xee6efe7a,0xf40822fb),LL(0x6887531c,0x07bc438f)}, {LL(0x69fa017e,0x0f6ccd49),LL(0xc28aee92,0x8e979e5a),LL(0x7cf48445,0x36d6b03d),LL(0xae0b26e2,0xcba8c9d7)}},
+   {{LL(0xcf74effb,0x497083cc),LL(0x41b1ea07,0x4c9b8a8f),LL(0x0cf8be2f,0xfabf255b),LL(0x51e0c1a8,0xfb7af458)}, {LL(0xb1fbc2e8,0x30eacdc6),LL(0x4432101f,0x96f439f7),LL(0x65252a4d,0x46487be1),LL(0x7b5bd99c,0x661063fe)}},
+   {{LL(0x0f0bafc1,0xe863f0d4),LL(0x58c02a3a,0xa7b455ef),LL(0xc5fc2eb6,0x8d87205a),LL(0x57cb70b1,0x02e2ef4a)}, {LL(0x09b35762,0xc5ad9c67),LL(0x25a3cf6f,0x74c7568f),LL(0x10d42fae,0x90840858),LL(0xf319c3c7,0xd8996a00)}},
+   {{LL(0xff648066,0xbe927b9c),LL(0xcdbeff80,0x1eedd01f),LL(0xdc0b047d,0x3ce34fde),LL(0x7261df8e,0x8d560044)}, {LL(0x82907e33,0x470658e2),LL(0x956885f8,0x65855bf3),LL(0xd7446f05,0xa80bddde),LL(0x07c08912,0x8b9538fc)}},
+   {{LL(0xa504bc6d,0x802ce9b6),LL(0x65b65a9b,0xcd62bd53),LL(0x9e1fadd9,0x4a46f64b),LL(0x68d6728a,0x2e5ca555)}, {LL(0xcb87d690,0x5bb40c53),LL(0xa3412a96,0x5f332158),LL(0x0a8de2d3,0x61736562),LL(0x3090b234,0x364b8d32)}},
+   {{LL(0x806cf865,0x6650f1bc),LL(0x3ed9c823,0xaa1e73f5),LL(0x7cc4470f,0xbbb84866),LL(0x8ee2f8c4,0xe55d4f88)}, {LL(0x813bb847,0x7e7511c8),LL(0xbf560383,0x541e7b3f),LL(0x302bed80,0x50d68691),LL(0xed64b539,0x51dcf814)}},
+   {{LL(0x48af53ee,0x4e02cc2f),LL(0xc9c30126,0x18df7e16),LL(0x2b3ed794,0x01f9c93e),LL(0x5fce5568,0x4dcf26a7)}, {LL(0x3a8011bc,0x1916d504),LL(0xafe810ea,0x26ea20e1),LL(0xdb764a39,0x7ba3943b),LL(0x32c0194a,0xbfa6be5d)}},
+   {{LL(0xe04c5657,0x7427eb59),LL(0xf13f3175,0xfee27f33),LL(0xf8a50c5c,0x16104ddc),LL(0x01e4d50a,0xc0e3d18b)}, {LL(0x9d254151,0x3ba9155a),LL(0x93b55e55,0xa005ac73),LL(0x8fabe96e,0x0ba613d4),LL(0x9fbd5fb9,0xd22f6847)}},
+   {{LL(0x71ffd978,0x4e05d13b),LL(0xeae6a8a7,0x67220f5f),LL(0x7fe498a9,0x579edfe4),LL(0xe866d9a1,0x13469c4b)}, {LL(0xcec8133c,0x87c7aca2),LL(0x082de8d3,0x0a0edf37),LL(0x1251e1ce,0xd1e8b153),LL(0xfefd964f,0x9fcff173)}},
+   {{LL(0x6631cd6d,0xa3c15717),LL(0x23df334e,0x5af2a7e4),LL(0xba8e2653,0xcc9e4de2),LL(0x4442a426,0xeba627ca)}, {LL(0xaf7414c3,0x2f7def49),LL(0x369c0e08,0x94ca5b5c),LL(0x86b9f0eb,0xa237d2e0),LL(0x797b4359,0x78f9e196)}},
+   {{LL(0xfce833d7,0x61dac639),LL(0xf3c99fc1,0x049624cf),LL(0xffb293db,0xeb20d47c),LL(0x5ddc1476,0x7a0e6fee)}, {LL(0x646aeee5,0x37348bad),LL(0xc536c2e0,0x3e5f2caa),LL(0x724fee87,0x7c87e56f),LL(0x5a0c4da5,0xccc0828b)}},
+   {{LL(0x19487784,0xbd83527d),LL(0x881c66f1,0xbcf99ac2),LL(0xd8ad98d0,0x76bf0c72),LL(0x5d4b4e77,0x56458550)}, {LL(0x9cb21bab,0x73dbad41),LL(0x015a26aa,0xde12b1f9),LL(0xb8168092,0x1dedfbfc),LL(0x93f365fe,0x5d9a278b)}},
+   {{LL(0xfc3ee5c2,0xc7155e11),LL(0x1ae69f50,0x36e8efe1),LL(0xf80108da,0x498e34db),LL(0x9d6ace8d,0xdb5dcc90)}, {LL(0x16e08e66,0x177d4c27),LL(0xa22d77dc,0x867cbd65),LL(0xd75a980c,0x42383b71),LL(0xfd9485cf,0x3651d4a0)}},
+   {{LL(0xc95bed0d,0x7d743209),LL(0x9f1ed3e1,0x20cc46eb),LL(0x05d9a61f,0x936c47a1),LL(0x10e729f0,0xc9db1540)}, {LL(0x85ef0c4e,0x634d4221),LL(0xd7593422,0xc30bd01c),LL(0xaaa4d5db,0x172701b5),LL(0xa30aa60b,0xf8253abb)}},
+   {{LL(0x757d3f14,0x6612a8e8),LL(0xc72bbe1c,0x2bb82c73),LL(0xdc9ba874,0xe8d38f7f),LL(0xa88f499d,0x08fb84a1)}, {LL(0xf18a06f2,0x03a90903),LL(0x9efa3c5e,0x28abd1e5),LL(0xa58f4dcb,0x33144b05),LL(0xa867f938,0x4d2fe3b4)}},
+   {{LL(0x825b3af7,0xb86c2ef1),LL(0xf3dc1cf2,0x88cff8c2),LL(0x0ef14751,0xd6b6b8c3),LL(0x8a21b40f,0xa98bf65b)}, {LL(0x53cb140c,0x6366847d),LL(0x213bba5e,0x753dcb75),LL(0x7fc68bde,0xa27ac368),LL(0x0ac5ed78,0xa037ea1b)}},
+   {{LL(0xf94f8735,0x938e3207),LL(0x678f448c,0x1b865be5),LL(0x1893be5e,0x831a5fe8),LL(0x88a6330f,0xe1dc8555)}, {LL(0x806fd401,0x9797b27b),LL(0x3ff777e3,0x894a619d),LL(0xfdb0cbbd,0x8adef55b),LL(0x2424dee8,0xe8253728)}},
+   {{LL(0x64b72c17,0x86ed4601),LL(0xf40a7bc2,0x6ff298a4),LL(0x2c50820a,0xd70404d3),LL(0x5baa8f6a,0x1b96ea05)}, {LL(0xece121e2,0xf435a4b1),LL(0x727d3e02,0x9c880908),LL(0x21508f0f,0x8d0badaf),LL(0x97fecafa,0x4a8cd9d1)}},
+   {{LL(0xd6e6d41e,0x694968b4),LL(0x224ee38d,0xb9c952ac),LL(0x32a78d23,0x6dc80377),LL(0x284681a5,0xd549c170)}, {LL(0x7a4044b7,0x28f17d43),LL(0xfdd1e862,0x4d713401),LL(0xe10ae1ab,0x4dbdc38b),LL(0x234e623c,0x915b80b1)}},
+   {{LL(0x78a7eece,0x8d06f538),LL(0xd4e139e6,0x024e16ac),LL(0x76941e4b,0x9f179c04),LL(0xaf9e377c,0x8e527c82)}, {LL(0xbdc11cfc,0x900155c3),LL(0x51c6ae6f,0x94aae6ab),LL(0xabdbc9a7,0xbf46201c),LL(0xefb496f2,0x47aa808c)}},
+   {{LL(0x30ac1db6,0xdc21603c),LL(0x1dcaf34f,0x9a7e4856),LL(0xe98f8d37,0x96b72bc7),LL(0x2347b39e,0x1f612ff7)}, {LL(0xef9f1947,0xd8b493f1),LL(0x28ee59ec,0x2fbbe543),LL(0x33e01547,0xf48b47d0),LL(0xae812d8f,0x9a6c12ab)}},
+   {{LL(0xd7ff8b46,0x15a0e356),LL(0x0328c074,0x1d3a693b),LL(0xe352acfa,0x3f65af31),LL(0x180b989a,0x2f4ea5a5)}, {LL(0xc9f5ccb1,0x38a87bc9),LL(0x0af93b90,0x415b3819),LL(0xa5760523,0x7f674dfb),LL(0x2ebabfcd,0x84929da4)}},
+   {{LL(0x8a944324,0x51e29771),LL(0x70de507b,0x3f46b07c),LL(0xe1e2979d,0x2aae78d5),LL(0xf7b6439b,0x1898177e)}, {LL(0x085cd043,0x3613073c),LL(0x6b38162f,0xd692094b),LL(0x5289b052,0xcdd3cda7),LL(0x9fda9885,0xdb1303ef)}},
+   {{LL(0xad86239c,0x8098576a),LL(0x59441026,0x7a120c51),LL(0x7f09ce9f,0x197ec021),LL(0x31598ea4,0xddac0b3a)}, {LL(0x55038662,0x0527495c),LL(0x3a1e4a65,0x9112996d),LL(0xbd3de4cf,0x987b26a0),LL(0xf6576232,0x97b32bf2)}},
+   {{LL(0x3ad37f5d,0x045b521b),LL(0x7941bc49,0x1e9b8951),LL(0xde1940c9,0xd7003802),LL(0xbb046081,0x31e1701e)}, {LL(0x37108972,0x44a1e144),LL(0x82ecae12,0x7853de83),LL(0xe24fb978,0x1785856c),LL(0xc94bbe6f,0x97c51f6e)}},
+   {{LL(0x89ddef96,0xf3a842b8),LL(0x99e5edc6,0x5603b4d0),LL(0xc55fdc87,0x02536f33),LL(0xa56ae774,0xdaee5ef2)}, {LL(0x1e373111,0x6c8894ed),LL(0x9d9ecf33,0xab8932a2),LL(0x04faf713,0x7c117128),LL(0xfd13b09a,0x5b47bd1d)}},
+   {{LL(0x486a9fbe,0xd9903baa),LL(0xc94229be,0x679b2bac),LL(0xd6cb4128,0x1d3b53d5),LL(0xf02c51fd,0x7bd5f4ea)}, {LL(0x71e3dcb0,0x2befe3f9),LL(0xa1df2e65,0xd82d76be),LL(0x99c97a5d,0x37613c5a),LL(0xba240cde,0xa82bcd1e)}},
+   {{LL(0xa26caad1,0xb75f7afe),LL(0x7a686fae,0xa3e13fc1),LL(0x108f5651,0x2e323f5b),LL(0xb9a827de,0x7366bc6d)}, {LL(0x8b5cff8a,0xf7de360c),LL(0x4b600a54,0x0ec94671),LL(0xf0beb559,0xef3de152),LL(0x54e21088,0x22ac586c)}},
+   {{LL(0xbaf20e49,0xc7829ea4),LL(0x695921e6,0x53842d74),LL(0xe731d4c3,0xaa34cc99),LL(0x1533aaa6,0x6b367268)}, {LL(0xda5709a1,0xc620d219),LL(0xb62f9483,0xa8dcb67d),LL(0xe269adbe,0x651aed2d),LL(0x44506fc9,0x5df65638)}},
+},
+/* digit=5 base_pwr=2^35 */
+{
+   {{LL(0x8a920b0c,0x257cbb5a),LL(0xb4613386,0x4f80e557),LL(0x56f595a0,0x51f71ff2),LL(0x4530aacd,0x7e17e81a)}, {LL(0xf98a3685,0x4750d6de),LL(0xd3065a36,0xabd27708),LL(0x6b1e9af8,0x791e48de),LL(0xbca94409,0x76af6ee9)}},
+   {{LL(0x7c24708a,0xc3f3edf5),LL(0x729aed26,0xa2bdd58a),LL(0x23a0a78a,0xf6a154cc),LL(0x1ac906f6,0x1fa55816)}, {LL(0xf8862578,0x43a53c18),LL(0x10b5662f,0x609b54e6),LL(0xa917fb59,0x799f90a5),LL(0x39ec4c70,0x6324a09c)}},
+   {{LL(0xa6e9bbee,0x03b03630),LL(0x9e3dfb82,0xa622bee7),LL(0x2f4fd54d,0x2d1c0f4b),LL(0x0f6bc5b5,0x55db7a29)}, {LL(0x80fb1627,0x3c04f501),LL(0x12ae13a8,0x089548d4),LL(0x838278b1,0x517e06b4),LL(0x7086838b,0x3ebf5485)}},
+   {{LL(0x5119187e,0xc2797860),LL(0xfaf02439,0x90d6557d),LL(0xe0adbbe8,0xcfd8ae5f),LL(0xb087b69c,0x437a7bd0)}, {LL(0x784da25a,0x02c7ad93),LL(0xa7ee1047,0x608be925),LL(0xe07b67ae,0xc1b14459),LL(0x34d84e59,0x5ff419a3)}},
+   {{LL(0x4eda0d92,0x6bb36d24),LL(0x07fbc185,0x5c26aae0),LL(0x3f263875,0x4f870f29),LL(0xd4693735,0x1ebedcbb)}, {LL(0xa5185b7a,0xc07be0c5),LL(0x8fcf7dfc,0xeb945785),LL(0x80dae162,0xf29f7ad7),LL(0x39ef4b9e,0x5378aa08)}},
+   {{LL(0x04543248,0xdaecb8e7),LL(0xed25202e,0x26480e25),LL(0xd76790ad,0xfa2edfa8),LL(0xb6d0d99b,0xbf541c55)}, {LL(0x1b13a756,0x66f00652),LL(0xe52f23d2,0xb223a80e),LL(0xbd112873,0xae65cade),LL(0x22a5f935,0xd5493e11)}},
+   {{LL(0x4a06a6cf,0x7811047c),LL(0x4491c251,0x5a2a37dc),LL(0xd9cd9918,0x576e9d17),LL(0xaec01959,0x042d1fd5)}, {LL(0x20323689,0xa6831c49),LL(0x61dedce1,0x43a1d326),LL(0x72255b9d,0x72243b01),LL(0xe02ac9ea,0xbb45f780)}},
+   {{LL(0x3861e021,0xd65476fd),LL(0x4c46858a,0x52f846d6),LL(0xd28aaff0,0xc05647c3),LL(0xd8c4e5a5,0x7619286c)}, {LL(0xbde4c525,0x5a07a707),LL(0xae488084,0xada62460),LL(0x8b282577,0xc8a026c4),LL(0x66be4dc0,0x6f22abba)}},
+   {{LL(0x4ed34fbd,0x2d76f93b),LL(0xe7b602af,0x2c698951),LL(0x9ec5fb0d,0x1e661871),LL(0x315cc81a,0x46e31962)}, {LL(0xeb421e0e,0xff8e44f6),LL(0x8937674b,0x4352a2fd),LL(0xfe6c4f64,0x20a5fcfa),LL(0xa34d0750,0xca31181b)}},
+   {{LL(0xd055c424,0xb7802c7a),LL(0x8f65ad90,0x16d2f41d),LL(0xc768af4d,0x67950df3),LL(0xe0ad0bcd,0x77830c6f)}, {LL(0xbf8d2412,0x2336e106),LL(0x85ca88ac,0xb98e8dfc),LL(0xe95e2f7c,0x0e7e9545),LL(0x7b53597f,0xb5e79cf5)}},
+   {{LL(0x6afba1ce,0x6bd7d417),LL(0x7a677e5f,0x33e79f9d),LL(0xffdab699,0x4e3537d4),LL(0xa4285219,0x59eb95af)}, {LL(0x1806a08f,0xd8af8af9),LL(0xd29af50f,0x842e01c7),LL(0x8801abc6,0x3d85bb88),LL(0x60318550,0xf6f2c3c3)}},
+   {{LL(0x67da8c11,0xea5525c7),LL(0x54055c34,0x22b0b254),LL(0x709cb9f2,0x615376d8),LL(0xf5dde98b,0x1249adf4)}, {LL(0x34ee5d1c,0xdc249fa1),LL(0xe1fe0af2,0xb28e9180),LL(0x9f7a7eb0,0xa7c01100),LL(0x585e14bb,0x021b8666)}},
+   {{LL(0x6b7dbef9,0xb271baac),LL(0x8f343593,0x4236b12d),LL(0x437744cd,0x12f36c5a),LL(0xae5401cf,0x7fa732cd)}, {LL(0xfffbb036,0x1ad43f00),LL(0x1a955f3f,0x21bf417b),LL(0xd5e9785a,0x29bfb7c4),LL(0x8492a9a9,0x512cd448)}},
+   {{LL(0xbc6e166f,0x7c035129),LL(0xdb0b7458,0x15ed999d),LL(0xbd5bbeb3,0xa6cf86eb),LL(0x9ff12f47,0xad43e502)}, {LL(0x55132772,0x4327f714),LL(0x532bffb0,0x3a2092de),LL(0x17e79a40,0xe504269c),LL(0xfe6212c8,0xa7fa7a66)}},
+   {{LL(0xbe1ed0c8,0x9df405bc),LL(0x52aea9e2,0xd533620c),LL(0xcd844eb6,0x061535f7),LL(0x4113b0d3,0x2e130366)}, {LL(0x12f94105,0x2318f5d2),LL(0x7247e657,0xe82b3353),LL(0xcd451cb8,0xf1f94428),LL(0xbf4004ed,0x54580439)}},
+   {{LL(0x904f8ff3,0x5410fd7d),LL(0xc2ea9b82,0xf41e2341),LL(0x8a8e0a61,0x3cf9d986),LL(0x905523d5,0x88cee032)}, {LL(0x90500e56,0x99e18cbf),LL(0x54b36dc8,0xc8f503a9),LL(0x9acbd7c3,0x3e47846c),LL(0x59044ba5,0x3d12d02d)}},
+   {{LL(0x9c57952e,0x9f881cd5),LL(0xeaf574b9,0xbb940474),LL(0x7297254f,0xc5e55792),LL(0x1ff80e5f,0x8c69fd98)}, {LL(0x1ac56b23,0x43ce5eff),LL(0xfa6c4425,0x40f2d4a1),LL(0xe6dea36d,0x96f5db54),LL(0x7ecafd55,0x46edbe2a)}},
+   {{LL(0x015056bb,0xd61eb9d1),LL(0xf8acd638,0x29101d3c),LL(0xa07c09c0,0x058a3cba),LL(0x916c41a2,0x22de329c)}, {LL(0x5862d74e,0xce6bf119),LL(0x24eae9b0,0x22bc1ca8),LL(0xf72e5022,0x36879b92),LL(0xb536ed27,0x568c3af2)}},
+   {{LL(0xc522b074,0xddde8aea),LL(0x5dba0853,0xfb65fda3),LL(0x8c165be9,0x9fb9ad12),LL(0x066a0538,0xf02eadde)}, {LL(0x3542d8b4,0xf406e2bb),LL(0x1b487a17,0x6eb6bf45),LL(0xf10c8469,0x19021dd1),LL(0x0dd62d0f,0x89f7fc06)}},
+   {{LL(0x536aeaed,0xc167be85),LL(0xeef97e50,0x25d2afd6),LL(0x285ca29c,0x283bcd9f),LL(0xbfe761bd,0x0596a697)}, {LL(0x1ec9182b,0x1c049442),LL(0x4d0dabc6,0xb80baa62),LL(0xe4d6088b,0x5f9d00ac),LL(0xa4e5af1e,0x00bf17f4)}},
+   {{LL(0x34c91be7,0xb4927065),LL(0x07dfe996,0x38bcda39),LL(0xf4b74334,0x36dc613b),LL(0xcac2e9d0,0xe86d7d85)}, {LL(0x9e02a9a3,0xbd3ccca6),LL(0x791ac0e8,0x95a5c52d),LL(0xc4797f43,0xc67a333f),LL(0x7067ebcf,0x315f15fe)}},
+   {{LL(0xd8a0dc6d,0x6afb2a53),LL(0x11662463,0x1437013d),LL(0x2aab43b2,0xc6085e3e),LL(0xd6e62578,0xc3ff31e9)}, {LL(0x66265960,0xd042bcb5),LL(0x2b150ead,0x1c2ca8ce),LL(0x6be6cdf6,0xf2acb89a),LL(0x56f43da8,0x15758366)}},
+   {{LL(0x04f3e22d,0xcd77dc66),LL(0xd22ed0c3,0xb5ff0675),LL(0xa4be810c,0xd702478e),LL(0x2f2bd028,0x87068882)}, {LL(0x9cf28224,0x634f999e),LL(0x5c4d6821,0x93b34996),LL(0x7602f1d6,0x13e80a0b),LL(0x0070c03c,0x1603ef41)}},
+   {{LL(0x3e05354f,0x6d5afe2c),LL(0x832fa658,0x5bf4c9b6),LL(0x845ac8f3,0x7d727b20),LL(0x19495772,0x19e7b62e)}, {LL(0x240a3c8b,0xa4b68a51),LL(0x2eeeb1b0,0x92a8d7a1),LL(0x80c40190,0xbf29d7cd),LL(0xb9bac35d,0xea17c9c6)}},
+   {{LL(0x052ec512,0xb80c73a8),LL(0x8f8e01a6,0x14b0992b),LL(0xd7348c1b,0xff5e4201),LL(0x271709c3,0xb63621bc)}, {LL(0x5af7527c,0xae4ceda8),LL(0x0e99e875,0xf565ab3b),LL(0xcf18ed54,0xf0b216c8),LL(0xeb9d8152,0xab1c93bb)}},
+   {{LL(0x74f01d08,0xd8dbe4d4),LL(0x1b137185,0xf0709326),LL(0x817848dc,0x1e3f3d78),LL(0x35563dd4,0x641187be)}, {LL(0x234c98ff,0x22ef5851),LL(0x61f60864,0xb194c00d),LL(0x04014749,0x6b331753),LL(0x2bff96c5,0x68d48316)}},
+   {{LL(0xbbe446d3,0xdab3e6ee),LL(0x03d09467,0x5f44f225),LL(0xb8b2b1d4,0xf2efe7cb),LL(0xf1d2421f,0x68efe1d4)}, {LL(0xf6315c02,0xd6670c3a),LL(0x56f06680,0xd728502e),LL(0xdfd2b03c,0xcca6aa65),LL(0x78160039,0xcd9aab0b)}},
+   {{LL(0xb0b3ba23,0x5d275a58),LL(0xf999dacf,0x753b56a9),LL(0x5610258d,0x57ccb6d0),LL(0x6f7c35c3,0xd6d84a91)}, {LL(0x38a8fa09,0x5b1483f1),LL(0x53ddeb68,0x383e18db),LL(0xff16f025,0x86fd396d),LL(0x8cd9a8bf,0x4cb9cfc0)}},
+   {{LL(0x05871313,0x5cd5ee0e),LL(0x06d5d9f4,0xa5ccf359),LL(0x92374e37,0x3d6af952),LL(0xf2ec642e,0x7ea948f2)}, {LL(0x56ea73fb,0xc23e6bf0),LL(0x9eb19e37,0x7d64f06e),LL(0x0260187e,0xa45859aa),LL(0xc3068fd7,0x18b5bc08)}},
+   {{LL(0x1c25a996,0x41d015aa),LL(0x316eb548,0x21a2188f),LL(0x7103a1fc,0x995b61fc),LL(0x1e0bd855,0x861df51c)}, {LL(0x1c956a76,0x40238ef0),LL(0x26d626b7,0xd5c7d20f),LL(0xc6933d63,0x318eb19d),LL(0x3320cafd,0x86b5fcf7)}},
+   {{LL(0x176fe157,0xdd68a270),LL(0x447eeffe,0x3f80f72e),LL(0x6cc91f8b,0x4d8109fc),LL(0x023bb419,0x415826db)}, {LL(0x59d1b1bc,0xb9f86473),LL(0x50f9995e,0x25b3ea1c),LL(0xbae70846,0xd444412d),LL(0x2988e874,0xc2f5b81a)}},
+   {{LL(0xa31d9e68,0xb4cbe1f9),LL(0x81a39a40,0x753e44ad),LL(0x955bbf75,0x24942a08),LL(0x5f040b8b,0x237e206f)}, {LL(0x8a3e0d60,0x463c8a16),LL(0xb66b0f39,0x51296c3f),LL(0x76ca47b8,0x1436c2e8),LL(0x4267c78e,0x67b2db2a)}},
+   {{LL(0x175cd222,0x6d7d40bd),LL(0x8764bb9b,0x0a586c66),LL(0x1d2368d7,0x3de362f2),LL(0xc11ca51e,0x44dba07e)}, {LL(0x1508cd59,0xba35225f),LL(0x3255d764,0x4413230e),LL(0x2c87e301,0xedad83d3),LL(0x9c616100,0x11ec9adc)}},
+   {{LL(0xaee95185,0x56ea388a),LL(0x541882b6,0x01ce5bbc),LL(0x6d4815d7,0x79ab40b7),LL(0x0031ef43,0x5be495a4)}, {LL(0xa9b09bcb,0x4fa079f7),LL(0xb228bb86,0xadc86ae8),LL(0x22f85924,0x7514a1c6),LL(0x88124abd,0x5757a455)}},
+   {{LL(0xc76031c5,0x15b0448c),LL(0xf1e83017,0x6871696f),LL(0x892cc2ae,0x651d07bb),LL(0xbe4d303b,0x582ae5a9)}, {LL(0xc4f05c83,0x71815f56),LL(0xaf958265,0x48bdfe08),LL(0xd09c1503,0x8a71b0fa),LL(0xf761b92e,0x0c991ec9)}},
+   {{LL(0x298feeeb,0x881edbf8),LL(0xbe1c031d,0x97289b39),LL(0x3ffb9652,0xf25be310),LL(0xc01694a7,0x0b3026ef)}, {LL(0xd0780bd1,0x7d77b988),LL(0x0885fbad,0x84fbd312),LL(0xe16adc7c,0x8dffd6dc),LL(0x79eec69d,0x43b49c37)}},
+   {{LL(0xeff92db1,0x3b4d45a9),LL(0xc7e734f9,0xd2b8114f),LL(0xe87af56f,0x1b57922d),LL(0xe83ff6bb,0x4c13c78f)}, {LL(0x60fecb6e,0x5e565ec5),LL(0x9f0a747f,0x9fea56a0),LL(0x90f97898,0xfcfb7b0c),LL(0xbaab7e9f,0x30c63847)}},
+   {{LL(0xa24d7872,0x28c5b8cc),LL(0xe8a6efb2,0x9e954a41),LL(0x9cc7a43d,0x4caa524e),LL(0x635f2f94,0x9fffcfe7)}, {LL(0xd62e5b5f,0x6c83049e),LL(0x74579624,0x912e6147),LL(0x8348fb73,0xd3701f60),LL(0x8b0adfc5,0x50604d24)}},
+   {{LL(0x0d083d62,0x15f58f20),LL(0x3f5d3403,0x5c8a1260),LL(0x87280eee,0xe2b2a242),LL(0x4f37dd1d,0x8357e08a)}, {LL(0x8de15065,0x89a0cb4b),LL(0xecdb153c,0x99300ea1),LL(0xa431dbf1,0xce005557),LL(0x8dc642b6,0x2252b42c)}},
+   {{LL(0xeb617e31,0xca0bca9e),LL(0x7c79d226,0x6f4feca1),LL(0x16621328,0x736e3488),LL(0xe15ed846,0xc9a25894)}, {LL(0xdc6b2db7,0xa200db2c),LL(0x1e073b6e,0xfac0cdc9),LL(0x951dbdfc,0x0da07b89),LL(0x96371634,0xb631672f)}},
+   {{LL(0xda1d94a0,0x98fafab6),LL(0x462b7dbf,0xa00898b9),LL(0x07f24e5d,0x06f37e5b),LL(0x8536a6cd,0xf7a7a87f)}, {LL(0xba189ea3,0x0728a226),LL(0x57141e9d,0xf8061cda),LL(0x51c80d12,0x6f54aa44),LL(0xeda90e20,0x33da68cb)}},
+   {{LL(0x14770db4,0x02c60ff3),LL(0xac4cf3fb,0xb86cd6b9),LL(0xd89461fd,0xccf907a6),LL(0x9e9165b4,0x200067d8)}, {LL(0xe295b7de,0xb2f480b9),LL(0x1f969065,0xc6985a77),LL(0x5cd87a7d,0x34c18e08),LL(0x6fba9206,0xc4788aee)}},
+   {{LL(0xbb96b9fe,0x3d3b6c66),LL(0x1bf87e8f,0xd85878da),LL(0xb9992cf4,0xffc24290),LL(0x027648ad,0xd1b38f86)}, {LL(0x5e7d7014,0x8d1ba142),LL(0xe1a58120,0x3d26c81a),LL(0x6f86865d,0x00f6857c),LL(0x75d38d77,0x6f255ddf)}},
+   {{LL(0x35bc9ba5,0x7d5a16ea),LL(0xd7825351,0x189d9586),LL(0x14a66d56,0x7892527d),LL(0x45a0454f,0xb404809b)}, {LL(0x813b5adc,0xf2a299fd),LL(0x3d36d761,0x87552737),LL(0xdf9e8536,0x3445366e),LL(0xf5a03104,0xfc884869)}},
+   {{LL(0x0266f0fb,0x68f0836b),LL(0x90a9d1cf,0x1ddd6e68),LL(0x37e61fc2,0x4623c1f2),LL(0x426f54ef,0x8de9f0cd)}, {LL(0xf840156d,0x17165c51),LL(0xc7b5cc28,0x0bba19b7),LL(0x7ff4de61,0x8b06afb9),LL(0x6225df6b,0x01d20d2f)}},
+   {{LL(0xd8254f48,0x04df4241),LL(0x7ad56002,0x99b9093f),LL(0x3d26e962,0xc6444d47),LL(0x2411c96f,0xc7e692aa)}, {LL(0x32413a38,0xb18b9791),LL(0x8d7dfc40,0xbcf338de),LL(0x9f5b9cb0,0x34ddb63f),LL(0x5d4d233b,0x35d34fd9)}},
+   {{LL(0x9e3bee8e,0x11f92f81),LL(0xe0d3ddf0,0x8179469d),LL(0x6023c840,0x6dae6621),LL(0xf03b7af1,0x9d289a37)}, {LL(0xb59c07b6,0x320de33c),LL(0xf3f84464,0x5a149c7c),LL(0x384e886e,0x00506d4a),LL(0x5bd06d30,0x99487ef5)}},
+   {{LL(0x765a6c39,0xa687f716),LL(0x650a9b29,0x709f5885),LL(0x390ce840,0x45ddf2a9),LL(0x1148bcce,0x06325ce3)}, {LL(0x0e90ebc9,0xacd03b37),LL(0x6fd9aab9,0x0f339c3f),LL(0x6bec30ab,0xa99d773b),LL(0x09646475,0xe67bbcb9)}},
+   {{LL(0xa3c8dafa,0xb6a47123),LL(0xb3f39689,0x1b5694c2),LL(0x32a29300,0x219661f7),LL(0x487619d2,0xfa9bf7c6)}, {LL(0xb7824262,0x62563980),LL(0x63f0a1b2,0xdadecdc3),LL(0x6980317b,0x2cdd2f16),LL(0x97db6f7e,0x4dd19242)}},
+   {{LL(0x449221fb,0x582e783b),LL(0x54260b98,0x0e750c04),LL(0x04a3a799,0x07f2ecbd),LL(0xca764eb5,0xbb7eb876)}, {LL(0xb72773da,0x6f5d3aa3),LL(0x5c58afe1,0xa6453632),LL(0xf8936ebd,0x7dded023),LL(0x376a0b31,0x9ad1eb48)}},
+   {{LL(0xea440df2,0x7d5f13bf),LL(0x28f95faa,0x828a770a),LL(0xe48ea1da,0xf833b2a2),LL(0x703e4e83,0xf2d95d63)}, {LL(0x6801f457,0xc62318ee),LL(0x62634b37,0x032fab8c),LL(0x5645b425,0xa7d8365a),LL(0xebd597d9,0x7e53f3ce)}},
+   {{LL(0x7bce0cc9,0xdac78a72),LL(0x26e742d2,0x47f7748d),LL(0x2386a04c,0x88f48520),LL(0x2b1eb9c6,0x5697825a)}, {LL(0x92443b31,0x062ebed4),LL(0xd27bcaa9,0x50a28e83),LL(0x9a240b5e,0x87d22302),LL(0xcdce6ee4,0xd1b84e70)}},
+   {{LL(0x560d4e58,0x7cc2d316),LL(0xd245bfa4,0x56d4625b),LL(0xe2f7afd7,0xc21d440a),LL(0x6a00f31b,0x560f58ab)}, {LL(0xfb04ba81,0x851634d2),LL(0x76e9d192,0x224ee0bd),LL(0x55dd0431,0xfe199a9e),LL(0x178a3a10,0xb000b4c7)}},
+   {{LL(0x7f16284b,0xf8f7b171),LL(0x23a1c714,0x6599db07),LL(0xdaba9964,0x6056cb93),LL(0xcb0855e3,0xc583347f)}, {LL(0x7d87470d,0x7f699695),LL(0x95107acd,0x5ca8e065),LL(0x6e144c4e,0xb1a3db13),LL(0x6f430d12,0xf199f5de)}},
+   {{LL(0xba6cbd80,0xaf683d2d),LL(0x757cb4bf,0xf890af4f),LL(0x82c7067c,0x8462fc0c),LL(0xd8cd6f66,0x03441056)}, {LL(0x6f20cb26,0xaf5b490c),LL(0xad80d673,0xf0ec63af),LL(0xb712a6bb,0x315de8fe),LL(0x05de6f81,0xfa1fd655)}},
+   {{LL(0x581b06e7,0x030714cb),LL(0x90b5915f,0xfa8f5b77),LL(0xd7e163ee,0x68d840a7),LL(0x0020c472,0x13fe38b1)}, {LL(0x7afc29f1,0xb51ef9f9),LL(0xb03e8075,0xbfeb71d7),LL(0xdbd7811a,0xb006cb5a),LL(0x436da1be,0x7078b912)}},
+   {{LL(0xab1f9053,0xee0facac),LL(0xa5537449,0x76d28abe),LL(0xc0d319f7,0xc146090d),LL(0x9df0c5bc,0xfd07f1b7)}, {LL(0x12a18a96,0xaddfb37f),LL(0xc7093b00,0x8bace9c7),LL(0x7390bb5a,0xfa3d5aac),LL(0x1d441ccc,0x0d0c70b1)}},
+   {{LL(0x9025d394,0x04a011e8),LL(0xbd46bfdd,0x5d7881f4),LL(0x2b418f47,0x218afa1c),LL(0x611d8b2b,0xbd7ef683)}, {LL(0xcbaed6c3,0xec711eed),LL(0x2e9d7afd,0x9c2b5f47),LL(0x20d5d33f,0x9a839ef4),LL(0x7d10cb59,0x9a2574da)}},
+   {{LL(0x36e5a4ab,0x92f18383),LL(0xd80d6458,0x82044f63),LL(0x5db13e0e,0xbeffa605),LL(0x67b29692,0xf0fff6a9)}, {LL(0xf11fc09e,0xafef3434),LL(0x26607b78,0x6e66198a),LL(0x1bd8e025,0x6d61dbb2),LL(0xf8cc371a,0x8550dd21)}},
+   {{LL(0x1bf4d92a,0x27c513fb),LL(0x8e739a0d,0x7754ad2a),LL(0xb2059117,0xb878cfcb),LL(0x115a7abb,0xc31404fb)}, {LL(0x2dd8ed66,0xac4c0c8c),LL(0xa04a860e,0xf6ba45e9),LL(0x3dad0fa1,0x3bf5a880),LL(0xaaf2b18a,0x15b07899)}},
+   {{LL(0x4ff8c56d,0x2d1600d1),LL(0x1257ba25,0x934d7dd9),LL(0xc98ef4bf,0x5a8774a3),LL(0xe1d07c93,0xb1159170)}, {LL(0xd82cd4ee,0x4df19bb9),LL(0x9d0161f6,0x74fcad1a),LL(0x092a16c9,0x9c83bd74),LL(0x81d301c2,0x2f988e8b)}},
+   {{LL(0xe75bfee4,0xeb713c34),LL(0xdae3fbd0,0x91795cc6),LL(0xf16e5ccb,0x58177d97),LL(0xf1480e12,0xbae253f0)}, {LL(0xb5f10a7c,0x0b79cd67),LL(0xfec6b813,0xd78c631b),LL(0xaed78c9b,0x54a77a5f),LL(0x60d24219,0xd600235b)}},
+   {{LL(0xbae3b75f,0x8973ddf6),LL(0xecd8afb1,0x4d847049),LL(0x95a735c5,0x2e320979),LL(0xa90bd553,0xa4058c04)}, {LL(0xe817d861,0xc7d154af),LL(0x3a4ab628,0x4084e2bf),LL(0xc7855fe7,0x6e952f70),LL(0x97d38b7c,0x4478055e)}},
+   {{LL(0xea5908bf,0xd768a66c),LL(0xeb0d786a,0x7cb5e512),LL(0xebcd49f6,0x32f9b0b1),LL(0x4503f651,0xf806f94a)}, {LL(0x3cdbdb9d,0x054b9804),LL(0x9f86dc68,0xb57ec65d),LL(0x2b5d1585,0xdfc7db25),LL(0xbd703bc2,0xd5db3f73)}},
+},
+/* digit=6 base_pwr=2^42 */
+{
+   {{LL(0x4129572c,0x7ab495bc),LL(0x0d5137d9,0x4289b0a5),LL(0xdb487d1a,0x53ccf567),LL(0xe1db2c41,0x09f113c2)}, {LL(0x7ed1e6db,0xb690faa5),LL(0xfa691934,0x5a1d2e66),LL(0x3dbac5ba,0x137b2a60),LL(0xc0f893f4,0x6db7f694)}},
+   {{LL(0x814121a8,0x5c205af8),LL(0x6eca3cf1,0x9d4309f3),LL(0x19c46f7f,0x4c8277be),LL(0x5f603436,0x9e8f6db6)}, {LL(0xd2402997,0x852871ef),LL(0x8eaf049d,0x322f8a8b),LL(0x2aee808e,0x83eb828b),LL(0x869396af,0x879cff57)}},
+   {{LL(0xaeda1784,0x6caac6a8),LL(0x9fcf9a7f,0xb9912426),LL(0xecc76665,0x33d3e59e),LL(0x8002731f,0x64fc7932)}, {LL(0xe8f1804c,0x07df21de),LL(0x79446a7e,0x4a226dc1),LL(0x81395930,0x13b40565),LL(0xca8f9f00,0xfc942dec)}},
+   {{LL(0x9cf3a610,0xfbb078b0),LL(0xb186da90,0x6885d7d5),LL(0x95203846,0x95ed09e9),LL(0x26026494,0x16a106b3)}, {LL(0x47bbfbe4,0x5197f54b),LL(0xb63c5137,0x41056d98),LL(0xccfa9b0c,0xa2490613),LL(0x5ee9146f,0x660bd814)}},
+   {{LL(0x09481f0f,0xe0bc900c),LL(0xbd6e6164,0xc3e0c562),LL(0xa95ef0e9,0xadd1794b),LL(0x6d9f3a9b,0x909393b8)}, {LL(0x44c90ba6,0x2616d41e),LL(0xaee5df51,0xf3569a04),LL(0xb9527d6c,0xc101acda),LL(0x9fd168b5,0xb045b3ce)}},
+   {{LL(0x5ae634d3,0x16aa6f9c),LL(0x8db45cec,0x6c8093a4),LL(0xe1df5266,0xaa0b7773),LL(0xed84401e,0x205afb8e)}, {LL(0xdc08c172,0x1694cfc2),LL(0x4d8f12ef,0x3b9e3437),LL(0x33e12319,0x60e1f28a),LL(0x517e5cdb,0x70243c74)}},
+   {{LL(0x6ac8581c,0xdc597feb),LL(0xa2e1df3e,0x9a6e2f4f),LL(0xa5678768,0xa75850f1),LL(0x501df5fb,0x3cda38d1)}, {LL(0x1b2c0aba,0x8a2a21a9),LL(0x6ce86736,0xd720ef44),LL(0xd6453e1f,0xbde36120),LL(0x60c35a5c,0xcbc15329)}},
+   {{LL(0x677fa8a8,0x91018dec),LL(0x69473bdf,0x1b96f6d6),LL(0x6df7a88c,0x18fe6127),LL(0x750e7dac,0x058b1bdb)}, {LL(0xa31a3108,0x7fb0ce1b),LL(0x0dbc3ff8,0x55ed7c61),LL(0x4b1a54fe,0xe29b0dbc),LL(0x610987cf,0x69c554ac)}},
+   {{LL(0x2fbbf0f5,0x396d6849),LL(0x633794d4,0xedb86027),LL(0x7780cf9e,0x4daf7cdb),LL(0x074c4913,0xdf0c20fe)}, {LL(0x6b9e988e,0x643ed220),LL(0x44ad867c,0x6c4f3463),LL(0x55732a96,0xf6038fea),LL(0xc9cedab4,0x6f208178)}},
+   {{LL(0xaacffcaa,0x458ac6ae),LL(0x31128469,0x6c2e8724),LL(0x43a2c1df,0x1fa06b92),LL(0xc17c39aa,0x3a0240a0)}, {LL(0xe47931a6,0xa359bad6),LL(0x8c551573,0x46d841fa),LL(0x94afd8f5,0x00e7d4c5),LL(0xd505c065,0x0619abc8)}},
+   {{LL(0x74b2d15d,0x4e0d67be),LL(0x0cbcfb11,0xf1797990),LL(0x30e3f497,0x38f4f8c6),LL(0xc0cb5fc0,0xb20f34fa)}, {LL(0xb62a3448,0xad78c79a),LL(0x172f6191,0xde5fce01),LL(0x132d4d12,0xc9e4f64b),LL(0x3ae195ef,0x606a3ef0)}},
+   {{LL(0xd74adf62,0x29665eaf),LL(0xb5e65a35,0xabf7ebd2),LL(0x9b28897c,0xfa734972),LL(0x94cc53de,0x1fb7be64)}, {LL(0xa046f0cd,0x2c965c9a),LL(0xb7825d93,0x30d20759),LL(0x7f202308,0x9ad6fab1),LL(0x6687e64f,0xac4e7e7d)}},
+   {{LL(0x6fa93f9d,0x708a0809),LL(0xcc19f11e,0x0f7d858a),LL(0x1136caea,0x3f5a0203),LL(0x5d1f4c74,0x9f557ecf)}, {LL(0x0b24d98c,0x1093c8ff),LL(0xf842cf6e,0xd847e9d5),LL(0x0f370242,0xc69a8435),LL(0xbfb25111,0x4bdba0d5)}},
+   {{LL(0xde37c084,0x1cceb45d),LL(0x613ceb88,0xf54df984),LL(0x8ad3de2b,0xfb73744e),LL(0x77743734,0x9accdee5)}, {LL(0xf0b168a6,0x4a9666eb),LL(0xba387a11,0xd514b308),LL(0x28f92686,0x0b34d361),LL(0x9b8d1c21,0x778cb2cd)}},
+   {{LL(0x78f0859d,0x56bf40b4),LL(0x913f06b3,0xfa849c0e),LL(0x59511f82,0x4f5bc55e),LL(0x9751adfe,0x03834b01)}, {LL(0x03211e57,0xb996f422),LL(0xf1457a45,0xde288dfc),LL(0xb76c0395,0x68d81258),LL(0xef1252d5,0x164aea97)}},
+   {{LL(0xf753150a,0x8ab509c1),LL(0x08453c11,0xb5738e4c),LL(0x39433bd4,0xe75bc57f),LL(0x6b323296,0x25c1b8e0)}, {LL(0xaa3bb357,0x5fe6c386),LL(0x3c447acf,0xe59d1de9),LL(0xe166ace1,0xe8a4304a),LL(0xf3697af9,0x28f397f3)}},
+   {{LL(0xcbb0cf57,0x53ba1ad8),LL(0xa76df9be,0xb400d312),LL(0x77cb5751,0xbf0b1cdc),LL(0x7dfd26ea,0x83564ceb)}, {LL(0xe1b9067b,0x2d11c081),LL(0xb31e56df,0x80c93202),LL(0x0d4df702,0x9d761b65),LL(0x902831e8,0x2ffcafdf)}},
+   {{LL(0x8ffde36e,0x13171ead),LL(0x54469909,0xbb143896),LL(0x39450242,0x7afef8ad),LL(0xae6e09f7,0xffc12ce4)}, {LL(0x33c86490,0x78868d24),LL(0x586d1011,0xd804eacd),LL(0x6c8e192d,0x07d07934),LL(0x3ad480df,0x02a120b1)}},
+   {{LL(0x675e8865,0x2b43067a),LL(0x77888dce,0x37617e62),LL(0xda16bdae,0xd5586bf8),LL(0x4eca8f0d,0xabd300f9)}, {LL(0x6164e5e1,0x9fbd2074),LL(0x16adb64f,0x2e4ef586),LL(0x1fd2d03c,0x912bd6c3),LL(0x822c4cc3,0x21d3cebb)}},
+   {{LL(0x9d13cd7c,0x772e609d),LL(0x692b094c,0x0078c6ee),LL(0xf636431a,0xa65bebcc),LL(0x7a004bc8,0xc3f33c62)}, {LL(0xbb2873ba,0xc8f7d02e),LL(0xdecdae1b,0xf94713c3),LL(0x9365469d,0x0788445a),LL(0x49976891,0x5bb3af6b)}},
+   {{LL(0xc909a78d,0xef9224b5),LL(0xbd1d937f,0x5ee5ad45),LL(0x8dee0ae6,0x95daf21a),LL(0xf8457dcc,0xb0999541)}, {LL(0xb70752fc,0xc44a7f79),LL(0x317f1cc2,0x2f94c55a),LL(0x02ff1738,0xe05bf19e),LL(0x93d75ed9,0x64b259dc)}},
+   {{LL(0x41a5434f,0x9891c59d),LL(0xcc75d49d,0x4f3e6d67),LL(0x5a1200e3,0xbeee822e),LL(0x21937759,0x4d21e654)}, {LL(0xb1dc1bb3,0x1f56a48e),LL(0xe8e238b3,0x728c02a0),LL(0x36b5bb24,0xc0743b3e),LL(0x1b94a28d,0x43d50e0e)}},
+   {{LL(0x95b4f538,0x169f3fbf),LL(0x117edeb4,0x14ee0319),LL(0xb17f10d5,0x1c60bd6d),LL(0xfcd1bbef,0x89cd5d7c)}, {LL(0x8fb283f2,0xfb3b4d9f),LL(0xebd92e30,0x503c7064),LL(0x0fed1a04,0x8196c257),LL(0x3c0bd1a2,0xd4e5ca27)}},
+   {{LL(0x517bb70d,0xdb82a8b4),LL(0xa3f57688,0x0adffb8c),LL(0x3083273e,0x8b2132ee),LL(0x9e916271,0x2cd8715b)}, {LL(0x624769dd,0xa55491d0),LL(0x9fea3ea5,0xa9d03db6),LL(0xccf844b5,0xaa784140),LL(0xaae950d4,0x10fb3e5a)}},
+   {{LL(0xb4648252,0x502794ab),LL(0xffc59db4,0x45824ce7),LL(0x3388d95d,0x4f56322b),LL(0x3718b1e9,0x78ee1e99)}, {LL(0x4195af70,0x0fb8f236),LL(0x2e3ae1cf,0x35bfbef3),LL(0xb2b76f90,0x7f11ec29),LL(0x97099ad7,0x4a6455d2)}},
+   {{LL(0xe8e1a8e1,0xf1b57359),LL(0xfb03acd3,0x8ae5d6f9),LL(0xf520b22f,0x0afd6882),LL(0xd31aa71c,0x0075d994)}, {LL(0xe06ce27c,0x0cb1c1c1),LL(0x9eb7eb97,0x3e5d56c1),LL(0xb344c5e6,0x0949e36f),LL(0xbbb583cd,0xbb6bae10)}},
+   {{LL(0xbdc78d09,0x0d01736c),LL(0x3c584335,0x248da695),LL(0xa36b30ba,0x90971af2),LL(0x475cb6bc,0xe2bcf902)}, {LL(0xcfa1371f,0x85a4c6b3),LL(0x1d6ec881,0xf093e021),LL(0x533db982,0x7e07f5c3),LL(0x188f6ea8,0x47ef6cd0)}},
+   {{LL(0x322b782f,0xc170b473),LL(0xbb4963fc,0xd6702d75),LL(0x9cae193d,0x045b497d),LL(0x04bf304e,0x401505f6)}, {LL(0x089992c9,0x1c381826),LL(0xff88b6d0,0x07658a7c),LL(0x62377637,0x3450ca87),LL(0xde142ea4,0xd762c36d)}},
+   {{LL(0xa587d55d,0xa64203af),LL(0xe25b4289,0x9c4ab4d2),LL(0xed2a11df,0x0cf91ff2),LL(0x987c6e6f,0xd1b787dd)}, {LL(0x3ac6f42e,0xd86edd33),LL(0x0ce1bb76,0x93630b85),LL(0xfb032819,0xf161f8fa),LL(0x189070c1,0xb50cb402)}},
+   {{LL(0x7cf18f01,0xaa338b82),LL(0xf4b507ab,0x6869c5b6),LL(0xe557c8c3,0x4ceada89),LL(0xd7ffa106,0x599910d0)}, {LL(0xa845438b,0x058db3f5),LL(0x85cff9e3,0xfe0eac27),LL(0x5a940e78,0xa07ab478),LL(0x333c3b8a,0x14528e1c)}},
+   {{LL(0x5fdef1e3,0x8ea3dc72),LL(0xb32fe22d,0xb4e5b6fd),LL(0xede4f55b,0x769a002b),LL(0x3756721e,0x480e72e7)}, {LL(0x57ef846d,0x4c46cade),LL(0xe885c6f5,0x23bcbbdd),LL(0xc10fbbfc,0x00c29a4f),LL(0x0f347390,0xc1ff06ea)}},
+   {{LL(0xfe9879e5,0x29a703ac),LL(0xe0fbd943,0xcc7f5c07),LL(0x32b77e29,0xf2531ea1),LL(0x32f4295f,0x312735ee)}, {LL(0xa2e525a9,0xdc2a8357),LL(0xecbc8ab4,0xf720f228),LL(0xcbd8796d,0x381526cb),LL(0x75e0e134,0x7c76ac3d)}},
+   {{LL(0x9054eb27,0x3232fbf3),LL(0x90e1f639,0x391b0077),LL(0x4f02f4ae,0x82670f94),LL(0x1d3f25f7,0x34d4f7a2)}, {LL(0xf558a458,0x7bfeae21),LL(0x551e6ea7,0x53b3dd79),LL(0x3073f5d7,0xe6199c93),LL(0xfb2c2a2f,0x412622d5)}},
+   {{LL(0x37823193,0x18f46485),LL(0x31e1be48,0x680a5a0d),LL(0x8036364e,0x3a391475),LL(0xcb1d0a9b,0x7e3f0825)}, {LL(0x96aaec01,0x98bd40cc),LL(0xbb7c23df,0xc6b9f634),LL(0xe82fdfcc,0x55d19415),LL(0xa3b777f4,0xc2fb0391)}},
+   {{LL(0x3f8c853b,0x8b114ad1),LL(0xddbeb94d,0x4e3e06b9),LL(0x68ee95b1,0x9182f2a8),LL(0xa6cc3f23,0xace7533c)}, {LL(0xbd1a9814,0xb66834e5),LL(0xd86aedfd,0xd2041557),LL(0x7c193877,0x3427a247),LL(0xa704a47a,0x82cfafcc)}},
+   {{LL(0x7d31afc9,0x0c0ff02c),LL(0x7831c4a7,0xf21771c0),LL(0xde7440d6,0x4831ba08),LL(0x3c1571b9,0x0b325f05)}, {LL(0x72a0395d,0xbc5f7dad),LL(0x01de0d58,0xe3edb5d4),LL(0xe22d1c48,0x7905874c),LL(0x2a4e8c36,0x1a3caac5)}},
+   {{LL(0xdb102fe5,0xadba9933),LL(0xe1f2e7be,0x64139568),LL(0xca7b979c,0x621dc3f5),LL(0x9e19c09b,0x3a0540c9)}, {LL(0x8a0ff72d,0xbc9b40af),LL(0xc5218a4d,0x1d12cc05),LL(0x189f1c3d,0xd8df5202),LL(0x04466bb4,0x179e50c1)}},
+   {{LL(0x18a294e2,0xd248a08b),LL(0x1ca6beab,0xb3097638),LL(0x4eb1baca,0x8a510243),LL(0xb969c6c9,0x017a8159)}, {LL(0x18d934f9,0xd47243b5),LL(0xbc6c5364,0x7d6df462),LL(0x5db5a5e4,0xa0024026),LL(0xb97f8fdd,0xe7698e0e)}},
+   {{LL(0xe002cb3c,0x82f247f6),LL(0x39cf057f,0x0b6c0267),LL(0xf9af8a18,0x2f61c916),LL(0x1a123e22,0x788e7773)}, {LL(0xd7eb0c7a,0xb1204eb3),LL(0x1d6ec91d,0xdb26d895),LL(0x9bc3891c,0xb1de5bba),LL(0xf05eae27,0x859372ea)}},
+   {{LL(0x9a883a4f,0x790622b7),LL(0x5c7151f8,0x98f73033),LL(0xc190ef08,0xf0a15c6e),LL(0xba984245,0x9a43c8b9)}, {LL(0x2b894790,0xab1ab5b4),LL(0x2785e0b6,0x23d7b8be),LL(0x640d9e3f,0x4d355dfe),LL(0x93028d3e,0x857a4263)}},
+   {{LL(0x4e5fb5f6,0x364875bc),LL(0x2daefec9,0xb6469e46),LL(0x6602c050,0x7ce7f952),LL(0xb73af5eb,0xfa906395)}, {LL(0x0f11a35a,0x89d95ae0),LL(0x57e064bf,0xc09d7a75),LL(0x2e75a8cb,0x0f41d576),LL(0x515b7558,0x60d98321)}},
+   {{LL(0x2cd9ebfe,0xe84d6615),LL(0x0feab754,0x61e68516),LL(0x86c9a37b,0x2ff7c012),LL(0xc3e390f0,0x877b99c3)}, {LL(0x4572d8f9,0xac7accb3),LL(0x0ff675f0,0x02eabda2),LL(0xc3ea8534,0xf623668d),LL(0xb70b2075,0x046c16e2)}},
+   {{LL(0xd233d120,0x950a5332),LL(0xa7df8d71,0x3ae8325b),LL(0x90965e17,0xad3637b0),LL(0x106c1142,0x45daea54)}, {LL(0x5e6d3096,0xee32d3af),LL(0x2d674c04,0x3cce9ed1),LL(0x26ef51f5,0xfe5eba55),LL(0x123e4331,0xe4347b56)}},
+   {{LL(0x1ffeb124,0x99196517),LL(0x893c67de,0xcfdfb46a),LL(0x1f2d8b44,0x94282f97),LL(0x0849ae43,0xf5a36180)}, {LL(0x62c16233,0xdf92ff74),LL(0xc4c4cb29,0xc3285b08),LL(0x2d099609,0x022b33bf),LL(0x8ce7bf89,0xdf54ff5c)}},
+   {{LL(0xaa4133d0,0x893a493c),LL(0x8648f2e6,0xecbd3ef8),LL(0x850daa4c,0x55d3e3d0),LL(0x3f9c2df7,0xdb3fa789)}, {LL(0x915abe89,0xd4ff5087),LL(0x8e2b44ff,0xf213ced8),LL(0x6da163d5,0x12986c63),LL(0xeb8554a7,0x8469f81c)}},
+   {{LL(0xcfe339a9,0x02771c16),LL(0x54c1ebf9,0x59dacbaa),LL(0xcbb59098,0x808daa6c),LL(0xaa6380fb,0x3062bce4)}, {LL(0x8d9a3827,0x0a48e696),LL(0xea2953e6,0x3efa0eec),LL(0x10dc2474,0x0eac3a66),LL(0x3a5fd0ee,0xe1f40601)}},
+   {{LL(0x03b3814c,0x21139247),LL(0xc44966fd,0x066b5b35),LL(0xb1a4f2a7,0x7c26de6c),LL(0x4d878873,0xdf564364)}, {LL(0x2871865a,0xaeced036),LL(0x89988d2a,0xf0f546f4),LL(0x4a3f75c6,0x770c14e2),LL(0x425cb4bb,0x5860cbc0)}},
+   {{LL(0x624f3df9,0x46adfead),LL(0x9a18c5ae,0x7d652daa),LL(0x3570aea4,0x570e49a2),LL(0xbbae014e,0x43c34264)}, {LL(0x605b1595,0xa2b26e2d),LL(0xf51ab652,0xf6eef9ec),LL(0x1d0b3d2f,0x8a7805fc),LL(0xa7aacdaf,0xe4c51946)}},
+   {{LL(0xe8f200db,0x4f9dad45),LL(0x799f054f,0x0aa7744d),LL(0x0e413e7f,0x1c482b21),LL(0x6bdef47c,0xc23af52e)}, {LL(0x9de79b4f,0xc3b48508),LL(0xca394a02,0x2d9c290c),LL(0x280dade8,0xd489193e),LL(0x33f67eb8,0xa0ffd28b)}},
+   {{LL(0xc109244a,0xa6416868),LL(0xdab7e76f,0xfa47746c),LL(0x025a59c9,0xbd8b83a5),LL(0xe9c85339,0x37a7e10d)}, {LL(0x8e5372a9,0xbfd39c67),LL(0x0cc6f674,0x488ebd42),LL(0xc83a8718,0x5bf27931),LL(0xd3dc19d3,0xee7d4404)}},
+   {{LL(0x3b95e79e,0xbb908a91),LL(0xb9edce81,0x858fac03),LL(0x4ae6847a,0x3235d73e),LL(0x9ecb19e2,0x9ec07bd0)}, {LL(0x40ff52d6,0x8275d983),LL(0x9480b557,0x8c7869a7),LL(0x9db981cc,0x1c33b55b),LL(0x7c199af7,0xeb24112f)}},
+   {{LL(0x159d47de,0x550305cd),LL(0x15551043,0x600b6d75),LL(0x5ce891fd,0xed06ca2c),LL(0xf3c1c2c7,0x47a06f87)}, {LL(0x79a6aef7,0x42205610),LL(0x23a822b7,0xe1761439),LL(0xfcda81a8,0x3205bdda),LL(0x8ad98044,0x6450547c)}},
+   {{LL(0x84aa320a,0x37a45e88),LL(0xe998bc70,0x431b5a6e),LL(0xa52ba368,0x5e3a2ff4),LL(0x73e219df,0xbd79ab96)}, {LL(0x7e6a6358,0x6d4f8f69),LL(0xe4cb6fb6,0x836f2e74),LL(0x237a74f3,0xad8f95aa),LL(0x85f84cd4,0x19c7d327)}},
+   {{LL(0x80601745,0xb9659246),LL(0xfa188812,0x334320bf),LL(0x0e88328a,0xbde66185),LL(0x8ec2bbd2,0x3422625c)}, {LL(0x7792fb03,0x887ed4c0),LL(0x4276248d,0x7c085d3b),LL(0x001d0212,0x586ce472),LL(0x4227fc2c,0xffdcad86)}},
+   {{LL(0xa9860901,0x2c9677a4),LL(0xadf6520d,0x56558edc),LL(0x3171ad9c,0x73e63876),LL(0x4411ea97,0xba0c10fb)}, {LL(0x440a0367,0x395e811e),LL(0x2738b187,0x2071fe1e),LL(0xd0695b56,0x8997f238),LL(0x9d6a5e25,0x29312d65)}},
+   {{LL(0x59c428b6,0xb06f0c1c),LL(0xe26a6ca3,0xc708bc99),LL(0x20ac9eb7,0xed6abbbb),LL(0xee3becf0,0x206a4e1e)}, {LL(0xcff40448,0x4255481e),LL(0xccc9a772,0x88a699a5),LL(0x2b9decbc,0x9309d5be),LL(0x4bf4166f,0xd83dfb6c)}},
+   {{LL(0x1eb28462,0x8b4d5532),LL(0x3ac59871,0x8640b18d),LL(0x8097dbf2,0xfa30b203),LL(0xe6316f04,0x39d13178)}, {LL(0x48e4cab9,0xc01ed2de),LL(0xf825e88e,0x703a1e77),LL(0x544f8fd0,0xd6d25db7),LL(0x545a7496,0xe665233a)}},
+   {{LL(0xb59e6514,0xca5edb75),LL(0x0616cab8,0x96bdce39),LL(0xe4828f9c,0x2de98879),LL(0xce48ab13,0xad2651d2)}, {LL(0xd96ba7f0,0x3d1a1120),LL(0x89f9b57c,0x84a5fae0),LL(0xb8ec84ff,0xa4de2f6b),LL(0x0fad0f90,0x965df027)}},
+   {{LL(0x93736930,0x22e11a14),LL(0x3a374779,0xfc742732),LL(0x3d5ffd9c,0x0316a54a),LL(0x13b6c910,0xb09fb61c)}, {LL(0x5591465d,0xa971e14e),LL(0x4eb0a4a7,0x76b1fbab),LL(0x5ebfec81,0xaefa5d98),LL(0xc6a0bdaa,0xaae94181)}},
+   {{LL(0x0fc158cc,0xfdb802a2),LL(0x72cccc0c,0xf3c4be02),LL(0x5fdacee3,0x87102393),LL(0x2e08a3b4,0xd6771b0f)}, {LL(0x42c1e1ff,0xf84ede0f),LL(0x0608cf05,0xa2eccbce),LL(0x94773c55,0xe9b2382c),LL(0x69ef96de,0xe5d11c4e)}},
+   {{LL(0x7d018399,0xbc724e06),LL(0x9c8b1c51,0xbc13fc93),LL(0xed957b36,0x68234776),LL(0x89a5aace,0x46fd436d)}, {LL(0xdd72d9db,0x6c2c7d2e),LL(0x235e4511,0x81bffd82),LL(0x61068143,0xdb53b6d6),LL(0x08a62d68,0x272cd67f)}},
+   {{LL(0x9df75d84,0xea49f6f0),LL(0xc3106b89,0x3a69848e),LL(0x7e84c701,0x2a6a7645),LL(0x4d98a8e7,0x6766f43e)}, {LL(0x379b1242,0xb8de3ac8),LL(0x9358f973,0x83faa936),LL(0x654c69a8,0x43eccb47),LL(0xe101c670,0xd176946c)}},
+   {{LL(0xb32c43a2,0xcd854fe6),LL(0x91bbdbc4,0x8068863b),LL(0x73fe5ee2,0xc355361c),LL(0x9bdc8289,0x72465061)}, {LL(0x0bb1c7d5,0xaf4ea67a),LL(0x5c8cb22d,0x4189210f),LL(0x677d2370,0xeeea5dc3),LL(0xb1199d8d,0x2404a691)}},
+   {{LL(0xf8690928,0xb6be30d6),LL(0x434ea2e8,0x88b68810),LL(0x4619fa9d,0x3bd453bf),LL(0x65a85a7d,0xf4f354d2)}, {LL(0x6254c4d6,0x91c6edb7),LL(0x5317107e,0xae770d16),LL(0xa81c00a8,0xccadedea),LL(0xed889ed1,0xe646640c)}},
+},
+/* digit=7 base_pwr=2^49 */
+{
+   {{LL(0x7435f8be,0x4fe0a88b),LL(0xd00a39ab,0x9e51a80b),LL(0x53ae3439,0x17895b40),LL(0x63177687,0xe5b769ac)}, {LL(0xb4419d5a,0xb24d8149),LL(0x5e863840,0xaf3cdff3),LL(0x3a65e949,0xb5e37ee8),LL(0x1ddc8491,0x9404d790)}},
+   {{LL(0x40c47099,0x51950cbb),LL(0x0a9b4a87,0x90ad3d8a),LL(0xae1eb361,0x544c3e23),LL(0xa18ce64f,0x1269b5af)}, {LL(0xda9ac0af,0x584bed44),LL(0x3d717c65,0xce3beee9),LL(0xf1a3d771,0x63f33d45),LL(0x6baf45dc,0x79542c04)}},
+   {{LL(0xc2eacdc5,0xce7206d4),LL(0x6e04b447,0xb5d6b7a4),LL(0x9334c66d,0x4a93a8b8),LL(0xef6cc8f6,0xbb1eb0ec)}, {LL(0xf126dfce,0x05a64f57),LL(0x04e0a471,0x523f2dd7),LL(0x2efecb7d,0x2d0d6a54),LL(0x58f33498,0xe24a7ab9)}},
+   {{LL(0xc5c27031,0xb30d3154),LL(0x756cd6c6,0x46dd0e3f),LL(0xbf0d1086,0x1f04aa20),LL(0xaf490e76,0x5e033931)}, {LL(0x78b15ef9,0x133ef889),LL(0xaf1407a4,0x23e9249e),LL(0x336fc35b,0xae3d0578),LL(0x9abea7bc,0xb2036a02)}},
+   {{LL(0xd5f2bc0c,0xc3c23c34),LL(0x1407a7f1,0x35121b13),LL(0x8d09441e,0xac79382a),LL(0x03c8ff09,0x085a457b)}, {LL(0x9ae0a63a,0x5dd9159d),LL(0xc59e756b,0xb2f63cd2),LL(0xfa6940d1,0x9fdde1ff),LL(0xade72f1f,0x3707701a)}},
+   {{LL(0x382fb0b0,0x48b6feac),LL(0x2cbb9b65,0x41ec4814),LL(0x3ef55415,0x9788c2dc),LL(0x7765b527,0x39839e63)}, {LL(0xc7a481de,0xa3eebf02),LL(0x0f4533cd,0x24b2923b),LL(0x734d205b,0xcade127d),LL(0x3a82bead,0xb9e27378)}},
+   {{LL(0x4ab5830d,0xe47e8326),LL(0xa3b38910,0xc243d39c),LL(0xdc0fd5c5,0x807d9eb3),LL(0x8f9ce5ce,0x3a54f2e0)}, {LL(0xc53f085f,0xde4c778d),LL(0x734867ca,0xe28299b8),LL(0xb6b9b82c,0x237c3a81),LL(0xc95db863,0x5ce51d42)}},
+   {{LL(0x5a491212,0x9ff47ea6),LL(0x9b99db72,0xb73df5ee),LL(0x22c654eb,0xfc2b420f),LL(0x0a3c3c7f,0x99d30dc9)}, {LL(0xff60c8b4,0xdc38d58a),LL(0xa82c9b1e,0x88840754),LL(0xcc17b854,0xec5a5d57),LL(0xc944a199,0xf66af64f)}},
+   {{LL(0xcba31e3b,0x46742824),LL(0x96a0c9a4,0xd3675705),LL(0x367d82bf,0x71643109),LL(0xe677a5bc,0xf47dfdd1)}, {LL(0xc31952e7,0x910c8191),LL(0xf29a1544,0xeb7e0aeb),LL(0x01ce24ff,0x0b8c8947),LL(0xf0cdb67d,0x425bf8dc)}},
+   {{LL(0x211f2509,0xa117ac22),LL(0x7e6a8cc6,0x2f41b55f),LL(0x4ea371d8,0x5ecceb27),LL(0xd483305c,0x7189fa01)}, {LL(0x88e14674,0x9cebfcc3),LL(0x6c1620fb,0xfdfd5a50),LL(0x2e2975cf,0xddfb0f80),LL(0xa9a902d5,0xc997846e)}},
+   {{LL(0xd1c00c01,0x2176a491),LL(0x3065a70d,0x2394655a),LL(0x68782787,0xcc2570d5),LL(0xc740b7fd,0x6e353aee)}, {LL(0xd2c06561,0x58f16ece),LL(0xc8a1f795,0x93bde6a4),LL(0x65369a7b,0x47fdb5e3),LL(0xc984cd77,0xdce3df9f)}},
+   {{LL(0x356331d6,0x8db17c8b),LL(0xb2782710,0x62b2c2ca),LL(0x238e883f,0x6e40fbf7),LL(0x6960ad9e,0x5a295791)}, {LL(0x3638a782,0x8449fb63),LL(0x6ad62292,0x6c354e45),LL(0xc528bbbe,0x34bcbe62),LL(0x0cee8399,0xc9228ef3)}},
+   {{LL(0xbd06a045,0x95be73b3),LL(0x5c03407c,0xe0750302),LL(0xa4b3da86,0x85c49ab0),LL(0x954c2655,0xc0836476)}, {LL(0x1aca739a,0x54cb9a00),LL(0x1fb04721,0xb0401114),LL(0x2701962c,0x5740d66f),LL(0xa64f04b3,0x9a4a2337)}},
+   {{LL(0x68dd3194,0x7eba53eb),LL(0x746f8af2,0x905aab30),LL(0x9705d86e,0x995618f9),LL(0xdcba13d1,0x7110614d)}, {LL(0xc53f4fed,0xb09b660f),LL(0xf13c318f,0xf51c1985),LL(0x7c86df88,0x122b674c),LL(0x2bcf8ec5,0x8fb7a0a4)}},
+   {{LL(0x643c0788,0x4bc1ae2c),LL(0x5e1fca05,0xa891e287),LL(0x9a41b807,0x082b4e70),LL(0xe30494fc,0xaead824f)}, {LL(0x7554bfe3,0x5f691d6b),LL(0x94c3261f,0x67ea08f6),LL(0x695e8ab7,0xcf6c0c6a),LL(0x37c303b6,0x79651ab9)}},
+   {{LL(0x00ff6bc0,0x6f4ef699),LL(0x5253ccec,0x49f1efed),LL(0xb6aeff80,0x01591591),LL(0x94c45f30,0x68df46c8)}, {LL(0x9a914825,0x7bfafb21),LL(0xb11e3ae4,0x096f8e5e),LL(0x29be22f6,0x79a8615e),LL(0xc64b3624,0x27ba8d9a)}},
+   {{LL(0x761eabfa,0x86623415),LL(0x5e855e56,0x8dd4e408),LL(0x2f6ac870,0x48cc5c1e),LL(0x64096f18,0x0a4a10a8)}, {LL(0x75818ae5,0x25d1f26d),LL(0xa37ae089,0x011c5261),LL(0x7da3f435,0x8774fdbe),LL(0x0ab1cce5,0x1b9ae4fa)}},
+   {{LL(0x535e7777,0x833c2ad7),LL(0xcece3d05,0xc28ae919),LL(0x3a3ef6bd,0xbabcd389),LL(0xa5dfb028,0x865bff3b)}, {LL(0x37685655,0xa3c2ae84),LL(0x9163ca7b,0xe06cab4a),LL(0x6ebb4335,0xe846c125),LL(0x6a728728,0x2198f30b)}},
+   {{LL(0x6c8ff204,0x630c83bb),LL(0x0ed7f839,0x70e32fb0),LL(0x68b61298,0x54c72e01),LL(0x8fa4b7fe,0xa8ce5a82)}, {LL(0xcdc9fa4d,0xbaf10a3f),LL(0xd51ecb09,0xbf6a9f72),LL(0x823237a8,0xac743440),LL(0x5d6156f2,0xf6e36de9)}},
+   {{LL(0x2756fb09,0xe72dc3e2),LL(0xbbdc2577,0x575f3de0),LL(0x7a366070,0x1c1e5a46),LL(0xd8c7063e,0x057691f7)}, {LL(0xfd7f0b1b,0x60399ec8),LL(0x345df56f,0x0bbb2623),LL(0x78e7ed41,0x320a77f9),LL(0xe37ffc3c,0xacd6bca5)}},
+   {{LL(0xa8aefb90,0xf4e52bac),LL(0xfc2e13ab,0x9d33e50d),LL(0x69cf674e,0xafd5fa3d),LL(0xe950f0e6,0x58ac4b08)}, {LL(0x72e5b1a5,0x2ad03659),LL(0x5a5f6246,0x9a069cd9),LL(0x387f7ba4,0x6bd9017a),LL(0xe131d546,0xd792f483)}},
+   {{LL(0x6c268178,0x27a81f1f),LL(0x49ec264d,0x467a3764),LL(0xb12a182b,0x9733cbbf),LL(0xfdd1455e,0xa7e632c8)}, {LL(0x6a61c342,0xe8463c5d),LL(0xdf19ace7,0xd75adb80),LL(0x54134c15,0x90d581fc),LL(0x478bfc4c,0x42d47645)}},
+   {{LL(0x3fbcf0ce,0xa66a6d82),LL(0x7d5a1a23,0xe2422963),LL(0x783125c1,0x1f4dd42e),LL(0xc6ee0055,0x35db6d41)}, {LL(0xc4aeab76,0xf9f68a4b),LL(0x276ba9fa,0x42138cfc),LL(0x2e5f09fc,0x042b8859),LL(0xa96915e6,0x285cb932)}},
+   {{LL(0xa7653ea3,0x6a5541d8),LL(0x2001defc,0x852c403e),LL(0x1f9919f8,0xc00a872a),LL(0x3597fa24,0x7ad62f63)}, {LL(0x036b7112,0xf17c9c39),LL(0x9fcbc34a,0x2b286a2f),LL(0xf0371dd4,0x798f8b80),LL(0x8468d228,0xb15fd6ac)}},
+   {{LL(0x22d9c5e8,0x1c140003),LL(0x2fe409dc,0x6aadf0fd),LL(0xc9e3f1ea,0x3c04199f),LL(0xebcb6427,0x7a929fa2)}, {LL(0x72a75f3c,0xc58e2d41),LL(0x34a78cf5,0x74f96bb8),LL(0xff669ec8,0xe9622eb9),LL(0x1f4311a2,0x372f6bc2)}},
+   {{LL(0x736bfd9d,0x528e2979),LL(0xbd43b9a0,0x2e2b3691),LL(0x20c774fb,0x9af895c2),LL(0x6d7e424a,0x076b26a1)}, {LL(0xaad6d339,0xebf7c6c5),LL(0xdbb7e80c,0x0b0d2c07),LL(0xc4af6e33,0x617d43a5),LL(0xaf18f263,0x61c4de18)}},
+   {{LL(0xc8da0f90,0x7efcb584),LL(0x306a2b0a,0x8b6b9b6e),LL(0x1050a719,0x2fdf3b68),LL(0x78b1be69,0xbbdb3786)}, {LL(0xbe1ee7e8,0xdfaaa726),LL(0x6d635bc5,0x23718715),LL(0x8f667d2c,0x9d855085),LL(0xe7b6f05b,0x845d582c)}},
+   {{LL(0xe60b0eef,0x84695098),LL(0x9320b398,0x1eccb023),LL(0x8807c29f,0xb730f1e3),LL(0x99b204b7,0xb9c6f2da)}, {LL(0x79ad84fc,0xa7b67c00),LL(0x89cda0c7,0x0d519681),LL(0x667a9bea,0x78bd5164),LL(0xf710be90,0xc1f7684a)}},
+   {{LL(0xaa02e1ce,0xc9d37fd0),LL(0x067effba,0xf28428f5),LL(0x2cfd0821,0x89c09a2b),LL(0x48ef4f04,0x845f2f67)}, {LL(0x1361cfef,0x0bf7346a),LL(0x2a0dc073,0x001ea4b0),LL(0x638016cb,0x33ee05bb),LL(0x3f81de50,0xc1c2b761)}},
+   {{LL(0xbf11e94c,0x68fbbed2),LL(0x2fb4b105,0x5d9f55a4),LL(0xa30eef14,0xd61e63c5),LL(0xedc00df3,0x8e1205ac)}, {LL(0xdc17a985,0x161bd942),LL(0x8a9cf54f,0x2424def1),LL(0xc4e33ef7,0xe43db8ff),LL(0xb4ac188f,0xd459f65d)}},
+   {{LL(0x4f447c56,0x664bb8db),LL(0x6cfe9e2a,0x6e1390b1),LL(0x389066d0,0xf1ca8c23),LL(0x8d248362,0x11cf32d3)}, {LL(0x92b1a8d9,0xc924d648),LL(0x9116ff20,0x994720d8),LL(0x014e5312,0x868b5a42),LL(0xea8fec96,0xf02a49c1)}},
+   {{LL(0xe38d8467,0x7409cadf),LL(0xf874c06d,0xaf089305),LL(0x86274217,0xe237f9af),LL(0x1ec3e3d8,0x33352628)}, {LL(0xc3fd78d8,0x5e1d7ec5),LL(0xe36af166,0x54bf72f7),LL(0xcabe1ab2,0xfa21fdc1),LL(0xa48ff343,0x59327c5f)}},
+   {{LL(0xe59c16a7,0xa3363fca),LL(0xcab8fe86,0x86f569e0),LL(0x80e29dc4,0xe4a4f70c),LL(0x7da0ee1d,0x084c28b4)}, {LL(0xd1d19b80,0x037bd2d1),LL(0x6b5c2f10,0xf35d1052),LL(0x5a86a641,0x8e85e9ad),LL(0x83ea4cf3,0xb1f4285c)}},
+   {{LL(0x135ac7bd,0xf09c734a),LL(0xa6c25ac0,0x7483609c),LL(0x8b4057d2,0xe679619e),LL(0x512dbba4,0x9ed96bdc)}, {LL(0xb17642c1,0xb98ac745),LL(0x6b062307,0x29acace3),LL(0x7d8f95f0,0x34d7b3f2),LL(0xa625176b,0x5154a2e6)}},
+   {{LL(0xb1c0b289,0xab7a8dfd),LL(0x55427789,0x43d7bc4a),LL(0xd41e4844,0xd933175d),LL(0x181fb550,0x9b9aa4dc)}, {LL(0x76dd90f9,0xc2975a67),LL(0xfdaf3f4c,0x500a5b32),LL(0x1031fc9b,0x6409d6ac),LL(0xd66b5dc3,0x85192efc)}},
+   {{LL(0xbc9f7dbd,0x1b787562),LL(0x45e4fbf7,0x0091dd44),LL(0x170d4011,0x60da634e),LL(0x00715fed,0x7bd31f5b)}, {LL(0x025e5677,0x037e6576),LL(0xcde5eac4,0xea5dfb46),LL(0xb4b735cf,0xe3ab3a1a),LL(0xd3727455,0xaa069d38)}},
+   {{LL(0xd8c06aa3,0xe0c58e8a),LL(0xcad35cc1,0xe3b52b23),LL(0x0609e412,0xd090990e),LL(0x98b22aaf,0x345e13a0)}, {LL(0xe33678eb,0xeb976961),LL(0xbbe7599b,0x0d8dc230),LL(0x48cba46f,0xbe234911),LL(0x8defaa24,0x9a58d320)}},
+   {{LL(0x7b63e1a5,0xed31862f),LL(0x17a13e12,0xe6a86f3b),LL(0x5b609ce8,0x4f81b920),LL(0xce25f81c,0x0a45cfa8)}, {LL(0xa872e892,0x4aa3bb5b),LL(0xa4750abe,0xc6020564),LL(0xe2244773,0x61de3d3f),LL(0x10ca3fa2,0x9cc3d627)}},
+   {{LL(0x4b327b97,0x21a51123),LL(0x1a0d95ba,0xbbf33878),LL(0xbd627599,0xe924444c),LL(0xdc155a36,0xa856688b)}, {LL(0x649c0456,0x54b3cb85),LL(0x60505cdd,0x04a78a12),LL(0x187e4595,0x093e813b),LL(0xf9a2fa72,0xc32b857e)}},
+   {{LL(0xe1e8d2b2,0x63519941),LL(0xa670a757,0xfef2e524),LL(0x49240195,0xa02b1710),LL(0xed9fd86c,0x5094d956)}, {LL(0xffdc3267,0x30604e4f),LL(0x62251341,0x848862b4),LL(0xb4ac8dd3,0xdc91bee3),LL(0x2d86d787,0x87c71967)}},
+   {{LL(0x5fed1684,0x6df16f01),LL(0x8e227589,0xeeccac28),LL(0xfb050a36,0x9b01442c),LL(0xc517e8ce,0x65471110)}, {LL(0xa7ce17a9,0x7b989604),LL(0x12c5f92e,0x588978c4),LL(0x4db554fc,0x67cff8ab),LL(0x320b7065,0xcd29cbcb)}},
+   {{LL(0x99e9994a,0x819a3bc7),LL(0xc61c8b71,0x0f79a8d1),LL(0x935751e9,0x77a7038d),LL(0x42fc0d27,0xf5ddc5cd)}, {LL(0x2b2bb23b,0xa8771b82),LL(0x2286f0f7,0x6e85221f),LL(0xf1d1d3dd,0xf009dfbd),LL(0xc9021146,0xff586ad1)}},
+   {{LL(0x8f026bfa,0x520177b6),LL(0xd61d20ed,0x4d46164a),LL(0x336345f8,0x106a11ee),LL(0xe85575e8,0x4ed0193c)}, {LL(0x270a39b5,0xbd28201e),LL(0x24668bac,0xf7c8100e),LL(0xbfe099fe,0xf3c86783),LL(0x1bc0c924,0x471dacb8)}},
+   {{LL(0x532dd7b4,0x6bea8904),LL(0x2daf3cff,0xec3f1131),LL(0x3828fe64,0xe393e2d8),LL(0x05206a96,0x1cebf144)}, {LL(0x5f68f63b,0x9bcd47e3),LL(0x5e4390fc,0x2684cd46),LL(0x51d84461,0x207544fa),LL(0x7807cb11,0x57da5910)}},
+   {{LL(0x50ae8470,0x90595098),LL(0x9db4a45a,0x0a17a0d8),LL(0xea491407,0xf606fea8),LL(0xb484d059,0x5cff97e4)}, {LL(0xa9b11ffe,0x8c01ddbb),LL(0xc950a5ee,0x3f925651),LL(0x2405129f,0xcc824c4d),LL(0xa8b6742f,0x87b00312)}},
+   {{LL(0x5949dfcb,0xdd0d52b3),LL(0x130072af,0x81f38318),LL(0xb3b4c1ca,0x8822ed39),LL(0xa66f4434,0x211ed088)}, {LL(0xc20687d2,0x27be39a3),LL(0xae0945da,0xbb4f2228),LL(0x512ce23f,0x3a50e01c),LL(0x8c4ff67e,0x55d9a4d8)}},
+   {{LL(0x95a1d3e3,0x3cb2d9b5),LL(0x99e196e8,0x41c5c39c),LL(0xe69e05d9,0x4a393a75),LL(0x2c0f0f97,0xd4884159)}, {LL(0xa45129fd,0xd294e8f1),LL(0x699abc9b,0xe8b1e52b),LL(0x03388ae6,0x01bf00e4),LL(0x02a1edc8,0xe28a4d75)}},
+   {{LL(0x51f4ac49,0xfd165412),LL(0x7f3d4d43,0x8de30397),LL(0x0c2ca7c6,0x15dc3868),LL(0x13eced29,0x4babcd3a)}, {LL(0x5dff92cc,0x2de9b732),LL(0xa941985d,0xa1b5dec8),LL(0xdb3553f4,0x04a117a2),LL(0xe44549d6,0x0940b4a5)}},
+   {{LL(0xa384e941,0x71fb2568),LL(0x1dde0f71,0x94c8598b),LL(0x23d89a31,0xcd48f697),LL(0x39d12254,0x259991a8)}, {LL(0x7301178a,0x3b8bb460),LL(0x816503e2,0x2ada0c13),LL(0x06d29e8a,0x24fbab77),LL(0x6da37897,0xff6b7a81)}},
+   {{LL(0xdd97f076,0x04e8fbf8),LL(0x483b4fd9,0x8d419976),LL(0x9cc344ba,0x364daf96),LL(0x4d0bab91,0xacb89d4b)}, {LL(0x28903b31,0xb25952e5),LL(0xacea03d9,0xc4812dfa),LL(0x7f05dd9f,0x18a72a77),LL(0x3eb2478b,0x0bb58aaf)}},
+   {{LL(0x98508e55,0xd713a5b3),LL(0x1ff922f9,0x2a0b8bd9),LL(0x7c6f93ad,0xd4f5bbb6),LL(0x9f231f11,0xa5b3520d)}, {LL(0x2830adff,0x5969027d),LL(0xb1104cd9,0x273cfa27),LL(0xb4789c19,0xa64cd5b8),LL(0xfba32075,0xc510ccc5)}},
+   {{LL(0x985e8f7c,0x0a0b0fb2),LL(0x9c663fb0,0xbe547bf3),LL(0x6d7f4b5b,0x23a5312d),LL(0x07587bdb,0x77bc2fbd)}, {LL(0xd41126cc,0x346ceac7),LL(0xe7c792e5,0x5a2d81ed),LL(0xce0fa3ab,0xb37b0ce4),LL(0xddf4d25c,0x68b976d0)}},
+   {{LL(0x3f2ba676,0xedc02e96),LL(0x7ddeedb6,0xbf9fa5f4),LL(0xf448057b,0xb4e3b86c),LL(0x7fcf66df,0x097051c5)}, {LL(0xe15ed0a5,0x4828f4d7),LL(0xda3fba4a,0x2de4bd3f),LL(0xfe099786,0x1b2fa928),LL(0x0c214e38,0xe29cad79)}},
+   {{LL(0x5e39f117,0xdc378421),LL(0x639cef28,0xd5698d4a),LL(0xe4d1143f,0x4e870b7b),LL(0xc98a9676,0x70f9c856)}, {LL(0x7a56d720,0x6bf17724),LL(0x0e4247d5,0x4f32d20f),LL(0x1dc73435,0xcddf6caf),LL(0x5f927abd,0x8876ceb8)}},
+   {{LL(0x391ce20c,0xf041dd30),LL(0x32792991,0xf458f4be),LL(0xe814f4f1,0xedd084db),LL(0xbb681078,0x92fec26b)}, {LL(0x1f7fe7e5,0x0e0f9b7c),LL(0xdd2f498d,0x7479642e),LL(0xd015d69a,0x189b3cb3),LL(0xaacbf7fc,0xac7a9674)}},
+   {{LL(0x8a23e947,0x54216056),LL(0xc6410a9e,0xcd8e9278),LL(0xe97ef6e6,0xb699eeac),LL(0x63752ed0,0xc550df2c)}, {LL(0xc3d5c820,0x26ff4f36),LL(0xc2370faf,0x3b65ce72),LL(0xc50931b7,0x86097526),LL(0x2a05c84d,0xaddfa2f2)}},
+   {{LL(0xf6c4002c,0xddcb40ea),LL(0x2f883b31,0x27ee96da),LL(0xc98b22cb,0xe88192d3),LL(0x318b8830,0xc36725fb)}, {LL(0x857044b3,0x03cddef2),LL(0x64e9d168,0x4349a60f),LL(0x7f5bce4c,0xa0db6b89),LL(0xd3e3442f,0x9b772fe2)}},
+   {{LL(0xd57a7ee3,0xf76ea7b1),LL(0x77880d2c,0x99aa11d0),LL(0x5cb4cecf,0xa752265d),LL(0xbad097f5,0x1c77ba6c)}, {LL(0x371da1de,0x8464c1b5),LL(0xaaefe6d8,0x47092846),LL(0xe05b696c,0x26c4a50e),LL(0xae49a9d6,0xdb16a174)}},
+   {{LL(0xf49fb2ac,0x3463a766),LL(0xedf91930,0xcd06c940),LL(0x795cfa90,0x0c86c91b),LL(0x25e40741,0x502332eb)}, {LL(0x204b9016,0x02b79a19),LL(0x492d75f2,0xb5ecefea),LL(0x3bcbf250,0xe927a583),LL(0x7b6b73db,0x5f1a0db3)}},
+   {{LL(0xf199a5a5,0x8e5e013e),LL(0x1f711941,0xa8a5fae1),LL(0xb4cfacd1,0x60f5c6e5),LL(0xb3c61a11,0x768db45a)}, {LL(0xe8169ac1,0xe3b9fbed),LL(0xfd951a2f,0xb24c702b),LL(0xfa00d7aa,0x19312546),LL(0xe5809cca,0x0fa78e5d)}},
+   {{LL(0x48a8dd26,0x3356c66d),LL(0xa39ca2cb,0x6653dc8c),LL(0x31ad7879,0x6711e401),LL(0xaa6ce3f5,0xdeb29ef4)}, {LL(0x4be1de95,0x005dbf8b),LL(0x6e892292,0x44f3bf2b),LL(0x93a5a474,0x1b558154),LL(0x1b75dcbe,0x7a4914a3)}},
+   {{LL(0xd7c4ea8c,0x0aed484f),LL(0xdfa66305,0x60b30298),LL(0x9b478201,0x1a03dfd0),LL(0x21fe2588,0xe7f87bc9)}, {LL(0x87150a21,0xc08f648e),LL(0x652d91f8,0x4c1ed208),LL(0x4276a7f6,0xbfbaf51f),LL(0xcf2d124f,0x8c66d0ff)}},
+   {{LL(0xeba54c44,0x089188f3),LL(0x34913da6,0x6d119807),LL(0x343e6c7e,0xd6605205),LL(0xb4bcc9c6,0xee126f23)}, {LL(0xcd3d4b8b,0xc89db2ea),LL(0x1c015a9e,0xa0f46093),LL(0x08749590,0xad500b0d),LL(0xde3a4cb8,0xd89972fc)}},
+   {{LL(0x7d292089,0x5c92d195),LL(0x973362e2,0xb2d11755),LL(0xd3feb4c4,0xe02d49fa),LL(0x0c215642,0xfd9a0027)}, {LL(0x1eccfa9c,0xd06976a2),LL(0xb8e81d80,0x3090e7cd),LL(0x9daa9002,0xebc4ede6),LL(0xe537c812,0xf3525b9b)}},
+},
+/* digit=8 base_pwr=2^56 */
+{
+   {{LL(0xf825a5fd,0xf459f7b3),LL(0x413a74f6,0x4595b420),LL(0x094a50e1,0x6b766e52),LL(0x89fb31e8,0xe4154579)}, {LL(0xd180dfb0,0x45e46b7f),LL(0xe2f5450f,0x33e40fb4),LL(0x28afd08c,0x080c953d),LL(0x4c9519a8,0x7598eaa1)}},
+   {{LL(0x16e9e6d2,0x02479b1e),LL(0xbcade03d,0xb1d6219d),LL(0x90e35bf5,0xdc6acf7b),LL(0x6e783aa3,0xbf0735f3)}, {LL(0xc5baa77d,0x393fc398),LL(0x5897d9aa,0x5d3dc1be),LL(0x95846d7a,0x3ba028b9),LL(0x2ea0ecf1,0x986fd641)}},
+   {{LL(0xcf253d88,0xf68bb6ad),LL(0xf8a6b0fe,0x7232fc8f),LL(0xe2d39fb4,0x40000163),LL(0x9ca0725f,0x6f29fb8d)}, {LL(0x0614d077,0x59d669a4),LL(0x4b6d578a,0xe115da8d),LL(0x83a272b5,0x33135232),LL(0x155c59ec,0x9a6f2b25)}},
+   {{LL(0x1b42ef1d,0xa519bf55),LL(0xc27da179,0x06d8b643),LL(0x13c66d44,0x3897633b),LL(0xb601f991,0x0f05909e)}, {LL(0x5dc3f8f6,0x2c6a6536),LL(0x3ed0a6ea,0xd3312416),LL(0x99fc2341,0x6845bb22),LL(0xb00980d7,0xce5e37db)}},
+   {{LL(0x15cfcddc,0x75ccac90),LL(0xf1d0b218,0x8d4cf698),LL(0x70bef9e8,0x13d8056d),LL(0x7f4701be,0x65727819)}, {LL(0xeaedc832,0x7a91f372),LL(0xa0784147,0xebb63c41),LL(0x919dbd15,0x96f1754c),LL(0xf72a4718,0x6a19841d)}},
+   {{LL(0xaeb6af41,0x4e112715),LL(0x6c5205fd,0x7d3ed2fb),LL(0x0511a84e,0xed2c2685),LL(0x6d870d63,0x4d8f50fc)}, {LL(0x5e7f3eee,0xd563122f),LL(0x0de61125,0x305bbec2),LL(0xbec29080,0x6bd9ff85),LL(0x069e573f,0x76e821fa)}},
+   {{LL(0x563e5ef7,0xe2630698),LL(0x372aaa98,0xc39a5d58),LL(0x07476b7b,0xedba16a1),LL(0x22dde27b,0x4f766078)}, {LL(0xe70b447d,0x9a40f350),LL(0x3ae1a820,0x1932fa39),LL(0x3043b4c6,0x098fa485),LL(0xb0c2a84e,0x85ad1d78)}},
+   {{LL(0x2efaa7c4,0x6dd33d86),LL(0x70e0b486,0xc6a9cff5),LL(0x1007fe8c,0xc8385ff7),LL(0xcc47f615,0x149d2919)}, {LL(0x1da795bb,0x9c32c8ef),LL(0x82d6827f,0x52baf59e),LL(0x83e96d6f,0xf0ac5895),LL(0x65643257,0x8a6ccf8f)}},
+   {{LL(0xa9e83f0b,0xd0359cbe),LL(0xc1676be7,0x8310d496),LL(0x8749b896,0xa32d348a),LL(0xee4f94c3,0xa572ff3b)}, {LL(0x6bed3340,0xab2db5eb),LL(0x64e55915,0x4305c1a6),LL(0xb99b81f1,0x46fbd6af),LL(0xa20a7451,0xcd56b2f1)}},
+   {{LL(0x182b9a72,0x4e5f8028),LL(0x43c5b55a,0xc413a162),LL(0x09aa4b1f,0x811131e0),LL(0xdc4c8ab7,0x76b86086)}, {LL(0xb148a0b5,0x3443574c),LL(0xb08011de,0xbd20d4eb),LL(0x466ebe95,0x65c3e6c5),LL(0xb3fae13e,0x32c59465)}},
+   {{LL(0x8fdc4e7c,0x22da76aa),LL(0x658d5551,0xdfd7a8b8),LL(0x1053b09b,0xa69edf83),LL(0xe2213496,0x2d75bf75)}, {LL(0x4413a9fa,0xb6c748bd),LL(0x79361648,0xd5b7233b),LL(0x3e2b11b5,0x20207035),LL(0xdf2d630c,0xb345c3c0)}},
+   {{LL(0x94e3f739,0x05069a51),LL(0xb70c1ddf,0x1b434d08),LL(0x94f0d520,0x935c65d7),LL(0x91431648,0x60e410f5)}, {LL(0x1976ffe8,0xa29110d4),LL(0x5f356ed1,0xcdd61aae),LL(0xbd986d13,0x580be703),LL(0x0a2e3d21,0xa69e0582)}},
+   {{LL(0x1c96fb4d,0x10d092a9),LL(0xbe91a9db,0xd045cf78),LL(0x9adea1f1,0xcaaa8408),LL(0x1e4c1662,0x31a1195f)}, {LL(0x961151fe,0xd2d443f6),LL(0x8e271369,0x4201c97a),LL(0xbcc2a908,0x7bce18d8),LL(0xa71adacc,0x12dab83e)}},
+   {{LL(0xaaf44aac,0x0813fef3),LL(0xb4bfdb49,0xe1d2959d),LL(0x88d4df9f,0xcffcfff7),LL(0xc527240c,0x67c3ff5a)}, {LL(0x92a14638,0x29e12cb6),LL(0x0ae9604b,0x7dbb65a8),LL(0x21c75958,0x525e720a),LL(0xc0ccf2a2,0x0185fb81)}},
+   {{LL(0x91121999,0xf983737f),LL(0xdd3638c8,0x737359ca),LL(0x1522f1c7,0xd9eb40d5),LL(0x0e39c2a8,0xe943c0b6)}, {LL(0xd14ba9a7,0x77605aaf),LL(0x4ad86db0,0x2abf7ab1),LL(0xdfda8f69,0x4ea157fb),LL(0x450e0acd,0xba84eba4)}},
+   {{LL(0x8f8cfac9,0x8b651ce5),LL(0x81beda93,0xe7688f88),LL(0x0d656e1e,0xef334ff5),LL(0x5ec25f80,0xa374d8d8)}, {LL(0x79c03819,0x9e13eae3),LL(0x8d4dab3c,0xaf5831c1),LL(0xf6e90c26,0x88deb51d),LL(0x823f5310,0x87a61f17)}},
+   {{LL(0xee419a3a,0x57b51c04),LL(0xb5a69217,0x7d0989dd),LL(0xfa4acf59,0xf3fd6ccd),LL(0xbfd224f5,0x3462ff33)}, {LL(0x8d93e5a0,0x1f5917e3),LL(0xef839050,0x9dbe542a),LL(0x3462671f,0x10736068),LL(0xe5de6b38,0xd87d5977)}},
+   {{LL(0x04c53b93,0x133db8e8),LL(0x27c219bc,0x19170537),LL(0xce2cabc9,0xd545282c),LL(0x469ecbdf,0x2678cf31)}, {LL(0x9e0cacae,0xd008c687),LL(0x2b6c22ac,0x156fc4b4),LL(0x308b2731,0x3355df4c),LL(0x08faf9ef,0x03cf658c)}},
+   {{LL(0x7a0915a6,0xb8659898),LL(0xec368857,0x36b2dd19),LL(0x60eaafc8,0xfb2bd7f7),LL(0xb44b5272,0xf1bf6aed)}, {LL(0x865b9f4e,0xfaab45d0),LL(0xe844e41e,0x02386d0c),LL(0x0161e99d,0xec1d4079),LL(0xabb5c528,0x9c08334f)}},
+   {{LL(0xf9f8a086,0x7909e63c),LL(0xadf8ecee,0x3a712d72),LL(0x6acfec7e,0x09685109),LL(0x0f542878,0xf66911d0)}, {LL(0x5552980e,0x3a72f74d),LL(0x7253ad0f,0xed981637),LL(0x1bfd1e6b,0x9dc627e0),LL(0x024f9a56,0x18e3253b)}},
+   {{LL(0x1f3c72e2,0xf19a4df7),LL(0x98be90d9,0xd95a2e87),LL(0xf11a00d2,0x7e4ff0e2),LL(0xb6687665,0x0627e350)}, {LL(0xdb3405b4,0x5c5464ba),LL(0xbe731e63,0x05b09eef),LL(0x2fc266c8,0x6d3d4dbb),LL(0xd82c6f02,0x4c3dea5e)}},
+   {{LL(0x918540a7,0x62aa6615),LL(0x6c4daade,0xadf970cb),LL(0x7e178990,0x56a04d85),LL(0x186f6979,0x4cfff521)}, {LL(0xaaa3aee3,0xdf085ded),LL(0x4f4b72ab,0xfecf047f),LL(0xd3060f67,0x4f9cb3c5),LL(0x42d281db,0x54e6c736)}},
+   {{LL(0x51f1d6bc,0xe49bd896),LL(0xa2f2a7e4,0x15d509ee),LL(0x41f65617,0x47e2dc0d),LL(0x83ea2023,0x38884ab3)}, {LL(0x656de9f3,0x4444bd12),LL(0xcc0e67d3,0xd4dd5f8a),LL(0xf1b87883,0x3ead168b),LL(0xb0947989,0xc5eba764)}},
+   {{LL(0x65b4dd37,0x72192451),LL(0xd5fc6692,0xa14c3472),LL(0x61b34144,0x42c4c5b5),LL(0x77fb34ea,0x511ae2d5)}, {LL(0xce9c8720,0xa65515cc),LL(0x07f34d47,0xff621230),LL(0xb503c00a,0x4c5ab72b),LL(0x6340c772,0xeb101a77)}},
+   {{LL(0xa7fd3e29,0x2b372b83),LL(0x1f489f46,0xcc8b4a81),LL(0x0e6d56e9,0x43059b81),LL(0x5c80ca09,0x3e29903b)}, {LL(0xa64b07aa,0x261572a7),LL(0xfa7f4b0d,0xd4609a30),LL(0x1dcb8251,0xa7f13485),LL(0x6168274a,0xe248ac88)}},
+   {{LL(0x102575ab,0x8427db11),LL(0xff61a2bc,0xac12ef8c),LL(0x4b73be97,0x7cb7f827),LL(0xcddbf0cc,0xc77853f7)}, {LL(0x7b5a0aa3,0xd708bfa2),LL(0x2b8df063,0x958a506c),LL(0x00a63a91,0xd234638e),LL(0xa5950bad,0xed7cb22c)}},
+   {{LL(0x709a8597,0xb330457f),LL(0xe06877a8,0xb0add8db),LL(0xd4313836,0x2a8b7708),LL(0xa95b96c5,0x32ba716e)}, {LL(0x56db8637,0xd7b3526d),LL(0xa87a9f4b,0x452032e9),LL(0x0ec2b904,0x8d3879eb),LL(0x17eec194,0xd3d34796)}},
+   {{LL(0xf8575e54,0xac3296e7),LL(0x30c6130b,0xdde97ce5),LL(0xe2e82ec1,0xecd9d2ec),LL(0x820736bd,0x256824b9)}, {LL(0x6cadee3a,0xf7769bf6),LL(0xd3a536b8,0x17fcaf9e),LL(0x455cefac,0xfe7ea0b7),LL(0x23fb1119,0xe5a0d171)}},
+   {{LL(0xdad91eb0,0x867b097f),LL(0xe94096c6,0xc404b031),LL(0x19d9a34f,0x4698a16e),LL(0x811fe3f9,0xd079d18d)}, {LL(0xb6520c47,0x3295facc),LL(0x4bdf90be,0xedbecdf8),LL(0x386faeca,0x2b501dc5),LL(0x167877d9,0x1e4bd20d)}},
+   {{LL(0x24039f48,0x1079941a),LL(0x24dd576e,0x33b4416c),LL(0x8e83d2c0,0x6ef3246c),LL(0xbc4bec51,0x3f1d0de3)}, {LL(0x86218640,0x39e48780),LL(0x59b0fd59,0x35dd3f3b),LL(0xd42eef24,0xd5336d0a),LL(0x2ff34216,0x73a39904)}},
+   {{LL(0x078c9852,0xf1de4ff7),LL(0xb8602383,0xad6ddf05),LL(0xd79b0ec1,0x186a9ce3),LL(0x1cfad092,0xae964a7f)}, {LL(0xd12c6d6b,0x54b46eba),LL(0x3738a68c,0x2ccbe41a),LL(0x6860d17e,0x81f6bfc3),LL(0x4d0c032e,0x288d91be)}},
+   {{LL(0x33e3eb81,0x6db7491f),LL(0x1d01759d,0xfab69b8d),LL(0xb17c9bae,0xa8b52594),LL(0xf6efb30c,0x36210cb3)}, {LL(0x1f950168,0xc5545b12),LL(0x2df60ba8,0x5ee71cdb),LL(0xc7f87caa,0xe7642e69),LL(0x8999648f,0x54e006bf)}},
+   {{LL(0x5e8c1fe2,0xe462943f),LL(0x39eb59b2,0x9ae0cf59),LL(0x1c96894a,0x065189d1),LL(0x2960dcf3,0xec373916)}, {LL(0x6eecbcbb,0x2df9a743),LL(0x03b10e27,0x9d331ea3),LL(0x1e7241b1,0x8a55f87b),LL(0xd7adbd98,0xe054531d)}},
+   {{LL(0xfaea0d1c,0x2091054f),LL(0xf3da6276,0xba66f890),LL(0x1624990c,0x6e045219),LL(0xf192a16e,0x5b6c3831)}, {LL(0xd55b1b58,0x9210c0c2),LL(0xced515ec,0x3774fdc1),LL(0x87aece15,0x3a45b8e2),LL(0x8c809536,0x87d7bf30)}},
+   {{LL(0xebb996bc,0x5ad51346),LL(0xa9b15b7e,0x06e051bd),LL(0x84dd1f01,0xe0a79815),LL(0x4b95d61f,0xeabd6e47)}, {LL(0x95c6c9b0,0x6b5a1e07),LL(0x552b2243,0xeb8b7ffe),LL(0xebda226e,0xccd1b1c2),LL(0xc074c679,0xfad5edf3)}},
+   {{LL(0x7fb30e0d,0xc0795477),LL(0x0033525f,0xb5a0e833),LL(0x0ab1bbc8,0xf9588eb7),LL(0x765e448e,0x37768242)}, {LL(0x39abe213,0x42d9838f),LL(0xece014c6,0x7b489da9),LL(0x1d11918b,0xe490feb5),LL(0xdc9674df,0x6139878d)}},
+   {{LL(0xf0f2e15f,0x4537739d),LL(0x265fb04b,0x909dbfac),LL(0xa85a92e1,0xf454459c),LL(0x0ea2683a,0x9863ff9a)}, {LL(0x6b861e21,0x525df843),LL(0xa5be4653,0xc0aea30d),LL(0xc3478fde,0xb953c18f),LL(0x9fe9c546,0xd61382e4)}},
+   {{LL(0x8028cf38,0x1a58de22),LL(0x5e2b7cca,0x42ed1e83),LL(0x77fc8e50,0x3aeeff04),LL(0x665c1868,0xd97733d4)}, {LL(0xa307f254,0xf5888f22),LL(0x2a611b9d,0x2336c25d),LL(0x8ada8179,0x36dcfd64),LL(0x1487551c,0x19fa7824)}},
+   {{LL(0x9b926bc1,0xbbf74320),LL(0xf63025c0,0x866e0258),LL(0x51d69360,0x19201095),LL(0x0c4d302f,0x41eb1b9a)}, {LL(0x090092d3,0xbf8a755f),LL(0x1c58e0b1,0x799c5b2d),LL(0xac4525e7,0xc02a1d6d),LL(0x6957ba32,0xfef6f879)}},
+   {{LL(0xf675f689,0x5cdc6602),LL(0xaf440b9d,0x34e87b7f),LL(0x9c90f45e,0xaee24060),LL(0xa11fa5ea,0x02ba93a6)}, {LL(0xae28c4cc,0x45fbd7f3),LL(0x6b03388d,0xa8b42449),LL(0x52647638,0x273b91d5),LL(0x853796d5,0x77b71c7b)}},
+   {{LL(0xd7f3e493,0xc36a7d60),LL(0x341d0b62,0x652a5693),LL(0x1622827c,0x81d85d27),LL(0x397830a9,0xa4b43ca3)}, {LL(0xc0fd9f91,0x4bea2ac8),LL(0x3c414b31,0x36e888fb),LL(0xf0188b96,0xc707f044),LL(0x4fd59614,0x3d1da542)}},
+   {{LL(0x6e00cae2,0x6291281e),LL(0x5c6b65e0,0xd99f2f0d),LL(0xd3f6c2e1,0x9ec86afa),LL(0x21e814ed,0x227478b2)}, {LL(0x85e080b2,0x02505104),LL(0x18d303ef,0x954db5b2),LL(0xb234d98f,0xa2c676e1),LL(0x8d7fbcd3,0x344ca871)}},
+   {{LL(0x986c02c7,0x14b5b61a),LL(0x4b8595a7,0x72d6859a),LL(0xb666b7f3,0x66bf5376),LL(0xb260afdf,0xf73b3655)}, {LL(0x444e370f,0x137418fd),LL(0xa7645462,0x54af92b0),LL(0xb49b2df0,0x9cb5e105),LL(0xe7e7ff25,0x1c05ae34)}},
+   {{LL(0x48319183,0x18e157aa),LL(0xec8bc2ae,0xd3c909d5),LL(0xd8695753,0x66dbf8a0),LL(0xcbfd48d2,0xc1ca512d)}, {LL(0xb32b6def,0x70031acc),LL(0x2b55ada4,0x0e043726),LL(0x4363b54e,0xe662bcbf),LL(0x89bffe20,0xa8d5c7f8)}},
+   {{LL(0x0cd5d74a,0xdb4ae6cb),LL(0x07fe9641,0x2fc26efe),LL(0x731f2c5e,0x6be9af88),LL(0x0b487b83,0xed4c3ca6)}, {LL(0xcb157d0e,0x8daf5424),LL(0x7ccd9293,0x15de18da),LL(0x244aa60f,0x5f8e99b0),LL(0x6bc9855d,0x55416b90)}},
+   {{LL(0x39faf2e6,0xbd5ab6bd),LL(0x05f2d1af,0x45335021),LL(0xa9f67730,0x4f4154be),LL(0xbf593ab4,0x7f090c91)}, {LL(0xe99d051d,0x557694be),LL(0x2fd65d41,0x29fcc997),LL(0x33e99da1,0xdd4d307d),LL(0x2b2b0ef2,0xc27aca5d)}},
+   {{LL(0xe60cdc3f,0xbe016070),LL(0x1f173f45,0xa0ceff57),LL(0x2c6f6bba,0x545b0309),LL(0x3c987c2a,0x2defef06)}, {LL(0x367b63c5,0x959b1a09),LL(0x9f7cb946,0xad6cfff3),LL(0x207a598d,0x5e95ce96),LL(0x74db2725,0xd2614502)}},
+   {{LL(0x97239c58,0x04262364),LL(0x9181765b,0x124db7c0),LL(0x8bdc8297,0xa7b5d21a),LL(0x684f23c3,0x1998f669)}, {LL(0x39fd52b8,0xf27a6063),LL(0xf77c78a1,0xb234c77a),LL(0x78f05350,0x768c0fb0),LL(0x1b5e5d18,0xfdd39180)}},
+   {{LL(0x6d066f37,0x081a48eb),LL(0xa6070025,0x9019a52a),LL(0x1b43f5b9,0xc13706f1),LL(0xc5f8f36f,0x6a72ddb6)}, {LL(0x57c29dcb,0x6032510d),LL(0x8c6b9c4a,0x7da2e6da),LL(0xba1ffad3,0xbaf45c3d),LL(0xff9b9ce6,0xa6c08234)}},
+   {{LL(0x16c58369,0xb49f9175),LL(0x204eaf4e,0xe8f239fd),LL(0x3e9a6886,0xbbd38a9c),LL(0x7c70d7f5,0xbd5388bd)}, {LL(0xa224f935,0x5b4c415d),LL(0x718c046d,0xd2d8f0ad),LL(0xe5243833,0xe4b59814),LL(0x899e792d,0x5c958c9c)}},
+   {{LL(0x08d155d1,0x783143cb),LL(0x597e6003,0x4f928874),LL(0xf39f44c0,0xc3065ab0),LL(0xbab3d1ef,0x9d7daf74)}, {LL(0x938c3cad,0xa0280d65),LL(0x9f52a44f,0x07712146),LL(0xb8739968,0xcb6d61c8),LL(0x65472265,0x679bd2a8)}},
+   {{LL(0x858daeb7,0x26d42a26),LL(0x6b823976,0x294ae3ef),LL(0x84d7c205,0x4648d309),LL(0xa2aa80fc,0x1742735c)}, {LL(0x8de7db67,0xd5a5bc26),LL(0x41e369f0,0x98056373),LL(0xb3face50,0xb7ab0ccb),LL(0xe6b21ef5,0x841871ea)}},
+   {{LL(0x4e29f509,0xf398a674),LL(0x26ec173e,0x9aad14fe),LL(0xb121b84d,0x59c16075),LL(0x140172a3,0x4fa2f61b)}, {LL(0xf4e10ea3,0x56654ed7),LL(0xac1f2ba7,0xda00028f),LL(0x5c4b82d2,0xe63f1841),LL(0x32c5fe5e,0xfaa24913)}},
+   {{LL(0x00ef2079,0xbb9c4afc),LL(0x7aca66f2,0x1f2ce903),LL(0xade178c2,0xb4d639de),LL(0x54f31c29,0x900dbbe2)}, {LL(0x0fe6f62f,0x17b8f697),LL(0x12dcabc4,0x409eefa8),LL(0xefbcacc3,0xf7856cfe),LL(0xe15ec569,0x9d715f5a)}},
+   {{LL(0xcd676f6d,0xe7c8dd8b),LL(0x795d4e6a,0xac11a49e),LL(0x830060f2,0xe609414a),LL(0x0c201ec2,0x402a32cc)}, {LL(0xaaea11da,0xcfd833b4),LL(0xac271a8e,0x9c466f72),LL(0x242d3570,0x5e763f53),LL(0x1f076a59,0x4707a99d)}},
+   {{LL(0x652a7668,0x9ab70aec),LL(0x0fa8623a,0xbb7fef7e),LL(0x6188a6dd,0x530a802e),LL(0xf5288460,0x48adf8de)}, {LL(0x5713c23a,0x361e97f3),LL(0x73fb66a1,0x55a873ab),LL(0x4a79b358,0xbd82520c),LL(0x949b0cfe,0xc707420a)}},
+   {{LL(0x8969c10e,0xb250ea86),LL(0x9eb06e76,0xa614e6f6),LL(0x64272ea5,0xa83169f5),LL(0xf53d3195,0x3591f3e3)}, {LL(0xf03e3d07,0xd5bb0175),LL(0x4b112bef,0x0419e061),LL(0x5282d081,0xd4954581),LL(0x97d14474,0x9cd03539)}},
+   {{LL(0x1d1e972c,0x9fe799b2),LL(0x1b6f06df,0x19d96bb5),LL(0xd1cd3cb3,0x52f984da),LL(0x65b5514c,0xb4836096)}, {LL(0x506c8fb6,0xa4ef97dc),LL(0xcc0b51bc,0x9c75b54f),LL(0xd262f1c4,0x241fb553),LL(0x78ca021a,0x8a23b2e8)}},
+   {{LL(0x75303860,0xc245a67d),LL(0x34980b39,0xa4f97fb3),LL(0x163bcd5d,0xf30ec953),LL(0xbb7800f0,0x5d2cd3ff)}, {LL(0xedea3138,0xdce29f18),LL(0x729909f6,0x74bcb05d),LL(0xf6f8cbca,0x109e5faf),LL(0x0b3cf9e9,0xf4383a6d)}},
+   {{LL(0x3f9ff29a,0xa4ee3215),LL(0x6a67f767,0xfe1dfa09),LL(0x99f62020,0xa5313b08),LL(0x2083278d,0x5b7e0685)}, {LL(0x9b49b557,0xbf59d82a),LL(0xd63ff779,0x2cc2cb31),LL(0x23dcdd56,0xce7be4df),LL(0xab6cdaa0,0xaa91bb94)}},
+   {{LL(0xb2a50109,0x56d590c7),LL(0x486b4dc4,0x783802f3),LL(0xf2eed008,0x7e93e2c4),LL(0x1a699c86,0xa524137c)}, {LL(0x9d50613b,0x69062f41),LL(0x5ed21dc2,0xa720ba96),LL(0x326c3127,0xc88cf46f),LL(0xffbf3788,0x1dfcff4d)}},
+   {{LL(0x4a7baeb6,0xd16116bd),LL(0xc31b0987,0xb8945096),LL(0x80184a13,0x4d988be1),LL(0x168089cc,0xade62671)}, {LL(0x722f5053,0x3a7171fd),LL(0xb4982c41,0x5fbfc659),LL(0x4d501d83,0x642ce23e),LL(0x005209fe,0x2fdb9f62)}},
+   {{LL(0xd46bdb07,0xea2ab4f7),LL(0xd9058f7b,0x3623d12a),LL(0x14192bb6,0xe7f1a217),LL(0x3ba09320,0x0340aadd)}, {LL(0xdf765437,0xa2b1136d),LL(0xc7d6d52a,0xae9184c9),LL(0x02117785,0x8559978a),LL(0x384e17fd,0x925bab25)}},
+   {{LL(0x69f216fb,0x866ea46d),LL(0x4ac99446,0x64a5d28a),LL(0x055dbf41,0x8c3ea2e0),LL(0xbddaa65f,0xe38acecb)}, {LL(0x26632b9a,0xf1802eee),LL(0xbc3f0465,0x626bb951),LL(0xa26eadf6,0x82e6ac2d),LL(0xe3874052,0x5c6d543c)}},
+},
+/* digit=9 base_pwr=2^63 */
+{
+   {{LL(0xfec4f694,0x5752669c),LL(0xd6931168,0x350bc0e9),LL(0xc8ddb9cf,0x2439a6d5),LL(0x8ae0bb1d,0xf63a6955)}, {LL(0x40d3e479,0xcbe2cbc3),LL(0xeb98b4ee,0x96658df6),LL(0x243a2f9f,0xdd94fc99),LL(0x86192cb2,0xef711781)}},
+   {{LL(0x272e9751,0xb6b50eda),LL(0x195edbf5,0x3fe27c6a),LL(0x2ef8a9cf,0x9cdd9c46),LL(0xccc851a3,0x4c276680)}, {LL(0x6f0a9ef3,0xc8e079a4),LL(0x6b0ba84c,0x61480000),LL(0x48b8fa3e,0xdced315c),LL(0x7f23719c,0x911a49b7)}},
+   {{LL(0x95d7c1a8,0x15220aed),LL(0xa2649538,0x8c61c008),LL(0xba7673d3,0x88d59b9e),LL(0xf40be30c,0x79d60d1c)}, {LL(0xe0fb803a,0x94148cd2),LL(0x34abe707,0x54698785),LL(0xfbebfc69,0x456b45a2),LL(0x81d6bd65,0x0707222e)}},
+   {{LL(0x062cc6de,0x9c2dc74a),LL(0x4d4b0c6f,0xad363af2),LL(0x4cc5d6e0,0xefd5d6f2),LL(0x7710d86d,0xff4ee684)}, {LL(0x35836984,0xac77740b),LL(0x760b044f,0x3d90a19d),LL(0xdd69d798,0x7ee58462),LL(0x730e783a,0xd5bccfdc)}},
+   {{LL(0xda28533e,0xcca141c3),LL(0xcbc7876c,0xd04404ec),LL(0xf7b603c4,0xb49475e5),LL(0xaab3168c,0x97fb4d51)}, {LL(0x0d16229f,0xc2b583f8),LL(0x951a7f3b,0x5006ef04),LL(0xd6baed68,0x2a55c7eb),LL(0xfd55b24c,0x87cecbba)}},
+   {{LL(0x23eb95d8,0x58a746cc),LL(0x33a5c0b2,0xb2959132),LL(0x95c8c842,0x33af25d4),LL(0x8d5372f1,0xc1d58422)}, {LL(0x15b3cace,0x035f6c68),LL(0xcb068d90,0x68986e01),LL(0xfea468a7,0xd1672698),LL(0x948fe35e,0x398ca3be)}},
+   {{LL(0x92c66b8c,0x9179c444),LL(0xb265dbc2,0x18a8ce39),LL(0x9972c1fb,0x0b859606),LL(0x328e13f8,0x6eb12109)}, {LL(0xfab69dde,0xa54457bd),LL(0x0b12b791,0xb8300047),LL(0x60bc2916,0x5706e6aa),LL(0x666cb3da,0xd84ee59e)}},
+   {{LL(0x06fc124e,0x07723822),LL(0xf676d4e4,0x2072d143),LL(0xcbc34659,0x19642255),LL(0x37260eae,0xf94542a6)}, {LL(0x520a49b3,0x78312ef5),LL(0x4c89f1e7,0x3127e5f1),LL(0x95c11918,0x88ae06b9),LL(0x16ea53bf,0xbef471e1)}},
+   {{LL(0xcd7334fb,0x8baf1c66),LL(0x9ea00553,0x97c9c63c),LL(0xa7040792,0x69ea9400),LL(0x5452617c,0x88a9a993)}, {LL(0x31a61d63,0x351dbf01),LL(0x18ccf2db,0x232b58d7),LL(0xca4a10db,0x4a6c45b3),LL(0xd641929f,0x6a5e33fe)}},
+   {{LL(0xf48c02a0,0x24d6f33a),LL(0x9a6b055d,0x38fa7d93),LL(0x5b7699f8,0xd71eb449),LL(0x50db0390,0xef56b91d)}, {LL(0xde66789c,0x8925a9d4),LL(0x7cf94e94,0x0466f30a),LL(0x309b9776,0x229a97c5),LL(0x4d0efc80,0xd18fded8)}},
+   {{LL(0xf4666b15,0xcc84ad78),LL(0x61fee54f,0xeda4fa62),LL(0x41ef5e34,0x20899e48),LL(0x6835dcdc,0x25e808c9)}, {LL(0x30338df7,0x7caddec7),LL(0x1c428837,0x425f0cce),LL(0xf57cd89a,0x05a2c8d0),LL(0x186d7f6f,0xb7789345)}},
+   {{LL(0x6a132af9,0x083723ac),LL(0x49464656,0xd20d67b7),LL(0x4cbd8c79,0xd2da033f),LL(0x4e39bdbc,0x11535403)}, {LL(0xd2493265,0x374ca955),LL(0x5baa52a1,0x5596dbf6),LL(0xd7134f01,0x1f9ec6e2),LL(0x7aad335f,0x57e39132)}},
+   {{LL(0xc04ee82f,0xe7a9c736),LL(0xfe272b62,0x56352d91),LL(0xa8feb4b2,0x026a2310),LL(0xaff81ac2,0x583627b9)}, {LL(0x1e712854,0xc5873417),LL(0x7e83ed63,0x9bab9e09),LL(0x31817045,0x44f72c7b),LL(0xf19ff0f9,0xfb2833d7)}},
+   {{LL(0xf3c5a5ae,0xff9ba069),LL(0x983ef82f,0x477a8745),LL(0xfc6dff89,0x2c76ffbe),LL(0xbc0581c9,0xa46d7ac0)}, {LL(0x3812e747,0x330b695a),LL(0x1ef269ea,0x1127b120),LL(0x268fc9ee,0x671abdc3),LL(0x292c037d,0xb79b5cd6)}},
+   {{LL(0xac6c7513,0x4dc597ec),LL(0x7137cb02,0x2a95c339),LL(0xaa158d09,0x1056c6c3),LL(0x62651a11,0xb7c57e70)}, {LL(0x4029dc23,0x204faeab),LL(0xbe951c2b,0x9cfcc9df),LL(0x6d2f91ec,0x6c207348),LL(0x0ad28254,0xeba44f9d)}},
+   {{LL(0x5ecbbda2,0xa8ad3655),LL(0x6d02cbaa,0xd2dfe262),LL(0x0caa7d42,0xcc3adc4f),LL(0x60c19a0e,0xb7d4037b)}, {LL(0x940f5e53,0xf348a376),LL(0xdb28bfda,0x36af5ad4),LL(0x0e1184f3,0xbccfa082),LL(0xcd943161,0x01b52933)}},
+   {{LL(0x6ddc2b29,0x30538e66),LL(0xfe8b55f3,0xa62931eb),LL(0x8c3d1285,0x53fa8c13),LL(0xf6e09177,0x6c04dad0)}, {LL(0xe9f72995,0x4117485c),LL(0x4118fe27,0xa327ed27),LL(0x27ab6f4c,0xf093cd5b),LL(0xd6230832,0xdba475a9)}},
+   {{LL(0x4b05ddfe,0xef32ca29),LL(0x55f1e45d,0xf0a1d655),LL(0xc4c07e40,0x73334086),LL(0x7d37650a,0xd94cedad)}, {LL(0xe77f62f3,0x68fc0478),LL(0x6f86d927,0x778538df),LL(0x3e88f10b,0x53547798),LL(0xc69c79f7,0x202e147a)}},
+   {{LL(0x8e229fcc,0xc8644cd0),LL(0xca3083a1,0x40dd3e04),LL(0x81327d1e,0xae69cd9b),LL(0x2c8f50ac,0xa82a5bb5)}, {LL(0x4521e436,0x5f4606db),LL(0xec9c0bf6,0x00660026),LL(0x155afae8,0x240d2560),LL(0xdfb37692,0x100600aa)}},
+   {{LL(0xbcde2353,0xc358664f),LL(0x9e568d49,0x92273ab7),LL(0x5b8afad0,0x170b988f),LL(0x8f3d6f5c,0x30eca57b)}, {LL(0xe4a2341f,0xd8333654),LL(0x7820dc37,0x159f2386),LL(0x0cdb7b53,0x1cb1ede9),LL(0xdfe03258,0x60835025)}},
+   {{LL(0xfd5a91cf,0xb8e9ba50),LL(0x4c46e29f,0xe98c574e),LL(0xf69d1c53,0xb39982ca),LL(0x0eb1e70e,0xa9cd8f58)}, {LL(0xb91554aa,0x2b40459a),LL(0x18e1b6c8,0xaa2580a2),LL(0xaaad3b10,0x9d2e8c3e),LL(0xcb7d29ac,0xa8162612)}},
+   {{LL(0x55af1ec4,0x352c193f),LL(0x93ef8e8e,0xd7c55bbc),LL(0xd64b2035,0x125861f9),LL(0xe6d5f30d,0x3608cefd)}, {LL(0xad9f900d,0xb51ae2f4),LL(0x3f5e7e65,0x75051125),LL(0xdb369bcb,0x13666ccc),LL(0x3d293bdc,0x4b860a20)}},
+   {{LL(0x1ed3b9a8,0x4a5e74a3),LL(0xe766263b,0x659e630e),LL(0x20f1fa83,0x76aab4a8),LL(0xa7e5c04e,0x538d8058)}, {LL(0xb4d0bf1a,0x24bbbd57),LL(0xdaf2116d,0xd6b483b6),LL(0xe0b26387,0x3741e9ee),LL(0x0b5085a2,0xbae08d1f)}},
+   {{LL(0x35235567,0x8d34cc5a),LL(0xc96f0460,0x4d1dca6b),LL(0xb0138158,0x0f9dece3),LL(0xff7d1100,0xff537811)}, {LL(0xfc094a31,0xfdb6c1c1),LL(0xcd2587b7,0xfc1caa8e),LL(0x48451fc1,0x929b5173),LL(0x41226af9,0x3a2721a0)}},
+   {{LL(0xade05650,0xd8d0daac),LL(0x06716360,0xe4da7719),LL(0xbad5c948,0x40e4ada2),LL(0x200fab41,0xc8351a4b)}, {LL(0x8ba775ce,0x6b331a1a),LL(0xdb863e54,0xa63306d4),LL(0x4f933432,0x91830d35),LL(0x3f8d1ac1,0xd68dd3de)}},
+   {{LL(0x2528eb1d,0x8324de53),LL(0x01bc884f,0x3e0bd21e),LL(0xe7033a75,0x52e759fd),LL(0x4b4dd9a8,0x02b650e9)}, {LL(0x043e9841,0x54d8ac61),LL(0xdb242bbf,0x72593a53),LL(0x5cab882c,0x3758f4ae),LL(0x2561c6bd,0xc90e0e6f)}},
+   {{LL(0xcd7b4a87,0xe12a9d84),LL(0xe3c89834,0x7161815b),LL(0xbc101b3a,0x395c0bc4),LL(0xa3ca73f5,0xbd595d18)}, {LL(0x03b799b5,0x3d310df6),LL(0xc53f29b4,0x40bfc0e3),LL(0xde158b51,0x53d4aa86),LL(0xd6588c59,0x2ce11e18)}},
+   {{LL(0x4b75949f,0xcf239c30),LL(0x5ac11681,0x6395491a),LL(0x163539cf,0x6a27ed1b),LL(0x04039ca6,0x493f2f58)}, {LL(0x7f69a5c2,0x9f5199c8),LL(0xae2d0cee,0x8c18d82f),LL(0xa219813f,0xf62a341f),LL(0xf4361434,0x26c64ef5)}},
+   {{LL(0x4a0ef08c,0x77345c8b),LL(0xaf73cca8,0x3cc435b5),LL(0x450fb7a4,0x0a919f44),LL(0x19114b21,0x28627d87)}, {LL(0xdd130271,0xfc4c4cbf),LL(0x1ad2ebfc,0x106926a6),LL(0x3db2b4b4,0xdd3df56a),LL(0x0ffedd8a,0x173797c1)}},
+   {{LL(0x8fe51d76,0x93d3cae1),LL(0x0d3ef578,0xe1ca5c0f),LL(0x62d4a204,0x8895d6f1),LL(0xb4b41b5f,0x40f1d4b8)}, {LL(0x27f2892a,0x57aa8c65),LL(0x900e284b,0x61656212),LL(0xbeac4ac5,0x539e37ef),LL(0x22defd99,0xa44657e4)}},
+   {{LL(0x37a12077,0xe368b228),LL(0xccb8c8f2,0x20c27563),LL(0xb04d490d,0xe520a36c),LL(0xd3b478b4,0xa609fb8a)}, {LL(0xf46f356d,0x016849f2),LL(0x3bc4dea1,0x6097039e),LL(0x9dc6d80b,0x47b8671b),LL(0x3cc7d41b,0x4488e969)}},
+   {{LL(0x38caee8d,0x8906b359),LL(0x978659cd,0x1361f201),LL(0xd3b2a63e,0xc3cdb311),LL(0x426f1eae,0x4ca18196)}, {LL(0x23f6680b,0x9fc1bb42),LL(0x3c7eced2,0x41341af1),LL(0x7a68e765,0x88285a2c),LL(0xb0d1d8f2,0xaa750ed2)}},
+   {{LL(0xbc7e971f,0x5f5d88f4),LL(0x6d8e7ec6,0xe5024a8b),LL(0xc70638b0,0x670a0c37),LL(0x5a937203,0x50946a8d)}, {LL(0x3f078903,0x4ab6437d),LL(0x64b29a91,0x9283a6c2),LL(0x61262bca,0x4a8324f3),LL(0x4623bcf6,0x4e5cee7d)}},
+   {{LL(0x65d524e7,0x527733d2),LL(0xac54edb9,0x46922641),LL(0x7c3abbfd,0x214ee73a),LL(0x19d4db91,0xcc0823fc)}, {LL(0x7e048a00,0xd0fb8000),LL(0x4d503e08,0x38c0cc59),LL(0x95aa4fb3,0x47887be9),LL(0xd69f1e7a,0xb1aaff36)}},
+   {{LL(0xeaec6ee0,0x90804a1f),LL(0x419cebb8,0x8c705172),LL(0xbe19ee57,0xbf97023a),LL(0x9949dfd4,0x892e73c4)}, {LL(0x8fe3596a,0xe5d2274d),LL(0xe452294f,0xbf374756),LL(0x07171553,0x7004f367),LL(0x87ccc25f,0x9cc1fc0e)}},
+   {{LL(0xc0156556,0x324f985e),LL(0x6d0280d1,0x6aa64bfe),LL(0xe71b4fd9,0x9573e5b2),LL(0x604e69b7,0x8c27ee90)}, {LL(0xe8e69c1b,0x638f668c),LL(0x47872752,0xcb082b9d),LL(0x6448cbf5,0x78cb1c7c),LL(0x1d64289b,0xecff9fb2)}},
+   {{LL(0x60a73003,0x87e6c037),LL(0x662900f7,0x2ec1a645),LL(0xeb2bcceb,0xe5426ba3),LL(0x183ce483,0x5a92db41)}, {LL(0x6d14ff01,0x42134557),LL(0xdb8c0a45,0x66edb7ac),LL(0xbc56e8a0,0x84ab655c),LL(0xe28e9ac3,0x1415df4c)}},
+   {{LL(0xf85361bb,0xbcdc7e9b),LL(0x16c0c714,0x6108993c),LL(0xaaa95baa,0xd07acd48),LL(0xe0fa5c4e,0x170340a5)}, {LL(0xb7952d95,0xc4f641cd),LL(0x972097c2,0x46abb8af),LL(0x405e2e5c,0x66dd8774),LL(0xe65cd521,0x4b5e06e0)}},
+   {{LL(0x9ba06f75,0xf735ba51),LL(0xaee16c33,0x7593d6fa),LL(0xe03ae69b,0x9d4bd1f3),LL(0x1ef6ea6a,0xe5fa6488)}, {LL(0xd9a7919f,0x3a6da864),LL(0x81272e19,0xddff474b),LL(0x1244c7b2,0xc5bb4e9c),LL(0xcc1c212a,0xedf8e52f)}},
+   {{LL(0xa4c1827f,0xd19a855d),LL(0x7fa05a73,0xe168d452),LL(0xa5b9ad4f,0x45ff209e),LL(0x53a6c5e8,0x40e3e466)}, {LL(0x48a00ae1,0x1698920b),LL(0x362e48fc,0x02230c98),LL(0xb91c59f9,0xf110025a),LL(0x44f66b0e,0x63110ad8)}},
+   {{LL(0x8376cda2,0x82df234a),LL(0xc6dddeca,0x8abf65ff),LL(0xc62a7da3,0x8f14f29c),LL(0xb1b6bca5,0xf72de3d5)}, {LL(0xa31eaef8,0x7ac2e3f5),LL(0x294b1ba9,0xe02837c5),LL(0x5de1f9be,0x6ec21aed),LL(0x02f3a951,0xb88e028d)}},
+   {{LL(0xa5f6104e,0x1f6e05ec),LL(0x3a07c6b4,0x499e15ac),LL(0x33663c56,0xa3e44646),LL(0x88eb0020,0xf53a6b9f)}, {LL(0x1803e5ef,0xdb552396),LL(0x73b33705,0xcff8733e),LL(0x0a2b3599,0x25c48cdb),LL(0x9dedbe77,0xc1ed86ce)}},
+   {{LL(0xa1671221,0xba436242),LL(0x7e91365f,0x4c9799a5),LL(0x121107c4,0x0192c883),LL(0xf5baa922,0x1b5cfa28)}, {LL(0x0730ac7a,0x7c3c2951),LL(0x1a25f163,0x51485604),LL(0x580f1339,0xf8bf7a73),LL(0x3e7a00c1,0xc8437d54)}},
+   {{LL(0xe54cafc1,0x06d9830f),LL(0xbc7bb25a,0x73c899e4),LL(0x4d019e9a,0xe02a1c21),LL(0x4c82f7ca,0x7def7c42)}, {LL(0xe4552ad3,0xbf92c623),LL(0x4889f025,0x5f794a85),LL(0xf23be980,0xc2997408),LL(0x2a201fc5,0x30720dc4)}},
+   {{LL(0xd95010ad,0x2867488c),LL(0xfd7cd271,0x58a3ccbb),LL(0x94603cbc,0xa8b6dfe6),LL(0x30714513,0x2f82f8b4)}, {LL(0xee947b2f,0x669651e6),LL(0xa9f5ef0c,0xab457d89),LL(0xb3097aad,0x318c4068),LL(0x2ebd81b4,0x48603ebb)}},
+   {{LL(0xa9214a69,0xfad72cde),LL(0x3a043b40,0x47befe5e),LL(0xb8756eb1,0x081a6331),LL(0xb07bfe5c,0x742baa0a)}, {LL(0xca969b23,0x139afd20),LL(0x5b0efb6f,0x8e79ff98),LL(0x4fe3d560,0x597adc3c),LL(0x4ec7705f,0x43f3575a)}},
+   {{LL(0xe721a8d9,0xd68edbdf),LL(0x99163951,0x7835a595),LL(0xdae8ced5,0xe26c64c1),LL(0x6fb38c50,0x6f33650e)}, {LL(0xfa4c968e,0x67e0a347),LL(0xadf4ad2b,0x0543656c),LL(0xd0796eed,0xb1949ee0),LL(0xe913d08d,0xf7d787ec)}},
+   {{LL(0xce8779fc,0x1ba96853),LL(0xf7136c6f,0x189f03f7),LL(0x01dee7c0,0xf8ecfbd2),LL(0x26238c14,0x14b7152b)}, {LL(0x49931faf,0xc287ca3c),LL(0x021862b6,0x35e51c26),LL(0xb21f5f11,0xd184b1a2),LL(0xfdc410b9,0x00bfa4f9)}},
+   {{LL(0x231a71e7,0xe2ef1957),LL(0x4ca62ea5,0x2f94036b),LL(0xd252d403,0xaa5b09bb),LL(0xd597319c,0x3f0ece2b)}, {LL(0x38297585,0xa3534f11),LL(0x471ad08c,0x9d82a8df),LL(0xc76e538a,0x7cec8f1d),LL(0xfdb8060f,0x2d81b849)}},
+   {{LL(0x32573393,0xf287b623),LL(0xa70faa41,0xb6c8c122),LL(0xa813ece4,0x1920eb65),LL(0x10f25914,0x413ce002)}, {LL(0x8f0de961,0x1bfef2af),LL(0xa1c99d94,0x56a3ad75),LL(0x06c897bb,0xda794218),LL(0x9d80d2be,0x0bbe1cf0)}},
+   {{LL(0xa134f6ec,0xb11894a4),LL(0xd2c860b9,0x8d547d4c),LL(0x12927767,0x43f75cf7),LL(0x05aec5e5,0xf9ec7a75)}, {LL(0xc0a9dbbd,0x7f62ecba),LL(0x0fbc05ca,0xd742229e),LL(0xb8e70ac7,0x6c102f0c),LL(0x447e391b,0xca49cfc4)}},
+   {{LL(0x45f7c12c,0xe0393cf3),LL(0x0ae0315e,0x2ffd44d1),LL(0x9a965165,0x035555df),LL(0x02bc3313,0xd58979e5)}, {LL(0x64f7f59e,0xc86e4daf),LL(0xdb68d956,0x6f82fd69),LL(0x9ec3e2de,0x4d5bd510),LL(0xb62d9cf9,0xb11d3f5a)}},
+   {{LL(0x8f428264,0x7e0ed4c8),LL(0xb436ae34,0x86d4e114),LL(0x51a9af3a,0xf104ceff),LL(0xc8f27d9d,0x4363c834)}, {LL(0x9bf54020,0xf07be56e),LL(0x6ee4ff2f,0x00931668),LL(0x2120780e,0x1458c5fd),LL(0xe8b675c6,0xc9d6d7a6)}},
+   {{LL(0x61fce3f1,0x305631d0),LL(0xa2551e17,0xb2dc2f83),LL(0xc760a38e,0xe659c07f),LL(0x0d2af67c,0xf6903600)}, {LL(0x5bd2eba7,0x9dd7c13c),LL(0x40d2ab55,0x7bc961e8),LL(0x2bc435b4,0x57d801aa),LL(0xa869a219,0x5967507d)}},
+   {{LL(0xce616610,0x333b3f42),LL(0x984c5d32,0x36eaaa3a),LL(0xd7574093,0xfe9749b9),LL(0x99c5accd,0x2a5c0776)}, {LL(0xa22c81b4,0x40513026),LL(0x4ba10402,0x3de26e23),LL(0x27b8da3f,0xe8382e6b),LL(0x0688d633,0x8eba886c)}},
+   {{LL(0xde581444,0xaf176be4),LL(0x731ad1c4,0x983ef59e),LL(0x9bb2357f,0x133b5409),LL(0xa0dd66e4,0x5fb15701)}, {LL(0xa869fa06,0x828c8499),LL(0xb50cd311,0xdf05448d),LL(0xfebbd718,0x122f7839),LL(0x4fe9d86f,0x67198ce9)}},
+   {{LL(0x05ae6d79,0x9bf8e789),LL(0x77546d9e,0x778eed18),LL(0x607faa53,0x26e3a1da),LL(0x48917bf7,0x1e7d6d66)}, {LL(0x0acbb5e9,0x5fa71ef3),LL(0xd962f777,0x2ef5e56f),LL(0x48ff5bb4,0x46c4961b),LL(0x2951e3a5,0x35f73b3d)}},
+   {{LL(0xdb231269,0x6af6ebdd),LL(0xd16ecf49,0xe7b2f6e4),LL(0x78dcf4d8,0x6da4a77c),LL(0xbc47379f,0x66105abd)}, {LL(0x0ffcf230,0xf562d8c4),LL(0x0e10ad7c,0xea727482),LL(0x86a540aa,0xf011c755),LL(0xc0ec8191,0x2f20552a)}},
+   {{LL(0x24632ef1,0x9e93a535),LL(0x5c02bf5c,0xfca01e29),LL(0x7f9db1e8,0x517981fa),LL(0xc398910f,0xcdc1a046)}, {LL(0x7eb30084,0x02d811bd),LL(0xef77611e,0x92f4aead),LL(0x544e6197,0xf7ef255c),LL(0xb769e032,0xcbfdfc7c)}},
+   {{LL(0x65699ee6,0x39363692),LL(0x740cc0ea,0xf3c22710),LL(0xb0a06a5c,0x0d9dd5d8),LL(0x7548e65d,0x447861a3)}, {LL(0x2141cf4d,0x340dfb90),LL(0x69b498ba,0x40c0b313),LL(0x3f5908e8,0x5a1f26c7),LL(0x65bb47a6,0x1b7d5490)}},
+   {{LL(0x75700b46,0x88165b69),LL(0xb2f7c9d2,0x6071517b),LL(0xa2d53658,0x0b6a5604),LL(0x3d2dcada,0xba7ee70e)}, {LL(0xa0d73c09,0xa9272942),LL(0xd861efad,0x30ea8541),LL(0x363b18fb,0x66af85fc),LL(0xd36fafff,0xd7db0b9b)}},
+   {{LL(0x40bd35f9,0xa14d871a),LL(0xb7659a1e,0xc1384abc),LL(0x12e90672,0x1961a706),LL(0x46eaabfe,0x3788ccb5)}, {LL(0xb6789ce7,0x4e4ca62e),LL(0xd2ec4e1e,0x84726335),LL(0x9148edd1,0xe9034c24),LL(0x07fc2fcb,0xe9587476)}},
+   {{LL(0x5e19a51c,0x5ed2e3a0),LL(0x06186f35,0x575b5ea3),LL(0x731f8572,0xefb5c1b6),LL(0xc68ddcad,0xae2ee358)}, {LL(0x48565217,0x4a618926),LL(0x8001463e,0x2430d34c),LL(0xe4c8ffae,0xd7c2141c),LL(0xb69b10fe,0x161116e8)}},
+   {{LL(0x92b19e2e,0x70082bfe),LL(0x59bbcc7c,0x18858610),LL(0x5e4be779,0x0e595124),LL(0x265e61a3,0x5c3337d6)}, {LL(0x0bbc7265,0x991c276b),LL(0x12257611,0x4f5363e1),LL(0x0ac9ca06,0xfc84e284),LL(0xb554e5b3,0x322debe0)}},
+},
+/* digit=10 base_pwr=2^70 */
+{
+   {{LL(0xa8c46e18,0x60c5ef28),LL(0x3400758e,0xbdd07852),LL(0xc6066192,0x13c3796c),LL(0x5c131aa2,0x56ac699d)}, {LL(0xec5d028c,0x9eb3fa4a),LL(0x1b30f5e0,0xdbd7486c),LL(0xa82244a3,0x0929ab49),LL(0x31a1d3d3,0xa6498df1)}},
+   {{LL(0x96198bc9,0x4886cbe5),LL(0x7366aabf,0x42d4373e),LL(0xb3204b5d,0xde65db0a),LL(0x1a8cd005,0xcb3f6305)}, {LL(0x376af5de,0xdd738b59),LL(0xb4a71f08,0x2265e993),LL(0x3785c519,0x73a4816f),LL(0xaa50fe89,0xc98eef27)}},
+   {{LL(0xa3fcd07d,0xa24df2f2),LL(0xed81efaf,0x72c1a0e4),LL(0xd724648e,0xd1dbf5e4),LL(0x191ce28c,0x624ddf85)}, {LL(0xfac1edfa,0x628169f3),LL(0xbabd8cb9,0xe35b42a7),LL(0x4748893d,0x658c4aa4),LL(0xfc093f18,0xb68832c2)}},
+   {{LL(0xca8bd10e,0xd6903021),LL(0xc6272451,0x7c2c8213),LL(0xa5b14d82,0x067cc69d),LL(0x5779456e,0x09bc6274)}, {LL(0x90e5bedd,0x491003cf),LL(0xca2bc9d3,0xf0272347),LL(0xf77b27f5,0x07dbe881),LL(0xe1acc935,0xa7f8657e)}},
+   {{LL(0xb7b4ac46,0xb87fbcc6),LL(0x8527a86a,0x132abb4e),LL(0xbfd88b11,0xe78670d1),LL(0xa352932b,0x4212cfaa)}, {LL(0x35003688,0x83d7e5e1),LL(0xb79fd125,0xa7e4ba84),LL(0x919fd264,0xdad2027b),LL(0x87ada394,0x1a985173)}},
+   {{LL(0xc2e5474f,0x61c57320),LL(0xce635808,0x570bea18),LL(0x4ca67861,0xc2f80886),LL(0x9be870a3,0xcd3b2c82)}, {LL(0xd6ed63c8,0xe4eb71f8),LL(0x4c96f701,0xf52b6342),LL(0xb48fa302,0xe4e4748a),LL(0x6ab4e195,0x69a47628)}},
+   {{LL(0x7d178f3d,0x1f3e0717),LL(0x02ed45aa,0xb40d6333),LL(0xa929f102,0x20549c3a),LL(0x389a6596,0x8ea303cd)}, {LL(0x435c0708,0x7d49f30a),LL(0x08df9773,0x72f8d34e),LL(0x14840cde,0x53b95b72),LL(0x6cb0e1ff,0xda217e19)}},
+   {{LL(0x2fcc27dc,0xd48ee6e7),LL(0xa8f8a441,0x9459b268),LL(0x1e0e6b59,0x621709d5),LL(0xa53f5c0f,0x767d2ab7)}, {LL(0xf7dae3dd,0x30c51859),LL(0xeb941438,0x79371372),LL(0x2a9e82a3,0xfef0469d),LL(0x3d3817bd,0xa901d3e4)}},
+   {{LL(0xb6cdb3bb,0x04e4bd5a),LL(0xe9af899a,0x06864c71),LL(0x43f993cf,0x65f442ba),LL(0x21316e34,0xcf9321af)}, {LL(0xf2398bd4,0x6870d661),LL(0x007fe273,0xdc393bb3),LL(0x56270871,0x75e0f15e),LL(0x024f529f,0xb38fd2f4)}},
+   {{LL(0xd87688ec,0x373c45f6),LL(0x7033e952,0xed8d2810),LL(0x6bf92152,0xe5d634ea),LL(0x007b46cd,0xf86a3648)}, {LL(0x16a8c40f,0xd6229ffb),LL(0x092fcf1f,0x0f688ce4),LL(0xc24d79d7,0x12eab783),LL(0xf910fa3d,0x0f8be21a)}},
+   {{LL(0x7a77cb69,0xb6ab69bb),LL(0xd83a4655,0x356710dd),LL(0x590e5655,0x080726ab),LL(0x0d39c69b,0xb5b6e291)}, {LL(0xf369e23b,0xd8cf22fe),LL(0x5f1e5201,0xae3eab18),LL(0xe7d09526,0x5c1110db),LL(0x25aab9de,0x34025bcb)}},
+   {{LL(0x28e31933,0x57fb2f5c),LL(0x488f0307,0x4f941a25),LL(0xcffbd305,0xce6521c1),LL(0xf98c249e,0xd6823f0b)}, {LL(0x852bb3c2,0x5bc9ae16),LL(0x27e55cfb,0x4c0bf11d),LL(0xaf6b40c2,0x3ae61532),LL(0xd556097d,0x7cb8966d)}},
+   {{LL(0x385a47ce,0xf07ba22a),LL(0xef13be2b,0xb7374a1f),LL(0x13686d7c,0xb6708544),LL(0x969123fa,0x6da6a6d0)}, {LL(0x77315c57,0x8f3e2716),LL(0x66b75734,0xe303886e),LL(0x5fac48bf,0x412c7e39),LL(0xa2375284,0xe64057b0)}},
+   {{LL(0xbf9df68f,0xc5b57d2c),LL(0xfd189f9b,0xf37a2ff9),LL(0x089de90b,0x0431d42e),LL(0x9f802e48,0x9543c336)}, {LL(0x96547b7d,0xfc01b798),LL(0xd19736e9,0xc6b9ea70),LL(0xedc08363,0xc218e472),LL(0xbd6467f6,0x5d327a44)}},
+   {{LL(0xde75db6f,0xe55869ab),LL(0xe2bfb67e,0x0502e775),LL(0xd3baff50,0x16aea992),LL(0xfa5aeacb,0xc2e59ce2)}, {LL(0xefe72786,0x4a2c11b0),LL(0xc36127cd,0xee3e2ee7),LL(0xedd288f0,0xa274e02b),LL(0x40280563,0x97562dcf)}},
+   {{LL(0xf69f4a41,0x06359300),LL(0x365b855b,0xf6289d15),LL(0xf20caebf,0xcf892307),LL(0x037867b0,0x53050f46)}, {LL(0xbc01018d,0xcd9f8831),LL(0x0c764963,0x9f5a7cff),LL(0xccc8c6db,0x896bc119),LL(0x87266395,0x3aeaa17e)}},
+   {{LL(0xc99bf4ea,0x140ba70d),LL(0x5fa7a58d,0x3edf7cb3),LL(0x2bda5832,0xe5a0d410),LL(0x051d41c0,0x0ee03dc1)}, {LL(0xe37cb7ad,0xce3e2c28),LL(0x8adfd406,0x2886491a),LL(0xb68992cb,0x7c40debc),LL(0xd80d6f75,0xc0b115b8)}},
+   {{LL(0x52186ad4,0xd056fbce),LL(0x4744750d,0x32335393),LL(0xd2e2002a,0xe8e9ee5d),LL(0x642dbbc8,0x227690ca)}, {LL(0xcccda3f7,0x9e96a947),LL(0x513bfca5,0xcccaae2c),LL(0x5b4d963a,0xc6c67214),LL(0x54729e5b,0xe36eddbb)}},
+   {{LL(0x3a38541d,0x16ec6c3a),LL(0x39ed09f3,0xfcbe786d),LL(0xe12082e5,0xd2cd1238),LL(0x9f13cdb2,0xf2af2ac9)}, {LL(0x601c85c5,0xaa7625da),LL(0xd503b778,0xd4b22a2d),LL(0x48515493,0x9e40e5d7),LL(0xcd08a785,0x52066f28)}},
+   {{LL(0xd7f02d26,0xae4db078),LL(0xac26d942,0xc65f85ba),LL(0x6f87f2a5,0x70877b6f),LL(0x94e6606f,0x267d15bc)}, {LL(0x4a99bbd5,0xb1567134),LL(0x1fb1dab6,0x6e1378ce),LL(0xf7bdc295,0xb1bdca31),LL(0xd557a617,0x8ccec147)}},
+   {{LL(0x2bca2883,0x22e41987),LL(0xd4029901,0x1be5512b),LL(0x9d808270,0xbdb94f89),LL(0xebe7c2ef,0x9d6aca03)}, {LL(0xe0d0de42,0x2b7366de),LL(0x33a3da60,0x0c1ade33),LL(0xb83228b3,0x8ffb5c8f),LL(0x92381c79,0x4a9a8bf2)}},
+   {{LL(0x64ab1659,0x808f239b),LL(0x7581ede1,0x787c8720),LL(0x81adbf39,0xe6cdc73c),LL(0x212cadd3,0xf898f1f2)}, {LL(0xad5185a1,0xc4898105),LL(0xa96a4637,0xa1c8d94e),LL(0xea592bb6,0x673a2852),LL(0x40f04df0,0xe6e2f91f)}},
+   {{LL(0xf599c194,0x5b04b607),LL(0x41789337,0xed176fd8),LL(0x836c7384,0x55d07dfc),LL(0x8d16beab,0x02ef7f8b)}, {LL(0x2a2fb582,0x30e2ecfe),LL(0x42239d80,0x5f858850),LL(0x47311bf3,0x6de69a97),LL(0xd6537cb4,0xe5035b08)}},
+   {{LL(0xa023701f,0x545cc067),LL(0x5db8696a,0x73c0795b),LL(0x63513fb1,0xb6782e74),LL(0xced829da,0xb803a3d1)}, {LL(0x62ad7df8,0xe41f6452),LL(0x4820b510,0x28f7c9bb),LL(0x51bb26ed,0x53fb148e),LL(0x7379da10,0x060a3a0f)}},
+   {{LL(0xca5d29aa,0xc1cdba5d),LL(0x2a9c1167,0x7b3bf6d8),LL(0xeb99c693,0xba44d295),LL(0xd7702f67,0xdd8b6c90)}, {LL(0xc9020430,0x1880b1d2),LL(0xa3cf8d35,0x9023c1a6),LL(0x3680e4ba,0x3859f398),LL(0x9c13bd00,0xa0d6d252)}},
+   {{LL(0xea948f0f,0x97b72c56),LL(0x9a53b08c,0x46164a48),LL(0xab079db4,0x2f4766cd),LL(0x884fcc54,0xc0032798)}, {LL(0x0f2c469a,0x360f15c5),LL(0x91faf16f,0xda4654ff),LL(0x959c8bc4,0xf972862b),LL(0xd69ec8dc,0x8baea208)}},
+   {{LL(0xd7fc5662,0xa7bb8005),LL(0xd826ead2,0xf5d3c12b),LL(0x52a7c9d3,0xb7ef2a4e),LL(0x7f284391,0x068a2d3e)}, {LL(0xfd32b95b,0x8b31ebcf),LL(0xae817cbe,0xe8a198e3),LL(0x709622f1,0x4fe885af),LL(0x4b85fed3,0x359b9bd1)}},
+   {{LL(0xf773e8ab,0x7e398389),LL(0xdc861bf6,0x16f66b2c),LL(0x0f4896d0,0xe790a84f),LL(0xbfc0d884,0xb622b3e7)}, {LL(0x68b5a0db,0x45b873ed),LL(0x568e591e,0xf1489f00),LL(0x29ead459,0x56c1ccc7),LL(0xa9e27e80,0x413c29c3)}},
+   {{LL(0x38560dd4,0xb92bf25e),LL(0xf8dbafa4,0x705a108a),LL(0xdd457db3,0x21a8dcea),LL(0x31567166,0xa6b8362c)}, {LL(0xb5cc9ab3,0x2403897c),LL(0x2732888b,0xf6fab357),LL(0x6670b41f,0x098c7e03),LL(0x3b7dac32,0x746557e9)}},
+   {{LL(0x0236e285,0x35fefab7),LL(0x2774e349,0x46cbdb6c),LL(0x9ef17109,0xced87555),LL(0xa62f1ae5,0x239bca38)}, {LL(0x62a84d6e,0xdf111398),LL(0xa5e0f4a2,0x0a85e6fc),LL(0xa77ef72b,0xf99fb58a),LL(0x7a8948e4,0x8a9982bf)}},
+   {{LL(0x661aab9c,0xaec530ab),LL(0xc09081db,0x69e829df),LL(0xabd8573e,0xeec2a176),LL(0xe49c7434,0xfd66e1dc)}, {LL(0x3c3022fd,0x7cd3374e),LL(0x782a5ee9,0x57f4aad9),LL(0xccf4c17c,0xc4895756),LL(0xdfcf2f68,0x8c2c2238)}},
+   {{LL(0x24d59b3b,0x34a74e34),LL(0xdc8f7797,0xaaefcbd5),LL(0x7ee6678e,0x5c1a421b),LL(0x0a9009a4,0xdb0ff59f)}, {LL(0xec8032b4,0xd34b5f90),LL(0x31f0fcc3,0xa18f9777),LL(0x284db8df,0xa261f6f3),LL(0x6e792bb2,0xa2424c98)}},
+   {{LL(0xf5d0c02d,0x88569dc6),LL(0xcb6bec70,0x26b907d6),LL(0xe43aea0a,0x13843bbc),LL(0x05f21d11,0x617e168b)}, {LL(0xe29d0cbb,0xf144b679),LL(0x7024cf5b,0x91e4a881),LL(0x19180f88,0xc378d716),LL(0x54ed1082,0xda518a99)}},
+   {{LL(0xf072c2c7,0x2126ab7f),LL(0x9c184289,0x3a47acca),LL(0x3beaeb53,0x6dfac532),LL(0x74273eb8,0x84edf6f7)}, {LL(0xffb63e39,0xa321d2fa),LL(0x2cf4d651,0x9bc7aaf9),LL(0xa64b49d2,0xaba3faae),LL(0x6bc59455,0xf73289d4)}},
+   {{LL(0xbe4f6bbe,0x1467056e),LL(0x4194bde6,0xf4760c6a),LL(0x5c9e7262,0xf5764a45),LL(0x04587fe4,0x7ef74ac6)}, {LL(0xe777be68,0x77cf78e5),LL(0xa6c87d60,0x25afa50e),LL(0x3fd6fcb1,0xde489976),LL(0x2dc827f0,0xcde258a7)}},
+   {{LL(0x90eb1b2a,0x25cfa041),LL(0xa27d8c4f,0xc5bc28cb),LL(0x0a904a49,0x3580377c),LL(0x4a8ee409,0xb6b90b44)}, {LL(0x01a9abd8,0xf844d591),LL(0xd6ff4e82,0xbca41e86),LL(0x7fe7b749,0x03947e3c),LL(0xaec7ad54,0x439aedae)}},
+   {{LL(0xd37d6329,0x7f16d734),LL(0xf7590c33,0x5246076d),LL(0xb3a6b219,0xa387b037),LL(0xb144579a,0xb8d31f32)}, {LL(0x8022f33f,0xf7e82c26),LL(0xbddc755b,0xe1dfbdef),LL(0x7341663c,0x5601861d),LL(0xb6f9c9c1,0xfd51a88a)}},
+   {{LL(0xbdce8225,0xff5a4efe),LL(0x0a0d7f4b,0xe48f112d),LL(0xe7b45e11,0x761f8392),LL(0xcf9f6904,0x1962a7c8)}, {LL(0x87cf2010,0x5bc4835e),LL(0x1147a2d8,0xde0644a9),LL(0x8adf17b4,0xe3877479),LL(0xf2ed2d8d,0xfe1b747c)}},
+   {{LL(0x6d3fbe07,0x70c6e020),LL(0x26f548b9,0x123eb346),LL(0xd5af55a1,0xd9679fe1),LL(0x695a0c42,0xc0f99991)}, {LL(0x14118c76,0x8c5030df),LL(0x5c6c52bf,0xde54e2dc),LL(0x77a5d58d,0xb946a54a),LL(0xeb7230d7,0x8047efe3)}},
+   {{LL(0x9478441a,0xb510f6ef),LL(0xf0846ba6,0x9bc72e40),LL(0x93f54c84,0x5b91d096),LL(0xbe53e825,0x19c5b6f8)}, {LL(0xc7a99964,0xe44535ed),LL(0x1ca8d56d,0xb985ed80),LL(0xe7c569f1,0x134456f8),LL(0xee3cc596,0x99d2a276)}},
+   {{LL(0xc4fbd15a,0xc379154c),LL(0x42a28720,0x9a570d9a),LL(0xc25517da,0x591b9609),LL(0x2345f7ac,0x7035ec0b)}, {LL(0x7de6a220,0x0af17957),LL(0x59afe8f0,0x1ac58522),LL(0x13a2b542,0x9d165f4b),LL(0xdb0d9ea4,0x93eac58f)}},
+   {{LL(0x51f17014,0xe8bea31c),LL(0xfb852afd,0x87535769),LL(0xa85b8553,0xf6c5f4c4),LL(0xf3ea05ac,0x3d175236)}, {LL(0x12ef95a0,0x95a0447c),LL(0x066827d2,0x0f9d7a43),LL(0x98f6f5de,0xc749d169),LL(0xf983396f,0xf908a1da)}},
+   {{LL(0xf769c903,0x367fa2aa),LL(0x4f362a95,0x8ff169bc),LL(0xef03d134,0xe7ea277b),LL(0x6bbc3241,0xfb909e1d)}, {LL(0xbe40fd47,0xbc0ef621),LL(0x36c784d0,0xeb81af8b),LL(0x4d7258e1,0x9f3c436e),LL(0xe0c1070f,0x659a0008)}},
+   {{LL(0x6e1ee4f4,0x73aacde3),LL(0xeed613ee,0x7d38933b),LL(0xa3f45f5d,0xf9f1c12a),LL(0x3cf1f194,0x5cb40114)}, {LL(0x90b00266,0xf3b4187c),LL(0x3ff2bc05,0xae1eecbf),LL(0xb9ec7510,0x68485897),LL(0x9dfa7e47,0xaad79937)}},
+   {{LL(0xf8425199,0x920c83c1),LL(0x1db2901c,0x4c356309),LL(0xb54350d8,0x94f7575a),LL(0x766da34f,0x0f583fcd)}, {LL(0xeb4cdb56,0x7e4a332d),LL(0x9c858a49,0xde50a366),LL(0x8850e0e1,0x2f5c675e),LL(0x0823cb73,0xa6984d60)}},
+   {{LL(0xf0306f5a,0xf2be2b4f),LL(0x0f656e4f,0x1460057f),LL(0x8e5a40b2,0x18b0a19f),LL(0xd8e60010,0xe0ee61da)}, {LL(0x51a17c5b,0xeb889c6c),LL(0xd29a727d,0xab9bcbf1),LL(0x938b3602,0x0489da03),LL(0xf2201024,0x3a63f755)}},
+   {{LL(0x6b8867ae,0x48b9ba81),LL(0x5beaa295,0xf21bd399),LL(0x314f06e5,0x04afeb7a),LL(0x4d69a1db,0x97b3d631)}, {LL(0x2c3abd28,0x7894bbc6),LL(0xf61be930,0x8d4c2024),LL(0x6cd3c115,0x1c99fabd),LL(0x489fc174,0x81fd713f)}},
+   {{LL(0x34f22c3d,0x8a5186c9),LL(0x5d4dea4e,0x6f3b0620),LL(0x8d142a58,0x699a1fae),LL(0x63b6f85d,0xe6ef9a27)}, {LL(0xe7619098,0xe328ed2f),LL(0xcd5e2a62,0x6a711e28),LL(0x8df04df9,0x6e660328),LL(0xbfca294c,0x20408abd)}},
+   {{LL(0xbf1b63a1,0x0a56526a),LL(0xf6c5b906,0xa2c60843),LL(0x0be4c10e,0x5853a055),LL(0xbf4be34a,0x07b7f195)}, {LL(0x834eb30f,0x84236601),LL(0x554ad143,0xc341a3a2),LL(0xfef50155,0x5726c18a),LL(0xfba3f989,0x6675b2e2)}},
+   {{LL(0x1a724c08,0xaf57caa5),LL(0x8572e2fe,0x1aeb064f),LL(0xf4d42236,0xd581e9f8),LL(0xcac0a73b,0x981b8bf9)}, {LL(0x6e62377b,0xa4dda971),LL(0xcd8b2630,0xf616c2a4),LL(0x43a9e0d7,0xd62bb5c2),LL(0xf2900034,0x0ba4572f)}},
+   {{LL(0x141035f5,0x98526ece),LL(0x47f96932,0x9d23e0c7),LL(0x303f1030,0xde71b90c),LL(0xd8b2c978,0x1ab75822)}, {LL(0xc9a8a043,0xb05416f4),LL(0x207cb89a,0xfd09d2c4),LL(0x829c9137,0x337ea541),LL(0x91f1b95d,0x32cdee0b)}},
+   {{LL(0x1e167589,0xfbdaf4c8),LL(0x3a40ad21,0x92f4e022),LL(0xb20a6100,0x7dde5491),LL(0x36882e26,0xd3e318a6)}, {LL(0xec661377,0x8b429db5),LL(0x263bfc94,0x50f3d163),LL(0x8cf1ea61,0x440b1e5a),LL(0xa4acdb9c,0x7ac91a81)}},
+   {{LL(0x5de555ee,0x7075a4a2),LL(0x34628abb,0x3e3029a1),LL(0x4681952d,0x66864e77),LL(0xc216b391,0x1598ac5d)}, {LL(0x925306cd,0xfb683b4c),LL(0x389478f6,0x3a195098),LL(0xeb637b71,0x4de8d01b),LL(0xd4863597,0x30cefab1)}},
+   {{LL(0xec3bdd24,0x2c01471d),LL(0xdcd0bffa,0x506caf09),LL(0xb390b435,0x796c84d5),LL(0x13ffd168,0x8a945849)}, {LL(0x7181d5d3,0xbf4582c6),LL(0x9a1593c8,0x4d02e605),LL(0xadb93647,0xe587df80),LL(0xa5bda620,0x0f9a916f)}},
+   {{LL(0x4b419a41,0xc03c9978),LL(0x08116e10,0x6f2417cf),LL(0x8a776d7c,0x2ac3a1c4),LL(0x0deb52df,0xdf439453)}, {LL(0xf97ff7fb,0x0da65c2a),LL(0x947a6f83,0x0def8af6),LL(0xa537c88b,0x137c4921),LL(0xb423ee63,0x3c6287a4)}},
+   {{LL(0x1dfd0324,0xad58c2d4),LL(0x21b01d36,0x81d98a8a),LL(0x52796b39,0x6383fbdd),LL(0x4277574a,0xc51ce718)}, {LL(0x644767c1,0xa27e6287),LL(0x1133f3eb,0x33f732a8),LL(0x2866847b,0xa0731467),LL(0xa56177ca,0xe9c31be3)}},
+   {{LL(0x0ac9c122,0xe0775154),LL(0xce7245d1,0xffdbaa9b),LL(0x2d075f70,0x18d8b4b8),LL(0x3081ed31,0x0117415d)}, {LL(0xbc9de469,0x8dd35493),LL(0x5dc75255,0xff6567cf),LL(0xe9f69b0b,0xea092559),LL(0x9e6b0b4d,0x1b3fc575)}},
+   {{LL(0xe9f96368,0x6d1e2d22),LL(0xb39dc531,0x8bf110ad),LL(0x79e0fefe,0xfdc376bd),LL(0x98ef312d,0x45d2bedf)}, {LL(0x59e0253d,0xc06acb78),LL(0x2cda9816,0x0bd3b262),LL(0x6530d59b,0x0660e88c),LL(0x8cfc848d,0xd7be8b49)}},
+   {{LL(0x74fba4ff,0xc5255038),LL(0x4b51bc10,0x7c63b042),LL(0x90d1253c,0xb978c083),LL(0xb6730083,0x1b9df8da)}, {LL(0x3c569f08,0x9e69a5b1),LL(0xb097dc2b,0x0f1e3c05),LL(0x20cf7d10,0x2b6d6775),LL(0xaa0e2833,0xf2f0ac82)}},
+   {{LL(0x58f3dde4,0x5ee23e3a),LL(0x5798d8e3,0x28ee2849),LL(0x7cd8b4fd,0x745549fe),LL(0xb6c43b2f,0xc421a726)}, {LL(0x28b388c8,0x09ec1c57),LL(0x9a6ae145,0xede0ec86),LL(0xac1c2b81,0xa8a3ba8e),LL(0x2a8ccc9a,0x1e2ae393)}},
+   {{LL(0xf76b0508,0xd45b911f),LL(0xd5d19bdb,0x48d8d596),LL(0x18a29b97,0x2f171c31),LL(0xcb0e6b47,0xe0b359ac)}, {LL(0x54d35829,0x6eac6649),LL(0xee9ae121,0x55b50cf9),LL(0x2e612445,0x10d8a8be),LL(0x2d879c15,0x894cd926)}},
+   {{LL(0x053f12a1,0xb5c46edb),LL(0x7ed85d8f,0x8be1d2d2),LL(0xc733f1f2,0xb9d3efc1),LL(0x3c2dd4bb,0x603b11c4)}, {LL(0xae34430c,0x34c8c61d),LL(0x408bf16d,0xb631a4af),LL(0x32bc1e18,0xd1e08231),LL(0x3e01180c,0x2c89cf65)}},
+   {{LL(0xac591e3b,0x6d63396d),LL(0xe5c43ea3,0xc695644c),LL(0x921fd7ec,0x3c026af9),LL(0x2aebea02,0x7af44a0f)}, {LL(0x7406f8e9,0x6b2b469f),LL(0x026d496d,0x5cf8173d),LL(0x8f9e1916,0x1a215954),LL(0x9dda5725,0x053a99e4)}},
+   {{LL(0xfb74773e,0x69d5655f),LL(0x1b650072,0x6080c2cb),LL(0x7c124c10,0x87eb0a1d),LL(0xd0a53741,0xb98c157d)}, {LL(0x2dd5e610,0x8236452d),LL(0x79ac2691,0x4ff17b15),LL(0xa8d2c252,0x6480c758),LL(0xbf5a070b,0x99e48336)}},
+},
+/* digit=11 base_pwr=2^77 */
+{
+   {{LL(0xae718ee3,0x0122b6fa),LL(0x0953c76a,0xfbd125de),LL(0xacc8df2b,0x228dad14),LL(0x3b6a34d1,0x19462480)}, {LL(0xa6dada25,0x101d6700),LL(0xb2ace072,0xa9d7f08b),LL(0x28c9e6d3,0xa3890cf0),LL(0xff0ec046,0x75441fd9)}},
+   {{LL(0xe7e99abe,0xf441a4d5),LL(0xcffebd31,0x613b633c),LL(0xc9225e84,0x38f79232),LL(0xa8d50c76,0x77e71551)}, {LL(0xadb6dbc9,0x4eaaa476),LL(0xe874dfff,0x0c05d4d6),LL(0x2a79f78c,0xe90b6084),LL(0xe5b044ef,0xfc2440ea)}},
+   {{LL(0x1f7791b2,0x0bfe0099),LL(0xec7118c0,0x824319b6),LL(0x26ff0e91,0x5488021a),LL(0xe519662c,0x4b99be59)}, {LL(0x61454f0e,0x56642798),LL(0xf8964409,0xe3d52fc5),LL(0xcfa269e8,0x803474b5),LL(0x9dca4b46,0x44098832)}},
+   {{LL(0x9d5489fa,0x0d8d3014),LL(0x73075ec5,0x7e6ea0c1),LL(0x9915c0c5,0x690b5733),LL(0x9b1b8d24,0xeb43bd65)}, {LL(0xdb8c3a67,0x0f314caa),LL(0x0c43866c,0xf4b15edb),LL(0xda747467,0x8a449724),LL(0x9b6aa0a7,0x1db81987)}},
+   {{LL(0x9e5334f6,0x845ea475),LL(0x8c1b666c,0xfc1f543f),LL(0x597c9568,0xa8b04080),LL(0xbe874b25,0x63ca9bd3)}, {LL(0xfd68ad96,0x2e3bea45),LL(0x8a532537,0x986ac26f),LL(0xc0d261c7,0x09b96c53),LL(0x6edbc81f,0xb2736c31)}},
+   {{LL(0x8f1a81e1,0x4ed28ebd),LL(0x4dad2297,0xb665265d),LL(0xb7cc92a2,0x7c893c7e),LL(0xcbd014f0,0x411cb60a)}, {LL(0x87d1b3ea,0x2a6daa73),LL(0xf72e7ed4,0x75685393),LL(0xd9716123,0x653ba282),LL(0x07bf8981,0x36f16d38)}},
+   {{LL(0xccb72a2b,0x87ac6925),LL(0x18a91aef,0x72291b67),LL(0xb9d3a9b9,0xb643d054),LL(0x7432556c,0x64f5e88f)}, {LL(0x6c0cd513,0xa0e75f2d),LL(0xb274ba66,0x0fd98813),LL(0xf4611841,0x0ede318e),LL(0x14ccb0f0,0x62174ebc)}},
+   {{LL(0xf8023127,0xbe0b2578),LL(0x8a8b68de,0xa95ccd09),LL(0x1925e578,0x0dc60235),LL(0x004fca40,0xb2153f53)}, {LL(0x72665f8e,0xb025456b),LL(0xa0246bee,0xa5327909),LL(0xf075a443,0xfcfc4ef6),LL(0xfbf58688,0xb013b77b)}},
+   {{LL(0xc76d4bcc,0x61cf5482),LL(0xa479ac17,0x33b9dd00),LL(0x378d08f9,0xab76cdb0),LL(0x1b0169ee,0xa7853f07)}, {LL(0x2d9a6c94,0x520c8c77),LL(0x505c01c3,0x1052dda3),LL(0x79057b87,0xe1cbad70),LL(0xe1cebe6a,0xbadb7c74)}},
+   {{LL(0xe863b050,0xcbd75627),LL(0xabf6e435,0xb69463f6),LL(0xd40663c7,0x8c5ddb7e),LL(0xa44d0f9e,0x60163cad)}, {LL(0x8837b776,0x27ce5cf8),LL(0xc4517de2,0x5822a6b9),LL(0x4a5fa804,0x13ebd2cb),LL(0xbb45f37f,0x9757a8b3)}},
+   {{LL(0xd8b7631d,0xf2cd3053),LL(0x1cf86301,0x6fbf49f8),LL(0x0f81683e,0x58782306),LL(0x9c3bfee6,0xd016f7fb)}, {LL(0x8288f87f,0x86237abf),LL(0xc99bedf0,0x7ea1cb82),LL(0x8580ef70,0x6d576a36),LL(0xedb3cc61,0x3f47edef)}},
+   {{LL(0x022ab3dc,0xa6335223),LL(0x7ba0cc16,0xf40befb2),LL(0x1305ecaa,0xc04ef5fc),LL(0x702bf51e,0x97369e0a)}, {LL(0xfc9322f1,0x12e19d2c),LL(0x2a02be68,0xd7a4ac9c),LL(0x79b276dc,0xf43ef7c9),LL(0xbfec9028,0x68068a0d)}},
+   {{LL(0x1af36580,0x5666a97a),LL(0x18caf853,0x2d1cbaa5),LL(0xef90bc8f,0xb18307c7),LL(0xba0fb4ed,0xa31e4d1d)}, {LL(0x87e1c358,0x5b690ba1),LL(0x31124536,0xcba0c072),LL(0x1a503f36,0x435dca21),LL(0x0fcbfcf7,0xbb5dd010)}},
+   {{LL(0x4fc68e88,0xd5570fab),LL(0xb9b0a139,0xdf0c6bb7),LL(0x6776ed5c,0xc07d66dd),LL(0x99b83913,0xa6289cbf)}, {LL(0xe8b0b5b6,0x5ad90ba4),LL(0xa4227441,0xa84c093a),LL(0xcdd1cc9e,0x9c5163e4),LL(0xc398aad8,0x606e8da9)}},
+   {{LL(0xe032e7b5,0x8a67a1d5),LL(0x8ca5da00,0x77ba9404),LL(0xd2f61f70,0x4661e336),LL(0xa10ca29f,0x8f797d49)}, {LL(0xe6094f0b,0xd5700ac9),LL(0xc6b73a38,0xefc469eb),LL(0x40139abb,0x3ec9341d),LL(0xb86fd629,0xd4c8985f)}},
+   {{LL(0xf3b482cc,0x0cee8957),LL(0xf65ccbab,0x3944f9e5),LL(0x66c91c05,0x3270f90a),LL(0xd1db396f,0x74116505)}, {LL(0xb20c1646,0xb862a96d),LL(0xa3b158f9,0x35b467d8),LL(0x1e52b2cd,0xd41b157b),LL(0xa774015f,0x638d24c5)}},
+   {{LL(0x8362d5fe,0x701e8452),LL(0x3ab681b5,0x0f31c2a9),LL(0x0aeca763,0x9dba2928),LL(0x12209bc3,0x5ab77c92)}, {LL(0x125f07e3,0x50f374ad),LL(0x9e429b96,0x286bfc78),LL(0x1123421b,0x7a6ae784),LL(0x33226d1c,0xcf6da188)}},
+   {{LL(0x497dca55,0x8b723a18),LL(0x319e96bd,0xeb5263c7),LL(0xd8ffec62,0xe6ccb5a8),LL(0x1e58e3ff,0xdf7eefa4)}, {LL(0x525f0600,0xfc4db240),LL(0xeb09a67f,0xe7104c1d),LL(0xe6dab597,0xc9cd4ca2),LL(0x9437d94f,0xe85dfcf9)}},
+   {{LL(0x35c71184,0x8f7ac0d9),LL(0x0de9d858,0xe3ab078d),LL(0x26639cd1,0xec853d20),LL(0xd5524a48,0xc51815a4)}, {LL(0xcb624592,0xf22917fd),LL(0x4d0e2026,0x0285d454),LL(0xdf239891,0xce9660c6),LL(0xf83b250d,0x3ee4745c)}},
+   {{LL(0xe8d22ceb,0x6ae36b64),LL(0x2baee45d,0xf22bbc52),LL(0xe665fcf4,0x6386a194),LL(0xc7d1e5d2,0xd507dc42)}, {LL(0xe964f436,0x5d5f3088),LL(0xcdb18512,0x4d4367d1),LL(0xb74b23c8,0x2a105316),LL(0x9ac7d99b,0x1c777027)}},
+   {{LL(0x6b032471,0x6d46885e),LL(0x9aa0f3a6,0x21146fe4),LL(0x5c0dde69,0x1f8b7552),LL(0x2bbd6b38,0x36df5f9f)}, {LL(0xfbec0d51,0x6716aa53),LL(0x60891322,0x168808d4),LL(0xb8c54433,0x48d90658),LL(0x0bd51da3,0xfb5502bc)}},
+   {{LL(0x51b2f3c2,0x8cf62975),LL(0x0a50de2a,0x3149e1da),LL(0x1bd13a9c,0x8f3dddba),LL(0x4afe578f,0xefba6861)}, {LL(0x1391e8c2,0xa0745ed6),LL(0x6e12a043,0x6f3ac5ac),LL(0xe2cd701e,0x9aa18b44),LL(0x89008910,0x614eb64f)}},
+   {{LL(0xe73c72d9,0x1fe032a9),LL(0x452b792f,0x9e6f052c),LL(0x7ba201b9,0xc7e75720),LL(0x2f9269d1,0x70040084)}, {LL(0x6adaf8cc,0xfb0b9ef8),LL(0x150b7e57,0x97721db6),LL(0xa45cfc38,0x20f71cce),LL(0x65b25b76,0x88121803)}},
+   {{LL(0xe31d4659,0x7dc23489),LL(0xcb43db1c,0xa9e52e03),LL(0xefff5157,0xc0ea0d9f),LL(0x51c0fc54,0x39049ef8)}, {LL(0x87926762,0xce36f42f),LL(0xba4686f9,0x9592667a),LL(0x2e18e003,0xc10ac0af),LL(0x1d5b8020,0xd8331f21)}},
+   {{LL(0x339d2042,0x3717c0dc),LL(0x7f4b91b9,0x15a69420),LL(0xc0ef99d6,0x6d68c762),LL(0xa4c3ed41,0xe7b460f1)}, {LL(0x1b921c34,0x9347066f),LL(0x3386c2ee,0x88cf4891),LL(0xd8e636de,0x4d97fd14),LL(0x5ee35f90,0xeae03e12)}},
+   {{LL(0x25d8fb88,0xdcf9ca03),LL(0x9fc0571e,0x5628fc3f),LL(0xd6c4e51e,0x6b325bf2),LL(0x601188e9,0x6f0716e1)}, {LL(0x89ade0f5,0xb69285b2),LL(0x12ed2b01,0x60c1acd6),LL(0x43b60fee,0x27be1bcd),LL(0x00ed3205,0x3c2a20ef)}},
+   {{LL(0x2629646c,0x20ae1a3c),LL(0x2d759cc2,0xc83b0826),LL(0xa46fa469,0x88b00e39),LL(0xe643a599,0x04a32357)}, {LL(0x1a53b854,0x46968a30),LL(0x9d858849,0x74e25e47),LL(0xd23f2e31,0x5a1f22fc),LL(0x1468c507,0xb87cbde3)}},
+   {{LL(0x0cf57b6e,0xea2426fc),LL(0xbd710176,0xf9f30718),LL(0xdadf57c1,0xcbb7e2eb),LL(0x591d5d74,0xfef42bd9)}, {LL(0x1fbd15a0,0x4dee7261),LL(0x478414b2,0xe50e9ddc),LL(0x8fce2612,0x3ab394fd),LL(0x3cf7cebf,0xc72bff87)}},
+   {{LL(0x5463a142,0x5b7c5c9d),LL(0x91a38cd2,0x055971c5),LL(0x6b427aac,0xf05d7b93),LL(0xd5d232ff,0xc8cd671b)}, {LL(0x7623ecf1,0x05fd142f),LL(0xb41e6cf4,0x304d403a),LL(0x60a9297e,0x5705690b),LL(0x2dc000f8,0xe5f8a24e)}},
+   {{LL(0x745e49ac,0xdc04bfd8),LL(0xd28bad92,0x1d5d1fac),LL(0x139a5808,0x6efa8390),LL(0x5de67f76,0xc3446f40)}, {LL(0xdeee6c23,0x798fd789),LL(0x8ee77fe0,0x0dc296d5),LL(0x1ba5c706,0x41eb5857),LL(0x51c42eaa,0x796bc315)}},
+   {{LL(0xa4688a26,0x29d307c9),LL(0x6add33ef,0x73ca7b6f),LL(0xdbec7223,0xa01d0b00),LL(0x61e0905f,0x9d76afd2)}, {LL(0x81529964,0x6266bbaf),LL(0xc6e1eb61,0x002807a9),LL(0x0501bda8,0x27a99ea8),LL(0x87f101ad,0xa8fa4fb9)}},
+   {{LL(0x77805fff,0xffe0dfed),LL(0x31e71c1a,0x5fa794be),LL(0x9c96d5d3,0xc4aaf9dc),LL(0x321904c5,0x1d61fad6)}, {LL(0x05a93813,0x219a6524),LL(0x570ba1d3,0x7e1fd96e),LL(0x9c1da550,0x9010f182),LL(0xb7e78a0f,0xedc0e2f1)}},
+   {{LL(0x8c9dad16,0x041cbb54),LL(0x203c3c79,0x8e31d8e8),LL(0xc89a6962,0x0328c1f7),LL(0x34430286,0x3ecc7ff3)}, {LL(0xb12e0194,0x11bd770a),LL(0xaeec3c02,0xade7dd74),LL(0xb1b5c96f,0xfcd7f6fe),LL(0x67a05831,0x3bad126e)}},
+   {{LL(0xacc7310a,0xa055ccbd),LL(0x676829dd,0x9718967e),LL(0x2ef0845f,0xe45bfa6a),LL(0x1ae654fa,0x143b9243)}, {LL(0x306fe598,0xe3cedca1),LL(0x95404a92,0xcc6e9621),LL(0xefcbb160,0x42ffa3f4),LL(0xdd13ed49,0x15ca1ae2)}},
+   {{LL(0x9619e9aa,0xd1554e0b),LL(0x4d616015,0x42ec3ddb),LL(0x10731681,0x11bdd8cf),LL(0x467c972d,0x985b66c5)}, {LL(0x4aae07a5,0xeeeee602),LL(0x309ccfbd,0x4132917f),LL(0x04e73a18,0xb8eb78fc),LL(0x08c4bbbf,0xfcec2a44)}},
+   {{LL(0x59f93eed,0x7fd687b2),LL(0x0bfa105e,0x11bf4f01),LL(0x7301be3f,0x78eacf4e),LL(0x9bbe7ddd,0xfb933974)}, {LL(0x59f6f767,0x62832513),LL(0x62fa81fd,0xec016e56),LL(0xa5a3e643,0x1411ba9a),LL(0x3831cbe5,0xacbf0461)}},
+   {{LL(0x93f79f82,0x7d09f44e),LL(0x1e1814d8,0xa7b9028c),LL(0xac4971b9,0x90ad0a86),LL(0xfd99533c,0x8a621960)}, {LL(0x50eb352f,0x7b8f0bf5),LL(0x0cc82392,0x95ab7d8e),LL(0xff5b3cb1,0x9ce7c2b5),LL(0x18f5ba8d,0xd6490c9d)}},
+   {{LL(0x54333da2,0x6e2d9540),LL(0xa12f2060,0xd0685c0e),LL(0xe498b2e7,0xf83e6caf),LL(0x277af6cf,0x84acfd39)}, {LL(0x4559f3b7,0x3cd483a6),LL(0x25d02417,0xdcf821ab),LL(0xf04c38f7,0xfd23d5dd),LL(0xdbdb0ee6,0x86db26e5)}},
+   {{LL(0xf2c6d7b1,0xcfb2b7ea),LL(0xb8989ace,0x1a7e1c79),LL(0x0419bff9,0x9b98a14b),LL(0xf0478181,0x61b0189b)}, {LL(0x33495d97,0x33939c20),LL(0x057cf917,0xd0cdbcce),LL(0x200c03ca,0x686f7f8a),LL(0xe02871b9,0xd840703e)}},
+   {{LL(0x27ab3b85,0x9da2838d),LL(0xa5619978,0x28cb26b3),LL(0x1c50fc16,0x83856b95),LL(0x66b521a6,0xfbaefd90)}, {LL(0xb120ca34,0xea3368d4),LL(0x7a2fd88d,0x035416c2),LL(0x682644b8,0xc5138982),LL(0x402255f2,0xfcab1a3b)}},
+   {{LL(0x6e857518,0x96161fa9),LL(0x6a57b587,0xef746757),LL(0x02a8ff06,0xc18af83b),LL(0xee322c01,0xf774ffe7)}, {LL(0x72706020,0xeea5e38a),LL(0xcb68507a,0xd691c235),LL(0xd4bb2399,0xc0bb4717),LL(0x383f2791,0xfb1a49ee)}},
+   {{LL(0xc021bc97,0xab2d6944),LL(0x420a7968,0x1b3917f7),LL(0x61eb3724,0xfe195697),LL(0x96b43be7,0x67bb2689)}, {LL(0x08e0ac70,0xd164c94d),LL(0x6afdb593,0x8e44c7ee),LL(0x0a934934,0x8face623),LL(0x85c99382,0xe0dcbae3)}},
+   {{LL(0xd0d858d1,0xa7257a14),LL(0xe01d81a5,0x40251b6a),LL(0xfce352d0,0xe42e516d),LL(0xe70b9e6c,0xe6762817)}, {LL(0xaf48ad8c,0xd7f30dd4),LL(0xf1716799,0x0e2d20ff),LL(0x0f6d2e42,0xb029e584),LL(0xfb773070,0xfd535a3d)}},
+   {{LL(0x798051f2,0xcdbccd7b),LL(0xfe86a3e6,0xb21a4573),LL(0x89f45ba9,0xee09c4fd),LL(0x223775f9,0x34e40f9b)}, {LL(0x0f21dd8a,0xa2b7b0b1),LL(0xf00e8a48,0xe79c5393),LL(0x8809fb40,0x91affe04),LL(0xdb1cc029,0xc2048084)}},
+   {{LL(0xb36ff4fa,0x4a5af45f),LL(0x549a3096,0xeabf0563),LL(0xd1c9b7fb,0x5bf784eb),LL(0xa551aade,0xe5252c8c)}, {LL(0x1f78ad14,0xb43302a8),LL(0x127d079d,0x203d49a7),LL(0xbef92b00,0x7c67d02e),LL(0x23e72393,0xbc8b1088)}},
+   {{LL(0x80ed15a3,0x3693f948),LL(0xe3f274f4,0xe263802a),LL(0xa3ed5aec,0xa4df28aa),LL(0xd655e3ef,0x27e5c514)}, {LL(0x734fe165,0xf6486989),LL(0x17776eb9,0xfdbc4add),LL(0xbbc787c1,0x4aabdcbf),LL(0xed39fed3,0xd615f75b)}},
+   {{LL(0x44219ce2,0x1f99d36e),LL(0x6599588a,0x007e666f),LL(0x3ae9b409,0x93ca74d6),LL(0x58de5be0,0xdb257634)}, {LL(0xf65c41b2,0x27187dcc),LL(0x33c21f95,0xf934d7e2),LL(0x8cfc880d,0x0cde3d95),LL(0x822f2043,0xf0d6caca)}},
+   {{LL(0x8ad2d673,0xece9fe9c),LL(0xf6bb7e34,0x415e5d82),LL(0x75890270,0x60f58fe4),LL(0x75167d2b,0x45ce114b)}, {LL(0xd0aef54b,0xf8b2d5e0),LL(0xa7f615b2,0xdd88e616),LL(0x71dcb6de,0x8ae85e49),LL(0x6058688f,0x05bf0c2e)}},
+   {{LL(0x0716b2bc,0x18a463a2),LL(0x381a3973,0xcef96bd2),LL(0x4548b78e,0xf3ebbbce),LL(0x0453d3b4,0x63c615b2)}, {LL(0x5f777a50,0xdc24dfe3),LL(0x53fa6e56,0x2d4c2ac3),LL(0x9370b673,0x5a444b1b),LL(0xba628549,0xf95158ee)}},
+   {{LL(0xc8c6b32c,0x5566897f),LL(0xbd920a03,0xf93afe73),LL(0xd9220a0b,0x9e230f02),LL(0xa4ac6dde,0x6ca8fc62)}, {LL(0xcdd326be,0xe95c8f06),LL(0x2c1ed4fa,0xe50e34db),LL(0xd933573d,0xd334d9af),LL(0xc43a0375,0xedeaf315)}},
+   {{LL(0x100e66db,0x0ef84d12),LL(0x69240af8,0xc03524c8),LL(0x07803a6f,0x57fd91f2),LL(0x9fda45f2,0xe9f21d04)}, {LL(0x0745b2e2,0x54f21bae),LL(0x1fc72bf1,0x3236b5ac),LL(0xb8bf72bf,0x2ff4a935),LL(0x4864df5a,0x4564d1dd)}},
+   {{LL(0xe75e5058,0x8868c744),LL(0x2759162e,0xc87ffc9d),LL(0xe483c139,0xf5307eca),LL(0x160aec58,0x924d9ba0)}, {LL(0x754b2138,0xb359c620),LL(0xbb699ad8,0x300cc789),LL(0xb549ccc8,0xcf401f0e),LL(0x7b7a0a6d,0xc38adec9)}},
+   {{LL(0x27db3ef5,0x1a29ad31),LL(0xb593b785,0x5e53dd7f),LL(0x9ef40483,0xa532e2ff),LL(0xd3f7e4c2,0x2b18398c)}, {LL(0x090319a1,0x8ba34974),LL(0x0e1c220c,0x761aac04),LL(0xcdfc60cd,0x713ef967),LL(0x52cf8c9d,0xf361013d)}},
+   {{LL(0xec452d71,0xe883eb5a),LL(0xc567a9c9,0x7aacab73),LL(0x790cc5e3,0x1b210f91),LL(0x6b993de9,0x7b26f8ae)}, {LL(0x3d0f5865,0xb906b214),LL(0x34a61d6e,0x2507dcb8),LL(0xda65351b,0x6d93aad0),LL(0x60e444a0,0xc992db9a)}},
+   {{LL(0x79206da9,0xfaa22f06),LL(0xaaba59a1,0x765b78da),LL(0x770497a5,0x31440275),LL(0x63570e60,0x553aea07)}, {LL(0xae16d157,0x8e7d5a21),LL(0xb8935aed,0xe52b267f),LL(0x2ce7a060,0x7b05aedf),LL(0xea3231ff,0x845ea9c5)}},
+   {{LL(0xaeabbaf7,0x84e0dcd6),LL(0x7cfd0130,0x50d114cd),LL(0x160841fc,0x08d645a7),LL(0x84787649,0x0b3484d4)}, {LL(0xb36d4cd3,0x887546e0),LL(0xe57d6c61,0x3ea2dcbf),LL(0xccf12537,0x5ac69355),LL(0x8d9ea7e8,0x2c073871)}},
+   {{LL(0xb2fc3b8c,0x1de71cb9),LL(0xe37371cd,0xe12f6a7a),LL(0xcd86ba26,0xb6c207ad),LL(0x65048a84,0xa44867d8)}, {LL(0x6beee87f,0x8ae26a05),LL(0xd8bc4be4,0x8820567d),LL(0x30f3b9aa,0x3ad95ba4),LL(0xe9b014c7,0xa9914d88)}},
+   {{LL(0x60b82ee6,0x3b026917),LL(0x5264a0cc,0xb823847e),LL(0x7047dfa6,0xd6799a61),LL(0xcfc89329,0x95136152)}, {LL(0xdd17d36d,0x526f3d6a),LL(0x585822ff,0x98428bde),LL(0xcfcc4a99,0x739553c4),LL(0xc1ec369f,0x81514223)}},
+   {{LL(0x6c795140,0xdf7336fa),LL(0x080801a2,0xbe3a5839),LL(0xcf1d29da,0x1896cd74),LL(0x9d9ff52d,0x3eca3b35)}, {LL(0xf016d437,0x43d2156e),LL(0x85e2e68d,0xdb5c8944),LL(0x0a441b54,0xccf8f4d5),LL(0xadba3643,0xe0b76ef3)}},
+   {{LL(0x0acaa7bb,0x4eab7cac),LL(0x608eac4e,0x8c991968),LL(0x611c435f,0xc3a0814a),LL(0x178cd3f9,0x8d636050)}, {LL(0xa102dd2b,0x84c78eab),LL(0x5d717425,0x91fba582),LL(0xc85fc096,0xe6c9723e),LL(0x2f5199df,0x073b8a86)}},
+   {{LL(0xc01a0e35,0x2ec2d815),LL(0x9ca22915,0x2a3f286e),LL(0x521f6455,0xd2ba9965),LL(0x90def689,0x0050add5)}, {LL(0x47eea07e,0xa3d4d355),LL(0x83866401,0xfb20807e),LL(0xa96b34af,0xa957f5e7),LL(0xb9cbcf03,0x82ff1b8f)}},
+   {{LL(0x27086c53,0x9d240c10),LL(0x1ea95627,0xcbe7be2d),LL(0xd8c358f5,0xb32841fd),LL(0xc155556f,0x9200c26d)}, {LL(0x79b790e3,0x9b9209c7),LL(0xb07bfbde,0xfc614198),LL(0xb21ff2f6,0x17831775),LL(0x16650aa5,0xe5e566b2)}},
+   {{LL(0x2ba1e788,0x499318ec),LL(0xa3130145,0x02b8669c),LL(0xe6de2405,0x17ff59af),LL(0x3dec03ae,0x31cb7d7e)}, {LL(0x92cdb7f9,0x532a4848),LL(0xae87aa1a,0x16fdc1c4),LL(0x92c5fba1,0x5f3072bb),LL(0x8da3fba7,0xdebd778f)}},
+   {{LL(0x38a2f85b,0x654b904b),LL(0x95d9900d,0x29c45d06),LL(0x1b8c060c,0xc735fc20),LL(0xac2f427b,0x0c1ae127)}, {LL(0xed135b93,0xc8ef4afa),LL(0x0eb1664f,0xe67e9e31),LL(0x62585591,0x7b37a5ef),LL(0x59ea850c,0x749f646a)}},
+},
+/* digit=12 base_pwr=2^84 */
+{
+   {{LL(0x44c39c8e,0xfb5b141a),LL(0x47fefa01,0xd655b14e),LL(0x0061cf3a,0x13486a95),LL(0x9449df46,0x502abd03)}, {LL(0xfcafda35,0xc7b8ea6e),LL(0x2794ab12,0x21f47a9b),LL(0x6cd72bf9,0xcb745d74),LL(0xeb6d9157,0x7e7e2382)}},
+   {{LL(0xc1f69662,0xd073880d),LL(0xa33914a9,0xfc612134),LL(0x188d13e7,0xc89c449c),LL(0xef6c3c44,0xa0ba1305)}, {LL(0x9e20febe,0x2aad7b73),LL(0xe44e4ed3,0x870828aa),LL(0xe1f50810,0x20de0c62),LL(0xdb549828,0x8c3d0f2e)}},
+   {{LL(0xddaa15da,0xf64eaef7),LL(0x17ca284a,0x0f51c821),LL(0xe921b63a,0xa5e39406),LL(0xb0033a00,0xc8d46bc5)}, {LL(0x81595010,0x2776e635),LL(0xec850f7f,0xbaf9990b),LL(0x00d52ffe,0xb9d9b6ad),LL(0x1618b2ae,0xc0ee70c2)}},
+   {{LL(0x6c6617fe,0x3669804a),LL(0x880aaabd,0x40accf21),LL(0xd60ef870,0x9b50ee21),LL(0xe05e7cfc,0xf515a660)}, {LL(0x56fc218a,0xa8a0f633),LL(0x38f949ac,0xfa4a50cf),LL(0x3f2dff04,0xdf340f72),LL(0xf3dbb6ff,0xc4de8964)}},
+   {{LL(0xce20f6fa,0xb5f066a6),LL(0x4519386c,0x1d3412fc),LL(0xbe777e31,0xc7a567a4),LL(0x6bb8c48a,0xe50763bd)}, {LL(0xe9ec4225,0xfc5f123f),LL(0x6fbc674f,0xe3d4fa83),LL(0x12f046bd,0xbe82bc9b),LL(0x4540d099,0x3fa46375)}},
+   {{LL(0x6bdb6cb9,0x71cb19f1),LL(0x4d3bbc75,0xc4dc2bfd),LL(0x4dff7a52,0x1e618971),LL(0x4dcfc02e,0x50418b1a)}, {LL(0x3f450b5c,0x87c1b960),LL(0xd6b40b2b,0xb98290c2),LL(0x93cac03c,0x09c471d1),LL(0x7b893f24,0x23786668)}},
+   {{LL(0x46ce0310,0x7ea2cea2),LL(0xe0f2b29a,0x63f33c18),LL(0x49e533f3,0xaaa381ca),LL(0x85f9675f,0x626bfea2)}, {LL(0xdbe236ee,0xeb24e2c7),LL(0x1cbce751,0x52b92857),LL(0x6eba8b03,0x5fdec6b6),LL(0xbdd16591,0xaa502258)}},
+   {{LL(0xbd72b510,0x2204dc49),LL(0x21ff1030,0x7294b181),LL(0x34887455,0x562447d2),LL(0xd755a273,0x4d950690)}, {LL(0x22123177,0x5ae7245c),LL(0x8739e6b3,0x793b9c06),LL(0xac40622e,0x3c546f47),LL(0xf22f4e26,0x72834781)}},
+   {{LL(0xb160dcda,0x071fa53b),LL(0xf54418d7,0x02544f12),LL(0x2a197f70,0x67a2ecf3),LL(0x36087521,0xd5ace75c)}, {LL(0xc60dfebe,0x92890d17),LL(0xb3461ca3,0x0a8ef231),LL(0x7d153dcb,0x5dd9122d),LL(0xbbf95bf9,0x6f0feb39)}},
+   {{LL(0x249cf014,0x1cb225e7),LL(0xa16c6161,0x15ab8af8),LL(0x347cd4d5,0x4da5b14e),LL(0x80f11fb5,0xb979be34)}, {LL(0x11c041f1,0xbf342d16),LL(0x05a6412f,0xbf26ece6),LL(0xa7178a54,0xdb32d2cb),LL(0xd746e1cd,0xb231db90)}},
+   {{LL(0xf9e32933,0xf21fcd9b),LL(0x2323b8ca,0x90a85189),LL(0x333fede3,0x85de5968),LL(0xd57b801b,0xe972778c)}, {LL(0x605a4d84,0x880b0f7f),LL(0x07a62b41,0xba935d48),LL(0xb6fa51db,0x6f2aa487),LL(0xd4c57fd8,0x47453b5e)}},
+   {{LL(0xa0ab5e27,0x330e35cf),LL(0x986091d0,0x7ea7d48c),LL(0x75665091,0x014c1174),LL(0x7dfcc05a,0x5bb7d7b2)}, {LL(0x320be704,0x25db5166),LL(0x57f9ef04,0x901e8aae),LL(0xfd9d683e,0xb3e6acfb),LL(0x13d0f253,0xaaad9456)}},
+   {{LL(0x5c1fe5ec,0x8d844af8),LL(0x2d221ff6,0x673c4108),LL(0xe1d216a9,0xc5fab7c5),LL(0x8af662b9,0x441b6179)}, {LL(0x964f18a1,0x455c9dac),LL(0x944d9182,0x7ab722a2),LL(0x2b9f811a,0x867dab4f),LL(0x6ea11fc8,0x56456edc)}},
+   {{LL(0x3bda5b5f,0xd53befa1),LL(0xf7692e9f,0x6c7732d7),LL(0x8ee3da8e,0x21682b60),LL(0x040cd10f,0xfe58b938)}, {LL(0x0bcd2c3f,0x2892c85b),LL(0xd34b6293,0x26316f54),LL(0xc54f4076,0xe8084f60),LL(0xbcf0ab1a,0x7a884399)}},
+   {{LL(0x963f7e1f,0xe3c393a8),LL(0x35c11e73,0x0cf06321),LL(0xb14f247a,0xf0948e67),LL(0x6ffca9ee,0xbe0da54b)}, {LL(0xacc8daf7,0x3cec00f6),LL(0x360e49eb,0xf162a218),LL(0x6a24ffec,0x5fe0f378),LL(0x368a7a32,0xbfbc4124)}},
+   {{LL(0xee77b584,0xc75fed65),LL(0x34696a94,0xca523f53),LL(0xd1d46db1,0xd0aa44b2),LL(0xa4e00e0f,0x34a51ef6)}, {LL(0x01dd25ad,0x2d9a298b),LL(0xd9612c49,0xb2677993),LL(0x7cfbea50,0xdf72f601),LL(0x51aee201,0x3875caa6)}},
+   {{LL(0xd70d2f5b,0xb0c9b0b1),LL(0x3aa54965,0x2d92fd2d),LL(0x62edea8a,0xfc3e7ac0),LL(0x8c09cc76,0x53d13ac4)}, {LL(0xcb45d6c4,0x6ddb2cbd),LL(0xb9b12f94,0xd4d015da),LL(0xfc0d5705,0xec1c03bf),LL(0x728765d3,0x4ded909a)}},
+   {{LL(0x4b3ede91,0x6bb1b26a),LL(0x98e0dd88,0x6e0b297e),LL(0x94be2216,0xbc942da2),LL(0xc1bfea75,0x7ee87aa4)}, {LL(0x06243439,0xaa0b18bf),LL(0xc07ae23f,0xab3cbbd4),LL(0x732c4e41,0x2a6f3242),LL(0x1fb3dbaf,0xe2a8f20e)}},
+   {{LL(0xb77e59a9,0x2592ab67),LL(0xb9056dec,0xb4fcb99d),LL(0x2abaae8d,0x05f73a76),LL(0x74d90826,0x114363ec)}, {LL(0x240a7bd1,0x8e5619d6),LL(0xa7d7efe0,0x84a131a9),LL(0xf30ef0a1,0xa9e0b5e6),LL(0x44d71549,0x5093c4d4)}},
+   {{LL(0x6aaec768,0xb45b2379),LL(0xc18e9dbf,0xb87f875d),LL(0xc2a4680e,0xfb7b3431),LL(0xa5c3e7d0,0x09793c2d)}, {LL(0x43b3d2c3,0x6f50c4c5),LL(0xe24f073f,0xa9286e3e),LL(0x9a432edb,0x2cba6f5c),LL(0xe6fb8aac,0x02f68331)}},
+   {{LL(0x1cb243d8,0x5bdf582f),LL(0x134c0312,0x70d1e446),LL(0x4fc4d71a,0x075aea54),LL(0xdfd8280c,0xd67bc165)}, {LL(0xf02c127c,0x22d95ee7),LL(0xfa0ff785,0xd6397d70),LL(0x489eb95a,0xbb8595ff),LL(0x1951b2e8,0xb6f1718d)}},
+   {{LL(0xda2b0f2f,0x3019577b),LL(0x68133c84,0x000d8865),LL(0xd400e457,0x9953a4a0),LL(0x99b410bd,0x6736e5a2)}, {LL(0xd809b43a,0x783624ad),LL(0x7e0f9613,0x2e24ef95),LL(0x75677105,0x6b75d7d4),LL(0xa1d0c0d2,0x0b1a58b7)}},
+   {{LL(0xef8dc1e5,0xcc86805a),LL(0x1d164d1c,0x5d44b7a1),LL(0x4e2bcaec,0x97c35659),LL(0x19e3574f,0x20a784c5)}, {LL(0x6d995e51,0xfaa49377),LL(0x74cf905c,0x6f3c1560),LL(0x8cb9815b,0x08744424),LL(0x3c8ae0f1,0x20c30dd2)}},
+   {{LL(0x2627f57c,0xd900fccc),LL(0x48c15a9e,0x4a883cb1),LL(0x5c4bc832,0x88ff133b),LL(0x03caeaca,0x3220ae77)}, {LL(0x0760f1c2,0x7fb1a5a5),LL(0xab5f58e1,0x13a0cfa3),LL(0xe42f5ca6,0x8eb8cdf6),LL(0x84385085,0x7f64ed1a)}},
+   {{LL(0x4c1d99fb,0xb46ca6d9),LL(0xfb1db32c,0x53d8539e),LL(0xc4a76674,0xdf63e9fa),LL(0x17577eda,0x571bd2a2)}, {LL(0x98eb0ec7,0xdf9f56dd),LL(0xb0d5146e,0x56a6d338),LL(0xd711a4e7,0x4da14880),LL(0x1055462d,0xbd0f87a6)}},
+   {{LL(0x6113b8b0,0x6cf09e27),LL(0xa48914df,0x49b45088),LL(0x3309a654,0xf17064e9),LL(0x60940fff,0x992f016a)}, {LL(0xdddd296f,0x26f7fb77),LL(0xbd0678b9,0x0ff4f745),LL(0x5cd8ba38,0x2496a58a),LL(0x4b6ca19a,0xf33ad598)}},
+   {{LL(0x8ac7c26e,0x5e5af629),LL(0x914afa86,0x920615a4),LL(0xbd9a2dfd,0xed42ad56),LL(0x7c7fc238,0xa71d66c5)}, {LL(0x12e404e4,0xe96bb688),LL(0x6532917f,0x3bd2c354),LL(0xef58e95c,0x7e1df696),LL(0x66171fd0,0x2daaf3b5)}},
+   {{LL(0x9411980d,0xce950f6b),LL(0x8d29db71,0xea644866),LL(0x28404923,0xe6c38270),LL(0xdd0a48ad,0x0a4fc792)}, {LL(0xc7211899,0xecc1d4b7),LL(0xadcf88b7,0xb26da083),LL(0x17bd48ef,0xdf23ae77),LL(0x0a7e08e3,0x2a2f4cfb)}},
+   {{LL(0x7d8689cd,0x1abe2b33),LL(0x51656b3e,0x65f438a3),LL(0x73117f10,0xdd3b8410),LL(0x7b7c176a,0x7c96f3ca)}, {LL(0x9e43ee4a,0xb21e2be9),LL(0x1dc97cf2,0x1a17c24f),LL(0x99886343,0x704910db),LL(0x529b3629,0xa53384d1)}},
+   {{LL(0xf9fcfe94,0x60899851),LL(0x3566ef54,0x7169391c),LL(0xce8bdf50,0x1af3fc5b),LL(0xa35084c6,0x397120d2)}, {LL(0x839a791f,0x15ad610e),LL(0xb5d82554,0xdd2678fa),LL(0x62eb8499,0xbf68af31),LL(0x048fdf1b,0x5f16cb07)}},
+   {{LL(0x0d388b91,0x155443fd),LL(0x1d6032c3,0x48e3c3d1),LL(0xd951845e,0xde25df5c),LL(0x689aa07a,0xbc900916)}, {LL(0x9c9f43bf,0x49cf5023),LL(0x39e18418,0xd8230c9e),LL(0xbeaa8aa0,0xbe7f0a24),LL(0x96b85079,0xe6b34623)}},
+   {{LL(0xaf315be9,0x373614fb),LL(0x3cfe5b5b,0x652c421b),LL(0x86c0b714,0x6393a17f),LL(0xe9f04024,0x76b51b91)}, {LL(0xbafa3f5f,0x7983229a),LL(0x257b708f,0x8bd01fbc),LL(0x738e1e9f,0xfbac8e5d),LL(0x0475a25f,0xc7e657c4)}},
+   {{LL(0xd9721276,0x2b969715),LL(0x260797a6,0xee8d0a64),LL(0x3b9cf79e,0xd497259e),LL(0xf9e2f0c4,0x7b42a055)}, {LL(0xe222eea4,0xe17ef834),LL(0x154236da,0x6783707e),LL(0xf6fd4afd,0x40c76e95),LL(0x15e8dcbe,0x2490f2be)}},
+   {{LL(0x644556d2,0x79f0d854),LL(0x76351664,0xd913643e),LL(0xb3a28f74,0x8ebf2b9d),LL(0x93d328f5,0x211f7915)}, {LL(0x282a0575,0x7ed21bb7),LL(0x339b5672,0x47b4a229),LL(0xb63c12b2,0x55d7cda4),LL(0xe1f87176,0x3c7d3e48)}},
+   {{LL(0xb1365166,0x5d640826),LL(0x13d7c710,0x2f7210de),LL(0x424c71db,0x5eda693a),LL(0x7214228c,0x8bff601f)}, {LL(0x07930e7d,0x62b99adc),LL(0xb6c454b6,0x962693bb),LL(0x39da0d69,0x11811d09),LL(0x9ee05d8d,0x04d3b3e4)}},
+   {{LL(0xb3478c94,0x6de458a2),LL(0x911bfe94,0xaa634037),LL(0x18548bb3,0xb34bfc1b),LL(0xd82a8c36,0x8691cdec)}, {LL(0xdff54e8c,0xf6f6a617),LL(0xf2e760de,0x7c02c8ae),LL(0xa6cb3b7a,0x4435804f),LL(0xa026dbd8,0x7126fcc5)}},
+   {{LL(0x9224c034,0xf6be939f),LL(0x1db2db02,0xdeac355a),LL(0x916eeb8f,0x79f2f5ab),LL(0x38288662,0x23cd8484)}, {LL(0x5ef7fa1c,0x36023cbb),LL(0xe3c06d38,0x99ffc509),LL(0xe4c1a0a1,0x7e46aa66),LL(0x800c236c,0x5c267a80)}},
+   {{LL(0xb285c4a9,0xb310bb44),LL(0xef3c26ac,0x590939a4),LL(0x05d68138,0x0a63307e),LL(0xa02c7716,0xc3f54624)}, {LL(0x72a47961,0x72bd8669),LL(0x00f72959,0x0f38ccba),LL(0x4c5e2f76,0xf19e92ff),LL(0xf42cc81f,0x281e7e6a)}},
+   {{LL(0xe8623c15,0x5e294a26),LL(0xd6018a35,0x7333286c),LL(0x2017f6f7,0x726c5269),LL(0x975f4b53,0x5850bfee)}, {LL(0xd09cffed,0x837079c1),LL(0x24e38c17,0xdf879c30),LL(0xc8b0f98f,0xccad4699),LL(0xa3149510,0x72768d91)}},
+   {{LL(0xf9f7b890,0x19d8e661),LL(0xc221c6fd,0x632af526),LL(0x9e45c757,0xd36d6f81),LL(0x8d2fc676,0x259ec57b)}, {LL(0xbc984428,0xee7a75c4),LL(0xfcd109b9,0xdfca15f5),LL(0x01bb8914,0x43bac0c5),LL(0x367f719b,0xe7bb5628)}},
+   {{LL(0x87f3d7c7,0xd1b27ad5),LL(0x9d27a014,0x1ee1e784),LL(0xa861e9a0,0x7318bcd6),LL(0x5b309fc9,0xfc58f7b8)}, {LL(0xd38548ea,0x8401e7ac),LL(0x18c5781c,0xe969ad94),LL(0xd112877b,0xf66c4dc4),LL(0x585814e4,0x7b35b193)}},
+   {{LL(0xe8daea8a,0x897dee89),LL(0xd97f6807,0xcce611c6),LL(0x503c9852,0x002bdb5c),LL(0x6e1890e5,0x07b8e792)}, {LL(0x31cdbf5d,0xb67018a2),LL(0x62d34c3a,0x5ffdfb4f),LL(0xf0a3679f,0x931cd3fd),LL(0x2698cfae,0xdef0ab12)}},
+   {{LL(0xfa310bc3,0x84939503),LL(0x219c84d1,0x09e57abd),LL(0xa5f13352,0x680845ba),LL(0x2fa12ec2,0x04a5099f)}, {LL(0x73329e21,0x7dfee5a8),LL(0x0e10a545,0xb90f9c9a),LL(0x486399d9,0x9621439f),LL(0xd2ad1611,0xfa385cec)}},
+   {{LL(0xabcca862,0xa2782b8a),LL(0xd0a39bd0,0xb054b5d7),LL(0x3d2bb968,0x4382352a),LL(0xff5e2cd7,0x7ccfff2d)}, {LL(0x49eeef8e,0x4699c2cd),LL(0xea6e87d6,0x61cbbd32),LL(0xf9837c3b,0x3939417e),LL(0xd03ec4c9,0x4703acb2)}},
+   {{LL(0x5706789c,0x0346180a),LL(0xe16740c3,0x22d3b5d0),LL(0x8e556069,0x970532db),LL(0x568555ea,0x6019ec74)}, {LL(0xd0f52395,0x0abd4678),LL(0x58281e7a,0x463eda51),LL(0xed472239,0xec14ae3a),LL(0x211fee7c,0xbf620cd4)}},
+   {{LL(0x18265234,0x0c55fcd0),LL(0x59ca56fb,0x50ee9c39),LL(0x95b0c3a9,0x1fc9ad92),LL(0x67e30737,0xf50e5530)}, {LL(0x548752d3,0x5f8c41a9),LL(0x9a993cfc,0xd333ec0c),LL(0x9272b108,0x3303ca6a),LL(0xb6b4c7be,0xfd9a7dbb)}},
+   {{LL(0xdb8b4a59,0x0d0a0e59),LL(0x8b613ece,0xde4536f6),LL(0x78cae6df,0x40d4ca40),LL(0x32ed74d1,0xc72de9e3)}, {LL(0x10165635,0x6e9a6665),LL(0x7033477a,0xfb017e5b),LL(0x36324707,0x69fb95a9),LL(0x8e806444,0xf9c45f1b)}},
+   {{LL(0x624659ce,0xc77a9c6b),LL(0xc11c66ed,0x4cfa45dd),LL(0xf721fa98,0x6cd2f0ab),LL(0x05773a00,0xc319d2a1)}, {LL(0x03780ee8,0x7b529c2b),LL(0x53fcd20a,0x39d800dc),LL(0x27bb1801,0x95cbe5b7),LL(0xfd2baff9,0x7cf7b69b)}},
+   {{LL(0x05ac4ee6,0xe55406a5),LL(0xe843e84b,0x76d1d6e4),LL(0x451df3ac,0x80e9bfb0),LL(0x454336b8,0xdfc4df6f)}, {LL(0x848eb0c9,0xd1ff061e),LL(0x7d38f0aa,0xb95c06ce),LL(0x414e1c35,0x64903254),LL(0x9241ad85,0x2e3a3f76)}},
+   {{LL(0x9c782a0d,0x18df4faa),LL(0x0d39f2bc,0x3c770067),LL(0xa7550bed,0x3231de91),LL(0x53f187e1,0x82bc8cd4)}, {LL(0xa7725969,0xd4ac6a47),LL(0xd7f8277d,0x3e912fcb),LL(0xaa4821df,0x55a7e1bb),LL(0x0188229f,0x76a85657)}},
+   {{LL(0xc6718b98,0x58814e93),LL(0xc6696591,0x09a844f1),LL(0x15c5f550,0xc61710e3),LL(0x7f479db1,0x50ada237)}, {LL(0x5f37c450,0xb193cc18),LL(0xef087f27,0x9ca76c42),LL(0x4c70fcd4,0x5ed92d2a),LL(0x5b885e23,0x09ce6642)}},
+   {{LL(0x85dda53a,0x372a50d0),LL(0xa868d192,0xa2df371e),LL(0xf1498180,0x75327a37),LL(0x68fcac12,0xf9b52234)}, {LL(0x162e8925,0x01a23316),LL(0xdd835a4f,0xe31c263d),LL(0x161fd20c,0xc99b6fb1),LL(0xe1290d96,0x45a718ed)}},
+   {{LL(0xd6fe51ce,0xab3eb23b),LL(0xc31b5717,0x65647849),LL(0x2327aa4d,0x79dc52e5),LL(0x8a8d745a,0xb35429f2)}, {LL(0x70160321,0x3c8527cb),LL(0xeab03ce3,0xf3754f26),LL(0xa60de6f1,0xb770b114),LL(0x6ff8df3d,0x58820b63)}},
+   {{LL(0xd28002e8,0xd756c50d),LL(0x77d5de1e,0x3fdf2ea9),LL(0x256225d8,0x7096d121),LL(0xe3da14e4,0x715e0a34)}, {LL(0x934c5574,0xc9de192f),LL(0x294fbbc5,0x24316113),LL(0x5dce9bdd,0x5cae550c),LL(0xdcd56b5b,0x620bd257)}},
+   {{LL(0x8954067d,0x7863ec51),LL(0x0cc50538,0xcffdda8f),LL(0x972e9237,0x9fc11204),LL(0x35589abf,0x0ba7b669)}, {LL(0x5782679a,0xf024829d),LL(0xb4d125a6,0x0120c6a4),LL(0xa992e1c6,0x9083d6ef),LL(0x019fa815,0xd0297bb6)}},
+   {{LL(0x405de1cb,0x55f15daf),LL(0x373edef6,0x09fbeeda),LL(0xf6a9c261,0x59bdc5aa),LL(0xc9e71efd,0x382e5535)}, {LL(0xcb62512f,0xc8018882),LL(0x71247604,0xac496589),LL(0x32dbadda,0xb9240303),LL(0x13598484,0x3725a798)}},
+   {{LL(0x3dea9821,0xd86dc46e),LL(0xfd6cebc3,0xb5f265da),LL(0x436d3815,0x78512dde),LL(0x730d9a6d,0xacd61d43)}, {LL(0xfb0db99e,0xb924c4c2),LL(0xf167f6da,0xb1522a39),LL(0xbb8e68fb,0x1170bad9),LL(0xb1604ac8,0xa8587272)}},
+   {{LL(0xb3a61e37,0x062c1fce),LL(0x7a5a4312,0x9f6c1794),LL(0x5a3fb6a2,0x20b9dee1),LL(0xe21f93f5,0xe8d87334)}, {LL(0x9712c30e,0xd6753b4b),LL(0x83ebc3ab,0x3419c791),LL(0xc457703f,0x2a810d48),LL(0xdc02edec,0x4e99fefb)}},
+   {{LL(0x289e0d5e,0x1dfb0d57),LL(0xac77f81e,0x9410fdf5),LL(0xb8a39635,0x4e15f173),LL(0x92b3d2a1,0x9a2ac0eb)}, {LL(0xc2f7662e,0xb3c14b5c),LL(0x120ab80d,0xc8d407a6),LL(0xcbe232a7,0x292d26dc),LL(0xe15a3a87,0x41379db0)}},
+   {{LL(0x80f3a730,0x4f71f3ea),LL(0x0a065a38,0xed131600),LL(0xf7aeb0d7,0x08e28e7a),LL(0x936591a5,0x0f14baa6)}, {LL(0x563fd2ee,0x73084e68),LL(0x3e0de76f,0x483ef4df),LL(0xf94a7011,0xd9c9ee67),LL(0x46f01aa6,0x30e92429)}},
+   {{LL(0x0cbb64c2,0x1790dc0a),LL(0xab57012a,0xdd038142),LL(0x815a09cc,0x80007bc9),LL(0xc8ec6158,0x8216c9e1)}, {LL(0x7c5c5307,0xb265ccc5),LL(0x2069c190,0x4cc82725),LL(0x895d29e2,0xef5036b8),LL(0x20d36990,0xfa3df596)}},
+   {{LL(0x64ed1e93,0xbe3a8fff),LL(0x881d6691,0x0dd70afc),LL(0x3532a102,0x9a324d1a),LL(0x1f221d30,0x63d66ca9)}, {LL(0x91c5f114,0xa9af3938),LL(0xe42d4002,0x06448846),LL(0xb9bbed89,0xfcfce4d6),LL(0xc253cf6e,0x1242785e)}},
+   {{LL(0x91e36c98,0x6e010871),LL(0x7f826468,0x4cc2bc93),LL(0x065160dd,0x555ef5ee),LL(0x80edecf4,0xf6ac7e37)}, {LL(0x42dcf023,0x31476d9b),LL(0x84fbc2c4,0x84005797),LL(0x87066916,0xeaed2fb5),LL(0x53b01c53,0x641e3721)}},
+   {{LL(0x0daf895d,0xd8c2b174),LL(0x6ff59370,0x73d108a6),LL(0xfc35a5c0,0xfd0bfcef),LL(0x72534cb1,0xbf3c7a7e)}, {LL(0x214c9cfc,0x87848d09),LL(0x3c07f690,0xadf4bb55),LL(0x85b373fd,0x5e0ab41c),LL(0x81f666da,0x7d70b146)}},
+},
+/* digit=13 base_pwr=2^91 */
+{
+   {{LL(0x4307832d,0xc2fdd8ed),LL(0xca47906f,0xf9224c4e),LL(0x017cbd0d,0x4f27eac0),LL(0x21d17bcb,0x4541317b)}, {LL(0x3ad282d7,0x4917023b),LL(0xddf12ac2,0x22428ded),LL(0xa8a0aacd,0xeda22a3e),LL(0x57d24e9b,0x26a134d3)}},
+   {{LL(0xd0eeba32,0x52e23a0a),LL(0x221d753f,0x25d126e5),LL(0x91e24d08,0x8e1ed8f0),LL(0xcd9be21d,0x02c62c6d)}, {LL(0x9532a9c5,0xbca97801),LL(0x81a6c714,0xaf2fa264),LL(0xe1b7e65c,0xc9aa988d),LL(0x64c72a93,0xf0a62b0d)}},
+   {{LL(0xf9610ee3,0x336b5e82),LL(0x27197965,0x74f00515),LL(0x73d9f75b,0x8c50dcb0),LL(0x1738761c,0x03c5f14f)}, {LL(0xd5c44aa9,0x54b9db42),LL(0x0712e8d7,0xe7f6fe09),LL(0x1842b16a,0x052dd8df),LL(0xf2ef2069,0x8ed31568)}},
+   {{LL(0xdf286b2a,0x78945abf),LL(0x7fa67e5f,0xeb6d7175),LL(0x202f3505,0x6375c396),LL(0x6b0950f1,0x2580efd2)}, {LL(0xf29e4788,0x6b00f83c),LL(0x0b14828f,0x87919d89),LL(0xc7405444,0xea5a49bc),LL(0x2c32843d,0x016c63a0)}},
+   {{LL(0x26ff88f7,0x210d3285),LL(0x71608bd5,0x1b297ead),LL(0x6b88bc96,0x4a88d3f8),LL(0xe37ada35,0xbb1a45bb)}, {LL(0x48a82bd3,0x11f1b7cf),LL(0x2d30aa67,0x4163cba7),LL(0x115873dd,0xa3e953e0),LL(0x42afff79,0x6a3b4b28)}},
+   {{LL(0x2b9273e7,0xd3dc474e),LL(0xb1b23abd,0x61c1874f),LL(0xf4d5e153,0xd5f8a93b),LL(0x86060309,0xc6bbaacc)}, {LL(0x0e88984b,0x8b2695aa),LL(0xde72f96f,0x7ac50027),LL(0x7465f84f,0x677e0f8c),LL(0x5ae1aff7,0x82a91836)}},
+   {{LL(0xffc68698,0x9bac667a),LL(0xe27ffbb6,0xecfd7724),LL(0x5ae1e4e6,0xe91c4733),LL(0x185506e0,0x35f4b258)}, {LL(0x08244fdb,0x9a9a8534),LL(0xcb7b0ade,0x66a86895),LL(0x674515e5,0x682f7d76),LL(0xa0989c88,0x24bb23ac)}},
+   {{LL(0x0d221223,0x57286693),LL(0xc4e1ac66,0xf86063c3),LL(0x7ed8dac6,0x300bb076),LL(0x9df22d27,0x316d9421)}, {LL(0x1e931ca3,0xf057605d),LL(0xa44243a9,0xeb8fc052),LL(0x258bdee7,0x0052ca94),LL(0x3b41de91,0x641a364a)}},
+   {{LL(0x29dd1d6e,0x6be331a5),LL(0xb313ee77,0xa7ff306f),LL(0xb3ea4118,0x34ac86fc),LL(0x22f564a9,0x0a1b5aa3)}, {LL(0x02e380eb,0x2dc7c8ff),LL(0xad64d506,0x8189e1f6),LL(0x66620827,0x1166cd4f),LL(0xd9f42d49,0x014279f2)}},
+   {{LL(0x7a3dcb16,0x7a39f290),LL(0xe47879d3,0x839da77a),LL(0xe1fc739b,0x56b02f74),LL(0xa82334a6,0xa9383776)}, {LL(0x57987dd1,0x4d212666),LL(0x95fce842,0x29adcc71),LL(0x595782c6,0x14267589),LL(0x85e654e6,0x510e9d3b)}},
+   {{LL(0x267ace10,0xd72cac5c),LL(0x920c18aa,0xe660e7d3),LL(0xcc72ef15,0x37b48943),LL(0x89a7f9e7,0x42d960a5)}, {LL(0x54f7f9a5,0x595dc174),LL(0x2c5f82c0,0x3e87d94e),LL(0xf4f2a124,0x4d64e5ae),LL(0xa09b588d,0xb3f83981)}},
+   {{LL(0xbf34e8b0,0x3ae6c701),LL(0x22847064,0x0bf3a934),LL(0x8ea2de26,0xe1e0e74c),LL(0xfeaac5a4,0x86c2f8bb)}, {LL(0xe3bef03c,0x2a480d20),LL(0x5e46b6dd,0x52cb289d),LL(0x7fc4e6ce,0xde824978),LL(0xefe0e9e4,0x5efd6cc3)}},
+   {{LL(0x9d9b77ff,0xe7255520),LL(0xe29d9f87,0x394da253),LL(0xc3cb75b6,0x16fd78bd),LL(0xe971d362,0xcbc91b12)}, {LL(0xa1b62484,0xc1392fed),LL(0x3e766961,0xb24bfbd2),LL(0x95ba6b9c,0x2294fcf2),LL(0x855b512f,0xb8ce9849)}},
+   {{LL(0x4e6d130f,0xde285cf6),LL(0xed016125,0x167651d4),LL(0x844b0dd4,0x2ed14ab9),LL(0x01af3bcc,0x08286377)}, {LL(0x9a1249c4,0x3452c1a9),LL(0x1988564a,0xe2dca2b5),LL(0x5ea96643,0xc39b0bc4),LL(0xc77a9547,0x9263c877)}},
+   {{LL(0x0a789b10,0xcb041e27),LL(0xa6dbbfee,0xa34f19a4),LL(0x33086677,0xf868676f),LL(0xdb44edac,0x6a65cba2)}, {LL(0xbc62d6be,0xd88f56fa),LL(0xd2fbc789,0x38c8efc5),LL(0x38d68b62,0xb65d0052),LL(0x72a374e1,0xee997944)}},
+   {{LL(0xf10e80bf,0x08288caf),LL(0x00eadbeb,0x4a8b3c06),LL(0x1c980713,0x9b6f29e5),LL(0x7f841d75,0x4c18fab4)}, {LL(0xff139676,0x2a00bcab),LL(0xcdcdb20e,0xc1b37d3a),LL(0x94ff5b39,0x5793df55),LL(0x0d803ccd,0x2e7903dd)}},
+   {{LL(0xd3d19916,0x1725f2d4),LL(0x053b7d23,0x611d262f),LL(0x2b6e7dd5,0xc55752d7),LL(0x48f1293c,0xde5bfc31)}, {LL(0xa1afcaf1,0xe5f49ce9),LL(0x351d61c3,0xf2b922d7),LL(0x7f72b0a2,0x38128176),LL(0xefdf37f8,0x89d987bc)}},
+   {{LL(0x0b7da037,0x3e00e417),LL(0x5d31b0fd,0x4b497db6),LL(0x9ca99d57,0x341f4139),LL(0xb670fb81,0xe3c943e1)}, {LL(0xb2fc6843,0x8641a057),LL(0xe1b928b2,0x0da67fe8),LL(0xe6088242,0xbf28578b),LL(0x6faf8d61,0xfce46814)}},
+   {{LL(0xf5222b8c,0x3df2aade),LL(0x47674d66,0xfd476d51),LL(0xed5b79b1,0x9b863fcd),LL(0x56718383,0xafbfab8d)}, {LL(0xe12c689c,0x9ebee088),LL(0xed75ead8,0x8952a4a6),LL(0xd84ccb85,0x23f0d4d5),LL(0x5f9025f5,0x21c0178e)}},
+   {{LL(0x4f001484,0x8a696ba4),LL(0x30830cab,0xc67dae24),LL(0xa3cb20bf,0xceaaa4ae),LL(0x6950872f,0xd9efc2f1)}, {LL(0xf8e8e09a,0x28bd2977),LL(0x4b09a7f6,0x9e53b2da),LL(0xb1b8ad8e,0x5157fcc4),LL(0xddfa7a9b,0x94a61702)}},
+   {{LL(0xb39912fa,0xba20be7a),LL(0x09b93f07,0x0a4fe581),LL(0x98f121cf,0x204ae93e),LL(0x58f74844,0x94f28422)}, {LL(0x800425d9,0x05f8b926),LL(0x5123c39a,0xd57ec9ce),LL(0xd9e68d0b,0x1388f6b7),LL(0x3efe5d20,0xfc69906f)}},
+   {{LL(0xfe9fce9c,0xaa20b748),LL(0x075e72bf,0x16e1c9f4),LL(0x39174d3c,0x5829a000),LL(0xbb63dafd,0x5f71d4f6)}, {LL(0xb0f5f8fe,0xec6ed47d),LL(0x4c49b832,0xc358df52),LL(0x9e63d51e,0xc4f8ad77),LL(0xdfa39206,0x796d7fc3)}},
+   {{LL(0x633a7977,0x401f05f2),LL(0x54b854cf,0x094bd596),LL(0x82e5a75c,0x2e0cd1fa),LL(0xb3ecda2f,0xb226582f)}, {LL(0x3cbe2d2e,0x22dae1de),LL(0x8999b918,0xb872c7ad),LL(0x46710199,0xd1d5084f),LL(0x8bd82851,0x4466c837)}},
+   {{LL(0x1dab2dc4,0x5e8b7e58),LL(0x7a91f5c5,0x8cd8071f),LL(0xe6138f99,0x84cd8b47),LL(0xaf2654eb,0x20e7f052)}, {LL(0xd51922f5,0xc54e9259),LL(0x8167a771,0xd871c9d3),LL(0xe383d00e,0xd5dd924a),LL(0x388eca67,0xb450e57e)}},
+   {{LL(0x239ab83f,0x1dcd3012),LL(0x0c7a0f52,0x33a6dc89),LL(0x6193a6f6,0x8e985b93),LL(0x3dd7b307,0xeafc52e9)}, {LL(0xe0ecf278,0x0fdf6b81),LL(0x978b70d6,0xc7f3cef6),LL(0x7ecd9446,0x02b66e40),LL(0xc7d56b32,0xfc461e1a)}},
+   {{LL(0x54845463,0xe12a71b8),LL(0x4ba1de87,0x7ebaa1c2),LL(0xa4156d1a,0xbbe2acbb),LL(0x038a2712,0xfaa06d81)}, {LL(0xce7c96c0,0x29e92c24),LL(0x11328e74,0xd23ae78c),LL(0xd227878d,0xd4b93bc8),LL(0x303e4a61,0xea666248)}},
+   {{LL(0x52312abe,0x7fc22a71),LL(0xe81bad82,0x71a1a01c),LL(0xf247636d,0xb5db6ed7),LL(0xb9b3bc2d,0x7c1f1779)}, {LL(0xbb95b6d5,0x8c038dac),LL(0x31143521,0xdf1e4719),LL(0x11bced4f,0x00737d87),LL(0x631d3cbb,0xeeb30359)}},
+   {{LL(0x9065c44e,0x5895a422),LL(0xf1719046,0x05729d73),LL(0xdeae310c,0xd0a441ce),LL(0xd79e64af,0xb84e8d5c)}, {LL(0x683fe2fa,0x3745796c),LL(0xfe78bd6b,0x4074c32a),LL(0x4308574e,0x5f6e61f6),LL(0xed8b9ff9,0x5aa5e088)}},
+   {{LL(0x71858d5a,0xb33daff2),LL(0x5cc00f45,0x39826442),LL(0xb1b6acbf,0x3518b291),LL(0x2be0ce53,0xe3cf7a03)}, {LL(0x22adb2cb,0xcf41bd94),LL(0x0a5cde44,0xd237684b),LL(0x3b0ada91,0xb42cc729),LL(0x158f8f5c,0xae2bdcb3)}},
+   {{LL(0x0b5d6726,0x2f2be78e),LL(0xd2656800,0x310a8dde),LL(0xd7e3058f,0x86ca2ff9),LL(0x25b36732,0x5b0d798f)}, {LL(0xcb6dac22,0x46a2f1d1),LL(0xbe986817,0x1670f4f2),LL(0xa0722d78,0xf30e647d),LL(0x506e9f18,0xbd60229d)}},
+   {{LL(0x3f97996c,0x7c47c11b),LL(0x27ab38f7,0x229d0456),LL(0x578658f1,0xe7efc0de),LL(0xc26d9942,0x2acd0220)}, {LL(0xac7d2813,0x5c3cb375),LL(0xcddb0285,0xa4c3d31e),LL(0xc97cca17,0xa88b8a2e),LL(0x91584769,0x76145ff8)}},
+   {{LL(0xdb12a1ef,0x0f65f52a),LL(0x500a563f,0xd9fc7c9e),LL(0x86ed4060,0x0dd2b856),LL(0xf72c1af9,0x9af924be)}, {LL(0x5c6b1f4e,0x3fdab095),LL(0xa963708b,0xe2efbf13),LL(0x579f69b4,0xb54ab5de),LL(0x323a9634,0x7db04144)}},
+   {{LL(0xa4489d51,0x1f3d5bc6),LL(0xbf55e957,0x90bb124f),LL(0x34156a8d,0x056870a4),LL(0x6c7847e5,0xb8e6f8d6)}, {LL(0x98be992f,0x2b36a080),LL(0xb6998093,0x95026694),LL(0x850da6e3,0x66083482),LL(0x5e7f5acd,0x53a5772d)}},
+   {{LL(0xd12c6ef8,0xa901efe8),LL(0xa98fb452,0xd2e7b49b),LL(0x16e6b324,0x117e8cf0),LL(0xdff9cbde,0xc1e476af)}, {LL(0xed65af5f,0xbcb8d6db),LL(0xc4d719b9,0x6a6e68d7),LL(0xc58302c2,0xb9ca284b),LL(0x64c26dfd,0xc0ba697b)}},
+   {{LL(0xa16ede87,0x94104b33),LL(0x3d836312,0x53d9d4ec),LL(0xbc65126a,0x10d0de1c),LL(0xd86edadc,0x47749529)}, {LL(0x296c6739,0x12136b07),LL(0x52625d69,0x55520c60),LL(0x758cb358,0xd0940240),LL(0xe0131204,0x07c7f4a2)}},
+   {{LL(0x8c97a415,0xf51c99d5),LL(0xcfc3897a,0xa851e6a9),LL(0x288466f3,0xbfa64cf2),LL(0xc5566e45,0xc3936399)}, {LL(0xfd9677f0,0xac03c8cd),LL(0xfb019589,0xa39f769c),LL(0x4ff666b6,0x1de61165),LL(0x85b5a9f7,0x68aa63c2)}},
+   {{LL(0x676171cd,0x8e719dd9),LL(0x31cb1fa5,0x769708bc),LL(0x3c89e03f,0xdb696ac1),LL(0x5a6a2d64,0xed4b31b4)}, {LL(0xc3701e0b,0xe134895b),LL(0x0d48c10b,0xc2b7cb1a),LL(0x6f4634b1,0x32548448),LL(0x77882809,0x4255a634)}},
+   {{LL(0xa8c7a7de,0x20369eed),LL(0x146bc23e,0x8cd4f928),LL(0xace2fdf7,0x33a46b56),LL(0x8de90883,0x0260862b)}, {LL(0x0cd7f758,0x266cc400),LL(0x2c094fab,0xfca82842),LL(0xc1db6eaa,0x76aa18c0),LL(0x677df7b5,0x9fd99820)}},
+   {{LL(0x6505c06c,0x9e814aea),LL(0x9d374686,0x7892c071),LL(0xefeb652a,0xa63f3fdc),LL(0x1112eb2c,0x78e39e8e)}, {LL(0xd9736a29,0x45d67166),LL(0xe6b013b8,0x11d5707f),LL(0x7b6a10dc,0x0d3880d6),LL(0xe376460e,0x9ce94af1)}},
+   {{LL(0x8151d6f7,0x4aa6bc08),LL(0x4a691116,0x03d3a3a1),LL(0xcab8c239,0x4159da8f),LL(0x9cf6577f,0x41fa65b4)}, {LL(0x77686928,0x750e3a13),LL(0x419b1535,0x98a37266),LL(0x5a7dcd82,0x52a248ce),LL(0xd30a3bde,0xa0f29296)}},
+   {{LL(0x194bac1d,0x3afc26d7),LL(0xc6bca7ce,0xc3e62ce2),LL(0x2599ed4b,0x18aff23d),LL(0xfbd1a2c2,0x3295ef53)}, {LL(0xd5e32164,0xd6bab22b),LL(0x4baadfba,0x057c9c7b),LL(0xf98d5d04,0xa2f34913),LL(0xe235074c,0x43a05cad)}},
+   {{LL(0xb730fc95,0x23455e6b),LL(0x39b23665,0x9f4ebc87),LL(0x85b20b65,0x5df9920b),LL(0x6c14e3bf,0x0b498ba2)}, {LL(0xb0d33a58,0xecdda85b),LL(0x409673ab,0x8a546c72),LL(0x9912204a,0x8f1ba8d2),LL(0x4e68e397,0xb5c89284)}},
+   {{LL(0x706b19bd,0x8032fe48),LL(0x4e7e94e7,0xac278b06),LL(0x98ea32b3,0xa9519fae),LL(0xefa7478e,0x139c8b93)}, {LL(0x906d35ea,0xb0c67b98),LL(0x56d74cd5,0xd87e7ae3),LL(0x5f979efd,0xef880295),LL(0x59ecd695,0x2c680e5e)}},
+   {{LL(0x55ddca5d,0x83853f31),LL(0x2b1bb580,0xd10b5f70),LL(0x2fb1a292,0x8f2ffd21),LL(0x04ac28d6,0x7809a39b)}, {LL(0xa8cc18ea,0x30048ffb),LL(0x96364040,0x2719805b),LL(0x9adeb28a,0xa5000343),LL(0x3ff62102,0x7db8b7f1)}},
+   {{LL(0x163c75ed,0xdb007489),LL(0x8df874e0,0x88c3e709),LL(0x7ad7c0a7,0x56dc387a),LL(0xc5fc0b15,0x433fd135)}, {LL(0xa22f8be7,0xd4416e4d),LL(0x40075032,0x0efcaeb4),LL(0x7dbe9d59,0xd9c4a943),LL(0x5547279d,0x2f0ae807)}},
+   {{LL(0xdc4d4aaa,0x21e3fe6f),LL(0xd5993c77,0x29e58a51),LL(0x67091b43,0x59ccbcb2),LL(0x7076581a,0x0de5bfb4)}, {LL(0x85af19c7,0x8731a13e),LL(0x1731f9c3,0x2912fe72),LL(0xc772c843,0x9990efed),LL(0xd4aaac08,0xa347aca7)}},
+   {{LL(0x756d776b,0xd2a39a87),LL(0xc5474304,0x5bab2c16),LL(0xd76208e4,0x5df74134),LL(0x7370a041,0xafcf546f)}, {LL(0x5a2fdce2,0x18edd456),LL(0x94b8c35c,0x779ac09d),LL(0x373fcbb4,0xee13a89e),LL(0x92f23e52,0x10119d22)}},
+   {{LL(0xe1fe48fd,0xab8403e1),LL(0x8ccea759,0xa8e3b517),LL(0x5b1895f8,0x1bb8f22d),LL(0x8c4510b5,0x1f0da6ed)}, {LL(0xcbabe6ca,0x089d962e),LL(0x5430d99d,0x76f187b9),LL(0x957cf187,0xa0dc99b1),LL(0xb54c9809,0x6a5735bd)}},
+   {{LL(0x4889756d,0x303d5810),LL(0x8c16a597,0x3e4e3b43),LL(0xc10211f9,0x8544c91c),LL(0x25923649,0xe99aa865)}, {LL(0xb082d15d,0x46c182c2),LL(0x1c802eb4,0x9e8c0484),LL(0xce415310,0xa242309d),LL(0x2832666a,0xf228c942)}},
+   {{LL(0xcf6a3a6a,0x4e91df41),LL(0xdf96419e,0x14ca91e5),LL(0xa8dc2f5e,0x4bd2872d),LL(0xfee58f5c,0xbd65bbc6)}, {LL(0x682672e0,0x700799fd),LL(0xc08fbdaa,0xf513eb11),LL(0x55e8e9e2,0x1c8a01f1),LL(0x10f9b4c1,0x84c452cf)}},
+   {{LL(0x44a4d342,0x445d7016),LL(0x102a924f,0x3aa7048c),LL(0x5577e56c,0xa0359691),LL(0x5fba2f7d,0x7fcbfd1a)}, {LL(0x73941422,0xe954731c),LL(0xa63ebdf4,0xea3b67ef),LL(0x412d7079,0x66c5af22),LL(0xed221b67,0x2bc98951)}},
+   {{LL(0x59a76bb2,0x3205d267),LL(0x7ab9171c,0xc97a941f),LL(0xad60a989,0x3d90e92c),LL(0xe222962f,0x4ab55cbc)}, {LL(0xd0322983,0x4cffc196),LL(0x392d825e,0xe0704fdd),LL(0xfde5d727,0xbe6e6494),LL(0xc418d4d7,0x90232a3c)}},
+   {{LL(0x2773e310,0xe2de5fdd),LL(0x7f9e114a,0x68ccf020),LL(0xe79c237c,0x9f1751b0),LL(0x6c3187d2,0xc2abae93)}, {LL(0x5eb676c1,0xe1181dc7),LL(0x27c8476d,0x224267c9),LL(0xc69541b1,0xb2889dd7),LL(0x59fc7230,0x810f21c4)}},
+   {{LL(0x78d49e36,0x54ca5605),LL(0x757fb05c,0xc08f02fe),LL(0x90920dbd,0xcedd6fe7),LL(0xc6ce067a,0x4788e867)}, {LL(0xa2a54555,0x65a0e653),LL(0x888ed307,0x685839a4),LL(0xe9f8ac0a,0x4bd2e669),LL(0x97f3b400,0x4262275c)}},
+   {{LL(0xad3ce8bd,0xe794c637),LL(0x219fcc9c,0x94ffdf84),LL(0x39ab67cb,0x7e51758c),LL(0x23554f15,0xe1986df9)}, {LL(0x726c9731,0xdd04a25e),LL(0x0e573df0,0xfdc48488),LL(0xa190db99,0x783b8eb8),LL(0x099e79f9,0x76ed445a)}},
+   {{LL(0x1b43d9bd,0xe8fdb2dd),LL(0x9c1c86ea,0xaf6364b7),LL(0x7ddcd46f,0x685c4cc0),LL(0x5e77c925,0x09c8f69d)}, {LL(0x1c9de394,0x06ed41f5),LL(0xa7558c05,0x4842fe1c),LL(0x16feb7c6,0x321c009d),LL(0x227c1f9e,0xc7ceae5d)}},
+   {{LL(0x7d40e380,0xbb435870),LL(0x1406f85f,0x81a50131),LL(0x1318e79a,0x55be5710),LL(0x8153bbdf,0xd06cdfa3)}, {LL(0x7910ab49,0x14191a8e),LL(0x38240cd8,0x27ae7e29),LL(0x09521dcd,0x487668bc),LL(0x16c39073,0x71aca9cd)}},
+   {{LL(0xf327ce2b,0xb6c709b5),LL(0x74225f8c,0xcb29ffb4),LL(0x5613d1ce,0x067ae5ef),LL(0xc66e862d,0xc76c10ab)}, {LL(0x3cacdbbc,0x81e14f81),LL(0x7a58b95b,0x9556a8a1),LL(0x1f882589,0xc9305da4),LL(0x6508f3c2,0x9d070e29)}},
+   {{LL(0x41799a9a,0x0d0837fb),LL(0x3be84a52,0xf48c6fbd),LL(0x6fc7bdd7,0xce88ee5a),LL(0x2735b133,0x451f6b77)}, {LL(0x5e298564,0x9852f7ab),LL(0xc246cab2,0x0ecc28b8),LL(0xf3843e02,0x6da44022),LL(0x54986cec,0x311c7b3d)}},
+   {{LL(0xece9fdc7,0x47f59432),LL(0x8f3144a4,0x357a41c5),LL(0xb1737adc,0x650a8396),LL(0x1e030333,0x89e5c4ce)}, {LL(0x93f45b51,0x0ee8741f),LL(0x1a3a4054,0x37d37f58),LL(0xb316f724,0x979d9899),LL(0x8d52d871,0x68e8989e)}},
+   {{LL(0xd389ee3a,0x8de849f8),LL(0x01bfb2d2,0x13cf5346),LL(0x89c355d3,0x4abd7264),LL(0x74151913,0xb3587e71)}, {LL(0x6a84a239,0x066d0753),LL(0x2792c22f,0xc6b89fd8),LL(0xb3ae725d,0xc281ab0e),LL(0x2d558979,0xed083a67)}},
+   {{LL(0xe7789a51,0xe73dfa3a),LL(0xf78ab107,0x2ef11d18),LL(0x749deb1e,0x10656c6c),LL(0xa3fc434b,0xfdc7c084)}, {LL(0xc5239e49,0x7dfcedbc),LL(0xeff84a97,0x8be4e517),LL(0x3e03dc97,0xf58dbe94),LL(0x3093c89c,0x76bf7cf9)}},
+   {{LL(0x361d2267,0x8b9e2a0f),LL(0x0267c69e,0x7b93f4ac),LL(0x4344d6b9,0x27e133ee),LL(0x083c4fd2,0xae124d87)}, {LL(0x8efd258e,0xb6fa7ef5),LL(0x001d7f3f,0x27ce324c),LL(0xc207bf1e,0x009acbed),LL(0xda8f340f,0xef5116d3)}},
+   {{LL(0x436f2a16,0x0a3018af),LL(0xa078c184,0xd5770b8d),LL(0x83cda41e,0x1e65799b),LL(0x45dc5163,0xe3118dff)}, {LL(0xf3b464b8,0xe18d705d),LL(0x86665941,0xf3b38f0a),LL(0xcf9f0b18,0xd2472de2),LL(0x23d6f219,0xa30756e3)}},
+},
+/* digit=14 base_pwr=2^98 */
+{
+   {{LL(0x0a3259f7,0xeceaf1b7),LL(0x227c64b6,0xda8fd3b8),LL(0x70092b54,0x0a3b75b3),LL(0x63730368,0x9d36569d)}, {LL(0x63101412,0xf9985c2d),LL(0xbfc61362,0x2138ce37),LL(0x975e576e,0xadd1bc16),LL(0x3067353f,0x47414e46)}},
+   {{LL(0xf718b957,0x91ee3f95),LL(0xc393de8f,0x1b48c768),LL(0xf0442712,0xc5844342),LL(0x09f55c62,0x9bbdb56f)}, {LL(0xb04eff9a,0xacd5821f),LL(0x4c3833af,0xd28455a8),LL(0xfd2accce,0xe434d5f8),LL(0x1f338db2,0x17b5475d)}},
+   {{LL(0x1c428191,0xb4c5bf43),LL(0x9c73c297,0x3c545ca6),LL(0x1192e414,0x9e2c3a96),LL(0xd9f030b2,0x78cbd84a)}, {LL(0xbe1e840d,0x8f240c83),LL(0x58aa9743,0x2cdfdc6e),LL(0x9957d3af,0x020b7c7e),LL(0xb671986d,0x427e485a)}},
+   {{LL(0x606235b2,0x5e0570b6),LL(0x29207af9,0xe340c4ae),LL(0x07bdef0d,0xd527a2c6),LL(0xafdf8bba,0xbb362c3d)}, {LL(0xbd5f0bee,0x7b4fc2a9),LL(0x1a2956b1,0x147ce759),LL(0x34124a7d,0xba7a6b73),LL(0xd15a2323,0x3c40c279)}},
+   {{LL(0x8d258f04,0xd61dc545),LL(0x1637b594,0xeec94710),LL(0x4494e17b,0xaf3d69d4),LL(0x35c2a62d,0x66a187c0)}, {LL(0xd3e49fa1,0x05d1fad2),LL(0xc294848e,0xc5739374),LL(0xa33b154f,0xe41c7256),LL(0x2a67175e,0x94c857d9)}},
+   {{LL(0x7e8d0d7d,0xc378ae9e),LL(0x2ad6434f,0xdd5aa5fb),LL(0x121d6bb3,0x2c9a53d7),LL(0xf98503ac,0x0eff01bf)}, {LL(0xff878151,0x0f4ac0c9),LL(0x2ed64ce1,0x7de9338d),LL(0x7990a899,0xbb111372),LL(0x6cd27acd,0x67dc7218)}},
+   {{LL(0xac79d12d,0x2061021c),LL(0xd2ad767c,0xfba74864),LL(0x7ceff24d,0x829205e4),LL(0x642990a9,0x6b590cda)}, {LL(0x25f3e07a,0x38cd6a3a),LL(0x320ecdde,0x23ee3eda),LL(0xcd21f39d,0xe9d9761f),LL(0x48f15a75,0xaec425d0)}},
+   {{LL(0x1cd40e31,0x3f2f4914),LL(0xa80c38d0,0x90642c13),LL(0xc689dc73,0xd59b1b55),LL(0x28722591,0x1e39c206)}, {LL(0x75b5c993,0x3044180f),LL(0x20d89f98,0x1c107c27),LL(0x8aa0f8d4,0x132eb88f),LL(0x6462c2e0,0x7514b4d7)}},
+   {{LL(0x51beb24b,0x8a77fd00),LL(0x7d759c3a,0x806bf860),LL(0x9b471f7b,0xeabb4953),LL(0xca286479,0xc8dc4ed1)}, {LL(0xfb4bbc30,0xd7839530),LL(0x938a46b5,0xaf83c0ef),LL(0xe7fa019e,0x5c8aca20),LL(0xb9387bca,0x4c9239b5)}},
+   {{LL(0x5a87bfdf,0x5456f4ea),LL(0x33291194,0x5e5d968c),LL(0x148e7cec,0x88305090),LL(0x2e21c226,0x4bee30d1)}, {LL(0x260284c1,0xadb163ef),LL(0x142aee60,0x189d187b),LL(0x1fa30c21,0xc06adbd2),LL(0xf683e78d,0x9a284018)}},
+   {{LL(0xbadb53cb,0x1d3515a3),LL(0xeb8299c4,0xd2dc99e5),LL(0x86398fef,0x772af816),LL(0xfa933978,0x04fb9487)}, {LL(0xb7e74574,0xf6c04481),LL(0x7bb54af1,0x2da1382e),LL(0x955c29db,0xa4f4414b),LL(0xec360e21,0x8740fd7f)}},
+   {{LL(0x7ccee136,0x033f132c),LL(0x101e7655,0xd7d54ca5),LL(0x697b4bd0,0xae7ede54),LL(0x14b44112,0x74da46f9)}, {LL(0x7e4cbb3a,0x2fc25660),LL(0x42e4cc85,0x3672acd2),LL(0x79c09849,0xa6660e02),LL(0x485fb022,0x9185150c)}},
+   {{LL(0x0b47fc0f,0x3467eeb1),LL(0x6e63d21a,0xc158e13b),LL(0x67a0fd04,0x32e2398b),LL(0x9c568cdf,0x4c1b1abd)}, {LL(0x3868ae83,0x67c2aaa9),LL(0x68b9aeb2,0xf8c0ef97),LL(0x200422db,0x46342f38),LL(0x8bac509a,0x2d3d0ef4)}},
+   {{LL(0xf1910693,0xc2d38d2f),LL(0x48ccb716,0x635655aa),LL(0x4de2e1fd,0x9e25d281),LL(0xd7627002,0xd71c6860)}, {LL(0xd78e9581,0xfe1e22bb),LL(0xff0f78d8,0x1de478df),LL(0x438cfdce,0x8a51e7d4),LL(0xa7f3912b,0xc1e0e840)}},
+   {{LL(0x293871c8,0x4e4f3176),LL(0xcd07fbe7,0x130f796d),LL(0x743ae5a4,0xb36587c6),LL(0xa2cf1bcd,0x53d9143f)}, {LL(0x87dd0ddb,0x992f8b81),LL(0xfee5fa17,0xb5e6b71d),LL(0xd5275603,0x4ddbc6ec),LL(0xa6444ac4,0xf5c8324d)}},
+   {{LL(0x45daf470,0xdd15e68a),LL(0x3e223774,0x28b9929d),LL(0xabd465cc,0xd1b0fcfe),LL(0x311cee67,0x4396df4f)}, {LL(0x69325ad4,0xecb3aff3),LL(0xb33b5d1f,0x8a90bd15),LL(0xe68a4d52,0x8fe2c6bc),LL(0x8edf3a99,0xac51e8b4)}},
+   {{LL(0xe7fbcc78,0x9c107eec),LL(0x99b2c238,0xcb90d80b),LL(0x907beb8f,0x3d8bff86),LL(0x0fd11ba2,0xc24cf66b)}, {LL(0xcf41fc83,0xfb8dfd53),LL(0xaad88ef6,0x01607c97),LL(0xec6dae5b,0x9387582a),LL(0x8ec63fd0,0x136b0150)}},
+   {{LL(0xddc1a82d,0x4514aa35),LL(0xe8545470,0x2f9ee274),LL(0x96c30353,0x778f6169),LL(0x9e229750,0x15abb585)}, {LL(0x12a9c499,0xf90f241f),LL(0xdc684e1d,0x82ec12e3),LL(0x2e6b0e77,0x87af4274),LL(0xa763baae,0x71ab36c2)}},
+   {{LL(0x3dc641fd,0x1ae5ce29),LL(0x5df82b05,0xc19768f0),LL(0x41c5a1c5,0x7b4fd1e9),LL(0x01005466,0x22ee282b)}, {LL(0x8f6e456c,0xb3e1540d),LL(0x64651792,0x40a9f6dd),LL(0x8920b669,0x684a60da),LL(0x78c5b4a4,0x2aec209f)}},
+   {{LL(0x956ce121,0x0fa5c09e),LL(0xa6e78e8b,0x833695ba),LL(0xde600687,0xce82270f),LL(0xad9331c3,0x6e390c25)}, {LL(0x246a3d4f,0xb05d89da),LL(0x838c1eef,0xae711914),LL(0xf1d67085,0xd8cae58c),LL(0xfdade743,0x325a0777)}},
+   {{LL(0x303e1f2e,0x2b0ab035),LL(0xc819603b,0x36f747a6),LL(0x6629fc0b,0xb694c4f1),LL(0x599ed5d3,0x7256e2bd)}, {LL(0x6d2990d2,0x9cf0b0ab),LL(0xcb7f5132,0xe1917f70),LL(0xf09b5d6c,0x11cdff38),LL(0x1a1e4794,0xc39abc64)}},
+   {{LL(0x077b65d3,0xdb9a70d0),LL(0xf5598e7b,0x920adb07),LL(0xc4230dd3,0x77934546),LL(0xcb625ce0,0x9d5d8b71)}, {LL(0x6f1c7cd4,0xc3daf4c8),LL(0xb9b865ad,0x2ba56856),LL(0x39499b2a,0x8324e78c),LL(0x7f1aa8ba,0x7205b582)}},
+   {{LL(0xa2229093,0x8d905ad8),LL(0x1c7aab2a,0x852e47fd),LL(0x584a4d4d,0xdef41f1e),LL(0x7ddde760,0xae09d5fb)}, {LL(0xf866bc37,0x2522a830),LL(0xb67c58ef,0x03cc7219),LL(0xfb3ce32c,0x657d3fa5),LL(0x022a6882,0x5ea63758)}},
+   {{LL(0x523ef0cf,0x5696e8c7),LL(0x05a39fcc,0xa4430e12),LL(0xfa2f40a3,0x8bcef6a8),LL(0x0dda969b,0x79f89254)}, {LL(0xde97dd75,0xac525965),LL(0xd23737e3,0x9d0344cc),LL(0xcdb0dbab,0x1d7b9481),LL(0x4afd6e49,0x572e9e09)}},
+   {{LL(0x8102acc9,0xd4703741),LL(0x885edc52,0x5de216ba),LL(0xbe745473,0x6d71f21c),LL(0xbc0dbc5e,0x2faf9df7)}, {LL(0x4daf0a82,0xb50d5931),LL(0x5f6f70d2,0x7df88bd8),LL(0x96049c3e,0x238a547a),LL(0x16d7cacc,0x13a19199)}},
+   {{LL(0x48c03182,0x62927639),LL(0x6ba0d410,0xdf79c08e),LL(0x8936bb96,0x7a342032),LL(0x6eecc44e,0xbe19c0fc)}, {LL(0xbc94cd2b,0xd0f55758),LL(0x85c4af02,0xa340c61c),LL(0x2f9d4124,0xabc82919),LL(0xace75b5f,0x8364e70d)}},
+   {{LL(0xd0ab9f2d,0x23ecf3bc),LL(0x641f2c9d,0x93ce40d2),LL(0xe23633bb,0xe7745db5),LL(0xcd64603a,0x2631ba6a)}, {LL(0x4f447129,0x9cd456f6),LL(0x7bdae20a,0x8251dcb0),LL(0x9728fea1,0x5f6b1524),LL(0xecc7d958,0x5b0e121e)}},
+   {{LL(0x4fa3e53a,0x5854321e),LL(0x48595cfe,0x27634743),LL(0x64ee4cbe,0x86ad6ff7),LL(0x0a265250,0xa1ba6817)}, {LL(0x6bcae29d,0xd2b61192),LL(0x4e251346,0x6c25bfd4),LL(0x2e7169ab,0x9c3684cb),LL(0x44563d91,0xd32f1f6e)}},
+   {{LL(0xebe4d35e,0x59de2108),LL(0xf55305ca,0xf4b2de90),LL(0x5f940020,0x9edaa201),LL(0xf5c7c6c1,0x20aefea4)}, {LL(0x43a2907c,0xcc70bb97),LL(0x22a81872,0xf4105216),LL(0x64c37d4c,0x272d7547),LL(0x89f21875,0xc3fe3793)}},
+   {{LL(0x8038bdab,0xd0681fed),LL(0x980ae34f,0x60ca792c),LL(0x68ef4365,0xa507f6f0),LL(0x5fef2e5a,0xbbe5d68e)}, {LL(0xd3f1bac5,0x186734f9),LL(0x74db9804,0x62a161e6),LL(0x5d552b06,0x83ea4153),LL(0x045c75c0,0x55b9913c)}},
+   {{LL(0x163a63a6,0x215ab13a),LL(0x470d3457,0x4b48de26),LL(0x4f115cad,0x5ff6eb36),LL(0x47976002,0x6a7be5ac)}, {LL(0x5da59798,0x6db75262),LL(0xe762dc2d,0xc0ca473d),LL(0xb4bf802f,0xd78b7f4e),LL(0x6539f1ec,0xd5711175)}},
+   {{LL(0xfa1ab835,0x6368c53a),LL(0x9c37e6d8,0xcdbe7bae),LL(0x258387e7,0x712d06cc),LL(0x7c975ea7,0xf4fd477a)}, {LL(0xadd2c656,0xee2e034b),LL(0x5a77b165,0xf75a9d1b),LL(0x9096a77e,0x78677aec),LL(0x7baa67e3,0x97454f46)}},
+   {{LL(0xa3f36c0b,0xcc7a321e),LL(0xa03570ac,0x7b987a46),LL(0x362bf7cd,0xa2e330f8),LL(0x2c0c525d,0x755ebad7)}, {LL(0x1022b0c7,0xa0046223),LL(0x81a4d7bf,0x2d84a8e7),LL(0x4069baa1,0x0b605bc8),LL(0x567e20b9,0x34f6a23b)}},
+   {{LL(0x86cd23f1,0x7036d92e),LL(0x28aa0960,0x0b9fdf60),LL(0xef8a75e7,0x4b7bd5a1),LL(0x36160070,0xa06bb30b)}, {LL(0xe4194695,0x6affeadc),LL(0x3fc22418,0xd92526d2),LL(0x1382cc81,0x8585c1b6),LL(0x62e97458,0x780bd2e7)}},
+   {{LL(0x7444fa6f,0x5eb7e070),LL(0x0455650d,0xa23ac3f2),LL(0xad27c213,0x66508006),LL(0xac522290,0xe68a3c56)}, {LL(0x0e51d572,0x2d0030ea),LL(0x8b2e5bbb,0xadcfe9be),LL(0x4f9907eb,0x17e77ca8),LL(0xd39a241f,0x614a62c8)}},
+   {{LL(0x1b06f603,0x542cc6ee),LL(0x08d99442,0x639699ed),LL(0xe0650c3a,0x3e9bd04e),LL(0x9e1454d5,0x882e3ba1)}, {LL(0xfcbee463,0x140a8911),LL(0x5027a6a3,0xf3dd8bf8),LL(0xd9bc64b7,0xd78a2c36),LL(0x699b4ef7,0x1d84024c)}},
+   {{LL(0x97fc5dd5,0x350333f0),LL(0x1576c516,0xa4d6401a),LL(0xca69653c,0x5d626d4b),LL(0xbf3cfe27,0xe95f2824)}, {LL(0xe3772b1b,0xe72b41ea),LL(0x097d7888,0x8ea57027),LL(0x9ca049a2,0x70f6aa77),LL(0x756bb0c8,0x2018efdf)}},
+   {{LL(0x0345afa3,0xda6878cf),LL(0xcccd6686,0x83464c74),LL(0x3a964bca,0x88223dc5),LL(0xc740e88d,0xf888546e)}, {LL(0xf81326e8,0x35ec4437),LL(0x85ab6fe7,0x950088ab),LL(0xead36510,0x97f53102),LL(0xb59c8069,0xc794ccef)}},
+   {{LL(0x89caf62d,0x2140cb95),LL(0xc827b302,0xc428c3b1),LL(0xa745f16e,0x2ab66aa7),LL(0xe6a7b98b,0x2f2092a6)}, {LL(0x876227c4,0x1af05abc),LL(0x5929c095,0x7dfc74de),LL(0x3733413a,0xe9369187),LL(0xcc411ec8,0x6b59b5e0)}},
+   {{LL(0x4b4b17fa,0x33044812),LL(0xb88b97d8,0x7aa817df),LL(0xcab7b062,0xc17134c9),LL(0x1ac6fc19,0xba623b9a)}, {LL(0xeed1be76,0x34f6ec38),LL(0x73b90899,0xbbd53e10),LL(0x68e8f6fc,0x405b7cb5),LL(0x54632f58,0xe7eb5613)}},
+   {{LL(0x44250c57,0xda2a9460),LL(0x18d9b98e,0xe4324d4a),LL(0x8a13f174,0x0b523b24),LL(0x21fd01b1,0xc49d7ce2)}, {LL(0x106e9251,0x77e3ef2f),LL(0xa897c7fa,0xd8806c73),LL(0x7a14d3e9,0x93778051),LL(0x92548bcd,0xba165ea9)}},
+   {{LL(0x04d3fc5c,0x145320e2),LL(0x8497fc0d,0xaefb5dbe),LL(0x4da37809,0x2bb2e980),LL(0x25a47890,0xbe80a2bc)}, {LL(0x406f020d,0x79763fb3),LL(0x006f55e4,0xa904f269),LL(0x6db4472d,0x1b7e8d01),LL(0x5e27eebb,0xe4845436)}},
+   {{LL(0xb3f34e7f,0x96b996f3),LL(0x10033494,0xfc3f3a63),LL(0x97637070,0xd49d2733),LL(0xc5a864f8,0xc23f30e2)}, {LL(0xa84fa551,0x52d8fbc9),LL(0x424a4b7f,0x1a0069ba),LL(0xc4fb3a52,0xec4439a7),LL(0x3f9b864d,0x6788c9ff)}},
+   {{LL(0x0dd84ad7,0x2ae948c4),LL(0x906543f5,0x089e36da),LL(0x8e063d82,0x353cfc75),LL(0x4f1290b8,0x63c08533)}, {LL(0x346a0166,0xacd53165),LL(0x278522c8,0x7e16ce42),LL(0x56ce3dd5,0x94cbe8a3),LL(0x6e4a5a49,0x3454c461)}},
+   {{LL(0xfb2061c5,0x8bc727c4),LL(0x4808ccfc,0x4319989f),LL(0x658e2506,0xe0906352),LL(0x7cd533a2,0x85fff124)}, {LL(0xf0d9acc3,0xa7fba99c),LL(0x7cb25b7d,0x98cbefc1),LL(0x93575d15,0x026165e2),LL(0x9824f254,0x2d6ff47c)}},
+   {{LL(0x5d10323c,0xc5edaed7),LL(0x72fdfe7f,0xc8aec89d),LL(0xc63531b4,0x75a35e9d),LL(0x078085cf,0x176967ab)}, {LL(0xbc52c981,0x91715f10),LL(0x8ebb143a,0x745d22d6),LL(0x8a4785cb,0x961b840c),LL(0xd481d1a0,0xca1535b1)}},
+   {{LL(0x1419cb3d,0x57b9009f),LL(0xb45eab3b,0xe55e79a3),LL(0x827b827f,0xa6a342dd),LL(0x0df5f253,0xe459ae62)}, {LL(0x68a9a784,0xe305dc3f),LL(0x300ab9c5,0xf26f4c33),LL(0xb7f36cb7,0xce8fd85f),LL(0x80160d32,0x59af7062)}},
+   {{LL(0x83c7d7e5,0xd60b0243),LL(0xbcec1e9d,0xa4913c9b),LL(0x81ceb7e2,0xd34a09cd),LL(0x4c501249,0xbc306a4e)}, {LL(0x11807e4a,0xa9aa2d86),LL(0xb647cec5,0x4e774fbe),LL(0x16835626,0x8a181f7e),LL(0x192d3af1,0x8e87a45b)}},
+   {{LL(0x43e04638,0xb7384c4c),LL(0x2ed324c9,0xdd8526fa),LL(0x41e7f76e,0x6bde5f9a),LL(0x59e65a58,0xeafb1fca)}, {LL(0xc770444a,0x308b26a9),LL(0x540b7c41,0xb613f1e3),LL(0x395cbeab,0x0a9bd7b7),LL(0xbaa44068,0x22392c83)}},
+   {{LL(0x16cc9521,0xd13d7073),LL(0xfd71479c,0xab70edf4),LL(0x66fef895,0x45063395),LL(0xcbfc194d,0x4e58c66e)}, {LL(0xf0a9de6b,0x09ddf160),LL(0x36ce07fb,0x0ae83c4d),LL(0x15c9e068,0xc0c94cc9),LL(0xb6921556,0xddfbe98c)}},
+   {{LL(0x585e3044,0x6a0917be),LL(0x063fdf2d,0xc94bed0b),LL(0xe5682a2e,0x706b550c),LL(0x9c8b7ba2,0x87712dca)}, {LL(0xb90370e5,0xa9641a09),LL(0x0ff83737,0xc421ed84),LL(0xbc8410dc,0xb6f39329),LL(0x9dd29ba8,0x743765c9)}},
+   {{LL(0xe02d0f81,0x9e30249a),LL(0x4714bb75,0xa4b5e0b4),LL(0xa4a7e91f,0x97fd77b5),LL(0xba6bee5c,0xde3fc9c6)}, {LL(0xcbcd5591,0x8841e605),LL(0xe1f7c4c8,0x1e55914c),LL(0x208c68af,0x8435358d),LL(0xcd2a63ef,0x6591dbe4)}},
+   {{LL(0x742d6ca5,0x5b05d51d),LL(0xdf094b1b,0x30025e17),LL(0xdc1efbdb,0xf12ca59c),LL(0x2e7e6dfd,0x7da09a2a)}, {LL(0xc0c683b7,0xbfac0e79),LL(0xe3e1b55f,0x031bc4d2),LL(0xead9877d,0x8b40ccc9),LL(0x40b8aadd,0x21b8ef8e)}},
+   {{LL(0x90f57778,0xbb7e3cd1),LL(0xf400a824,0x773eb79d),LL(0x6fc8fa42,0xbd4c442d),LL(0x6ed5efd2,0xe1139505)}, {LL(0x75283aac,0x7a4e5a08),LL(0xbe87a27a,0xf9e0a099),LL(0xba57dbed,0x4205ae43),LL(0x78422ecb,0x894256c3)}},
+   {{LL(0x37b60688,0x79ae1af3),LL(0x347041da,0x1d1bca16),LL(0x5c9132c0,0x31c60604),LL(0x595e5894,0x279bdf98)}, {LL(0x1d2c095f,0xb72dddb7),LL(0x163ac158,0xa883dceb),LL(0x265b4d30,0xcb260c3c),LL(0x050fd33d,0x34b54be7)}},
+   {{LL(0x658beff2,0x8bd28b3c),LL(0x09a6e1ec,0x65f86dd4),LL(0x8b384cda,0x3545dfde),LL(0xa89f3eeb,0xe44b513a)}, {LL(0xd3cd60e4,0x692b8be6),LL(0xc38cb203,0x7e0fb256),LL(0xcb5357ab,0x7e8e6fcc),LL(0x2bc72acd,0x6ca28e07)}},
+   {{LL(0x2be5e59f,0xe253693c),LL(0x6bfa6a7c,0x5171606d),LL(0xfd080a81,0xc762c632),LL(0x79e8f883,0xd2a32de1)}, {LL(0x0b4d880d,0x83e1185a),LL(0x163d9d91,0x65dd239a),LL(0x65c6cb80,0x6b27c8fc),LL(0x0a9e316c,0x1ccf3865)}},
+   {{LL(0xe4260ec9,0x3ca5f563),LL(0x1966624c,0x57fe8acf),LL(0x485a1714,0x8f419c76),LL(0x9e097470,0xc25a68e8)}, {LL(0x4575d7c6,0x83a70e64),LL(0xde115525,0x69912319),LL(0x8998a76f,0x17c6b72e),LL(0xcf18f9b6,0x77baef8f)}},
+   {{LL(0xcef1a81b,0x9b30e1f6),LL(0x7a913729,0x6208f5aa),LL(0xea4bd33b,0xd035c6fe),LL(0xc070a91e,0x992b3bbc)}, {LL(0x5765f803,0x2d9d352c),LL(0x75de518c,0x8f8f3be3),LL(0x817699ce,0x0f052e85),LL(0x6c19dc41,0xf99b2a7a)}},
+   {{LL(0x0d446bf3,0x5af4a582),LL(0xd7fed553,0x772b7fe4),LL(0x927e6152,0x7fcb944e),LL(0x434d663a,0x121d2455)}, {LL(0xd335d051,0x510a3c91),LL(0xc5ac34c3,0x500685e2),LL(0xab79eaba,0xf5884686),LL(0x93db2eb9,0xe0e0ac17)}},
+   {{LL(0xac489921,0xd465f6f0),LL(0xe2b068bf,0x837e9a0b),LL(0xca91b115,0x18d33b87),LL(0xb229131e,0xaa408f05)}, {LL(0xb8181a4d,0xa29828ee),LL(0x3b2efd1b,0xdc6453de),LL(0xa4173643,0xb5cb4df7),LL(0xc87824a1,0x698945ab)}},
+   {{LL(0xaa34ace6,0x5a328515),LL(0x25d1c626,0x5ff8242e),LL(0x4ec621db,0x9f72d8db),LL(0xf37da49d,0xb1e2f4b2)}, {LL(0xab7e45b5,0x69898c9c),LL(0x4841e3b9,0x824b49d5),LL(0x4e4d6515,0x8cf5e9f7),LL(0xa8db154a,0x2890dfca)}},
+   {{LL(0xf0206850,0x1f81f3e8),LL(0xde9a6ac1,0xb3ac6fde),LL(0xd3d1e189,0x01a52cb2),LL(0xc6f97656,0x8b1003d9)}, {LL(0x071166e3,0x7d6bc509),LL(0x599ab3c2,0x70e4092b),LL(0x57b65e7e,0xc76c942f),LL(0xe32e0dfd,0x96b27ae3)}},
+   {{LL(0x74302334,0xf1b75df7),LL(0xddc19852,0x7a5774f4),LL(0x360fd321,0x75512520),LL(0x050a14d1,0x535c194b)}, {LL(0xd2e00af7,0x2c3ec10e),LL(0xfb80ae6e,0x56af0fd3),LL(0xc9ecc58b,0x0d232cdc),LL(0x8ace3fd8,0x613e6384)}},
+},
+/* digit=15 base_pwr=2^105 */
+{
+   {{LL(0xcf8508ef,0x9446ad09),LL(0x37e532ea,0x9f3d8f08),LL(0x0a93983d,0x83ac877e),LL(0x6bfc58ea,0xfe6d3142)}, {LL(0xf24093f6,0x8ce87afb),LL(0x1fdb0cee,0x7f9f7828),LL(0x449327e3,0xc7cc8678),LL(0xed053dec,0xc037dc1e)}},
+   {{LL(0x7f556fb4,0x648a1ff5),LL(0xb594c351,0x572b70b9),LL(0x0144de37,0x626ccdb8),LL(0xc2535365,0x1fdcf48d)}, {LL(0x79e3898b,0x27b71199),LL(0xdf5f36b0,0xebbd6857),LL(0x5d6a2534,0xfac3bee4),LL(0x641e93ad,0xdc3afd8d)}},
+   {{LL(0xc60f3afb,0x16c1b01f),LL(0x831def7f,0xbb27fdd3),LL(0xcbdd9bde,0x9486213a),LL(0x02e3d553,0x7476902c)}, {LL(0xfec8f10d,0x753b903e),LL(0x25630cca,0x2dd38f35),LL(0xde02aa03,0xdae709e3),LL(0x8b105ef7,0x086fe69b)}},
+   {{LL(0x808ebc1f,0x5397bda4),LL(0x3ce8a2f9,0xf9729be3),LL(0x33db00fc,0x729dcc05),LL(0xed390630,0x4b78d0dc)}, {LL(0x2cf2137f,0xa136eeef),LL(0x8b4d49cb,0x9c502dd5),LL(0xcf029110,0xaf4a7dbf),LL(0x6cbe8a02,0xdaa35ce1)}},
+   {{LL(0x370c2467,0x1571eb4f),LL(0x7fb82b75,0xe4335bb0),LL(0x5a6c898a,0x51d5ab7a),LL(0x841a9e58,0xd247f964)}, {LL(0xfbffd479,0x796a7f54),LL(0x84fff2fa,0x2e8c5898),LL(0x98f8541d,0x1f238f40),LL(0x088bdcac,0x36eb1876)}},
+   {{LL(0xaaf5633b,0xc13ae27a),LL(0xa97a9627,0x8f7e5e9d),LL(0x48edec55,0xc319f3b0),LL(0x65ed3dfd,0x3c779bf7)}, {LL(0xbdc31f74,0x1caedeb0),LL(0xf9d802fc,0xeccf737a),LL(0xe8627ded,0xd0dafb3e),LL(0x0bdc1f60,0x3d1a3fcc)}},
+   {{LL(0x809394af,0xe664d3e3),LL(0xb7de44be,0x7a0033d6),LL(0x48e7cdda,0x1ac5d6d2),LL(0x5c51a8f0,0x30ae5ee1)}, {LL(0xfad7f3cb,0xc74af296),LL(0x08e21cae,0xc6f46381),LL(0xd8329029,0xc38eecd1),LL(0x36eb5bdb,0xb8edbf3f)}},
+   {{LL(0x47e0830a,0xfa7a7ca4),LL(0xbf923c8c,0x10ca4982),LL(0x4eb89fa7,0x7f341b26),LL(0x62580214,0xdad2e00c)}, {LL(0x05dc8064,0xf4431edc),LL(0x3572b257,0x9cadff5b),LL(0x846d4e4a,0x4ba505d1),LL(0xd3ee3dcb,0x2c352204)}},
+   {{LL(0x84277b9c,0x847dd6dd),LL(0xfacaf5a6,0x5637159c),LL(0x6953a17b,0x8328e448),LL(0x7feb3033,0xf2ad4020)}, {LL(0x9c6f8ca3,0x13cf3804),LL(0x46847511,0x52763552),LL(0x68251a47,0x9508f8bd),LL(0xd8454669,0x646f35a7)}},
+   {{LL(0xa31165a9,0xe2ddee26),LL(0x51d53325,0xf63d9eb7),LL(0xcb75ae59,0x21cec7b9),LL(0x47c820c3,0xc1db6c87)}, {LL(0xe4334644,0xc5c08de1),LL(0x7aedf0c6,0x901bb7ea),LL(0xe593034d,0x7aca56e1),LL(0xac79dca5,0xb4859456)}},
+   {{LL(0x512b52fe,0xbfeb8802),LL(0x361ca0ce,0x49a11a54),LL(0xdb0a0d31,0xa3847d84),LL(0xaef9c99a,0xa8cb0196)}, {LL(0x557e3ab7,0xbed844df),LL(0x8fbbfec5,0x5add587b),LL(0x562f2d97,0x5c6a94ec),LL(0x0b50e924,0xc013555b)}},
+   {{LL(0xf31375ba,0x6cfc50e5),LL(0x2f00cbc5,0x03f28bf8),LL(0x4fcb8030,0xd2aba6e6),LL(0xf5a8a9fa,0x407708e6)}, {LL(0x9ac48c72,0x12ead9ff),LL(0x9d623bf5,0xfac378d8),LL(0x55501113,0xf198b50a),LL(0xaa4ebab9,0x2a4decb1)}},
+   {{LL(0xb579dd2c,0x1a216ecc),LL(0x388bf4e1,0x25f47453),LL(0xd1d2da7f,0x8d25b06e),LL(0x6f1233b6,0x768b72e3)}, {LL(0x2cff62f7,0x552720c0),LL(0x7137a13c,0x1a548a96),LL(0xa4c363e0,0xba7279fe),LL(0x7d7eb21c,0x2ffed2de)}},
+   {{LL(0x1acf70fe,0x505d0285),LL(0xd21f6a60,0x80eff323),LL(0xe1230ea3,0xc82ba8f5),LL(0xbedf579f,0xbd62cdfb)}, {LL(0x7d3641dd,0xb40421ef),LL(0x2d4d743e,0x6891778e),LL(0x710b9a47,0x5f948c84),LL(0xf826125c,0x2def0e19)}},
+   {{LL(0xedeecd01,0xfb60929d),LL(0xa03026de,0xf06be113),LL(0x86399ffd,0x38c813cf),LL(0x173b16ef,0x13032b08)}, {LL(0x084d6535,0x7e724163),LL(0x21f27534,0x96877c2b),LL(0xd711f116,0x83ba59c0),LL(0x2fd7c69f,0x9965630f)}},
+   {{LL(0x1ae81229,0xaabac3a0),LL(0x148e1882,0x090dbd12),LL(0x31cb7aa0,0xa85ecbe3),LL(0x128bb31f,0x609b647a)}, {LL(0x6630df86,0xbac0683a),LL(0x1b018227,0x6464115f),LL(0x355a4889,0x3656bcbc),LL(0xbf83cfa9,0x016544e2)}},
+   {{LL(0xf28eb958,0x1ceab5ef),LL(0x9a6222da,0x79bfaf0a),LL(0xe6e3d02c,0x124983be),LL(0xd9809a68,0x17694d04)}, {LL(0x6792739b,0xffabeddb),LL(0xe47325ab,0xbdb2b8b6),LL(0x3b588ebd,0xc714fc94),LL(0x908005c6,0x05608d4e)}},
+   {{LL(0x8574beb6,0x642988b4),LL(0x7d340a32,0x5f42b6bf),LL(0x015c6881,0xb9a9d868),LL(0x1c605992,0xdbaae567)}, {LL(0x0258ae5b,0xf4de3ce2),LL(0x59566a8b,0xf97c829f),LL(0x56427160,0xe6a2bcf2),LL(0x4373ea8d,0xf8293133)}},
+   {{LL(0xb1efc946,0xf1b956fd),LL(0x808093f0,0xa063df44),LL(0x3e5117f1,0x858f2952),LL(0x44beb9eb,0x3234fe7a)}, {LL(0xdb861cfe,0x4072fc4a),LL(0xd66744c6,0x05baff23),LL(0xd2525a01,0x29792eff),LL(0xc4da658b,0xdd295de7)}},
+   {{LL(0xab1a3973,0xda0df9de),LL(0x6040f669,0x6c992dd3),LL(0x9bf69190,0x37e9609b),LL(0x4e42f5f6,0x511d43c5)}, {LL(0xda5203c4,0x53a22fd7),LL(0xa479afc7,0x94fdd100),LL(0x9f7f5222,0xe70498ad),LL(0x4eb83b7f,0x2c9aa98c)}},
+   {{LL(0x46a789c7,0x2f4073a1),LL(0x55c7dfaa,0x165fe6ce),LL(0x9568157c,0xe43487d7),LL(0xaab6a594,0xc280e535)}, {LL(0x1b585dbf,0xdbecfd3f),LL(0xc40e2af0,0x2b4e36ce),LL(0xa81aeaab,0x929924cf),LL(0xfe09d50b,0xee180dac)}},
+   {{LL(0x5c8813ec,0x0e9534e0),LL(0xbf059e39,0x3a480d66),LL(0x922aa4b8,0x78bc90d6),LL(0xd322c8cf,0x38ec5090)}, {LL(0x53c45514,0xe2895d7b),LL(0xf87fdcde,0x75d79881),LL(0xd2a6a687,0x9b464d37),LL(0x3d3ef8dc,0x10397dd5)}},
+   {{LL(0x95afa08e,0xc8a86f1b),LL(0xec2996e1,0x7bfd303e),LL(0x8d2b3b23,0x06b95997),LL(0x3561b0c8,0xb845a116)}, {LL(0xb958f678,0xfb12b585),LL(0xd107ef12,0xdba63951),LL(0xa3519195,0x90bd0905),LL(0xb257e0c8,0xf9d44184)}},
+   {{LL(0xddaf95d7,0x1695386a),LL(0x809ae02f,0x1c987ab7),LL(0xc451d3e7,0x891cf742),LL(0x5768b696,0x86849e36)}, {LL(0xcbbfd204,0x0696cd51),LL(0xfed897b8,0xbb53a371),LL(0x8aa620e3,0xe0fe223d),LL(0x52a8f25b,0x1b5ee8d9)}},
+   {{LL(0x27548f6c,0x0de6c174),LL(0xa93b31f0,0xe5c6edbc),LL(0x817ceea6,0xe61261cf),LL(0x5d870f27,0x1b0ec8f1)}, {LL(0x2dec6994,0x0bedc816),LL(0xf1a7bb8b,0x66160b26),LL(0x524ca170,0x1ff210fb),LL(0xf7c80ae3,0x614821f4)}},
+   {{LL(0xf3000fae,0x965f7077),LL(0xfec38f0b,0x8571c6a0),LL(0x6185b9be,0xcc456e3e),LL(0x789c25ba,0x7bc54e2d)}, {LL(0xa69808b3,0x7f02bd10),LL(0x37038d98,0xed93c962),LL(0xf938fb63,0xc6111d40),LL(0x9507e5e7,0xa17dc699)}},
+   {{LL(0x50cb6974,0x19726121),LL(0x1d104057,0x111c1aed),LL(0x2662de2f,0x81078d8f),LL(0x9efeb028,0x1ef08237)}, {LL(0xf78a5396,0x56f438e8),LL(0x437dc527,0xd21ba23f),LL(0xc06415c8,0xac90a522),LL(0x259126fd,0x220ca571)}},
+   {{LL(0xf9f51b92,0x787d95e4),LL(0xb8ca2138,0xbf42e574),LL(0x6e233df9,0xef21daaf),LL(0x6cf80ea1,0x96b96e74)}, {LL(0xe3971a07,0x1ef9daef),LL(0xff89c7e4,0x677b1970),LL(0xd884b085,0x9ee5b752),LL(0x61547fff,0x33619056)}},
+   {{LL(0x3d9f3efd,0x311eefd9),LL(0x7e886bc3,0xd2875f3a),LL(0x4beacc3a,0xbcc81d97),LL(0xd0a66eb8,0xeb650ec0)}, {LL(0x77084634,0x281ca8c8),LL(0x64c67e6b,0x7f4a841f),LL(0x159bf81b,0x4b273600),LL(0x9ccf70db,0x4ba4d2eb)}},
+   {{LL(0xf2bf2558,0xbc08829d),LL(0xb10b2ebc,0x47ae1454),LL(0xc086a93c,0x333c13ce),LL(0xc6b55bf0,0x3f6fdb67)}, {LL(0x1bd554a3,0xc9f275b7),LL(0xbe0f349f,0x5b9246f6),LL(0x6554b6c4,0x64b68d72),LL(0x515cec85,0x2bbbae77)}},
+   {{LL(0xebed62e7,0x33cfac1d),LL(0x6b41618b,0x3c81a7d6),LL(0xfe2e4600,0xa2254b89),LL(0x8fad3fe4,0x4a3df864)}, {LL(0xe66cfedd,0x59a52ec8),LL(0x508312fc,0xbf1cc2e0),LL(0x43d2b3af,0x3a3232c8),LL(0x8190f470,0xb5f38a9e)}},
+   {{LL(0x49b34898,0x66f8ab1f),LL(0x639542c2,0x8abcdb14),LL(0x69f1d26f,0x2bb1c7d3),LL(0xb38a33df,0x5f81d57e)}, {LL(0xb93b7f35,0x09ac2fe3),LL(0x0495e23a,0x04fb8aa5),LL(0x827c7e3f,0x1eee24aa),LL(0x64764e0f,0x7abea152)}},
+   {{LL(0x124fc93b,0x26ca80af),LL(0x74afb087,0xd91a00a5),LL(0x6da41290,0xa5fb11f7),LL(0xc06ed042,0xdf0091f1)}, {LL(0x40f9d3e3,0xa8119962),LL(0x6ce49b7a,0xe369ccab),LL(0x45054d72,0x883bb849),LL(0x6540becb,0xf0a59888)}},
+   {{LL(0xb0f3c71c,0xe0451de6),LL(0x1415b4c9,0x743ef775),LL(0xca1acdd1,0xa58a274c),LL(0xe8541fff,0xd7ea1008)}, {LL(0x838a69d7,0xd9e850b9),LL(0xdaae2f97,0xe10e8f02),LL(0x3f6a2972,0x171e84fc),LL(0xc246583e,0x633eb6a4)}},
+   {{LL(0xe24cef9f,0xebc282f2),LL(0xe1ce5845,0x3179b652),LL(0x0518c54a,0x0135ba96),LL(0x9f70792a,0x870bf551)}, {LL(0x8bf8a156,0xf697d0e4),LL(0x8ee7d7d5,0x43e2484c),LL(0x9a9048b2,0x70db3d0e),LL(0x3e4d7406,0x61b55195)}},
+   {{LL(0xe87f6dd1,0xa3c52447),LL(0x23677fe0,0xec10188a),LL(0xdead71f7,0x7a452fa4),LL(0x3f6fe858,0xed4ee634)}, {LL(0xf2d5c94c,0xf965c676),LL(0x0decc80d,0x0996cc07),LL(0xb6ddc325,0x5afa68b0),LL(0x8742e309,0x3d3c2ad0)}},
+   {{LL(0x27f51f5e,0x8b8e6c8c),LL(0x92098a08,0xf1376f3e),LL(0x4b882c4b,0x35536b06),LL(0xde4c3582,0x014340e1)}, {LL(0x7f1ca91c,0x175467d4),LL(0x9bce1797,0x68c5b51e),LL(0x19012699,0x5cd679e4),LL(0xf716996b,0x10b9703c)}},
+   {{LL(0x488fa6c2,0xe3b66edb),LL(0xbe280135,0x0a2282d0),LL(0x6d91fdac,0x35ce4d3c),LL(0x8155a134,0xb98a0a84)}, {LL(0x776c50fc,0x21f06a79),LL(0x26350d70,0xdbd01951),LL(0x26a437b0,0xd6f9876d),LL(0x5c7060e1,0xcb775368)}},
+   {{LL(0x18e6d5f0,0xad1e752d),LL(0x74f04fed,0x772fe662),LL(0x0df08834,0x0bd18af7),LL(0x7ece72a8,0x762989a5)}, {LL(0x96682f56,0xa83ccbe4),LL(0xc8574e7d,0xef2d0293),LL(0xa692af49,0x40ddfe3a),LL(0x939a45af,0xd908da33)}},
+   {{LL(0x7fb566cb,0xcb0aaa02),LL(0x0a7ce78f,0x1a661985),LL(0xf37c5adf,0x4da4e27f),LL(0x0cc939f3,0x7681e673)}, {LL(0xc454574e,0xc7f2e4f0),LL(0xa8537580,0x9de8a32a),LL(0x10def8ae,0xe6a9c102),LL(0x464719e0,0xae78232c)}},
+   {{LL(0xfa654b64,0x9d641492),LL(0xfc50d880,0x226ccdc2),LL(0xe2914a7d,0x4de213df),LL(0x599f5498,0x0b8a645f)}, {LL(0x2bccd831,0x66f10173),LL(0x2b3a9c40,0x403f0199),LL(0xc9610738,0xc74f0b9f),LL(0x0b46ac10,0xba410b27)}},
+   {{LL(0x54e4fdcc,0x2dcb078d),LL(0xe09e24c4,0xc61c77aa),LL(0x88ea0b53,0x0e8ea39c),LL(0xf233ab5e,0xd9119da5)}, {LL(0x5f5debb2,0xb758a9ea),LL(0x00e92bd4,0x059216b5),LL(0xe7360390,0x1b1a2613),LL(0xe869a1a2,0xc14b7223)}},
+   {{LL(0xa6694f09,0xabf55010),LL(0xed2404c0,0x63366f79),LL(0x1c51be09,0xf20f4b3a),LL(0xb1c626ee,0xfe7678de)}, {LL(0xf7afca9e,0x6d838292),LL(0x117aa688,0xc7d4c8d4),LL(0x8666abdf,0x8a5afc59),LL(0x64bcebeb,0xbf60960e)}},
+   {{LL(0xa465f6c1,0xa3714182),LL(0xcde3ec9c,0x0bf1ed5b),LL(0x8c7e804c,0x9514a9ab),LL(0xedd67466,0x3bf26aa0)}, {LL(0xc35cb8ca,0x56715dbc),LL(0x27ceb627,0xf1db57df),LL(0x76cccd55,0x0fb2af88),LL(0xf78b729b,0xa7062596)}},
+   {{LL(0xd747a3c5,0xadcd6725),LL(0xc5a40709,0x8a48e3f1),LL(0x45770cae,0x8e0ed905),LL(0xef303ef7,0x876dd734)}, {LL(0x10cf38e0,0xc1ba93c1),LL(0x7015bc1f,0x864b7600),LL(0xba3e3988,0x562c4a17),LL(0x284be9f1,0x2a9f7326)}},
+   {{LL(0x8b828941,0xb7654247),LL(0xc9b12a51,0x39d216ad),LL(0x96bfb78e,0x5aa986b7),LL(0xdb035d72,0x03e84332)}, {LL(0x706d83ca,0x9c31486a),LL(0x578b5be2,0x1e8d2589),LL(0x9c0e19e9,0xd230692c),LL(0x5636c233,0xc4c04ffe)}},
+   {{LL(0xb7b1085d,0x055a7f9a),LL(0x7127f8a6,0x0b95bd70),LL(0x8212f130,0xe46b90e4),LL(0x7553be99,0x3a96b399)}, {LL(0xfcf9a3d9,0x275b3d3a),LL(0x4a000fc8,0x2ea82765),LL(0x8a5ee593,0x8fe4e866),LL(0xe91922b8,0xc21fb0a8)}},
+   {{LL(0xca60070b,0xbb1be472),LL(0xe8528806,0xda7cb863),LL(0x118e6553,0x1db15b4c),LL(0x65c5d88c,0xa025fdbb)}, {LL(0x3a386e61,0xa39d8ef4),LL(0xdfcfdddf,0x6d3ec0ac),LL(0xb71d31e6,0x2796b244),LL(0xcf115f67,0x2573307c)}},
+   {{LL(0x65eefd0a,0x1fd0ff33),LL(0xf11e7458,0xbccf1f9a),LL(0xb7d9d5eb,0x9eae5a6c),LL(0x2832faf8,0xf8537377)}, {LL(0x47a0f3d3,0xb4dea3dd),LL(0xa0f53e71,0x63488c8a),LL(0x6faa38a1,0x99ee8730),LL(0x07a1deb0,0x2aeddfc3)}},
+   {{LL(0x832b5854,0xa267b1c8),LL(0x65b53ec1,0x9900a35e),LL(0xcfb04fd2,0x48f0a28d),LL(0x20298787,0x812928ee)}, {LL(0x6a0b4410,0xfcb59a3d),LL(0xf110bdb2,0xbbbf3ab0),LL(0x16482469,0xaba3e829),LL(0x1147a106,0xbb3eac8d)}},
+   {{LL(0xffd9704e,0x62f6ab3f),LL(0x57738b2b,0x377ea047),LL(0x6ecf5b7c,0xc7aa5b97),LL(0xea9fc4e8,0xe071c7d7)}, {LL(0x4836bfb2,0x0288e6dd),LL(0x4aeb65d9,0xaa8b86fb),LL(0x1a1c0d47,0x26fdeac9),LL(0x9dc28ac7,0xb3120524)}},
+   {{LL(0x65cecbe0,0xff616b88),LL(0xd4048223,0xb89723f8),LL(0xc1a31afe,0x8b7e01ed),LL(0xd3c4211e,0x2393d6c9)}, {LL(0x13b13f14,0x0869249a),LL(0xb2e70fe7,0x8f1a3264),LL(0x7b95acff,0xeff7b36b),LL(0x39ff4b91,0x23c50cb0)}},
+   {{LL(0xa15d8452,0xeded72d0),LL(0x4ba3309b,0xea5ca78d),LL(0x96305651,0xd82ee73c),LL(0x8139439b,0x4cac8092)}, {LL(0xc5ec048b,0xc98dc86c),LL(0xb7139830,0x9da9d401),LL(0x27779cf2,0xf5bfeb58),LL(0x2bd8b6a9,0x4b60ccaa)}},
+   {{LL(0x6bcbb956,0xa36d0224),LL(0xf0e51128,0xf2112a15),LL(0x13024873,0xd7ac5f44),LL(0x69694520,0xff46c98d)}, {LL(0xb2711548,0x3e234001),LL(0xb35b1166,0xd0779d68),LL(0xdeb4717d,0x2028eece),LL(0x9be21fab,0x850d09a4)}},
+   {{LL(0xf5ef4cee,0xcd35cb52),LL(0x1e5b3cfa,0xf2553399),LL(0x3786fc5f,0x4485976c),LL(0xfa3cea9c,0x6c9f2023)}, {LL(0x56af91ed,0x68c29707),LL(0x777e9142,0x809cec7c),LL(0xe5d5d798,0x851b722a),LL(0xcef8c32b,0xec1f97a3)}},
+   {{LL(0x253844a2,0xa11cf832),LL(0x693d4fd2,0xdf87f03b),LL(0x6b0eb704,0xb61f0699),LL(0xac59d2a2,0x080a5bd3)}, {LL(0x1643cbbe,0x73f59698),LL(0x4b7ba290,0x10a57d7f),LL(0xd0447972,0xe4b82c9b),LL(0x2f43f859,0x404dd684)}},
+   {{LL(0x922059aa,0xd272fee0),LL(0x5178b0be,0x843ed881),LL(0x86c9162a,0x207e4a04),LL(0xec84f4f9,0x878fdb48)}, {LL(0x91caf241,0x871b3050),LL(0x1fb13d46,0x8262da64),LL(0x7366609f,0x63de50ac),LL(0x52c7f6fa,0x967ee652)}},
+   {{LL(0xe37dcdc2,0xe10444b0),LL(0x86ffa680,0x7e0e4371),LL(0xeca3a3f1,0x3bad50b9),LL(0x5abc83e7,0x940d884b)}, {LL(0xa73fb10b,0xeaaf8eb0),LL(0xd9516149,0xbe55f32a),LL(0x7605dea4,0x10d61621),LL(0xc635fa56,0x81b1ad2b)}},
+   {{LL(0x1310f870,0x27fac810),LL(0xf0e70eb4,0x11e1c692),LL(0xa7421ec0,0xb9562565),LL(0xa4ef4ffa,0x767d4047)}, {LL(0x1c967080,0x3b451e7b),LL(0x392d1331,0x533f61fd),LL(0x96e5ff86,0x6aab28ab),LL(0x7f376756,0xa1b2b242)}},
+   {{LL(0x2b6b90dd,0xf8d5f0c2),LL(0xb18081b3,0x87eac11d),LL(0x4174f535,0x2ee6288f),LL(0x1b707425,0xe3c13596)}, {LL(0xef6a5fb7,0x767b52a4),LL(0x276b2342,0x4bf25e6e),LL(0x9f1d65c4,0x458ba3eb),LL(0x1be1d550,0x79785faa)}},
+   {{LL(0x2e714062,0xb24b66fb),LL(0x20789175,0xcbc0bbe4),LL(0x5cd2cc1c,0xb4e9f6a3),LL(0xe627db99,0x22fcf5c6)}, {LL(0x71c4064b,0x93070fd3),LL(0xb7ecb7dd,0xfd210885),LL(0x120e8ae2,0x3f6daec6),LL(0xfbbfaece,0x77fe8b36)}},
+   {{LL(0x12bd7795,0x5d2d2085),LL(0x7b4c3dc2,0xc512f088),LL(0x45882547,0xf9872bfc),LL(0x3c562919,0x5e981c91)}, {LL(0xe58a262e,0x3317542c),LL(0xa8a9dd18,0xcc4bf1e6),LL(0x250938e0,0xdec83633),LL(0x476d72ec,0x4fc227c0)}},
+   {{LL(0x8a6844e7,0xec486987),LL(0x4cbea877,0x50d7a883),LL(0x20ade230,0x1f95e37a),LL(0xd8d21407,0x2519286c)}, {LL(0xa42deb62,0x3311b853),LL(0xe59b3a32,0x45847f41),LL(0x89fd9f9f,0x0caaab8e),LL(0x9f51cd86,0x5409be2d)}},
+   {{LL(0x0f154082,0xdc0933f4),LL(0x38f58e69,0x827e9dc5),LL(0x68dec2a0,0x2a0d7f92),LL(0xbd1ad785,0xd63fb894)}, {LL(0x1f28a56a,0x98514af5),LL(0x7bc9a0dc,0x2da1b252),LL(0x54e93581,0xa9ac1d69),LL(0x2baaaa7a,0xc8839329)}},
+},
+/* digit=16 base_pwr=2^112 */
+{
+   {{LL(0x83f43b77,0xf18e7aed),LL(0xc2aa04da,0x920f9627),LL(0x4a82737d,0x6cdbef51),LL(0x6f73484c,0xa4c4552e)}, {LL(0x31d71064,0xd5746e81),LL(0x879a4556,0xd3dc3b6a),LL(0x8195822d,0xfe97658c),LL(0xb5487724,0x029f23db)}},
+   {{LL(0x40cd9210,0x930cc9f7),LL(0x850d3b04,0x2503f6ab),LL(0xa7ae15b3,0xec506ec3),LL(0xea31b3d7,0xbbc07d6d)}, {LL(0x28537f3a,0x7a3b5c09),LL(0xf88fc051,0x422e43fa),LL(0x719b38fa,0xe3124491),LL(0x8d876920,0xceb14c76)}},
+   {{LL(0x0e9a20f3,0x38d4bbc0),LL(0xfd2e38f0,0x894e9aac),LL(0xcd9b4b2a,0x2da01f5e),LL(0x318c4485,0x16a3865f)}, {LL(0xbfa19d23,0xaf5b433b),LL(0x4364d1fb,0x25a7b72f),LL(0x7560aff9,0xc95fb661),LL(0x46c4ad73,0x45f88a2f)}},
+   {{LL(0xbff4117a,0xa6e7de7c),LL(0x6a0a77d1,0x76f3b820),LL(0xc7a61f94,0xc5d05f86),LL(0xc43c20e1,0x203e53ee)}, {LL(0x2b3123e3,0xa0cfb1f9),LL(0xcd1e0306,0xb9df4a57),LL(0x0ecfc4e5,0xe16f372a),LL(0xfe4b90f2,0x7a4890e1)}},
+   {{LL(0xf63ab511,0x06215553),LL(0xbf0024f2,0x33aa9936),LL(0xfe9443de,0xa6976aa3),LL(0x9cfd96c8,0xbb3a3f6b)}, {LL(0x5a01db04,0x07685d1a),LL(0x1aff9ee0,0x719b1943),LL(0x36b9d144,0x78b18d33),LL(0x83314c11,0xe0535048)}},
+   {{LL(0xab46baa1,0x7ac6f818),LL(0x612e7294,0x1a7e6e33),LL(0x84f7970a,0xe75d4bd7),LL(0x109b6bc8,0x01f7477d)}, {LL(0xf4f82041,0x6eaa6485),LL(0x7253a748,0x15bcf8e4),LL(0x0e25199f,0xbdf0ff85),LL(0xd38a3a51,0x7c04d155)}},
+   {{LL(0xde493b9e,0x4d42e7ca),LL(0xd50a2e6f,0x20d44d8b),LL(0xa136cacf,0x776744dd),LL(0xb7c9a92b,0x7076da71)}, {LL(0x623f74a4,0xabbf894e),LL(0x198a20d0,0x97a82645),LL(0x3afc2cbc,0xe7cf94a9),LL(0xaf78625c,0x321d0eae)}},
+   {{LL(0x5c3cc91d,0x08770792),LL(0xa90cc9ca,0x046988d7),LL(0x04b7b23c,0xeffafc67),LL(0x5442d455,0x40bd30de)}, {LL(0x894fa50f,0x0fb45dd1),LL(0x1d94ffa0,0x21d1d9d4),LL(0x9b86eaa8,0xe173942e),LL(0xfd5c7b97,0xce014737)}},
+   {{LL(0xbdba221b,0xc32ef561),LL(0xf1977fa6,0x7337f9d2),LL(0xdf87c904,0xed39e4b6),LL(0x4e4b42a7,0x33d38bed)}, {LL(0xac1d51b7,0xba067411),LL(0x839580df,0x557fd8cc),LL(0xe811e09a,0xb78c9d10),LL(0x503fba95,0xc88f41c6)}},
+   {{LL(0xa5e384f8,0x9a5a8a55),LL(0xe3f2e164,0xdae2cd6d),LL(0x7fe4a566,0x1aeca707),LL(0xf1246767,0x1b4bc003)}, {LL(0xefa657bf,0x0e9b3777),LL(0x31e2f70b,0x8eab6fe5),LL(0x11c1204f,0xbdad5903),LL(0x91532b47,0x2e44375b)}},
+   {{LL(0x36ff3e85,0x1114778d),LL(0x34666923,0x20c0ae59),LL(0x0cd3fbad,0xd2632705),LL(0x0fe20d2d,0x8425117a)}, {LL(0x5d9c1135,0x6357f526),LL(0xce4a2395,0x15d71312),LL(0x5e9c2710,0x039e9cb2),LL(0x44b60831,0x52fdb2b3)}},
+   {{LL(0x274b92be,0x9db65fd6),LL(0x5a4e03c4,0x42e75c22),LL(0x71b5eafb,0x44d3dbfd),LL(0x103fc758,0x88d0b648)}, {LL(0x1fddcb14,0xabfd2e78),LL(0x495cdc3e,0x97dcfaa2),LL(0xb2df3ef2,0x40bb734c),LL(0x09534fd4,0x31b480bd)}},
+   {{LL(0x6b86a3b3,0x2c71da30),LL(0x9a09fed7,0x1e12a3a9),LL(0xc7384cdc,0x0a2db3dc),LL(0x5e36f8a6,0xc0217825)}, {LL(0x8ede307f,0xe24dbd75),LL(0xebe9f510,0x2facc912),LL(0x96182ac0,0xb61be987),LL(0x02763251,0xb620848e)}},
+   {{LL(0xc0cc511f,0x07d39023),LL(0x7edd108a,0xf7d25871),LL(0x64c9384f,0xc8c5e7c9),LL(0xfd2a3cd7,0xd757e952)}, {LL(0x5dc5a281,0xfdf4cdce),LL(0xef172b0d,0x44eb15e5),LL(0x3a527fa8,0x4ae215cd),LL(0x799d07b9,0x894e93fc)}},
+   {{LL(0xcd4f3698,0xf1b7e242),LL(0x0f5938c1,0x1a6bf173),LL(0x81993de2,0x3b63b490),LL(0x5142c9bc,0x85339f49)}, {LL(0x2cd76fda,0xe26a056d),LL(0x6fcc0a94,0xb256a6e9),LL(0x6f3e73af,0xd16bfc92),LL(0x888c44e8,0x7803a77f)}},
+   {{LL(0xd7ddf9c6,0xf39b64b8),LL(0x5d569f45,0xd45385b4),LL(0x7bee2c10,0x664a3cc4),LL(0x7a85dcf2,0xe8dc0a92)}, {LL(0xfb9f2d66,0xc52cb3b7),LL(0x9b383fd9,0xbdbfd7c6),LL(0x45354223,0x2e680304),LL(0x0f793d28,0xd28024a2)}},
+   {{LL(0x49323f3d,0xf4534c60),LL(0x403f3cbb,0xd8f714ea),LL(0x0c9114b6,0xb322ce9c),LL(0x04f5a26f,0xed598114)}, {LL(0xca4d6380,0xbf4370f4),LL(0x5617b049,0x5b47ec2a),LL(0x8f29216c,0xb76cda8e),LL(0xb7d21102,0x43ae42df)}},
+   {{LL(0x7e214a10,0xe86fad25),LL(0x872383ae,0x8e6e92d4),LL(0x947b1597,0x03877f47),LL(0x5c64d4eb,0x379f75b9)}, {LL(0x75b6a6a0,0x7c5cde24),LL(0xd4000c5d,0x3ea032c2),LL(0x6c68b1c6,0x60009080),LL(0x335870a2,0x41bebff3)}},
+   {{LL(0xd19d5645,0x2ed69769),LL(0xdb690597,0x2cd37a8e),LL(0x0e409770,0x78cb56ca),LL(0xb925a814,0xabd82184)}, {LL(0xd6699f32,0x0c9956ee),LL(0xa7403d75,0x643f9fde),LL(0x096a5ae0,0xdff1c91c),LL(0x715e451b,0xf5521502)}},
+   {{LL(0x10d439c8,0xc9a9b356),LL(0x34d07c31,0x32f6cfa8),LL(0xad5695eb,0xec53f311),LL(0x44a6fe02,0x5662d4c8)}, {LL(0xa45aa72c,0x61e0e521),LL(0x4c419b22,0x871c1edf),LL(0xd2a12cb1,0xc8fa39f6),LL(0xea13725a,0x1a3c1f5c)}},
+   {{LL(0x596ffa8d,0x37ecde9a),LL(0x8141a8cf,0x05998695),LL(0x64a41e17,0xbfd09cde),LL(0xd36cd34a,0x757eb754)}, {LL(0x924eca9a,0xb7af7dcb),LL(0xf080f0fb,0x7ea1037b),LL(0x5cb45e86,0x83ba980e),LL(0x432460dd,0x6507f349)}},
+   {{LL(0x48cc71b6,0x022fb5d5),LL(0x7463b619,0xcf8c1da2),LL(0xca921e29,0xa998e56f),LL(0x7a58c8cd,0x8a085913)}, {LL(0x19360e36,0xb190b760),LL(0xfbf084c8,0x8db680a4),LL(0xb08a85d8,0x378e26a9),LL(0xed767e3a,0x7a4a76a2)}},
+   {{LL(0xfafb4ebe,0x49c02443),LL(0xe835bb64,0x13393c0a),LL(0x831318c5,0x8fb3c1b7),LL(0x7a953ee8,0x6cfc12e4)}, {LL(0xbdc3382e,0x40bc5dab),LL(0x91477169,0xafceaf38),LL(0x5d96bbaa,0x2bce857e),LL(0x6d82bfa3,0x773d0f01)}},
+   {{LL(0xbb44217b,0x1d2f53c1),LL(0xca4af11f,0xf86e2d44),LL(0x03bed09a,0x5074a13c),LL(0xaaf42eee,0x2b4bf81a)}, {LL(0x99e776e7,0x4fadc3b7),LL(0x1e38ab2f,0x5cc783aa),LL(0x56e6da3e,0x6f4e6a70),LL(0x954eecf9,0xbc189674)}},
+   {{LL(0x404994d0,0x74d1848c),LL(0x9f616104,0x61ea7b3a),LL(0xae606590,0x3c3db2ac),LL(0xa5b84251,0x828f4bd8)}, {LL(0xc1a21d1f,0x10657402),LL(0xa0712849,0xdda85a8a),LL(0x399c8655,0x7b67dde1),LL(0x893527b9,0x2bbedf8d)}},
+   {{LL(0x51f7b7dc,0x7b65f5be),LL(0xd24c8a1f,0x0ea63df3),LL(0x301ca48d,0xbf37fc9b),LL(0x983cc052,0xd8a3c292)}, {LL(0x99fa6a3b,0xce38783a),LL(0xccf1550b,0xeb68a111),LL(0x1d73464e,0x27a41464),LL(0xf2fa9888,0xa7057196)}},
+   {{LL(0xd4847bae,0xd85a07f1),LL(0x11a06651,0x2b4ad0a3),LL(0x77eb1904,0xd0f77fc3),LL(0xcedef25f,0x2c5e08b0)}, {LL(0x32e22a19,0x8912c8d1),LL(0x5e0a50a3,0x5236775a),LL(0x89d1ab73,0x72355d39),LL(0xfdcc5841,0xfa4673c5)}},
+   {{LL(0x65098a4c,0xa195e28c),LL(0x0cd1ab63,0xe9281bd7),LL(0x489b2edb,0xf8c14c1b),LL(0x69b2ce14,0x977bf4ec)}, {LL(0xac0a2acd,0x99a623b5),LL(0x42d9c309,0x51bfd462),LL(0x93136090,0x7524af84),LL(0xda7a4e57,0xd8af499d)}},
+   {{LL(0x250bc42a,0xf90857b0),LL(0x8bcd0271,0x98730ce0),LL(0x53f21acb,0x9f030b22),LL(0xd1588b81,0x50c9baad)}, {LL(0xe5c6a667,0xbbb075d9),LL(0x5a4b52e8,0xa0fa1f39),LL(0xed4c6bd6,0x1187885f),LL(0x5c4eaf8e,0xa8e4cb26)}},
+   {{LL(0x93d20219,0xc174c25d),LL(0xeec5e85f,0x36802b80),LL(0x9df9662f,0x0e042dd4),LL(0x618e5719,0x17b30440)}, {LL(0xd8ba51a0,0x93b1fd03),LL(0xb8b982d7,0x7ae9e8ed),LL(0xbeeda8bf,0xee91a229),LL(0x3ca6ddcc,0xcf53fd11)}},
+   {{LL(0x9541ba26,0x18c0652e),LL(0x170a01ac,0x73e8774d),LL(0xacfdd329,0xeb54b7b9),LL(0x0e76b5a0,0xd794c7b3)}, {LL(0xb3892898,0x42e74020),LL(0x99f6cb8d,0x9e5e6c8d),LL(0xfe03f52e,0xa6a31eec),LL(0xbb39d4e0,0x513d88fb)}},
+   {{LL(0xea3c920c,0xb3b41b05),LL(0x79d9852f,0xd89b5c97),LL(0x5b5e3864,0x9d28072a),LL(0xf844faa6,0x42da1975)}, {LL(0xcb8fddba,0xe79c488f),LL(0x48a7736b,0x1f657cd6),LL(0xf97fb64f,0x886b0cf6),LL(0x76a28a3c,0x5149b5a4)}},
+   {{LL(0x1afcbd90,0x8a6cde7e),LL(0x58749b85,0xd76a01bd),LL(0xf0c26554,0x5c80cb11),LL(0x84527e02,0x9ed38d64)}, {LL(0xa4c30681,0x7f29a74c),LL(0x1719616f,0x86407c74),LL(0xf4a3b7b4,0x32e3c46a),LL(0xe6ab5da2,0x24405d9e)}},
+   {{LL(0x3c3ae427,0x1da5dffe),LL(0xf4e5a32a,0x94910788),LL(0x238ddc6a,0x957c8aba),LL(0x77a7cf1a,0x0108f685)}, {LL(0x15ce8b7b,0x6fc75ff9),LL(0x3d575029,0x4edab763),LL(0xc563cd2a,0x3ff0c310),LL(0xbfc8eeda,0x4847b1a2)}},
+   {{LL(0x757d31ff,0x468e8c2e),LL(0x86509e5b,0xced6d2c1),LL(0x6fe40e59,0xe094527e),LL(0x62366279,0x60692b74)}, {LL(0x9e74e755,0xd295d74c),LL(0x0dab0489,0x290e1d9f),LL(0xbb27ee4b,0xb9a186fe),LL(0xe8317dce,0x42148ee2)}},
+   {{LL(0xe2d0a20e,0xd6e363b7),LL(0x1cef1538,0x78f15b8c),LL(0xf3be466f,0x589a303c),LL(0xfdcbc13e,0x2265f6c4)}, {LL(0x4485b1a2,0xe0e14f74),LL(0x208a96a4,0x7ca36271),LL(0x2ed52123,0x057d4d36),LL(0x68fac36c,0xa8db8048)}},
+   {{LL(0x37cbfa09,0x7a56cf9a),LL(0xb16c3053,0x4b516223),LL(0x91594292,0x1fd1ee93),LL(0x557f80ac,0x4d162bcd)}, {LL(0x88ff9c2d,0xf5fd3b04),LL(0x3fb1b85d,0x68987ad1),LL(0x6155de65,0xf67d59ec),LL(0x3f0bd172,0x4c07af00)}},
+   {{LL(0x9c2bf1fd,0x00140ccc),LL(0x51b92065,0x8080c45f),LL(0x14df16ae,0x1cb2dc8a),LL(0x75b1f255,0x4ffcc3d6)}, {LL(0x894d4171,0x79f8eec6),LL(0x115a40ca,0x35166150),LL(0x1e3d94bb,0xedf1d72c),LL(0x6b449b84,0x7ff03c53)}},
+   {{LL(0x061c67b3,0x160cf5a5),LL(0xf0f09a2f,0xb0a00f93),LL(0x68a8da43,0x0264485b),LL(0x6489b156,0xc759f15d)}, {LL(0xdd829e9c,0x2a11b987),LL(0x6b5c345b,0x17314743),LL(0x2f69f6c8,0x2975e961),LL(0x67e20896,0x09bb7401)}},
+   {{LL(0xfe551c17,0x7f467851),LL(0x69e21a26,0x95c6233d),LL(0x38883da3,0x74ce81b4),LL(0x782d0892,0xc8423a0a)}, {LL(0xab4fb3c0,0xfc448320),LL(0xbebe866d,0xeb16c9f3),LL(0xc91f8426,0xb39947cb),LL(0x135a737e,0x5325e077)}},
+   {{LL(0x0dc952ae,0x3f1f6358),LL(0x11b5d367,0xd895c1e7),LL(0x3fbfa003,0x7f274c34),LL(0xac2cc640,0xd857788c)}, {LL(0x5e2bb440,0x11221521),LL(0x72593f54,0x55434a77),LL(0x68e4dd9c,0x66b05d13),LL(0x12e3d41a,0x12a8fb57)}},
+   {{LL(0xbb5fae80,0x2ec62606),LL(0xaacba503,0x9eaf40df),LL(0x26af59a7,0x19e558fb),LL(0x622d6938,0x3f2d4bf2)}, {LL(0x535fe116,0xf0b1e85e),LL(0xfe73f104,0x46432083),LL(0xb693e309,0xa95ad049),LL(0x325dfa59,0xf6087361)}},
+   {{LL(0x80425123,0x744a599a),LL(0x423fd4e6,0x6bda3f5c),LL(0x35965b90,0x03955ccf),LL(0x53f0a6fe,0x62c8848a)}, {LL(0x3a3a35a1,0x178e553b),LL(0x9e030f02,0x6efc0c2a),LL(0x38be10f3,0x7e56b0e6),LL(0xbb300b38,0x1191d9ce)}},
+   {{LL(0xe886fbc2,0x9fd84fda),LL(0x9c00e4a4,0xf035a8c8),LL(0x6ed8d8e3,0x7f4ff879),LL(0xf9c8cd34,0xbe5d919f)}, {LL(0x46b1f1dd,0xff2c1c6f),LL(0x47402d14,0x0223b3a2),LL(0x954fdaa8,0x4b1ebc54),LL(0x18c4df68,0x86ec790d)}},
+   {{LL(0x471905f2,0xad5c677c),LL(0x182ec89d,0x1a68ba11),LL(0xbfa487ee,0x12a327f6),LL(0x276055b9,0x30ca2aa2)}, {LL(0xa59cd8ce,0xd566652b),LL(0x474a03e4,0xf0b59854),LL(0xab765798,0x0422e45c),LL(0x1cb17c04,0x3e953c8d)}},
+   {{LL(0xb596aaf9,0x417e891a),LL(0xf3ec51ba,0xba82c529),LL(0x6db56ed5,0xb11fd308),LL(0x9b3ddc17,0x5fb0a74a)}, {LL(0x35a87a5e,0x1f687081),LL(0xf9f6b0e2,0xaae0f99c),LL(0xcf71ca11,0x832393f8),LL(0x9b1fd88a,0xf5ac065b)}},
+   {{LL(0xf683528b,0x797b7e87),LL(0x6d94d4b0,0x9f20f862),LL(0xed3e4230,0x16cd0e38),LL(0xc87982cc,0x4d0b0bdf)}, {LL(0xcee676f6,0x85717733),LL(0xdd374f60,0xf3496084),LL(0x166094ee,0xff44623e),LL(0xe2810898,0x07dc4021)}},
+   {{LL(0x7ae039d4,0x2d5227d9),LL(0xcf8809fe,0x568b6907),LL(0xc236afe2,0x8aad94e4),LL(0x73349590,0x6425f1df)}, {LL(0x705c1877,0x651576fa),LL(0xa5863955,0xbd33cd65),LL(0x2da96aa8,0xad74a142),LL(0x59cfe828,0xf6b257b8)}},
+   {{LL(0x0eaa7534,0x5219eec8),LL(0xfd0dd6d0,0x53ea9a05),LL(0x5dde2351,0x756529cf),LL(0x29e2d804,0xa7360629)}, {LL(0xfb5a4761,0x28771b2b),LL(0xb3bb1f38,0x60da5eb0),LL(0x6d3cfe20,0xd4a3b5c4),LL(0x92024c1a,0x469b04b5)}},
+   {{LL(0xde6dd334,0x6b8ec890),LL(0x6d98754a,0xeffeeec4),LL(0x9f8d54f6,0xb1048169),LL(0x5d5b36a7,0xd0c07da1)}, {LL(0x15888db9,0xf9ae490e),LL(0x07df860b,0xd5a1892a),LL(0x27a5a0d7,0x50c60ca4),LL(0x46a0b8ac,0xbbd0fce3)}},
+   {{LL(0x8deab946,0xf81ab2f8),LL(0x817ffd53,0xe6b9acc5),LL(0x2b0381df,0xcaf68e05),LL(0x9e93c470,0x0106a5cc)}, {LL(0xe163c645,0xd26d2f91),LL(0x68aadebe,0x6bdcffe7),LL(0xc395c555,0x71f4884c),LL(0x254fb79a,0x4f4030b8)}},
+   {{LL(0xc46b1467,0xfa653fe1),LL(0x2e6abe67,0x28217176),LL(0x27d1cd26,0xc16b18bd),LL(0x249738c8,0xd51607b3)}, {LL(0x775813c1,0x18cd7460),LL(0xb10829c3,0x52faea3f),LL(0x1772ebff,0xd8fd6679),LL(0x778a7e83,0xdff758fe)}},
+   {{LL(0x2feef039,0x26e4f31b),LL(0xf9b43327,0x4f4fc7c7),LL(0xaddd1fa2,0x3b84e5f3),LL(0xd4242404,0xc0eef944)}, {LL(0xdc3ba34b,0x2b673fd1),LL(0x69183309,0xf986f952),LL(0xec8e36fd,0xffcd5144),LL(0xb0c127b8,0x478507ea)}},
+   {{LL(0x9255b728,0xfe7b2f7b),LL(0xded6f35a,0x16920d4a),LL(0xbbccd77d,0x6929ce34),LL(0x18b3f3d5,0xb4f47349)}, {LL(0x5a35b8b7,0x87be91fd),LL(0xe52e66ed,0xaeb3e00b),LL(0xa5e001c2,0x4c3c8b8c),LL(0x7e1cd2e2,0x94455438)}},
+   {{LL(0xc46af91c,0xacfe69e0),LL(0x459ac4f0,0xdc0c487e),LL(0x9aa5f8c5,0xa751e9fa),LL(0xb1c0d6a4,0x25ef51fb)}, {LL(0x9815bf13,0x4ab11893),LL(0xc3fb6b63,0x4d325f7c),LL(0x65c46bec,0xdaafe4b4),LL(0xc81f3920,0x859dc702)}},
+   {{LL(0x03c1119e,0xe8520642),LL(0xec5ba6a9,0x779aa443),LL(0xa80e375f,0x3a67b2a9),LL(0xed9b4386,0xed1815eb)}, {LL(0xfa4b8673,0x4e340573),LL(0x90410326,0x656b84d5),LL(0x2ca1c69d,0x1ac7a2f8),LL(0xc9e33454,0x33a8f5db)}},
+   {{LL(0x590d3ed9,0xac657070),LL(0x69359bfc,0xc654c74a),LL(0x9bb29ff2,0x0944e646),LL(0x36a431f7,0x597d58cf)}, {LL(0x74699e50,0x63d2b113),LL(0x0ebaa3a7,0x8300bd87),LL(0x5af7d764,0x44c9fce1),LL(0xf510d9a6,0x63664d89)}},
+   {{LL(0xad2738bf,0xfca05203),LL(0x4f97a5dc,0xe6a27f40),LL(0xca3f9851,0x35168c7c),LL(0x485ee3a7,0x4e69b71f)}, {LL(0x36cb5281,0x63e2a348),LL(0x50833789,0x61ce193c),LL(0x3e28b1e5,0x6dd478ae),LL(0x9fd3df48,0x6125594e)}},
+   {{LL(0xbbec3a57,0x5944a4dd),LL(0x5458e1c0,0x25937801),LL(0x17353358,0x66d303d6),LL(0xe345d659,0xaecf3b39)}, {LL(0x5810d1f6,0xeb40a373),LL(0x8f000190,0x8cc2508d),LL(0xaf2a1798,0x4d5b34cc),LL(0x86fa636e,0xa8b08198)}},
+   {{LL(0x504e4f6b,0x6d5d2ab9),LL(0x1ec07198,0x6e45e6d5),LL(0xa94aee41,0xffc5a20e),LL(0x78d0c598,0xbeed3369)}, {LL(0x46d118f2,0x66dbaa33),LL(0xf9b1e25b,0x05c29a75),LL(0xa22ffc88,0x584c5d2f),LL(0xf391c3b4,0xea4e8f85)}},
+   {{LL(0x2d8695c1,0x72d7baff),LL(0xe56fa041,0x0657382a),LL(0xdf07e3e0,0xb9e1fb03),LL(0x9ed38264,0x07e33a23)}, {LL(0x82ac5348,0x101e6eeb),LL(0xc3bd1c42,0x5dbc24f1),LL(0x0240c4ba,0x61565007),LL(0x061c2210,0x70cd3678)}},
+   {{LL(0xfd2b5a38,0x50a027c0),LL(0xbf38df41,0xb6fa11b2),LL(0x32eefc97,0x6a096396),LL(0x61f5b16d,0x211ec2fa)}, {LL(0x4e593da3,0xa7af3631),LL(0x82eac2a2,0x70220ee7),LL(0xe514ad4e,0xa0318e91),LL(0xc370d9e0,0xd75f8d31)}},
+   {{LL(0x2fef6fcd,0x81786476),LL(0x863ca79c,0xd07dfd8c),LL(0xfcde5989,0x3bf40078),LL(0x1c5049bc,0x9a46927c)}, {LL(0x4ff33b6d,0x4820f7d4),LL(0xd545bf61,0x9d68d68d),LL(0x3d87d526,0x7ab77351),LL(0x2092c747,0xd3a745f2)}},
+   {{LL(0x09e7162c,0xdb79ed37),LL(0x210d92c6,0x44616839),LL(0x63dcb460,0x5b031f22),LL(0x1f0a91f9,0x3973c3a2)}, {LL(0x4fd105a2,0xe3a171c3),LL(0x7415e7ba,0x90e8b6d7),LL(0x85cb608f,0x85b12450),LL(0x6cef3a42,0x1c34558c)}},
+},
+/* digit=17 base_pwr=2^119 */
+{
+   {{LL(0x6bfb7d2b,0xba072db1),LL(0xcd530741,0x47d37598),LL(0x3c42d1f7,0x43651160),LL(0xdf7ad0f0,0x56246f5d)}, {LL(0x61e482bc,0x8fb015ac),LL(0x349deadc,0x0d85d7a7),LL(0xdbe87257,0xd1c9cb04),LL(0x991f4753,0x7fafce4d)}},
+   {{LL(0x788ddfa9,0xb37b0a32),LL(0x22de8830,0x195e96ff),LL(0xe9970a54,0x6746a7a8),LL(0x32c3b8e3,0xf8310204)}, {LL(0x69d78b56,0x8f88c4e5),LL(0x32e19cb5,0x552d9699),LL(0x75856adb,0x09922345),LL(0x7f98d51e,0x8d8e9c90)}},
+   {{LL(0x982c6395,0xfeffb22d),LL(0xc62a5b27,0xdfd4da10),LL(0xfa23869c,0xefa32c77),LL(0xd3cca749,0x09880fd2)}, {LL(0x1c0b1468,0x132e45d4),LL(0x6abd03ac,0x5982349d),LL(0x8496624b,0xca9e4d78),LL(0xde2e1781,0x67d665f6)}},
+   {{LL(0xe7d2dd53,0xf71b570d),LL(0xe66c00b0,0x1b3f2bfa),LL(0xe0035164,0x79966be0),LL(0xf446dc7d,0x34973c74)}, {LL(0x11f54954,0xf5d6eb25),LL(0xfa3d438f,0xbf2b50cc),LL(0x6c64c70f,0xb2ec85c5),LL(0x48be0622,0xf393648b)}},
+   {{LL(0xb6feb95d,0x98fddddb),LL(0xee8c9bc1,0xa4643994),LL(0x890d891e,0xd7b2fc74),LL(0xca0eaeec,0x02b0250f)}, {LL(0x313621f6,0xebf22427),LL(0x3d10edc1,0xbebf1220),LL(0x25e1dab1,0xab9110ab),LL(0x227311c0,0xc6fedb85)}},
+   {{LL(0x2e08da84,0x9d690034),LL(0x5910338b,0xf5b19b0f),LL(0x1fa0bc39,0x3fc4466e),LL(0xf1112f63,0xca53dc42)}, {LL(0x63a3dc0a,0x92aca6d6),LL(0x9419064c,0x8dcedb90),LL(0x3a91d432,0xf9fa275d),LL(0xeaa0d1d8,0x7e0a58c7)}},
+   {{LL(0x0e084642,0xee2e60fd),LL(0x3c4a8cff,0x9ac1e67b),LL(0x4d090e4e,0x6ed4d550),LL(0xfd57b7f5,0xa34c965a)}, {LL(0x562629f5,0x52def5f8),LL(0x55250d17,0x081dcb7a),LL(0x9ca0c08c,0x36dd4479),LL(0xbb3cb32a,0xf5a61bb4)}},
+   {{LL(0xb676803b,0xddd3edb4),LL(0x1f133225,0xdb1c8989),LL(0xe0d8bab5,0xd126568d),LL(0xecdc8566,0xb5ac5b4f)}, {LL(0x8f3d8f23,0x722ff7a0),LL(0xf10be28c,0x36c915e9),LL(0xaafa221f,0x2fbb05c2),LL(0x023ccb2a,0x68ff90a1)}},
+   {{LL(0x3a172324,0xcb39b132),LL(0x955ca4ca,0x4736b6e3),LL(0x5dd56ec6,0x5c9df760),LL(0x214bd470,0x51604a9e)}, {LL(0x3b3f97e7,0xb6efe4a7),LL(0x0fda2133,0x7550472e),LL(0x2651c2c7,0xc4fe77e1),LL(0xab84f3e2,0x3ec327c6)}},
+   {{LL(0x8b8e24e8,0x0ad17671),LL(0x02b1cea8,0xe32d77d0),LL(0x60bd4d38,0xe0d299e1),LL(0x6c91ec2e,0x1bfba2ba)}, {LL(0x70d20a36,0xc088dd8b),LL(0x1229f50b,0xfdbf6f48),LL(0xbe6c6296,0x92c76498),LL(0x9dc37f91,0xe683842b)}},
+   {{LL(0x3324291c,0xfb363d7c),LL(0xfdb18fcd,0x5e5add72),LL(0xd6c95f2d,0x9de675eb),LL(0x74008223,0xc1856a75)}, {LL(0x4eced49e,0x7ffcfa1a),LL(0xa3f8d364,0x860b89b9),LL(0xabd5dc8d,0xf467525b),LL(0xca798fc5,0x091308fc)}},
+   {{LL(0x4d476783,0x8afc20fc),LL(0x4f4a4105,0x9d537b0c),LL(0xd4909288,0x2777c5b3),LL(0xd86b966d,0x4c171ecb)}, {LL(0x8aecd3b1,0x78434d75),LL(0x3c3c750f,0x42ff5d51),LL(0xd09948b7,0x694d185f),LL(0xf3b49dae,0xf04ac838)}},
+   {{LL(0xd309b6d6,0x9d2d587e),LL(0xfa5a7861,0x0180d9fe),LL(0x90c44435,0x8d8ccea4),LL(0xa88c5be9,0x589c13be)}, {LL(0xe333267d,0xb893583e),LL(0x11dd21c7,0x6023b379),LL(0xada30194,0xb675575f),LL(0x894e0c4e,0x9626d3b5)}},
+   {{LL(0x557c6f06,0xd22f6193),LL(0x35632c35,0x1e63aab1),LL(0x1937f1c0,0xe29bf305),LL(0x7a50026a,0x0b466363)}, {LL(0x17981c5a,0x366f11b2),LL(0x519754dc,0xd6ee7b2f),LL(0x307d0e67,0x5a97284a),LL(0x64b277a0,0xa557ad44)}},
+   {{LL(0xf84b1019,0x5ddc3321),LL(0x58b32a58,0x200c72ea),LL(0xed63c375,0x3fde8ec6),LL(0xfc7631f3,0x43dcf338)}, {LL(0x6d450ea0,0xe792250d),LL(0x07d3db4e,0xc4e603fc),LL(0x00b41e0c,0xcea45f30),LL(0x24d5daee,0x88d6bca8)}},
+   {{LL(0xbd99aa45,0x5eb45bc6),LL(0x897f9d2f,0xa6d3f368),LL(0x0ef0a6d5,0xb0d51079),LL(0x96060347,0x61824a15)}, {LL(0xf4aafaad,0xca274dc3),LL(0x30c72081,0x18f0d114),LL(0x87c9b89c,0xc5655c78),LL(0x35cd57c7,0x1aa6ec7c)}},
+   {{LL(0x9b65ad1b,0x1cd9d5d8),LL(0xb6c14445,0x4a16ab0f),LL(0x64b90ac0,0x3dfe8f1f),LL(0x6e74758b,0x03fcac0d)}, {LL(0x600481ec,0x1d66792b),LL(0x90c0b5a1,0x8ce82a88),LL(0x188e6cee,0xaaa38b82),LL(0x9308ecde,0x30212eb7)}},
+   {{LL(0xcdda4e80,0x46bd9fa7),LL(0xcbc0f2a4,0x70370d7d),LL(0xeb29a60c,0x3973fb1c),LL(0x6231d5c7,0x7981116c)}, {LL(0xd602afb6,0x85103428),LL(0x5cd4ac6c,0x81f0c208),LL(0x15c1b416,0x4f8b17d3),LL(0xab6f98d9,0x44b41162)}},
+   {{LL(0x41b1971a,0x4e645041),LL(0xcd52e12e,0xbba921a5),LL(0xdb4b8f7f,0x933a4814),LL(0x34feda62,0xdca3ab03)}, {LL(0xfe4f5b6f,0x154a891b),LL(0x42fbc748,0x98e7359b),LL(0xb24ff52a,0x898cc21c),LL(0xb6161aa6,0x977a41fb)}},
+   {{LL(0xf259bad6,0x294be79f),LL(0x1436d2c9,0xcb398d5c),LL(0xfd5cf185,0x1027daf9),LL(0x3d66e1be,0xf8d45357)}, {LL(0x5e06a15c,0xf2eb11cc),LL(0xd7b022e9,0x9622cbb6),LL(0xec51a8b6,0x10ec7a69),LL(0x2edb94f0,0x8fb4fc2e)}},
+   {{LL(0xe6ba3083,0x5dbbd978),LL(0x2ffaec1e,0xe4781637),LL(0xe2a40c8f,0x8894c77e),LL(0x3fa7a9a9,0x8d1036a6)}, {LL(0x396b03b2,0x965b4e3c),LL(0x8f8fd5fa,0x88955edb),LL(0x1ee08a1c,0xcac327b5),LL(0x530de1fc,0xd6c8f31a)}},
+   {{LL(0xd07a0e64,0x2453a284),LL(0x2cfdc2ef,0x9213658c),LL(0x9d01ad31,0x9a244f4a),LL(0xc8b15211,0xc425bb80)}, {LL(0x4fa2620b,0x9b8002cc),LL(0xc7507557,0x28bbf261),LL(0x5c049d63,0x0073dbd3),LL(0x48d8b4f1,0x3ab8e2b8)}},
+   {{LL(0x706dce47,0x016becf9),LL(0x5895a21a,0x8d01a616),LL(0x7e87c308,0x9183e4ed),LL(0x9bed7f9e,0x11b36c32)}, {LL(0x2358aeb6,0x33824723),LL(0x13bdb39b,0xa5860022),LL(0x2ef1d21a,0x6ed2ddd9),LL(0xaf1d247a,0x99d19e55)}},
+   {{LL(0x5e83de5d,0xb92fa411),LL(0x2e415b4a,0x3b033c3a),LL(0xa212891f,0x8937cdd2),LL(0xe004d4e6,0x87ab5784)}, {LL(0xc88a1067,0x76bd5e58),LL(0x7f7e532d,0x47e43f3d),LL(0xfcd17d34,0x7d5ac06a),LL(0x692ef144,0xffd5cb79)}},
+   {{LL(0xfd890d5b,0x65c07f39),LL(0xa91b372b,0x7117fde7),LL(0x10f5b15a,0xa4660779),LL(0xa61ea2e3,0xb89afcb6)}, {LL(0x64929d39,0x682d2684),LL(0xa32804be,0x73693f54),LL(0xf38843db,0x0627fc85),LL(0x51963e61,0xb9b156b1)}},
+   {{LL(0xe7159cf5,0xcd4ea6ef),LL(0xdda7e74a,0xc905c7d3),LL(0x9f7845c9,0x404f325c),LL(0x045d2825,0xdd3f6793)}, {LL(0xf3b8412e,0xa169aeca),LL(0xd9b038dc,0xdc57caa3),LL(0x0ba059d8,0xac53fe9d),LL(0x2d5104e5,0x417db31d)}},
+   {{LL(0x3cb774d3,0xb96ded44),LL(0x4efd48cb,0xfa239311),LL(0x929c61c0,0x56fcd1fb),LL(0x777cd8d0,0xb26d7077)}, {LL(0xf3b23f0e,0xd4b3d88f),LL(0xc5b5601c,0xda981ab5),LL(0x7e6ebe0f,0xcfcbd74d),LL(0xb2293d46,0x1492deb1)}},
+   {{LL(0x985b3451,0x58073626),LL(0x22c94e35,0xfc95b827),LL(0x27395e42,0x59c0f6c3),LL(0x0943d33d,0x9df08ee6)}, {LL(0xe8a08922,0x448e23a0),LL(0x72281cde,0x7086aff3),LL(0xcdf01d2b,0x72d0e7c0),LL(0xe51b1b9a,0xb43c3a98)}},
+   {{LL(0xee7e312c,0xef4e9549),LL(0xba2b211c,0x1c1a4c83),LL(0xf71ff858,0x8171fa17),LL(0x276b1681,0x34bcaf4c)}, {LL(0xa67f5718,0x25917289),LL(0x823a71ca,0xd3346c72),LL(0x0669a9de,0x52ab957b),LL(0xf75e8e8a,0xc5369c47)}},
+   {{LL(0x53d02dec,0x106ca521),LL(0x981875aa,0xcc64e77f),LL(0xa7dd017f,0x9eebc562),LL(0xe6b5a1b0,0x4995637f)}, {LL(0x0a4ca9cd,0xb9443e49),LL(0x17946d86,0x0c2cb41c),LL(0x29c7ecd1,0xd5c01d64),LL(0x02f0168c,0x9b983170)}},
+   {{LL(0xe819af44,0x3b8adc78),LL(0x5768b40d,0xb011ee8c),LL(0xc17aa477,0xaf6b5b7e),LL(0x399cec9a,0xb7b81c0b)}, {LL(0x4e6d778b,0xcd4613c1),LL(0xde8944ec,0x02f2be5a),LL(0x1946764d,0x88173973),LL(0x666629a1,0x076d664f)}},
+   {{LL(0x362051df,0x3fec6c68),LL(0x459344fc,0xa47f4d3c),LL(0x4600aeae,0x2b2dce3d),LL(0x52b87527,0xb011fb67)}, {LL(0x038a287c,0x32935ec3),LL(0xb04b4e6e,0x3a4d78bd),LL(0xcf457bd2,0xea091ade),LL(0x400262a9,0xc1c5eaf4)}},
+   {{LL(0x2508a829,0x090b0e7f),LL(0xc7e6c921,0xdd9e97dd),LL(0xec580b93,0xede91767),LL(0x078497b4,0x5707ead3)}, {LL(0x8630a55d,0xfb0bf5a7),LL(0xeb8a2f44,0x76d93e86),LL(0x4e59a8e8,0x82670c97),LL(0x3fb2c2d8,0xa3d2cca5)}},
+   {{LL(0xaad33d37,0xd425e60c),LL(0x5a545f6b,0x34bfa0cb),LL(0xe6535512,0x70a943bd),LL(0x21121f6d,0x18952c76)}, {LL(0xee465696,0xe6682a52),LL(0xe0eb00bd,0x8d0360c8),LL(0x4a5941a8,0x63f1453c),LL(0x4af638fd,0x01e29963)}},
+   {{LL(0xefe85789,0x1048931e),LL(0x157af429,0x23ccded6),LL(0x3f300f4d,0xa982a568),LL(0x3f700a62,0x8100e468)}, {LL(0x51835bfc,0x2725d7f9),LL(0x23a4020d,0xcd8d4e46),LL(0xe61118cb,0x51110d60),LL(0xb8437d9f,0xa3493f04)}},
+   {{LL(0xfac40985,0x9fbbea04),LL(0x3027c14f,0xb3358457),LL(0xfbd4b11f,0xab742abd),LL(0x2970cf1b,0xb8fed4f3)}, {LL(0x6687230d,0x9590d0af),LL(0xc48cf458,0xf9c1f6e2),LL(0x7fa08521,0x1c33d03d),LL(0xbe898655,0xfee123ce)}},
+   {{LL(0xf1314f5b,0xf776cf2f),LL(0xf0f9c3d2,0xd6d216f4),LL(0x906b02ef,0xbe11228a),LL(0xd7b87ecc,0x7624a2f4)}, {LL(0x9087cafe,0xa782f223),LL(0x163f2035,0x920e7685),LL(0xa73b80b6,0xa0d8909b),LL(0x27cc507e,0x0eeae66b)}},
+   {{LL(0x5dce9965,0x53d8e1be),LL(0xdbd38fcf,0xdb50b654),LL(0x49fc2935,0x8b202385),LL(0x377cbd77,0x084eba46)}, {LL(0x8e09632d,0x8454f7a6),LL(0xe5758347,0x80f3a428),LL(0xa9cbfcb7,0x4bb18f87),LL(0xca7c980e,0xedf2ffdc)}},
+   {{LL(0x3e261922,0x1cf053ae),LL(0xa63912aa,0xf0888442),LL(0x3cb24eb7,0x1aaa3512),LL(0x7b81e98e,0xb5dfa074)}, {LL(0x661a4545,0x141879a1),LL(0x99a8c2c1,0x6653c4c6),LL(0xc5d505d3,0xc22d6310),LL(0xc5f0c78c,0x9d638f75)}},
+   {{LL(0x469f5e6d,0x7273161a),LL(0x570c72d9,0x33eb4a18),LL(0x6abee3c6,0xe12a683f),LL(0x9cc81b72,0xf2a9e173)}, {LL(0xf3d853f7,0x802a0bfd),LL(0x10a738e9,0x29992d92),LL(0xbecedafc,0x1c0f3652),LL(0x4db73f9e,0x1082c50a)}},
+   {{LL(0x12a0a4be,0x9e11cf40),LL(0x5afe9e96,0x909fd82f),LL(0xa6a969c8,0x856584e7),LL(0x99d7330a,0x2b6da49f)}, {LL(0xe280a3b9,0x72b1cf8b),LL(0x1937b6a5,0x246de8f1),LL(0x8cfb96f9,0xb00e2780),LL(0xfd77a783,0xeade29b3)}},
+   {{LL(0x7da1d450,0x958562ef),LL(0x22de90d0,0x3169fcfd),LL(0x77ec2951,0xa1e3434c),LL(0xe1bd8d64,0xf39a9a6b)}, {LL(0xe04f79b5,0xc920cb6a),LL(0x60ff8edf,0x762e6fb9),LL(0x929a95a7,0x83dc8bfe),LL(0x36b6ce1e,0x49b513da)}},
+   {{LL(0xf3d2765e,0xe4816577),LL(0xaf856c63,0x1312a886),LL(0x8bcfcf5d,0x4f7a5366),LL(0xd2f03842,0x91ad62c6)}, {LL(0xdbd71f84,0x22cda102),LL(0x6627a00b,0x71789e32),LL(0xd2410e8b,0xb54d6740),LL(0x98ed4727,0x8d3694e1)}},
+   {{LL(0xcd99c665,0xe2d6c0f6),LL(0x699f74c7,0xd17588c5),LL(0xd5d46fb5,0x8c9782c9),LL(0x6c267548,0x354ac9f8)}, {LL(0xea7130ab,0x8c63b1cd),LL(0x4cf6b548,0x576ba221),LL(0xd5468eec,0x9c955edc),LL(0xb4a14725,0x919cf507)}},
+   {{LL(0x8002d36a,0xf247bd8d),LL(0x02b47ddd,0xc83b60c9),LL(0xfff501b1,0x4f129515),LL(0xd64e71b7,0xa63e3a98)}, {LL(0x55a58715,0xb5751e37),LL(0x55a4f821,0x7ddfb4ec),LL(0xe14de186,0xd3a8f95c),LL(0x2937edde,0x85378d49)}},
+   {{LL(0xb8a345ac,0x1920558f),LL(0x2c1dbb9d,0x54694f51),LL(0x3d0a5a7b,0x18c9c4d3),LL(0xbf750f4b,0xa1fdbdf4)}, {LL(0xc21a6881,0xd5bd6686),LL(0xf3993386,0xb7b0a8d9),LL(0x97190f76,0xd6e893db),LL(0x45616120,0x4eb35724)}},
+   {{LL(0x26ad9a82,0x895b00f6),LL(0x971d0ca1,0xa58149dc),LL(0xb6679d74,0xc63a05cd),LL(0x8055c6a5,0x60f5254f)}, {LL(0xb29145fd,0xada91593),LL(0x2f262a34,0xb3a9177c),LL(0x9891ca6a,0x57820548),LL(0x7bff5685,0x8ae54528)}},
+   {{LL(0xc5688a3b,0x4fb44e1d),LL(0x3710d1d6,0x4218b8d6),LL(0x1369fbd0,0x5dac6bdb),LL(0x44c2e266,0xc7beebf0)}, {LL(0xcba2d1a9,0x0689d915),LL(0xcf1bbb05,0x4cc337bc),LL(0x0bab5543,0x5210b5b9),LL(0xa9853130,0x016182ea)}},
+   {{LL(0x5144bc42,0xe8dc851b),LL(0x7b93055d,0x3018f623),LL(0x578becbf,0x7edbb8c1),LL(0xe2a7675f,0xf8f60fc9)}, {LL(0x94c92d2d,0x134881aa),LL(0x9247f4b2,0xa63bd2f3),LL(0xbf3b0367,0x4c6d9ebe),LL(0x047ad9ad,0x888d6d53)}},
+   {{LL(0x44585129,0xb9418a31),LL(0x44cb598d,0x1323c7d5),LL(0xb70a073a,0xc8fc3c4d),LL(0xbb93f56c,0x9c4ca7d3)}, {LL(0xabc63c83,0xe7cbe861),LL(0x0d0a169e,0x818fe43f),LL(0xc09a418c,0xe94df57d),LL(0xf676897a,0xa008a9b1)}},
+   {{LL(0xae8966fc,0x99ba9f51),LL(0x471e30ba,0x55b12caf),LL(0xbfafd498,0xb1bd6fde),LL(0xe9aa9838,0xeae761ac)}, {LL(0x50c071e7,0x75d3c156),LL(0xe8c0037b,0x85880a03),LL(0x9853ff7e,0x5d7e8ead),LL(0x2983d1c7,0x85b204bf)}},
+   {{LL(0x83d72e57,0x227db8d6),LL(0xfdb61456,0x7e7a8220),LL(0x8004cf1a,0xbddbc901),LL(0x958b9930,0x478b4395)}, {LL(0x58043933,0x86449b83),LL(0x7bd6ba5b,0x01dd912b),LL(0x89e2e066,0xdda1a9ad),LL(0x6309ded8,0x879256ba)}},
+   {{LL(0x8c8552c8,0xdeba90d0),LL(0xaad71cb4,0x7b032e4c),LL(0xf082a99c,0x5bb578be),LL(0xab33998c,0xb57b228a)}, {LL(0xd015435e,0x9d2eae78),LL(0x8e3b9525,0xa0d063d9),LL(0xffdbe1ba,0x1f9a2028),LL(0x60631591,0x0530a2da)}},
+   {{LL(0x935fa41b,0x346428a4),LL(0xf8aec139,0xc018ca23),LL(0x8be1be1f,0x93a6f894),LL(0x713c9374,0xbba1d4be)}, {LL(0x29775feb,0xe8dfed99),LL(0xea7a5f66,0x1420d105),LL(0x94ce6e57,0x7aaf838a),LL(0x31bae62c,0x36bc1745)}},
+   {{LL(0x0902acfb,0x135f2c6a),LL(0xc8f8b720,0x3f58bbf5),LL(0x7b24b523,0x9cf3b670),LL(0x2cfb9d31,0x41aaae1f)}, {LL(0x691437f3,0xf056397f),LL(0x0dbc8d53,0xa2d10c2f),LL(0xe67d3b9e,0x4e65badf),LL(0xd0f3b235,0x35e5daab)}},
+   {{LL(0xfd8cf584,0xbc72271f),LL(0x43242c5a,0x9239f174),LL(0x12a40272,0x34531164),LL(0xc9e761d2,0x94d966a6)}, {LL(0xdd67b047,0xbe3e6ac1),LL(0xe1efc076,0x0bb38e73),LL(0xb3048c28,0x10bf089c),LL(0xe443b993,0x4b0a6f51)}},
+   {{LL(0xdee28047,0x3e16ebf9),LL(0x3052ad0a,0x16ec4a23),LL(0xb1bf930b,0x3998effb),LL(0x03ebfdaa,0xb4114afd)}, {LL(0x1396395d,0xb4c78011),LL(0x089df702,0xba92fc4f),LL(0x1291f995,0xb930554f),LL(0x83051bb8,0x9f94cba0)}},
+   {{LL(0x96fd9f4b,0x0b1573be),LL(0x66a9d440,0x6a12d630),LL(0x5d85253d,0xc196f2e3),LL(0xf54c7e5c,0x462984eb)}, {LL(0x1d537418,0x035ac614),LL(0xc1c6b59a,0x450380bd),LL(0x82379084,0x7dd661b3),LL(0xcd0c5a31,0x4eb1fa9e)}},
+   {{LL(0x4f3d0dce,0x85a3ba2d),LL(0x7776e63b,0x93f050a9),LL(0x6fad968e,0x70c4b7b7),LL(0x8fcbb3a8,0x62bd2f9d)}, {LL(0xa2d898bc,0xadb40a32),LL(0xbe38d65f,0xd2771f28),LL(0x6da63955,0x76044a0a),LL(0xf1e95f6f,0xd6a0ead8)}},
+   {{LL(0xb99f96a1,0xdb496201),LL(0x85301b9d,0xd3254945),LL(0xd77759f9,0x09912611),LL(0x0a78b426,0x18d84a4e)}, {LL(0x59412e82,0xc9f3f40c),LL(0xa004dbb4,0x711dea6f),LL(0x4eb119b8,0x47902c02),LL(0x91f009b2,0xf572e2fc)}},
+   {{LL(0x558e4d2f,0x91595d69),LL(0x52c290a4,0x8084c51d),LL(0x992a121c,0x8a50c301),LL(0xcb3741fb,0x94bb024f)}, {LL(0xb2a7c77a,0x0a394617),LL(0xc22f42b5,0x8150a4bf),LL(0x0579b33e,0x995dea1e),LL(0xb160a048,0x6d0486c0)}},
+   {{LL(0xcd13cf78,0x6a43358d),LL(0xc239ddd9,0xca0f888b),LL(0xfa0b00ee,0x3a7d6291),LL(0xbc7d9ff1,0xb1ce7548)}, {LL(0xf2a721d5,0xa53e4309),LL(0x8f9cdc30,0xc7db97b5),LL(0xc41f17dc,0xaace5a7e),LL(0xf88931d1,0xf1512053)}},
+   {{LL(0x878c3257,0x42f59675),LL(0xefa9ea48,0x89b85130),LL(0x9c0a3c9f,0x46d6a4c2),LL(0x2b79ba9c,0x8b644b16)}, {LL(0x5dd38db5,0x04efc273),LL(0xb1517018,0x3eb13d54),LL(0xa1eadf80,0x77a2cd3a),LL(0x719046b6,0x3e13c900)}},
+   {{LL(0x27bd7f11,0x2c441420),LL(0xfb60b0c4,0x6a81357f),LL(0x435c0494,0x9aec5c76),LL(0x6c5a26e0,0x81de8d9b)}, {LL(0xc0994fd6,0x4ee94721),LL(0x34a8f772,0x0a064d08),LL(0xd0d19c37,0xce0a4697),LL(0x17fee1a0,0x17e69edf)}},
+},
+/* digit=18 base_pwr=2^126 */
+{
+   {{LL(0x0d97e720,0x607d9ff5),LL(0xd58ded63,0xb2f45187),LL(0xcebddda5,0xc3c9a473),LL(0x9f2a826a,0x158c5ffa)}, {LL(0xc9926a4c,0xb013c632),LL(0xfd9cdcdf,0xb77ff183),LL(0x60f2a870,0x10522cf9),LL(0x8b785dd2,0xec9cb27b)}},
+   {{LL(0x093e7b88,0xb61c560c),LL(0x7836b6af,0x1a071d2c),LL(0x8744e2ba,0xefff0cb7),LL(0x1d98c1b4,0x64e68241)}, {LL(0x255b2058,0xcd6960eb),LL(0x4fbea5d6,0x49ab8da4),LL(0x3be9fc79,0x187e1063),LL(0x608c2ed2,0x8a1b1e05)}},
+   {{LL(0xd37a3508,0xcec02d4a),LL(0x74c5ba0a,0x4c782e5b),LL(0x7791431a,0xb8af8ee5),LL(0xb026ec5d,0x1ce27b63)}, {LL(0x3700700b,0x555b20ca),LL(0xedc5d245,0xcba9b26a),LL(0xb6c8475f,0x0b7b9673),LL(0xac0e1f8d,0x42c8378b)}},
+   {{LL(0x3b9955d0,0x0f9d275d),LL(0x1c8821fb,0xf1d4a4e1),LL(0x772fff7d,0xa68b3db0),LL(0x4ad0157e,0x44e88d51)}, {LL(0xb2cd6a45,0x30215fb5),LL(0xcc8b83a3,0xbe06c395),LL(0x278783b8,0x65939879),LL(0xcfdf1c78,0xa2afb709)}},
+   {{LL(0xef8f2608,0xa606b1b4),LL(0x692748ab,0xe93edcfa),LL(0x11c00a1a,0xc491f379),LL(0x5910ff12,0xda223710)}, {LL(0xa48ef0c7,0x01b8301c),LL(0x6a66075a,0x6aaaba95),LL(0xf41968df,0xd957fd31),LL(0x810f7e12,0x3beff2a5)}},
+   {{LL(0x0166a9b6,0xc0fffab6),LL(0x0001efd3,0x0fcff3bb),LL(0x3ca7dd76,0x71754cc5),LL(0x193004f7,0x4be75141)}, {LL(0xe85b5e6e,0xc5a167eb),LL(0xf6f2cf6d,0xcb58bb11),LL(0x5d66b373,0xbd5607d4),LL(0xb66756db,0xe851bf33)}},
+   {{LL(0x051eba5b,0xb68407b9),LL(0x4d671441,0xcffb2fb7),LL(0xbc3f53a3,0xbc2f0b8b),LL(0x9ef353fd,0xc981e9e3)}, {LL(0x6b6c488e,0xd572412e),LL(0x12fdbe81,0x82d6d4b1),LL(0xb7107cae,0x520bee11),LL(0x5e15ad7f,0xfdb116d3)}},
+   {{LL(0x9f786bba,0x59e0e25e),LL(0xf569f776,0x84ccee5e),LL(0xc65e8e91,0xdb3cfdd8),LL(0x204b9083,0x6e8356b1)}, {LL(0x1d352666,0x542586a5),LL(0x1efe1b23,0x85dffa61),LL(0x08e848ae,0x55cb76cd),LL(0x8cdf60c7,0xc0a2e345)}},
+   {{LL(0x8a81f432,0xd7661b9d),LL(0x2d3b9761,0xd61d15d9),LL(0x964c0d6f,0xd86f762a),LL(0x8654db4d,0x92265bf1)}, {LL(0x8f2ec7f3,0x32a7aea7),LL(0x2adde2ca,0x42807b6a),LL(0x75fee69d,0xfbbc49ce),LL(0x04ac0522,0xb9a0c8fc)}},
+   {{LL(0x18d2673d,0x9381f3f9),LL(0xe66cbd3b,0x9d68f490),LL(0x23aa62a9,0x5398369f),LL(0xddc89f47,0xfe633979)}, {LL(0x23715956,0x7b0a0db0),LL(0xbdbd7f59,0x54490644),LL(0x70fd4892,0x54fae599),LL(0x58d70625,0xf4143690)}},
+   {{LL(0x71b71d0b,0x24f6f72c),LL(0x5c005e63,0xff5b4e7a),LL(0xa4c883e8,0xba780463),LL(0x4cd4b20a,0x80a5df74)}, {LL(0x6d7c343f,0x60e8ce25),LL(0x2f747183,0xf91858dd),LL(0xeebac0dc,0xb9ac44ff),LL(0xcf3c18a4,0xc7ef09b6)}},
+   {{LL(0xd60ac5ee,0x03b3ed03),LL(0x774f226b,0xd7ff1d19),LL(0x974fce02,0xf3023f78),LL(0x4d58863a,0xbc7a21f1)}, {LL(0xafa49904,0x11f20287),LL(0xcb652fc9,0x38eeb5ca),LL(0x60968927,0x36f83dba),LL(0xb1f816e3,0xa277fb42)}},
+   {{LL(0x24c4aafb,0x33fe6abd),LL(0xf849d34c,0x351783c5),LL(0xa83b8877,0xb05861e7),LL(0x165facf7,0x08070a11)}, {LL(0xcbd621ce,0xc67659ee),LL(0xdb33d024,0xbd1cb955),LL(0x7f89fc9d,0xf905262a),LL(0x6bf78f6a,0x74f0edfe)}},
+   {{LL(0x17d1cc17,0xb5699ed0),LL(0xc1956ae1,0x36e8d8fe),LL(0xb6862470,0x00c2e63b),LL(0x859fc5a1,0x91d67c91)}, {LL(0x73c01612,0x2edda122),LL(0x25ad6cad,0x4fc0c955),LL(0x6d49602a,0x86dc8d5e),LL(0x81bac523,0x3c655393)}},
+   {{LL(0x39474b06,0xaaac8d6b),LL(0x1d067375,0xa62ca86c),LL(0x3e2f1678,0x3461389b),LL(0x4e94d086,0xd1582637)}, {LL(0xb95e7d4f,0xf6639922),LL(0x98cd55fa,0x04944fda),LL(0xb80ca5d3,0x18c715ba),LL(0xa345b27f,0xd31a5c19)}},
+   {{LL(0x33fa7cc4,0x4ded7eea),LL(0x4878a57e,0x46d34338),LL(0x3ca03752,0x3886e71d),LL(0xfb64fd08,0x89b88f81)}, {LL(0xd01cfcc7,0x63b59d57),LL(0x92395b98,0x59b5489f),LL(0x85f9b49c,0xfac77233),LL(0x5278f731,0xfafc41aa)}},
+   {{LL(0x00388e4b,0xb313cb90),LL(0x861f72d8,0xb29287e3),LL(0x2c3b8ac6,0x43de376c),LL(0xa9bf75aa,0x21605fc3)}, {LL(0x276d462d,0x6a9cf92a),LL(0xb7299436,0x4462ca30),LL(0x92efbcbd,0xf6056144),LL(0x8faad78b,0x24b12a0e)}},
+   {{LL(0x95ee48b9,0x4f24944e),LL(0x8e7edbb5,0x52595cc8),LL(0x689c9dd3,0x7aacddba),LL(0x0c2a7b03,0x9241786f)}, {LL(0x81437bb9,0x519db770),LL(0x6d05b745,0xd2dc650c),LL(0xf4da9f84,0xc835e323),LL(0xadfda6e3,0x5022d761)}},
+   {{LL(0xdbc5ab6a,0xbf04e965),LL(0xdd44718a,0x2052d700),LL(0xb5df3a58,0x15382b85),LL(0xc5fbc78d,0xd327bd39)}, {LL(0xcca3308c,0x8e275e8a),LL(0xded5ccbd,0x41af59d8),LL(0x0a4bf5fb,0x0f9ee3ed),LL(0xdc23fcbf,0x9e6a23ea)}},
+   {{LL(0x586fdd0c,0xf15ee76e),LL(0xc3e7e467,0x0312aad9),LL(0xc8f701b0,0xade1974d),LL(0xed1cd6f5,0x0ed28eb1)}, {LL(0xae84c01d,0x38294a8e),LL(0xd18640de,0xf92455fe),LL(0x012248dd,0xbcbb94b2),LL(0x56144cf7,0x1501fcac)}},
+   {{LL(0xbfda902a,0xa26673ae),LL(0xb479ca91,0x43b1d30e),LL(0xdeef3d59,0x95274166),LL(0x5afd7e70,0x8c7562a8)}, {LL(0xad251a12,0x4777fe2c),LL(0x9e680be8,0x819bab8d),LL(0x78047d4b,0x66fa057e),LL(0x5a545dd4,0xc45b3436)}},
+   {{LL(0x2c9cfa6e,0x7fd549ad),LL(0x8b96315c,0xf10ec8ee),LL(0x856a4568,0x4d0ed63d),LL(0xd463a4a8,0xb4e24229)}, {LL(0x12e4588b,0x6c952e4f),LL(0x99012ba6,0xf1984048),LL(0xfbda3014,0x5da75f07),LL(0x7f285817,0x66999795)}},
+   {{LL(0x22b8cfe4,0x97287cab),LL(0xd8c692e8,0x61632d22),LL(0xa077209b,0x4f4f9155),LL(0x29e964a5,0x2f2f92ec)}, {LL(0x6fcea7cc,0x60420269),LL(0x6ac5c24d,0x199f9720),LL(0x4da4479c,0xaa3953ff),LL(0xccf8657e,0x67398b2a)}},
+   {{LL(0x0998809f,0x3b5f167b),LL(0x2a2f571d,0xc3e83943),LL(0xe7b0d324,0x8549ba82),LL(0x696a7f38,0x7b06a63a)}, {LL(0x35449b93,0xced578da),LL(0x3cc159fa,0x4ea9415e),LL(0x57b90f18,0xc3ddbda5),LL(0x8700badc,0x24fdf078)}},
+   {{LL(0x5d4c8c47,0x44cee732),LL(0xb17dd495,0xc0b239c6),LL(0xe1be0c32,0x6780bd62),LL(0x063bddf4,0x110a47a0)}, {LL(0x13a8d848,0xa90140d2),LL(0xde534654,0x1d68b5c6),LL(0x1512e64a,0xa2a1e5a3),LL(0xd3124922,0xad6a8d49)}},
+   {{LL(0x145a0527,0xf1fa8d0c),LL(0xfe9db0b7,0x0ccce1c8),LL(0x3fe7c4cc,0xe6c3cc0a),LL(0x2f738d79,0x76eae0d3)}, {LL(0xd0de0f71,0x0d782496),LL(0xfbcbd056,0xccc55f6a),LL(0x6a7f8864,0x17f5246c),LL(0x7cd24cd8,0xf9de64e6)}},
+   {{LL(0x4f9a3bdc,0x3ddcbb16),LL(0x8e0d99a1,0xfde3a0d4),LL(0xf6e5dcba,0x981e0fab),LL(0x61f79c51,0xc1064b73)}, {LL(0xa32b775a,0x0a869f83),LL(0x55a1577d,0x0cde66d2),LL(0xe3bb27af,0x504ce900),LL(0x85533de3,0xe4c9be11)}},
+   {{LL(0x6b36ad4f,0x2f290b5f),LL(0x5cb095e2,0xe6f76190),LL(0x3b554ff7,0x29395483),LL(0x99764874,0x85545940)}, {LL(0x7450a88f,0xff1214b8),LL(0x59e88b1a,0xbc9cb6de),LL(0x8bfdd7a8,0xa9e067ad),LL(0xb28f7d79,0x78aa457f)}},
+   {{LL(0x7bd85a60,0x16f0911d),LL(0xef261002,0x7707dd6f),LL(0xe1630afb,0xb01a4c0b),LL(0x19aeb27d,0xc0f30dcb)}, {LL(0xd84ba546,0xe88fcb43),LL(0x65fd1039,0x783d872e),LL(0x31f7eba1,0xfaa47e36),LL(0xed88d17b,0x8dda923a)}},
+   {{LL(0x33e35d28,0x4ec580d6),LL(0x15f993fa,0x265304ee),LL(0xf2ae9522,0x1bcab7b3),LL(0x2dbd0f8d,0x5052f343)}, {LL(0x4b76a2d7,0x56b810c7),LL(0xb9958dc4,0x155c75b9),LL(0x09744e94,0x57bf9cf8),LL(0x69d5f1de,0xa3966c31)}},
+   {{LL(0xf2dba508,0xc71337d7),LL(0x35e29729,0xf3576639),LL(0x185ebe81,0x8b9f962d),LL(0xb568d2bb,0x02d8e46f)}, {LL(0xcbd403ec,0x6f01d807),LL(0xa24ad755,0x1b69b3a1),LL(0x9590b131,0x25c39a78),LL(0x1aecd9d8,0x97fda837)}},
+   {{LL(0xd1b71f70,0xbca63e99),LL(0x45b80826,0xc32ead34),LL(0xf22ca374,0x40cdb35e),LL(0xe3eca583,0xf3345d52)}, {LL(0xeec9a46e,0xb7ac8953),LL(0xf9e6d29e,0xa53937d5),LL(0xe1f8a6fb,0x6f368183),LL(0x806a8abf,0x9d8c3243)}},
+   {{LL(0x976e8e2a,0xbc9d2ff1),LL(0x61412921,0x3f1368a7),LL(0x7f2804f6,0x2e1657f4),LL(0xe3ebdf3a,0x1b882e9e)}, {LL(0xa2e80317,0x608764d7),LL(0x0ad73663,0xb74ee179),LL(0xb0524495,0x1173d159),LL(0xb58b629d,0xc240c899)}},
+   {{LL(0xcedb87f6,0x8d9ffe66),LL(0x21798fcc,0x4524b666),LL(0x6fef806d,0x0664e176),LL(0x51eb4dad,0x4c761a8e)}, {LL(0x18172cf1,0xccc778ca),LL(0xf6dd2876,0x6613453b),LL(0x536d0fa0,0x8705c793),LL(0x51e37897,0x14e993fc)}},
+   {{LL(0xd5671d2b,0x4e184d72),LL(0x0b9e7bc7,0x79603b70),LL(0xdfdb38bd,0x8d5e2918),LL(0x244056f5,0x1ba618af)}, {LL(0x62b0a78c,0xcf12684a),LL(0x08faae3e,0x02414f76),LL(0x04460bb6,0xeb5e46b1),LL(0xa5421a1d,0x858bff26)}},
+   {{LL(0x58105d71,0x00e9d751),LL(0x3e96afb8,0xe344d48e),LL(0xc908733a,0x623e0712),LL(0x26d8fec7,0xaa6414f4)}, {LL(0x4cd83aed,0xfc579659),LL(0x14f9fefa,0x157c3675),LL(0x72010716,0xef328124),LL(0xf2d6917f,0x07462442)}},
+   {{LL(0x8b0a03e6,0xd597bb13),LL(0x4b1d0be6,0x98c27ea8),LL(0x81f4cc10,0x0661730b),LL(0x227c28ac,0xc5582e64)}, {LL(0xeda1dd8d,0x0e055f07),LL(0x111d2362,0x21971d4c),LL(0x4f5aed4f,0x96fb3bd8),LL(0x263d2ec0,0xd3a725a9)}},
+   {{LL(0x75805da7,0x924b92c5),LL(0x99ea0f23,0x2281b845),LL(0x0cc69407,0x9eb2d585),LL(0x73e37aa6,0x24d300f1)}, {LL(0x6096fc38,0xf9898f71),LL(0x5fe51085,0xbbbb9db9),LL(0x1b256f24,0x7d295c22),LL(0xa50ef0fd,0x57cfb147)}},
+   {{LL(0x5ce14729,0xb21b0324),LL(0xc09d3b12,0xea789b59),LL(0x42ac8d0d,0x85f31309),LL(0x2df1e859,0x2491f5a3)}, {LL(0x737a96d0,0x7c772436),LL(0x26fb9947,0xb0ed3793),LL(0x63ac41a3,0xda15ea52),LL(0x75083892,0x0e08e162)}},
+   {{LL(0xacebf496,0xaa14fb9b),LL(0xcbe699c0,0x58f2f880),LL(0x6bf89e82,0x105528cd),LL(0xd55b006f,0xda7b7322)}, {LL(0x82c3dacf,0xa3cef586),LL(0x70a1273d,0x2ff15456),LL(0x638a7b71,0x58cd4d4f),LL(0x6658d510,0xc4b57b87)}},
+   {{LL(0xab1dbe77,0x7882a41e),LL(0x414117ab,0x96d3bb50),LL(0xcd513682,0x2bd8d4d1),LL(0x5000f661,0xc8e9b040)}, {LL(0x31c0930c,0x29779d48),LL(0x896bdea5,0x0022cb33),LL(0x763c0ec1,0xd3d74b44),LL(0x7fd561cc,0x112cc5b7)}},
+   {{LL(0x59c2b833,0x1df79691),LL(0xd0ec1b55,0x01cebc67),LL(0x6f465506,0xf4633f2e),LL(0x6b1b6ad6,0xf47b7567)}, {LL(0xbad013dd,0xe2f176a5),LL(0x30e7c0fd,0x2c115d7f),LL(0x9e559d45,0x2eab75e3),LL(0x2300b4e7,0x1263f5c7)}},
+   {{LL(0x2cd146d6,0x4c924a09),LL(0xe5789c9a,0x9a1b257b),LL(0xd27abd78,0x8e40946e),LL(0x99234500,0x247ec25b)}, {LL(0xeb6988ad,0x9f06caf8),LL(0x0e149426,0x0b72b8e5),LL(0xa8f84597,0xf9adbf4c),LL(0x9b4f1aa4,0x64d27a37)}},
+   {{LL(0x46f5d5f2,0x82700fc7),LL(0x04989cd2,0x4b0e04c3),LL(0x6f5af46a,0xd639b521),LL(0x0fc2691f,0x44ea1ef2)}, {LL(0x0714f7f7,0xf13e00fd),LL(0x71d85df3,0x633c40d6),LL(0xdee21d7a,0x6f6f7238),LL(0x59028409,0x6290f02e)}},
+   {{LL(0x351f177d,0xfb6ddd0d),LL(0xdd1e174f,0x369eceaa),LL(0x6c843b5e,0x1bbc2a52),LL(0x92cae446,0x7d7e23cd)}, {LL(0x5a38b9e3,0xeba4e720),LL(0xb0d938c9,0x2f73cdc2),LL(0x7029bda1,0x305cd8e9),LL(0x3eadbe69,0xb89bcab8)}},
+   {{LL(0x12e03d9d,0x5dfd63f1),LL(0x011c3ede,0xc9a84c84),LL(0x80ae875c,0xc005ca24),LL(0x81accbc8,0xec0795be)}, {LL(0x647c9164,0x178b2555),LL(0xb08837ac,0x2f734e34),LL(0xa7f59230,0xbe526d36),LL(0x36b1b439,0x04bcbd1a)}},
+   {{LL(0xbfed8b76,0x9facd8e4),LL(0x3effb9c0,0x00a38fd4),LL(0xfbb82766,0xbdd58ae0),LL(0xca299e52,0x40c83bce)}, {LL(0x3a3fa244,0x97ca5552),LL(0x0c7a3805,0x1ed80666),LL(0xc2e9f136,0x36d4b48a),LL(0x0d622caf,0x61546b7c)}},
+   {{LL(0x949a818a,0x7a082dab),LL(0xdf117a78,0xabeae732),LL(0x125cf9d5,0xaad6b6a4),LL(0x64782727,0x6f2239aa)}, {LL(0x085f79e7,0x713d2218),LL(0xac131fac,0xd41f57ff),LL(0xb3ae0e8a,0x284f357a),LL(0x38dcc8d4,0xc0d1edaf)}},
+   {{LL(0xa9464019,0x3c6bc82e),LL(0x530a5e90,0xd7dd84ef),LL(0xd5599222,0xa5e66bf8),LL(0x6ac95397,0x4e72af2d)}, {LL(0x5fc24563,0x9f1a07ea),LL(0x5b880422,0xa141f22f),LL(0x89f7410b,0xd73aeac9),LL(0x6e42db0d,0x6338ed46)}},
+   {{LL(0xec98d287,0x04b133e3),LL(0xc577e4ee,0xcc241a9a),LL(0x93061899,0x2dbbe42f),LL(0xbc11cc13,0x0a0e4ed7)}, {LL(0xc5caddc4,0xb071b323),LL(0x7871a7e0,0x0e3957b9),LL(0x98081396,0xe7103262),LL(0x66a7f57c,0x7c8f8f95)}},
+   {{LL(0x8826d365,0x1610e739),LL(0xfb6db009,0xa213fbce),LL(0x5ce89c06,0x95c5fcf4),LL(0xbebd98dc,0xab52bddb)}, {LL(0x766db9ea,0xbc44b8f1),LL(0x88b05089,0x9967dd54),LL(0x67f5e8f3,0xc93c634a),LL(0x142a8feb,0xa694031d)}},
+   {{LL(0xb2e7248f,0xa8eebd56),LL(0x3c58b696,0xcd19c75b),LL(0x4547a82e,0x07e73d52),LL(0x88fb8706,0xd0712572)}, {LL(0x31ea9870,0x40cdc6df),LL(0x162e376a,0x495d9a1f),LL(0x887ac539,0x8949aa22),LL(0x9bc583d6,0x29df13d5)}},
+   {{LL(0x2b42aa7e,0x3a3e6eb1),LL(0x7b1c195d,0xa01f5a2a),LL(0xcb2c11a6,0xd3d74682),LL(0x81ad6533,0x836b7d64)}, {LL(0xa46779af,0x8e1bdbf4),LL(0x3f7b598e,0xcd49a654),LL(0x366bfaf5,0x68b2f071),LL(0xe721dd42,0xed690044)}},
+   {{LL(0x6ea4f73d,0x336ae4a5),LL(0xf8a7879f,0x82dfe663),LL(0x36731ad4,0xb2124285),LL(0x33c3a9c6,0x43c22a6c)}, {LL(0x92099706,0xafc1079e),LL(0xe16b6284,0xf9a79e36),LL(0x7622d5ae,0x60d5cb84),LL(0x0cc8ff1b,0x59bf1054)}},
+   {{LL(0x0007fdec,0xabfc3ecf),LL(0x2940eb14,0x50d5d9d1),LL(0x363fe556,0xaa0fc194),LL(0x3e8136ad,0xdff8537e)}, {LL(0xd4758d1d,0x67cc7eb8),LL(0x3933ed53,0xa92e25b7),LL(0xb8e43f55,0x5abe73e9),LL(0x56aca77d,0x4053a594)}},
+   {{LL(0x68ca18ef,0xae79957a),LL(0x9ab6c63e,0x6de02525),LL(0xb420e61d,0xda98b352),LL(0xa1886a2b,0x1ce29a57)}, {LL(0x298eb07a,0x770ac62b),LL(0xbe0e4efe,0x77240b6c),LL(0xce345bd8,0x014fc42d),LL(0x5a088737,0xbbfadb41)}},
+   {{LL(0xc58f70e6,0x6ccead4f),LL(0x33f961cb,0xcffb8463),LL(0x10592c72,0x00f9e97c),LL(0x4ee13791,0x26e172f9)}, {LL(0x76be4aee,0xc0aaeb24),LL(0x6d4733a5,0x60639b8d),LL(0xe9824c63,0x4385253d),LL(0x5a6ec4be,0x1a1a6fa8)}},
+   {{LL(0xf240dee0,0x192d1756),LL(0x72b79881,0x2025b7d4),LL(0x2b72581c,0xc78d1510),LL(0x6ce04b1e,0xad215fb2)}, {LL(0x51825094,0xf6d9d268),LL(0x1396e3fb,0xd311318c),LL(0xe7569442,0x2e0ac139),LL(0x1625ab82,0x87a2ce43)}},
+   {{LL(0xef57556a,0xb80a6611),LL(0x71cc9c55,0x07f0854a),LL(0x18f3c17f,0xd389f266),LL(0x27d60ce4,0x505f0c2e)}, {LL(0xd47f313f,0xb22cba09),LL(0xb54567f0,0xafafd0e5),LL(0xdf6b19e2,0x5ef24ccf),LL(0xc1ed7af2,0x1bdfecf8)}},
+   {{LL(0x9292a792,0x3b282d57),LL(0xc6eb072b,0x1f707c79),LL(0x9c377f4b,0xd003564d),LL(0x0d238b8c,0x5c24640f)}, {LL(0xc761f342,0x5d6b2907),LL(0xc9410e62,0x3d2ca5e5),LL(0x828d9724,0xd6460004),LL(0xc6bd3f16,0x5f4534a9)}},
+   {{LL(0xfcdd30f3,0xb1034130),LL(0x6fdff0ad,0x5d58fb37),LL(0x1802ad1c,0x38db7075),LL(0x77ebecd1,0xf623e469)}, {LL(0x34d6498b,0x8137121b),LL(0x1d23e12c,0x7308ce7a),LL(0x9ff4b2ea,0x0ae3a098),LL(0x7e4031c1,0x2ad516f6)}},
+   {{LL(0x2e589320,0x9a5420e1),LL(0x5e25e259,0x65eeb509),LL(0x6a3b5957,0x9b2a7963),LL(0xdd1b076e,0x7a4526b2)}, {LL(0xe21e1f1c,0x97c50f3f),LL(0x96333bbd,0xac57b9aa),LL(0xdde450d5,0x6a758bc8),LL(0x503caafe,0xb40dc871)}},
+   {{LL(0xd708d79f,0xdc222142),LL(0x410b01f5,0x6e865d9e),LL(0xc2770d9c,0xc1c852a7),LL(0xe911ac74,0x712632d6)}, {LL(0x14c4ab3d,0x62b6c88d),LL(0x0a39eb27,0x8301eea9),LL(0x5d3979bd,0xf79d280a),LL(0xa654a36c,0x19aa8dff)}},
+   {{LL(0x1033b53c,0x8143df73),LL(0x66e26976,0x68a707c0),LL(0x9f632135,0x6137bbb3),LL(0x53d7671d,0x3dd0766c)}, {LL(0x1ae41b8a,0x5911dd90),LL(0xd36dda61,0xf03b9577),LL(0x8124e895,0x54b05a75),LL(0x77ae9102,0xca3d0293)}},
+},
+/* digit=19 base_pwr=2^133 */
+{
+   {{LL(0x31374f15,0x7ebb859b),LL(0xef252dad,0xa0c99e14),LL(0x67ece5e9,0x1e7986cf),LL(0x91977b66,0x5da0ead5)}, {LL(0x09327227,0xa649c744),LL(0x54749258,0x872a712d),LL(0x3200c5f4,0x726afe79),LL(0xafc17f8c,0x0e2bb0c1)}},
+   {{LL(0xa7c105f2,0x9cd93b4f),LL(0xda99164a,0x3f726d9d),LL(0xbf4a949c,0xc712c46b),LL(0xc37256b6,0xe59e6eac)}, {LL(0x690f6301,0x15cd9bb1),LL(0x12731855,0x4651e3ee),LL(0xafef0287,0x1b89ff18),LL(0x8cf8ef33,0x828f05f3)}},
+   {{LL(0xd6a50dfd,0x99581231),LL(0xe0417fb3,0x04685a7c),LL(0x208b5fe3,0xa008475d),LL(0x6410c058,0x2c4c429b)}, {LL(0x310092c3,0x79e4fd13),LL(0x6d1a521e,0x7427d01f),LL(0x3df97d1a,0x147eccdc),LL(0x83dfbd77,0x47855f01)}},
+   {{LL(0x33a02c72,0xe94fe042),LL(0x8fae1141,0xdae4fcc2),LL(0x3f2e6273,0xe72a038a),LL(0x6a25d515,0x9a1ce36d)}, {LL(0xfd073863,0x8153e8a1),LL(0x5172d501,0xf2211bd2),LL(0xc53b5a95,0xc124656a),LL(0x36f92d75,0xc8053ff7)}},
+   {{LL(0x5cb0881c,0x33355d5a),LL(0xd5273f5a,0x5fc4d9d6),LL(0x2d9b2d7c,0xc453efa6),LL(0x31188a46,0xcdb8ebf2)}, {LL(0xe5518189,0x6a704b59),LL(0x063e64cc,0x429234b8),LL(0x14ef1233,0x40cffa7b),LL(0x690fdb56,0x0aa0f353)}},
+   {{LL(0xa7aeff39,0xd942b5c3),LL(0x468e22d2,0xbffa3ee2),LL(0x0ddcc978,0xf4775f87),LL(0x8f0844a9,0x96e78a1d)}, {LL(0xad39cf64,0x612366d2),LL(0xec0b0759,0xdb6c2d0e),LL(0x0cdb5a23,0x0e1bf681),LL(0xc8f61745,0x7f66d1d9)}},
+   {{LL(0x341e8e52,0x7c9a86ef),LL(0xc6c0c9f4,0x699c4bad),LL(0x5891e000,0x4c05825e),LL(0x964c8893,0x58018554)}, {LL(0x851ab0dd,0x7de94fef),LL(0xb95cc821,0x6a7d4201),LL(0xd78e9023,0x4049097d),LL(0x1ae13d00,0x643d2c22)}},
+   {{LL(0xf02f3c7f,0x627d47f0),LL(0xde1836bd,0x90ef4f98),LL(0x037ab96c,0xbc213bc1),LL(0x081136bb,0x68a85d1c)}, {LL(0xb2416e55,0x118d9406),LL(0x9cc314d0,0xa141225e),LL(0x7b11b196,0x789a1ba1),LL(0x7e118e33,0x913dc084)}},
+   {{LL(0x86f40cf7,0x8f9b40bc),LL(0xd7db7e47,0xe231f3d1),LL(0xe20b4aab,0x3a410ad7),LL(0x4eed5f0b,0x8a2113eb)}, {LL(0x5d6fa5c4,0x7143c79b),LL(0x290bc8e8,0x03e78200),LL(0x6df74fba,0x3adcfc9a),LL(0x8133d568,0xb6097d34)}},
+   {{LL(0x31869498,0xc9cefd0f),LL(0x2fd095f2,0x85947e8a),LL(0x1504797d,0x1ddd6648),LL(0x9716a8bb,0xa95da092)}, {LL(0x12d84053,0x95aa6936),LL(0xc55e67eb,0x72fc12d1),LL(0x06ef4be3,0x749b8b10),LL(0x34f456a5,0xc38e420f)}},
+   {{LL(0xae160a19,0x2cc69569),LL(0x36d55038,0x74fbdbdb),LL(0x947485dd,0x6980abce),LL(0x47512487,0xb7735320)}, {LL(0x6fea675e,0xc3bd644b),LL(0x5c737e8a,0x609e1bc4),LL(0x798d8ade,0x0f57a1ae),LL(0xddefb8fe,0x23cbec25)}},
+   {{LL(0x0cc4712b,0x4217f375),LL(0x0f291446,0xa9c00e7c),LL(0x3d3a4a1d,0xdfd1306b),LL(0x98125cd2,0x00ed920b)}, {LL(0xeee4a43c,0x63a9ef01),LL(0x6f9e4a3d,0x9a7dc255),LL(0xc4d5c72f,0x8bce3406),LL(0x8f96ed35,0xe3d75cb8)}},
+   {{LL(0x7498a122,0x09d4e31c),LL(0xef84741b,0x09eaddc6),LL(0x9db5cb88,0xa1326dcc),LL(0x8c9f83ad,0x4e117a92)}, {LL(0x339efd4a,0x1218d0c3),LL(0xf439c2c2,0x713cb3a5),LL(0xf4be09b0,0x47c3d5a0),LL(0xb22d4b13,0xb1e447f6)}},
+   {{LL(0x9390f446,0x61a676e8),LL(0x4b665b99,0xf27f8468),LL(0xcb425070,0xde0f2d69),LL(0xb1b44cc8,0xc06c4d0e)}, {LL(0xb238f095,0x8d1e7057),LL(0x346e39e8,0x3a594514),LL(0xc7769111,0xaab63eb8),LL(0x1f14e661,0x0ec890fd)}},
+   {{LL(0xf086654d,0x90facfe7),LL(0x41c8c571,0xde0934d2),LL(0xb1500664,0x039e652f),LL(0x1cfe032e,0xef178aa7)}, {LL(0x2de93f4b,0xc9384203),LL(0x56ba84eb,0x5ef322b0),LL(0x6f5293e4,0xbbd44ddc),LL(0xcaa174df,0x2602db67)}},
+   {{LL(0x1fc992a2,0x72b4f821),LL(0xa6b4a84a,0x978e8dff),LL(0x6c376e65,0x5675e4b4),LL(0x12adfa1c,0xea7ecdd9)}, {LL(0x015c63ca,0x2716fbfa),LL(0xffc2525d,0x5cf2d9d8),LL(0x65982e03,0x0486116b),LL(0xa4391e19,0xb1efea6e)}},
+   {{LL(0x69efc6b4,0x28597561),LL(0xb852556e,0x80e99908),LL(0x94ae6d46,0x5eefe55a),LL(0x2e3a3198,0x12b26045)}, {LL(0xefb08a09,0x4058ae83),LL(0x132b1478,0x98b02e95),LL(0xe12a464f,0xc8d839e1),LL(0x5005cd7b,0x74ead159)}},
+   {{LL(0xf1e44be9,0x8c69c9e1),LL(0xa9f52f3b,0x7f26c90a),LL(0xece64370,0x69176c00),LL(0x509ee6ff,0x503c8d3a)}, {LL(0x13b04f02,0xa09be19e),LL(0x643caed3,0x99c9adfe),LL(0x1f7d56d1,0xf56cace3),LL(0x7208b2d2,0x3bd8f8ce)}},
+   {{LL(0xe3dc11c3,0x7e060458),LL(0x3cee9fd9,0x4bf3ee1f),LL(0xb13f6955,0x311d36c9),LL(0x949a2270,0xe0540057)}, {LL(0xeb0e86f0,0x81715d89),LL(0x684f12d2,0x4d9247bd),LL(0x1f4e65f3,0x5ab67e28),LL(0x49c084aa,0x9a7511bc)}},
+   {{LL(0x885e5174,0x23c7c351),LL(0x740d99d2,0x98b58b9a),LL(0xd0f7cdac,0x06df81c3),LL(0xca5bce89,0x0f9b70a8)}, {LL(0x64b75e83,0xd56bb3fa),LL(0xaf35d072,0x93197268),LL(0x4fc0a41b,0x0b5b9234),LL(0xbdd3c4d0,0x62fcace3)}},
+   {{LL(0xf0586c2c,0x9d6452e4),LL(0x75ab88f2,0xeff7c53c),LL(0x55ac49f1,0x4dc93482),LL(0x6c9cc798,0x17d87bd6)}, {LL(0x098981f9,0x33ae28d5),LL(0x7701e52f,0x9d6a1b3f),LL(0x99eaa042,0x486c53d2),LL(0x03afc21f,0x98aa3f49)}},
+   {{LL(0x2e52b8d8,0xc8b72a65),LL(0x2aa5efac,0x09a85a1a),LL(0xe79274b1,0xeabfc647),LL(0x6bcf4da9,0x028bf090)}, {LL(0x13e3ea53,0xdcdec0f2),LL(0x8f439e63,0x2d3d7144),LL(0xd67a72e4,0x480760c1),LL(0x194045f7,0x067e368e)}},
+   {{LL(0x809c3830,0x78b5538c),LL(0x52092ff8,0xc8ac5719),LL(0x30aee850,0xf19a8e28),LL(0xf01f3bbe,0x0df7fea8)}, {LL(0x86fd67b2,0xd760b97b),LL(0xa6564bd2,0x206d69b7),LL(0x6d2a5400,0x2b892324),LL(0xcd7e3254,0x88871256)}},
+   {{LL(0x87732723,0x0cc50279),LL(0x558feefa,0xb9c6bb3e),LL(0xff0b193a,0x1bcc46ca),LL(0xcbd69b3e,0xcdc0a8c8)}, {LL(0xea79f2da,0x41eed8ca),LL(0x255e53b7,0xe8ace5f3),LL(0x88ccf86b,0x395a8fe4),LL(0x20ed30ef,0xd216328b)}},
+   {{LL(0x14a6980d,0xf3c5304c),LL(0x4a8ff9c8,0xf2ff8dd3),LL(0x405fd9f8,0x0c064c28),LL(0xf8bec41f,0xd5a4389e)}, {LL(0x06539007,0x108eb76f),LL(0xe5b77a5c,0x07e54756),LL(0x91e76eea,0x16921e08),LL(0x3ae0f1bd,0x1115fa02)}},
+   {{LL(0x2fbcabf1,0x1707e16d),LL(0xf00409c7,0xc378a5e1),LL(0x4e979d9d,0x03ebda4f),LL(0x8db0a1eb,0x9f500297)}, {LL(0xbdc09fca,0x14d99c16),LL(0xf220f46d,0x93d2153f),LL(0x695c1cf4,0xef0a6dab),LL(0x0f9f0308,0x2bf50e8b)}},
+   {{LL(0xebfc2cc0,0x5b9d7fbd),LL(0x399feb1f,0xe829943e),LL(0x12271884,0xd71ae69c),LL(0x5c70819e,0x630373d8)}, {LL(0x7b504312,0x8a6a4356),LL(0xc9f0fa51,0xc95bba4f),LL(0xadb5b25b,0x365b744b),LL(0x2cc6fba3,0xff354cf5)}},
+   {{LL(0x5c5c7a3c,0x410b6919),LL(0xd908d360,0x808c50eb),LL(0xa0e1f12e,0x938e6ffa),LL(0x5deeff80,0x0abc9757)}, {LL(0xb8a1899c,0x7cee5115),LL(0x71222521,0x45438a51),LL(0xa9cdf4b2,0xd41cc7f1),LL(0x5cbe530e,0x08bc758c)}},
+   {{LL(0xbe1e98d6,0x4d159b5f),LL(0x79118217,0x0e7df936),LL(0x7c04f363,0x6f083b4c),LL(0xa7b01b0b,0xceefd5f7)}, {LL(0x5225613c,0x912a0820),LL(0x47e419b2,0xe352a814),LL(0xcb242da7,0x13d357fd),LL(0xe32582a5,0x2b7d2f6e)}},
+   {{LL(0xc2af2cf5,0x5e5de9aa),LL(0xa9829911,0xa3a15dc0),LL(0x81f4e37c,0x9d1276d1),LL(0x660ef8ad,0x1a6f842a)}, {LL(0x0e6e1a45,0x7e845834),LL(0x71be6668,0xd35e5bb1),LL(0xf7ec18b4,0x9e34ab63),LL(0x81fe675f,0xe29d2bb4)}},
+   {{LL(0x01dda038,0xd27b3ced),LL(0x3df445a3,0x736e714e),LL(0x84350a52,0x67b274a7),LL(0xa512f3b7,0x768c71c0)}, {LL(0xc0527d8d,0xfe7b04de),LL(0xb907b598,0xdb863bb7),LL(0xb4d780c0,0x10baf6be),LL(0x037076f4,0xede7cf3f)}},
+   {{LL(0x7bb8f7eb,0x6182edd7),LL(0xfd42abaa,0x0c8ff597),LL(0x2509587d,0x5a70613f),LL(0xc3065d12,0xf1021c86)}, {LL(0xa4400c71,0xc2f6f6f1),LL(0xb1534643,0xc223cd9b),LL(0x47a2a271,0xeb80c173),LL(0x085c5509,0x819f5c66)}},
+   {{LL(0xca80edd4,0xe11d5f59),LL(0x55d4992b,0x9507273d),LL(0x9c447a9a,0x2a98295f),LL(0xb0326458,0x208c8c64)}, {LL(0xa64f7a80,0x35733679),LL(0xb62a99b9,0xba1bfd3a),LL(0x2a561380,0x6413821d),LL(0x8fa8c3b1,0xe3981c6e)}},
+   {{LL(0x4c112657,0xe8f90bc0),LL(0x5891314f,0x00143812),LL(0xdd16b908,0x53bee37c),LL(0xace3515e,0x5ef52747)}, {LL(0x08b2511d,0x0977b35e),LL(0x31cffcc6,0x36bb88b1),LL(0x0d352768,0x770e4cc5),LL(0x2ea1fb62,0x671dcc1c)}},
+   {{LL(0x66d31a96,0x85b86714),LL(0xbba43133,0x7f362f30),LL(0x6f3cb1d5,0x4eab5126),LL(0xfa43f0f9,0x40152d8f)}, {LL(0x8911f045,0xc638d431),LL(0xfc9d2e7b,0x6e3010f7),LL(0x08b69404,0x4dda1ed0),LL(0xe477872b,0x240675d0)}},
+   {{LL(0xad34a6bd,0x3ff0ea7b),LL(0x5264de55,0xbc5e1c89),LL(0xbceb12e0,0x203411ee),LL(0xffa5bd05,0x26846263)}, {LL(0xcb4ab908,0x391b5dff),LL(0xd4da45fd,0x7f6186ed),LL(0x979b86e4,0xe99d0fc9),LL(0x8840a9b3,0x4435462e)}},
+   {{LL(0x23dd384c,0xa8d02633),LL(0xf2315889,0x3c727167),LL(0xb5d62cc9,0xecbae568),LL(0xbaa1d792,0x40ce9631)}, {LL(0xd0e12184,0xcd48fed5),LL(0x52bc5016,0xc9a7fff0),LL(0x035316ab,0xa9b8e35c),LL(0xd2911287,0x5143958d)}},
+   {{LL(0x1b178420,0xf42adc27),LL(0x65669f90,0xae08ad39),LL(0xd0dca837,0x08bb4d6b),LL(0x4d7f6ff5,0x70e90a56)}, {LL(0xfdb90bc0,0x75f9a13d),LL(0xd4086d82,0x81c49e00),LL(0xe8270dca,0x7e0bb630),LL(0x3fc84692,0xe17cbfdb)}},
+   {{LL(0xb830a82e,0xfa9f9f7a),LL(0xc421f787,0x779c1b43),LL(0x5f3228fc,0xbfdee7cb),LL(0xe6d2dbc4,0xae5f7faf)}, {LL(0x2372e875,0x0d5b4ea2),LL(0xc40e10fd,0xdb6de86b),LL(0xdac0ac3e,0x3333e09c),LL(0x40eaa8ff,0x2cf32731)}},
+   {{LL(0x0f9ab359,0xbcc615ec),LL(0xb2c6164b,0x1aa2882d),LL(0xf655391c,0xfb149a32),LL(0xf65236d5,0x7ca3089f)}, {LL(0x16c28f40,0x7c4cfe27),LL(0x0fa0b7c2,0xf79da06c),LL(0x034e0a16,0x94f42fa6),LL(0xe38de64b,0x7ab3f95f)}},
+   {{LL(0xb22201b6,0x6f88c00e),LL(0x700517a6,0x898524c6),LL(0xa0ceb0ad,0x0ccfc437),LL(0x460bb58f,0xd06cfa78)}, {LL(0x5831ecaa,0x6d4d3929),LL(0xbf911264,0x8f75eab4),LL(0xa2e3f511,0x148b9a37),LL(0x08c9f80a,0xadfac06e)}},
+   {{LL(0x59796071,0xb59b40c1),LL(0xe8cf924d,0xf8604261),LL(0x7cdd157b,0x62fb2e88),LL(0x7b705eda,0xcfd4e0e8)}, {LL(0x461528e7,0xca1fdf90),LL(0x5fde007a,0xc5183843),LL(0x0d0ed14a,0x1ba46c51),LL(0xbe5c0a2e,0x10ad5bad)}},
+   {{LL(0x30acf8ca,0x09ea64e8),LL(0x9418e9ad,0x3955e875),LL(0x875264ed,0x1d21df4e),LL(0x0581f749,0xbbc5eb39)}, {LL(0xbbf1fb97,0x3706eec1),LL(0x6b2f5eeb,0xcd45ab48),LL(0xcb88826e,0x06460a7c),LL(0x392ba975,0x4dcbdbc0)}},
+   {{LL(0xe7c70538,0x730209a8),LL(0xae3fc792,0x599cc22c),LL(0xe4aa5031,0xf09a490f),LL(0x54a5fa3c,0x1da45cc5)}, {LL(0xea63a49a,0x2dd67bed),LL(0x47c3eaf4,0x0034d1fa),LL(0x4e399b5d,0xd087e502),LL(0x86773ab1,0x0c4814ee)}},
+   {{LL(0x720c5639,0xf7487ef3),LL(0x7974de0d,0xe92b61ce),LL(0x0485c5a0,0x95e62be6),LL(0x04106b91,0xc6852222)}, {LL(0xc1ade8a4,0x00da5377),LL(0xb7a2858b,0x9d1c0410),LL(0x443add53,0x397e0842),LL(0x5869ae74,0x49b263b4)}},
+   {{LL(0xe556e3ee,0x11ba45cd),LL(0x7a9a8a4c,0xab156bd6),LL(0xf0d18ab4,0x17365440),LL(0xb14a4744,0xe521f2a7)}, {LL(0xb9342505,0x34e01748),LL(0x7e94ed9c,0x5ccf93b1),LL(0x56a45c57,0xc2227bb1),LL(0x2b4dc4c4,0xe6c24fc1)}},
+   {{LL(0xb5efcf4b,0x0b4e8bd2),LL(0x89d1456e,0x1e444d00),LL(0xdd912a92,0xf61791d4),LL(0xbe21c88d,0x273ff257)}, {LL(0xed970696,0x0dce3133),LL(0xd2bad902,0x880c4ac6),LL(0x6414edf6,0x51e8ac62),LL(0x269a83a4,0x643b1ac5)}},
+   {{LL(0x1ae39054,0xe12cd141),LL(0xec48169b,0xfa03dec7),LL(0xffd4e32f,0x9a7e5f54),LL(0x95d1e91d,0x9fca0951)}, {LL(0xe9d89d35,0x4926b7f3),LL(0x78d87706,0x8482378f),LL(0x037c6654,0x01fbb845),LL(0x23e2f8e9,0xdf0a2f7c)}},
+   {{LL(0xfa42644b,0xf8399134),LL(0xeb2c0555,0xa101ea2e),LL(0x20f63ef2,0x49f217e9),LL(0x3ea042fd,0x6dc746df)}, {LL(0x9d83c522,0xec6f962b),LL(0x46433e27,0x3ede54e7),LL(0x33164ac7,0xb1423cd2),LL(0xbfa5fc95,0x20c64e2d)}},
+   {{LL(0x39db916f,0x3d31d446),LL(0x634b17e5,0x78001ba1),LL(0xbc99ff5e,0xaaf3386e),LL(0x3d250224,0x1a220140)}, {LL(0x2ecf9d24,0x672d7427),LL(0x336d679d,0x6b974067),LL(0x32eb37df,0xde420b89),LL(0x7a3543f9,0x0f9e256a)}},
+   {{LL(0x200d6a8e,0xf62da17b),LL(0x830ff40f,0x8169842b),LL(0x3c0e6814,0xcd4eceea),LL(0x23b9259d,0xbd82b74e)}, {LL(0xae3e7b28,0x6f238f0a),LL(0x7af86426,0x494a32be),LL(0x1b7563b9,0x037ca2a7),LL(0x5fdcaecd,0xc3fced23)}},
+   {{LL(0x36dfd5cb,0xc0854674),LL(0x3caa7a3a,0xb1a84f91),LL(0x5620105b,0xa885601b),LL(0x00900b91,0xf1d7c46c)}, {LL(0xfa122e33,0xe0f7c8d2),LL(0x285d0bee,0x0934fb8d),LL(0x1a8a3f76,0x30165143),LL(0xec346c88,0xeb5c5c7a)}},
+   {{LL(0x360a8ee9,0x7742973b),LL(0xf7d8d27c,0x7724a1fe),LL(0xe704848c,0xe2ef7117),LL(0x94263272,0x3537c444)}, {LL(0x98ab002d,0xebdba4e9),LL(0x93b7e5b1,0x32a5f898),LL(0x794abc1b,0xb61731f5),LL(0x5468cbe6,0xb5f4e92a)}},
+   {{LL(0x4d778661,0xd6d2b49c),LL(0x4e9dc32c,0x103f285a),LL(0x90fcec4e,0xa9aa2966),LL(0x8c0b3b2f,0xd3c797c8)}, {LL(0xf2de6e14,0xd3578eb9),LL(0x73a97595,0x2acc03db),LL(0x09077c60,0x478dde95),LL(0xc2af8284,0xfa628390)}},
+   {{LL(0x710be8e8,0x6f853320),LL(0xaf30382f,0xe82b20bd),LL(0x84d76429,0x2bd9deb5),LL(0x0c40cadd,0x946bd273)}, {LL(0x321ad905,0x635825d8),LL(0xbf0d5115,0x83098ca4),LL(0x05c974e7,0x88c9d029),LL(0xfb9dd953,0x7c4e57d8)}},
+   {{LL(0xeb8cbf0a,0xd78c87b6),LL(0xf83dab15,0x58159265),LL(0x3151f64a,0x9514e9e3),LL(0x0f1b5bb6,0x1c88c3f0)}, {LL(0x97b858c7,0xdc4aca85),LL(0x0edd4865,0x10ae8cd3),LL(0x1bc6cc91,0x1936de9d),LL(0xe20418f8,0x00e1ce30)}},
+   {{LL(0xd809f4b2,0xb1ab9480),LL(0xa6cd539f,0xbfd30904),LL(0x42c763e4,0xc1b190f5),LL(0xc4ecffc2,0xe33b4fa4)}, {LL(0xa878adbe,0xf25324ff),LL(0xbedfd786,0xeccc049c),LL(0xd8b3585a,0xdaaf2754),LL(0x70b9eed5,0xdf32e69a)}},
+   {{LL(0x4eaea039,0xd78cb2f4),LL(0xc074d045,0x6482829b),LL(0x7da7c22c,0x6ac3ead2),LL(0x705fea94,0x67b9ea06)}, {LL(0x39fb21df,0xeac1ae3f),LL(0xf51d087e,0xa77fddbf),LL(0xe70a271e,0x12eb266f),LL(0x86f17a24,0x0a172df0)}},
+   {{LL(0xbcbad9a8,0x7716bc4d),LL(0xcb910c92,0x8b765410),LL(0xdd003ebf,0x396f226e),LL(0xe4d8bf32,0xae505a60)}, {LL(0xf42bb734,0xdc2696ea),LL(0x80d6aa88,0xbb11ef90),LL(0xe2c4c402,0x349c4690),LL(0xa4e5f79c,0x9ab6e6b0)}},
+   {{LL(0xf56c97dd,0x6e41b109),LL(0x83229f7d,0x0970559d),LL(0x2ed4a491,0xb4a2d91d),LL(0x3bcf8238,0x242fdafd)}, {LL(0x2dbc937a,0xb63250b0),LL(0x7fbbb539,0x5c2a2238),LL(0x60abe459,0xa1de3547),LL(0xbbb84007,0x83ce2b23)}},
+   {{LL(0x10462cba,0x0409eae2),LL(0x7b0f5349,0x2e00c6e0),LL(0x76ede751,0x21e1d965),LL(0x7c23dbfc,0xbbe5ab3a)}, {LL(0x6ba8c9fa,0x81e96ec5),LL(0xad42e868,0xceb58ca4),LL(0x2dbda6c7,0x34c82144),LL(0xd21681f9,0x65760feb)}},
+   {{LL(0x1e7dda59,0x630fd545),LL(0x1e29c9da,0x55b561f2),LL(0x8d33dfa0,0x8ae9d493),LL(0x622f636b,0xd15fae7b)}, {LL(0xf33f38c4,0x8af04ed9),LL(0xcb352553,0xe3e46959),LL(0x0a4aef26,0x6034aeec),LL(0xa2fe0ca5,0x90909f19)}},
+   {{LL(0x8d0b7db1,0x1731c11f),LL(0x801ca119,0x8e6dcff5),LL(0xa0c5be76,0x274700a5),LL(0x282aa2d2,0x419fa0e6)}, {LL(0x4d20e470,0x1f531ef6),LL(0x8d571251,0x26883939),LL(0x56bf1e8f,0x6128626b),LL(0x11817bb9,0x1b6dc179)}},
+   {{LL(0x4f09f267,0xe389017f),LL(0x685428b5,0x486a41c6),LL(0xdf51c763,0x41b004a9),LL(0xd14d921d,0xf870a9d5)}, {LL(0x1a697050,0xca0b73a4),LL(0x782140cd,0xdc946697),LL(0x70307904,0x9d1b51dd),LL(0x1d479e44,0x6a63bc33)}},
+},
+/* digit=20 base_pwr=2^140 */
+{
+   {{LL(0x6a975d8b,0x196be23c),LL(0xde2aef07,0x6d7848f8),LL(0x88971bdf,0x880e9c1b),LL(0x9617507c,0xa0b61ebf)}, {LL(0xb558d193,0x7881e1cc),LL(0x27efe5db,0x8e3eb39e),LL(0xa94fbc74,0x78bc5008),LL(0x05b737b4,0x1a4b3db7)}},
+   {{LL(0x9495b5d5,0x7c5160a6),LL(0xf28742c9,0xdcacde01),LL(0xc36ab664,0xecb43151),LL(0x1c4951b8,0x0f12d8b7)}, {LL(0x6cf69608,0x074e467a),LL(0xe511db0c,0xc1fca494),LL(0x5e9d0611,0x9e7f32d7),LL(0xbfeb842e,0xe175a733)}},
+   {{LL(0xfa650f2e,0xf131a5b1),LL(0x20da5a45,0x3caa49a5),LL(0xc2438f2b,0x24fed3b9),LL(0xda6b04ef,0x2cc1dd26)}, {LL(0xf4e712ba,0x2a127b3b),LL(0x68312cb3,0x0b70938a),LL(0x7b0fbdee,0x6ad2ea01),LL(0xbe454e4d,0x3acad928)}},
+   {{LL(0x0073091f,0x311570c2),LL(0x424de0f4,0x647e3c94),LL(0x8c1a63a2,0xde2d71b0),LL(0xf86636ed,0xdf945b97)}, {LL(0x03e3fe9b,0x0baf127b),LL(0x6b52aae3,0x92f83122),LL(0x153e74ab,0xd9ee0e78),LL(0x40be2c16,0x9dc95154)}},
+   {{LL(0xff55ee27,0x439ee637),LL(0x4197b103,0x4582af54),LL(0xa4f51df0,0x9eb0314a),LL(0x8ea0aff9,0xc36d2248)}, {LL(0x2fb634db,0xced23286),LL(0x717de21d,0x7e6dc894),LL(0xbddeaa23,0x26790435),LL(0xc60f5f3d,0x85e9b4c1)}},
+   {{LL(0xcdde20bb,0x682cbf3c),LL(0x6a732b9c,0xa47c3fba),LL(0x0ce1c418,0xacec4317),LL(0x3590c160,0x01918f43)}, {LL(0xc9a8e4b8,0x75b33494),LL(0x768b6247,0x2eeeb35e),LL(0x4bc33c58,0x7cd0c3cd),LL(0xa7072e53,0x3bcf455b)}},
+   {{LL(0xd5636ab2,0xa711ef88),LL(0x29744971,0xffb5a3a8),LL(0x7367f41d,0x771631a0),LL(0x6406b576,0xbfb67bfa)}, {LL(0x27651342,0x131d1159),LL(0x46e3f66a,0xac7e214a),LL(0x3eb4550e,0x0aac82c6),LL(0x223b5174,0x8559e605)}},
+   {{LL(0x98a9bc05,0x4edab171),LL(0x87f2da64,0x595ab161),LL(0xa2f9ed58,0x979ec870),LL(0x821939e4,0x86d5088e)}, {LL(0xa7e275ed,0x3ef8e783),LL(0x597b7d0e,0xd3ee8fa2),LL(0xe37c7a09,0xfa9feaca),LL(0x1bf492b4,0x5c99fe2a)}},
+   {{LL(0x6752e22d,0x2aab71e0),LL(0x8d49ece1,0x4d5f1957),LL(0x6bee4aad,0x0aa0ec0f),LL(0x5f7cd806,0x39370e73)}, {LL(0x632cfcdd,0x58fd71fc),LL(0xba368b2b,0x3d4620c7),LL(0x0d8cfec7,0x04f4292a),LL(0x3958af0f,0x63655048)}},
+   {{LL(0xe3e75827,0x02c15d27),LL(0xf97df6c8,0x67689774),LL(0x8af8f2c4,0xd9705120),LL(0x380a0ea8,0x32da611b)}, {LL(0xcc720f86,0x3307681a),LL(0x5b47a369,0x4bf885c1),LL(0x1975e918,0xcbddf1a0),LL(0xa1c00961,0x31f853c3)}},
+   {{LL(0xf61e86b5,0x962c22ee),LL(0x8d14b7ab,0x374a3d0a),LL(0xcc9088b5,0x474d0c8a),LL(0x9410ef17,0x860d7276)}, {LL(0x189a1251,0x3ecbf75e),LL(0xe8b9b799,0xe84818ed),LL(0xb53eca19,0xab271286),LL(0x3a839b17,0x027357ec)}},
+   {{LL(0x581331b1,0x0b462f27),LL(0xa256d027,0x5f7ffadc),LL(0x406f7c16,0x56bac41e),LL(0x1381101b,0xa7f4c4cb)}, {LL(0x0c610852,0x099d3d6a),LL(0xfb0030af,0xaa9b1599),LL(0xd84033fb,0x6473c362),LL(0xbe5a1780,0xb986d38d)}},
+   {{LL(0xcd174988,0xf53ade08),LL(0x07be5624,0x31b0cf0a),LL(0xed030fa9,0xb6b01fac),LL(0x33788dfb,0x1f5be6be)}, {LL(0x149e8bcc,0x422f2d64),LL(0x756ebbb8,0x547566e3),LL(0xf6901e1e,0x3db92d1b),LL(0x6a0d05bc,0xcb4f2933)}},
+   {{LL(0x0da0fa19,0x1e217e90),LL(0x7b368488,0x099a14f7),LL(0x56f03a02,0xe8ea90d5),LL(0x4f15c7cb,0xa8e0de5b)}, {LL(0xaf2b26fb,0xaa71fdd1),LL(0xb360ef3c,0xfebf13a8),LL(0xc746e5d7,0xb51da724),LL(0x9f7a3430,0xcd04472e)}},
+   {{LL(0xd88d80ba,0xcec6fe54),LL(0xf46bd447,0xf72b99a2),LL(0x01395763,0x92576701),LL(0xfcf5cb52,0x222e4583)}, {LL(0xb7a7a29c,0xe9be9305),LL(0x2de6ac68,0x851409f0),LL(0xf623bf59,0x356a9d64),LL(0xf17991c6,0x728c1b45)}},
+   {{LL(0x7801a3c5,0x2ea0d0e0),LL(0x18b8af1c,0xc83d3ba4),LL(0xd51c0a1d,0x60f8e2af),LL(0xab2dcd2c,0x8316659a)}, {LL(0xad4913ea,0xb17fe8dd),LL(0x1ebaf2b4,0xfaa00a43),LL(0x3f6b097e,0xd9b38415),LL(0x6a966271,0xc834b785)}},
+   {{LL(0x76d1ee14,0xd7178eae),LL(0xf7355b21,0x97d88a40),LL(0xd8fd191b,0x26ec5d87),LL(0x49918b3a,0xd03e01ec)}, {LL(0x4c0bab43,0xf5a8c77c),LL(0xfc2f3545,0xe3b79537),LL(0xc8ec71b9,0xc27e762d),LL(0xf590d16b,0x1a9cb95e)}},
+   {{LL(0x8a2e4ddf,0x16a54803),LL(0x29174939,0x750f427e),LL(0x6062b3bf,0x387a3b0c),LL(0x458ab1af,0x076ed346)}, {LL(0x71c17e91,0x7d23cb62),LL(0xa4f577c8,0x0dddee93),LL(0x792f1b41,0x3603b37a),LL(0x0903401f,0xaff8777c)}},
+   {{LL(0x3fe54a2a,0xedc8e4de),LL(0x688fb8f5,0x6d700be4),LL(0xc2ee31ad,0x7cb13770),LL(0xfcff3124,0x2c397d86)}, {LL(0xa8727aa5,0xd776ce7d),LL(0xbe4750b0,0x0a2aef64),LL(0x99d9d493,0x8dd77987),LL(0x1b59a777,0x87e6a8ae)}},
+   {{LL(0xa9f6dc04,0x2d042077),LL(0x694e426c,0x6d51ace0),LL(0x10911f48,0xa926914b),LL(0x040931de,0x62df7914)}, {LL(0x9e720308,0x3034741b),LL(0x6d92d5a5,0x90f16a15),LL(0xf98fd891,0x5c4f57e0),LL(0xf9569e0c,0xb73433b2)}},
+   {{LL(0xa8b7688a,0xa330f53d),LL(0x55fc1fbb,0x7791f82d),LL(0xe64e0212,0x4dadf4ae),LL(0xd1276f1a,0x35cf0460)}, {LL(0x5a3a0aa3,0x30dd755b),LL(0xbb71a09f,0x19f1e322),LL(0x5f519d1d,0xe4c403be),LL(0x02fbf0a6,0x37beaba5)}},
+   {{LL(0x482b6363,0x5d4577c2),LL(0x35c49e8e,0x08ec8262),LL(0x1306a6cc,0x576331a9),LL(0xd935c78b,0x144ab6e3)}, {LL(0x8e559f49,0x351cd010),LL(0xf11c2959,0xfb3bfb28),LL(0x038946b5,0x6cfc511f),LL(0x615428cb,0x88403481)}},
+   {{LL(0xfe51ac2a,0x2213f75c),LL(0x378bd527,0xb606dbde),LL(0x6a141a9f,0xf620fee0),LL(0x315dec75,0xabc98f30)}, {LL(0x7886593e,0x4319d321),LL(0x300fd9f7,0x079c9a51),LL(0x803d9a1a,0x31aa1f50),LL(0x8afc5a81,0x5fd61247)}},
+   {{LL(0x4d68b278,0x09c7943c),LL(0x13127581,0xe5613d8b),LL(0x154e9d71,0x74c43c9e),LL(0x8704abfa,0xf17dfd9b)}, {LL(0x42ed6c47,0x9aaf0c75),LL(0xca69299d,0x501d677c),LL(0xa0c054e1,0xbf0ee15a),LL(0xabe752ae,0xdf63ab63)}},
+   {{LL(0x5a7b338c,0x286cad1d),LL(0x3caca86d,0x02749fb9),LL(0xbbd73dcc,0xd22930de),LL(0x9457dd3b,0x7cd84a01)}, {LL(0x6d2ae68c,0xad12ecfe),LL(0x25ac2bf6,0x7261b6f2),LL(0xafcd9f79,0x436737c0),LL(0x19fd2468,0x7197970b)}},
+   {{LL(0x93719d43,0x40a6efdd),LL(0x92e30def,0x092f6b27),LL(0x945a2fe5,0xfc9f72cc),LL(0x9858fc74,0x81aee7fe)}, {LL(0x420bc8fa,0xb1e62845),LL(0x04a6708e,0x9992adc0),LL(0x0d4f9104,0xd926fc3b),LL(0x26f2adf6,0xd4add622)}},
+   {{LL(0x4bcd5be5,0x21d8ee08),LL(0x1bbb4ae6,0xdb783f9e),LL(0x4590db53,0x88a04207),LL(0x684fc043,0x34d40baa)}, {LL(0x9f4e1d9c,0x597267fc),LL(0x28c384da,0x9aad1e1d),LL(0xb9959e1e,0x8a3a23e5),LL(0x196a21e9,0x53f744fe)}},
+   {{LL(0xd90f85a0,0xb999bd07),LL(0x5afae72d,0xa2e4e84f),LL(0xe9f02054,0x13b21ee1),LL(0xddd8141e,0xf5afafeb)}, {LL(0xca70163a,0x45bc0494),LL(0xc41eeda5,0x28763719),LL(0x7ecc0c08,0x6a319684),LL(0x076b22ea,0xbd9f55c3)}},
+   {{LL(0x369a2386,0x07468891),LL(0x20008208,0xb080b9b5),LL(0x5be5a264,0xd0980b3d),LL(0x962cc2f1,0x5a2c8b0a)}, {LL(0x3aa93d10,0x81d30e71),LL(0xd109ee0d,0xfad2a511),LL(0x2f2a4ad7,0x5092615f),LL(0x5d4b605e,0x05f4a36a)}},
+   {{LL(0x347eb237,0x29ccf0ce),LL(0xde0c147e,0x70e48b51),LL(0x75f5a03e,0x090e9755),LL(0x4e4b82f0,0x46cabeeb)}, {LL(0x54349ec9,0xff7a9e08),LL(0xbeafd1f5,0xca68a223),LL(0x61e40675,0x6f3790a6),LL(0xb82e4dbc,0x388ab541)}},
+   {{LL(0xdd235e1e,0x322c8cb1),LL(0xc8173e52,0x3b14c68e),LL(0x574904e4,0x33636551),LL(0xd7c2dc2d,0xb4b65763)}, {LL(0xb181a4d6,0x8b3ed18a),LL(0xbd32168e,0x985dda9c),LL(0x3c87d509,0xa51c68aa),LL(0x151e919f,0xfc9f2925)}},
+   {{LL(0x932f4e0d,0x0e56c67b),LL(0x13ec96e5,0x5f679c3e),LL(0x2b0f5e32,0x4ce06b7e),LL(0xfedc75e4,0x0a533bb6)}, {LL(0xb380df09,0xa0dd19b0),LL(0x3a6ddb00,0xf4929faf),LL(0x09f7c1a0,0x1915c834),LL(0x851c1a2b,0x472b336b)}},
+   {{LL(0x05f88602,0x074f00ad),LL(0x805b8ab9,0x9667be3a),LL(0xebbd307e,0x7d5664b8),LL(0xec565ee4,0x8e32a654)}, {LL(0x3d066e7f,0x39ac7fe4),LL(0x2d536ab3,0x10ca406c),LL(0xd3edc0c6,0xbee014fb),LL(0x3bece717,0x90102653)}},
+   {{LL(0x4f03f075,0x6584d7bb),LL(0xe9174d0c,0x800c2893),LL(0xe4cf53cb,0xb7f43e4e),LL(0x7c558243,0xec48b418)}, {LL(0x58cb956b,0xd28bf9f0),LL(0xab08c7b5,0x9edf1763),LL(0x4f0a1621,0x2963719c),LL(0xde04da99,0x579ab665)}},
+   {{LL(0xfba11aff,0xf2ddb89f),LL(0x12cf53da,0x20a78602),LL(0xdf4c5858,0x76fa1e51),LL(0xd24436b2,0x2446871c)}, {LL(0xa0fc4a3e,0xd1e19f40),LL(0xf85d8f0a,0x5f800419),LL(0x75acd9ad,0xc4d904ea),LL(0xb44bee31,0x7bfda3d8)}},
+   {{LL(0xc1091b73,0x708ba9f8),LL(0xa269c3fb,0x7541c163),LL(0x6250fef7,0x70b88704),LL(0x83bdb6a9,0xcce21ba5)}, {LL(0xad3aae38,0xac9d16d7),LL(0xc0d7e245,0xcd4d4364),LL(0xf2d3b87e,0x7efc174f),LL(0xd3eafdbc,0xd7d59601)}},
+   {{LL(0x0d08b5a6,0x7bdb71be),LL(0xdc0767c4,0xafacb373),LL(0x52bc6671,0xc1669739),LL(0xb2897c77,0x16b2db10)}, {LL(0xea532cb6,0x83388c52),LL(0xe6eb8dba,0x34d9d1ed),LL(0xe7304455,0x35e80739),LL(0xed880b03,0x160ff056)}},
+   {{LL(0xe93e390d,0xacbb86b4),LL(0x0ccd2170,0x4b8fe391),LL(0x7041a509,0x152f50e6),LL(0x8245846e,0xfd06deff)}, {LL(0x6fdc50e6,0xac2c53d2),LL(0x6511b111,0x3f80b6f6),LL(0x7003fc5b,0x19ccbfd4),LL(0x68f85f61,0x87b8a692)}},
+   {{LL(0x865e1a92,0x1df507e5),LL(0x1a990e09,0xbfcc9e0e),LL(0xe1c8c019,0x4c308da6),LL(0x595f93b0,0xb91e6b3f)}, {LL(0x5f05162f,0xcf829bc0),LL(0x783bb2e3,0xdafeb8cc),LL(0xc2414d57,0x6dc7d3ed),LL(0x8b1d72b9,0xe2a4a8f6)}},
+   {{LL(0xcfd32a38,0x71bf52ad),LL(0x9363cbc0,0xc4e397d2),LL(0xa33f087c,0x9087d3a4),LL(0x0877706a,0x9f6364dc)}, {LL(0xb080f2f9,0xffc60339),LL(0x95ac2b71,0xd15463ad),LL(0x57f6f482,0x88d081e3),LL(0x7b007a37,0xb09a8b95)}},
+   {{LL(0x45b25d05,0x3b477b48),LL(0x96fbd5f9,0x8574b156),LL(0x08f8068b,0x8c83d2a1),LL(0x4de9b6ba,0xd211d3c9)}, {LL(0x50a5d36c,0x15e042d4),LL(0x59359eeb,0x347bd354),LL(0x08e7266e,0x9f490b33),LL(0x819401f5,0x717aab49)}},
+   {{LL(0xecc91695,0x76bb6354),LL(0x8186c902,0xebe83bf8),LL(0x10b5b0bb,0xd7def681),LL(0x5c0de1e5,0x61d4d1a2)}, {LL(0xe95196fb,0x90b18984),LL(0x991f80bd,0x4dd43f8a),LL(0xacec7d96,0xfb9f9251),LL(0x1ad859f3,0xda9011fd)}},
+   {{LL(0xe8acfe97,0xd1bf4998),LL(0xe24c9844,0xf0465b0e),LL(0x4f0c0f26,0x0077436e),LL(0xa8da0eab,0x7fd96af1)}, {LL(0x13e56b69,0xbba3b016),LL(0xa9f72976,0x983e21c6),LL(0x4cb655c8,0xa6f32536),LL(0xac1bdb22,0x535c0ec5)}},
+   {{LL(0x2f6a64db,0x83f80c2b),LL(0xbe501cec,0xd17aab9b),LL(0xe2cfc5e2,0x79425df0),LL(0xe3f9325f,0x2bf5f26f)}, {LL(0xc8021a05,0xfc09df0b),LL(0x9e424b8d,0xfe4c6e29),LL(0x3b9a8720,0x2016c8e0),LL(0x3c4b4418,0xcdd7d85f)}},
+   {{LL(0x6963f1b0,0xf1b48800),LL(0x9a08b253,0xd9823f57),LL(0xc9da3fdf,0xcc24bbfe),LL(0xa0cba640,0xa2571d2d)}, {LL(0xd5ae16e8,0x5b1f5f63),LL(0x60159974,0xe6cf3ff2),LL(0x78129a0d,0xb93649dc),LL(0xb5400ab1,0x87c22333)}},
+   {{LL(0xe7a7800e,0x094942cb),LL(0x18119850,0x08a56eea),LL(0xa6e8b442,0xcbff11da),LL(0x36ca6959,0xe954e2fa)}, {LL(0x98b72a80,0xed30e6ae),LL(0x3f135040,0xf243a521),LL(0x1bc939ea,0xed0036c1),LL(0x5dd6c569,0x60f4d633)}},
+   {{LL(0x74e2b5c9,0x7fb9b31f),LL(0xcb72d40e,0xbc36fdac),LL(0xb3c5b943,0x02af3d7c),LL(0x0aeb01da,0x5b15bc83)}, {LL(0xa1011495,0x90d11200),LL(0x24985a8b,0xa1c81885),LL(0x76aeacab,0x88c90026),LL(0x1f12fa5f,0x0c1f49b9)}},
+   {{LL(0xbf331b58,0x5b22d4d6),LL(0xdb31aff6,0x06be0082),LL(0x3d46956c,0x045ed635),LL(0x2295f501,0xb2d277ea)}, {LL(0x0fb9bba2,0x782075e7),LL(0x85282daa,0xa9b510b0),LL(0xe55149a5,0x047c7ccc),LL(0xfce1fc7b,0xc4c8909d)}},
+   {{LL(0x0c7726e8,0x6dab5cc5),LL(0xca39244e,0x5d1b838b),LL(0xba2b1e27,0x53cbaf0d),LL(0x75a6eef1,0x8c004a0c)}, {LL(0x4ede4a2a,0xa64bae7f),LL(0xd12b73e2,0x4754b7ac),LL(0x1fa9d313,0xe47f83d7),LL(0x2ee589bc,0x5abcef66)}},
+   {{LL(0x574a0e62,0x3887509c),LL(0xcf30ac87,0x19af881f),LL(0x9bc90cab,0xf6533601),LL(0x144f49b4,0xec56a77d)}, {LL(0x5a57d1da,0x3b3f0347),LL(0xd0760795,0x5e1f7625),LL(0xd315991b,0x4279ef13),LL(0x276b89b6,0x2db9ea17)}},
+   {{LL(0xe305c123,0xb9147eba),LL(0x044ed131,0x7d2b05be),LL(0x052a8c9a,0xe42aaac5),LL(0xf2dc286e,0xcaea17f9)}, {LL(0x843e3789,0x60477540),LL(0x86dbd5bb,0x15aff9ad),LL(0x404d19d7,0x512e8e8c),LL(0x849c9b36,0x17a226af)}},
+   {{LL(0x0f6fecdf,0x97d2e90e),LL(0xfad04e43,0xf419d984),LL(0x6cc8a1f4,0x3c0928fa),LL(0x41b9422a,0x291ba9a8)}, {LL(0x2b22d148,0x57259d92),LL(0x96c54e2f,0x00db3300),LL(0x2bf16cf2,0x2f7d0103),LL(0x28c6f3f6,0xeb91da2e)}},
+   {{LL(0x01fb36b3,0xb3dd3e74),LL(0xde13a76e,0x9f858ce9),LL(0xa956f92b,0x37d101ed),LL(0x279135b1,0xe690fb99)}, {LL(0xaa582bb6,0x5606b90a),LL(0x625c35d1,0x64a7a73a),LL(0x1399d9c3,0x760fd0a2),LL(0xee11031c,0x83f149e0)}},
+   {{LL(0x9a56fc7b,0xaa152081),LL(0x2aeed73b,0xc5420916),LL(0x6af31aed,0x4708c364),LL(0x400a3c00,0xa4888933)}, {LL(0x0c9fd693,0x709a8ef6),LL(0xa0be6da3,0x0041aad9),LL(0xc27cfa40,0x76dfaaf0),LL(0x65c9bec5,0x60c939df)}},
+   {{LL(0x365520da,0x2aa5a69a),LL(0x9ec87c2f,0xbe4e6989),LL(0x047c15e0,0x9654315f),LL(0x49ff2646,0x6155742c)}, {LL(0xeeb87617,0x7f13d29e),LL(0x7869f65a,0xb3ec0bf8),LL(0x95e911f5,0x352df13e),LL(0x65a18b39,0x0b7b3165)}},
+   {{LL(0x95c1ae2c,0xca3a0e5b),LL(0xbd8893a8,0x41569204),LL(0x1dd938d8,0x8e272329),LL(0xbe08dcc6,0x9ebd3581)}, {LL(0xe62451e3,0xfcdf27be),LL(0xbd00e4cf,0x003cef6d),LL(0x7822142f,0x5c53d150),LL(0x531d18a9,0x3dfe4810)}},
+   {{LL(0xcc735908,0xd3db2a2b),LL(0x02ebfca8,0x36aafbf3),LL(0x41b1939b,0x0b6892df),LL(0xd4cc54d1,0xa358af32)}, {LL(0x816ca0e4,0xc3691102),LL(0x4a8ac7df,0x7d19ced6),LL(0xc446dac9,0x3b879f15),LL(0xa752cba2,0x3dbb05d4)}},
+   {{LL(0x377955aa,0xcd5a8976),LL(0xdb52e31e,0xe004f700),LL(0xf8e86df4,0x96bbe7a2),LL(0x7be7ca4d,0x7222afea)}, {LL(0x88e987d3,0x59c66ae3),LL(0x4a0d5b68,0x68ef2718),LL(0x80b8d4f2,0x877c5a34),LL(0x958a0b02,0x7971d9c3)}},
+   {{LL(0x42b5427f,0xe27bd316),LL(0x0ccc39c0,0x2a22c845),LL(0x40e1d76b,0x3554a4ac),LL(0x92b2e4fc,0xea167207)}, {LL(0x5ef6c382,0x8d1920cd),LL(0xb59b8a1d,0x8cce849a),LL(0xb77a3c66,0x8cc5d3aa),LL(0xd4b32716,0xd0b2d1fa)}},
+   {{LL(0x5310960c,0x0c77d6b0),LL(0x510286a9,0xd6882788),LL(0x447724fc,0x3b746d3e),LL(0xd90a2bfa,0x35ccd7ec)}, {LL(0xe84ffd07,0xfdf698b3),LL(0xe1ad22a9,0xe48c3f22),LL(0xcc132c1e,0xab9aa9fc),LL(0x27d5da27,0xac21e719)}},
+   {{LL(0xf2ba4860,0xd2901a5e),LL(0xa8ec0fc8,0x2692fa40),LL(0x000d3b93,0x3094ce3b),LL(0xd2b1631a,0xec6401c6)}, {LL(0x5dc9aa9a,0x45d5d140),LL(0x79b8016c,0x7f6c8ee3),LL(0x2e17e9a5,0xae55bd0c),LL(0x030ccd6a,0x3a94f9dd)}},
+   {{LL(0xd47ba16b,0x2bda2870),LL(0x19478d1f,0x63d711dc),LL(0xd56c1e59,0x5d5468ce),LL(0x17ca4328,0x708de792)}, {LL(0x307a96b3,0xa334f5c4),LL(0xff18110d,0xcee33aed),LL(0x9769e987,0xa5f4fdfb),LL(0x57ffc5c9,0x88acb409)}},
+   {{LL(0x56d35855,0x01081813),LL(0xc13a5758,0xb71eca92),LL(0x8d602029,0x5a45240f),LL(0xc4b8c96b,0x87ebbe00)}, {LL(0xd85745df,0xf46698da),LL(0x9ffee072,0x4a566eff),LL(0xaff65cb8,0x42ed3481),LL(0x77a90433,0xaac95b14)}},
+   {{LL(0x8d196a53,0x1b28f46c),LL(0xcdbd9fe4,0xcbbf4f19),LL(0x659aec4a,0x8f50d741),LL(0xa1fe4731,0x7a3f13c4)}, {LL(0x9c48ea03,0x8b08f67d),LL(0x30bfbbc2,0xb6b1f23a),LL(0xbe1922ca,0x506bcd04),LL(0x87d25258,0x776a01d8)}},
+},
+/* digit=21 base_pwr=2^147 */
+{
+   {{LL(0xea7b5d4c,0x5e18dec9),LL(0x54824cab,0xdf68b68a),LL(0x19b979a4,0x95e83fd3),LL(0x47583451,0xae23018b)}, {LL(0xe4b1ada0,0x6d542cce),LL(0xea7dd7f3,0xda343eaa),LL(0x51c6410f,0xeb3f3610),LL(0xc31d99f5,0x07b1d023)}},
+   {{LL(0xf15dd582,0x9e286677),LL(0x76af5d63,0xd38c0a2e),LL(0x20458bc9,0x9a2a0330),LL(0x4dec62b8,0xeea13421)}, {LL(0x844ebf75,0xe3a33849),LL(0x293f553e,0xfa8ab7e4),LL(0x251f1165,0x62645cb5),LL(0xf5129f90,0xd4b950a4)}},
+   {{LL(0x676a12d3,0x9f90ee04),LL(0x085f915e,0x1b29c564),LL(0x0b1978e4,0x9f6dc6ca),LL(0x9c198d9e,0x4c0d6c7b)}, {LL(0x2227b629,0x87d7b321),LL(0xe2948756,0xa8a84e65),LL(0x3f4c99f7,0xcc4da5ca),LL(0xe32ea5f7,0xb833f7a7)}},
+   {{LL(0x81faa9d2,0x50f96b29),LL(0xd6f02f65,0x64012727),LL(0xcdb1d3cc,0x2cd2e3fa),LL(0x29c0a50e,0xbdfad5a5)}, {LL(0x52aaf132,0x39985ce1),LL(0xe85b9cef,0x5b4af6d8),LL(0x2cdd9e5c,0x77e7be86),LL(0x6900c97a,0x571f80ae)}},
+   {{LL(0xa2039264,0x7d864b41),LL(0xe7a1ec50,0x9b8360d4),LL(0x698aad26,0x7e747f57),LL(0xa0092f36,0x302ca891)}, {LL(0x23d87bf6,0x6e028e6b),LL(0x1630244e,0x2acff8d0),LL(0x25c8ced6,0x0ffdff1d),LL(0x6980d8b2,0x36aa6193)}},
+   {{LL(0x013d56f2,0xf94e72a6),LL(0xdd7b9d90,0x773009fb),LL(0x4bf59897,0xa91e3a3b),LL(0xe142e1ac,0x6e933bcf)}, {LL(0xb87e1ab1,0xda3d9e96),LL(0x88f9e836,0xe11afcf9),LL(0x0375c534,0x5e6a5f0e),LL(0xb6ffb25d,0x51e6f8e1)}},
+   {{LL(0x8f9321b1,0x25091565),LL(0x4a982984,0xe9f1ecbf),LL(0x386c46ac,0xf3f70ab3),LL(0xfc1f18c2,0x459c38c3)}, {LL(0x8f1adadc,0xdb4f3421),LL(0x10377108,0x407fc6f5),LL(0x7f527055,0x00dc2006),LL(0x8ced154a,0x0954c6f0)}},
+   {{LL(0xc9740c53,0xf3282b6a),LL(0x41dbe39f,0x03eacc2d),LL(0x67a8efcd,0xe8b03a50),LL(0x5ae21e0c,0xffbd4db7)}, {LL(0x44d0d734,0x54cf603d),LL(0x6cb67a47,0x0f18661e),LL(0x7b5ee4a9,0x2c0fab45),LL(0x39e2058d,0x6b1e81db)}},
+   {{LL(0xedbaf0c5,0x8b08f88b),LL(0xc316b258,0x53472ddc),LL(0x48ea6389,0xe33d4fbd),LL(0x41376c31,0xd46cc336)}, {LL(0x1f4b27b1,0xf75970e1),LL(0x7df17073,0x8724067e),LL(0xee3ccc33,0x2feae0a4),LL(0x5315da8c,0x5937e13a)}},
+   {{LL(0xc83f6068,0x43829b93),LL(0xaf0dde53,0xbff91371),LL(0xb855c3b4,0xa32c2616),LL(0x93d815cf,0x02d833da)}, {LL(0x08c13120,0x15728346),LL(0x9585e921,0x7f3066d0),LL(0x4a82ab0a,0x75bb9267),LL(0xa49befd9,0x9e2a57bd)}},
+   {{LL(0x71ee419c,0x8ad82e9f),LL(0x6dfea81a,0xd0eea5b4),LL(0xc0170b1f,0xafecee48),LL(0x10620b5e,0x7fcbdfad)}, {LL(0x484f199c,0x09d50de5),LL(0x61b1b765,0x5ef922dd),LL(0x6d690771,0x88ae4cd8),LL(0x114c214a,0x1da200b8)}},
+   {{LL(0x84b84724,0x146c53c6),LL(0x31e1ed23,0x3a2c632f),LL(0x2945924b,0x81b05b75),LL(0xf18e1eb1,0x467d88ee)}, {LL(0x35217d7a,0x48b20941),LL(0x889300e1,0x44c0d0e6),LL(0x6ddf17e2,0xfe5ac61d),LL(0xbc48c8c1,0x7463b946)}},
+   {{LL(0x0e133e40,0x71f0b988),LL(0x96ad47f9,0x3089a14e),LL(0x0656aeca,0xfe410d68),LL(0xe5a5d41a,0x3e91d6f3)}, {LL(0xa1d556cf,0x460202bf),LL(0xbd690249,0xdd0febc7),LL(0x030e29cc,0xfea9706c),LL(0x75069cf9,0x246c5b9e)}},
+   {{LL(0x1bf71499,0x9b34abbc),LL(0x396a8d2f,0x54ad175d),LL(0xc21e26e3,0xd24c5d09),LL(0x2459a577,0xac40d850)}, {LL(0xc44333c6,0xc39c86d9),LL(0xfd90ecc9,0xa8611e31),LL(0x8c4c4c53,0x0b0b75b4),LL(0xe63d2143,0xe7cb9387)}},
+   {{LL(0x5b760034,0x3602a8a8),LL(0x6e104dbb,0xc1862283),LL(0xfd5ff53e,0x5788edbd),LL(0x4f94f45a,0x80660ca2)}, {LL(0x29c0ed14,0xb336730d),LL(0x046d9189,0x5d616cb4),LL(0x225af275,0x15ab3734),LL(0x09d289d8,0xfbe8e07b)}},
+   {{LL(0xa14022a8,0x3a5c3e5b),LL(0xbd4408d9,0x767f663b),LL(0xe3dd2388,0xbb9e99f2),LL(0xcdd212fc,0xb74aa12b)}, {LL(0xf1a3e558,0x0fa6c246),LL(0x6ab750b0,0x3438d000),LL(0xa8878152,0x3ecbcddf),LL(0x4a0c9ae0,0xb7cfd45e)}},
+   {{LL(0x6dacd699,0x94d6f315),LL(0x6230c97d,0x175eb1a4),LL(0x86a6f7ac,0x71b08487),LL(0xaed119fc,0x719382f0)}, {LL(0x778ed8c0,0x1ad5aafd),LL(0x05971b48,0x50bff6bb),LL(0x2c44215f,0xbef3f639),LL(0x786ed057,0xbd41e0b6)}},
+   {{LL(0x6f8388f9,0xcab6f40a),LL(0xc1036d40,0x2d28c986),LL(0x6c48899c,0x1c34c280),LL(0x4e7ab6bb,0xae5adb31)}, {LL(0x43cbfdb2,0x177be277),LL(0xdaefbc6a,0x2dcd89fd),LL(0xc781fdb3,0x50142a1d),LL(0xd2b6736c,0x509a4fc5)}},
+   {{LL(0x79742e8c,0x9ee77ef4),LL(0xb83b089f,0xdd0d1069),LL(0x3d72e109,0xa24b3ec6),LL(0xaa96ee7c,0xae6ca0ae)}, {LL(0xa9a0cbc1,0xe00ad03c),LL(0x6418f1c5,0x4546b62c),LL(0xa21cc8b2,0x1e17db71),LL(0xcaa4c349,0x8b9d47b7)}},
+   {{LL(0x7aab9cbb,0xf8570103),LL(0xb3744c03,0xfe9e4b29),LL(0x1fc33ea1,0x49e2232d),LL(0x2de54ad0,0xcd48a6ee)}, {LL(0x5bdd1bc6,0xb86ec33b),LL(0xbac3b893,0xaf526bb0),LL(0x870e2bf6,0xb04c837d),LL(0x50dab80a,0x28ff8899)}},
+   {{LL(0x7b947636,0xd4c83663),LL(0xb7436db0,0x06c6cd30),LL(0x17d56795,0x7ab75a80),LL(0xca7f046d,0x77791074)}, {LL(0x2de9d2e5,0x1bd096a5),LL(0x6e6be114,0x6d4acb7f),LL(0x8db873a5,0x81a31e5b),LL(0x04023e99,0x2d8d394e)}},
+   {{LL(0xee9c5ef2,0x37bd1f32),LL(0x5b8fb46a,0xbafcaec4),LL(0x2af1a097,0x3df41b8c),LL(0x61dc7aea,0x964b842d)}, {LL(0x1bad072f,0x52398a6f),LL(0x5635f531,0xbb0c080b),LL(0xebf3ad33,0xcb28ce88),LL(0xc3a8f497,0x90b71f6e)}},
+   {{LL(0x1a385b42,0x78645e5b),LL(0x69b6d3c6,0x5d5904c0),LL(0x147803dd,0xfb3cf0a7),LL(0xc6d19fc2,0xb6a77f5f)}, {LL(0xbd44484b,0xcf0ef92d),LL(0x12ce2c67,0x8fb42a30),LL(0x7210863c,0xdb2335c3),LL(0x3dc85906,0x554576e3)}},
+   {{LL(0x6dd39c2f,0x6b4b3c04),LL(0x855cd4de,0xfd4f3af2),LL(0xe5a53210,0xa36566b3),LL(0x6a98e15e,0x6c067309)}, {LL(0xee980506,0x081baaa6),LL(0x0c6a1b26,0x9a07bd11),LL(0x79b09922,0xd456c89e),LL(0xb09f5ba1,0x9b5fab01)}},
+   {{LL(0x39919aa2,0xd0a175ef),LL(0xb1f85fbe,0x4ee517ad),LL(0x6eb3d8e9,0xfb7a7bec),LL(0xacbe98b9,0x50b50620)}, {LL(0x98f57ede,0x234d1d45),LL(0x6f79e2b7,0x58ef079c),LL(0x450c98f1,0x1c33c1d7),LL(0x786da940,0x15975645)}},
+   {{LL(0xe0d8b3d4,0x3e6594ec),LL(0xfa71a933,0x0164b70e),LL(0xaf271f1e,0x40e3b984),LL(0x9ae69547,0xbe32ad15)}, {LL(0x5a427993,0x262589be),LL(0x6c3e1a7c,0x4b3e3bca),LL(0xf845374f,0x627292f3),LL(0x1fa30be8,0xdd2045a9)}},
+   {{LL(0x8b2069cd,0xe175943a),LL(0x66c7e8cd,0xd6cd24ed),LL(0x5a782620,0x28547601),LL(0x72a3060a,0xdf7c8411)}, {LL(0x78c42926,0x792cd830),LL(0x0e93a85c,0x033c893d),LL(0xf0628494,0xe950d396),LL(0x46c2a3f2,0xda10bbc1)}},
+   {{LL(0xcdc5d60c,0x72ebaff3),LL(0x8a3405fb,0x9014e8e9),LL(0xad9afdf3,0x9bf9c97f),LL(0xf3c1e5f4,0xbb13b772)}, {LL(0xb09d5bc0,0x4aa551f9),LL(0xb940c311,0x3d4ac2dd),LL(0x8de44bb4,0x31df7ada),LL(0x34efaaed,0x6a4472f0)}},
+   {{LL(0xb9fff1c5,0x722a8485),LL(0xae8115a2,0x9d7d7833),LL(0xa6a90974,0x9af16fb7),LL(0x5d4148f7,0xd45674f7)}, {LL(0x16dd3dbd,0x73f9c0c7),LL(0x690f3397,0x07bf2660),LL(0x3fd32526,0xcb3ae556),LL(0x604d4f34,0xe338554b)}},
+   {{LL(0xbe0b183c,0xfacbd02b),LL(0x86d62744,0xbc7bf32b),LL(0x974d6e93,0x72534d2f),LL(0xea3feee9,0xb6d4702c)}, {LL(0xe3e499ea,0x3c809d2c),LL(0x11f80fc3,0x21396e62),LL(0x8caf3e29,0x4c062ed7),LL(0x76e7abd3,0xf616386e)}},
+   {{LL(0x2366988a,0x164f450f),LL(0xd98f3e44,0x3d504751),LL(0x1245c2da,0xfb24a05c),LL(0x3a4b7d5b,0xe0f1abdc)}, {LL(0x3904650a,0xb3c9c6c3),LL(0x60bb196d,0x5e0976a2),LL(0x4416ebb9,0xd40e1899),LL(0x8cf6004b,0x17bb471b)}},
+   {{LL(0x6cfe66ba,0x6fc1807f),LL(0x29707210,0x30916eab),LL(0xf86680a6,0xca1f8047),LL(0x89e17f8e,0xe650ddfb)}, {LL(0xb7f54f4b,0x24d3b7f8),LL(0x37aecea1,0x660582f1),LL(0x1844b7eb,0xd5fbc8dd),LL(0x5c3dc6ba,0x282f82f4)}},
+   {{LL(0xea82b2d0,0xd8900003),LL(0x8aa048eb,0x768a926c),LL(0x9b5828e5,0xb2c9cd4f),LL(0xeade7d8f,0xba495c57)}, {LL(0xffaa4c50,0xe34557b0),LL(0xfb68b884,0x173d84f5),LL(0xb5dc2d05,0x41066a30),LL(0x9c444119,0x70201799)}},
+   {{LL(0x84545a3d,0x455b3bd5),LL(0x55a82e39,0xf99bc1be),LL(0x34d738d0,0xeb1a19ac),LL(0x6fb86da0,0xf4db202a)}, {LL(0xab3d0af0,0x80c7fe6d),LL(0xb55e75a8,0x6309b340),LL(0x14fa8243,0x7420990c),LL(0x31e99561,0xcf1ca497)}},
+   {{LL(0x0ad2ee5c,0x57be924e),LL(0x6431db1d,0xd7f512c8),LL(0xd7454bdb,0x34820d3b),LL(0x1c29bcff,0xd1b787b5)}, {LL(0xd8c904ff,0xa1be7364),LL(0x03d9de03,0x03eaccbc),LL(0xd55aea29,0xed3539ab),LL(0x303b3cff,0x18538363)}},
+   {{LL(0x1ffcd1ac,0xefc62993),LL(0x6cb50f54,0xe135d1b0),LL(0x0729d9be,0xe7e100b1),LL(0x18197c59,0xd36dca0e)}, {LL(0x98199253,0x764f8b64),LL(0x167e1a9b,0xad7320e0),LL(0xc0f24dd9,0x94e82547),LL(0x0e3f1ba2,0xc3d18f51)}},
+   {{LL(0x481dbf79,0xab9e3684),LL(0x3e1c615c,0xa97cc411),LL(0x600023e1,0x329ca306),LL(0x25d35124,0x6886d2c4)}, {LL(0x88762f6e,0xc2f0430a),LL(0xb670e97d,0x957d712f),LL(0x47bd9b03,0x22756e13),LL(0x12a8c9cc,0x388914c7)}},
+   {{LL(0xf43aac80,0x55348002),LL(0x8013a02e,0xad78c205),LL(0xbb0e56c1,0xb5281701),LL(0x734f38bd,0xd6d1d721)}, {LL(0xb6cdb463,0x80116f1d),LL(0x40b39d99,0xf32aadca),LL(0x85f09a39,0x9fc8089e),LL(0x199bf862,0x75b82e32)}},
+   {{LL(0x6f1b59fc,0x015ae86a),LL(0xf0452f86,0x5f320972),LL(0x781f1238,0xaf7acf39),LL(0x6eb74aed,0xd1d24611)}, {LL(0x490bd5e2,0x1ad7101b),LL(0x98a6e83c,0xd022378b),LL(0x52b157fe,0xa2f27dc7),LL(0xccacae16,0x3654d631)}},
+   {{LL(0xe4f0a0bd,0xdb8ada43),LL(0x3341b0bf,0x9f6ae901),LL(0x3152a32f,0x097f8bd0),LL(0xeee86b2c,0xce9b738c)}, {LL(0x6a823435,0x64a9d62f),LL(0xf55dfa6d,0xb7b9b5ac),LL(0x83f5af85,0xb8c64ee2),LL(0xc53c946c,0x7013963b)}},
+   {{LL(0x5fc2a831,0x94d4225b),LL(0xb63b3826,0x48675097),LL(0xa5d6d53a,0x22c23a1a),LL(0x16a81a17,0xc3c10d5e)}, {LL(0xe0d941b4,0x8db96fcf),LL(0x1cb7a468,0xa8647f63),LL(0x3f42ecc0,0x0b89a58f),LL(0xda0cac97,0xd1733e16)}},
+   {{LL(0x1a86121c,0x461eca58),LL(0x7244a317,0xef0138bd),LL(0x3d3ffe7c,0xaed39498),LL(0x4045823e,0x4fe8fcf3)}, {LL(0xa6ee872b,0x4b3b6f39),LL(0xda9a633e,0x115b8245),LL(0x2049774b,0x929baa1e),LL(0x1000266b,0xf6b4d4f1)}},
+   {{LL(0xf1356621,0x962aa572),LL(0xeb2302c6,0x4e685aa8),LL(0xf35b82aa,0x39c06bef),LL(0xf64da098,0xb6c03322)}, {LL(0xa308390d,0x11b86ff3),LL(0x41d985b1,0x77a3720f),LL(0xfaa6f3fd,0xb168a469),LL(0xc0faf628,0xd2ba710d)}},
+   {{LL(0x746f41f3,0xf4c971b0),LL(0x63d7f7fc,0x364ba4b3),LL(0x1faf5cec,0xb2def85e),LL(0x9551f27a,0xa6fe9391)}, {LL(0x8e50f618,0xcfcc1d8a),LL(0x0065e67e,0xf6542186),LL(0xabe41505,0x4ef21343),LL(0x51418ab1,0xfe3546ee)}},
+   {{LL(0xbf9f7486,0xff1223da),LL(0xa9bc5572,0x6cc7cca5),LL(0x7bb973d0,0x6508d1b1),LL(0x2368233b,0xb513ad67)}, {LL(0xba24eaa8,0x557c82bb),LL(0xfc12df9a,0x23facfbf),LL(0x1bd29d0d,0x0b9cac2e),LL(0x8f3f7b54,0xa8bcd296)}},
+   {{LL(0x53b55ad3,0xbb8864d4),LL(0x95994d28,0x27df7e6b),LL(0xfeb87f64,0xbc77e2d7),LL(0xfc320e59,0x9774f15c)}, {LL(0x5185829b,0x9ea5d3fc),LL(0x609ec7fb,0x99373b5a),LL(0x4194d8cf,0x64f56139),LL(0x0a2fe77a,0xecba5bf6)}},
+   {{LL(0x82354145,0x42a1b7b2),LL(0x62bca3e3,0x2b79e7a6),LL(0x8831d4ff,0x59aaec97),LL(0xacb71be8,0x4d6bc5dd)}, {LL(0x4fec50c3,0x762d04b3),LL(0x9ddd97fd,0xf3c4675b),LL(0xc34045b7,0xdb5178e5),LL(0x766b9053,0x4adc8110)}},
+   {{LL(0xca63ecda,0x565c0337),LL(0x1af894ac,0xd6c6d681),LL(0xb5fc09da,0xefec9708),LL(0x8aba8b6d,0x1431d872)}, {LL(0x18310709,0x85a3ce45),LL(0xc47c2b83,0xc1cde1dc),LL(0x14c2a12a,0xb7ef27e0),LL(0x6e368d27,0x8b71b273)}},
+   {{LL(0x179b2984,0x67f16018),LL(0x4ef61a22,0x5173d31a),LL(0xc9f14d9e,0xba63adc4),LL(0x9688d292,0x73eaa8ed)}, {LL(0x02520f06,0xfa293712),LL(0xbea41c69,0xe30cc213),LL(0xad52eb5e,0xf79e3ecd),LL(0x4bf77331,0x2a27ce55)}},
+   {{LL(0x7e2d4949,0xe42b98e5),LL(0x5a65f85d,0x1dbde554),LL(0xd92c7b22,0xb279d97c),LL(0x30b89bc2,0xd24002ee)}, {LL(0x8751885b,0xc04d8b06),LL(0x318315b6,0x72dbb9d7),LL(0x24db3bad,0x8c8c7a8d),LL(0xac099b90,0x72395500)}},
+   {{LL(0x3b63813d,0x02276f8e),LL(0xc56dc03f,0x544fd0f8),LL(0xc483a9af,0x17456a14),LL(0x9451a721,0x5d48c67c)}, {LL(0xfac1ef95,0x291496c2),LL(0xfc4411a5,0xa3f2ab37),LL(0xcd4e3fcf,0xde152368),LL(0xfa5a8c83,0x81ca294a)}},
+   {{LL(0xc0c26d44,0x2ed18f02),LL(0xce80faf2,0x9c0a1b76),LL(0x41898b83,0x9a85dc2e),LL(0x89a50ef3,0x5cbc3b53)}, {LL(0xf5357321,0x48b4907d),LL(0x25633dbb,0xb0136866),LL(0x522854d4,0x25dd8dc1),LL(0x50cc30a4,0xdbeae6e6)}},
+   {{LL(0x9390af03,0xda185ada),LL(0x71d252db,0x781d3fba),LL(0xca6a4a4c,0xb722397a),LL(0x208fcb10,0x4aabd6f3)}, {LL(0xb7732e23,0x57dd464d),LL(0x64873b5b,0xd2a318f1),LL(0x6ba79987,0x7ea2a0ee),LL(0x9e71f0f1,0xba85083a)}},
+   {{LL(0xfb64ab17,0xbef38b74),LL(0x0e771f3d,0xad5df725),LL(0xe62b1ad5,0x5643e9d0),LL(0x7b3c14f3,0xcf042ad5)}, {LL(0xb68348f4,0xa19be528),LL(0x1e5256a8,0x2c84f1ac),LL(0xdfbf9082,0x51e5bc38),LL(0xefd7d72a,0xceff3352)}},
+   {{LL(0x5ad7d46f,0x6ef91278),LL(0x0fcca663,0x17f7fc50),LL(0xd9f23933,0x632d7301),LL(0x0dea1daa,0x65e9ecd7)}, {LL(0x0a9a9f75,0x7fcb28cf),LL(0xf1bb7859,0xb11cf06a),LL(0xab7a05df,0x53fb6578),LL(0x184139d2,0xec66a34b)}},
+   {{LL(0xb0204d46,0x72c4f2c7),LL(0x3b84bee4,0x01911854),LL(0x898a4242,0x4ede3a9b),LL(0x87443aa4,0x0a1364b0)}, {LL(0xda496b1c,0x09fab15e),LL(0x886e4ce8,0x3566cd75),LL(0x8c69ecfa,0x74773ee8),LL(0x9063032e,0x0c86fb14)}},
+   {{LL(0x6b2fd84f,0x663d143a),LL(0xe0d0bb5a,0x5eb846c3),LL(0x1e86c2d2,0xa47a004e),LL(0xaac66f3b,0x9aa58c2a)}, {LL(0x773d9542,0xbbb390c6),LL(0x2c0d40ab,0x690dc585),LL(0x54b3fac7,0xfa2a01fe),LL(0x50fcc641,0x304f3e04)}},
+   {{LL(0xf1f215cf,0x6a5826f5),LL(0x0295be18,0xb5884a85),LL(0xefb88796,0x2ebae687),LL(0xa834e03d,0x9c88424a)}, {LL(0xdc8f5906,0x191cc9b4),LL(0xaf008897,0xb2fd7a46),LL(0x247b0884,0xcaf1bb42),LL(0x663a707b,0x2e395a86)}},
+   {{LL(0x0b25e236,0x1b02d217),LL(0x1c197115,0x19333d84),LL(0x46e1a716,0x39983bd6),LL(0x04bccc8f,0x16c80b72)}, {LL(0x266df347,0x1f785c03),LL(0x6972f537,0x0cdbe78c),LL(0x8ca31414,0x855cf360),LL(0x9beb3a0a,0xa772d600)}},
+   {{LL(0x91f8ddab,0x232af62d),LL(0x627adf7a,0x7094aa6d),LL(0x881048e1,0x0e9fd7f8),LL(0xe49ea366,0x3b0e2bd9)}, {LL(0x9122da74,0xc90fef06),LL(0x092466c4,0x0d6e5b45),LL(0x556e9f62,0x97355746),LL(0x2c379ec2,0xf5e66795)}},
+   {{LL(0x3f2d4af3,0x4a696b53),LL(0xa43d3b16,0xed6e5245),LL(0x345003a0,0x283dc3c5),LL(0xd5cd0152,0xc72bfdc8)}, {LL(0x9ce20521,0xd804bb82),LL(0x57d10078,0x58cc5a06),LL(0x9c57c58f,0xf03dbc97),LL(0x59ccbf41,0x80e2f879)}},
+   {{LL(0x4aea1de6,0xc49e14b0),LL(0xed6a443c,0x460bd819),LL(0xc29b904a,0xc992009a),LL(0xc84f2684,0x2aa5a13d)}, {LL(0xec814890,0x92e25280),LL(0x28d956df,0x1ecd903e),LL(0x0acc574f,0x8817914c),LL(0xc3009a19,0x99784ee6)}},
+   {{LL(0x8aa7d09a,0x377f9f23),LL(0xe7549321,0xd57eb4bd),LL(0x9d73f625,0x6e14ab03),LL(0x99af3394,0x517da44a)}, {LL(0x27cb3fa1,0xfbe5bb75),LL(0x724e7564,0x21eac97b),LL(0xe4b750aa,0x1dc8ba25),LL(0x60f75816,0x6c654cf1)}},
+   {{LL(0x4f815779,0xaeb3ade5),LL(0x2017c755,0xd9e995a7),LL(0x327b5f6c,0x55e3665c),LL(0x1388c7bf,0x744b60ec)}, {LL(0x5044e755,0x121ecdca),LL(0x4d345685,0xc400e8ef),LL(0x5f33d488,0xc8214514),LL(0x59d03f59,0xca131897)}},
+},
+/* digit=22 base_pwr=2^154 */
+{
+   {{LL(0x25bdaaa0,0x501fc8eb),LL(0xc87a9bb4,0x7c8a5680),LL(0x2f062926,0x853bbeb0),LL(0xb9eeda56,0xb3c57893)}, {LL(0x9bca1c9f,0x68cd4a7e),LL(0xf5cc222c,0x59048816),LL(0x215d6d0c,0x2536745e),LL(0x1bbb6a21,0xe5877a3a)}},
+   {{LL(0x6f848fa9,0xadf5f9e6),LL(0x38cde737,0xa71c2747),LL(0x67cb8c57,0x4393cae3),LL(0xd7b63131,0xbd92c017)}, {LL(0xfb22fe46,0xa0a5af5d),LL(0xf50a93ba,0xb583899c),LL(0x9faccd59,0x6d0c15bc),LL(0x538403ee,0xf6523175)}},
+   {{LL(0x07dd5639,0x6564f5ac),LL(0xf7878cb6,0xca41f9a4),LL(0x8c64ae2a,0xfaa4635f),LL(0x9a0b9349,0xcdf8b59a)}, {LL(0xe4a60e1d,0x4f5241da),LL(0xb39bdb4b,0x78137c87),LL(0x150dec4d,0x8be930f1),LL(0xba887987,0x657b26ab)}},
+   {{LL(0x37685d88,0x4ea10dda),LL(0xd731c69c,0xe3230237),LL(0xb08f5466,0x1b763c15),LL(0xe81d1dcc,0xaff88e1a)}, {LL(0xd59ee10e,0x80727f9a),LL(0xfd0a4b08,0xb4874044),LL(0x8080c797,0x73341f14),LL(0x0bca447d,0xd6f8686c)}},
+   {{LL(0x3bf045a1,0xb5195d35),LL(0xbdf86846,0x8ab4787e),LL(0xc1297de4,0x021e70b0),LL(0x2bf7d7c9,0x6647395a)}, {LL(0x6c53a9f9,0x0c6f7bc3),LL(0xa7d2cdf8,0x4d363ee2),LL(0xe7d8654c,0x345c0db7),LL(0xc54495e0,0xad20414c)}},
+   {{LL(0x8c8b5dea,0xda6d2976),LL(0xb8a8de06,0x086e2590),LL(0x117ef5b6,0x8b33aa79),LL(0x86cffe7d,0x0f2f48da)}, {LL(0x637b35b0,0x64aceb4a),LL(0x7970d200,0xe7c80e34),LL(0x490750d0,0x97b35d20),LL(0xcf086f26,0x8f51c896)}},
+   {{LL(0x2b97db3e,0x922a5247),LL(0xef0b0c5a,0x2d2e9629),LL(0xc6ddbb93,0xbfa2d7f1),LL(0xa1aa3a47,0xa3054d11)}, {LL(0x5dec6d34,0xf0542e5c),LL(0x99cbde0b,0x5f07037a),LL(0xdf84f722,0xe0fcd9c7),LL(0x506265b2,0xba1d1c37)}},
+   {{LL(0x6024b146,0xc120e21c),LL(0x897c7c4c,0x6ec12670),LL(0xcdc3bfd9,0x93d66405),LL(0x51291a43,0x11a4bf09)}, {LL(0xc1d3f866,0xe03be947),LL(0x0b8e9b95,0xe8fb0d9b),LL(0x81a53ce3,0x086e8f43),LL(0x5dbc7df2,0x31638c02)}},
+   {{LL(0xf5c2e2ea,0xc3b539cd),LL(0x37487fcb,0x9daa265b),LL(0xd3230bd6,0xc7c360b8),LL(0xcd2b5454,0x58b95398)}, {LL(0xc3cbaecc,0x8bb25b57),LL(0x10278dcd,0xa005c68f),LL(0x892e2646,0xfd0db08e),LL(0x5e06c8c6,0x2a028ef6)}},
+   {{LL(0xaa502c09,0x261b9232),LL(0x7d94c5a8,0xeeec0e49),LL(0x7242d24c,0x455ead6b),LL(0x1849c97c,0x34364390)}, {LL(0x4c999019,0xf12636c8),LL(0xc953953c,0xd3d1c5aa),LL(0x4750765b,0xf0af2db1),LL(0xb786c76d,0xec54d07b)}},
+   {{LL(0xbd87f89c,0x9133f43a),LL(0x2a51adf0,0xdcdd636d),LL(0x11297389,0xf4f4cf95),LL(0xd56aa420,0x91924348)}, {LL(0x48400b65,0x7c22b37f),LL(0x216e717c,0x24f38199),LL(0xf8320e87,0xa6023750),LL(0x4221edb4,0x75e6a505)}},
+   {{LL(0x4b309591,0xd35b1e98),LL(0x5ee94c5f,0x42b1807b),LL(0xe0047093,0x83956e4c),LL(0x54694578,0x8085ee15)}, {LL(0x81783d8c,0x3c90c788),LL(0xe0237c6f,0x8a90901d),LL(0xbaff3de1,0x0c99ffff),LL(0x02fe131e,0x2137ceaf)}},
+   {{LL(0x41239908,0xf4e704fa),LL(0x52d7102c,0x967fb92a),LL(0xc35dee65,0xf39fb59c),LL(0xcaa28432,0xc64ae280)}, {LL(0x2670c458,0x475bd3ee),LL(0xc7cd41d2,0x10737180),LL(0xda10717c,0x355677d4),LL(0xdf059223,0xabfed553)}},
+   {{LL(0x825dbf24,0xec3a18aa),LL(0xe764b30c,0xbd512314),LL(0x618319f4,0x58a2cd2d),LL(0xef0eba88,0x1fb5cdc1)}, {LL(0xc56cf3f0,0x873bf808),LL(0x54264b2c,0xb1615dcd),LL(0x47b9c8ef,0xa4f81bc4),LL(0xed88cfd0,0x2944aaf5)}},
+   {{LL(0xb0cdc808,0xafc4909f),LL(0x7b2bf5e2,0xe9a26a72),LL(0x6288476c,0x7042d722),LL(0x51aaf6e5,0xd8abc3ef)}, {LL(0xb5c79cca,0x515b23a8),LL(0x7657351d,0x187becde),LL(0x03374d99,0x61c7f31e),LL(0x1a44862e,0xc4ae7a4a)}},
+   {{LL(0x48333fcd,0x46b86f3e),LL(0x879bafd4,0xf599454e),LL(0xb1032834,0xb66f9bbb),LL(0xd88eddbb,0x35e2b02a)}, {LL(0x7577639f,0xae5260e6),LL(0xc6833313,0x717980e5),LL(0x76486e82,0x8810257b),LL(0xe2be33f0,0x341eabd8)}},
+   {{LL(0xa2d71a66,0x1a3ac103),LL(0xcc74bf4a,0x5a167f3f),LL(0x9270393c,0xfb14416b),LL(0xfd72b4c4,0x35fa5264)}, {LL(0x8a85ed9b,0x4d7f38b8),LL(0xab3109c6,0xc4690dbb),LL(0x0e6bf7f3,0xe110eef9),LL(0xa4624802,0x8d7f6a9e)}},
+   {{LL(0xbc1c7123,0x17803e58),LL(0xe1474235,0xc560b570),LL(0x65652635,0x20d64d7b),LL(0x230595d4,0xd3438458)}, {LL(0x77db6b64,0xda2f612e),LL(0x6366298f,0x776394aa),LL(0xdd713c92,0x9a5d9f0b),LL(0xab32da41,0x4a76ac61)}},
+   {{LL(0x73d5fb84,0x5b4448ad),LL(0xdf7d1cd1,0x1e34a02e),LL(0x16bd2f70,0xa21b17dc),LL(0x50c3001e,0xbacae607)}, {LL(0xeb73d61d,0x8b92652a),LL(0x80675310,0x0f63b99c),LL(0xfbd2960d,0x3a461728),LL(0x18ed5275,0x97786921)}},
+   {{LL(0x35acc43e,0xf45195a6),LL(0x278df575,0x98f0e92a),LL(0xf9c913c9,0xac58e78c),LL(0x3c2f5603,0x87f36641)}, {LL(0xfdc7ba99,0x4cbfca59),LL(0xb414b408,0x38cea97b),LL(0x8e9a95c8,0x8866af43),LL(0x6e89f54c,0x002826f2)}},
+   {{LL(0x268c9458,0x1e6a064e),LL(0xfde23d05,0x4859cd2d),LL(0x09769eff,0xa796e476),LL(0xf53fb8ac,0x5f9f42b8)}, {LL(0x4cb772c9,0xa4815fba),LL(0x54fe30ec,0xdcf25466),LL(0x38d5ca08,0xc99ab40c),LL(0x60064488,0x82b2cbc7)}},
+   {{LL(0x5b0b7f62,0x6f30df35),LL(0x8fdbb499,0x0390319f),LL(0x16c76539,0xc2c296c6),LL(0x59ccb304,0xc14b1b47)}, {LL(0x13daa1a0,0xd6602401),LL(0x3d4f8cb6,0xbe004303),LL(0xd2dc03cc,0xe6199da0),LL(0xe545a1b1,0xed3fe5f9)}},
+   {{LL(0x210f3673,0x2f11aba7),LL(0x61163b97,0xc24703af),LL(0x3b483b09,0x7f374317),LL(0xd46f9296,0xe7bc3e5e)}, {LL(0x2b0cb7e2,0x1c50e3db),LL(0x2fbd23de,0x9bd71f62),LL(0x759f69e8,0x2065e31a),LL(0x284b6c52,0x919a429f)}},
+   {{LL(0x54e913c5,0x49f11dd0),LL(0x20a72d19,0x7ffa161d),LL(0x009c1e3b,0x95ffbf1d),LL(0x629d0ead,0x4b1b21d7)}, {LL(0xfe044400,0x13c8ce43),LL(0x7a2aa524,0xbc674bb9),LL(0x05ee2f53,0x4b24e77b),LL(0x0b0e6b0b,0x932c88e0)}},
+   {{LL(0x132650a4,0x8dcb4d48),LL(0xbcd1d3cb,0x33e540ad),LL(0x5287b964,0x2b06624b),LL(0x122d6eb9,0x27931bda)}, {LL(0x8d174cad,0x71dfbf40),LL(0x6c902d4b,0xfd0694f1),LL(0x259e124d,0xa98898f7),LL(0xf4a61bc5,0x1d62e0af)}},
+   {{LL(0x1fd4fb12,0x5f33c254),LL(0x0210b9b5,0x7713d097),LL(0xc5a4242b,0x740186dc),LL(0x46ecd060,0x01bb181e)}, {LL(0x1a5bda7d,0x33b7ab04),LL(0xd00e16cf,0xe46af59d),LL(0x8b6c2c21,0xe96001b7),LL(0x5bb7751d,0xc7b1811c)}},
+   {{LL(0x7a40b44e,0x242c8832),LL(0x356161ef,0x91df9740),LL(0xa5a35885,0x086225ae),LL(0x4cdc74c0,0x75a079c9)}, {LL(0xc27c6878,0x64d5aa45),LL(0xc40673e1,0x09bb0ca6),LL(0xa5cdcf6e,0x52cabb76),LL(0xb3ede3af,0xe8721135)}},
+   {{LL(0xaedd8467,0x247c0c4b),LL(0x13cbeddc,0xa5461b8d),LL(0x769c62a9,0x5534be46),LL(0xe48d8c1f,0x233a8a3f)}, {LL(0xec479241,0xc36b4212),LL(0x032c47cc,0x05d56e03),LL(0x3535933e,0x550734e9),LL(0xd72acafc,0xd15e49f8)}},
+   {{LL(0x56559945,0x3a6124a1),LL(0xc43cf23d,0x6c0f1355),LL(0x0d76d8a0,0x05295022),LL(0x8c784376,0x2a6e2fd8)}, {LL(0xdf94fdf3,0x9f6bb3b9),LL(0xd8b57423,0xa35d7645),LL(0x6d5bd896,0x7d6878bb),LL(0x8ee5ae30,0x0bce51f8)}},
+   {{LL(0x3db8ae66,0x96851d65),LL(0x2009aee6,0xc6c1602d),LL(0x5a518952,0xf22b0c63),LL(0x07bf2fa3,0x977a6bb5)}, {LL(0xcb26b0ac,0x33080653),LL(0x7ac99139,0xe9868e09),LL(0x4f5d4c31,0x2c9eb26c),LL(0xd15005c5,0xd31db990)}},
+   {{LL(0xd8b623bc,0x2aefd008),LL(0xb16968d6,0x853aeb2b),LL(0x6c6e6657,0x18273bc4),LL(0x07b15072,0xa9c6cdd5)}, {LL(0x77f4f318,0xb658188c),LL(0xe1400983,0x485f1006),LL(0x093bd29b,0xcfd33291),LL(0xea60e1ee,0x052b19dd)}},
+   {{LL(0x907a0923,0xacd537a1),LL(0xb0d1bce9,0x5d02cd7d),LL(0xe9be2652,0x36039ed5),LL(0x4fb0ff86,0x87c4e351)}, {LL(0xa7751b13,0x9a081ba8),LL(0x04f13df9,0x3458a462),LL(0xb55e569a,0x46766072),LL(0xef1d851d,0x13aff2f4)}},
+   {{LL(0xd99b27c8,0xdb33d3fc),LL(0xe8616dd0,0xf29ca40a),LL(0x2859420b,0x00dc11be),LL(0x1c6eabfd,0x81492864)}, {LL(0x8058e39f,0x2759be06),LL(0x20603338,0x54c5de6e),LL(0x94624743,0x7ee11332),LL(0x571facce,0x1779ce9e)}},
+   {{LL(0xc6461516,0x2fbb2ca6),LL(0xbb5e69c5,0x123bb55b),LL(0x7799b9ed,0x8e17f857),LL(0xe96f77c8,0x93d201e0)}, {LL(0x971ebb1a,0x947fe77d),LL(0x50d472c1,0x54458ef3),LL(0xb355beb5,0x9e5b84c0),LL(0x4246646d,0xb256b767)}},
+   {{LL(0x31070752,0xd46bd9ff),LL(0xb0c4e90e,0xbf39f0df),LL(0xe757d172,0x69590038),LL(0xff9be09c,0x3f667a81)}, {LL(0xcc1023e3,0xb3134dcd),LL(0x206c3ae6,0x5b484a53),LL(0xffd70809,0xadaab841),LL(0x4838a5a8,0xeee2912f)}},
+   {{LL(0x4ae35baa,0x74807863),LL(0xce0b26f5,0x223fbd61),LL(0x639eeaa4,0xe26cd1e5),LL(0x99a11537,0xed83e5de)}, {LL(0xfd8f6b2a,0xda5ba49f),LL(0x01c7e980,0x06d0bae3),LL(0xce2282b3,0xefbbbd81),LL(0x7e10755c,0xcc23bbbc)}},
+   {{LL(0xa7bcd991,0x4a6ec66a),LL(0x6786fd37,0x5fb281fe),LL(0x6e3ceb36,0xf04d0250),LL(0x10802397,0x2655da89)}, {LL(0x14e9a7bb,0xe9728470),LL(0x4d40305a,0x92e40fea),LL(0x25e16338,0x951b46c5),LL(0xdbda8365,0xe2675cae)}},
+   {{LL(0x728d1426,0x9f95f6a2),LL(0x790cfb37,0x9e2117ee),LL(0x9d591988,0x0aa986fd),LL(0xaff7ef49,0xf9d3a0fb)}, {LL(0x66b46866,0xf29e00cf),LL(0xf17c5029,0xc3b6837f),LL(0xe271f24c,0x26813f18),LL(0xeb0dfe9d,0x079dfbb1)}},
+   {{LL(0x04581237,0x44bbd9e7),LL(0x688346be,0x62d29710),LL(0xfda789c9,0xc0503c08),LL(0xe4589f0d,0xdb3ca137)}, {LL(0x33282195,0x51ae7c6c),LL(0x6abc61e6,0x0e9b7f17),LL(0x2fadc830,0x209ad188),LL(0x1016f753,0x006449df)}},
+   {{LL(0x0f8501e6,0x1c6877b6),LL(0xb7dae4f4,0xda5aac7f),LL(0xc196b602,0x3ef6cb3c),LL(0x8cb84512,0xe40ceb42)}, {LL(0xabef859c,0x0ea50c35),LL(0xc63900de,0x420f02c8),LL(0xaa0cc011,0x5cfb1d84),LL(0x54f83f0f,0xf50f6f46)}},
+   {{LL(0x312fc8f8,0xe712b893),LL(0x9a03374f,0xa85f1365),LL(0x2ad8ab97,0xe6dfcf7d),LL(0xf9ca6b81,0xb9bb605c)}, {LL(0x73a4a593,0x451924c4),LL(0xb63988c8,0x6e9ad0b7),LL(0xf0700929,0x76e8afeb),LL(0x4a38a822,0xff86ddf8)}},
+   {{LL(0xf46f35f6,0x3927499c),LL(0x76c7a037,0x6b902adc),LL(0x34b3b202,0x5da70852),LL(0x2484ba31,0xecf2a5c7)}, {LL(0x23bb65ef,0x7be47505),LL(0xa0f2a97f,0xee68409e),LL(0x78740fca,0xae72829d),LL(0x43fa856f,0x115c21ea)}},
+   {{LL(0x1667c4d5,0xde990734),LL(0xd410fbb6,0x59b75de9),LL(0xe0667ad4,0x82b41f72),LL(0x21f9c1f4,0x37248ded)}, {LL(0xf3a7b4f5,0xb896dcd6),LL(0x9e950ff4,0x9af07cc4),LL(0xe1294534,0x92d5e7fe),LL(0x29908d08,0x47d0f355)}},
+   {{LL(0x240aedbb,0xaac78e61),LL(0x828256ff,0xd4db7ac2),LL(0xf0f4571d,0x28b1d15e),LL(0x580a4882,0x360a20df)}, {LL(0xf5791b48,0xcdd5dfff),LL(0x658adde2,0x811a740c),LL(0x098481a4,0xbeb78afa),LL(0x4ea07bff,0xca53eda0)}},
+   {{LL(0x18dd8d61,0xe98da505),LL(0x1e8383b9,0x915be141),LL(0xdc808fbe,0xa75e7c8a),LL(0x4e03ae4e,0x06aa0112)}, {LL(0x8eddba25,0x356b6fb2),LL(0x7d77982e,0xe3de7ec7),LL(0xc3f98387,0x7677833b),LL(0x5d466049,0xe0afaef2)}},
+   {{LL(0x8c1d6c0f,0x680eacc0),LL(0xa29cf61d,0x0e2c8fed),LL(0x6eb199ac,0x3521dbdd),LL(0x5b89e9d6,0x3fabfadb)}, {LL(0xed499e32,0xb95ab78c),LL(0xcc51ea6d,0x1340c28f),LL(0x25ae9715,0xc8fa0b7a),LL(0x7fdf1245,0x155b7ec4)}},
+   {{LL(0x39ef85fa,0x0f4ede24),LL(0x044ae8db,0x5897e124),LL(0x6cc87dc1,0x7758fddf),LL(0x8b6e6c2b,0x3b4e7634)}, {LL(0x35073805,0x906f4064),LL(0xac8af507,0x718041a7),LL(0x80eaa117,0x3ce21d03),LL(0x6eed3138,0x61f26890)}},
+   {{LL(0x21bb7ea5,0xfeebcf9f),LL(0xd7633c0e,0x5c12eb00),LL(0xdabe211c,0x4b181ddb),LL(0xcbf62b41,0x4ef450e3)}, {LL(0x8c1a7558,0x57467566),LL(0xcfc8998f,0x69d86a57),LL(0xe081a1c9,0x93774831),LL(0x06f261c9,0x41df86f8)}},
+   {{LL(0xb105fc8f,0x70f435be),LL(0x0ebd4f26,0xae9446cb),LL(0x9fb56ea3,0xae31f4fd),LL(0x42cfad34,0x9b46f7b2)}, {LL(0x87586562,0xd868b34f),LL(0x5f51775f,0xa85d3b47),LL(0x1316c97c,0x4044622b),LL(0x731b5046,0xac4e004d)}},
+   {{LL(0xd77b2412,0x35cb3645),LL(0xa81b50e3,0x9bbedc78),LL(0x0df0e9ef,0xa18122dd),LL(0x0d8ea8a7,0xcf2c4bfd)}, {LL(0x8b5229a7,0x279e8b0b),LL(0x3957bfa7,0xa57d73af),LL(0x39b9b2e7,0xa43bae74),LL(0xfc31bfb5,0x433aa70a)}},
+   {{LL(0x69c1f295,0xa412f894),LL(0x8bf52897,0xf769ff01),LL(0x475d9f3e,0x0aeefe6e),LL(0x99fb41f1,0x91e111f8)}, {LL(0x754bcbab,0x53cf2f68),LL(0xc32956ad,0xa5507492),LL(0x93c47e38,0x8b1edef5),LL(0x55b99660,0x9ec031f4)}},
+   {{LL(0xcf1a8f8d,0x062c6977),LL(0x6549b48e,0x1024e450),LL(0x88bcc389,0x526ac918),LL(0xb7eec98b,0x63d2fef3)}, {LL(0xe7d0ac71,0xf2d14ff6),LL(0x52b5f573,0x5976bfd2),LL(0xc8f25c97,0x12bddfc8),LL(0xdb3daf40,0x163e5a3c)}},
+   {{LL(0x28153cbe,0xb5fbd550),LL(0xce869652,0xeecbfb93),LL(0xb5de211c,0xff93f232),LL(0xfec2473e,0x86087984)}, {LL(0x3285e4d1,0xbfe38f73),LL(0xa4a84804,0x70f9d56f),LL(0x5a41451f,0x53098653),LL(0xc6ce70de,0x7f7646b0)}},
+   {{LL(0xd5644337,0x73b29200),LL(0x46845bd5,0xa3179558),LL(0xa592b8e9,0x2a997f3f),LL(0xae672e91,0xb5b275b3)}, {LL(0xd485fdf7,0xa7dbac92),LL(0x51414415,0x2a45c684),LL(0xcfc3d868,0x06291ddb),LL(0x82fb2677,0xe8aea560)}},
+   {{LL(0x43f1424e,0x72aad5ee),LL(0xbb61e23b,0xae16dd76),LL(0x6986112b,0x207f442f),LL(0x67e43ae9,0x06cf2338)}, {LL(0xaa9c46e9,0x5cc8bd01),LL(0xbff6eb25,0xa09e383f),LL(0x6a953b73,0xe3a14a2b),LL(0x7626f351,0xb4d35aeb)}},
+   {{LL(0xba0073db,0x895f5dee),LL(0x4021cd4c,0x38d579c9),LL(0x5745def0,0x73cc6022),LL(0xf93437c2,0x7d8a4371)}, {LL(0x6fb8e762,0x3140c926),LL(0xe33db57b,0xc8419a52),LL(0x40ca01cb,0xfe8425d1),LL(0x339f928e,0xe945aa5e)}},
+   {{LL(0xc571764c,0x0a54ab50),LL(0x2a1a045d,0xe0bb25b9),LL(0xd3aa14bb,0xe34b7eb5),LL(0x0a6d94d9,0x853c2919)}, {LL(0x6e3f1936,0x2483e5e7),LL(0xe04e91ac,0x66b3d134),LL(0x66d4a7a4,0xe814a174),LL(0xeeeb8bc6,0x2e15f4fd)}},
+   {{LL(0x4baaa9dc,0x8456c7e1),LL(0xf4250062,0xc14f1f14),LL(0xde03d3c9,0xc7e410a2),LL(0x76700791,0xdd59fb0c)}, {LL(0x48acf7ef,0xdb3d872a),LL(0x0d24b355,0x2650270e),LL(0x17c61227,0x7f1fe16b),LL(0xf228c44f,0x77113813)}},
+   {{LL(0xa61d90f9,0xe6dc0f8c),LL(0x320d2db7,0x04dfc974),LL(0x16f3c468,0xdbcb8fea),LL(0x4b20b6d4,0x56a5b8ea)}, {LL(0x850e96e6,0x248a29d2),LL(0xa3c46541,0xf2e71f9b),LL(0x7c5b3d37,0x4aaef1b9),LL(0x104abc8c,0x0f653946)}},
+   {{LL(0xc7e4ce10,0x0e5d1925),LL(0x45521d8f,0xf041fd81),LL(0x227dd083,0x531486ff),LL(0xa8528e6d,0x576ff7e2)}, {LL(0x40c9838c,0x4c90cec8),LL(0x514a6ca3,0x51091b67),LL(0xdbd753eb,0x2ae64b87),LL(0xde249a3d,0xb2c74bea)}},
+   {{LL(0xdf391b85,0x04cff9c4),LL(0xd449f992,0x4abfecf7),LL(0xa9e14b49,0xc7fe422e),LL(0x1b0e809f,0xf61c7d63)}, {LL(0x511186e2,0x712068dc),LL(0x10440a09,0x44067d91),LL(0xc72bd69f,0xae8c7b19),LL(0x1a24f10f,0x71bebb70)}},
+   {{LL(0x51b07118,0x7751de97),LL(0xcf836c01,0x60dc2779),LL(0x47e2698a,0xd9fd9af4),LL(0xe8597ee4,0xa6bc8354)}, {LL(0xe7fbe3e0,0x7ea1b649),LL(0xcf28de2d,0xb3d0f305),LL(0x7ae0ba11,0xae1a8664),LL(0xd7fa15c1,0x7a92e830)}},
+   {{LL(0x7592bd9c,0x85e95437),LL(0x5140811d,0x6ae96379),LL(0x471262a7,0xf77a94ae),LL(0xaf374335,0xbc3fc629)}, {LL(0x2a5bc796,0xaa032562),LL(0xd99fa09f,0xaa3619c7),LL(0x38795c65,0xda56cfe9),LL(0xf8893387,0x953aff09)}},
+   {{LL(0x1a89f319,0xc75f9df6),LL(0x8db72e5b,0x07fdf045),LL(0x23496830,0xc1545deb),LL(0x74f901c9,0x803233b4)}, {LL(0x0384551a,0xb2f97be8),LL(0x6b2116a1,0x39bc7f2b),LL(0x9421e72f,0xf7f04c19),LL(0xeb78bea3,0x76b396b1)}},
+},
+/* digit=23 base_pwr=2^161 */
+{
+   {{LL(0x46a2512e,0xb503d27b),LL(0xddc1d56c,0x305bb293),LL(0xf18ee2ba,0xff6e7a8c),LL(0x53e08dcf,0xd565ad58)}, {LL(0x7a3b543f,0x865c7f6a),LL(0x6c260230,0x65ba01fa),LL(0xce8ac62f,0x48893aaa),LL(0xd0b136da,0xdf701299)}},
+   {{LL(0xb9334e9b,0x1f6ffbf4),LL(0xb8fab993,0xf3dd5292),LL(0x5e22e2be,0xa009aa6f),LL(0x1f4c264d,0x98917cac)}, {LL(0xfdbcead8,0xfe34e303),LL(0x5df57243,0xa9894e9c),LL(0x25d35b50,0xe471e059),LL(0xc1b1805a,0x337f6278)}},
+   {{LL(0x97b49209,0x5daf6d70),LL(0x81974bde,0xdd2d9b92),LL(0xab548f82,0xe91e4a38),LL(0x51121eee,0x53c34242)}, {LL(0x5e963f61,0x115fbb26),LL(0x0520ca29,0xe988b4ca),LL(0x254ad17b,0xe16ec5e1),LL(0x003b6214,0xa3651c70)}},
+   {{LL(0x3e10d4ac,0xaf9463c2),LL(0xfd36f051,0x7d476867),LL(0xda6dec1b,0xff605874),LL(0x9d3f6d97,0xf767bf93)}, {LL(0xe0a9bcc9,0x9996d4ba),LL(0x6ca4de3b,0xda018943),LL(0x251d0394,0xbc7ed87e),LL(0x3bbfd259,0xb5038750)}},
+   {{LL(0x36551c03,0x029456df),LL(0xebd0d948,0xdb9d1013),LL(0x0a0d8a50,0x465554b3),LL(0x5d63bb6b,0xba0c4d39)}, {LL(0xa806a8dd,0xccb8336f),LL(0x11f840b2,0x7dcb9305),LL(0xf55b4cec,0x353db4ad),LL(0x6fd1e493,0x89364db1)}},
+   {{LL(0x812e7603,0x761826be),LL(0x64292bfd,0x8cc52039),LL(0x72456302,0x53dfe709),LL(0x41e2eddf,0x152130aa)}, {LL(0xb37b8cc7,0x8e0535d4),LL(0x837532f1,0x3b225d32),LL(0xc8c97d38,0x037a7209),LL(0x16e48ee3,0x53e7f241)}},
+   {{LL(0xc1ad13df,0x7d1db455),LL(0x1fea3929,0x6e1f043e),LL(0xe429a9a4,0x57040e49),LL(0x3d37cf6c,0xe3faaab8)}, {LL(0xb5556188,0x50fc7f5d),LL(0xd78e636d,0x847a0bdd),LL(0x64b922d9,0x2391ec3c),LL(0x5e916aaf,0x1136d3a1)}},
+   {{LL(0x52b47c8f,0x79c7aa3c),LL(0x01ae5805,0x485a4d3b),LL(0x5ce8fb12,0x92d92ed4),LL(0x59381354,0xca30214c)}, {LL(0xb1db1e86,0x7060e77c),LL(0xe63f4f80,0x9b3f0cd1),LL(0x5f9b5bca,0x72b4780b),LL(0xcd768829,0x8b3ae0ef)}},
+   {{LL(0x7d7e07b7,0x56302379),LL(0xca0b7c78,0x035482d4),LL(0x9206aa05,0x7259f443),LL(0x20cb3de9,0x64414a40)}, {LL(0x61bc0b8c,0x8a6dcbf1),LL(0x296e7195,0x892352f7),LL(0x101b2e4a,0xdcdb0099),LL(0x8b2146d6,0xa45e6fad)}},
+   {{LL(0xc163dead,0x0067623e),LL(0x7a0d0bbe,0xcea413a0),LL(0x07b4842e,0x853ba898),LL(0xa6028a81,0xdeacff41)}, {LL(0xbda19562,0x99355b9f),LL(0x2d72c250,0xfc04c881),LL(0x84708e57,0x113468f8),LL(0x75f116c7,0xd89725c8)}},
+   {{LL(0xef411182,0xe455a4bc),LL(0x2e2d17a7,0x5049893d),LL(0x63dc5c01,0xc95b2819),LL(0x0dba785b,0xdcd71801)}, {LL(0xf14fab55,0x40453945),LL(0x2770ee1c,0x088ce40a),LL(0x06d9598a,0x8279e2d1),LL(0xd4a87bb4,0x5d3c5431)}},
+   {{LL(0xd76ecd51,0x1b38031d),LL(0x46956036,0x9d0e0a2b),LL(0xf0f95393,0xc4032c88),LL(0x2a953c67,0x9f6ef7be)}, {LL(0x2a17bf8b,0x2efbe60f),LL(0x94021315,0x2760a668),LL(0x8539e19f,0x74bb5e1e),LL(0x21abddb9,0x451d1871)}},
+   {{LL(0xc6e4e921,0xebe5af82),LL(0xc974adea,0x112eacf9),LL(0x578527f0,0xfaf339b2),LL(0x189f6f85,0x99f358f4)}, {LL(0xa71afead,0x7dcb8b55),LL(0x8064193d,0x2f1d060e),LL(0xf7ee1c6f,0xa3fd88fb),LL(0xd2cf9522,0x5f04a813)}},
+   {{LL(0x6b84132d,0x7f269818),LL(0xd5a2d648,0xbd168c27),LL(0xb679a0f7,0x9b942ec4),LL(0xbb9cbca9,0xe41de333)}, {LL(0x2e01126e,0x4c872561),LL(0xbfc3eb73,0x22335c0f),LL(0x68ac2fb1,0x240bc732),LL(0xbc85402d,0xb8417023)}},
+   {{LL(0x626b9e21,0x9e7bc606),LL(0xd32f5a02,0x269730cf),LL(0x30c0e501,0x8a7e40e5),LL(0xe193068b,0x8ca204a3)}, {LL(0xd35d15cd,0xe163f0e9),LL(0x81db5ad6,0xe79b972e),LL(0x34ce78b1,0xe77896c8),LL(0xdb32b7a1,0x34013369)}},
+   {{LL(0xba7eecae,0xcd5ea3b9),LL(0x98fb3e01,0x5a181aae),LL(0xebae2976,0xeef18e17),LL(0x7bde6ebb,0x4dfcf855)}, {LL(0x67efcb7b,0x3bd9233a),LL(0x508636c5,0xe239f907),LL(0xfc7d80d0,0x55fa5bd0),LL(0xadd84e62,0x7dff3697)}},
+   {{LL(0xa451ab5f,0x094999bd),LL(0x84f816c6,0xe1e80a8b),LL(0x79365d78,0x1d03e205),LL(0x26aa07ed,0x97867a21)}, {LL(0x87daba99,0x3775f9f6),LL(0xe234f0c6,0xb8e48a60),LL(0xce810a04,0xb5e9da1e),LL(0x7e23eb56,0x507186ea)}},
+   {{LL(0x6d0e2d77,0x712b7e83),LL(0xba762fad,0xd0d01453),LL(0xeaa40c09,0x0b99376b),LL(0xd820a745,0x1c504914)}, {LL(0x988cccbc,0x95253f63),LL(0x890a8f3e,0xa2509639),LL(0x101b2ffb,0x1a1d4e61),LL(0xe8cbd5c0,0x7ef87097)}},
+   {{LL(0xffcb7a5e,0x2d97c48c),LL(0xb53ef365,0xf8e689c5),LL(0x1663f92e,0x77174c04),LL(0xb1092dc6,0x6ecec0e8)}, {LL(0xa32f2627,0x73b9aa58),LL(0x60e59cad,0x8769f196),LL(0x9cc319f2,0x48f0b44c),LL(0xf99f9683,0x7250145d)}},
+   {{LL(0xaba849ae,0x7e64dbe0),LL(0x6c73116d,0x10d1f421),LL(0xed9ede24,0xb328c5ce),LL(0x378b700f,0x88d3ce5f)}, {LL(0x0fbb5ce7,0xc46308c5),LL(0x89080ba0,0xa5645209),LL(0x7421b242,0x20535f91),LL(0x73468b87,0xb781b953)}},
+   {{LL(0x1ea3bef5,0x2d661df1),LL(0xb736aadc,0x7cc327cf),LL(0x29275755,0xc2399607),LL(0xd5f898c1,0xb55bea15)}, {LL(0x43c26d0a,0xda46300a),LL(0x7049da00,0x436028f9),LL(0x8d663ced,0x84b6d22c),LL(0x892f2bbf,0x27a5d632)}},
+   {{LL(0xe11b8c58,0x2d44fec6),LL(0x7e2fa445,0x06227704),LL(0xdb7c9bff,0xcf8478e0),LL(0xb79b045b,0x6cb2c41d)}, {LL(0xb2564709,0x7cc15937),LL(0xa36b06ce,0x8a803fe7),LL(0x0cb3f166,0x5afccc83),LL(0x671829b9,0x99928fa6)}},
+   {{LL(0x95ca27d8,0x30403f59),LL(0x9fa4aaf8,0x932c4cb7),LL(0xc667fb27,0x87582a85),LL(0x90731ac3,0xe2a194ba)}, {LL(0xac93143c,0xc660c61a),LL(0x009a1bd5,0x8f17379a),LL(0x8f31434c,0xd5b8f708),LL(0xda8c6c71,0xddd191d9)}},
+   {{LL(0x764e7cfa,0xce4c98cf),LL(0x737681ad,0xe092319c),LL(0x076aa02d,0xcad0dfab),LL(0x4aba2cab,0x9b3fef50)}, {LL(0xc335cc06,0x0e5be68e),LL(0x2df69968,0xe9b4a0be),LL(0x9b6aac31,0x99a6281d),LL(0x9fbea2d5,0x8ad6fcbf)}},
+   {{LL(0x51b62f55,0x7ca33c80),LL(0xad73508a,0xb38c5137),LL(0x12e0d740,0x8719ef6e),LL(0x465131ac,0x0236cb9f)}, {LL(0x87ad5ee0,0xe2d19347),LL(0xd956804e,0x9ace8527),LL(0x31137831,0x3029383c),LL(0xbd51d617,0x0e5c551f)}},
+   {{LL(0x0a03400d,0xb636f2ea),LL(0xcbcf9cd4,0xd29cc71c),LL(0xeb4d6ec5,0xf2f326dc),LL(0x416b7c93,0x388b949a)}, {LL(0x3c503859,0x666c1b52),LL(0x46a8ccbb,0x884f7922),LL(0x6d3d59d3,0x178e2a1b),LL(0xb4ce82eb,0x7a69df38)}},
+   {{LL(0x2bea8775,0x72269622),LL(0xc39a4f84,0xe56d7ef7),LL(0x3805cbd7,0xb77af11f),LL(0x709678a8,0x0bc7f7ed)}, {LL(0x4f8f3b5b,0x98e34e10),LL(0x794a4df1,0x72db4581),LL(0x2c514b30,0x85006b04),LL(0x6420f8b3,0x85e764c1)}},
+   {{LL(0x3695e174,0xc0dfd5c4),LL(0x0289aa37,0x9f92d788),LL(0x5db20592,0xc134b365),LL(0xc7219c18,0x59b4cbe9)}, {LL(0xac0967b2,0x6a3d1177),LL(0x1ba38ae8,0x8151c2c1),LL(0x412325e2,0xc641909c),LL(0x7dd7e26e,0x48363487)}},
+   {{LL(0x664d826a,0x44042fea),LL(0x4dd40be3,0xdd2c7cb4),LL(0x0d996bf6,0xe59e4dbb),LL(0x8e0229b1,0x6fc0c14b)}, {LL(0xbfa48aaf,0xd4c8b0cd),LL(0x4b99854d,0xa53df3f0),LL(0x275a0924,0xfadf8e66),LL(0x60a07499,0x59d9701c)}},
+   {{LL(0xe655f7ab,0x7114614b),LL(0x5e784508,0x38772b5e),LL(0x92f6f65d,0xfc43a684),LL(0x2eaa12c1,0xd3ee25e5)}, {LL(0xbe46890c,0x816290f0),LL(0xca2c68fd,0x9a4c7bfa),LL(0xa9929b6b,0x3b13bd8d),LL(0x7b407e4b,0xfca82f6e)}},
+   {{LL(0x264fd55e,0x0900fc45),LL(0x01c0b24b,0xc21ac1fc),LL(0x7eb87506,0xa9a3bb2f),LL(0xcf3515e4,0xe75a8676)}, {LL(0x1fbfa819,0x6fba618d),LL(0xee768355,0x107ee98e),LL(0x1854c2a8,0x60a1cd14),LL(0xbdd537f1,0xecfe8ffc)}},
+   {{LL(0x92216e10,0xb9ef2df1),LL(0x544c138e,0x41617a46),LL(0x6146ffa7,0x3c18dc9e),LL(0xa123f0a7,0x65971a58)}, {LL(0xb7236fbc,0x8742256c),LL(0x89e7d9fa,0xb6b01d5d),LL(0x591520f9,0xb89fc499),LL(0x868d093a,0x8b7e518e)}},
+   {{LL(0x864024df,0x12d364cc),LL(0xd3ca249c,0x4e51720f),LL(0xc3e7717c,0xd4018aff),LL(0xbd9c347f,0x3933d2e2)}, {LL(0x73f5e99f,0x552a180f),LL(0x3a85d208,0xd285340b),LL(0xe1ce67fe,0xbb18d80c),LL(0x83c25b36,0xbddacdca)}},
+   {{LL(0xe2ec1483,0xb804a63e),LL(0xb6f378bd,0x1ed5e8dd),LL(0x940d5c8b,0x6e8b785c),LL(0x5db277c9,0x287f910b)}, {LL(0x21697439,0x23e569f6),LL(0x220c21a0,0xf2724c51),LL(0x593d9faf,0x4a2624d2),LL(0x9a767fa0,0x3575ac2d)}},
+   {{LL(0xe373946d,0x0688ee82),LL(0x7d6e0f46,0x53c4f7ad),LL(0x6387c4a5,0xf09c120f),LL(0x034d905a,0xea599054)}, {LL(0x96f47ffd,0xd1c25ac8),LL(0x498c131c,0x79fefc72),LL(0xfd0f04ff,0xe38a9891),LL(0x507ffdb6,0xbabaa0ba)}},
+   {{LL(0xff2c1296,0x5ba5b087),LL(0xb11c65f6,0xd055200b),LL(0xc122b712,0x495c43b7),LL(0xfd49beaa,0x67be7b6d)}, {LL(0xff122ebf,0x4733ae4d),LL(0xbb8aa313,0xa7af0961),LL(0xbb664056,0x37a48675),LL(0x2717b97f,0x1a2e46d5)}},
+   {{LL(0x41c03434,0x27d237ff),LL(0x64392d37,0xff6ac694),LL(0xc8760f96,0x68af23ef),LL(0xebcb4941,0x0db02e9c)}, {LL(0x503c478e,0xd53acbc6),LL(0x59a93009,0x98b57280),LL(0x77106136,0x02eec182),LL(0x60f1a2c9,0x479ceb4e)}},
+   {{LL(0x4ce8472d,0xa65212a6),LL(0x5c5cfb78,0x8a413025),LL(0xe4f6301f,0x809bcfd6),LL(0x8526e445,0x1a4b3e3a)}, {LL(0xd2c21f77,0xc5df37ed),LL(0xb6549a51,0x0a8960c9),LL(0xc2b60bfb,0xf3ee7161),LL(0x2f29d70d,0x4eb121c2)}},
+   {{LL(0x41338a01,0x60517edd),LL(0x8abd8979,0x112b0b06),LL(0x8261cb5e,0x0dfc1bad),LL(0xdd75c844,0x4c5b2df8)}, {LL(0xe2bd0cb2,0x0e431f82),LL(0xb52c3dee,0x5ea5e908),LL(0xe65e3215,0x35f76129),LL(0x238f84dd,0xa8ef1f0c)}},
+   {{LL(0x569acd7e,0x24406c10),LL(0xa43a1a15,0x848f9239),LL(0xb59cb0f7,0x0ed7507a),LL(0xdb5d2780,0xb1cae5e3)}, {LL(0xe36b3d8a,0x8498b35d),LL(0xb0e03087,0xa70017ac),LL(0x5dd40f22,0xa30085ce),LL(0x5e9f036e,0x9cabbb99)}},
+   {{LL(0xcc12ab57,0xfe7cf5e4),LL(0xbd42f670,0x0621ec4b),LL(0x676f990b,0xa757ce1f),LL(0x00fba2a3,0x9a4d8ce1)}, {LL(0xe183748c,0xc197d938),LL(0xff983cfc,0x22d93910),LL(0xe6404bcc,0xe2cddf82),LL(0xe46352af,0xa1ab6b24)}},
+   {{LL(0xaa6e87b4,0x8139b920),LL(0xa4cfd54d,0xdcd916ed),LL(0xce706002,0x25e71805),LL(0xcdb18ca4,0x717afb75)}, {LL(0xce35878e,0x1bbfc81c),LL(0x6489ccbc,0xf7e70779),LL(0x397aa0cf,0x5ee8f301),LL(0xdf7dacf6,0xbae0d113)}},
+   {{LL(0x9d2d58a9,0x4678f24e),LL(0xbecea5d5,0x88dba739),LL(0xe2ed4e48,0x569022de),LL(0xe0c85090,0xfd8fc354)}, {LL(0x0f63048b,0xe9371a26),LL(0x370f7fb7,0xf39141df),LL(0xb70bb9c2,0x506cf28a),LL(0xc693ebd3,0xe40c4ba6)}},
+   {{LL(0x2bb50fa2,0x40f97d5f),LL(0x2e61bce7,0xae3c5460),LL(0xeef27ae0,0x70e55cb7),LL(0x6ce0b769,0xc25f74a7)}, {LL(0xc992a672,0xb005edf9),LL(0x25057d90,0x1f2cb7b9),LL(0xe290f8f2,0xdbdc1707),LL(0xdc59b932,0x28e63855)}},
+   {{LL(0x3c66f759,0xb953884f),LL(0x64dfd55d,0xcf041815),LL(0x7dc7ad53,0x6f2f2f5b),LL(0x8ea1f45b,0x809fdfd8)}, {LL(0xb2bb5cb4,0x881cb8fd),LL(0xc0130d5c,0xd618c015),LL(0x3da65abc,0x7a5e28be),LL(0x8c1189f8,0x4a977c0d)}},
+   {{LL(0xbc603abc,0xec7482c2),LL(0x02c0842e,0xf29bda81),LL(0x79364904,0x902af147),LL(0xb907b3fd,0x26e02eeb)}, {LL(0x72669c2d,0x620d65a2),LL(0x54f64a80,0xa693dd9c),LL(0x9e0a63ac,0x54ad4bcb),LL(0x6ed16504,0x2753fc62)}},
+   {{LL(0x0273ffe4,0x74963c14),LL(0x094c7502,0x678d0c8c),LL(0x22000f27,0xca67f8ea),LL(0xf8dd71ba,0x51dc1915)}, {LL(0x98a9007c,0x794ecaf5),LL(0x86eda8b5,0x59901840),LL(0x8bc88d24,0x968e8097),LL(0x2e7653c9,0xdca279a1)}},
+   {{LL(0xdc26e82e,0x1059d04e),LL(0x58883851,0x555d7463),LL(0xbcc8c9b8,0x587d2fa7),LL(0xa70f9438,0xccd249e9)}, {LL(0x3f042899,0xecd1410f),LL(0xd7b60032,0xab2197cb),LL(0x6e13fcc8,0x7a882b68),LL(0x6069d3c6,0x2b254e90)}},
+   {{LL(0x0a5a7c4c,0x5e32b7be),LL(0xce4348fc,0x7b4cb1af),LL(0x7ea900b3,0x1b2516b6),LL(0xc1ae2dfb,0x657bc42c)}, {LL(0xc84358f7,0x966cf5dd),LL(0x8bbb3dda,0x1ed1059a),LL(0x7ef8cddf,0xeb9c774e),LL(0x7ac60165,0x06a875ae)}},
+   {{LL(0xcea605a8,0xa83ea5c4),LL(0x8654beb3,0x4530c084),LL(0xbf72312c,0x24fabf4a),LL(0xb40c4381,0x24f18918)}, {LL(0x4fedfade,0x3e0ae8f3),LL(0x09e5e629,0xe41efad0),LL(0x4e57c52e,0xf3b59f72),LL(0x2b83b6da,0x9445048b)}},
+   {{LL(0xbfc01a87,0xa9bfe121),LL(0x4322a971,0xe36bddac),LL(0x36dfcf7e,0x69d94ea2),LL(0x362686e6,0x8e1b5a75)}, {LL(0xc3f49f82,0x1c72f17e),LL(0x52974443,0x3721953c),LL(0x5bc862ef,0xcf294740),LL(0xf817443f,0xf17560b1)}},
+   {{LL(0xd9b7d170,0x86496a45),LL(0x30884525,0x328b9067),LL(0xdb0a782f,0x2a3ef99f),LL(0xd99df0b7,0xdd987d4a)}, {LL(0x25a584ea,0x6d3987c6),LL(0x29a5950a,0xe8d0721c),LL(0x57c53b70,0xa59f0d0a),LL(0x24258dbd,0x7be9e7fe)}},
+   {{LL(0x54cc75ed,0x46dae73a),LL(0x7853e5f8,0x394ef4bf),LL(0x36c388de,0x959c2373),LL(0x394765e6,0xf2fb6ec9)}, {LL(0x371b17cb,0x100c6484),LL(0xa9c4cbfd,0x9ea18ed7),LL(0x0de2350d,0xf80633fc),LL(0x953b9922,0x15340a4e)}},
+   {{LL(0x6bb3570a,0x5b7a8841),LL(0x69be38a5,0xaa60c1fa),LL(0x9a4fdf16,0x1d7b8cd3),LL(0x79b7d811,0x4ac796c9)}, {LL(0x41f02e64,0x3add19f9),LL(0x936dc0f5,0x0191319d),LL(0xc649034b,0xecd7b289),LL(0xbcd717b9,0x8727da31)}},
+   {{LL(0x37c3f6d4,0x915efe46),LL(0x4212673f,0xc4c17160),LL(0xaae1dd30,0x700065f2),LL(0xef9e6835,0x1d34987e)}, {LL(0x97481831,0xb9ec9a9b),LL(0x009828d1,0x62963848),LL(0xe2efc59a,0xaaa5b111),LL(0xf0ee5357,0x69c9c45d)}},
+   {{LL(0x744273a9,0x3a0a5e80),LL(0xf8aebce0,0xb90f0618),LL(0x719925fd,0x26097e15),LL(0x7a3558f4,0x1dec5b44)}, {LL(0xfa7716f5,0xdf2b0d02),LL(0x135ffdfe,0x694c2162),LL(0x924109b5,0x4c4326d0),LL(0xb70e0343,0x015ed4fb)}},
+   {{LL(0x43cf9b49,0xe53e0cb1),LL(0xd095d494,0x4bcc085a),LL(0x3377f3a4,0xf822e1ec),LL(0x2194b5e2,0x7a91bed9)}, {LL(0x494cf7eb,0xe4efadce),LL(0xe3c66300,0x54f85cad),LL(0xee1de92b,0xf836ac05),LL(0x797f187a,0xe5594be4)}},
+   {{LL(0x6c2f22ad,0xc8984b8f),LL(0x24eb0638,0x5bc45ccf),LL(0xf9cae64a,0xa3bf76af),LL(0xdd0154be,0xa047456f)}, {LL(0x7fbf388d,0x97abc656),LL(0x7cdbb5ec,0x3982cfae),LL(0x58f7d067,0x9a20958e),LL(0xab24c89d,0x3410d254)}},
+   {{LL(0x10b6dac4,0x3323ecfa),LL(0x82b48e73,0x72162399),LL(0xc053241c,0x008460df),LL(0x6cba220a,0x3f19ea5d)}, {LL(0xf6995f1c,0xb1e67b5b),LL(0xf6bbd860,0x5dbb0857),LL(0xbfad0ed0,0x4a4af8a8),LL(0x0c0c34f3,0x5cdd60f5)}},
+   {{LL(0x9b0bd003,0x8b1d6b98),LL(0xeabfefae,0x00d4d712),LL(0xba53c27d,0x050f03c5),LL(0x79150499,0xb913f4ed)}, {LL(0x60a5bf91,0x2d76d9b8),LL(0x62406523,0x9737f9c7),LL(0x395b42d6,0x283998f8),LL(0xea70af6a,0x89f8239d)}},
+   {{LL(0x903bfe7c,0x0a566bf0),LL(0xfee72391,0x24498e1a),LL(0x832ee123,0x78826150),LL(0x233ab1ba,0xc027ad8b)}, {LL(0x9151585d,0x7fef452a),LL(0x7fd57ba0,0x8ce6f402),LL(0x4a57cf35,0xa71d972a),LL(0x9fe76cf0,0xe1988f3e)}},
+   {{LL(0x253ebc53,0x9c4ffcf9),LL(0xd81e0e7d,0x49d998fe),LL(0xd936810a,0x33170c80),LL(0xa06640b7,0xf4d25f8c)}, {LL(0x70ff78bd,0x72688a5c),LL(0x8c8d0b8a,0x34b07828),LL(0xdf16bea4,0x49c1d0a7),LL(0x1749b5f2,0xe30f483b)}},
+   {{LL(0x2db5c35d,0xf31f4e74),LL(0xa795631a,0x2f4a8d0d),LL(0x456291fd,0x14fc9827),LL(0x9d025d71,0x556bc84b)}, {LL(0x2be2fc0b,0xde9342c1),LL(0xb56220a7,0x19251494),LL(0x3fb9e00f,0x2eccc1b3),LL(0x0b4c5626,0x61ea56fc)}},
+   {{LL(0xc8de583d,0x0b3b54a2),LL(0x18eb3ab1,0xab82996e),LL(0xab894b9a,0xb3c54da2),LL(0x282f693e,0x8461043c)}, {LL(0x2144fe99,0x76fdff0a),LL(0xee262747,0xdcd2cf19),LL(0x50aa1526,0x7d5d4654),LL(0x18a7ec6a,0xd51f0acb)}},
+},
+/* digit=24 base_pwr=2^168 */
+{
+   {{LL(0xe9bafc5b,0x8ef75e07),LL(0x350ded97,0x3d9a8f7e),LL(0xbe5a617f,0x80bd9f33),LL(0x39ac3f81,0x9e4bb187)}, {LL(0x16d6010f,0x862f676d),LL(0x431fad0c,0x57e26af2),LL(0x51b31194,0xa4eabe77),LL(0xe6688201,0xa3c5ad45)}},
+   {{LL(0x0a870b65,0x98578a3e),LL(0x7bf17a8e,0x4c3c1862),LL(0x4c3c451a,0x91d83ced),LL(0x55e87cf3,0x53345fce)}, {LL(0x07bfc06e,0x9fc74ceb),LL(0x63c9c166,0x98f43f19),LL(0x064a11a9,0xd0323a57),LL(0x9f9ab838,0x062daf41)}},
+   {{LL(0xc79e075a,0x78f3382e),LL(0x18a421c7,0x513fa60d),LL(0x9c5819af,0xcc3072f2),LL(0xfa1bb510,0xd7e13b43)}, {LL(0xfa5a4c87,0x9fcde704),LL(0x1b99a2a3,0x8abcd0ea),LL(0x9bd447bd,0x475f27a9),LL(0x3e59c3d9,0xd76a8d29)}},
+   {{LL(0x053928d8,0x816a7516),LL(0x42ae7264,0x7e94f136),LL(0xce07ce23,0x23232c2f),LL(0x4817d6ec,0x01e4a0f2)}, {LL(0xcc20ad14,0x441a9b63),LL(0x0d21ecee,0xfb48322f),LL(0xe18282f9,0x3731da85),LL(0xbebac026,0xc8b9bce3)}},
+   {{LL(0xfb40f6eb,0xaf8cc1ea),LL(0x46da720b,0x6323b09e),LL(0x1d38f39c,0x88ffe8de),LL(0x8130b24a,0xe83c6477)}, {LL(0xeb2d34f5,0x742c9a22),LL(0xb5a748cc,0x1e6d6ced),LL(0xfd9beb10,0xd404e103),LL(0x9afe95be,0x2961fe88)}},
+   {{LL(0x715ec3d8,0xeaebea1b),LL(0x0a12419c,0x041b6a8f),LL(0x7c938a34,0x62dc7c81),LL(0xcdc5fff7,0x82487751)}, {LL(0xe1af59ec,0xa6b66a49),LL(0x9477d26e,0xc3a4bcd3),LL(0x3814db8c,0xf1a11d02),LL(0x68db15d3,0x54eee4f8)}},
+   {{LL(0xbd1e9747,0x6bf7ca4c),LL(0x43ccc4bc,0xb1b6ad54),LL(0x8da84a61,0xc69f2884),LL(0xf9711542,0x0091c7f7)}, {LL(0x453047f6,0xc4e6f225),LL(0x97c7e3e9,0xc596da1b),LL(0xa8f52b67,0xfb13d165),LL(0x1a9c488f,0x19637285)}},
+   {{LL(0x8f55569f,0xbc71da82),LL(0xfcfa8eac,0x994f22aa),LL(0xd125a428,0x7898ca3e),LL(0xd0b7b7a6,0x515a1546)}, {LL(0xb69bf491,0x5a2683b5),LL(0xa42a807f,0x6ba81619),LL(0xc94d5215,0xc0fd26c3),LL(0x18530846,0x62a45aa7)}},
+   {{LL(0x37273183,0x44f318de),LL(0xd8838e64,0xbaf347bc),LL(0xc10bd132,0xf4eda6e2),LL(0x8dc1ad93,0x83c7ede9)}, {LL(0x8cf4ff03,0xe80c62d5),LL(0x2f07b4ee,0x11a7a0a0),LL(0xd98392c8,0xb80b9b6b),LL(0x9a0aa80b,0x204f1d49)}},
+   {{LL(0xf82e970d,0xfdb5cca8),LL(0x776acfe7,0xecf378a7),LL(0x8a831ce6,0x3531fa79),LL(0x09b0801a,0x5700c737)}, {LL(0x535d31b1,0xec42ff0d),LL(0xb33efb8b,0xb6b3971e),LL(0xaea18334,0xfda59073),LL(0x38f2fe85,0x4140f7a2)}},
+   {{LL(0x7f94d561,0xe49d626a),LL(0x13d1f34a,0xf96582da),LL(0x0359aae4,0x3febeb07),LL(0xaeec7460,0x6650f2c5)}, {LL(0xe9cd375a,0xbbe0c788),LL(0x6bdaba35,0x89dd5fc0),LL(0xe55ea70e,0x28372a1c),LL(0x165f93c8,0x7b0783c7)}},
+   {{LL(0x864c3071,0x02504fe7),LL(0x605cfda0,0x36f81f1a),LL(0xbc696d66,0x24e29169),LL(0xcae8bfe3,0xa5825793)}, {LL(0x11284998,0xa83c1431),LL(0x664b7288,0x65c63d28),LL(0xf3d9324b,0x27886c93),LL(0x543e57e3,0xc1113df3)}},
+   {{LL(0xce01b683,0xb0445233),LL(0x7461c4fd,0x24346ceb),LL(0x21de75bf,0x7d041f7c),LL(0x90bb1906,0x9011fb71)}, {LL(0x5a328ef2,0x08e319c5),LL(0x1efefad4,0x6ff65b33),LL(0x7d65c69f,0xfbd3b5de),LL(0xd3217d60,0xd4334974)}},
+   {{LL(0x7a26a34a,0x839d8213),LL(0xc274ec2d,0x286f5ba1),LL(0x549d467a,0x70b11e5d),LL(0xbab21acb,0x32abb599)}, {LL(0x56050248,0x1749ff50),LL(0xab6e3518,0xae09381d),LL(0xb7c7cbaa,0x130f2230),LL(0x58ad63c8,0x95bd0212)}},
+   {{LL(0xd818b029,0x89df17fc),LL(0xadcead52,0x3adfa8ea),LL(0x5e5e6bac,0xa053996e),LL(0xbb513548,0xe0520b75)}, {LL(0x83619988,0x48a308ab),LL(0xdb876ff9,0xe670a46e),LL(0xeb25b46a,0x9fa01e90),LL(0x3ec94540,0x216a79ed)}},
+   {{LL(0x63ec25d5,0xb7ff1e3c),LL(0xdb0e0ecd,0x34eb853d),LL(0x8585f678,0x6abf274e),LL(0x042f940f,0x1c5631cb)}, {LL(0xd878876e,0x9316062e),LL(0xf646f4da,0xe33fb504),LL(0xe8325e17,0xbe768e51),LL(0x34669720,0xa149fd9f)}},
+   {{LL(0xcd5e8c42,0x52ae1c9a),LL(0xe96f83e0,0x5649a760),LL(0xb00f406d,0xe2dfbc7e),LL(0xe515ee81,0x2c16e595)}, {LL(0x23bda404,0x8f70c727),LL(0x1037f4ae,0xab3f81cb),LL(0x6e1cbe88,0x8aee1626),LL(0x68bdcdeb,0x00ac9330)}},
+   {{LL(0x0839925e,0xbd59e52e),LL(0xe74147ab,0x745c4654),LL(0x1cc8fd73,0x62c74da2),LL(0x3ca8d5b8,0x4d6d0a79)}, {LL(0x6cf71f79,0x1abb8eb1),LL(0xf6e73158,0xf992f48c),LL(0x4743b2fb,0xbd762b6a),LL(0xa3dd2d7d,0xff10d92a)}},
+   {{LL(0x398a66bd,0xaeb951ba),LL(0x525464cc,0xbabecb98),LL(0xf0626fcc,0x58f1306d),LL(0x93589d0e,0x657e556d)}, {LL(0xeb8bc568,0x6e335253),LL(0xdf326998,0xadeac526),LL(0xc3dac9ab,0xe95ebd63),LL(0x7e08328b,0x640affd8)}},
+   {{LL(0x7c6bcd50,0x67d17cb6),LL(0xd22afa9d,0x53d2035e),LL(0xad10c93f,0xe090f72f),LL(0xff7177c5,0x3fe3363e)}, {LL(0xc9eabc39,0x4bca027b),LL(0x3772aa3b,0x6cd8125d),LL(0x33beb0cc,0xddecb4ff),LL(0x48dbca34,0x93106dbb)}},
+   {{LL(0x3fcb7c56,0x8f78b26f),LL(0xfeec7f95,0x7070a91b),LL(0x1e24ed7d,0x46993a5a),LL(0xb475ac69,0xf4767e86)}, {LL(0xba185179,0x823414d5),LL(0xb759b040,0x8e483070),LL(0x0b9f92c1,0x11c0b695),LL(0x480fe0b5,0x0550cc93)}},
+   {{LL(0xedb902fd,0xc22171da),LL(0x8cbe07a5,0xb957c764),LL(0x8afac027,0x2448debc),LL(0x4929336f,0xf92a0c7b)}, {LL(0x70a74661,0xc0030a25),LL(0x321f75d1,0x059a3b2d),LL(0x36778dc2,0x9b148cad),LL(0x9f065b65,0xe5bb5bfd)}},
+   {{LL(0x0acc348c,0x7f4eba88),LL(0xc52c9f87,0xf32176e5),LL(0x626a59a6,0xe46dbdf7),LL(0x3a0a93bc,0x378e1c67)}, {LL(0x9a09155d,0x35115b1f),LL(0x8f7bb886,0xe8cfb1e4),LL(0xbb5d6ed5,0x8b41023b),LL(0x757b7a36,0x811345aa)}},
+   {{LL(0x83df4716,0xe1f4f272),LL(0xb74e9b14,0xf74df238),LL(0xd6b77a6c,0xf0e3b055),LL(0x69a6fcb1,0x3c83cd8f)}, {LL(0xa1cab5cc,0x3242efb0),LL(0x88984cac,0xacfd414d),LL(0xd5d906f3,0x577ae54f),LL(0x697066d2,0x6986a53b)}},
+   {{LL(0xea00b990,0x90e2af0f),LL(0x7158885b,0x9cb0453f),LL(0x8e7a57d2,0xf9d0eb76),LL(0x2c9d875f,0x51ae1283)}, {LL(0xcf6163c6,0xc0a7ee6c),LL(0x019ec7a4,0x3232ea57),LL(0x4a0e43fa,0xb02834c6),LL(0xb490e6c3,0x84574f7b)}},
+   {{LL(0x9d21f7a6,0xf7e94726),LL(0x6d3aecab,0x558c1977),LL(0x4068045f,0xfde9440f),LL(0xfd5f0314,0xb5d8551d)}, {LL(0x8c0c481b,0x8ba68084),LL(0x5a8f79a1,0x5e71d6c6),LL(0xc56b0108,0x49b97695),LL(0xa1e9eebe,0x15ba180a)}},
+   {{LL(0xb69b68d9,0x9c4fda90),LL(0xeec1adbd,0xd2971385),LL(0x5e1c90de,0x840ffb07),LL(0x2ca26bf7,0xba414a19)}, {LL(0x0b81e898,0x5f39d9bc),LL(0x2ff18a05,0xc9a42925),LL(0xabde2cfd,0x533fb463),LL(0x43e6be0e,0xe663a9e0)}},
+   {{LL(0x03333e51,0x5d4ad42d),LL(0x18ac0012,0x91ae8bff),LL(0x2547848d,0x372a1896),LL(0xf66137e4,0x9674b667)}, {LL(0x99da2e79,0xeb990770),LL(0x30aec97a,0x895b9a52),LL(0x12360e0b,0x0aab007d),LL(0x65466cc1,0x4bb34e4a)}},
+   {{LL(0xfd25d8a0,0x27a34a2a),LL(0x69cb2927,0xaafea16a),LL(0xe6dc75fc,0x0e11ac80),LL(0x2d34487a,0x9c8765d1)}, {LL(0xbad0d9da,0xae64f510),LL(0xa0e73b2f,0x7961edd7),LL(0x6fbe5743,0xca525961),LL(0xbdf203da,0x64213d85)}},
+   {{LL(0xbcaa4f6c,0xd198358b),LL(0xd9d7c488,0xf88d65b6),LL(0x2786a271,0x1084398e),LL(0x47414887,0x3663203d)}, {LL(0x5fca39f6,0xcf2a1de6),LL(0x934f3e14,0x0bb2cc4d),LL(0x4b77050d,0xf3be7aae),LL(0x9b28afb0,0xe34237f6)}},
+   {{LL(0x4d74701b,0x35d2f26d),LL(0x2bcec1c1,0xaafcf32d),LL(0xa89a4303,0x7e6d5411),LL(0xd16d3799,0x893d49be)}, {LL(0xbe6fc0cb,0x595bc68b),LL(0x7e0f210c,0xf6c5187a),LL(0xb72abee1,0xce81c62a),LL(0xb97009d2,0xa2df9c2f)}},
+   {{LL(0x253fc4d8,0xcca2d240),LL(0x6bbce9fd,0x665bd37c),LL(0x1894ef09,0x06825935),LL(0xe1e94d49,0xb778698d)}, {LL(0xd000ae5b,0xf7375453),LL(0x3cf25ac5,0xff480ab3),LL(0x5bd55565,0x7e9c73cd),LL(0x9e93c4dd,0x8b94ccdb)}},
+   {{LL(0x72fb6273,0xf1bb5a4a),LL(0xaa70e149,0x4c43ed72),LL(0x9bd0fdcc,0x0fa2fc60),LL(0x1edbfb07,0xd5f1da21)}, {LL(0xdfc8fbd0,0x807d0730),LL(0x2f3f38a8,0x35d70a63),LL(0xa28d1263,0xbc8f4609),LL(0x6a8b5dbe,0x3914eab7)}},
+   {{LL(0x595e2cb4,0xf7f12108),LL(0x5002cf1d,0x4291eedb),LL(0x5aa22cac,0xf4952ca1),LL(0x0b7fc122,0x26165608)}, {LL(0x5328fa99,0x1124ade4),LL(0x2def25ec,0xe6a8df39),LL(0x6bbb637e,0xea2e520c),LL(0xc53c4119,0x014b1241)}},
+   {{LL(0x82f10b6f,0x8d62f18c),LL(0xb6237ee7,0x0ae65a6c),LL(0x0b3854b1,0xdd80b18d),LL(0x1513bb62,0x9973bced)}, {LL(0x9de2ad48,0xde57beaf),LL(0x535607cf,0x5e910743),LL(0xe081ec0b,0xe9db2147),LL(0xd6605e3e,0x6c8de2e1)}},
+   {{LL(0x358f2214,0x6355232f),LL(0x7a68b1af,0x4d2e16e8),LL(0x36fca6bb,0xfa1c0ee4),LL(0x3f86774c,0xc72d46c0)}, {LL(0xf43b746e,0x1a7c248e),LL(0x8ce45bc2,0x9e6bda4c),LL(0x5f1b337e,0x5d034c38),LL(0x839736de,0xe409c5b3)}},
+   {{LL(0xd4cdaff8,0xed0cf963),LL(0x79f001ba,0x44f02b38),LL(0x2ccb8140,0x7b96b3e2),LL(0xfd7a65e5,0x75f3b4f4)}, {LL(0xff127853,0xc3c2526b),LL(0xb821d579,0x83a1af5a),LL(0x7595fcb5,0x38cdec4c),LL(0xfc5087ef,0x451f3488)}},
+   {{LL(0x53a1067e,0xff4d9a56),LL(0xce726373,0x0fa1e3d3),LL(0xc7a2531a,0x44b09eb4),LL(0xb9bae1c3,0x85a08d4e)}, {LL(0x57e30df1,0x6f648df2),LL(0xfa99a590,0x7031c30e),LL(0x97279447,0xee774ac4),LL(0xfc4aa4bd,0x209db32c)}},
+   {{LL(0xd00162c5,0x16f00f86),LL(0x2a764e84,0xc07cd7cf),LL(0x1ca65433,0x1d5a8a3c),LL(0x23c3274e,0xc8312332)}, {LL(0x219e36c6,0x98e54063),LL(0x1ef7cfbc,0xdc58b7ac),LL(0x8e038501,0xbeb62f4b),LL(0xcd395d95,0x4e561ec2)}},
+   {{LL(0x7b52d899,0x5f30a6ad),LL(0x6fe6a324,0x8469e0d3),LL(0x66e1b790,0x134efc67),LL(0x0c79ff66,0x83dd2026)}, {LL(0x2f34ec0b,0x86eb118e),LL(0x2e88dadc,0xad065ae3),LL(0x210e9f07,0x360b74e8),LL(0x84399899,0x7fd3a220)}},
+   {{LL(0x07a40d1f,0xc773de10),LL(0xd13c775b,0x154a177c),LL(0x45ad0c8b,0x95414d0b),LL(0xe99f15a5,0x570e5eaf)}, {LL(0xff16d767,0x2d4cebdf),LL(0x29a4fdf6,0xba1ff6c2),LL(0xf688c671,0x130c0c04),LL(0x9f45e0e7,0x22bec62c)}},
+   {{LL(0x1e2b0a63,0x32d45e09),LL(0x37c34218,0xdae1e68d),LL(0x7209b7bb,0x23be8e9a),LL(0x40491232,0xba0e9cb9)}, {LL(0xba0682b7,0x8e031260),LL(0x10ddb86c,0x297555a4),LL(0xa76c7360,0xd198646b),LL(0x5a586007,0x3b75b785)}},
+   {{LL(0x7edb2dc2,0x8b59709f),LL(0x51786d93,0x44f6a309),LL(0xb63c9913,0x9169b4f4),LL(0xdbe8e2b3,0x8ca079c3)}, {LL(0x7abc8a61,0xa880c111),LL(0x59ddd254,0x70a8145a),LL(0x63becc50,0x02a63419),LL(0xfbbad322,0x6ec2ef3a)}},
+   {{LL(0x45cbf3cd,0xc2dfe29d),LL(0xef2d2092,0xa89376e9),LL(0x0c966d8c,0x383bfee1),LL(0xc007fb2f,0xc0565256)}, {LL(0x5fe005a0,0xd301e371),LL(0xb1e72bee,0x964ef9ab),LL(0xcf2d4524,0xc94ed7d4),LL(0x76f3eab9,0xb06a72dc)}},
+   {{LL(0xe55b0ab2,0x48c28889),LL(0x65694bcf,0xbd612f05),LL(0x0f467ffe,0x20074294),LL(0x47ef9d56,0xfd7a507e)}, {LL(0xe4e4d8c6,0x42188941),LL(0x1fbd47da,0xc2c56cbe),LL(0xb5bdd7ab,0xf792f4c3),LL(0x4d69fd85,0xc6399760)}},
+   {{LL(0xef280b0d,0x505ab038),LL(0x006c1f94,0x651fdcb6),LL(0xfa2991d2,0x7339ee2d),LL(0xd54c9bb6,0x1b1a7cc6)}, {LL(0xd2904b41,0x8dede945),LL(0x09e4e059,0x52d040e1),LL(0x7ac78d98,0x7b445194),LL(0x843eefdc,0x7e8a7150)}},
+   {{LL(0x40134333,0xac8a06ef),LL(0x164b93c7,0x9560ebf0),LL(0xa3185f3e,0x388b3852),LL(0xc32a5275,0x82d5c7bd)}, {LL(0x634d0cc5,0x55be0701),LL(0x8d5f6d9f,0x6b197517),LL(0x73e95ab4,0xc0230337),LL(0x91d4022f,0x444dd5b5)}},
+   {{LL(0x91113dde,0x9d143506),LL(0xfaa36cd3,0x96cf601f),LL(0x84c9ad57,0x5c3e3e34),LL(0x40d2a664,0x23bfe8fa)}, {LL(0x0b0e3449,0x6aa979c8),LL(0x512709f7,0xd6826281),LL(0xdddcf6f8,0x0b325140),LL(0x3b96457c,0xfe84573c)}},
+   {{LL(0x1c309f88,0x59abefee),LL(0xa8724347,0x33477c3a),LL(0x60706b11,0x33403ed4),LL(0x4495c3e1,0x51bed1b0)}, {LL(0x7a24f3c1,0x665cfeb3),LL(0x1c308351,0x8192a4b8),LL(0x4141a529,0x6e4517e6),LL(0x67b867da,0x5759ea77)}},
+   {{LL(0x26232ec9,0x7aab9945),LL(0xa64c5dc0,0xa824cac6),LL(0x64ff47c2,0xf21a0cd4),LL(0x7805a5d1,0xae2d21f8)}, {LL(0x3ca8a790,0xd623bfb8),LL(0x86d4a756,0x13b0fc4c),LL(0xfacb1168,0x241d21a8),LL(0xa934f338,0xec6f6010)}},
+   {{LL(0x0f31d290,0x634a0a9b),LL(0x763daea5,0xcf92c5ab),LL(0xe77b0d53,0x0b806f9e),LL(0xb28ef216,0xbc8fd127)}, {LL(0x39513a56,0xbf91047a),LL(0x413325a7,0xea955643),LL(0xf4393f5b,0x66bb6903),LL(0x3233f106,0x531d2061)}},
+   {{LL(0x76d1cdc3,0x4a3982de),LL(0xb2b7c677,0x0229ec30),LL(0xeabda9e6,0x5bae8379),LL(0x3ca82336,0x8c2e812d)}, {LL(0x2141b693,0xa545eb61),LL(0x250b6c43,0x499d3300),LL(0x448e4754,0x92e773d3),LL(0x865b3e06,0x92b8b5f0)}},
+   {{LL(0x9f416b6b,0xa451913a),LL(0x9ff52642,0x5e0ca98a),LL(0x7ea302d4,0x45680474),LL(0x807aa7f6,0x6fd6ad8c)}, {LL(0xadb8e7c9,0x52a0586e),LL(0xa11c24b9,0x83e8df6b),LL(0xdf0e5a3a,0x759c627c),LL(0x7d5a5096,0xb90025e2)}},
+   {{LL(0xb5aa4c54,0xdef53e38),LL(0xce92b7d7,0x1988ffd4),LL(0xa3e477e0,0x57327da8),LL(0xb1865433,0xbb71fb98)}, {LL(0x77f9c1e4,0x9626f672),LL(0x79739e8a,0x3920c877),LL(0x1d4f81f9,0x79c89490),LL(0xa80c8777,0xe3bb110b)}},
+   {{LL(0xeaf8f1c9,0xfcf41c59),LL(0xb04e5cb6,0x1232d0fd),LL(0xb8a0d147,0xfd53510b),LL(0x50440a49,0x00f8f8c1)}, {LL(0xfd9ef05e,0x01051ba9),LL(0x784fa874,0x49e4bce7),LL(0x25e12ef8,0x05570857),LL(0xba63cb92,0xbc3f1a78)}},
+   {{LL(0xdf6384da,0x2fdf52f9),LL(0x2f4ea5a4,0xc39b1102),LL(0x4038f947,0x33e2b15d),LL(0x7afe609b,0x4e8708ec)}, {LL(0x9c267384,0x5244dd3d),LL(0xe4521f6d,0x0998fe3b),LL(0x82b3e5ae,0x2f9edfc3),LL(0x50d40739,0x9c1e9cac)}},
+   {{LL(0xc088273f,0x1ece668c),LL(0x4e936fd9,0xf93a1c0c),LL(0xc156b8af,0xe2190269),LL(0x13b61c2a,0x8deb3e20)}, {LL(0x5ca80b2f,0x80270a39),LL(0x50c1cfa4,0x4d14e5d7),LL(0x8e3d93d8,0x432dfb5a),LL(0xb6342251,0x63747a4a)}},
+   {{LL(0x204fbd2f,0x27ea3a2a),LL(0xb80fdfe6,0x7984bb43),LL(0xb02de84a,0xa37c34f2),LL(0x2c8c972c,0x0b1a644b)}, {LL(0x0bd18ab9,0xd798b88d),LL(0xbca6cd73,0x575e7634),LL(0x98c4eaf0,0xf9eba2c3),LL(0xb68a46a9,0x29fad702)}},
+   {{LL(0x0c5d558c,0x041e97b6),LL(0xcbdb9128,0xd63447b7),LL(0xff2eb943,0x23db3b1e),LL(0x466b8d63,0x4365bb09)}, {LL(0x37ee656c,0xc7753dc7),LL(0xcdc6e682,0xd579789d),LL(0xe8119095,0x89f47cfe),LL(0xae3ee575,0x437ffb9d)}},
+   {{LL(0x38815ece,0x2574779d),LL(0x51c44c46,0xcb2740a8),LL(0xed7a76ff,0xba413fe7),LL(0xbf0ae035,0xb9eab0d8)}, {LL(0x32bdf3a4,0xa811ced0),LL(0x74cfafa7,0x6ad5d116),LL(0xbdeb82aa,0x880f52a6),LL(0xec63b3ad,0x1231d57b)}},
+   {{LL(0xcb59ccf9,0x309c0378),LL(0xba9edab3,0x1d7df69f),LL(0xc99dedb5,0x7f7ac99a),LL(0x895b3f46,0x8f80e9e5)}, {LL(0x22c33905,0xcd131ed5),LL(0x75e6b3ba,0x14549812),LL(0x654e450a,0x582d0e52),LL(0x74d16dfa,0xde1c0d1a)}},
+   {{LL(0x61f9e183,0xc3be7088),LL(0xf80d3cac,0x4a5c99c3),LL(0xb0e34b3a,0x5b40c364),LL(0x839042ea,0x69909c81)}, {LL(0x8f0c95f8,0xb7ef4f47),LL(0xafc8e9f1,0xe3056c6f),LL(0xb75c89ee,0x22d3c2c1),LL(0x950def5d,0x62b674ed)}},
+   {{LL(0x49ea463f,0x41c243cd),LL(0xc56fb03a,0x23534ee6),LL(0x247440db,0x7fc03e5a),LL(0xafc42f6b,0x27678ecd)}, {LL(0x98928b47,0xf374ff7f),LL(0x354df077,0x7564fbf8),LL(0x16d6633d,0x42672973),LL(0xbb99af31,0x0b38bb32)}},
+   {{LL(0x2bc3aae2,0xc41f3915),LL(0xb3e50c95,0x647c4281),LL(0xf96fb010,0xad4c2ad6),LL(0x177625fc,0x7226aecf)}, {LL(0x84607f8c,0x37ba555d),LL(0xb543a91d,0xa03071cb),LL(0x053d0710,0x3d211ac9),LL(0x5c2a1d89,0x164fa46a)}},
+},
+/* digit=25 base_pwr=2^175 */
+{
+   {{LL(0x4e52ea93,0xc04700aa),LL(0x045fc580,0xfabef0f2),LL(0x7576a121,0x5dc7a669),LL(0x4199b106,0xc9fb39cb)}, {LL(0x82a264e5,0xd32e50b5),LL(0xbfb73909,0x74602584),LL(0x5a6d6668,0x302beabc),LL(0x1d9d4cb8,0x36a212c7)}},
+   {{LL(0x161994bd,0x1e41e6c6),LL(0x3bbe1a5a,0x826e3e7d),LL(0x1959a233,0x96eef1a9),LL(0xfddbccd2,0xda19b770)}, {LL(0x043ecc44,0x4ef2d04b),LL(0x717959f3,0xfe0a70e2),LL(0xe4d35ace,0x9cb08894),LL(0xe624edd2,0xe7f33491)}},
+   {{LL(0x4eafb50e,0x89840192),LL(0xbc3cfd37,0x5fe9994d),LL(0x2e10d7c8,0x3ef558a9),LL(0x140bcc77,0x4abb40a5)}, {LL(0x798f8beb,0xabd31a08),LL(0x8c6669cd,0x0843cc64),LL(0xa28bc830,0xcd558020),LL(0x79713c2c,0xc0c63c85)}},
+   {{LL(0x22a925ab,0x30050eab),LL(0xc17fa9c3,0x04ca1b18),LL(0x2e78c658,0x65cefeab),LL(0x7438db43,0xc41fad72)}, {LL(0xd4e767c2,0x325ed5fd),LL(0x2f231c8c,0xf8f23432),LL(0x461be3ba,0x4113b363),LL(0xf05d9065,0xdb7f3ed1)}},
+   {{LL(0x9646251a,0x3a8d5550),LL(0xd273850f,0xfe297376),LL(0xdaff290d,0x3ef52e26),LL(0xf385f499,0x7cb0d6dd)}, {LL(0x8dec986c,0x524a7098),LL(0xefa55e90,0x84c67830),LL(0x358d7293,0x0d67894c),LL(0x53029c5a,0xf61f2f09)}},
+   {{LL(0x61a84855,0x48f3da82),LL(0x0f833d73,0xaba0fd9e),LL(0xca2a4697,0xb394fc65),LL(0x235b671b,0x6d1396d7)}, {LL(0xd30eadfc,0xd0e4f469),LL(0xbbba35d9,0x7793c845),LL(0xe6720c17,0x8a1df169),LL(0x692513d6,0x61a6ad6c)}},
+   {{LL(0xf420f571,0x10d99829),LL(0xb95f58ef,0x3a3e7e29),LL(0xe33df5c2,0xa84ce91c),LL(0xbeb27809,0xdc752a6e)}, {LL(0xed4165f2,0x2f0a02e4),LL(0xde82f50c,0x38fe6c27),LL(0x32823cda,0xe6cc175b),LL(0x12114c5b,0xde84bc57)}},
+   {{LL(0xdb30b8e4,0x11a6c189),LL(0x86e86078,0x05c8c37f),LL(0xc1d86e41,0x49e7b2a2),LL(0x5b7ec203,0xe2d5caf2)}, {LL(0x6e0bc3f6,0x9b2d14c8),LL(0xfb1996c3,0xbccfc175),LL(0x9146034d,0x656d7341),LL(0x4ee15b9e,0x1b52695f)}},
+   {{LL(0xe3d7a9ba,0x6a718a09),LL(0x8179c743,0xd23dab15),LL(0x18a8fdb3,0x42a14dc3),LL(0x9c06c76e,0x1a83b315)}, {LL(0x3532661f,0x0511d88f),LL(0xde1c9620,0xf87f9293),LL(0xc593a8ad,0xca7bf58d),LL(0xeeccb139,0x99a2bb9d)}},
+   {{LL(0x806b9289,0xb5f6d463),LL(0x3a6b0c34,0x3ea598cc),LL(0x584f7281,0x15f45b42),LL(0xbc7ae6a1,0xe1d5c601)}, {LL(0xc047baf7,0x54e77c12),LL(0x8d094856,0x8a28dacd),LL(0xc966a377,0xf97a4708),LL(0x1194bcb1,0xab6d968d)}},
+   {{LL(0xf793fc69,0x86e91ad3),LL(0x35fd1d40,0x7308564a),LL(0x25209cd2,0x2fe6eda9),LL(0x2181b37e,0x4131f882)}, {LL(0x8b2746d4,0x482b71d7),LL(0x62457606,0x2ded4edb),LL(0x228716ef,0x7a3ab372),LL(0x052615ba,0x7b9a7fe7)}},
+   {{LL(0xdd66df72,0xa1a419c0),LL(0x220d437b,0x3d6163e1),LL(0x48f65b65,0x66f4ab96),LL(0x24c1b07a,0x7bf2e166)}, {LL(0xf7d59ed7,0xa5f752da),LL(0x397002b2,0x822a36a7),LL(0x95a0eef2,0x2217d8ba),LL(0x112130cf,0xc638e2ff)}},
+   {{LL(0x8200243f,0x1f8f33b0),LL(0xf3fd98f5,0x5e04f7a0),LL(0xa035040f,0x7284fb93),LL(0xbd7dca09,0xf0ea970a)}, {LL(0xcb70cfcc,0xf7ad211b),LL(0x00e02e91,0x725c6209),LL(0x08fc63f2,0x267c0248),LL(0x40288b14,0x6e0015a0)}},
+   {{LL(0xfee7400a,0xf54e8f53),LL(0x5440ecb8,0xcbf23a53),LL(0xe144a499,0x671454fe),LL(0xc2f2417b,0xe4271d4c)}, {LL(0x1192e312,0x9959256a),LL(0xf136183b,0xb6047a30),LL(0x1401c327,0xdab5ac05),LL(0xf2165db9,0x6e6be56e)}},
+   {{LL(0xaaddadc9,0xa5e3e4d4),LL(0x70d67be1,0xaf17c26b),LL(0xba97e68f,0x1517e454),LL(0x7734bb47,0xe5b648b9)}, {LL(0xfe16ba3a,0x49897279),LL(0x2a8e44fc,0x7f06ea39),LL(0x4a35a161,0x1d224d07),LL(0xe0dd23e2,0x8193386c)}},
+   {{LL(0x8d50f5e5,0x129991cc),LL(0x9bb3eb63,0x8bd33e4c),LL(0x55237dc7,0x265d11e8),LL(0x097c7dd8,0x1b18a622)}, {LL(0xdc82b2f0,0xa70c971b),LL(0xb46475dd,0x8a327174),LL(0xa02937bf,0xc691c628),LL(0xb25bf0c1,0xe0116a1a)}},
+   {{LL(0xe08d1c31,0xf664575b),LL(0x846b10e1,0x861b19ec),LL(0xbc503595,0xd0f252c6),LL(0x67311903,0x4bdc115a)}, {LL(0xea73aedc,0x9ae6a005),LL(0x0c74dcd7,0x740e084c),LL(0xece2c272,0x7f8fded9),LL(0xb81398e3,0xa1aa7af3)}},
+   {{LL(0x1e68ac58,0x0eadd7ba),LL(0x05e7a8c0,0x6963f5e7),LL(0xa92975ec,0x62bc8e20),LL(0x52212edb,0x7d3d6a26)}, {LL(0x9382fac9,0xb7f552ba),LL(0xa173d279,0xc30f74ea),LL(0xf689bf28,0x39f4255c),LL(0x043f8c73,0xd4c1031c)}},
+   {{LL(0x31efd4fd,0x06217bc8),LL(0x81e85f8d,0xd7c74ee6),LL(0x6d4d5b87,0x026d44b6),LL(0xa3d3d64a,0x02b527a5)}, {LL(0xc7c583c6,0x08040736),LL(0xe2d48f57,0xc907dfff),LL(0xb878086b,0xfdb026b2),LL(0xdb8d9fdd,0x18df5786)}},
+   {{LL(0xc3f6f6eb,0xecc2e3bf),LL(0x2e4fd949,0x8c6233d2),LL(0x8c19dfda,0x9ff84df0),LL(0xc904b53b,0xc3684199)}, {LL(0x2ed805a0,0xad916740),LL(0xbb9bc118,0x86d86fec),LL(0x831e2f8d,0x877592ca),LL(0x37c00fd1,0x937979a7)}},
+   {{LL(0x94e93ff1,0xdfd5b943),LL(0x0d7ec09f,0x9f3dba56),LL(0x2a3e45bb,0xd48c9819),LL(0x59767c8c,0x7598d955)}, {LL(0x570e2f7c,0x78f3b73f),LL(0x5ca8986f,0x80cf1d8f),LL(0xe09aed6a,0x85fd5b44),LL(0x016458e0,0x9dbc9e8e)}},
+   {{LL(0xe0658781,0x5a04432d),LL(0xbe1929aa,0x4f203a2e),LL(0x3f6f221f,0xebb4daec),LL(0x35d1aeef,0xff4411db)}, {LL(0x44ba9de5,0xe0a08abf),LL(0x7ea89691,0xd9d3fc15),LL(0x30688617,0xcd46c3ec),LL(0x8a0734ee,0x373f16f4)}},
+   {{LL(0xffbabf7f,0x48180188),LL(0x7222fb2e,0xeea6d2ee),LL(0x6a54ec5b,0x3d474834),LL(0xdc46b1d6,0x737129a0)}, {LL(0xdd7ee10d,0x55286060),LL(0x258d0e1f,0xc51c03e0),LL(0x28a9241a,0x4efd2825),LL(0x260685f6,0xfb65a110)}},
+   {{LL(0xce187425,0x5660e8b7),LL(0x5cd84819,0x561d2ba5),LL(0x70e054c9,0xf9d5e4cd),LL(0xd22f695d,0xf675f65c)}, {LL(0xc9bb644e,0x795c01d5),LL(0x9b850e12,0x672e2eb4),LL(0xca1ea12f,0x2ab5d236),LL(0x9beb4af0,0xe35e8cf2)}},
+   {{LL(0xe5b9fa23,0xc1df0ba3),LL(0x42fdbd7a,0x5a08b4e1),LL(0xcdc540d1,0x68e819ec),LL(0x87880bf0,0x5e3d1fdd)}, {LL(0xffafd344,0x645c40b1),LL(0x6575e52c,0x6e9d3416),LL(0x294ac0a1,0xb2e7d3c5),LL(0xcdfb4a4a,0x37efa549)}},
+   {{LL(0x26b755d6,0x21ff71d7),LL(0xa6bc1bf1,0x0a54a557),LL(0xc3c6ae77,0xeada3cf2),LL(0x37e04bcc,0x6bad9c4f)}, {LL(0x9a23232a,0x8f73c6d7),LL(0xb5dfa064,0xe5c6d4a4),LL(0xf0fa7ca0,0x309fe482),LL(0xcdda03ee,0x4301332a)}},
+   {{LL(0xbe7d18d8,0x03f1bee7),LL(0xe48d21bd,0x4cc197ea),LL(0xe283905a,0x3bc1730c),LL(0x7716a7e5,0x48ef9c77)}, {LL(0x7e7cdf03,0x858159cf),LL(0x181db8e2,0x075bde91),LL(0xb91d37a1,0x41dc21dd),LL(0x27ce2ffb,0xa8c2d028)}},
+   {{LL(0x9b95abef,0xd91e4b87),LL(0x15d527b6,0xcf266296),LL(0xbe77897a,0x220c63de),LL(0xe1db621e,0xe2e9aaef)}, {LL(0xef78abe9,0x6ff70ca7),LL(0x606c6691,0xcbac3b6d),LL(0xc1b3edb0,0x853c8652),LL(0x6c950049,0xe9991ca7)}},
+   {{LL(0x0f3dfe94,0xc7996707),LL(0x2b157224,0x8f587f77),LL(0x79d4a8fe,0x15305efd),LL(0xf8b1c628,0x8ecdcc76)}, {LL(0x43296f3f,0xdee6f4ff),LL(0x9a611d96,0xef451f15),LL(0xb866ac8d,0x0cc52efb),LL(0x2a948958,0x4341c0a7)}},
+   {{LL(0x6e606237,0x572e50e1),LL(0xb5c36fd1,0xc353ebf6),LL(0x8f336b04,0xbb424ace),LL(0x7a1a3f2c,0x41070a8d)}, {LL(0x44d216fb,0xba899da7),LL(0xd9ae60d2,0xc3c67a0c),LL(0x7b0adfe6,0x4239c94c),LL(0xcb9113de,0x31707fce)}},
+   {{LL(0x9fbeec11,0x8e979d1a),LL(0x3a31b9ca,0xe91ebacd),LL(0xe7c6dec1,0x803942a2),LL(0x97a014a2,0xd228f45b)}, {LL(0xf2b12d42,0xb1632b5e),LL(0x4924fa25,0xe8f884ae),LL(0xcf16c567,0xd5fc2617),LL(0xda7e2d6f,0x7a1b6a5c)}},
+   {{LL(0xbe92a7b3,0x4ce5f7df),LL(0x73b3343e,0x47b3ae5b),LL(0x5b420387,0x50f4f84e),LL(0x88310928,0x9f0ab1f2)}, {LL(0xb12d1d1c,0x74ebb140),LL(0x31ac2cba,0x0ae6cedd),LL(0xc21bdd1e,0x32723384),LL(0xd5c6c2ca,0x6f96281a)}},
+   {{LL(0xa0b39ee0,0xc748d465),LL(0xd88192ff,0x6eb164e5),LL(0x274b529d,0x1683dadb),LL(0xae309351,0x2b10f764)}, {LL(0x08d75d9e,0x0883e08e),LL(0x38811957,0x1f8aa37a),LL(0x1d8b85f3,0x8034dc02),LL(0xd79088ab,0x84ea1f05)}},
+   {{LL(0x6862b81b,0xf07dea5c),LL(0xfe35a6dc,0xa8fc7555),LL(0xa1b82f01,0xda4e60ba),LL(0x6ffd7625,0x244d2600)}, {LL(0x9f90ff63,0xdf8fb6f5),LL(0xab38eb94,0xad672b7b),LL(0x58856d1f,0xedfaa2b5),LL(0x35f92f40,0x21a1607a)}},
+   {{LL(0x06fb30e3,0xb84da991),LL(0xcc56a400,0xa0d07e00),LL(0x93fd2d92,0xdb30f193),LL(0x5bf13afe,0x00c05a75)}, {LL(0x6fefa94c,0xeaf9775b),LL(0x9dd0cbac,0x49294971),LL(0x76daa793,0xf6b32b7a),LL(0x5f4b5866,0xf99ab5a3)}},
+   {{LL(0x4048dca6,0x1d7ed3fd),LL(0xd7f15df8,0xc5b3bb9b),LL(0x32c158fc,0x91ce88e1),LL(0x2f695dbf,0xa9f9fa39)}, {LL(0x2c8a1986,0xdec05501),LL(0xa4a8fd59,0x672f1f0a),LL(0x5a76ac6e,0x6bcd0742),LL(0xd4d20c8b,0xbdcd5cb6)}},
+   {{LL(0xa40f1728,0x415cd43c),LL(0xff9b3b96,0xe9a2d477),LL(0x433943a1,0xd3e2b0a5),LL(0x4eb2c0c3,0xd1541167)}, {LL(0x95f2d149,0xf87bdbfc),LL(0x45d34ca8,0x2bd39fa1),LL(0xdab00e92,0x3b6a7a13),LL(0x6ff20d67,0x41165d61)}},
+   {{LL(0xb1d18d6b,0xdc53cf15),LL(0x63bbf9b3,0x6ea2fa84),LL(0x1d902bcd,0x2db5778c),LL(0xe9d2c388,0x1dc90edd)}, {LL(0xa85f6463,0xdffcf272),LL(0x73e39a28,0x39a819d0),LL(0xafe01bfc,0xc78ebd50),LL(0x7b785c52,0xe4b8250d)}},
+   {{LL(0x68bdb64b,0x055143cb),LL(0x14be27d4,0xb52edc52),LL(0x53e2f793,0x1d1bdee0),LL(0x10cd9bff,0x7345eb49)}, {LL(0xd4cd4ef0,0x90453d46),LL(0x84e44542,0x3e664290),LL(0x3cbd98ea,0x82d01f52),LL(0x01d9e203,0x52c0877c)}},
+   {{LL(0x3037522c,0x6a501306),LL(0x782a592f,0xd9c325d6),LL(0x13c4e6fe,0x6e59e464),LL(0x39a3f6d6,0x526781f9)}, {LL(0xcf1128bd,0xfc524f59),LL(0x02f3be9f,0xdadb63e0),LL(0xe185c435,0xb08798db),LL(0xde3ddcf7,0x5c7a43b2)}},
+   {{LL(0x31fe21d1,0x2c86ead6),LL(0xabc137a3,0x423468dc),LL(0x7fb4f98b,0xf6486443),LL(0x2286ec9e,0x2b783579)}, {LL(0x87434bd5,0xf357cadd),LL(0xbe18433c,0x9723e095),LL(0xcf03cee8,0xb3c8af12),LL(0xd35d137f,0x0e8cca8f)}},
+   {{LL(0x0db2fb6e,0x12d1bf78),LL(0x338063eb,0x7ba7fdc6),LL(0xea08e154,0x2879e31b),LL(0x932e86bf,0x065f2a8c)}, {LL(0x7e1c58ff,0xa8b81127),LL(0xd994f18c,0xc871f5e5),LL(0x1178850d,0x605d45e2),LL(0xaee1bef7,0xb0bf9e70)}},
+   {{LL(0xd667cbbe,0xc1683c7c),LL(0xe69b98b2,0x9ef69304),LL(0xf6f9c815,0x0a8c9e07),LL(0x4e5f84e6,0x569b8d0d)}, {LL(0x1fc5d5a8,0x24b88ec1),LL(0x9aa6194e,0x1665554c),LL(0xdb2918c1,0x3f8ee3a9),LL(0x8fe1e6a0,0xad285e77)}},
+   {{LL(0x2379d44e,0x750d79a6),LL(0xcb9ecfe5,0xca6138cd),LL(0x936c31da,0xe6be41a0),LL(0x5cb4498d,0x3a1f11d5)}, {LL(0x50a6c9d6,0xada67cc3),LL(0xc980c3c7,0xf4639033),LL(0x44e96555,0x265e392c),LL(0x0e17c4ca,0x4300a7a1)}},
+   {{LL(0x209e85ef,0xa8601933),LL(0xfcc217ea,0x668df199),LL(0x8036cb0f,0xf7b585eb),LL(0x35fe6e82,0xe4495232)}, {LL(0xcfb2f036,0x67721652),LL(0x71e07f50,0x5d6fd917),LL(0x89a6a91b,0xd41ca22f),LL(0xf2cfdda9,0x312f9630)}},
+   {{LL(0x3a578f62,0x15b18402),LL(0xc0c038c9,0x10626fcd),LL(0xa5cd4372,0xa52f95b5),LL(0x6e8e112b,0xb6fef8f5)}, {LL(0x11fab0ab,0x989b3a51),LL(0x8977e32c,0x06c1115c),LL(0x465e9450,0x4636948e),LL(0x694b276e,0xe7abe46a)}},
+   {{LL(0x61d082f1,0xb32b882f),LL(0x9dd19f86,0x823157fa),LL(0x7f93cd09,0x1b82f7d5),LL(0x0dc74073,0xbad277c8)}, {LL(0x468b99e3,0xaba9e94d),LL(0x41e59396,0x6229671f),LL(0xd2289ff8,0x704f2caf),LL(0x8c814ead,0xcdcdace0)}},
+   {{LL(0xd56deec7,0x95794bec),LL(0xb8a0ce82,0x78db79b7),LL(0xee813d00,0x6dd486b1),LL(0x40cf3162,0x69519c9a)}, {LL(0x36b35595,0xd2dadfb5),LL(0x93efa424,0x12eb7480),LL(0xe4e43a20,0x1a3d521c),LL(0xdf5d3544,0x5cbb7a21)}},
+   {{LL(0x925203c8,0x113cefcc),LL(0xea8cd01a,0xeed708a9),LL(0x3f3f779d,0x3a2f1b92),LL(0x479592da,0x1fbc215c)}, {LL(0xd53e8b95,0x5a7c5a97),LL(0x4e9c3758,0x3a44582f),LL(0x14df3fd7,0x26d90c1d),LL(0xee38bc30,0x502e5767)}},
+   {{LL(0x0212974f,0xe8ae97b6),LL(0x4d039a10,0xfea5a73e),LL(0x92c0fdb0,0xa982a075),LL(0x21418dcc,0xbc7086af)}, {LL(0xcb51c72c,0xffd7f093),LL(0xbc76b9c5,0x91aca156),LL(0x1684a73b,0xa291853a),LL(0x0e77cb21,0x6b2f8e7a)}},
+   {{LL(0xfd9a10a1,0xd97f58dc),LL(0xb8236729,0x98d2486c),LL(0x7e6c1d50,0xb92e694a),LL(0x72658e86,0x4d63390d)}, {LL(0x08055594,0x1f201428),LL(0x338c87aa,0x3de47cf9),LL(0x5c6ac061,0x5ce813e2),LL(0x740b36b9,0xeb4465c8)}},
+   {{LL(0xb8acbe0c,0x0c965784),LL(0x6256978e,0xc959ebd5),LL(0x91477b07,0xa890940f),LL(0x4fa82b89,0x053a23ff)}, {LL(0x9fa33d46,0xf034a362),LL(0xf279bb5b,0x38ed9a88),LL(0x62add133,0xfbbdef88),LL(0xaa38a683,0x828f72a5)}},
+   {{LL(0x267b5ea3,0x9146637d),LL(0x9a992bb8,0x66809f3a),LL(0x3c2b1f25,0xb00eeea7),LL(0x0ee94476,0xe6b8f877)}, {LL(0x5a607394,0x963127fe),LL(0x36150382,0x61300711),LL(0x4b2562d8,0xa664a1dd),LL(0x16eff5f4,0x525467a6)}},
+   {{LL(0x2c4349ef,0xe4ca78b2),LL(0x83b1af6e,0xf8a16f10),LL(0xd9bb22d1,0x79d40c49),LL(0xf8266976,0x56146b42)}, {LL(0x897ba43e,0x85e59150),LL(0x49db7609,0xb8e46e0b),LL(0x897b70a6,0x82eadb25),LL(0xc3b51d94,0xe58a82b7)}},
+   {{LL(0x7d4b01ac,0xe8b7e1a0),LL(0x11f61cb6,0xf64a1925),LL(0x8e9d74e6,0x83348530),LL(0x41fb58d4,0x817d12dd)}, {LL(0xc1bd6656,0xd50034f2),LL(0x637c966d,0xb8bdb750),LL(0xf3f6043b,0x45c7c55d),LL(0x035d9e2a,0x94114e5c)}},
+   {{LL(0xb4aba76b,0xe90f69e7),LL(0xd2e846f6,0x0828a26a),LL(0x215ffa01,0x102c7df1),LL(0x1d4c6dc5,0x413a78b2)}, {LL(0xfc74ef0d,0x385287e3),LL(0x7c27938e,0x3b36abde),LL(0x90304dc4,0xd1e3f997),LL(0xa04dc8b0,0x021c0c69)}},
+   {{LL(0xd4d7be23,0x683b5f2a),LL(0xd5f90281,0xa7a84926),LL(0x430865c6,0x39e0b7e0),LL(0x8783e582,0x93ac97f7)}, {LL(0x2c625d27,0x17b306ad),LL(0x94d3e624,0x68bb44c8),LL(0x4c2f2978,0x7171de49),LL(0x30989845,0x416ea489)}},
+   {{LL(0x99237e81,0x2e80ee9c),LL(0x068d6a27,0x32488419),LL(0x572b1b3c,0xc410b6aa),LL(0xf9783651,0x7e948dd1)}, {LL(0x1e6480dd,0xd3d8d0e6),LL(0x98c9043f,0xd7a36305),LL(0x0855e0aa,0x49116415),LL(0x69dc8e45,0xb2b32e5c)}},
+   {{LL(0xd245f866,0x8a5079df),LL(0xff820872,0xb01aae80),LL(0xccf7941f,0x9d28824d),LL(0x4474cb72,0x50126f4a)}, {LL(0x96502d68,0x98a8793e),LL(0x31565d00,0xbb902aa1),LL(0x629195cc,0x658e671b),LL(0xe0538847,0x11e1c243)}},
+   {{LL(0xb1cf5c60,0xd568d31e),LL(0x69d2b852,0x0ee57a09),LL(0x8a878858,0x7c5fbfa2),LL(0x33d9cc56,0x9e865f8d)}, {LL(0x804919db,0xc4ea1347),LL(0xffff9c82,0x119b305e),LL(0xc0b1385b,0x4b1d22a4),LL(0x8bfb7d49,0xcd137fcc)}},
+   {{LL(0x3d60b16d,0x388f185d),LL(0x7b9059d6,0xebe9ccd7),LL(0x5b1a1486,0xd7a5d822),LL(0xb7a96047,0xd5f436f8)}, {LL(0xfe9a6a85,0xba6f026e),LL(0x641e42b4,0x1a7896af),LL(0xdd585baf,0x959ed02b),LL(0x6a03171a,0x9dd5aafa)}},
+   {{LL(0x7462177a,0x2f614019),LL(0xf204a9bf,0x7fe0b000),LL(0xd8f9aaf0,0x48dff2c2),LL(0x44e51fb8,0xc4c6b211)}, {LL(0xb5045dab,0xd953e1aa),LL(0x2213fe48,0xe812f1b6),LL(0xc2c207cf,0x7225406c),LL(0x6e37570f,0xd4485756)}},
+   {{LL(0xd119c946,0x88487685),LL(0x8abad2a2,0x88c3b68f),LL(0x33d6b387,0x4ad3a5b2),LL(0x752c8779,0xcbd6859e)}, {LL(0x0c8d84ae,0xd39d2428),LL(0xeae116e8,0x4f4d432d),LL(0x7bca7897,0x6a7234fc),LL(0x0621313b,0x0560ef41)}},
+   {{LL(0x439eb333,0x8abe2721),LL(0x5ef06c04,0xa25898fb),LL(0x09e8a2b3,0xc0457e12),LL(0xd3db51ae,0x42a82291)}, {LL(0xbb8b6574,0xfa5694d6),LL(0x821a7c54,0x96c9d0d7),LL(0x9c7307f1,0x6ca9c870),LL(0x0b61315b,0xdf986b01)}},
+},
+/* digit=26 base_pwr=2^182 */
+{
+   {{LL(0x2414cc1f,0x00956ae7),LL(0x9269a256,0xddcca61c),LL(0x98debc25,0xb6b0b7a8),LL(0x6219098c,0x8d22f26d)}, {LL(0x155b0f5a,0xe6886816),LL(0xa6bbf8ab,0x98bf1dca),LL(0xa7a5125c,0xad753cfb),LL(0xd035cdd4,0x2776abcb)}},
+   {{LL(0x53dec3c7,0x7ca7b846),LL(0xf496bdba,0x687e1823),LL(0xc3dcb9e2,0xc80b3eb2),LL(0x84225ce8,0xacc353e3)}, {LL(0x0d095866,0xe05e65dc),LL(0xad3cabcb,0xf0e672bb),LL(0x6418c792,0xd41d5684),LL(0x7e054eae,0xbf3a93c1)}},
+   {{LL(0x660806af,0xb1ee1e1e),LL(0x58d6f28c,0x80343918),LL(0xe65147a9,0xc45fd605),LL(0xb6350936,0xd2549da2)}, {LL(0x327f65fe,0xe911e5cf),LL(0x2e6a8798,0xa67ab221),LL(0x877d719f,0x1e65bff2),LL(0x02eed54f,0x0c442e62)}},
+   {{LL(0xb9849d3a,0x43f65311),LL(0xf1c8ddd6,0xcf67262b),LL(0x0bd30c3e,0xaa685dfc),LL(0x982c272e,0x6b3e8009)}, {LL(0x58c77cad,0x5f17349c),LL(0x6bae8b87,0xedff544c),LL(0x7756877f,0xa4f3c616),LL(0x1c1efc86,0x773e0a1e)}},
+   {{LL(0x12a34995,0x6eba4820),LL(0x557a37f3,0xd7728baa),LL(0x4cbf4465,0xaabc1658),LL(0x512f9952,0x0b69fc02)}, {LL(0x11f2564a,0xfaa2ced8),LL(0x92756eb3,0x08e33e8f),LL(0x1e7a41ab,0x5e3cbd97),LL(0x9e0c6241,0x164d5746)}},
+   {{LL(0x3b829cd7,0x18b31982),LL(0x79630d02,0x3e1eb379),LL(0xeccee5ad,0x36488094),LL(0x3c279436,0x017ffe2b)}, {LL(0x902cd8d0,0xa50c6207),LL(0x8bf841bc,0xa8889419),LL(0x568d84fe,0xb583cddd),LL(0x486ceb15,0xd44f4fde)}},
+   {{LL(0xf16d100a,0x7fc026e6),LL(0x6e978d4d,0x597ef385),LL(0xc378a7ae,0x4ff0c8fb),LL(0x01290a24,0xc3c62260)}, {LL(0xd872c88d,0xcfa1466a),LL(0xa24d7e55,0x75a2bbdf),LL(0x5a97918b,0x22f3ed4a),LL(0xd269af5b,0x1ea63267)}},
+   {{LL(0x87b9fb99,0xad976b82),LL(0xda3bee6b,0x3573fd74),LL(0x903689fd,0x45918654),LL(0xd7972b58,0xcb9f0686)}, {LL(0xde558c9b,0x650da92b),LL(0x6ec49cc0,0xd1952ba0),LL(0x35f28ce4,0x8c0d5c20),LL(0x1ec23e29,0x9dcfe8e1)}},
+   {{LL(0xcfdb977a,0x9160fe39),LL(0x542494f7,0xefcf6cb5),LL(0x8e174950,0xbe6933ca),LL(0x545b0115,0x0a70d904)}, {LL(0x645da54a,0xa57cab74),LL(0xccce0b27,0x5afc7253),LL(0x214e3ba5,0xb61d0521),LL(0x6691b407,0x7bd8b2be)}},
+   {{LL(0xb328a429,0xceb4afdd),LL(0x7afed623,0x827095d5),LL(0x77b0be44,0x66706b4c),LL(0xabfb56f8,0x519a6688)}, {LL(0x22252b7e,0xe41222ee),LL(0x147a66b6,0x555e359a),LL(0x07c8ca74,0x2742a5fd),LL(0x8ced3fdd,0xaabcfcf6)}},
+   {{LL(0x4aa42d2c,0xf5eeca7e),LL(0xc87c4dc6,0xbb303e15),LL(0xef042fee,0x248f8bed),LL(0x533d09d9,0x46218d6a)}, {LL(0x548886b6,0xa88ff67a),LL(0xe6013294,0xbd209031),LL(0x8300635f,0xdb3f3fe5),LL(0xc0b382c7,0xcffee035)}},
+   {{LL(0x7dcf8453,0x3cf0e50a),LL(0x56d291c0,0x04f6ec51),LL(0xf0f18428,0xa661543c),LL(0x1accb2b7,0xf97d4d62)}, {LL(0xe61d301d,0xf1761c6b),LL(0xe448c129,0x596e5601),LL(0x72a0f666,0xcb03c522),LL(0x25e7a1f3,0xa7e14727)}},
+   {{LL(0x23d1871f,0x36d954ab),LL(0xd6081dfb,0xd2f39f4f),LL(0x2679ada9,0x3a880f92),LL(0x91a5d6a0,0xf0fee68a)}, {LL(0x3e61e33f,0x3921cbbb),LL(0x35e1e77d,0x4e5aab7a),LL(0x03c18893,0x21f3cc63),LL(0xa770a8c7,0x79245af4)}},
+   {{LL(0x7e51f086,0xbff10075),LL(0x5811f498,0xb56be140),LL(0x83a98b67,0x68467b86),LL(0x1fade07d,0xf6edb087)}, {LL(0x78862399,0x2edecd3d),LL(0x9b7af9cb,0x37daa6f6),LL(0x6d47c5ef,0x85a6497d),LL(0x39301006,0x2fb2e0df)}},
+   {{LL(0xf917c19d,0xe016f864),LL(0xbbeffadf,0x13d7b154),LL(0x7a45b559,0x782af420),LL(0x282deb9a,0x3c1a429e)}, {LL(0x03bcd568,0x19162a7f),LL(0x6a75b478,0xb6e783e1),LL(0x1e0792fc,0xe57cfc78),LL(0x1efc3382,0xff2feecb)}},
+   {{LL(0x52976cf3,0x6db16b9f),LL(0x619d4735,0xe529ce99),LL(0xe78d3b8b,0xca300a12),LL(0x950758de,0x0102c5de)}, {LL(0x2d07d024,0xf5c942ad),LL(0x64391219,0x39845b08),LL(0xa3a15fea,0x903010b3),LL(0xe4a6ee10,0xc43a27b3)}},
+   {{LL(0x11a68908,0x7ffda7a5),LL(0xd58a29c9,0x68c6314d),LL(0x22fcaff1,0x0cd90035),LL(0xa62a89d4,0xe3aa51dd)}, {LL(0x9bdf5d6f,0xa9bcb98e),LL(0xe8aa6625,0x1604aeaf),LL(0xfb84978e,0x039e1899),LL(0x8b12f3f6,0x9fed7e70)}},
+   {{LL(0x5f3abdc7,0x3967d25b),LL(0xc31cdf13,0x59764b77),LL(0x44ed9e58,0x7f7ae919),LL(0x7a4fa83a,0x8120dc20)}, {LL(0x7a3be5aa,0x8f26be82),LL(0x08322dd0,0xce37f597),LL(0x293b69cc,0x56d67ab8),LL(0xaafcda9f,0x6aee1996)}},
+   {{LL(0x53583ea9,0x7233aa8f),LL(0x712e1a1c,0x62f53b00),LL(0x497ded2f,0x5d43280c),LL(0x5a80a4dc,0x49e13111)}, {LL(0xc1794ff7,0x6e172a3c),LL(0x1f58dacb,0x8606762c),LL(0x51529865,0x1da73889),LL(0xd84103e5,0xa47bb9cf)}},
+   {{LL(0x97c20835,0xb1d944fe),LL(0x83dcc0a5,0x491c3266),LL(0xffcbae26,0x05844f68),LL(0xdf3dddf1,0xed986ff4)}, {LL(0x6e99c870,0xf4335453),LL(0x504d4bd8,0x1bdac226),LL(0x0c6f81f5,0x83d0daac),LL(0xe8bc390a,0x38a38b11)}},
+   {{LL(0x4fb57a95,0xb5db4026),LL(0xfda9e00b,0x56fe3068),LL(0x75068eb7,0xb4cbc4d8),LL(0x0917270c,0xa4e319ae)}, {LL(0xa9fa4af4,0xfee3ad3d),LL(0x7e08e130,0xfdd37c3b),LL(0x7e20ccef,0xa58cb305),LL(0x71d67f51,0x8c62a658)}},
+   {{LL(0x0c39dce9,0x8f901521),LL(0xae094f03,0x7290d86a),LL(0x265af1be,0x027eeb8f),LL(0x3d339eda,0x503b029c)}, {LL(0xcf314fd9,0x80424295),LL(0xc8c0bda7,0x1c1f147e),LL(0x3c6b6a4d,0xdf62b7d4),LL(0xf51d85a4,0x40234d8b)}},
+   {{LL(0x87aa7320,0xdd265578),LL(0xadeb6482,0xa89fcb54),LL(0x4e070384,0x0ef03bf2),LL(0x8743dfbd,0xc6105020)}, {LL(0x5d27095d,0x3e725c2f),LL(0x7cda1922,0x4908ad2b),LL(0x39253969,0x1aeec423),LL(0x9532b1ed,0xe83788aa)}},
+   {{LL(0x3707a48e,0xe0ea95e9),LL(0x25b9ce83,0x92dce89f),LL(0x98fddec9,0x50f98c45),LL(0x9611499c,0xf855c25e)}, {LL(0x6bc5c7e1,0xa2ac4b6e),LL(0xeac603dc,0x1d785c06),LL(0xbcd0f392,0xf1ea511d),LL(0xa3d9c63b,0xe65e53d0)}},
+   {{LL(0x2cba1f30,0x0e9d4931),LL(0x80f54dea,0x7bbe9f60),LL(0xd281a4b0,0x338c3c1b),LL(0xc5d8c93d,0xe4015e4d)}, {LL(0x2a638dcf,0x005d5f3d),LL(0x93590a62,0x1809826b),LL(0x41dbc303,0x57167811),LL(0xde317590,0xca68ff8e)}},
+   {{LL(0xb3bb4bcd,0x1c9e1107),LL(0xea45615a,0xca2acabf),LL(0xc5c7887c,0xd03216e6),LL(0x8e807f39,0x93304716)}, {LL(0xf6d2df1d,0x447ec23c),LL(0xeb2af08d,0xb78b5eb3),LL(0x3928cba9,0x42aa89b7),LL(0x6b3a5b51,0x19cdaaef)}},
+   {{LL(0x84f53803,0x9f1b77a9),LL(0xb6c92ed1,0xb503ba46),LL(0x415a9310,0xdf643f25),LL(0x11e704e1,0x62c03df5)}, {LL(0xbc353033,0x28edb2ac),LL(0x5d51a13a,0x11c3f53c),LL(0xb33c4bf9,0x940fd3d5),LL(0x90752078,0x87f4a39d)}},
+   {{LL(0x694b252b,0x278d5506),LL(0xa19b908b,0xcf1f2fa2),LL(0x593f6309,0xd7017566),LL(0x94446be7,0xb59db87a)}, {LL(0x5dabd5a1,0xefb13355),LL(0x3ad29b54,0xdb181ec1),LL(0x493660a1,0x9c922273),LL(0xaee2937d,0x6417e2dd)}},
+   {{LL(0x0c6c9490,0xea6564a3),LL(0x7e9093a8,0x549de296),LL(0x114fdfc0,0x16ee432f),LL(0x581b797b,0x4b8cb518)}, {LL(0xfc723ef1,0x0ff2000c),LL(0xd2810407,0x04118c31),LL(0x397746f7,0x1c70b45b),LL(0x820d944f,0xe6a097ff)}},
+   {{LL(0x16932a2b,0x56d37981),LL(0x2a56e5a3,0x6ea2bdb6),LL(0xd6adba3f,0x5a0c8e60),LL(0x92dfc539,0xd9fc0c3d)}, {LL(0xad4703b3,0x3ec9b59c),LL(0x01acd6ca,0x2ec364cd),LL(0x8a22945b,0x1cbf5cee),LL(0xb61c2d62,0x7a5ee3f3)}},
+   {{LL(0x38e0b010,0x55cbbc12),LL(0xeac66541,0x1d3b328f),LL(0xa6ecab7b,0x376689ff),LL(0x18e311da,0xd53dba23)}, {LL(0x92b17598,0x2eac821e),LL(0xf7ac89f3,0x189beed5),LL(0x90495104,0x34099080),LL(0x1843249e,0x96fde77c)}},
+   {{LL(0x55aad0c0,0x8cfefdef),LL(0xabd08b50,0x7333fdd0),LL(0x6cc6cbbe,0xf7a4cba6),LL(0x4b6cab8f,0x33d19dd7)}, {LL(0x251a53d9,0xa68ae7fb),LL(0xcb4027a0,0x899359f8),LL(0x51545d57,0xebb3b4fa),LL(0x0c22d827,0xaf991107)}},
+   {{LL(0x9c61a135,0x9dbc0424),LL(0x9b9738d2,0xaffaca71),LL(0xaf175775,0x19b90602),LL(0xa76145a8,0xd143206a)}, {LL(0xd097041b,0x78b56ef6),LL(0x9885c8e9,0x1743caa6),LL(0x6470c328,0x6e7bac8b),LL(0x60b9332e,0xb9ae25f2)}},
+   {{LL(0x357341bf,0xfbcfac04),LL(0x9e5ee9c3,0x8248bad4),LL(0xb90a7851,0x8e6f0733),LL(0xff4ae91b,0xfea8a071)}, {LL(0xf2bd6d7a,0x51124615),LL(0xab20d0fe,0x615a7d14),LL(0xdba82817,0xe00c5a61),LL(0xc686c175,0x16628f9a)}},
+   {{LL(0x5404a90f,0xbe5422ed),LL(0x8a7a9b26,0xb64e4b77),LL(0xc398d5b5,0xa6b4a52d),LL(0x46fac3b9,0x79dc4546)}, {LL(0x165351b7,0x3640b779),LL(0xa695e869,0x766c8775),LL(0x619fcffd,0x5f1cbdfd),LL(0x031e0bff,0xe9f818e5)}},
+   {{LL(0xaf4d3447,0x38f691c9),LL(0xb3e917ea,0xb5f699ab),LL(0x2b1deace,0x86f16719),LL(0x84cbe734,0x9ec95fbd)}, {LL(0x6eba1abf,0xf02cc3f6),LL(0x9aa8180c,0x461a5e58),LL(0xa3ccea6a,0x4dc2a0c8),LL(0x0798909b,0x5c69a75d)}},
+   {{LL(0x812c8eb6,0xc4d85c78),LL(0x6323e1c8,0x3d8a3b22),LL(0x29422501,0x3223cec1),LL(0x530e047f,0x916dc309)}, {LL(0xa9c1ab6b,0x8a19d2bc),LL(0x3841317e,0x4bdba9e9),LL(0x2112a38d,0x6f2c2a17),LL(0x6d8e3939,0x4662dcad)}},
+   {{LL(0xdc655eda,0x0e4f3f5f),LL(0x9c881920,0xaa22f0da),LL(0x67d88654,0x8340ee6b),LL(0x1c9f6357,0xf801097b)}, {LL(0x9e176f3d,0x9f99de5c),LL(0xebf5fb24,0xbc9a110d),LL(0x73d21e68,0xb809fd4d),LL(0x695033f4,0xbeb8d26d)}},
+   {{LL(0x7e8f0b85,0xc95577ad),LL(0xf8818570,0x51273b69),LL(0x1cc94a20,0x0ec50252),LL(0x08c84536,0xe1db2bd6)}, {LL(0xd85b1de9,0xb1f570f4),LL(0x9a1fc303,0xabce5498),LL(0x02242885,0x668d0ba7),LL(0x9685e07e,0x79388850)}},
+   {{LL(0xce934ce5,0x3f3c4e32),LL(0x9ff4b9b4,0xb28527e3),LL(0xc72002f6,0xe9061fe7),LL(0xb9769e95,0x607f2bb5)}, {LL(0xc32000f7,0xbaa8cc5e),LL(0xbd48efd7,0x01e614c3),LL(0xc14632b1,0xd9b34d2d),LL(0x768a21ca,0x1ae81a22)}},
+   {{LL(0xb810c614,0xcb9a9a6d),LL(0x874ab5c7,0xda49c09a),LL(0x7cc9c8d4,0xeee6272a),LL(0xe7ec86da,0x51c7922c)}, {LL(0x1e3b6b61,0x23cc1a7e),LL(0x82558db4,0x4eca3a76),LL(0x6b461b11,0x2f551c4f),LL(0x6af29c9b,0x453e0b12)}},
+   {{LL(0xcec8023e,0x420bfb56),LL(0x94bdbdc1,0x4bbdaedb),LL(0x404bfc3e,0x10bc55e5),LL(0xab51fce1,0xf9739308)}, {LL(0xa94dfb51,0x2358464e),LL(0xc8f32241,0xe4a6fb49),LL(0xda512a3e,0x577688be),LL(0xd36e14ea,0x2d3c606c)}},
+   {{LL(0xa5e01e7e,0xd27c3e13),LL(0x77d59d22,0xc3a251c5),LL(0x2905797d,0x9ec09c2a),LL(0x14631112,0xb4b6f908)}, {LL(0x363dbac4,0x7823933c),LL(0x39f846cb,0xd84a6763),LL(0x4030a2a9,0x1e4bb25e),LL(0xa5fc1ee5,0xf01d214b)}},
+   {{LL(0xb447793d,0x829a0c65),LL(0x4e25d120,0x30acd098),LL(0x0d303f6f,0x9ea332ff),LL(0x22ed4ded,0xd3fb28a4)}, {LL(0x6903e164,0x810ce8f5),LL(0x1833c609,0x808b461f),LL(0x72522af8,0x4072c309),LL(0x74db90db,0xd2d82112)}},
+   {{LL(0xba296174,0x5ea7d936),LL(0x3648812c,0x7e5ded45),LL(0x8e38035d,0x2c4fded4),LL(0xdbfbb14a,0xb854da38)}, {LL(0x0cbfb239,0xdbbd67e8),LL(0xcb557e0e,0x7601eae5),LL(0x7a58a0d6,0x314da116),LL(0xd8a872fb,0x1e58f388)}},
+   {{LL(0x71dadd45,0xa4be22e7),LL(0xb4987a42,0x9b7f5b81),LL(0x1d3069c8,0x5247db4e),LL(0xa467f47b,0xf3a1e332)}, {LL(0xfb8f2c5f,0xf6bb25e8),LL(0x7ae91e77,0x8251159f),LL(0xeb75407c,0xde2659dd),LL(0x802a3ac1,0x95065766)}},
+   {{LL(0x6b72b61a,0x660052c8),LL(0x3d8a1958,0x829bbd31),LL(0xd2f117ae,0xb3685865),LL(0xe3a71e3b,0x7fbea11e)}, {LL(0x5c5fad51,0x3d4b9ec1),LL(0xacb8259c,0x3bea1660),LL(0x9a509be3,0xc8104251),LL(0x585b686f,0xf72bf320)}},
+   {{LL(0x99daa475,0xc2a3ab6b),LL(0x4becfede,0x90b14d1b),LL(0x3d9d0afd,0xce429c02),LL(0x1c8b2aba,0x06808d58)}, {LL(0x80ad39ef,0x0d93617a),LL(0x8a43be32,0xf74bec7f),LL(0x60a05c2e,0x289165a8),LL(0x2362cf24,0xf0af3324)}},
+   {{LL(0xa0b47050,0xea3930be),LL(0xa31cb31e,0x41389bbe),LL(0x79453c35,0xb9c5d352),LL(0xf003bc42,0x2ba76383)}, {LL(0xdf3e584d,0xc50edd7c),LL(0xe0ba1be8,0x1dbc31eb),LL(0xae2af005,0x3b5ac433),LL(0x59926c30,0xfcbee1c6)}},
+   {{LL(0xf7e4629d,0xac7bc32e),LL(0xb5f47aad,0xa8dc1288),LL(0xd8649714,0x20c126fe),LL(0x2b71ac23,0x6a4f6c70)}, {LL(0x25734c15,0x62894fb0),LL(0xa729b9e5,0xa2d9e0fa),LL(0x7e156277,0xea6f7501),LL(0x98a18a50,0x3673acc1)}},
+   {{LL(0x7f7e79af,0x7d01055e),LL(0x6171d577,0xed8d5439),LL(0xef05c965,0xfa2d9b6a),LL(0xe6633c13,0x7817a47b)}, {LL(0xa6d2f376,0x06272783),LL(0x9568043a,0xd0f626f3),LL(0xf1bd91c5,0xdfb12cab),LL(0x5ad30686,0x18905e8c)}},
+   {{LL(0x73ac46e8,0xe0013762),LL(0x5af4d4f2,0x206b1836),LL(0x89a8f1d1,0xb03c0b48),LL(0x640bf665,0x95e3e1cf)}, {LL(0x86fb997f,0x297e499e),LL(0xf60d8eb1,0x81bd727c),LL(0x720f096b,0xc515f493),LL(0x86a94d0c,0xf7597cf2)}},
+   {{LL(0xb082d6ed,0x4773ad0c),LL(0x94b81c0d,0x214eec00),LL(0xed7c4c24,0xa6d7aa78),LL(0xff3fd7a9,0xd85b1f7c)}, {LL(0x20b6ccc1,0x49d3616e),LL(0x6802a93c,0xfcfa001e),LL(0x776ee65f,0xbba36742),LL(0x9428fc8a,0x2dd7c9c8)}},
+   {{LL(0xe5b6e3a2,0x9d828030),LL(0x48d3d714,0x4121195c),LL(0x570af430,0x257ee3eb),LL(0x26b4cf57,0x2a671ac3)}, {LL(0x9db68076,0xaec42520),LL(0xc3c7cee5,0xed843bb8),LL(0x149d37c1,0x1b61f90e),LL(0x98fbfb9d,0x4ca8e2a2)}},
+   {{LL(0xa3982946,0x03a44334),LL(0xd4befd43,0xeaf9324e),LL(0x638a0cd4,0xb8d94f6a),LL(0xdeb08f18,0xa31bb3bd)}, {LL(0x72687905,0x5110af28),LL(0x3a340e29,0x55fda9a6),LL(0x196cea51,0x6443f449),LL(0x6bc5da80,0xe9ec0450)}},
+   {{LL(0xb6b44a5c,0xae0f278f),LL(0xc515289a,0xe68726a1),LL(0x2b40e5c7,0x898b6305),LL(0x1ada5a90,0xde7299f8)}, {LL(0xf9d08f93,0xa2c88f5f),LL(0x1e63009f,0xfc2bd729),LL(0xbea2b729,0x0807272c),LL(0x218dd90b,0x9a63b1b9)}},
+   {{LL(0xb1dabf09,0x38e80021),LL(0x2443a764,0xe3a676f8),LL(0xa8532882,0xef4a05dc),LL(0xe8b0ce0e,0xc259956d)}, {LL(0xd8ee10c0,0xfc574cd1),LL(0x7fa10049,0xd52a95b7),LL(0x85c56478,0xb5a4d746),LL(0x0edb0cad,0x88350494)}},
+   {{LL(0x1867854e,0x8b30fb7c),LL(0x9f0f6504,0x44ec0ea1),LL(0xcf2e520f,0xc52bccf4),LL(0x9166eb89,0x6a6a21a5)}, {LL(0x091170f8,0x497f91bc),LL(0xe6777ab2,0xb393e8e7),LL(0xe3e3431e,0xcc5983a4),LL(0x79367184,0xd53f6009)}},
+   {{LL(0x0a26048c,0x1e98da25),LL(0xfc7c4b92,0x424ce10c),LL(0x05475e00,0x68b714be),LL(0x705d9482,0x4a1718c9)}, {LL(0x9e4faf21,0xb8155971),LL(0x5538895d,0x61a18810),LL(0xfaae53ec,0x5184e291),LL(0xa2b188af,0xf896d047)}},
+   {{LL(0x3d1419e5,0xa020d4e6),LL(0xac6abc2b,0x242ac140),LL(0x106b1d87,0x788495c8),LL(0xce9b245e,0xab200ac1)}, {LL(0x4e5f20eb,0xa20dce3d),LL(0x3bf92e6f,0x565aeb30),LL(0xa755073a,0x3356cb1a),LL(0x85fe856a,0x48ea9c5f)}},
+   {{LL(0x0a1b4cd1,0xe919a194),LL(0x7ff07194,0x952a9e8a),LL(0xb1ab2cdb,0x0318f858),LL(0xb9ff9fb8,0x15d2013d)}, {LL(0x382956d1,0x5c6e545a),LL(0x181e332a,0x837e5575),LL(0x85390ed1,0xbbd49515),LL(0x10bf94df,0x3f060d1b)}},
+   {{LL(0xc9d8181b,0xf2a5787c),LL(0x134485ff,0x896e2cb1),LL(0xcd08cbf8,0x384caba5),LL(0x72db7456,0x738e46cc)}, {LL(0x5b9e5772,0x210d3a72),LL(0xaf2e33d1,0xb8e1334e),LL(0x4482676d,0x44c10267),LL(0x4415241b,0x26cb8890)}},
+   {{LL(0x1ec5e5e4,0xbc306902),LL(0x887fbf89,0x5448f880),LL(0x4813d7ad,0x005f1892),LL(0xaf2042f7,0x66a5d667)}, {LL(0x85efea29,0x7a6cd56a),LL(0x3bc57ad1,0x8f5f8999),LL(0x65ed0ba6,0xc327d9a2),LL(0xbb5960a6,0x70903647)}},
+   {{LL(0xcd18f7c7,0xa9ac0ba8),LL(0xf810659f,0x2f247995),LL(0xef7b847f,0x5237e1a8),LL(0x9726b24e,0xbb6494b5)}, {LL(0xd6365612,0x409fe17b),LL(0x62524003,0xe6b17469),LL(0xfbeae701,0x96d999eb),LL(0x22a68973,0x1e070524)}},
+},
+/* digit=27 base_pwr=2^189 */
+{
+   {{LL(0xbd6f5691,0x8804d814),LL(0x47626e7a,0x87d7cbf2),LL(0x0cae3517,0xa306c2a1),LL(0x45bd18c1,0x28db9e39)}, {LL(0x21ef3e76,0xa5fea551),LL(0xab15c554,0x25be281a),LL(0x3a800191,0x142afa42),LL(0xc00648a8,0x3423e674)}},
+   {{LL(0x53187aa5,0xb924c209),LL(0x71fef056,0xf48b71be),LL(0x64d96d4e,0x6dbe2bb1),LL(0xd6243d76,0x39431f9d)}, {LL(0x70b0fb54,0xa16ad319),LL(0x24947691,0xe0dbfa7e),LL(0x26fa488c,0x79f5e350),LL(0xcb7bbfc3,0x1d4bef31)}},
+   {{LL(0x5ce13b46,0x6b48dad8),LL(0xb24cf98c,0xccf1d742),LL(0xcb13352a,0xd23cb1e2),LL(0xd6afe639,0xcf631d5f)}, {LL(0x3eaff993,0x4efc3e7f),LL(0x5b696cba,0x6d964ec9),LL(0xc084c309,0xcd83e6d8),LL(0x83222c44,0x6dd4d00f)}},
+   {{LL(0x66dd92a2,0xb578242b),LL(0xf7c1d9cc,0x1dc43436),LL(0x6209be19,0x19de1339),LL(0x0f752c70,0x8345aaab)}, {LL(0x4bef76eb,0x32136355),LL(0x5027b622,0x14d1bf6f),LL(0x49589ecf,0x6e02958c),LL(0xe8204c6d,0xaa815119)}},
+   {{LL(0xd6bff7c5,0x0b71993e),LL(0x854b4268,0x73a97052),LL(0x9384c1f3,0x14142e0f),LL(0x30e24766,0x9ddadde3)}, {LL(0x5f7d31dc,0x94ea466e),LL(0x27b4de48,0x4958d0fd),LL(0xe9f4c8b5,0x886b1340),LL(0x5cac9a87,0xdb81ec19)}},
+   {{LL(0xba302229,0x98d1d434),LL(0x4752fc22,0xd69b84d5),LL(0xfc89b366,0xdf64abab),LL(0x1ffa5a86,0xcad34a78)}, {LL(0x89fecf33,0xcb182ef7),LL(0xfad468fe,0xf584eac7),LL(0x12192df7,0xbce50a67),LL(0x2c674c0a,0xa0af7e14)}},
+   {{LL(0x7d7d01eb,0x4dd64f56),LL(0x3340308b,0xf773875b),LL(0xfefe56c2,0x9da860b3),LL(0x8c082d57,0x68dc178e)}, {LL(0x4f2dcbc1,0x1d4b8054),LL(0x372bb57f,0xae29efa3),LL(0xe9c6c1c2,0xd1305864),LL(0xeda23e9b,0x074c05ea)}},
+   {{LL(0xf32eb964,0x9d45c63b),LL(0x40eb2caa,0x6ce89abe),LL(0xf7897292,0xba22b299),LL(0x6eb36131,0xa3f1f2c4)}, {LL(0x13653600,0x5f6431b2),LL(0x87cb87da,0x3e890c67),LL(0xe9f9dae6,0x8c1fdf17),LL(0xdde61148,0x3a5f0315)}},
+   {{LL(0xabbc6d75,0x3ac368a9),LL(0x2ee61d61,0xa79d82bb),LL(0x4a921132,0x7945824f),LL(0x79db62e6,0x4888dc5b)}, {LL(0xa0951bb1,0xd2d1c0f3),LL(0x63e0201c,0x31833952),LL(0xfc1bf4d1,0x9f4a5f35),LL(0x2d7aea05,0xdec4156d)}},
+   {{LL(0xe971f03a,0x106f6c92),LL(0xa0af9de2,0x3ef76714),LL(0x8a56a600,0xd7c94c18),LL(0x113024cb,0x148c3372)}, {LL(0x4f1e0045,0xc4414b8c),LL(0x3c5940e0,0x484368df),LL(0x40059400,0x4be4c591),LL(0x98567a3b,0x08c18d1e)}},
+   {{LL(0xc15a4f97,0x8d14656b),LL(0x2155a59a,0x33297a2c),LL(0x06160e6c,0x60918351),LL(0xebc5af6b,0x07f3da78)}, {LL(0xa626865e,0x7560171c),LL(0xca393efe,0xc7624f8f),LL(0x9d3b817a,0x0421ce08),LL(0xb862fbeb,0xb6e88e3b)}},
+   {{LL(0xc2fed522,0x5aa4fa73),LL(0x49e13bef,0x4f16254d),LL(0x9c4b4aa9,0x6baa5a5c),LL(0xbcc1469d,0xa2ff9d04)}, {LL(0x316ae13d,0x11546116),LL(0x977ad52a,0x58601900),LL(0x76917d1c,0x280e788b),LL(0x3f63d735,0x11eb89cc)}},
+   {{LL(0x80a61907,0xa333eb30),LL(0x8e0fe259,0x71c6d7bb),LL(0x8903476d,0x1f8fa3e3),LL(0xb8d35637,0x9d6b08cb)}, {LL(0x5558b4bb,0xb86791a7),LL(0x3817817c,0x49843f52),LL(0xb1a87bc0,0x95c57cbd),LL(0xa860e612,0xa29f1b74)}},
+   {{LL(0xf565667d,0x9bab9f99),LL(0xba6012c9,0x8cb455f8),LL(0x8c99d3d3,0x5893806f),LL(0xc225bfa6,0x86ac6780)}, {LL(0x25ebc23b,0xd2597a55),LL(0x67774d0d,0x0e4756cb),LL(0x324ac4f8,0xd9ece566),LL(0x2d44d0c4,0x7306d3fd)}},
+   {{LL(0x6383dae1,0x859ae964),LL(0xfd4c6216,0xd014a3ef),LL(0x069b2d20,0xa574f44a),LL(0xebdf8bb3,0xd1f497d9)}, {LL(0x1f07ab41,0x8ae6a7a1),LL(0xfb44eb34,0x851cce43),LL(0x87df3df3,0x5bd7dc28),LL(0x69daa3d4,0x2ecac9d9)}},
+   {{LL(0xf0e363fc,0x6453ec21),LL(0x2f563f00,0x32d9097d),LL(0x21c6c3c2,0xd9138da0),LL(0xa4af14d8,0x5ede72e9)}, {LL(0x5f7e0f3a,0xf2877807),LL(0xa1d8cb76,0x902a6718),LL(0x0aa1055b,0x3f5995b0),LL(0xbd39ac08,0xc042ae09)}},
+   {{LL(0x315e2d42,0x0023ac8b),LL(0x0f586688,0xc953c25a),LL(0x84af1182,0xdcfc75f8),LL(0x1bca3f65,0x62d0549f)}, {LL(0x1a3ec909,0xdfe35aea),LL(0x0e08db1e,0x940cc9cf),LL(0x6720bb49,0x564272e9),LL(0x9d0f1fea,0x5cf3c188)}},
+   {{LL(0xe864adb2,0x0e4f08e3),LL(0x506e31af,0x0cb289b7),LL(0x3064914d,0x3156ce7d),LL(0x4312b695,0x19bc7516)}, {LL(0xf3f92668,0xa32ff9a5),LL(0xf7218000,0x27facbe7),LL(0xf160ae6d,0x94256a4e),LL(0x2b29fdcf,0x370001d8)}},
+   {{LL(0xad64f8a3,0xe7af5f6b),LL(0x76795128,0x1f112f63),LL(0xffb57cd2,0x7e40bccf),LL(0x8319b22d,0xd67bf9c9)}, {LL(0x187d0701,0x6e7e491a),LL(0x097f991a,0xc148f7c2),LL(0x5cbe0e8b,0xcb29e10f),LL(0xf79b116e,0x7a3a382e)}},
+   {{LL(0x89834f72,0x2c0e019a),LL(0x4d3db5f8,0x2bf719f7),LL(0xb75c7792,0xca9a1c9f),LL(0xea84dac6,0x5d08bdce)}, {LL(0xc19ab5ba,0xbfce3a57),LL(0xfa3f9988,0xaeee1040),LL(0x42d60e45,0xc2530d65),LL(0x970f45e4,0x3152ebe0)}},
+   {{LL(0xd42dc77f,0xe4d97e3d),LL(0x5574fad9,0x530285ae),LL(0x471a69ea,0xd1b7afa9),LL(0x631d89e2,0x387dbcb1)}, {LL(0xdd78499e,0x814ad4c5),LL(0x1d0dfe97,0x64ec4b01),LL(0x07f07d47,0x94309c03),LL(0x62b5e61e,0x41eff10f)}},
+   {{LL(0xc741d5e4,0x4c5f282c),LL(0x6de92087,0x57fabb11),LL(0x454817cb,0x700c9ae0),LL(0xc89c9396,0xfe69f411)}, {LL(0xb5a7d681,0x58e3c9a3),LL(0x46861c6d,0x470a7722),LL(0x09f109bf,0xec768ab3),LL(0xc437ed33,0x942c6e94)}},
+   {{LL(0x1e8f0499,0x47ed5529),LL(0x2b2a6859,0x6ebc15cb),LL(0x3b7eb01e,0x2048480d),LL(0x0eb5b1e8,0x81ec7273)}, {LL(0x06331a5f,0x0d2c99a3),LL(0xb750f721,0xeef6704a),LL(0x8d31bc86,0xc206a032),LL(0x408b936f,0x2f107d5f)}},
+   {{LL(0x0f385e25,0x875a1a80),LL(0x6c64cefb,0xc9af3f65),LL(0x940d0d3d,0xf04533d4),LL(0xed037857,0xf4ba7908)}, {LL(0xe0a65f64,0x87c8d282),LL(0x8d36e063,0x330d4fce),LL(0xe7d8a190,0x63be53d3),LL(0xa50f4421,0x21d8b8ed)}},
+   {{LL(0xc6cf5b6c,0x3ba9ee3e),LL(0x8ad714e7,0xf65978a1),LL(0xa2658e51,0xf656b06c),LL(0x836348b7,0x9ff08d11)}, {LL(0xb4446482,0xffc4e64a),LL(0x0aee36e1,0x1b2aefe4),LL(0x472a1f48,0x671ba148),LL(0x8e7adf8f,0xb49841ee)}},
+   {{LL(0x66cc5844,0xf1147aeb),LL(0xe98e6d2a,0x63613b08),LL(0x603ab32d,0x116a90b2),LL(0xc8bfe3f9,0x4ec010b0)}, {LL(0x6ade25fe,0x0c777b8f),LL(0x9ce22d89,0x001d4eaa),LL(0x44ac47c8,0x6db9ccb7),LL(0x4ec30b46,0x6f302a54)}},
+   {{LL(0xd0e15dc0,0x5cecbad4),LL(0x85a0dfd2,0x94aec967),LL(0x93b36023,0xea5ab597),LL(0x5aae786c,0x7a8e2c2b)}, {LL(0x5d32f528,0x36a9cada),LL(0x9bf6c01d,0x9456818b),LL(0x99eef09b,0xa8bf78fc),LL(0xb17f22f5,0xa985428a)}},
+   {{LL(0xc629eb2c,0xd692c983),LL(0x73b1d30c,0xa337c6c3),LL(0xf1bb40d4,0xe7ddfdef),LL(0x05c1666f,0x3a8c3804)}, {LL(0x60d2bef6,0x493e63c9),LL(0xefe213e3,0x691e62b0),LL(0xcc6ca61f,0x21e0ac0f),LL(0x766116ed,0xc10967e2)}},
+   {{LL(0xc8dbf45d,0x2c236cc4),LL(0x733efa04,0x2a82eb14),LL(0x347a6ff1,0x902bf5ce),LL(0xfa388193,0x3676d671)}, {LL(0x26f89287,0xe9c33e19),LL(0x562b15ac,0x02d31244),LL(0xe021732c,0x9e4ba964),LL(0x9ab33c90,0x941414c2)}},
+   {{LL(0x45bd06ff,0x0d3570f0),LL(0x31cd21e4,0x801dc949),LL(0x5415144f,0xa41e2412),LL(0xece94c65,0xbae09ca9)}, {LL(0x2f97570e,0x4260198e),LL(0xf46490f6,0xa259afd2),LL(0x3c4fb96c,0x00f2abc6),LL(0x2eef07be,0x0efc09b0)}},
+   {{LL(0x8f740f60,0xb942cfa2),LL(0x784e9740,0x199e21bd),LL(0x5d4540d6,0x637300d1),LL(0x7a2f5e25,0x34ae598f)}, {LL(0xf05daced,0x52cf26cc),LL(0x915e272e,0xa9da856b),LL(0xdb12472b,0xeb2c8ace),LL(0xa4573f87,0xd128ff5c)}},
+   {{LL(0x384f7eac,0xe4560927),LL(0x69c875ff,0xbd99f622),LL(0x28964fdc,0x74100973),LL(0x8054bcea,0x50cbf125)}, {LL(0x06a058ac,0x353f31b7),LL(0x26a946c9,0xd3b877ff),LL(0x5eb0be15,0x498a5c1f),LL(0xeb747a39,0x05b58fe0)}},
+   {{LL(0x0f882efe,0x90de3537),LL(0xdbc95f6c,0x5f2f3afd),LL(0xa76bf0ac,0x7132b8d5),LL(0xc4e85b83,0x72f32aa4)}, {LL(0x82f7a347,0xe2f78e42),LL(0xda83076c,0xaaa330d1),LL(0xfcabeb6d,0xf50e9a28),LL(0x22fe7d57,0x5e52a050)}},
+   {{LL(0x1b6fc753,0xa4b6aa1e),LL(0x75730769,0x234f0cc6),LL(0x57a95f95,0x0afa2a7a),LL(0x9b03ef9f,0x890e1525)}, {LL(0x63cfc138,0xdc7175d6),LL(0x1160eb2f,0xabe382c2),LL(0x87543983,0x4f1c814e),LL(0x92141325,0x6fe1cb1b)}},
+   {{LL(0xf974aa92,0xd90de989),LL(0xe20a8b2c,0x05824dcd),LL(0x60486091,0x4585b513),LL(0xda0d2af8,0x3b9134db)}, {LL(0x714f27bd,0xd05b74dd),LL(0x51882a69,0x0a592f27),LL(0x0f9ea98a,0x3b2a4123),LL(0xefb8d6a3,0x224984e5)}},
+   {{LL(0x9a327922,0x1aa50f15),LL(0x6520a546,0x9e3e00ce),LL(0xd907cb22,0xd7bc1af3),LL(0x02d10825,0x3d67387c)}, {LL(0x96f5160a,0x6363eb76),LL(0xe9bfa874,0x570f726c),LL(0x1610756d,0x046eb974),LL(0x30225b02,0xf882930e)}},
+   {{LL(0x57b9dd4d,0xac9cb21d),LL(0x0c232dbf,0xbfc89f57),LL(0xe053c53e,0x394b293e),LL(0x7e9d446f,0xba3ee438)}, {LL(0xf0a991a7,0x6ade5095),LL(0x9ab116e9,0x67573396),LL(0x78262300,0x12ea345b),LL(0xb31bcc9c,0x8cf6845e)}},
+   {{LL(0x3a0aaf9e,0x8b3d3bed),LL(0x0be4aceb,0xbc96d843),LL(0xfa286283,0x0b0fe631),LL(0x4fb40200,0x0f56d817)}, {LL(0x9822d0df,0xb127b480),LL(0xa6ef4cea,0x4371e41b),LL(0x7020b057,0x137094fb),LL(0x417d00d4,0xcf389055)}},
+   {{LL(0x06fc7565,0x9c39092a),LL(0xca3567a9,0x171c6679),LL(0xdaedfb9b,0x719cdc8b),LL(0x7bee4586,0x1d518df5)}, {LL(0xe2993ef8,0xc89737c0),LL(0x37e67625,0x18942fc6),LL(0xf9f50d34,0x0a230644),LL(0xfcfac882,0x44b03266)}},
+   {{LL(0x2ff08571,0x4114da9c),LL(0xf77f1ec6,0x9e6efc68),LL(0x626d49b7,0xc743c435),LL(0xd72e683e,0x222a8f20)}, {LL(0x986cfcb9,0xf864ad6f),LL(0x1fbe2e80,0x52eeb7d2),LL(0x2f6e6e3b,0xb337c8e5),LL(0x194b512f,0xe3b1fae9)}},
+   {{LL(0x4461d867,0x558a7d04),LL(0x98e71599,0x96328a05),LL(0xa9723e88,0x0854720d),LL(0x6aab0a8e,0x6493b2ef)}, {LL(0x5879f131,0xe9c2fc77),LL(0xcbd88d45,0x637458e5),LL(0x02edb0ad,0x99ed8dc5),LL(0x25c5178b,0x3d73930c)}},
+   {{LL(0x74538fff,0x8523314f),LL(0xf6f98371,0x6ea73224),LL(0x5968f573,0x63963b7a),LL(0x566859a5,0x6d164517)}, {LL(0xc16d87ea,0xdc821ff3),LL(0x212b5026,0xabe871cd),LL(0x0d22a44e,0x21b5e538),LL(0x61f867fc,0xc9996395)}},
+   {{LL(0x7e1a6478,0x8f036b2d),LL(0xb6b480d7,0xeb02626b),LL(0x853bdf9b,0xbb23a8e9),LL(0x6056a545,0x4f50f068)}, {LL(0x6ccbbe7c,0x22f6f006),LL(0x4e69d1ea,0x4fd2a78c),LL(0x5b6b450d,0xe44bc55d),LL(0xdec81bb6,0xf6ce542d)}},
+   {{LL(0xa4eb0fb2,0xef0a6ef5),LL(0xd4980352,0x9e610a98),LL(0xdb5e1e93,0xfbbd4ec1),LL(0x9bda164b,0x2499dda1)}, {LL(0x5d7c2e6d,0x9ca3408d),LL(0xd8d592ce,0xe1332af4),LL(0xa96df23c,0x17dc0809),LL(0x017da47d,0xf9de1649)}},
+   {{LL(0x046f1fec,0x7c6dbfcc),LL(0x2f3c0d0e,0xdf97df21),LL(0x15554fb4,0xd9c72b46),LL(0x0e0dfe10,0x2dd05582)}, {LL(0x9bc6b1b4,0x96e9d007),LL(0xa39c09c5,0x6733cd04),LL(0xa6d2a173,0xa3aba701),LL(0xb05777ae,0x5db207a0)}},
+   {{LL(0xdf0ea29a,0x1ccf304a),LL(0xb89980ea,0x8acbe8e6),LL(0x1da4a141,0x3e0ea648),LL(0x219e4744,0x3efdba52)}, {LL(0x7ceeb8f6,0x66462315),LL(0xab44289c,0x58b60b9a),LL(0x20358b74,0x20e5caca),LL(0xe7b308d6,0x127c38af)}},
+   {{LL(0xa7998f62,0xd3c94374),LL(0x6bea34f4,0xd7e25617),LL(0x7dee4d34,0x5949315e),LL(0x54172018,0xb2e005ec)}, {LL(0xd453985a,0xa9ae96b9),LL(0x8f34cc17,0xb6b457b2),LL(0x0d29601b,0x2ee5d560),LL(0x22d8b1a2,0x9ced0b39)}},
+   {{LL(0x45bd053b,0x8803a029),LL(0xd710ab22,0x74ac8dbe),LL(0x2decdf50,0x85ec8019),LL(0x7cfcaff8,0x5dbd78f2)}, {LL(0x9cd975f5,0xe1cf9cfe),LL(0xf3c8cb17,0x877f64f7),LL(0xe2af3650,0x7f4a8e85),LL(0xdb0df0b4,0xa9f64e73)}},
+   {{LL(0x6f9bbc33,0x07f05666),LL(0x5c60bb7c,0xb65eb480),LL(0x2c64c0a0,0xf4d592cb),LL(0xb0e393d6,0x4c211ca2)}, {LL(0x63168860,0x579af697),LL(0x0bb440c7,0xd310e874),LL(0x4f9c11f3,0x9ea0d6e5),LL(0x86ff798b,0xea2f7885)}},
+   {{LL(0x39aaf1dc,0xc6da108b),LL(0x6dca2220,0x82102428),LL(0x145e622a,0x14b458ce),LL(0x3b180e3a,0x3bbc3875)}, {LL(0xacb7fd2f,0x3ab22178),LL(0x3693d714,0x0e534530),LL(0xc7ec03e2,0xc1fd929a),LL(0x99a07eeb,0xeb019c7f)}},
+   {{LL(0x91a55cca,0xcb9580f7),LL(0x702ad2c0,0x81028920),LL(0x0375c32c,0x2bb257bd),LL(0xd4b46bbc,0x0dce2ca9)}, {LL(0x817d02bd,0x3c2e5a46),LL(0xe12d33b6,0x85e0e1e7),LL(0xf0b8ddb0,0x580ff8d9),LL(0xc34fcbb3,0x787da7d7)}},
+   {{LL(0x171f9992,0x56494568),LL(0x0ff4a12c,0xc6e25f47),LL(0x79c73f4e,0xc2cd25a6),LL(0xf5eda63d,0x4637cbb5)}, {LL(0x5be0e828,0x9109e57a),LL(0x1f163c08,0x728ef761),LL(0x78dbdeec,0x1e3a6df3),LL(0x2c8de4a9,0xe7f6aca4)}},
+   {{LL(0x90a5be66,0xbce3bab3),LL(0x094756bd,0x919c578b),LL(0x985e7377,0x1ce7e3eb),LL(0x0557048e,0x633c1c09)}, {LL(0xc5b96f12,0x81187ea3),LL(0xd56e1cf6,0x801e85df),LL(0x507eeed8,0xbf95fe8c),LL(0x3698e7cd,0xd0acfd5c)}},
+   {{LL(0x605bac71,0xadaf9a61),LL(0xb123eaaf,0xe0843223),LL(0xddcfde26,0x30ec1468),LL(0xff6a1d88,0x430d451a)}, {LL(0x9adc70db,0xbbdbe0f6),LL(0x1136be03,0x9b46d033),LL(0x16be0fe9,0x52b6373c),LL(0x61ae9043,0xd33f05dc)}},
+   {{LL(0x266f59a5,0xacf5c3c2),LL(0x2fae7be0,0x3604d62b),LL(0x2a41a8d9,0x2f2cc5aa),LL(0x1d6f4fa8,0xfdf7477b)}, {LL(0x08f28800,0x4230eb97),LL(0x40bb4483,0xaa98d929),LL(0xe5d22ebd,0xd4da5774),LL(0x805bb7af,0x15168385)}},
+   {{LL(0x08daebe5,0xd97a96f1),LL(0x9d8999dd,0xd922cf87),LL(0x7936f3f9,0x897c7d84),LL(0x4e7b7181,0x27b549ab)}, {LL(0x4e5b0ad7,0xed0ee361),LL(0xda8f8e55,0xbdff6d60),LL(0x4c048c02,0xe956c094),LL(0x3143822a,0xd24779a0)}},
+   {{LL(0xbd0c00ee,0x0e3aa0d1),LL(0x5a4a7d88,0x1a1bd5dd),LL(0xce070c53,0xc90ef6f3),LL(0x74eca63d,0xa71051bb)}, {LL(0x46832957,0x8a999853),LL(0x81e80e8a,0xb3bbc239),LL(0x016787ac,0xae5b6237),LL(0x5dae8f5c,0x7ce78dfe)}},
+   {{LL(0x517fe3fe,0xbe651548),LL(0xc6a5e772,0x05e62067),LL(0xc9485ed1,0x2210d84d),LL(0x8a6eee11,0x69fde490)}, {LL(0xa469dfb0,0x17968de0),LL(0x602d46db,0xac30d2f8),LL(0xec069e78,0xf657d86c),LL(0xa31aef88,0x757df3c5)}},
+   {{LL(0xc1ff8914,0x37086522),LL(0x723bf167,0x7baec510),LL(0xf3c47a9b,0x490762c5),LL(0x102a471f,0x17bbc510)}, {LL(0x548a760d,0xf0e6a3c3),LL(0xcf1e9ede,0xf285996e),LL(0x8cdd5a04,0xae796a87),LL(0xb8fc49a0,0xdc42ef1d)}},
+   {{LL(0xa9f62b53,0xa633b0a4),LL(0x0c0a3c30,0xc886d312),LL(0x18fa222f,0x393b92c9),LL(0x9db12fbb,0x66e37c3f)}, {LL(0xfab589af,0x02bf22e7),LL(0xd6cd6b36,0xd5d92647),LL(0xceeb48af,0x77f94baf),LL(0xa4f33fc6,0xf019cf34)}},
+   {{LL(0xb7146b3f,0x252a9fd3),LL(0x95d4b67e,0x3766f86e),LL(0xb255675c,0x3ed2707a),LL(0x8a784850,0xeea3ec3c)}, {LL(0x140d6e34,0xf3d857e4),LL(0xf6ceb755,0xbc6cf0fd),LL(0x5dca790a,0x0f712e4a),LL(0x25a61995,0x8f50f81a)}},
+   {{LL(0xbf8603b5,0x34a23983),LL(0x9d5f531b,0x94f00603),LL(0x67fd7eae,0x70e7a47e),LL(0x8212c9e9,0x6bb95327)}, {LL(0x6f210f09,0xc64bf6d6),LL(0x17e5c910,0xbca4858e),LL(0x62ae32f9,0x2a50c942),LL(0x8cefad6a,0x3eebbc00)}},
+   {{LL(0x2652d642,0xcef4d282),LL(0x3befebcf,0x81ed9fa6),LL(0x897e0176,0x90bd51a1),LL(0x9de039ce,0x7984f584)}, {LL(0x4ae3c591,0x5fc4ad6b),LL(0x9e99b321,0x49152d54),LL(0x0dcb2002,0x5523c105),LL(0x95e56981,0x7b90a79d)}},
+   {{LL(0x5c85a96d,0xfd2ee3a7),LL(0x500a7de4,0xd2522a65),LL(0x302acaab,0xf8fd6e88),LL(0x5091d4db,0x7650501b)}, {LL(0xbece48fc,0xed696481),LL(0x7c607061,0xed0f758f),LL(0x777a784e,0xa50c5f12),LL(0x644bb580,0x277930ac)}},
+},
+/* digit=28 base_pwr=2^196 */
+{
+   {{LL(0x5a345feb,0xc3e68861),LL(0x9e673ee1,0x94732631),LL(0x919dd1e0,0x1ca9e16a),LL(0x7ee72ece,0x5c5fd643)}, {LL(0x44132d93,0x6cb9289e),LL(0x9e412dd2,0x13ce8884),LL(0xe5575763,0xc591ca98),LL(0x3d95dba6,0x54d16b23)}},
+   {{LL(0xcd23150d,0x5d14b945),LL(0x7073aca6,0x4c629bdd),LL(0x2ae90a54,0x8b490f10),LL(0x1b954905,0x90ac9273)}, {LL(0xcc859916,0x60d66e57),LL(0x4623ec12,0x8efc0c93),LL(0xee6446d9,0x7cf43e52),LL(0x3b876c0e,0x52f0ed70)}},
+   {{LL(0x408b21aa,0x8e2f513b),LL(0x49c93f2b,0xc0329149),LL(0x01763c25,0x3fa20bb8),LL(0x44f03ae8,0x79a4e372)}, {LL(0x9e656f07,0x62c00166),LL(0xd4f7d001,0xf60e4ef8),LL(0x2fb833e1,0x53f41836),LL(0x44306f46,0xebd05053)}},
+   {{LL(0xbabc0ced,0x7e129f0c),LL(0x387a00e5,0xdc3779d2),LL(0xfd877781,0x565b9104),LL(0xb9b0b6cd,0xbd0a82a0)}, {LL(0x7100e5f6,0x8d3441c1),LL(0xac644c87,0xacb6ff06),LL(0x53338b8e,0x3c225d8b),LL(0x8c1af351,0xceb3d5a1)}},
+   {{LL(0x9a5a0468,0xc1d3bb33),LL(0x61982d21,0xc03b516e),LL(0xb291fef9,0xa9048cd2),LL(0xa8804afd,0x980ad516)}, {LL(0xd0e79a72,0x70f6be8c),LL(0xf4732024,0xb6d54735),LL(0x83e1ab7b,0x806a1018),LL(0x3990d8c7,0x9778043e)}},
+   {{LL(0x93866048,0x077699bf),LL(0xff9227d9,0x65f55949),LL(0xcfcda703,0x16fb1b59),LL(0x21900a7d,0x2e6c84dd)}, {LL(0x135d0e83,0x64e516ee),LL(0x3468b0c5,0x0b23f59a),LL(0x28ab03cf,0x82c7503f),LL(0x16e205fc,0x996c402c)}},
+   {{LL(0x419e91be,0x50df5a9a),LL(0xde5e495a,0xe87107c6),LL(0x5d5e19e0,0xe9794744),LL(0x72da213e,0x4dafa96a)}, {LL(0xc3fa8e86,0x0e6e8b4f),LL(0xb6d77ca7,0x1b8f7cd1),LL(0x706df6a6,0xf8d828b3),LL(0x53d87715,0xcdf6af0e)}},
+   {{LL(0x1a9c897e,0x6cf10c24),LL(0x916a1205,0x0dd8e724),LL(0xfa0d3140,0xcc7064c5),LL(0x84dfd5aa,0x6c86ed36)}, {LL(0x577c7929,0x76dce975),LL(0x5bd6ed9d,0x52f906bc),LL(0x7c6192a4,0xf3ea668d),LL(0x6029320a,0xe17f070a)}},
+   {{LL(0x7469061a,0x1eac24b3),LL(0x4316c77f,0x3dabd22c),LL(0xff89a312,0x8482cedd),LL(0x2c1f6053,0x55fcf94b)}, {LL(0x8fd0d21d,0x33ec6f78),LL(0x73659d64,0x69c11b6c),LL(0x56a3a2bd,0x526daf71),LL(0xfa361075,0xbca687e9)}},
+   {{LL(0x933bf0bb,0x2e4789e8),LL(0x966d990d,0xf116229a),LL(0x533d663b,0xeab882fd),LL(0x1a8dd311,0xb8045837)}, {LL(0x4de2017d,0x81653c5a),LL(0x72913079,0x8fb93d78),LL(0x9a881d4b,0x7fabbd5b),LL(0x6917a675,0x412c455c)}},
+   {{LL(0x6f141551,0xcc2edabb),LL(0x37da30a4,0xb7abf17c),LL(0x5a5a4ae5,0x6ba126be),LL(0xf16420fe,0x62d57539)}, {LL(0x60120f8f,0x0d0f184d),LL(0xea0e3002,0xfc476acd),LL(0x5c72feca,0x44abf2f7),LL(0x7dc4f7d8,0x9475f1b2)}},
+   {{LL(0x8ee523b9,0x73ab9d73),LL(0x284aee1f,0xbab23db2),LL(0x3ac14546,0xbd5ba327),LL(0x608f0ba3,0xa23fac5b)}, {LL(0x21d0ef28,0xaa9572b7),LL(0x4298486d,0xceb5ef64),LL(0x9ef8dcf6,0xa04e77a7),LL(0x19c0045b,0x97f09c3d)}},
+   {{LL(0x30ba26c1,0x7ed8b79c),LL(0xa98102e4,0xb42be53e),LL(0xf4b43279,0x949b3df7),LL(0x9567fee0,0x255d269f)}, {LL(0x7a243517,0x403cb2bf),LL(0xe2ad23fc,0x2a4c65d6),LL(0xf908566a,0x94f1825f),LL(0xfe213455,0xe069a98b)}},
+   {{LL(0x30ea65dd,0x4545362e),LL(0xadb85796,0x34f4dacb),LL(0xb6a4ecb8,0x90ad12a0),LL(0xc28967d6,0x447b03fa)}, {LL(0xd19110b4,0x59838c20),LL(0x8a435879,0x87b82f62),LL(0x43e29bdb,0x8142a729),LL(0x3dfdc8b1,0x8d0b0f18)}},
+   {{LL(0xfb979b3a,0xca762e34),LL(0xc18bbf21,0x397bdcb5),LL(0xf6c2b420,0x96fa7329),LL(0xcddef320,0xbf1704a8)}, {LL(0x18d004e2,0xf6b4158c),LL(0x937442a6,0x152f3bb6),LL(0xd5761c0c,0xa09c23c5),LL(0xb41aee95,0xed2f886f)}},
+   {{LL(0x2f5fdc0d,0xb173531f),LL(0x94545d45,0x8e20f422),LL(0xf89feb01,0x93670135),LL(0x9ab69a17,0xaf918dc6)}, {LL(0x506fefff,0xf51bc727),LL(0xa4265311,0x422f1da2),LL(0xe7bc3d42,0xe51daab5),LL(0x18c5efa9,0xf84e403f)}},
+   {{LL(0x7ae8c1ac,0x4881b506),LL(0x9ccd7907,0x4e91e2a4),LL(0x900f9cc3,0xda8456cd),LL(0x1960c011,0x2ab8bf52)}, {LL(0x40df778a,0xe3a48dca),LL(0x620a5842,0xdb32053b),LL(0x1d1eb87c,0x03d495de),LL(0x356a3b71,0xab3d61c4)}},
+   {{LL(0x67f8fd28,0xaa174b78),LL(0xef4b5a61,0x1fac09aa),LL(0x3e34a1f7,0x1b130350),LL(0x54f8886c,0x7bf5094b)}, {LL(0x46796c23,0xafd7c7aa),LL(0x43229c33,0x29d6957c),LL(0xb3f302eb,0xf072a3dd),LL(0xdfe88ba8,0x02c32f31)}},
+   {{LL(0xdb20ccd7,0xc7e09106),LL(0x743f73f4,0xa4bd9654),LL(0xa3dc78ce,0x0da95599),LL(0x72cfae28,0x592eb031)}, {LL(0x2e33a978,0x08deb061),LL(0x6a6fda81,0x5140e27b),LL(0x1e4ed643,0x112df62b),LL(0xf3bd4035,0x8dc11817)}},
+   {{LL(0x89d5969a,0xe2eb11eb),LL(0x2abf7b5d,0x8b98b412),LL(0x503581f3,0xfadc86da),LL(0x17c93e2d,0xeb6abf84)}, {LL(0x18c01bd9,0x8b79771c),LL(0x4a8dce83,0x1453e3be),LL(0x39d39973,0x1ad87224),LL(0xbf243bc5,0xff090892)}},
+   {{LL(0x382bedef,0x6a1df43b),LL(0x19de6fe1,0x033e8419),LL(0xd4faae54,0x6452d500),LL(0xf0e70af4,0x7500affc)}, {LL(0x01573fee,0x20fd5539),LL(0x243895ca,0x1a743969),LL(0x40c2c57b,0xde1e9429),LL(0x31012c38,0xf6ec005e)}},
+   {{LL(0x7573799a,0xfa4085e6),LL(0x2bed46ce,0xc22af050),LL(0xc5aba2ef,0x27af51d5),LL(0x04db0d39,0x0ec10c86)}, {LL(0x3b24208c,0x1eb81185),LL(0xaf7ad0a6,0xf1679cc5),LL(0x0904950b,0xba4a0113),LL(0x95576705,0x1594a6c9)}},
+   {{LL(0x66a7cf83,0xe77231ad),LL(0xec544394,0x26ab4740),LL(0x57d938a3,0xe6177369),LL(0xe42c3bb7,0xb7b3a692)}, {LL(0x375896b8,0x2fd702b3),LL(0x8c7939b4,0x1d018259),LL(0x41459874,0xf0c4f2b2),LL(0x0dc6f212,0x9378e716)}},
+   {{LL(0x7a66311e,0x3d3c7ec9),LL(0x99d5bfc3,0x5814e370),LL(0x853a2a0f,0xfadc2bf1),LL(0xd56ab5b8,0x1a599e2d)}, {LL(0x69887883,0x8e0dcc72),LL(0x4c350df1,0x21f0fef6),LL(0xe184c7d3,0xcf66d359),LL(0xd6bf6f3e,0xe0a70098)}},
+   {{LL(0x1fc32647,0xd3ebe2eb),LL(0xb6e2b597,0x75bfe1d7),LL(0x1d79f8b2,0xee70e8b1),LL(0x22f84958,0x860dd445)}, {LL(0xb66087ce,0x79594022),LL(0xbcb1f94a,0x63f6cbef),LL(0xf591e4dc,0x5133f830),LL(0xde8bf0f6,0x74e1ecec)}},
+   {{LL(0x94675207,0x857fc8f1),LL(0xc3f35ba2,0xc5296c2c),LL(0x3604dabb,0xbf28b47c),LL(0x27bc3d65,0x04e7327f)}, {LL(0x8f39e0cf,0x4db8a2fb),LL(0x09259685,0x5dc47b71),LL(0xa4de166f,0xe6ed6024),LL(0xe6de71b8,0x1ac28eb8)}},
+   {{LL(0xde0f3ad5,0xa14fc82e),LL(0x71cc9cb8,0xa79d41fa),LL(0x1dcd45eb,0xaa3a9b48),LL(0xef7058d5,0xf032fb9e)}, {LL(0x6faff309,0x36c17b34),LL(0x8ae1feb7,0x4948c041),LL(0xbe01d85b,0x75aaac9e),LL(0x3a87c92f,0xedd090df)}},
+   {{LL(0x66f1bc09,0xd4a51a8c),LL(0x624501c4,0x6937a04d),LL(0xcf517fa3,0x0ea9b494),LL(0x97bd5a1f,0xf6c9f8f5)}, {LL(0xf9d08467,0x40db2fd3),LL(0xf36d7d9b,0x0fc4a3bd),LL(0x3a05f478,0x62b2d0a3),LL(0x0aed0dc4,0x23d10e6f)}},
+   {{LL(0xfaecbd1f,0x99a5243c),LL(0xb4778d2a,0x947cd2ad),LL(0xaf972525,0x732567c6),LL(0x55fa62d2,0x7fc799bb)}, {LL(0x31ae4fe2,0x489b97d6),LL(0x60452dd0,0xfc4d1794),LL(0x97a9d571,0xa209703c),LL(0xd3cdb1fa,0x5376755f)}},
+   {{LL(0xcbf848fd,0x59a04cec),LL(0xd8e08dac,0xce5d2e17),LL(0xc33c7aa6,0x228bab35),LL(0x21fbfb4c,0xafe35bfc)}, {LL(0x9a324327,0xb5bc22a3),LL(0x8f69bbbb,0xa5ebc106),LL(0xd3ce998f,0xb57e2a7c),LL(0x36b3daa6,0xf5124481)}},
+   {{LL(0x55ba441e,0x9c8bb332),LL(0x1e7bb563,0xa59604a1),LL(0x0e866639,0x58a4ed26),LL(0x4a07437c,0x16618c5a)}, {LL(0x42b9f556,0x16ee0e2d),LL(0x84d673cd,0x37212ffd),LL(0x5aa11143,0xca0aa707),LL(0xa19d5673,0x0870c727)}},
+   {{LL(0x0252bb27,0xd42fcabc),LL(0x232d58c7,0xd31640b0),LL(0xd668bec1,0x8ed36735),LL(0xc9ffdbb3,0xda05206e)}, {LL(0xc2cc7511,0x74a5690d),LL(0x9307e6c6,0xd9f700b7),LL(0xddd1f6c5,0x4314cbbf),LL(0xf6a56335,0x684e5fe3)}},
+   {{LL(0xcef21a38,0x293e6d78),LL(0xa5c00798,0x44ff3cca),LL(0x4c14277c,0xd0ba2b0b),LL(0x112bfe0f,0x055937af)}, {LL(0x07f62c86,0x385c5f32),LL(0x2b74d37a,0x2f2174fc),LL(0x87392797,0xfd148548),LL(0x1e915675,0xa042da97)}},
+   {{LL(0x303ffa29,0x483da53e),LL(0xe7e22af9,0xa45444fc),LL(0xb341b59d,0xb35517e0),LL(0x5200e59f,0x3f162587)}, {LL(0x89a10e57,0x989eacfb),LL(0x1d58aa0c,0x607ac377),LL(0x1034dc4d,0x1e4383e3),LL(0xb8333f6b,0xf6f005ad)}},
+   {{LL(0xbd12d31c,0x44ed1039),LL(0xdf31318d,0x7ad933a5),LL(0x573afed9,0x38e47459),LL(0x955aa030,0xf4268eca)}, {LL(0x73557b15,0x2e7fd928),LL(0x3132f7e0,0x5a6eecb0),LL(0xf4aa4e81,0xda969ef8),LL(0xf6d01345,0x32e93212)}},
+   {{LL(0xb71b977d,0x861be850),LL(0x522a1bd4,0x27e74bf4),LL(0xd6cd632c,0xc1bf979b),LL(0x45ade444,0x42ff0569)}, {LL(0x844f9670,0xd83c47d5),LL(0x2a6ee193,0xcd043a61),LL(0xcffb1e1e,0x83eeaed6),LL(0x74f69cbb,0xd5f247fa)}},
+   {{LL(0xb07b4847,0xa3672b4d),LL(0x5f18adee,0x6924cc93),LL(0x0e3010aa,0x2bba7f99),LL(0x1247525f,0x67a19679)}, {LL(0xdb300d06,0x8a803471),LL(0xbe746d66,0x9e4cbdc1),LL(0xa19a438b,0x7697620d),LL(0x1d3bf87d,0x6bcc02b8)}},
+   {{LL(0x035db19d,0x7e6120e7),LL(0xd4c5bffc,0x7bdc87a3),LL(0x0c55329c,0x253e640d),LL(0x5d8b08b7,0x66a3e79a)}, {LL(0xa1e098cd,0x5207c026),LL(0x281f8392,0x0ebf16ec),LL(0x92a0308c,0x23496b1d),LL(0xeee3b5e2,0x656a37b0)}},
+   {{LL(0xdbb1a336,0x06484363),LL(0x3144be3e,0x8f75d177),LL(0x94556995,0x9ba6b64b),LL(0x4f60f3ca,0x582752fd)}, {LL(0xce077119,0x0ef1112c),LL(0x330adf94,0x7d1f096e),LL(0x8c8beb8a,0x3d056e19),LL(0x8a818f22,0x3b37452f)}},
+   {{LL(0x25942cb6,0x3a981b6c),LL(0xb4e8a449,0x7c44afb3),LL(0xe24754c3,0x6fb1219a),LL(0xa1dc0ee0,0xfb0beafb)}, {LL(0xde9fdc45,0xe304522e),LL(0xfb993b6f,0x199c9acd),LL(0x467540cb,0x3db844d1),LL(0x237609c2,0xfb17ad8e)}},
+   {{LL(0x305ecfba,0x71b8e5e2),LL(0xee3e142e,0x4db5ff32),LL(0xd0e4952b,0xb63861c8),LL(0x0a9fd323,0x31615374)}, {LL(0x419ff1de,0xc5018bd3),LL(0x268e760b,0xfe154089),LL(0xa58839a8,0x080560f7),LL(0xfa63c18c,0xa5651a9a)}},
+   {{LL(0x3c0dd3c0,0xa56a5db9),LL(0x8c605fd0,0x369d9633),LL(0xe4abdc10,0x874c80e4),LL(0xbed73e2d,0xa51ccf80)}, {LL(0xe811f73a,0x0d4c5785),LL(0x56d184c4,0xbdb20bb2),LL(0x829f8f77,0xe2f17d5d),LL(0x62d206e8,0x5a9c6110)}},
+   {{LL(0x0f120aac,0xa2c162b3),LL(0x0719f0e5,0xce7d87a9),LL(0x72771aa1,0x34b0af6d),LL(0x61664490,0x14cd1358)}, {LL(0x2e583d09,0xca246242),LL(0xe5dc4f8e,0xacc7101e),LL(0x1cac2227,0x81ca4350),LL(0x1cb956d6,0x1e2d5e1c)}},
+   {{LL(0xf6c6c40d,0x91c1784f),LL(0x79b69f88,0x87d207b2),LL(0x99bfeb83,0xb595c7f7),LL(0xf5a2a30d,0x00255997)}, {LL(0x1429a65c,0x173c06d0),LL(0x1c1e88b9,0x3b736d65),LL(0x1d352b26,0x4b837afd),LL(0x61f6015e,0x28feff48)}},
+   {{LL(0xcc6f755a,0x6a018604),LL(0x2480cd13,0x237e99f7),LL(0x4806e70c,0x9e4b61ec),LL(0x2dc701e0,0x432cd9c9)}, {LL(0x4cc2e9df,0xb53a6c87),LL(0x3f55ee1b,0x480cec78),LL(0x1b75f42c,0x6529be1f),LL(0x9d8172ce,0x02ea00a7)}},
+   {{LL(0x5111964d,0x4becc439),LL(0x26bc1b2f,0xbbacb9e8),LL(0x4cbb86bc,0xb54c03c1),LL(0x2409efbd,0xe9a4062a)}, {LL(0xa36c2d81,0xf2bf82aa),LL(0x1934fb8b,0xca54403e),LL(0x815530ad,0x9fa14838),LL(0x4b3b9dc7,0x61d20960)}},
+   {{LL(0xfc3fdf00,0x5d025851),LL(0x903f4e1e,0x6d54c968),LL(0xfbf0eabf,0x19bce90a),LL(0x7e2705b0,0xa6fc82f8)}, {LL(0x3859deec,0xb6713954),LL(0x7fc14fb0,0xaf7ce848),LL(0x201649b7,0xefc16858),LL(0xb9290c9b,0xd54149f5)}},
+   {{LL(0x8d74d480,0x8fabb8b5),LL(0xa79780e4,0x5d5e811f),LL(0x1a913e41,0xab5d6056),LL(0xc20fe5f7,0x25752259)}, {LL(0xcc886df1,0x90e0ae01),LL(0xa9b62a8c,0x6ae21693),LL(0x8eb63740,0x8b091617),LL(0xfa4582e1,0xf606d236)}},
+   {{LL(0xb6fa9957,0x327cdd57),LL(0x090a843a,0xd437dd5a),LL(0x110a160f,0xa71e8ffa),LL(0xe0e7b8d7,0x06cc9a0b)}, {LL(0x4149c7e4,0x9c68c246),LL(0x2c97a9c4,0x93b3f30a),LL(0xf7bae99f,0x9c455710),LL(0x450919a6,0xc4021591)}},
+   {{LL(0xca71787a,0x78a9291e),LL(0xc6ce47b5,0x7f53ea16),LL(0xa645bdd9,0x5afd8059),LL(0x6f5dc11b,0x4a92ad88)}, {LL(0xb50989d6,0x98cf0d1e),LL(0x5451f18a,0xc951af42),LL(0xaf845330,0xe22952cf),LL(0x135127ad,0xb41280c6)}},
+   {{LL(0x4eaa282d,0x186e9876),LL(0xd00bd0c1,0x349d9cf2),LL(0xfc113b5e,0x62fc626c),LL(0x5c1c01e7,0x3bbdb9cc)}, {LL(0x8e6ee6af,0x1718ea72),LL(0x037c4309,0xee65d8a9),LL(0xb03a7695,0xe6fd0e89),LL(0xd98392ed,0x3d1e7ee7)}},
+   {{LL(0xb6be9b31,0xaa13d316),LL(0xde741080,0xa82574d3),LL(0x2d528dc5,0xfb7d547b),LL(0xdc2367a8,0xc248c38f)}, {LL(0x2e6e4f5c,0x03839186),LL(0x199a3579,0xddd69fc4),LL(0x6e436954,0x511e8047),LL(0x66e2ebe5,0x55111f7f)}},
+   {{LL(0x21f7f7d0,0x0bf9fba7),LL(0x4f503538,0xb2478ee9),LL(0x7dcafa3c,0xc005ace4),LL(0x4272f368,0x1635337a)}, {LL(0x648f00b0,0x58571699),LL(0x9aaf3dfa,0xa3a63085),LL(0x0404286c,0x7739e0b4),LL(0xec8a001d,0xdeac15bf)}},
+   {{LL(0x73c2c5aa,0xde66bbb2),LL(0x521b56b3,0x7efd8f2c),LL(0x5acba831,0xaea4b798),LL(0xbb49ba96,0x7d2ed42f)}, {LL(0x8b3dd207,0x6627737a),LL(0x23d6e4e3,0x9bce96a8),LL(0xa1e6d36e,0x9b0dc0c8),LL(0x01d74556,0x8ac65271)}},
+   {{LL(0x5824e483,0x88116d65),LL(0x015a20fb,0x8bec1540),LL(0x84c6c201,0xc0fd1be4),LL(0xd0aec624,0x7229bcb2)}, {LL(0xb12d4458,0x432f6a32),LL(0xba1d6f9f,0x6d23feba),LL(0x9670810c,0xe42aa0d7),LL(0xd7016713,0x0853a4fd)}},
+   {{LL(0x6d80279e,0xccd5597f),LL(0x6415c533,0x38da04c8),LL(0x2671181e,0xb10d7b78),LL(0x97f364a6,0xcbdd8d46)}, {LL(0x2dec2002,0x58364e10),LL(0x4a710e0b,0x32ac4f69),LL(0x7a76aa7a,0xe1014a5e),LL(0xf5a52659,0xef12fb9f)}},
+   {{LL(0x52a9f0bc,0x896e0150),LL(0xa9f30cdb,0x1832343f),LL(0x8a8b97c5,0x7e6c3855),LL(0x430c0bce,0xec35aa60)}, {LL(0x478c2e04,0x62a91ae0),LL(0xf9f6ed5d,0x3fb0e632),LL(0x38180a2e,0x611a808b),LL(0x38b51175,0xd97783e4)}},
+   {{LL(0xf6e205a3,0xd8f99af9),LL(0x7603c5d7,0x23a9c215),LL(0x362902a4,0x7ea47656),LL(0xdd156f0d,0x72e5156c)}, {LL(0x0d3fea96,0x7ed9876f),LL(0xb7eae5ba,0x6528a2fa),LL(0x3a347530,0xd4853ba7),LL(0x134b274d,0x382efc86)}},
+   {{LL(0x58b369a0,0xdc127dca),LL(0x5f402ad2,0x1643504e),LL(0xd34d6c27,0x6b4f38c1),LL(0x67f116ac,0x371ce6bb)}, {LL(0x79cd879f,0x484c8eda),LL(0x22a9b85f,0xf424d865),LL(0x757f428f,0x92fe7517),LL(0xdd4af7b7,0xd25e6d86)}},
+   {{LL(0x8eeb2111,0x950f14a4),LL(0x4df584ec,0x49148d81),LL(0xf948cd07,0xe5e9c633),LL(0x5448cbbc,0xea7f6c95)}, {LL(0x899f519f,0xa0c97d7c),LL(0xdec1498b,0xc4e5ba41),LL(0x26217d05,0xb9a91f3c),LL(0xf384ceb0,0x3a4f282f)}},
+   {{LL(0x8222f133,0x3cf68601),LL(0xc8f2dc86,0x8b278591),LL(0xa8da2ebb,0x81fa4793),LL(0x9d1c4401,0x8569fd5f)}, {LL(0x75f885bc,0x6efc18af),LL(0x2748eb65,0x143bfbae),LL(0x15a3c6bf,0x522ce2b3),LL(0x83136c73,0xb136ad14)}},
+   {{LL(0xa5c81101,0x5e783a9f),LL(0x55f25f26,0xc86e2aae),LL(0x90a28f88,0x3a743e06),LL(0xcc0738f5,0x98dd5b9b)}, {LL(0x8eae6a69,0xd8614cf3),LL(0x5756c5eb,0x7875a5bf),LL(0x5ead9d7d,0x51449dc5),LL(0xa8a01af9,0xc14224ba)}},
+   {{LL(0x804706f3,0xf7fdae2a),LL(0xaea936e5,0x6c13606a),LL(0x2262e4c0,0xc1d46957),LL(0x916ae9c5,0x722196be)}, {LL(0x5b9e876c,0xb4eeb8c6),LL(0xe2050402,0x52ab1ca9),LL(0x2bb01a10,0x7faad61a),LL(0x46592c7f,0x9f68f264)}},
+   {{LL(0x90e060dc,0xb8f91727),LL(0xaf6c0a26,0x851f6196),LL(0x41f539ad,0x6d263d0a),LL(0x6f4d2c1a,0xdce679ec)}, {LL(0xe2b72cc9,0x7fc664e2),LL(0xd3b330cf,0x615b7e94),LL(0x203bea7f,0x2b34720a),LL(0xb60243e3,0xa8b5b403)}},
+},
+/* digit=29 base_pwr=2^203 */
+{
+   {{LL(0x43948fd9,0x73e4881f),LL(0x30366891,0x59a92320),LL(0x4ba4834a,0x4bbabbc8),LL(0xc82c07ab,0x1c497968)}, {LL(0x071532ef,0xd0cd7131),LL(0xaf7707f8,0x98cc656b),LL(0xe243b3b6,0x215b5613),LL(0xe6768fb1,0x934a9326)}},
+   {{LL(0x86981a47,0xbceffd5c),LL(0xfd7b3c8a,0x73f3fba7),LL(0xeb8dbfff,0x68e7c94c),LL(0x5ef58c7f,0xeeb9498c)}, {LL(0x4682cc17,0x6a3030c5),LL(0x11fa7606,0xe4891534),LL(0x7f67ec7c,0xee5f6317),LL(0xc1044c1e,0xb54667fa)}},
+   {{LL(0x17e2fd63,0x6fb2c996),LL(0x4c8403d2,0xb0185503),LL(0x9d358b90,0xc5be1024),LL(0xc4378579,0xf0f24bb7)}, {LL(0xfb4febb9,0xa7efc299),LL(0xfa08ba72,0xc3a2ef59),LL(0x88f05366,0x18fa7dc2),LL(0x02547849,0x1a74e2d7)}},
+   {{LL(0x4de9a577,0x5a4eac4a),LL(0xf6fe9c02,0x90cc24f8),LL(0xf8a905cb,0x8a0f6f18),LL(0xe4f1762b,0xbe9e8262)}, {LL(0xecdf087a,0x35576bfd),LL(0x0a6bc78c,0xba3e0388),LL(0xa17c0a34,0xb4e8192f),LL(0x5a880efb,0x4570ba90)}},
+   {{LL(0xcac00b9f,0x07de0d68),LL(0x01800a6e,0xe1fdd6a2),LL(0xe5314d35,0xe3b90ba3),LL(0xdb744306,0x44546439)}, {LL(0x2203b37a,0x6380716b),LL(0x4e91af7f,0x23cbe8d1),LL(0x8ee4dc29,0xf1985187),LL(0x94fc8d9c,0xfd8573f0)}},
+   {{LL(0xe1a62a2a,0x83a1d51a),LL(0x7e853d0b,0xe87e402c),LL(0xc4e90530,0xfe9a6035),LL(0x4abefaca,0x54b5cebc)}, {LL(0x1d5169b5,0x15619949),LL(0xd73c1c4a,0xc0f00556),LL(0x3cbecf5f,0x18e43a45),LL(0x166de9cd,0xeb01b421)}},
+   {{LL(0xcfb20485,0xc8e8c309),LL(0x363ad7c8,0xd77d67fe),LL(0x69f701cf,0x6e7f4b25),LL(0x7fcaf871,0x79e92157)}, {LL(0x6ca3cdfb,0x7f4833fa),LL(0x38e5faa6,0x56b05354),LL(0x132462aa,0xc8aed299),LL(0x56132d98,0x10822589)}},
+   {{LL(0xaaf92685,0x90dc63e2),LL(0x5dbb9cb4,0x3e04d972),LL(0x31e8c6ee,0xce4fc968),LL(0xa0c59074,0x1e97a81a)}, {LL(0x3c304572,0xb0155234),LL(0xf8eb4b73,0xebb53fa6),LL(0x9805090a,0x7215aa0e),LL(0x89850a7c,0xda3638f6)}},
+   {{LL(0x56571a34,0x7c597653),LL(0xe703d189,0x7d1b3acf),LL(0xa9e4c7b5,0x60c8c189),LL(0x9d88d904,0xcc32247e)}, {LL(0x7da293ad,0x24497feb),LL(0x25e53072,0x899b3b45),LL(0x9a86cbd1,0x797cf7ce),LL(0x021e289b,0xf8b78760)}},
+   {{LL(0x234e22ae,0x19a86a03),LL(0x28df8a46,0xf68ea837),LL(0x6963bccf,0x08490650),LL(0x7b0290d9,0x6456066c)}, {LL(0x46499926,0xe88db823),LL(0x7f1dee4b,0x89286a63),LL(0x92056fe8,0xc7c89dc4),LL(0x59305ba7,0xf2199a15)}},
+   {{LL(0xd37aeaab,0x63a0623e),LL(0x92d702bc,0xddc6e8bf),LL(0x9194b809,0x4c50fa3b),LL(0x83f8495a,0x2f80f0db)}, {LL(0xd2d3a24b,0xb9e81cc7),LL(0x19aa05eb,0xac4078c7),LL(0x3075d71f,0xfc7cfe11),LL(0x78880670,0xbf6420c1)}},
+   {{LL(0xed296c83,0x9abdd2e0),LL(0x05520143,0xfd1b5fb5),LL(0x081b3399,0x41fdc147),LL(0x5f1513b7,0x1857f543)}, {LL(0x9660f655,0x3c8336ed),LL(0x0f10bfdb,0xfce431ac),LL(0xca805a94,0x0ea84745),LL(0x1028dc9e,0x6b90c9a5)}},
+   {{LL(0xf5e2d8c1,0xc74f59b6),LL(0xa995f1ad,0x3420e4b0),LL(0x6f27c2e6,0xf445163a),LL(0xfee9e64e,0xc9e836e0)}, {LL(0x4a5662d4,0x72bbd993),LL(0xe4b3be3c,0xede33c30),LL(0x0b72e9f7,0xe6585a6f),LL(0xd7166923,0xe9db4f62)}},
+   {{LL(0x1e8dfc9c,0xc2b35669),LL(0x0c63dd17,0x6821eccd),LL(0x5d08af0e,0x04ac5aa7),LL(0xf22bb6d8,0x205d4f2f)}, {LL(0x150b9f08,0x410f9432),LL(0x438ba36c,0x030a14aa),LL(0x22d085c4,0x877bdbd3),LL(0xe57bdbc0,0x73fca18f)}},
+   {{LL(0x96866778,0x12f67776),LL(0xb8d7aff2,0xaf2056cb),LL(0x515ac929,0xcb7a820c),LL(0xd8cfc654,0xab8cc213)}, {LL(0x2c7d24db,0x61191a7e),LL(0x488091da,0x49c80525),LL(0x594de7c1,0x13fffbb7),LL(0xae545628,0x2630e5e3)}},
+   {{LL(0x99436a93,0x4036f60a),LL(0xd6fc4c47,0xb8345c33),LL(0x6bf5efa3,0xd92e66ad),LL(0x2f182c67,0x93ff4e74)}, {LL(0xa2cafa21,0x99ff20f6),LL(0x27c3cc55,0xd3fd11ac),LL(0x495f26f8,0x2db290d6),LL(0x7308f762,0x6f5230bd)}},
+   {{LL(0x675c39d2,0xc55b6693),LL(0xffb648c2,0xc2dd17a6),LL(0x9db65d12,0xf499fc54),LL(0x45dcf94a,0xafaa2ca2)}, {LL(0x378b466b,0x127e2476),LL(0x1560ad4a,0x3cf3ae73),LL(0x6505f13b,0x9421abd3),LL(0xb8bbb833,0xe256035b)}},
+   {{LL(0x330469a7,0xed5954e3),LL(0xe6eb7d66,0xc7a47e05),LL(0xfe1788d8,0x9cba7e17),LL(0xf5891c9f,0x649ed415)}, {LL(0xbfbfa732,0x95d927e9),LL(0xd0ad1ab6,0xe49b7cdd),LL(0xe810c89b,0x5428cd4b),LL(0xbef210fd,0x8531f1f1)}},
+   {{LL(0xa7e82d5a,0xc3a905d1),LL(0x481c716c,0x7d05441f),LL(0x2c64caad,0xde3e623c),LL(0xf7648a4c,0xaa087c88)}, {LL(0x812dd797,0xfd854cd3),LL(0x704f9b00,0xf7e38751),LL(0x67e199d4,0xdbc68933),LL(0x6b7abe7a,0xcaf9859e)}},
+   {{LL(0x7092fcd9,0x7e69d33b),LL(0x9ce5d034,0x62caba84),LL(0x4f9d8e2a,0x8f76c891),LL(0xb5402c13,0x80453491)}, {LL(0xba158686,0x3b12029c),LL(0x79e5f710,0x68c30374),LL(0x13379967,0x0172c088),LL(0x66c1bec3,0x815a7cd6)}},
+   {{LL(0x3583f26b,0x4fb772fc),LL(0xbc6de4ac,0x184e910f),LL(0xc78d11f7,0xe240766f),LL(0x228ca31c,0x9b91d8b7)}, {LL(0xf936b869,0x49ac65ea),LL(0x7eb94485,0x305e35aa),LL(0x9902e550,0xf98898b3),LL(0xf4882892,0x39e2e1c4)}},
+   {{LL(0x510fb2c6,0x1b1f7153),LL(0xa8dd49b5,0x926281d9),LL(0xe19aed6e,0x95b18e64),LL(0x147dbc34,0xb2fd0487)}, {LL(0x78ea2218,0xe24c19cb),LL(0x41c97ecb,0x29d82c2f),LL(0x2189b254,0xa25e240e),LL(0x7d30325a,0xc091b10b)}},
+   {{LL(0xb0df531c,0xbd97328f),LL(0xf59fde17,0xb9642e17),LL(0x283d48f2,0x2fbc1e3d),LL(0x6f78070c,0xf1df02a4)}, {LL(0xf84e6631,0x02bedfe3),LL(0x78dad683,0x52f8d43d),LL(0x495259e1,0xf46103ad),LL(0x8c15eabc,0x1618b4d5)}},
+   {{LL(0x4c9f94eb,0x7113c774),LL(0x73cec3fc,0xe46378ff),LL(0x01f758cf,0x9afcf2e2),LL(0x4fd204c5,0x107d8637)}, {LL(0x02eb7e91,0xaddf03f0),LL(0x2c323958,0x3e9a53c4),LL(0xb8873b00,0x7704e522),LL(0x932ee5dc,0x66df134f)}},
+   {{LL(0x03c7f3af,0xca79a1d5),LL(0x2ae47fa3,0xebe20ef1),LL(0x17230342,0x7714e3d2),LL(0xe40aa533,0x9c7811df)}, {LL(0x3e9a5051,0xae91d2ce),LL(0xe238f9b8,0xba285530),LL(0x0339766e,0x89d5cd2b),LL(0xb413f986,0x93663f84)}},
+   {{LL(0x81ca1f1b,0x064f86c4),LL(0x084acda8,0x9f293ddc),LL(0xb6175db8,0x8342b1a4),LL(0xea2ff365,0xe5fe5f9c)}, {LL(0x9d38449e,0xf3261914),LL(0x9bad5bab,0x0ab18c01),LL(0xf7f413b0,0x33e27bfc),LL(0xa97eeaa0,0x28cd4f57)}},
+   {{LL(0x2c332a9e,0x0fdbd2ae),LL(0x98701115,0x33b836f3),LL(0x063f0086,0x10e0f050),LL(0x019feb54,0x5b27b3ed)}, {LL(0xaeb7d5d4,0x0ca3658b),LL(0xea6406a2,0x78fe9de9),LL(0x9408d163,0xc5ec233a),LL(0x68a1e5a9,0x396ab585)}},
+   {{LL(0xc231e8a6,0x8f6b833c),LL(0xa929692b,0x27b25935),LL(0x448acf72,0x7a5b6ad3),LL(0xaf16bdb0,0x8dcaa5f3)}, {LL(0x3374f7e6,0xdff06c32),LL(0x539a3701,0xd60546c0),LL(0xb54f29a0,0xea6c8be1),LL(0xae9283bb,0x4f4d05d1)}},
+   {{LL(0x302e29a2,0x9b6f4735),LL(0x93072f24,0x4b885807),LL(0x2b80ad3b,0xdf9735a2),LL(0x447cf546,0xd7698639)}, {LL(0x7166f887,0x85d1b691),LL(0xbb266c5f,0xbee67ee7),LL(0x3352e10e,0x2f26f4cd),LL(0x1810c9a7,0x3da9d102)}},
+   {{LL(0x0aef0604,0x57f580da),LL(0x320045d7,0x077a2a8d),LL(0x066f356b,0x26f0145d),LL(0xd4f8e96a,0x53cf17cb)}, {LL(0xe5f65a1e,0x5d676a61),LL(0x2d47c1ef,0x5b90c19b),LL(0xe8e38fb0,0x3191c793),LL(0xa9d2327a,0x693b12ec)}},
+   {{LL(0x69d0f052,0x55f34643),LL(0x45f84534,0x33e1d555),LL(0x80701273,0xc42a509a),LL(0xe12011ba,0x44e2ba25)}, {LL(0x088d877c,0x873dfef6),LL(0x4d5678a4,0xe7fcf39e),LL(0x4da139d9,0x4e30113e),LL(0xe5862a18,0x2bb3e16d)}},
+   {{LL(0x3b4eabca,0xedaaadeb),LL(0xc2e27942,0xb76de7e3),LL(0x2b75c3ec,0xd90f7323),LL(0xb06a598c,0x6b535135)}, {LL(0xf2d7d8cd,0x734cecd5),LL(0xbfe66081,0xf12326b5),LL(0x0f34c8a5,0x34911c45),LL(0x8df7353b,0x7951bf63)}},
+   {{LL(0x46d7b4fe,0x30896843),LL(0x278cac2f,0x243d4a42),LL(0x37d003f0,0x45611751),LL(0x2376533d,0x33805b67)}, {LL(0xa85fe8b7,0xc445afc6),LL(0xb15158f5,0x301222b3),LL(0x4b14036f,0x154d52e9),LL(0xea0ecc82,0xc8476fc3)}},
+   {{LL(0x3208137c,0x94da1496),LL(0xafe1a8c7,0x3baa129f),LL(0x9703f557,0xb85a2f96),LL(0xd725a5ff,0xf42dccd7)}, {LL(0x65056cd2,0x3a33f179),LL(0x0cf94095,0xd881ccf7),LL(0x6303e783,0x340e0cd8),LL(0x88217f1b,0x416cf684)}},
+   {{LL(0xed007f36,0x786cf04d),LL(0xd88c1942,0x175f74ce),LL(0x6d68fc4d,0xed048973),LL(0xb964a38c,0xce395cfe)}, {LL(0xcd330ee4,0xe9743bdb),LL(0xf97a762c,0xf17bab34),LL(0xad928c68,0x22255884),LL(0xb9e8077c,0xd3c1d23d)}},
+   {{LL(0x5ab75374,0x58fb102d),LL(0x60846ed3,0xb1e9c754),LL(0xfb7f0375,0x9018297f),LL(0xc463a80a,0x7fb4a936)}, {LL(0xfde681f2,0xf3a3795a),LL(0xdbdaa227,0x921d68ba),LL(0x3bdd60a9,0x037f9f76),LL(0xb72dc615,0x1ffa2eb9)}},
+   {{LL(0x9d13790d,0x0299f815),LL(0x15386061,0xb998bb02),LL(0x3a4bd602,0x927fba47),LL(0x88839181,0x09e52c2c)}, {LL(0xcd4cb312,0xcb72dfee),LL(0x9e7a20ad,0x0f8110e2),LL(0xb731a1d0,0xe8f4f028),LL(0xcf0bdfd9,0xd34f72da)}},
+   {{LL(0xf9e4e9dd,0xed220086),LL(0xdcf7a7c2,0xf010bc70),LL(0x18cba86b,0x82548215),LL(0xd17e2640,0x53991db3)}, {LL(0x36e78893,0x15a1d452),LL(0x5196deb8,0xb7016435),LL(0x8a5a113c,0xc0a694a2),LL(0xf88f4a96,0x8869c5ee)}},
+   {{LL(0xa04cf5a4,0xc87493d3),LL(0x2acf8ae9,0x8fcbf9cc),LL(0x5f4577ae,0x31a69667),LL(0x17860f6a,0x90b308c3)}, {LL(0xb8100661,0xad52f355),LL(0xe1cdd233,0x88c56f9d),LL(0xfdea75e7,0x8573eaf1),LL(0x918b105f,0xa9e1a6eb)}},
+   {{LL(0x1c2ed307,0x4dfc3495),LL(0x83e4c758,0xab3c77b0),LL(0x492c18a0,0x867478a1),LL(0xa2f2b0a0,0x363c4869)}, {LL(0x79feb005,0xb8aaafb0),LL(0xaff2b9b6,0x7f4aa6db),LL(0x40d3e3be,0x146dd323),LL(0xbf896fa5,0x1c385ffd)}},
+   {{LL(0x05e786e2,0xd14c6725),LL(0x8393c822,0xea39a1f7),LL(0xdea90ff5,0xada3c067),LL(0x8583cec0,0x365330b6)}, {LL(0xfcb19bbd,0x3436c5e4),LL(0xc17936ce,0x79300037),LL(0x75c3cdbf,0x286cff99),LL(0x3b97a2c7,0x8fe01f04)}},
+   {{LL(0xc995187e,0x8c83d6ce),LL(0x02177827,0x19c277d7),LL(0x3df3e2b9,0x489905b6),LL(0x0427dafb,0xf08f0b89)}, {LL(0x1bc1da3c,0x158cc809),LL(0xca1e4416,0xcb43a5ab),LL(0x8b0c40e0,0x56583d2b),LL(0x13e158fd,0xf2526dfd)}},
+   {{LL(0xe83bb2ca,0xe5a563d6),LL(0x8866c759,0xa6f92dec),LL(0x08842e64,0x70925060),LL(0x08b00da8,0x85e46e92)}, {LL(0xfb7f58a8,0xf2285e11),LL(0x9d6e0309,0x317c848b),LL(0x0e36fffc,0x7433b94a),LL(0x30c9303f,0xece6af5f)}},
+   {{LL(0x736e0f75,0xfbd9d440),LL(0x6096a0e5,0x08626766),LL(0xa7765537,0x87d4cf9e),LL(0x0afd09f9,0x8e9677f4)}, {LL(0xc4329375,0x891784e4),LL(0x6fdc5971,0xc8a93e29),LL(0x56384813,0xa91dffdc),LL(0x6c4aeacd,0xab63e41f)}},
+   {{LL(0xa107d69a,0x1c68ba35),LL(0xea22b707,0xd584a355),LL(0x2a60a584,0xd137b7a6),LL(0xf7aed1de,0x52451306)}, {LL(0xfdfb77e0,0x033cbbba),LL(0x91b6efcd,0xc86b62e6),LL(0x79ceab1b,0xd9a1d969),LL(0x8e6c5aef,0x1592a98f)}},
+   {{LL(0x459ab9c4,0xd435d4cb),LL(0x031ed4a4,0x14906fcc),LL(0x9e557179,0x914ed064),LL(0x580276ed,0xd385933e)}, {LL(0xf72540bb,0xaa6ec120),LL(0xbb82293a,0x346cb924),LL(0x852d4c25,0x07faec7c),LL(0x800d2598,0xac085aa3)}},
+   {{LL(0x27003ab5,0x0365b469),LL(0x7ac1bd17,0xe19df62c),LL(0xdd18d34d,0xa2552da7),LL(0x95e2a1c8,0xcd512c87)}, {LL(0xcaa52503,0x241248fd),LL(0xcd7100b1,0xe61686c8),LL(0x5ad031e6,0x44a299c8),LL(0x65630cab,0x81e798ca)}},
+   {{LL(0x38f33ffa,0x29b78ec5),LL(0x8274ede8,0x4c977d91),LL(0xe30a3670,0xc2509da8),LL(0x7e1314bf,0xca4f3811)}, {LL(0x10502f91,0x6f17120d),LL(0x7e9ec0a0,0x83a6a5a6),LL(0x5ffa281d,0xea385d46),LL(0x27788a7f,0x9b5617f0)}},
+   {{LL(0x7fd944f9,0x3d82474e),LL(0xe78463c9,0x0a51dd22),LL(0x1e48b437,0x7c89de98),LL(0x1c6ec067,0x266f3bcb)}, {LL(0x8c3ded5c,0xc70605ff),LL(0x29aad028,0xafdf2f2d),LL(0x9b5e49d5,0x9391adc0),LL(0x58d8ad28,0x287c71ae)}},
+   {{LL(0xd0eeed6d,0xc30e49aa),LL(0x09b7e01f,0x38a0df51),LL(0xbf50d9d4,0x99b8e9fb),LL(0xa7631129,0x9f7b9a62)}, {LL(0xd96673b3,0xe5b91eff),LL(0x11367a82,0x787e3b4d),LL(0xbb46ef48,0x4acd9f15),LL(0xb03e4bde,0xe53397aa)}},
+   {{LL(0x418bf6c5,0x34779fdb),LL(0x9b65d515,0x6652a440),LL(0x2b4b09a0,0xdde9341b),LL(0x71caa860,0xeb738363)}, {LL(0xa4dcbf1d,0x877c5748),LL(0xe196f289,0x1ef56130),LL(0x361cd371,0x0f3aab3e),LL(0x148923e8,0x6e18d6bb)}},
+   {{LL(0x7b1e1275,0x21c62346),LL(0x6079338a,0xdf9423b2),LL(0x8754b499,0xbfbddeeb),LL(0xa9c4331a,0xdf533f81)}, {LL(0x259965ba,0xc7cbeff9),LL(0x15cafacc,0xa0baa9f2),LL(0xe67e271a,0x1c21913b),LL(0x891be506,0x50af9c3b)}},
+   {{LL(0xa2a70f5a,0x126f5e11),LL(0x43dce789,0xa0122964),LL(0x85ff5d02,0x9fffa026),LL(0x2c88f575,0x60129f63)}, {LL(0x431f28ef,0x84c6fe69),LL(0x90739c61,0x4c8f9fa8),LL(0x8918e61c,0x736f417b),LL(0x3b015817,0x8b6aba7d)}},
+   {{LL(0x0f55af3c,0x9e68deb6),LL(0x319db7ff,0x4d9e096c),LL(0x96dfd36c,0xa501a30a),LL(0x22b6c762,0x40e04cea)}, {LL(0xa2399320,0xb68301a5),LL(0x2e949778,0x27b4166f),LL(0x43ed3058,0x0dc6e078),LL(0x824aec05,0x639c56a7)}},
+   {{LL(0x221d3df5,0x6f7d6840),LL(0x515052ba,0xcc239513),LL(0x53daa4d9,0x9bae1b32),LL(0x55f48d65,0x092ef600)}, {LL(0xfd580512,0xb9900574),LL(0x3f311517,0x5a5c817d),LL(0x4b254f3a,0x05ae9b81),LL(0xc21ad77b,0x5c3e5317)}},
+   {{LL(0x8fca71ca,0x6e8a3eab),LL(0x27873f63,0x6c7f8347),LL(0x28085e33,0x5ec047a3),LL(0x18427572,0x67680fce)}, {LL(0x15b0869a,0x6d47b399),LL(0x34a2e285,0x98c3603c),LL(0xf52a8416,0xa433e765),LL(0x5db86652,0x5bff0584)}},
+   {{LL(0x9e7fecde,0x7f70d3dd),LL(0xa83b381b,0xa2b89863),LL(0xa6b99289,0x300c3288),LL(0x75013e20,0xdd13c2f9)}, {LL(0xbac12b16,0x06359cfb),LL(0x2b43f3b3,0xd2b55576),LL(0xf210632a,0xb15ba830),LL(0xe56df9e7,0x20b6efa4)}},
+   {{LL(0x1f9177b4,0x0938194e),LL(0x8f405fd1,0x7c016035),LL(0x457d6a03,0x252134d2),LL(0x53a2e10c,0x4685d4b4)}, {LL(0x02eac216,0x8f1c37e0),LL(0x5a496eb3,0x179b623d),LL(0x93e372b6,0x5a6d58dd),LL(0x9421e441,0xa25eec6d)}},
+   {{LL(0x4d0720f9,0x409c3e03),LL(0xa3fc00ab,0x2777da66),LL(0xf56bf0e9,0x632d1928),LL(0x81c7680a,0x74b619cc)}, {LL(0xc9fd4d6d,0x3a4558d8),LL(0x1ecbe0c8,0x0abfbe48),LL(0x2838cd39,0x5797e18f),LL(0xb906544e,0xcb1460b3)}},
+   {{LL(0xde3d03f3,0x0ad70da7),LL(0xbc08d266,0xd5228cd8),LL(0xe2127739,0x20a51d4b),LL(0x32415191,0x707f915d)}, {LL(0x272d51c6,0xa5f7a323),LL(0x5064ac44,0xf59cd866),LL(0x30a4f6c7,0x61d25464),LL(0xe53a2628,0x8e771272)}},
+   {{LL(0xcfaa2596,0xa0cc22a7),LL(0x7f71cb29,0xcacf1bf2),LL(0x878247dc,0xc49231b7),LL(0x3ddf4b91,0x59ffa3e0)}, {LL(0xc04cf9ea,0xb7f67ac3),LL(0x014fe759,0x6f2f8586),LL(0x80aeb984,0x1247ab7a),LL(0x711df025,0xcf0b0606)}},
+   {{LL(0x4c384510,0x4953b9e4),LL(0x2ff4c127,0x79f79f6a),LL(0xa5952a92,0x65d70a6c),LL(0x2d444f40,0xaf294f32)}, {LL(0xb02dd069,0x176d29e0),LL(0x5c58bafb,0x8d32cd7a),LL(0xe8c9bee5,0x73975397),LL(0x858552b6,0x3c349573)}},
+   {{LL(0x70a7674b,0x370e5aaa),LL(0xa8a20c27,0x772754ba),LL(0xcd7d1d70,0x44694b35),LL(0xe3c73f00,0x10a220aa)}, {LL(0x488b2276,0xd9f89b47),LL(0x0191e1ef,0x4fba4973),LL(0x1d1d3b1e,0x137e7a4d),LL(0xfaf30f65,0x027f787b)}},
+   {{LL(0x8e8a4752,0x17c0461e),LL(0xd3bb4e8e,0x61b2514b),LL(0x027b825a,0xffb211a0),LL(0xd04f4da7,0x7233b0a2)}, {LL(0x5d790a25,0x5a916ae0),LL(0x66164ce8,0x6ae299b0),LL(0x9253f696,0x38d3eb33),LL(0x0c8ff333,0x36749936)}},
+},
+/* digit=30 base_pwr=2^210 */
+{
+   {{LL(0x80cdc998,0xdc325eb7),LL(0x451072d2,0xeaeb3ea4),LL(0x63f4814e,0xfbe4a77a),LL(0x5cf7300b,0xaf719653)}, {LL(0xaf79157b,0xa5961c0c),LL(0xc1b1eff8,0xd6bd64fa),LL(0x209c1192,0xd53c7278),LL(0x11867896,0xd49a6edf)}},
+   {{LL(0x53b69982,0x1ba0afe6),LL(0x54894dcc,0x457c5a61),LL(0xc615ab9c,0xe9c42a0a),LL(0x38499dbf,0x22d4f201)}, {LL(0x58d094a6,0xb1ec2a6d),LL(0x866be1ba,0x25d12924),LL(0xa5513025,0x1417e1e6),LL(0xab039206,0x46a7be0e)}},
+   {{LL(0xab8f5570,0x702df5a9),LL(0xc4b1ef0b,0x8465e1b6),LL(0xc3f6ddef,0x2824394d),LL(0xf9af33e5,0x8d94a8af)}, {LL(0x3598996c,0xc80d4436),LL(0x03e27975,0x19843a6e),LL(0x8976fb0c,0xf3b68ae9),LL(0xf594fced,0x4baabfbe)}},
+   {{LL(0x11f87843,0xe70ccf99),LL(0xbf750a24,0xaa750516),LL(0x31a6eefb,0x7718717c),LL(0x4f1b3cf2,0x349467e6)}, {LL(0x13e06789,0x7e8543cc),LL(0xa7d9be3c,0x96a8b796),LL(0x9733549a,0x094ce7cf),LL(0xfe62445e,0x1d488ec1)}},
+   {{LL(0xdb5f2680,0x5e774509),LL(0x94c14b10,0x3bd21da3),LL(0x32bd63c9,0x72b49b44),LL(0x178414da,0xf420c1a3)}, {LL(0x1668b9e2,0xcc2d52bd),LL(0xeae81242,0x53293fa4),LL(0x6f2165ba,0x25da0381),LL(0xa05d275f,0x20d877c0)}},
+   {{LL(0xb492ea77,0xa9747923),LL(0xbe6adbb5,0x6e43f55d),LL(0xd04c50fc,0x47238bd2),LL(0x05274034,0x815b9906)}, {LL(0x583e24e1,0xbfe63e3a),LL(0x02b34de8,0x09a6e9e1),LL(0xef23522a,0xa67b6f20),LL(0xdf79bc11,0x1cbe2314)}},
+   {{LL(0xcf12ff20,0x5dad995e),LL(0x3cd20a95,0x219b1c14),LL(0x2ff2f4a4,0x90f3022c),LL(0x6c06b717,0x4fc4df0b)}, {LL(0x8620dd16,0xaab7e518),LL(0xda0e5568,0x0b84b91c),LL(0xd3892316,0x47e5f136),LL(0xade1cb59,0x3085b0f3)}},
+   {{LL(0x48f7b419,0xd0f1da3b),LL(0x1ab412f4,0xe49b7486),LL(0xb18ada64,0x2b86b881),LL(0x33a6e0cf,0x83b6cf6d)}, {LL(0xb21355f1,0x3a954c94),LL(0xe49a6dd9,0x6fc89f6c),LL(0xc059f9ef,0xbac706ff),LL(0xae2685a0,0x23b21e1b)}},
+   {{LL(0x6d022d4a,0xc5ab3825),LL(0xa0ecc567,0x74093b16),LL(0x2abd9be8,0x3dc28b8b),LL(0xb1c505da,0xec16d9a4)}, {LL(0xbdd32fd2,0xaf90003d),LL(0x9c865764,0xcf60567c),LL(0x1ac07ee1,0x2d7aba98),LL(0xc043f883,0xe743b7e3)}},
+   {{LL(0xe09f1cb5,0x5b2205b0),LL(0x2de6c01f,0x61d16b0b),LL(0xceb03ba0,0x5cd2251b),LL(0xe69c7fdf,0xaecceaa8)}, {LL(0x6f6c743d,0x06a74010),LL(0xfb06c2f6,0xdd6f9396),LL(0xdbc24e26,0x281bf209),LL(0x542a22ac,0x30727475)}},
+   {{LL(0x362ad50b,0x031cb47b),LL(0x49176ef3,0x76498aed),LL(0x7bce256b,0x34efbeb7),LL(0x495a1bf4,0xc1e699cc)}, {LL(0xb2ce0814,0x3b3145d0),LL(0x23a72021,0x697da9bf),LL(0x38f9734c,0x1c41ef07),LL(0xdbc79075,0x7ce22ed7)}},
+   {{LL(0x21a372f5,0x3d9da6d9),LL(0x64d7385d,0x6f1ae40b),LL(0x08a21016,0x7cda6a92),LL(0xfba7e2ed,0x2f70ed61)}, {LL(0x92f2ed9a,0x7e004451),LL(0xe155958a,0x5eabaf90),LL(0x7dc71ee2,0xb2ccd9f2),LL(0x619586ab,0x5b451f60)}},
+   {{LL(0x5009f1bb,0x063d4c36),LL(0x061052ac,0x43e60edb),LL(0xaec77de3,0x4c919093),LL(0xdeb01a6e,0x18d45e98)}, {LL(0xc237cb96,0x12dcb455),LL(0x7e5ecb32,0xebb1bc83),LL(0xb26d22b4,0xd7b215cd),LL(0x7317de40,0x444dd4bf)}},
+   {{LL(0x2462b04f,0x615d0240),LL(0x1129b663,0x42838b96),LL(0xb8d018b5,0x885d8416),LL(0x443bf150,0x7b41c195)}, {LL(0x240b55f9,0xf56a3e74),LL(0xdfe6ef4a,0xbe5746a1),LL(0xa8184d57,0x8804a2d6),LL(0xf2bbb3cc,0x4d5b40e4)}},
+   {{LL(0xa1175405,0x05e49964),LL(0xb6048479,0x639da398),LL(0x7d7f6fc9,0x8a97ce53),LL(0x9d2de749,0xa6d08585)}, {LL(0xc83c3ca5,0xf4502fa9),LL(0x272692ba,0x80e9d34b),LL(0x6847e384,0x503ba60e),LL(0x236cf53e,0x5ea54ed6)}},
+   {{LL(0x7b8ff683,0xb23f24e4),LL(0x8427bfe0,0x04c77af9),LL(0x3a5735c6,0x478310bc),LL(0xeb1d4e91,0x7779bd08)}, {LL(0x84d65c69,0x549b94f4),LL(0x214867a7,0x061b9beb),LL(0x6b043b58,0xbfdbf8ae),LL(0xcf6e237c,0x43a4a64d)}},
+   {{LL(0xe9189e8a,0x7d721a71),LL(0xf3f69ec2,0x7979776b),LL(0xd4286ded,0x8800a4c1),LL(0x7c8d89d4,0xe71ff3e8)}, {LL(0xf11da2f7,0x2215b363),LL(0xc6b5cc88,0x2b31b90e),LL(0x90cd9d4b,0x8670711c),LL(0xcaff7330,0xf3f9f486)}},
+   {{LL(0xd84eaa53,0x71360b3b),LL(0xb09a669c,0x721e4618),LL(0x8cdd491a,0xaa8cd53f),LL(0xcb945a6b,0xa0b016fa)}, {LL(0x7e564447,0x1a5d5182),LL(0x999678bc,0xb50e7345),LL(0x396cebe9,0x01501dbf),LL(0xb3ee0e13,0x1ec925b9)}},
+   {{LL(0x09315492,0x253ed150),LL(0x9d099bd0,0x6d5f0d32),LL(0x5fec6081,0xc979ef86),LL(0xf92fa2c8,0x9ef7bd88)}, {LL(0x21a7e802,0xc4f127ae),LL(0x30fe9599,0xe1190118),LL(0xaf5c0c1e,0xc7727acd),LL(0x8a734759,0xbd2ea388)}},
+   {{LL(0x9441342b,0x040ff080),LL(0xedff16ff,0x2f0905c1),LL(0x3cc77b3e,0xb58b665b),LL(0xe03f98e8,0x332f2dae)}, {LL(0x78f9bb87,0xf6533e48),LL(0x37255bba,0xb4ea4758),LL(0xe594b600,0xd8360086),LL(0x808b7682,0x5b4c0c9c)}},
+   {{LL(0x07e34c9d,0x9ab29ad6),LL(0x37e15a32,0x5e45e94c),LL(0xe436b8ce,0x2b63da06),LL(0x4b845bd9,0x8dd93735)}, {LL(0xa4f1fd37,0xadf9ce47),LL(0x5a926be6,0xbe2b0843),LL(0x896a0e81,0x54e97009),LL(0x0add1b2f,0x06fa991a)}},
+   {{LL(0x340c4ef7,0xd264b27f),LL(0xbd6e1c10,0xd8928a72),LL(0xfa19fd2c,0x3116810a),LL(0xbcc942b6,0x81d07fa9)}, {LL(0x1888d381,0xd02ced95),LL(0xb72ddae5,0xe554f461),LL(0x87789bd5,0x7e0a0478),LL(0x0c890258,0xfd48c9a2)}},
+   {{LL(0x8ec1e909,0x62dd03a4),LL(0x14084578,0x7e16f498),LL(0xf80356fa,0x895777f8),LL(0x85299026,0x4daff32d)}, {LL(0x8ba547ca,0xc17e6df2),LL(0x038de094,0xc885aa8b),LL(0xb715dae2,0x244a6756),LL(0xd84d1340,0x0fa31722)}},
+   {{LL(0xf4b0761c,0x5eee3ca4),LL(0x49c05683,0x90622c9b),LL(0x7b96cab1,0x1d767ea5),LL(0xb0283e92,0x29c2c08f)}, {LL(0x3c2764c5,0x496d6260),LL(0xc11ee301,0x3d1f37e2),LL(0xeb3f2c9c,0x9b1f652d),LL(0x6c171bec,0xbba69097)}},
+   {{LL(0x87059fa8,0x3051cbe7),LL(0xd34499c5,0xa2d043f8),LL(0x1fb740cd,0x34431d14),LL(0xffe32d27,0x7828f8ec)}, {LL(0x613b329a,0xffeea95a),LL(0x85a1711b,0xa3bafec3),LL(0x26d17299,0x3527c435),LL(0x12d76d5e,0xd52037b4)}},
+   {{LL(0x5f7f27a7,0xdcdaaae9),LL(0x4cf9a4c6,0x93b7670d),LL(0x808b6209,0x0f7f8f34),LL(0xd276b68e,0x95071418)}, {LL(0xd980e9e6,0x4222c57d),LL(0xd98ad596,0x5f49edf6),LL(0xb9188288,0xfefdfd1b),LL(0x8cdd5be1,0x4340be00)}},
+   {{LL(0x6e1a2133,0x36187b58),LL(0xb81d026e,0xc2a0b8bf),LL(0x164fa62d,0x0aaa95ad),LL(0xbca633e0,0x06449d7d)}, {LL(0xc2ea71e5,0x8aa8c573),LL(0x0b3e113a,0x0abf37c5),LL(0xbc9b1b1a,0xe3a8c47e),LL(0x371ebf26,0x39a91f2b)}},
+   {{LL(0xee5f9472,0x93045d9e),LL(0xfd721f98,0x34b36e9d),LL(0x9dc0f7ec,0x51ea1d87),LL(0x0c11edda,0x6bd8f977)}, {LL(0x94c4b895,0xfe8c621c),LL(0xd53b731e,0x0eb93181),LL(0x10d82811,0x378fa7d4),LL(0x8e39bcb2,0x6e82fdb2)}},
+   {{LL(0x8225f3b3,0x8eefbbdc),LL(0x4aa48c64,0xed42d6bb),LL(0x845b95a0,0xc2025c88),LL(0x33ab3325,0x505f80d5)}, {LL(0xd673fc83,0x673e8935),LL(0x97e7f0f7,0x2c0ed148),LL(0x5acd0ad3,0xfe43e830),LL(0x26b99f5f,0xfbd8507e)}},
+   {{LL(0xc6608e45,0x76a46e76),LL(0xe86be8fa,0x009e532a),LL(0x0e36d265,0xe41a870e),LL(0xcf7cce22,0xb5416dc5)}, {LL(0x0496237d,0xe3a7ff52),LL(0x954c3494,0x97a48d26),LL(0xd3d4075f,0xf1ed17cb),LL(0x975caf06,0x0c0257f9)}},
+   {{LL(0x1b616e6a,0xa33e7115),LL(0xb3ae45e3,0xcf9d848c),LL(0xf4cfac7f,0xcaf518b9),LL(0x4d40cf27,0x9becff33)}, {LL(0x2dbd58ca,0xc4e5058c),LL(0x3c23a7a9,0x05041895),LL(0xa308ce6d,0xee357d2f),LL(0x35a2a495,0x85a23f64)}},
+   {{LL(0xec5dd4f1,0xe18c97fe),LL(0x728cdf90,0xe7db08e9),LL(0x313b1e13,0x49e3bdd1),LL(0x3339d502,0x1bd41528)}, {LL(0xb1e8de3a,0x7da926de),LL(0x05d4cd42,0x9e0e414d),LL(0x5828d725,0x17104089),LL(0xdcee4df2,0xa81d3b0a)}},
+   {{LL(0x5380a1fd,0xf371df9f),LL(0x01e8f1bd,0xf53ccf62),LL(0xfb9c9458,0x3a8fda7f),LL(0x281886f7,0xd2580682)}, {LL(0xe353d170,0xd82c6a16),LL(0xac6fcdac,0x93d4228e),LL(0xa2696ce7,0xda15bc75),LL(0x93062091,0x08d4b1f9)}},
+   {{LL(0x0137e74f,0x6b0a9f13),LL(0x89b4ae8e,0x886e975c),LL(0x7cc37225,0xd87fa21d),LL(0x75146cb5,0x902378b0)}, {LL(0x2ac37123,0x1626eaca),LL(0x54386b1f,0x7702f84d),LL(0x40b68a72,0x16ea26be),LL(0x591b8f61,0x77dbc13a)}},
+   {{LL(0x64d45c14,0x5bc6decb),LL(0x5e9dfc40,0xe86065ad),LL(0xd334271c,0x1f7b8cbc),LL(0x1609c0c1,0xe7885ece)}, {LL(0x2b53c51e,0xeb91c45b),LL(0xa5b781a7,0x45eac26a),LL(0x8f53c5c3,0x26a30ba9),LL(0xcfc5b52d,0x5f5d3f5d)}},
+   {{LL(0xa84e7e79,0xd0a089e1),LL(0xf6e18472,0x8517a795),LL(0xec5f50ea,0x82d3426f),LL(0x8c71adca,0xc17db8ad)}, {LL(0xb6487626,0x2cf7de22),LL(0x3893a44a,0x16dbf2cc),LL(0xb910e48c,0xebfbfe16),LL(0xa1a848ed,0xbae37636)}},
+   {{LL(0xa23b5072,0x620cc557),LL(0xe02ebcd5,0x102c21fb),LL(0x01cc7197,0xcc36ce43),LL(0x041f93ff,0xcd7784ae)}, {LL(0xfdbd408f,0x5d590673),LL(0xa9736949,0x3ac415e0),LL(0xe93a376a,0x3a606234),LL(0x639106da,0x3963f8bd)}},
+   {{LL(0x2eca64aa,0xb9371a1e),LL(0xf6a37708,0x55d8acc0),LL(0x700ca1c2,0x6427ae9d),LL(0xcaedcc49,0xa546e891)}, {LL(0x1dc5d243,0x360bb871),LL(0x04515b2b,0x9b976dca),LL(0x36c9a271,0x93039555),LL(0x9282cf88,0xab5759e2)}},
+   {{LL(0x18e48026,0xa13e8076),LL(0xd6f717ec,0x0176b82e),LL(0xcb3f99d5,0x674d52b2),LL(0xa9843239,0xe31dcdbb)}, {LL(0xeeda05b6,0x416f1d1f),LL(0x14a73582,0x240e6567),LL(0xe795230d,0x9536e3d1),LL(0x6f7ab036,0x76cb7afd)}},
+   {{LL(0x8cecabda,0x484d5922),LL(0x73e60445,0x9bdbb41f),LL(0xfd7b16ee,0xf0462726),LL(0xe8d105fa,0xce7c19c8)}, {LL(0x761a976c,0xa23ea861),LL(0x46ca5a54,0x4fe4957e),LL(0x66cfe860,0x9d9ff39b),LL(0x8c790570,0xf17dc160)}},
+   {{LL(0x535746cb,0x3b2b4cd4),LL(0xf1bbd38d,0xce36b0cd),LL(0xa543c0cf,0x3c130636),LL(0x177105a2,0xbb034ceb)}, {LL(0x26225300,0xcf15bb54),LL(0xcfa6adc7,0x24955ce1),LL(0x10fd7013,0x2629f627),LL(0xa50a31cc,0xc24723bc)}},
+   {{LL(0x4fcf572d,0x05eeecab),LL(0xa4658714,0x415a9ca3),LL(0x301e2ccd,0x4e3b4c4b),LL(0xe33adc08,0x70fac5aa)}, {LL(0x5b6be6d9,0x0601d00a),LL(0x5af3b88b,0x63447696),LL(0x0c24c33a,0x1d657715),LL(0xdf4def76,0x2d445d8e)}},
+   {{LL(0x3a80a6f2,0x581c8d1f),LL(0x373ef7b6,0x036e6c59),LL(0xb9a27c2a,0x789c58c9),LL(0xb8e6dbb5,0x5c11218e)}, {LL(0x959f9976,0xdebf9e67),LL(0x67a8de27,0xb03f6305),LL(0x5514e8f4,0x637cc7a9),LL(0xb468d2a1,0x4c0b4786)}},
+   {{LL(0xc6f8cabc,0xb7513ebf),LL(0xa408108a,0x04606528),LL(0x0dddb33a,0xa692835f),LL(0x1edf7940,0x2542be99)}, {LL(0x4fe8b0e0,0x7710728d),LL(0x6f906286,0x596f1bd8),LL(0x49332bf2,0x2c349d27),LL(0x691d2287,0x88776630)}},
+   {{LL(0x1a7423c8,0xd01bf1ce),LL(0xd8036566,0xe8bec28a),LL(0xd1b5d9e2,0x16fc87bb),LL(0xc6da902a,0xfd294be5)}, {LL(0x919ae171,0xfa89e247),LL(0x26635aad,0x928b6e3f),LL(0x3735ac7e,0x0ee29e91),LL(0x788935e9,0x02e944c2)}},
+   {{LL(0xeeff55fc,0xd90b8c82),LL(0x2f91a1fe,0x08367319),LL(0xdc2f7e5a,0x2c5dc61a),LL(0xb2390047,0xb832a444)}, {LL(0x2c553a4e,0x4ce89fee),LL(0xad45098f,0x12a27895),LL(0xe43b0f71,0x1ff82aaf),LL(0xf1e7d8a9,0x1a7cb977)}},
+   {{LL(0xb0f9a471,0x308d3dd9),LL(0x63667d67,0x1ac7bb13),LL(0x983bd3ab,0xe1006212),LL(0xa1ee0c40,0xe85cf622)}, {LL(0x17762982,0x2fca619f),LL(0x9005d505,0x718d3341),LL(0xfcd7e352,0x10723067),LL(0xecd66987,0x9106b398)}},
+   {{LL(0x6caed476,0x56316cdc),LL(0xa2b81e98,0xab580067),LL(0xcfbade9b,0x6ed0d1ce),LL(0xee035b72,0x437b4a26)}, {LL(0x68e4bcf2,0x3e5ec22c),LL(0xef47783d,0x450c8cbc),LL(0x9f191485,0x44bbb111),LL(0x4cc6740b,0x9739f773)}},
+   {{LL(0x46916cfe,0x0b317ff7),LL(0x688ec7a3,0x87f27d15),LL(0x41f9a761,0x47a4d9dc),LL(0x2178b281,0xa5312e5a)}, {LL(0x0aecfb7a,0xcad2b7a2),LL(0x36fc0fd8,0xbdfa00f5),LL(0x1af75d63,0xf591022f),LL(0xac25958c,0x6a49667d)}},
+   {{LL(0xfbf78a7f,0x0b041ee6),LL(0xca381097,0xd9de2c1c),LL(0x7574d9be,0x05fd5c5b),LL(0xb6d11cfc,0xa6528df8)}, {LL(0xf3a4ca29,0x5ce0c155),LL(0xf437e5b4,0x2938ccfe),LL(0xa1ed44aa,0x9d8d7a57),LL(0x85d8741b,0xd71debeb)}},
+   {{LL(0x13df982d,0x7bde3729),LL(0xb4cf3148,0xa8d9c745),LL(0xcba275c5,0x23921a5b),LL(0x275b9672,0x0363aae3)}, {LL(0xcf92ad8d,0x0b4a262f),LL(0xbf743a42,0x72774696),LL(0x6023bbe6,0x11cd45cf),LL(0x20c56119,0x429ccf34)}},
+   {{LL(0xd7475c78,0x7c91b8f0),LL(0xb9354bca,0xe50da5d4),LL(0x69c8feba,0x5d5d1ea4),LL(0xc7b7f865,0x2317c0a2)}, {LL(0x03d9baf5,0x94d00f1e),LL(0xb56ac4c6,0xd3b67465),LL(0x87de998f,0x9446625f),LL(0xe1f64a2d,0x3856dc73)}},
+   {{LL(0xf78276ac,0x5f373637),LL(0xc6cf775a,0x605ba933),LL(0x6d566239,0x054d79f8),LL(0xef7d6f74,0xb849ad78)}, {LL(0x4eca8583,0x98211c0c),LL(0xcfbd79b5,0x1ab4e538),LL(0xdea4ddaa,0x31b33e6a),LL(0x4cd5d7aa,0xf2ded24a)}},
+   {{LL(0xfc946020,0x58a268f9),LL(0x80dc7398,0xdbb52ca4),LL(0xe7cbe477,0x8775976b),LL(0xc0533996,0x28ed33ec)}, {LL(0xab4291d0,0x18872b4b),LL(0xffd2b019,0x85cbe15c),LL(0x22a8d093,0x79eaadf5),LL(0x30233f5a,0x90de0633)}},
+   {{LL(0x918b70cd,0xc14dcb02),LL(0x0de211b0,0x4b51b7a2),LL(0x0eb62019,0x0ab448a6),LL(0x5ea90b98,0x3eced1b5)}, {LL(0x6c2076c1,0x07bd4a18),LL(0x2b589ad3,0x47f32041),LL(0x3e712ad0,0x118fbfb8),LL(0xb1c32d0a,0xe5b325f6)}},
+   {{LL(0x4bc91ded,0x9bdf4633),LL(0x09576539,0x772e030c),LL(0x4cbc303c,0x7a86797a),LL(0x75bcd9ac,0xd67b4700)}, {LL(0xe75c067b,0xbac8a0cb),LL(0x4648496f,0xe9d8b1b4),LL(0x03cab28e,0x1223ec7d),LL(0xde7adaea,0x02724154)}},
+   {{LL(0x6d4bf31c,0x409ccac4),LL(0x0063551f,0x1b94f674),LL(0x3b0901d9,0xf226b69c),LL(0x481ff255,0x7df3479b)}, {LL(0xd3a3d92b,0x1d14732d),LL(0xd0c3c874,0xeebfc9a9),LL(0x63a0fea3,0xbc437feb),LL(0x19cbbf7e,0xe7b54a3f)}},
+   {{LL(0x2f1018ee,0xdf848524),LL(0x4b05bbeb,0x51d6101f),LL(0x98bfb1e0,0x9fd89832),LL(0x80624593,0xbed00651)}, {LL(0x81c4c6c5,0xc3debb59),LL(0xe5a80dec,0x4852b97d),LL(0x5185263e,0x016e1e33),LL(0xa58a64e9,0x312bdfc2)}},
+   {{LL(0xfb6fc10f,0x15c0b9db),LL(0x53a60a83,0xdf7da617),LL(0x9316b783,0x5b2cf831),LL(0x31d430d6,0x80685bb8)}, {LL(0x00a1fe67,0x4cdf95eb),LL(0x86f00e90,0xe57bac33),LL(0x60df2d50,0xf2bc80f5),LL(0xe536b981,0xe9f1cb36)}},
+   {{LL(0x164db1ad,0x61461106),LL(0x35b8fff6,0xbe997006),LL(0x206afe91,0x50f52bc4),LL(0xdb6dbf1c,0x5091b009)}, {LL(0x0c5e1362,0x478880e4),LL(0x5e01291a,0x534134db),LL(0x375ea421,0x6dbf0a65),LL(0x4e7b933d,0xa9ccdb5a)}},
+   {{LL(0xe7edccde,0xc6ded9a8),LL(0x663f5ff5,0xe8a000e0),LL(0xbf5ad009,0xdca77977),LL(0x9c08321c,0x9272cdbc)}, {LL(0xe96c7124,0xa47276fe),LL(0xdaebbb3c,0x9df802a2),LL(0x72ab0e97,0xac2687f0),LL(0xb2fc44ce,0x9de38f9b)}},
+   {{LL(0xf2a8d795,0xe7218ed3),LL(0x216d39ef,0x88d12556),LL(0xb0c34966,0x8721d56e),LL(0x8c6fc70d,0xf8fc685d)}, {LL(0xb34df873,0x223297b5),LL(0x3aedc31b,0xb925eddc),LL(0x148f7b40,0xd590f536),LL(0x250edd04,0xa293cb99)}},
+   {{LL(0x642203ed,0x81059ed4),LL(0x5d573546,0x84a6a8aa),LL(0x06368938,0x08ae9cbd),LL(0x8aadc565,0xc72edf75)}, {LL(0x24e76c88,0x07176f84),LL(0xe80a0c15,0x40c90ef6),LL(0x1b7f38f3,0xf6261ec5),LL(0x1787b4fc,0x573fb3b4)}},
+   {{LL(0x3d8f7f76,0xb96cf87d),LL(0x568545e9,0x24e222eb),LL(0x43b7b477,0x4ef1b7f7),LL(0x7e760cdc,0x950cf5ef)}, {LL(0x77589cae,0x712b377a),LL(0x6c0055fd,0x574113a9),LL(0x63eec85a,0xb5f5aae0),LL(0x879e8025,0x7dcabe71)}},
+},
+/* digit=31 base_pwr=2^217 */
+{
+   {{LL(0x53e5b6ee,0x44c0d484),LL(0x30b7b45e,0x6bb8f04b),LL(0x28e9ea10,0x1e86f74d),LL(0x34d18744,0xc3c4b5c3)}, {LL(0x21b9b77d,0xbf544b3b),LL(0x3d1fe201,0x2fc9c924),LL(0x06f9e225,0xf579e7ec),LL(0x594d6567,0xb315d26f)}},
+   {{LL(0x0bd15805,0x58eff116),LL(0x875e499f,0x68297f87),LL(0x5ea5a87b,0xd35eae63),LL(0x12c4e5ab,0x0a971eba)}, {LL(0xe74578d6,0x42881be9),LL(0x4f2f393b,0xebc94b22),LL(0x970992eb,0x2c050b87),LL(0xd76aeab3,0x8d161987)}},
+   {{LL(0xf5aa086b,0xf70303cd),LL(0xeace7f47,0xd08a96b9),LL(0xa3d9fbe8,0xc2d80ba5),LL(0xdd0d65ab,0x92ae00b4)}, {LL(0x92720eb7,0x47343b4e),LL(0xb11bb102,0x7d02d6cb),LL(0xdff8e215,0x108463df),LL(0x34932c5e,0x337ed8ee)}},
+   {{LL(0x38c91c7b,0x9019c6cc),LL(0xa8b7191b,0x53a4b37e),LL(0x7cda3696,0x32def013),LL(0x0b1b1951,0xff7560d8)}, {LL(0x2fca0e94,0xda881267),LL(0xf3de6f3a,0x4fa496b7),LL(0x7df69264,0x55d3bb73),LL(0xac528da8,0x13a3375c)}},
+   {{LL(0x093254e4,0x77d8b8fa),LL(0xc72589e3,0xb7e15f0d),LL(0x44e0f1bd,0x015f37c4),LL(0x7995b9bf,0x2a76ab0a)}, {LL(0x7234a6e9,0xa40df932),LL(0x48131689,0x3b833076),LL(0x5d6086ec,0xb6bffdd9),LL(0x686ec539,0xe41a22c2)}},
+   {{LL(0x0af4e9a2,0x6cc6dde1),LL(0x21f8c9d4,0xddba1723),LL(0x442d8a6d,0x00a3a943),LL(0x232cb20f,0x6bed88aa)}, {LL(0x8a71a6f5,0xe9721260),LL(0x205ba144,0x8cd12061),LL(0xd3f2f387,0xf80e0a91),LL(0xc3af4314,0xec89f182)}},
+   {{LL(0xeee198ca,0xfc76277d),LL(0xc7460487,0xb8a8fcc5),LL(0x4e492c16,0x4a22c9ce),LL(0x1a4b790d,0x4c8d90e8)}, {LL(0xc67a35fb,0xc5fc4986),LL(0xff6cb4af,0x2c25684a),LL(0x782bcc19,0x4ed8e8e0),LL(0x01a81cd7,0x5929b9bd)}},
+   {{LL(0x362c4aee,0xfdba1119),LL(0xd149e823,0x9475450f),LL(0x61e240df,0x03086510),LL(0xb2797e52,0xac4c0d91)}, {LL(0x94e2e738,0x07a9f04e),LL(0x93dfaa57,0xc9f25009),LL(0x631bf262,0xe28d8a1e),LL(0xb6c3c6a3,0x3a5e0c8d)}},
+   {{LL(0xae45fabf,0x01589390),LL(0x1409ad54,0x463e763e),LL(0xf475ebad,0x2f646c86),LL(0xd3156a19,0xc59f2fe9)}, {LL(0x70713ee6,0x04278242),LL(0x4b1db138,0x648f4274),LL(0xab041377,0x9e8ee82f),LL(0x7382f8be,0x22cb83f8)}},
+   {{LL(0x45d8b0ba,0x00203bde),LL(0x449f6a1f,0x11b2f690),LL(0x6f74f293,0x2c7c2de4),LL(0x66e72466,0x17b643d4)}, {LL(0x5c6c0160,0xe11d64be),LL(0xaa5059ab,0x07290c5d),LL(0x97daeb3f,0x6542c00a),LL(0x3b52f2d0,0x32035053)}},
+   {{LL(0x662b0116,0x129a163d),LL(0xef4e03d2,0x69c20d78),LL(0x1b8c4c47,0x0bfb8719),LL(0xcb905d4c,0xe30a6e7f)}, {LL(0x2999a4e7,0x4c1f1674),LL(0xad1da706,0x4aed0900),LL(0x18de0472,0x05a38a3f),LL(0x2d7633ab,0x31f41bd8)}},
+   {{LL(0x2f8883e5,0x1b8ecbd2),LL(0x3a64153e,0x99728060),LL(0x58c55e86,0xcfeeaefa),LL(0xc328ee2f,0x7d432254)}, {LL(0x89178540,0xde7dbdba),LL(0xc26595af,0xde8566c2),LL(0x0e935c9e,0x1f13be1a),LL(0x908f2eea,0x95111f23)}},
+   {{LL(0x8ac82d6d,0x6a09759c),LL(0x2af6853a,0xc40e05be),LL(0x9ebb7992,0xb2ada630),LL(0xe97341a0,0x49a066b5)}, {LL(0xd9a721b8,0xadb7051a),LL(0x830efbe9,0xa466738d),LL(0xb3d63909,0x059da0ce),LL(0x174ba475,0x1656371c)}},
+   {{LL(0x1c88a562,0xfdd7948f),LL(0xfd9cf776,0xcaabdc55),LL(0xae13fd6a,0x8d762316),LL(0xd8375e9c,0x660b92e0)}, {LL(0x76c3f200,0xf2995b0b),LL(0x05719dc0,0xf567190c),LL(0xb12864a7,0x7d36ce50),LL(0x54735d1e,0x30258374)}},
+   {{LL(0xabc3be1f,0x710ce4f1),LL(0x72790b98,0x60f62a23),LL(0x70cb9330,0x65fab2e1),LL(0x88055c5b,0x79d44d45)}, {LL(0xe3124844,0x41bb384a),LL(0x16d961c2,0x14b14f40),LL(0x21490b02,0xde1abdd8),LL(0x37e062f9,0xb389c479)}},
+   {{LL(0x89e9fd58,0x995172ec),LL(0xd4b6b6bc,0xdcaadeb5),LL(0x58f8274e,0x194b5bbc),LL(0xdd36196f,0x27bc618b)}, {LL(0x91f96509,0x2bf616d0),LL(0x10369df1,0x042750f1),LL(0xcc6235cb,0x2deb4dd4),LL(0x1a87b1ec,0x2827be70)}},
+   {{LL(0x9c0bf12e,0x64b51fe0),LL(0xe31e0b4a,0x7207b82c),LL(0x8ffc7e20,0x1c83452e),LL(0xcfe17446,0xa576441e)}, {LL(0x5b761026,0x3c0d9f1c),LL(0x49fb5e4f,0x6ddb5b03),LL(0x49b76e83,0x9d06bcdb),LL(0xcaca1322,0xae6c1cd3)}},
+   {{LL(0x8d0c3145,0xa6302c44),LL(0xdb923523,0xdf2b2e00),LL(0xcbec4bb4,0x23c9b1ac),LL(0xb9404df6,0x00812c47)}, {LL(0x5a7ba08c,0xbc2402e4),LL(0xbe20a418,0x3747c00c),LL(0xd8852ba0,0xd9271e79),LL(0xd17dce99,0x23b0a034)}},
+   {{LL(0xff544ad7,0xe074cc46),LL(0xf539b80f,0xa20a564a),LL(0x160be860,0x8ac42d48),LL(0x321b73a8,0xee177537)}, {LL(0x54d66875,0x8abe55b2),LL(0x5afc229c,0xfbc7f36c),LL(0x0238495a,0x240e1a85),LL(0xa395833c,0xe3a3ce40)}},
+   {{LL(0xf728f780,0xf768ab15),LL(0x235e77a0,0xe51d7b01),LL(0x229d9893,0x62c9e93a),LL(0x181cc80f,0x4f977897)}, {LL(0x200b971a,0x8c511590),LL(0xfb426176,0x375d6bd9),LL(0x70c51868,0xc05778f2),LL(0xefa7e541,0x4c97170d)}},
+   {{LL(0x8b84263b,0xc9418082),LL(0x32d34971,0xbe6a7d14),LL(0x800e9440,0x13563381),LL(0x6f307185,0xa8216ca3)}, {LL(0xcdb72e79,0xdd328e86),LL(0x98c8ec5a,0x12270ca6),LL(0x4aa64725,0xdcdff9de),LL(0x711a3443,0x6c4e4857)}},
+   {{LL(0xfd4bc556,0x0b1a7f46),LL(0x91e333e3,0x47be9b69),LL(0x0bbda87b,0xa25416f6),LL(0xa6662e57,0xdd28bb9f)}, {LL(0x160d4c8d,0xbe3f1008),LL(0xc400e826,0x6b940d6f),LL(0x530eedcd,0x84444a9a),LL(0x98bb94b0,0x059f7fe2)}},
+   {{LL(0xf9a9206b,0x95812873),LL(0x84fd0604,0xb297afdd),LL(0xa07328a1,0xcc9b49e9),LL(0x6939c8d4,0xf398425b)}, {LL(0xf05e1647,0xf0983010),LL(0xecfd9a8a,0x44fd7e04),LL(0x048ea3ba,0xb6360e0c),LL(0x4d53e852,0xb3646297)}},
+   {{LL(0xbad34d69,0x1f89310d),LL(0x2d46c9a7,0x90164c59),LL(0x90bea726,0x9da649c2),LL(0x712b3c99,0xf9e3c93f)}, {LL(0x9595fcbd,0x56799720),LL(0x7ff73c8a,0x9df889af),LL(0x21d4b858,0xb84ab588),LL(0x75f8d5ed,0xc4d8d792)}},
+   {{LL(0xbaba0dd4,0x5bb2a0e3),LL(0x6361a1f6,0x92868101),LL(0x317a8d60,0x2a8a5037),LL(0x4e292ae3,0x94f6062a)}, {LL(0x2fac57bc,0x75997687),LL(0x94ca729f,0xb4974ec5),LL(0x457cf0bc,0x08573b42),LL(0xb5d2d7d2,0x29810942)}},
+   {{LL(0x0d6b71c4,0xde67f5f9),LL(0x96c9efe8,0xb3f0fc22),LL(0x1dd3ec47,0x5ccb725b),LL(0xa6c7d7c8,0xe46f74cf)}, {LL(0x1015077b,0xa83b2cbe),LL(0xc6f18e1f,0xf25f03d8),LL(0xdf7df1f9,0xf6085d4c),LL(0x7edd80e3,0x41cc10fa)}},
+   {{LL(0x184c848b,0x52baa943),LL(0x8440951a,0x34953670),LL(0x0a64ec56,0x80e35f10),LL(0xa76dfb17,0x983e6846)}, {LL(0x582a6f2f,0x1c36e2da),LL(0xbb4a5970,0x92646d9d),LL(0xba2787f1,0x104921ef),LL(0x82a7b5e8,0x9534285f)}},
+   {{LL(0x735609a3,0x2ec007e9),LL(0x101a63dd,0x9a8f7e1a),LL(0x67873b7b,0x5be18d1e),LL(0x120f1614,0x5aab1e54)}, {LL(0x0411611e,0x76746098),LL(0xc2d0ef25,0x594bc1d9),LL(0xf7a2f757,0x5e553bba),LL(0x27b30458,0xf4977b90)}},
+   {{LL(0x678eee93,0x15039b93),LL(0x6f7addf2,0x85c801b0),LL(0x789d510c,0x2486b980),LL(0xd22a229b,0xc9436c5a)}, {LL(0x73e51e60,0x8756a5d8),LL(0x5754e3b3,0x3f07b126),LL(0x58fe2115,0xb80cea06),LL(0x1cd8a387,0x6353bd22)}},
+   {{LL(0x33492484,0x20a789d2),LL(0xbb09a0a1,0xb9798030),LL(0xed12d370,0x33984709),LL(0xeb23b902,0x75de9eff)}, {LL(0x7c25fc2c,0xadac78f5),LL(0x1d0b5f8c,0x303fe207),LL(0x11476db0,0x27a5beef),LL(0x59bd70d9,0x31e83b05)}},
+   {{LL(0x9dadeac6,0x6bccfc43),LL(0x1c94f378,0x3f086ccb),LL(0x2aa8f08f,0x8a461f5b),LL(0xec9aba3b,0xe595e625)}, {LL(0x8986ed09,0x68c58a92),LL(0x447ef3da,0xa54367f5),LL(0x97b00026,0x54a4613d),LL(0xa29c5003,0x90c6ed7d)}},
+   {{LL(0x74d0d696,0xf3075967),LL(0xf93bccb7,0x4b5d7ec5),LL(0xc634df50,0xaffebff2),LL(0x9e4de7ec,0xf5f10676)}, {LL(0x39e65a52,0x0d7283b8),LL(0x340b7891,0x7cdeb6b7),LL(0x430f523a,0xc0f088fd),LL(0xe56c557e,0x230d7f4c)}},
+   {{LL(0x53b54ed9,0x5dddcf76),LL(0xde5f5c14,0x26ee5883),LL(0xdd8ea846,0x8508f250),LL(0xa8bb3368,0xfa76b584)}, {LL(0xda0ba39c,0xf21e7b3e),LL(0xb2362193,0xc86a3405),LL(0x6b703774,0x6b6a76ec),LL(0xf324cc3d,0x321ae16b)}},
+   {{LL(0x3bb40b53,0xffd1f522),LL(0xfa8f86a6,0x4c346c38),LL(0x8af3e0e0,0x3581b4ed),LL(0x47f9466c,0x414a64d6)}, {LL(0xc23a6d66,0xea4c8749),LL(0xf58bbee4,0x47725f11),LL(0x6e52a438,0x42b5fcbe),LL(0xd342aa5b,0xec53f1f9)}},
+   {{LL(0x34d2d189,0x3ba8934c),LL(0x4d32053e,0xee2db91f),LL(0x4917a8fc,0x22cfe17c),LL(0x9d2b8434,0xba960f32)}, {LL(0xcd127ab8,0x57b63730),LL(0xf2f9de97,0x9bc8edfc),LL(0xd3d681de,0x2d381835),LL(0x69aecca7,0x6c678ec1)}},
+   {{LL(0xaefa5e06,0xf1829bdf),LL(0x52667de8,0xf3653c05),LL(0x25502c2a,0x2c5aa70b),LL(0xa8d15ac2,0xcb7b1fdc)}, {LL(0x5cd46e56,0x907da825),LL(0x10f13bff,0x002e15c0),LL(0xb6668859,0x15f07ba5),LL(0x58d76538,0x9f570ebc)}},
+   {{LL(0x428a40b4,0xc9e73889),LL(0x91097ca7,0xba56290b),LL(0xb4b6e2c6,0x110d618c),LL(0x16d1ccc1,0x8b751b5c)}, {LL(0x236cf4e7,0xd6722fa0),LL(0x45690ce6,0x8825fdf2),LL(0x4c6aafbe,0x3136dc94),LL(0xffb201f9,0x90877062)}},
+   {{LL(0x6585e6bc,0x981f1194),LL(0x7c448e14,0x1ed8bcb5),LL(0x99240cde,0xd47c4e5c),LL(0x5a3dc11c,0x40a2c185)}, {LL(0x9b4a64a0,0xa48ba204),LL(0x05c5ffff,0x2a4b9726),LL(0x8a589860,0xde7917f2),LL(0xc903166d,0x817534d7)}},
+   {{LL(0x2904fb9c,0x705a32fa),LL(0x968cdc46,0x36fd5965),LL(0x02252db4,0x857616d1),LL(0xcecb5ede,0x97016763)}, {LL(0x732de054,0x419cea8a),LL(0x5ad5df4a,0x07024b5b),LL(0xe4926459,0xbb0d04ff),LL(0x5bb8ccfe,0xe13ccb02)}},
+   {{LL(0x172273dd,0x9eec2896),LL(0x970c1d17,0xd9884cba),LL(0x18301645,0xe5c167dc),LL(0x530e5772,0xe5dda586)}, {LL(0x2dd0f27b,0xdeeaf709),LL(0x41dfb251,0xc601f20a),LL(0x42217e9b,0x5f480c1d),LL(0xb337bfb1,0x0d75797d)}},
+   {{LL(0x6b09b7ba,0x57275fa5),LL(0x7ed39142,0xb2c06e02),LL(0x55b9ffc5,0xe4a5c153),LL(0xaf8cfd87,0x7fc8f8ba)}, {LL(0x52bb4875,0x2681b16f),LL(0xfa54f41e,0x109913f6),LL(0xc10efaf2,0x43a37dab),LL(0xc4db2b3e,0x2417e0f7)}},
+   {{LL(0x74b171f0,0x9ad49010),LL(0x0c286a6b,0xf93a2805),LL(0xd6505654,0xedb3ff5a),LL(0x56f044c3,0x917d1b62)}, {LL(0xae8fa028,0xecb37d56),LL(0xc8d09f75,0xb7393011),LL(0x24108bb2,0xbf4254de),LL(0x3da56bb4,0x2fbdf4ec)}},
+   {{LL(0xfcc90f61,0x43928b32),LL(0x185e0747,0x5711f0d6),LL(0xda66a848,0x02ae53eb),LL(0xb11bfea2,0x55356274)}, {LL(0xfb4350c1,0xc98220ab),LL(0xa88aff38,0x7327f2d8),LL(0x5337ebb4,0x4cc524f8),LL(0x08349c3b,0x26036273)}},
+   {{LL(0xe9f0b69f,0xf5dfd98c),LL(0x68ad67a6,0x659bbdab),LL(0xe8498c3e,0xff607092),LL(0x13c967af,0x58596538)}, {LL(0xcb1b7be7,0xd1137da6),LL(0x60a238f7,0xce99ea53),LL(0xce1e19c2,0x4e2bd42b),LL(0x54536688,0xd72c8380)}},
+   {{LL(0x10730a9a,0xca840f1d),LL(0x1ac7e8d0,0xf6728578),LL(0x5477c494,0xb612808e),LL(0x6ca5d6ac,0x0c1ca4a8)}, {LL(0xca32c44c,0x22ae5b85),LL(0xfd30b311,0xe9282bc1),LL(0xd83b4375,0x2a8da008),LL(0xfcb5e289,0x86641f5c)}},
+   {{LL(0x44e9b97b,0x41035fe1),LL(0x7960006b,0x73fcd3f5),LL(0xabadf5e0,0x00af6af7),LL(0xd6a51fd5,0xef092904)}, {LL(0x27d65074,0x71fc839c),LL(0x4e172032,0xb498bf86),LL(0x84f59a56,0x0dbe225c),LL(0x18876dd0,0x7483b3c2)}},
+   {{LL(0xf91b1357,0xcbc6b30f),LL(0x4f94143d,0xe62b95f1),LL(0x27844d1c,0x89a6d9a3),LL(0x08a93e2f,0xe4d58280)}, {LL(0xa4548cae,0xb6399a98),LL(0x581bf6ce,0x43cd7b37),LL(0x6fe894df,0xf422f901),LL(0x0df5d778,0x8a3136e3)}},
+   {{LL(0x6037a8ad,0xbd1f5116),LL(0xb87116ab,0xd9fc3a2a),LL(0xe7d895a1,0xa8453cff),LL(0xfddb9459,0x16cfa41c)}, {LL(0xb58e8ada,0x0ec95efe),LL(0xc5babbea,0x75ada3cb),LL(0x00c666ea,0xf5b7d0f7),LL(0x9f7d801b,0x76ae3164)}},
+   {{LL(0xba2cc911,0x91cb75bc),LL(0x265cc0bc,0xb0a2ff7e),LL(0x1db1e8b7,0x40348d2f),LL(0x32932412,0x3f25dea3)}, {LL(0x019f9ff0,0xdebf9ff8),LL(0x04983fa2,0x0e14f34a),LL(0x2871044f,0x4db63d8a),LL(0x49cf89f8,0x44a26abe)}},
+   {{LL(0x3b1486d3,0xd7f47ff7),LL(0x0df27804,0x8c5c5a2b),LL(0x36c98b65,0x90bf1e51),LL(0xe8122a80,0x840dafef)}, {LL(0xdb8c1c81,0x7aedd136),LL(0x0d318f69,0x6ee61b01),LL(0xbdd0df45,0x977ca7ff),LL(0x2e2a87c7,0xf022a488)}},
+   {{LL(0x1d1398b2,0x1b23be35),LL(0x9697b4f7,0x36942c4c),LL(0x95ccf028,0xc8bf163e),LL(0x4d14ef92,0xf0db5fbb)}, {LL(0x38bad57f,0x831f4fc2),LL(0x3a9cb8d7,0xe85f0e3b),LL(0x59eb0dd9,0x25f020c9),LL(0x1921b158,0x4ce4bb1a)}},
+   {{LL(0x6512acb8,0xd8935b15),LL(0x2fca09d2,0x5cce49c7),LL(0x0c4c3ca1,0xc337656e),LL(0xe2d879f1,0x23456e2c)}, {LL(0xb6d5f5da,0x37d6ae8f),LL(0x153744ea,0x7b9d45ed),LL(0x48c6b2fb,0xdf7a46ee),LL(0xf9a6febf,0x8b985c75)}},
+   {{LL(0x3b94604d,0xdf89cff5),LL(0x276a4dec,0xc42ac0b2),LL(0x8ec89c90,0xa3c01aaf),LL(0x29c9b8d2,0x85139f5f)}, {LL(0xf1ceac4f,0x131c7d1c),LL(0x815a3624,0x9bbffcb5),LL(0xc1b223c8,0x013b698f),LL(0xf406edb2,0xca83b9c5)}},
+   {{LL(0x09763085,0xcff3a9af),LL(0xb22a2d16,0x55425beb),LL(0x78513eb5,0x9e9bf762),LL(0xc8fc301d,0x51a7e6a3)}, {LL(0xc6fedddc,0xda8179b0),LL(0x97c1615f,0xb332a260),LL(0x98f9538d,0x474c193a),LL(0x1c2c2423,0x0797739b)}},
+   {{LL(0xeb4d4966,0x69578161),LL(0x9023f40a,0xe352d4fd),LL(0x0d7bfc3e,0xd997a77e),LL(0xab347e7c,0x88d576e2)}, {LL(0xee54d6bb,0xc7256b68),LL(0xd819e0d4,0x5e6052c1),LL(0xcb0ae74b,0x1f3d9077),LL(0x46cc559b,0x8a518fce)}},
+   {{LL(0xab76ef88,0xacb8abca),LL(0x0d715487,0x34ab9ab6),LL(0x9fad30d7,0x75d466b0),LL(0x70d43609,0x626eb0d4)}, {LL(0xca4f4152,0x5e7f91f7),LL(0x180b857b,0x0cd7bf19),LL(0x888784e5,0x1f02dd96),LL(0x179f78da,0xd814b697)}},
+   {{LL(0x262bdba4,0x859a17f5),LL(0xa0357a50,0x7904d1e7),LL(0x396e9b8e,0x32618d84),LL(0x58a6b6d3,0x89e436e7)}, {LL(0x65dd4f77,0x92f0b5fc),LL(0xc94daf4a,0xd6732624),LL(0x639f0f26,0x9baccd3f),LL(0x4ac7343c,0xa931549a)}},
+   {{LL(0xa382f7f8,0xca0a0c72),LL(0xa79db5cd,0x83f6f975),LL(0xe8480ce8,0x61a9e83f),LL(0x627230eb,0xd9bc2e5d)}, {LL(0x126d3593,0xb68ca25d),LL(0x5ba2eae4,0xb0a3ea37),LL(0x779369f6,0x46df27b5),LL(0xef5aca01,0xe373c06c)}},
+   {{LL(0xc7e6da22,0x16017031),LL(0xfa5e30cd,0x0ebf4e04),LL(0xc158287f,0xfbbc899f),LL(0x7aa34c4f,0x2500a059)}, {LL(0x3097f73b,0xa5ec0122),LL(0xebb69a3a,0xfa3414da),LL(0x1eb75bcc,0x313b90f0),LL(0x042bb2f5,0xada6f2c4)}},
+   {{LL(0x345b5e0b,0xe36fb965),LL(0xaa35a8ed,0xe5c2b124),LL(0xc516624e,0x320e6bac),LL(0xab5cd865,0x7494531d)}, {LL(0xd639964c,0x3252833c),LL(0x2a863ec5,0x636cca80),LL(0xd4745db4,0xc5a0d58e),LL(0xaee04954,0xfbe83385)}},
+   {{LL(0xc64459ff,0x147fd269),LL(0x71a648f9,0x2cb6e8ae),LL(0x20f4d77f,0x9b60a470),LL(0x5148c5b3,0x787cf10b)}, {LL(0xe0eddbc4,0xf78752a9),LL(0x17a7b44e,0x3653850e),LL(0xfe81cbe3,0x0723c71e),LL(0x63f0c737,0x073321cb)}},
+   {{LL(0x0dd7a3d3,0x3901182b),LL(0xfdd2fe05,0x815e7f95),LL(0xb80bbde9,0xa5c9d4aa),LL(0xab66a78d,0xc7482e42)}, {LL(0x428d2b13,0xd39c93cb),LL(0xe0704360,0x42034e44),LL(0x0f443b13,0xc4911a35),LL(0x03dcad27,0x2aca9f41)}},
+   {{LL(0x20ac3ed4,0xbcff2917),LL(0xa3264885,0xb5dbaf6e),LL(0x8ff15198,0xe03507f7),LL(0xb43502a8,0x4ae6eec2)}, {LL(0x5bd190d5,0xd9f54a08),LL(0xb45ab2da,0x0083ef47),LL(0x9f590c17,0xad5b5dbd),LL(0x2b851af5,0xf22497b4)}},
+   {{LL(0xf9e1028c,0x7121a1bc),LL(0x7d0d8fb9,0xc73d0d0f),LL(0x38308151,0xced27f14),LL(0xe806a5e9,0xc3a91403)}, {LL(0x591e02d5,0x61f97d94),LL(0x5660a6ac,0x560bdc67),LL(0x8daa09b3,0x48e5d2d7),LL(0x6d060cfd,0x11a53285)}},
+},
+/* digit=32 base_pwr=2^224 */
+{
+   {{LL(0x6d8c664c,0x62def7ed),LL(0xd7c445c6,0xa18cdcd5),LL(0xeb247a53,0xafef1fff),LL(0xa7bcaff3,0xf18532d4)}, {LL(0x8228f8b6,0x9d6b98be),LL(0xdf5bae09,0xa6d78326),LL(0x2df3ef7d,0x2a14242f),LL(0x7c9186ec,0xf8e6318f)}},
+   {{LL(0x4195ea3b,0x24e7be56),LL(0xe9004927,0xc83ca2fb),LL(0xfe22b55d,0x1f714602),LL(0x1300d585,0x46a812c1)}, {LL(0x49a4326f,0x6d1c1509),LL(0x0ed826f8,0x809cd7eb),LL(0x8af9df29,0xd7bfc208),LL(0x255a91bd,0xa2de76ad)}},
+   {{LL(0x16fd9964,0x0f8239b3),LL(0xf2610a4c,0xf665d70c),LL(0x97d2ea7e,0x171cbd72),LL(0x61abaab8,0x73b44718)}, {LL(0x59fe8da0,0x7cf51127),LL(0xb07df47e,0x0f4f41e5),LL(0x4a372433,0xffa8f027),LL(0x27f74cbd,0xd81f30a6)}},
+   {{LL(0x6c1f0a26,0xeead2ca7),LL(0x13682a88,0x2e01d56c),LL(0xa462087b,0xc8a80826),LL(0x28cba4b2,0xfc58f343)}, {LL(0xf29a3c5e,0x8dd7c9f6),LL(0x9ad618d8,0x850dbfa7),LL(0x9b6b61a2,0xf50863c3),LL(0x7d05ee45,0x002a661a)}},
+   {{LL(0x27d3b8be,0x14010c4e),LL(0xe3a443f4,0xedbeaaf5),LL(0xb8292acb,0x490345b0),LL(0x25ba42a7,0xc7e668d3)}, {LL(0xe0537626,0xc19660d1),LL(0x18fae412,0xd66fd1cd),LL(0x6da0faff,0x9fcd223a),LL(0x98936cec,0xd7ce3450)}},
+   {{LL(0xa560c149,0xf034f9ae),LL(0x989c20eb,0xe5890a29),LL(0x5b53f4cd,0x458f2ae4),LL(0xee3acab9,0xef29ced5)}, {LL(0x3b955c96,0x76ccef1d),LL(0xb56b6ec7,0x962e7cc3),LL(0x07d6bce5,0x875d647d),LL(0x74c21890,0x8c23b3bf)}},
+   {{LL(0xe03cb9d5,0xcedb11ed),LL(0x04764b76,0x47738de3),LL(0x50bb6ded,0x6f7ce6e8),LL(0xf8ed3511,0x5e608149)}, {LL(0xb59509fa,0x356e84cd),LL(0x4380a777,0x5bf4f316),LL(0x4b247fc2,0xc01ee458),LL(0x21904864,0x78f1f2bb)}},
+   {{LL(0xd5f746f5,0x1238b582),LL(0xcb88cc2b,0xc57efeb9),LL(0x745003a1,0xf68eca6d),LL(0xbfc8f384,0x07a970b0)}, {LL(0x22cc2470,0x0bee944d),LL(0x8b1f2c1c,0x3443464d),LL(0x13feac55,0x4994b3e8),LL(0xf3956a55,0x4b765986)}},
+   {{LL(0x55e67c31,0x59edf0fb),LL(0x79b1c829,0xd4b5d5c3),LL(0x0de5bcca,0x07a06f00),LL(0x330c2c72,0x341a88ad)}, {LL(0x698d32f6,0x7397271d),LL(0xcdf83234,0x3a4cec92),LL(0x74b01d96,0x0470e9b3),LL(0x33348365,0x7dda11e5)}},
+   {{LL(0x1a6f8daf,0x443113bc),LL(0x22f23db6,0x4aabc189),LL(0xacd9f3db,0xe49e44cf),LL(0x8cd17297,0xd4f1bb7e)}, {LL(0x4a913f53,0xb04fbb93),LL(0x6c86105e,0x4f7006b5),LL(0x6b149fb7,0x4c5fbb78),LL(0xc560a223,0x6e51cd68)}},
+   {{LL(0xf43dad1c,0xa774b7b2),LL(0xe2e54684,0x752bda11),LL(0x31fd1051,0x5e8c42b0),LL(0x6d626024,0x3433f8e6)}, {LL(0x81222cde,0x0bbf388b),LL(0x5a01b9c6,0x6e36dba4),LL(0x8bb96798,0xd40b53bc),LL(0x67edebee,0x0996b811)}},
+   {{LL(0xe03cee8f,0x337d2f7f),LL(0xe3340395,0x9fee11b7),LL(0xff28b894,0x5e692755),LL(0x818df733,0x26b7ccb1)}, {LL(0x3f856c08,0xfdba70df),LL(0xb9b68dff,0xada7e84c),LL(0x3d94be82,0xe21bc711),LL(0xf414ad42,0x8cf9aa56)}},
+   {{LL(0xcf5fc878,0xa4fb8515),LL(0xf5e272e6,0x4ded5af0),LL(0x544c3b52,0x84ac8c43),LL(0x8176bb65,0xef87db08)}, {LL(0xee817f3b,0xcb0a1362),LL(0x80c18e65,0xc66294de),LL(0xe785aafe,0xdc309d6e),LL(0x067e5029,0xbc120cab)}},
+   {{LL(0x6192fb13,0x3381cbb8),LL(0xf4453db7,0x224b42c1),LL(0x5c3f5df8,0xf350cb01),LL(0xc92c2b90,0xe2f6a112)}, {LL(0xc5ec296d,0x98ad6583),LL(0x7052182e,0x3d40647e),LL(0x9b9518fb,0xe8ef7f96),LL(0xe0db0384,0xc6b20f21)}},
+   {{LL(0xa4252be8,0x28db3783),LL(0xdd35941f,0x4cdffa95),LL(0x2a39d8ed,0x420fe5b8),LL(0xd36d9cb8,0xf1bb1ba6)}, {LL(0x59e9350f,0x2ee7a269),LL(0x281715c0,0x2fcfc8cc),LL(0xf1f6f5c5,0x18eff4b8),LL(0x07dafab5,0x7116619c)}},
+   {{LL(0x0c373dd5,0x5110960e),LL(0x6a66bc95,0x47328843),LL(0x36fe8309,0xfacc5c96),LL(0xd8f96a7c,0x9aa4ac3f)}, {LL(0x667a4056,0x25f9d0eb),LL(0x02dc4791,0x86827922),LL(0x2fd413a8,0x439c22a2),LL(0xfdd26609,0x7a042220)}},
+   {{LL(0xd27ba521,0x3a91666d),LL(0x7d4b9f71,0x6f5104ee),LL(0xbb47bc9b,0x40132052),LL(0xd2ccbdb8,0x2e3abd4d)}, {LL(0xcfb272b4,0xe7933f6c),LL(0x43745371,0x7f11dc29),LL(0xbe7045b3,0x13cfc5f4),LL(0xf82e7c6d,0xbd9bc4bf)}},
+   {{LL(0xb92eb77b,0x818af55a),LL(0x7c9e1857,0xa1670a18),LL(0x248c3221,0xbc2461c1),LL(0x1a83297b,0x5cd73ff9)}, {LL(0x60117763,0x71407061),LL(0x710c2a83,0x5cc24ce6),LL(0xada65d58,0xf5ed07a3),LL(0x797d1400,0xb6680ecf)}},
+   {{LL(0xa9541c99,0x6c4bbd3b),LL(0x82602492,0x6b40d496),LL(0x23bf5b90,0x5b7a76d4),LL(0xc1853a39,0xcdc8af3d)}, {LL(0xe5498d83,0x16b95891),LL(0xc6b6c833,0x79824688),LL(0x07b1f505,0x85e8eda3),LL(0xfa811945,0x9726c0cb)}},
+   {{LL(0xfe343e1e,0x17303b76),LL(0x96333863,0xb2126775),LL(0xc0266304,0x64ea4e57),LL(0xbacb79c3,0x1bdb1074)}, {LL(0x0736a6ef,0xe831e0fa),LL(0xd6e8b992,0x2aca2eaa),LL(0x79fe3e4c,0xbd826767),LL(0x3a734d3f,0x6b1d3976)}},
+   {{LL(0xc3975414,0xf783db17),LL(0x07df3385,0x7e419e09),LL(0x4df4613d,0x4277467c),LL(0xcda41334,0x9dc4530f)}, {LL(0xe04dde9a,0xc73935ac),LL(0x7875ba8a,0xb5df87e5),LL(0xd58fc4e4,0x8ecf2835),LL(0x5a6185ff,0xb894eb35)}},
+   {{LL(0x9f13574e,0x9f4b94cc),LL(0xd96b4e75,0x9e0c01b5),LL(0x845cc040,0xd71d3e3b),LL(0xb5d3286d,0xc6189d7c)}, {LL(0x5fd594dd,0x8d37a0e6),LL(0xe7a30724,0x04a3b28c),LL(0x18926418,0x0f8e71bf),LL(0xa518ed5a,0xfa4ff814)}},
+   {{LL(0x7b3b48ba,0x6cbeb4fe),LL(0x91b05c03,0x83f02ab2),LL(0xb32ef037,0x80e378c3),LL(0xf5e5da54,0x9f6ff741)}, {LL(0x164a508f,0x45c200f2),LL(0x3ff058d7,0x0e602458),LL(0x6c2e9538,0xbeeb355b),LL(0x5d77716f,0x9630c1f5)}},
+   {{LL(0xac98bf6d,0xcb92413a),LL(0x70323ee4,0x8282fcb9),LL(0x5aa32516,0xee12d52b),LL(0x07987c8d,0xc919ec6c)}, {LL(0xed28c5f7,0x87aae537),LL(0xb2bd434b,0x149605f1),LL(0x2bf14505,0x57473670),LL(0x107e581e,0x63da246d)}},
+   {{LL(0x0d5be936,0x0aa31094),LL(0xec764512,0x1d8fd232),LL(0x8d74b839,0xe04818e3),LL(0x6368d1cc,0xde0d832a)}, {LL(0x57d47992,0xda81713b),LL(0x4e80243d,0xaa95cc1b),LL(0x223de6f3,0x489485b6),LL(0x56a3c752,0x4b499af7)}},
+   {{LL(0x75c71258,0x92194724),LL(0x983741ee,0xf5c19b72),LL(0x92c50889,0xf3e12150),LL(0x6fd2f5b0,0x6c5157fb)}, {LL(0x0722cc9c,0x36d60a5d),LL(0x30b9f9d2,0x771d265c),LL(0xfd0db76d,0x0f9a077c),LL(0x5260994e,0x0b32100a)}},
+   {{LL(0x56cbf480,0x6b5ed8c0),LL(0xcc0333ab,0xb8c81e7d),LL(0x8b5e0aa5,0xf1418e45),LL(0x4afab018,0xaab0c50a)}, {LL(0xd450a624,0xca956e9c),LL(0x894e035f,0xf21f70c2),LL(0x8a275c9f,0xed278abf),LL(0xacacc440,0xe7fb9811)}},
+   {{LL(0xbe341c13,0x4e4d6cd2),LL(0xee64f20a,0x416cce71),LL(0x7f08679a,0xf8c7bc61),LL(0x1c704022,0xb94ff515)}, {LL(0xb514f5b6,0xad72a1f4),LL(0x79875917,0x4d1e211b),LL(0xb07d653c,0x48f6dc04),LL(0x93c01c47,0xe0e04ff6)}},
+   {{LL(0xab174f36,0x07ae0999),LL(0xca2dc30b,0xcf4ef926),LL(0x94e8251d,0x9714c60e),LL(0x0de5f068,0x2538ba0f)}, {LL(0x90ddf656,0xc5a49c97),LL(0x39bf6a35,0x0c1e16e6),LL(0x25b9fbd8,0xcb95b0a6),LL(0x3de19195,0x4542c31a)}},
+   {{LL(0x3a9e0ea3,0xf412a02c),LL(0x4de62b3c,0xfe9a3582),LL(0x7a0717ee,0xf1f3746d),LL(0xd2ef9ad8,0xba90fc11)}, {LL(0xc83c6f73,0xb1ba3ad5),LL(0x60bdd383,0xbe5fc20d),LL(0x020c9e4c,0x9e43fb4e),LL(0x4a723b44,0xa05c4a30)}},
+   {{LL(0xf5173a7f,0x573ca375),LL(0xa4167956,0x36247f33),LL(0x5988a2a9,0xfdca2237),LL(0xb67a8f91,0x47996c90)}, {LL(0x048ac621,0x81c9b5b7),LL(0x783695cd,0x9103639a),LL(0x4b1ab3a8,0xd0798ce6),LL(0x69b15dfa,0xe3d9c0f5)}},
+   {{LL(0x141575ff,0x5eb13209),LL(0x7eb9e721,0xbddd0975),LL(0x6831b938,0x65663fa7),LL(0x55f6cb48,0xd4b7c427)}, {LL(0x96d2060f,0x4b49a85d),LL(0xda925c2e,0x3ed79c3a),LL(0x8e82d785,0x1d4451f6),LL(0xba6a5e46,0x6d98f3a7)}},
+   {{LL(0xbf294799,0x063a83cb),LL(0x2c85d35d,0x6f5da2fa),LL(0x39efdfee,0xe62b2761),LL(0xc03f71a5,0x6ae06274)}, {LL(0x77a4862d,0xdef56513),LL(0x57dbd573,0x35e645ba),LL(0x59cf67cb,0x40056c08),LL(0xd7027075,0x775d65db)}},
+   {{LL(0x2694019a,0x24aa8fdd),LL(0x6bd6668e,0x1b88287a),LL(0xf61b82ab,0x6a1e8e19),LL(0x4e8b1db6,0x80a15170)}, {LL(0xb924bbbe,0x15c3932e),LL(0xbd116e71,0x74f4ce65),LL(0xf6321c14,0xa8e99357),LL(0x954a80f0,0x76e9895b)}},
+   {{LL(0x14c01a75,0xdba1751a),LL(0xca30bcd2,0x876bea8b),LL(0xdece0a2d,0x3d65090b),LL(0x85e67c70,0xd7f5fc3d)}, {LL(0xc33d62fd,0x7227baf0),LL(0x7ff2e8dd,0xdb4aa57b),LL(0x1b8b15b6,0xea9503e1),LL(0x1ecf9a47,0xac73fb2f)}},
+   {{LL(0xa1d7a4e9,0x44295047),LL(0xfcb8be3a,0xf866500c),LL(0x8ac97f71,0x577fe7d6),LL(0x184cf421,0xfe58b3c7)}, {LL(0x2257fca2,0xee1dbba2),LL(0x68222049,0x8863504b),LL(0xe98da738,0x2835d6cd),LL(0xebac308b,0x2eb636c0)}},
+   {{LL(0x30e6541b,0xef3bcf85),LL(0x28b6cf8a,0x2cfce82b),LL(0x298c83bb,0xeba0d41d),LL(0x79a8b547,0x44a793ca)}, {LL(0x016c6e33,0x3c6e57c1),LL(0xd532d216,0xca18a655),LL(0xd5bb7d92,0x67a4be7e),LL(0x4e0342ea,0x994e2300)}},
+   {{LL(0x8ec44e63,0x8e7660e7),LL(0x5503ced1,0xf80a078e),LL(0xce46bc92,0xfcf32a5e),LL(0x478eb739,0x07be6804)}, {LL(0xd06ba93e,0x1e321bd2),LL(0xf04f0889,0x613e26a2),LL(0x5b82d87e,0x34d539af),LL(0x48ba15b9,0xa0f1df0f)}},
+   {{LL(0x250ca2bd,0x21b152ac),LL(0x344d5ddf,0x95129899),LL(0xa87104a2,0x1957aa9a),LL(0x4947c3a0,0x556397c6)}, {LL(0x2f503a41,0xc91576ac),LL(0x23fe187a,0xbb31e807),LL(0xf119d6e4,0x4acfdf32),LL(0x40443afd,0x2dd489cf)}},
+   {{LL(0x401d7694,0xa3d7f66f),LL(0x4ed5d768,0x17f081d1),LL(0x817bc12c,0x7644b3b2),LL(0xd62eedeb,0x27c9c0aa)}, {LL(0x2b0a8060,0x268cbc8a),LL(0x96e464ae,0x8e7f4195),LL(0x2744b02e,0xeeba3f76),LL(0xadf63639,0x12b43d18)}},
+   {{LL(0xafed16ed,0xdccce701),LL(0x2ac9398a,0x8c1ea370),LL(0x5f6a4411,0x1415df46),LL(0x3a175501,0xcfb39afe)}, {LL(0x9f54354f,0x4fcec763),LL(0x2c970d84,0x588b27c6),LL(0xa8224016,0x21e6dd84),LL(0x3b72f0cb,0xe9c46518)}},
+   {{LL(0xd5d1fe24,0x0701a1f8),LL(0x639c8d0c,0xdf122b29),LL(0x8a5eed5f,0x8e0f3b48),LL(0x3a78ac13,0x842e61a0)}, {LL(0xb59306fc,0x4027698b),LL(0xf64a4dfa,0x81483f2e),LL(0xbe7ae3c7,0x00552dfb),LL(0xcac162c3,0xef177a59)}},
+   {{LL(0x372fddcb,0xfe972f0b),LL(0xb8ce81f6,0xcce30c49),LL(0xc45e98dc,0xfc1ce67e),LL(0x3783a4a8,0xa60e98e6)}, {LL(0x3df70661,0x92797920),LL(0xdd89ba7d,0xf7cee55a),LL(0x09a6e124,0xd3169db4),LL(0x0bd41ab9,0xef5dbbb7)}},
+   {{LL(0x517b3ec2,0x2aa6a625),LL(0xe7a16ec7,0x384d8896),LL(0xc7c4e36a,0x47a0a6ad),LL(0x70d3255c,0xfd6c3a88)}, {LL(0xde1a0ebf,0x14a9d207),LL(0x4b3e4611,0x2d048ddb),LL(0xba681250,0xa9838068),LL(0xa5a81013,0x046856e8)}},
+   {{LL(0x51829cad,0x495b110c),LL(0xd45d7f94,0x4f818244),LL(0xf317a8f7,0x0ab9700e),LL(0x4a9f7b93,0x71337d9d)}, {LL(0xc132dfea,0x5bf8738a),LL(0x529286d6,0x7dc3d9d0),LL(0xaf44e647,0x15166241),LL(0x801c0c4f,0x2a30203b)}},
+   {{LL(0xc8ccc007,0xb6d8b3e2),LL(0x65a405cd,0x8047f64f),LL(0x93707850,0x761fc66d),LL(0xa072f1ca,0x983efaa9)}, {LL(0x66c21b41,0x2ef3a020),LL(0x2615c8b4,0xf2a7f12a),LL(0x7c74f238,0x95aab12f),LL(0x7d218536,0xbc5af351)}},
+   {{LL(0x6153dbd9,0x6afd9316),LL(0x0f490f01,0x8d96f32c),LL(0xa696d1ed,0xe6f1c2f2),LL(0x263c6237,0x7f856a8c)}, {LL(0x78e78e17,0x3c04b203),LL(0xb8783c30,0xe066a7b9),LL(0xe9fad0c6,0x092600f2),LL(0x23296459,0x199aa83a)}},
+   {{LL(0x9ceb342d,0x7ea7f267),LL(0x4f7050c2,0xb0aeba90),LL(0x36a48ee4,0x1975255c),LL(0xfb0cbbcb,0x51e8f00a)}, {LL(0x72cd1726,0x4db8c883),LL(0x21884b56,0xb7cefa6e),LL(0x5a8b51e6,0xb3d99216),LL(0x17432c34,0xe8874be8)}},
+   {{LL(0xbe667830,0xed9c8203),LL(0x00576ea8,0x36f71719),LL(0x4f453712,0x7e619f29),LL(0x277e36b2,0xfd72cf08)}, {LL(0x1906def4,0x2ad66e5c),LL(0x625b2ed0,0x1a41af29),LL(0xe886c193,0x9d078a98),LL(0xc7887231,0x2e695611)}},
+   {{LL(0x692d9f3f,0xad0b9852),LL(0x2bf0add2,0x96bf1f2c),LL(0xe6771aaf,0x267a4e4a),LL(0xb8ec8d7b,0x2456a79d)}, {LL(0x9b4fd076,0x9cfced03),LL(0xcb535a32,0xf5f6c940),LL(0xf935b8c8,0xc87b801e),LL(0x1db5d356,0x048d3406)}},
+   {{LL(0xcc7aeb5f,0xd1aacf49),LL(0x1ce01ab0,0x83751097),LL(0x1542e890,0x33959df0),LL(0x14c8dc94,0x854a5b36)}, {LL(0xd4c57302,0x90206dbc),LL(0x0e630364,0x987ceedb),LL(0x028cd638,0xa6947957),LL(0x8135c2d2,0x3a85252c)}},
+   {{LL(0xccfc0b5f,0x32fa157c),LL(0xa718018b,0xd48d48bd),LL(0x1862e2ef,0x4a747a35),LL(0xa845faf4,0x687284d8)}, {LL(0x9083606b,0x6ed592df),LL(0xf6b24f52,0x71d824d8),LL(0xde6958ef,0x577ee51c),LL(0xeaa073f3,0x10cd4ec8)}},
+   {{LL(0x74fc6486,0x08756ee1),LL(0x8e6b9fd2,0x0a467330),LL(0xe39d5dd9,0xff14c353),LL(0x9db64528,0x83366ede)}, {LL(0x9a74d8bd,0x17179ee4),LL(0x12a3df00,0x7558e4d5),LL(0x5d96f1c2,0x81dd44d7),LL(0xd2a55835,0x7b96331b)}},
+   {{LL(0xa500b46f,0x1823e611),LL(0xd54fb077,0xb0ac9b5a),LL(0x33c71d20,0xf722b8f1),LL(0xfea3668a,0xe2839f3c)}, {LL(0xb4d2b786,0xa0a852c6),LL(0xc407bf55,0xb2517978),LL(0x08aeab9e,0xc471f1de),LL(0x014ac795,0x37d24267)}},
+   {{LL(0xe0c7c2f8,0x1c857b65),LL(0xad12c830,0xe8d19be1),LL(0x681ee22c,0x707c391a),LL(0x4accb89c,0x9a7ffa7c)}, {LL(0x1893a017,0x697849a5),LL(0x2c7ea9df,0xfb136828),LL(0x64fedbef,0xd9cd7274),LL(0x97d34dce,0x8f5292fa)}},
+   {{LL(0xa66a2551,0xe156986b),LL(0xeb59ca5f,0x117feba7),LL(0x0f032cb5,0xc17d8e21),LL(0x66fcbc2f,0x784ff4a1)}, {LL(0x4da11f1a,0xe2222e1a),LL(0xa568168f,0x70082588),LL(0xaecadd4c,0xaa89f45a),LL(0x9b6e0343,0x0bf1fddb)}},
+   {{LL(0xf6a91f13,0x3e358ce9),LL(0x3ab2789f,0xc0bd40db),LL(0x8f4ed8b0,0x6161a18e),LL(0x9036a21f,0xd3eea00c)}, {LL(0x29a4efd1,0x89c0784e),LL(0x476a275e,0xd236efc2),LL(0x503b03a8,0xf76c35df),LL(0x9a22bfd0,0x8cdaf62f)}},
+   {{LL(0x25f93276,0x35642ab2),LL(0xc7d40275,0x89782b78),LL(0x3c49cec8,0x9712395b),LL(0x6c0d4fff,0xae71ef61)}, {LL(0x9fae9918,0x4abfc4ff),LL(0x33101dc5,0xc914b6e1),LL(0xc5a6200e,0x7cfec436),LL(0x4b3dcd11,0x2fc11565)}},
+   {{LL(0x59432c60,0x239c7a40),LL(0x22add07c,0x02249f33),LL(0x75dac585,0x24c41b20),LL(0xc68f17ef,0x56460524)}, {LL(0x26b1be6a,0x0ceaebfe),LL(0x8b029e66,0x66e57f4e),LL(0x24abea51,0x27b25825),LL(0x6530fc43,0xf294e8a3)}},
+   {{LL(0xe45d5952,0xb18e5b41),LL(0x139c4496,0x38bbd803),LL(0x0ec5d7fa,0x9f8ef219),LL(0x5fe2dfde,0xc9c3f5d7)}, {LL(0x101847a6,0xb777fdbd),LL(0xe81f43f3,0xed0d5477),LL(0xf346063b,0xe8048972),LL(0xd99110bf,0x24c18b11)}},
+   {{LL(0x08ace39f,0x139c48ef),LL(0xb69aae4f,0x15a5c522),LL(0x73db5b08,0x111da9ad),LL(0xeca37c8f,0xa9d04191)}, {LL(0xbef9565e,0x3c2ca965),LL(0xfa76c302,0xf81bd53b),LL(0x70884fc9,0x0ad018da),LL(0x3788ac64,0xf4b50f7c)}},
+   {{LL(0xe31dab6e,0x07c9ff21),LL(0xacf1c83c,0xbe675ba4),LL(0xfec46ff6,0x8e82ed46),LL(0x98db1bd7,0xe495543e)}, {LL(0x803057c7,0xf32beb7c),LL(0xd4c1d0ad,0xe428b266),LL(0x17d361ed,0x2f12f5e3),LL(0x37b0a588,0x7e4d1011)}},
+   {{LL(0x45191741,0x276b47b5),LL(0x69b66190,0x2e4853fa),LL(0xe7bdc8f0,0x16bc57b7),LL(0xdeccccc1,0xea602ffa)}, {LL(0x9cb31872,0x4c0755d5),LL(0x8103078e,0xe99cf567),LL(0xb4a4233e,0x99c188ce),LL(0x62f59951,0x05705183)}},
+   {{LL(0xb4d7985c,0x31997616),LL(0xec57c2a4,0x179ce767),LL(0x3f526d15,0x5f0cf032),LL(0xdb4bfa47,0x264738de)}, {LL(0x9f8ded60,0x25f639cd),LL(0xb5d53ef3,0xdf159b4b),LL(0xaf518a12,0x03d62f07),LL(0x31b4f561,0x6555dc2e)}},
+},
+/* digit=33 base_pwr=2^231 */
+{
+   {{LL(0xd21a8cc9,0xd2e9b318),LL(0x2ca3021c,0xdd145132),LL(0x662a1d49,0x50809c23),LL(0xdb9a43a7,0xd2d88e2e)}, {LL(0xd8f5ae76,0xfcb9c78d),LL(0xcc9eaa64,0x43c24579),LL(0x4c77b841,0x0ec95254),LL(0x9fd1a16b,0x81bf40c7)}},
+   {{LL(0x86deb025,0x003f5ad0),LL(0xc67cd0e7,0x2679509e),LL(0x0bf55abe,0xf5ea1434),LL(0xe55ab6f7,0x2b008316)}, {LL(0xf74f6d2d,0xf024a0fa),LL(0xbc0354d2,0x6a6aee85),LL(0x63655ba8,0x95858557),LL(0x2e5ae080,0x4a498fa2)}},
+   {{LL(0x2a888703,0x01077713),LL(0x090be0e7,0xf2e27f3f),LL(0x3cecbe3a,0x82fc9bdf),LL(0x7b1d538d,0x8782603b)}, {LL(0xedeebb78,0x7d17272e),LL(0xcd91f41c,0xbcd41bf6),LL(0x0b2a7c23,0xa2e1cf47),LL(0xa55f581c,0x4113f826)}},
+   {{LL(0x6c5ad1de,0x50a1938b),LL(0xbbbcfbb2,0x582af3d3),LL(0x616dc98c,0x52d4caa6),LL(0x6436993f,0x0358ee8f)}, {LL(0xa8a225da,0x1726fb3f),LL(0xba153234,0x19963274),LL(0x7dd63a79,0x2faa07b2),LL(0x03af0155,0xfa614791)}},
+   {{LL(0x40909a5e,0x32fda583),LL(0xc4f12914,0x86dfa845),LL(0x8f148955,0xd4e48493),LL(0xb621ed08,0xb2387966)}, {LL(0x4b98bb51,0xe24ace21),LL(0x972fa4fe,0xc09395f2),LL(0x6240a11f,0xea48bbae),LL(0x0628c87c,0x1d352dac)}},
+   {{LL(0x38d649c9,0xb64cc68f),LL(0xeb0b32b3,0xba386af2),LL(0xc7e04a43,0x46203d6b),LL(0xac933a18,0xe7119d35)}, {LL(0x2d8e2319,0xb49945b8),LL(0xebc198c1,0x50803fb2),LL(0x54e1965f,0xbba9b722),LL(0x6a2f6ce3,0xef99e555)}},
+   {{LL(0xa7773634,0x08d4842b),LL(0xdc9667d4,0xd74a5f16),LL(0xd288b431,0xeb7445f8),LL(0x06f3eb8d,0xfb4c958d)}, {LL(0x0822cc38,0x0f0d2614),LL(0x2841774c,0x41f2db05),LL(0x87737eef,0xee5a56cb),LL(0x93ff1f0c,0x44f47ee6)}},
+   {{LL(0xa76e0551,0x1b67ab9f),LL(0x80103930,0x9cd89803),LL(0x1e3f0b7d,0xa44ada9e),LL(0xab068051,0xd8b9e12d)}, {LL(0x6c9b9264,0x4b173f87),LL(0xed83fccc,0xf690324a),LL(0xcbf26ab6,0xbcf11c37),LL(0xbb5a5124,0x756e686c)}},
+   {{LL(0x295f42d7,0xb4860441),LL(0xf7ce7abd,0x691c0c07),LL(0x0cf9e7ee,0xb7298e81),LL(0x0078f84b,0xc1f04c82)}, {LL(0x84f104ff,0x76fd4c26),LL(0x8ef62a20,0x02e09bcb),LL(0x5dc6bf1e,0x2d57a3b9),LL(0xfaf238ac,0x9c91ed37)}},
+   {{LL(0x72201d51,0x6e7438ad),LL(0x2f9c5f1e,0x21575ff7),LL(0xe9e69ca5,0xa79e730d),LL(0x181dc1e6,0x8c4b76ef)}, {LL(0x36fd5dcd,0xee49b481),LL(0x9b98a9e7,0xe2b0abbf),LL(0x56d73e2f,0x158bf19f),LL(0x171dbdaf,0x57f48600)}},
+   {{LL(0x4154af39,0x84a34d78),LL(0xc4f2b6d1,0x00d77f78),LL(0xbbcdaf40,0xe854bc3c),LL(0xc4bdfe3f,0x79173d04)}, {LL(0x9c12386b,0x0b38a9c7),LL(0x4e867095,0x35ade38a),LL(0xad4503d4,0x9b59b733),LL(0x519fa2c3,0xde78faaf)}},
+   {{LL(0x4c06054c,0x52be199a),LL(0x6bc131fe,0xfb672e76),LL(0x75727a3d,0x18456f98),LL(0x0b54e514,0x582bb431)}, {LL(0x342db765,0x423b2d26),LL(0x410dd3af,0xb9f61c88),LL(0x591372c6,0x982ed8e5),LL(0xa254d7de,0x164d3dcf)}},
+   {{LL(0x5b24d126,0xb7afc9d4),LL(0x03b9423e,0x9a4cc4aa),LL(0x374992a4,0xd08f1886),LL(0x916f96bf,0xc0091c83)}, {LL(0x6590323c,0xe2c67f26),LL(0x33c29eee,0xe2c1d03b),LL(0xbda6f15e,0x7aa66662),LL(0x9c5b3f53,0xb7be042d)}},
+   {{LL(0x47aaf362,0xd002c669),LL(0xbe3d6cf1,0x2c617eea),LL(0x2696c156,0xc675e472),LL(0x300de521,0x30a327a9)}, {LL(0xb2c1271f,0x4c302013),LL(0x9f200a8d,0x1e33aefc),LL(0x570430d1,0x96b0439d),LL(0xa3b38fda,0x81f0a2a7)}},
+   {{LL(0xec2689ac,0x053ab535),LL(0xb15d7d8f,0x64d9749c),LL(0x83103bc7,0x60f8cfb6),LL(0x521acb02,0x2c2fcd9c)}, {LL(0xc12c5482,0x48c214d6),LL(0xeeb134dc,0x1405e044),LL(0x35476d64,0x42ea6d9f),LL(0x47d1d827,0x10018bfe)}},
+   {{LL(0x649297e4,0xc733bd99),LL(0xabce43a2,0x05838cad),LL(0xe4e80fe3,0xfa436f8c),LL(0x0d5f0144,0xb9675230)}, {LL(0x1623b566,0x2e032b53),LL(0x474d46f4,0xeaa63a6b),LL(0x5d26c59d,0x5fb45d1d),LL(0xc33009a6,0x42bb533d)}},
+   {{LL(0x5f3530b7,0xd5136244),LL(0x917a0596,0xd08c41eb),LL(0x92e724d0,0xf7b0c53a),LL(0x33a32625,0x5da06ef9)}, {LL(0xcf2471f7,0x79d1d4ef),LL(0xb45c801e,0x66bbdd4b),LL(0x500d7d3f,0x08eb7948),LL(0x41e15b91,0xef181412)}},
+   {{LL(0xec03eab8,0xd1db3beb),LL(0xe8d69476,0xa9fa27f5),LL(0xff635334,0x0e12d824),LL(0xcc398c6e,0x6492e0d2)}, {LL(0xf9b8e95d,0xc7e10809),LL(0x359220ac,0x0f223d83),LL(0x838d57d0,0xe3fa8632),LL(0x7eceadf9,0x69f39720)}},
+   {{LL(0xe3216cfa,0x6bcd8c6c),LL(0xb3aafe8d,0x18b38450),LL(0x0df99851,0x7c4a2aa1),LL(0xe4baf9d1,0x4ef90b0a)}, {LL(0x78fd60c7,0x2cf3b19e),LL(0xdc5e89d6,0x9a984dba),LL(0x74b98d83,0xc255cdb2),LL(0x1cd56647,0xd22d6b01)}},
+   {{LL(0x906ceba5,0x843c1b8d),LL(0xeff68580,0xb3cdbcfe),LL(0x20b5374e,0x23070ee7),LL(0xb3bad308,0x3c002942)}, {LL(0xeea0ac36,0xdd8c5903),LL(0xc795e0a6,0x895f9e33),LL(0xcb480e18,0x1aa78ee4),LL(0xf098b228,0x496f868b)}},
+   {{LL(0x4d27b4dd,0x614b2760),LL(0x19e6cf07,0x371952d7),LL(0xf19d6072,0x436f8352),LL(0x05d59965,0x1924a65b)}, {LL(0x6c7d95b8,0x24b73ed1),LL(0xf24e0c63,0xc0c1182b),LL(0xe00ee483,0x26bddc97),LL(0xeb273e5c,0xb5483155)}},
+   {{LL(0x071f409c,0xefdc6436),LL(0xbe3b67ef,0xd365854c),LL(0x16464a6e,0x8c779358),LL(0xdf8e1457,0x203ddcc9)}, {LL(0x053d5161,0x79a5d81d),LL(0xa138a9ad,0x400fcf59),LL(0x19e41dc1,0xb1b49a82),LL(0xe83ef0ae,0xb22d8be7)}},
+   {{LL(0xd55314b7,0xf5a58086),LL(0x5d8521da,0x15f11b3c),LL(0x291b2c95,0x7e2cfa65),LL(0x9e7d171d,0xcbe1ebbc)}, {LL(0x31abb7ca,0x08abf4f4),LL(0x3145aab6,0xab75ab4b),LL(0xc91df3bb,0x2477e003),LL(0x5fb21fb4,0x3aaa6316)}},
+   {{LL(0x19975b92,0x158c3140),LL(0xaf6ba885,0xc56ae293),LL(0xdbaeb71b,0xaca56c2b),LL(0xf839c5b1,0x055af6c5)}, {LL(0xd952602f,0x9151b965),LL(0xf5fb8767,0x9f932eb6),LL(0xed6b41a2,0x62c939ad),LL(0xf23d4066,0x9b6b927b)}},
+   {{LL(0xdb946489,0x496de695),LL(0x18a6c65f,0x42bf45fc),LL(0x164cec5c,0x04735741),LL(0x9613a62a,0xae775e3d)}, {LL(0xdc89b793,0x1504451e),LL(0x0ecd9d96,0xcbaec945),LL(0x2c418b8a,0xe276fc86),LL(0xe8d44377,0x554f7e9a)}},
+   {{LL(0xf33bc446,0x63235b41),LL(0x821ccc03,0x87c169ee),LL(0x673af66e,0x0cf2348f),LL(0x0c7948f9,0x8599e2ab)}, {LL(0xaabc3b75,0xf5adfa96),LL(0x483124da,0x9795a274),LL(0x4d9c0140,0xedf6495a),LL(0xdd3c77fa,0x0c9f7c82)}},
+   {{LL(0x888b4667,0xaeb73e0a),LL(0x58543c5c,0xaa668b44),LL(0xcc178905,0x202c0fdc),LL(0x5de78836,0x41ef3a21)}, {LL(0x24ae9c7e,0x7364fad8),LL(0x0fc2eaa0,0x53380ac2),LL(0x606d6c1e,0x8774da1c),LL(0x7708e227,0x06441270)}},
+   {{LL(0x4eae8274,0xdeec8e6c),LL(0x41239341,0xb492fb05),LL(0xd976486b,0xf2954f06),LL(0x087ce2a2,0x1e047c68)}, {LL(0xbb89d375,0xb73c8c29),LL(0x701a0875,0x49385696),LL(0x64aa976f,0x31bc7a8d),LL(0xb7a3d9c3,0x18e78816)}},
+   {{LL(0x6624e1f4,0x2a0c5fca),LL(0xcc0fc819,0xca8545cb),LL(0xb3ad4841,0x2c75f447),LL(0x0f74c340,0xc4d5519b)}, {LL(0x92d3f30b,0x927ef4d1),LL(0x431f93e7,0x78ebfcc4),LL(0xf8965364,0xaf5629b9),LL(0x54b21fa4,0x44e638d6)}},
+   {{LL(0xc4cd4c75,0xfb07bcfe),LL(0x83af4ac6,0xce3f5997),LL(0x4f240b5f,0x5ead7a63),LL(0x0dbf8af0,0x2022a1d7)}, {LL(0xf2209edd,0x92b20fbc),LL(0x10a7ecc9,0xfce72a08),LL(0x263d2b5d,0x7cc3caf6),LL(0x580fc070,0x8100ef90)}},
+   {{LL(0xe24329f7,0x1c95acf6),LL(0xeffd2039,0x14da3a17),LL(0x275e3676,0x16318504),LL(0x85ca5d2d,0x32710ccf)}, {LL(0x874a7390,0x2a126ea6),LL(0xb8dcfd7c,0xd5a068ec),LL(0xf0236b59,0xa34c0297),LL(0x4fff03df,0x2b170c0c)}},
+   {{LL(0x2ae9a2d2,0xc282d4de),LL(0xac52c9e0,0x29f78296),LL(0x3df2f4c6,0x7f0d2cb2),LL(0x41039d16,0x980a7fcf)}, {LL(0x5b06b724,0x4db1b8c4),LL(0x1a1b85bc,0xe320e3fe),LL(0x7360d0d3,0xcc8d9f84),LL(0x9f48ed5a,0x007988f0)}},
+   {{LL(0x2186e804,0x6fd456dd),LL(0x2926090f,0x3f19e3ea),LL(0x977dcdba,0xf0cab9a6),LL(0xedad8c10,0xb471e4ba)}, {LL(0xcdc417c8,0xe7c4dd36),LL(0x20b76bf8,0xfc7f2ae9),LL(0xebf3d639,0xc9f0da0e),LL(0x4644ab64,0xe300d6d2)}},
+   {{LL(0x334d29a5,0xf9f7152f),LL(0x37f36984,0x917289c0),LL(0x9ed4b515,0xd15927a9),LL(0x563a77b9,0xfa8b8275)}, {LL(0xc40dfee5,0x43ea0f17),LL(0xf72bef08,0x8a28c572),LL(0x025d6958,0xd5003878),LL(0xcb1b6062,0xe9401972)}},
+   {{LL(0x13f6f911,0x275ee0af),LL(0x59faf0f6,0x4769c1d8),LL(0xf50cef56,0x53fc3d51),LL(0x54de29f4,0xe9770dc3)}, {LL(0x89596068,0x87d7b7ca),LL(0x673435a4,0x52d7ba45),LL(0x84e3e3be,0x45316dbe),LL(0xd649c5e2,0x13542260)}},
+   {{LL(0x589511a5,0x14a9eed8),LL(0xc5358ef4,0x0d7527a8),LL(0xeb0bbe14,0xf2d40b4b),LL(0xe5d22771,0x1440a284)}, {LL(0xc1e7e82c,0xc18d05a0),LL(0x07151cd4,0x9016e4e4),LL(0x85db5f76,0x4fc9af71),LL(0xab66537c,0xff42f355)}},
+   {{LL(0x7a686255,0xa7056d21),LL(0x26293579,0xa7cede42),LL(0x2aab0a50,0x3f2ccac2),LL(0x4bb7243b,0x1b2788c3)}, {LL(0x1dbdc9d4,0x630b62aa),LL(0x39da12d1,0xe3db41a5),LL(0x70002cf0,0x21931da5),LL(0x673058ef,0xfee85cbd)}},
+   {{LL(0xc7c42af8,0x2d1cf1dd),LL(0x0825b89f,0x76a0fa77),LL(0xa28995de,0x00214efa),LL(0xe6999ce7,0x7dc21359)}, {LL(0xf42a4bec,0x20702bd2),LL(0xb6143abd,0x7354dc89),LL(0xf5de67c8,0x2a8cdfff),LL(0xf8ffae5c,0xf9ca5d9a)}},
+   {{LL(0xa9628acb,0xf3b9cc45),LL(0x815f61f3,0xb7bf0c36),LL(0x9b223a50,0x1990ab58),LL(0xf458e88a,0x9a0592b9)}, {LL(0x387b6a9b,0xefe8f4d0),LL(0x44ef81db,0xd095c7a6),LL(0x47719f48,0xc2862764),LL(0x581373b8,0x3e7c004a)}},
+   {{LL(0xbe4e4810,0xf295c399),LL(0x6e54fac6,0x612795ea),LL(0x7e9494d8,0x6bf7f61c),LL(0x45173bd5,0x4d7716fd)}, {LL(0x0ce552ee,0x18669750),LL(0x6788a766,0x11101886),LL(0xe882771a,0xa6213a2d),LL(0x61f56788,0x09f2ed01)}},
+   {{LL(0x2aedcfc4,0xa79f0fde),LL(0x5bc82591,0xabc29122),LL(0xa09d42f5,0xf609987f),LL(0xa3635846,0x02134ae2)}, {LL(0xcd5c483c,0x1d46efe5),LL(0x15df8024,0x9ff595e9),LL(0x293795a0,0xbfd4336e),LL(0xb58c5d67,0x66da568c)}},
+   {{LL(0xeec43448,0x32d583b1),LL(0x40d01f19,0x607e9937),LL(0x5bcc2ad7,0x6afc4f19),LL(0x3a5812bc,0x2ca0449e)}, {LL(0xe8da35d8,0x41c2bce6),LL(0x33a509f2,0xe4db55b4),LL(0x94410947,0xda2b24f6),LL(0xcafc6dd1,0x7d7bb631)}},
+   {{LL(0x2a532b74,0xd556e407),LL(0xc869df8f,0x1e694111),LL(0x06e0169e,0x50cda672),LL(0x3707ecb1,0x7df41886)}, {LL(0xc3242421,0x7aafce42),LL(0x11e0a44c,0x60612189),LL(0x8a53ab1d,0x32101741),LL(0x76b8d6a9,0xe127385e)}},
+   {{LL(0x4750f3a2,0x5c3b4d31),LL(0xcc5198b2,0xd171fd6a),LL(0x3594f286,0xb89322ca),LL(0x27f74e3c,0x8b4f4cc8)}, {LL(0xdadff2d4,0xc4688ad8),LL(0xb2fdff39,0xbd8a9a91),LL(0x2964c781,0x73750eb6),LL(0x50de680d,0xbe9a03a8)}},
+   {{LL(0x4cd55799,0x294a2b0c),LL(0x8a3a6b8b,0x5805ae4d),LL(0x21633b92,0x07b2d4d2),LL(0xe57bbb26,0xefa856a2)}, {LL(0x60cb643f,0x12e317b2),LL(0x6c834e8a,0x254cb412),LL(0x1b362e2c,0xd6ee3322),LL(0x89914fc7,0x42e64947)}},
+   {{LL(0x979c3ff8,0xdaeada94),LL(0x5a1873cd,0xa44b6a1f),LL(0x499ffc1f,0x789383b0),LL(0x557a38a8,0x592382d6)}, {LL(0x21e4db6e,0x88822a1e),LL(0xc963c23e,0x9c999add),LL(0x433bb910,0xfb037ad5),LL(0x9809dff8,0x6110e8db)}},
+   {{LL(0x61387767,0xa4983145),LL(0xe56c50f9,0x7273be1f),LL(0x1916c01e,0x5253327f),LL(0x65b37c60,0x9eee7c75)}, {LL(0x2d600e2e,0x5499f3ec),LL(0x4ca4bf5d,0x2d1b9fdf),LL(0xb3943c2c,0x1607d54c),LL(0xd9c3cca1,0xedf5c033)}},
+   {{LL(0xa3726095,0xc71b98b3),LL(0xbf0f0641,0x2a91c9c7),LL(0xda90d923,0xc1e1511b),LL(0x8228c16b,0xf02d59f7)}, {LL(0x2015183b,0x8fab42e4),LL(0x819892a0,0x16405bef),LL(0xe25ce366,0xd99a3634),LL(0xdc3afe38,0x199bc33e)}},
+   {{LL(0x179ab605,0x267e7e9d),LL(0xf2d6e555,0x79a6da08),LL(0x7ea9359c,0x33f4d1d9),LL(0x3996e486,0xae341954)}, {LL(0x910c2c7b,0xe4b82ccf),LL(0xe52e380a,0x61d73e7a),LL(0x3a6a45ac,0xf2c62d45),LL(0x48bf07b8,0xe818d7ac)}},
+   {{LL(0x38ce06b1,0xe4cf0848),LL(0xbabeeb19,0x96164f53),LL(0x225bd012,0xe05ca174),LL(0x9974fdaa,0xbb1b0499)}, {LL(0xdc260806,0x1bdcc894),LL(0xb2f915c6,0x7c7a56f8),LL(0x4f5c9bbc,0x6b698021),LL(0x9008a762,0x55499301)}},
+   {{LL(0x0798f8ba,0xef709592),LL(0x7caa8fce,0xe3f874ac),LL(0x8823caa8,0xc42c4926),LL(0xc419d236,0xb57c6c44)}, {LL(0x4a317758,0x87c2eabb),LL(0xf7cae53c,0x37cfc928),LL(0x1d3ab5a1,0xef445dce),LL(0xfe013d49,0xcbc46cae)}},
+   {{LL(0xdd35b006,0xb1966080),LL(0x29dee3e7,0xa785fb46),LL(0x08203088,0xb48f4900),LL(0xeb743a39,0x6525b981)}, {LL(0x67060cce,0x9deb5ba1),LL(0x7772b406,0xbde5e2b2),LL(0x3b1c2f3c,0xfd565b68),LL(0x3b1a0573,0x8e29abf4)}},
+   {{LL(0x6da46ec4,0x915727f5),LL(0xb499edd4,0x49e84352),LL(0xd05963c0,0xe22083c1),LL(0xd86c2fcc,0x1c1ed6f7)}, {LL(0x4d8351fa,0xa3eccd8f),LL(0xb28a05ec,0xb8937b52),LL(0xed8ebcc0,0xd3715e91),LL(0x69fa2f3a,0xfdd782c3)}},
+   {{LL(0xb302293b,0xe0c58a7b),LL(0x3a83da06,0x1e6d6259),LL(0x279b54d8,0xbf0d9168),LL(0xab1e9ec6,0x49cecec2)}, {LL(0x9da8698e,0x40e1fe0d),LL(0x16348623,0xe98a5e9a),LL(0xd253ba6c,0xc5fc1b68),LL(0xf1c10a13,0x83a93a19)}},
+   {{LL(0xd00da14e,0x25dc5ffd),LL(0x703b2b98,0x9e2f1559),LL(0x5c78a57a,0xa8e225a0),LL(0x323662e1,0x45b1513d)}, {LL(0x10729589,0x4005e604),LL(0x2a43bf54,0x769fd85b),LL(0x5bd68ad7,0xadeb310f),LL(0xb12034db,0x9cb1cc55)}},
+   {{LL(0xe3df350e,0x17c5f6c8),LL(0xbf031a24,0xbfb83778),LL(0x71c01a22,0xa4cdf6ed),LL(0xb7470cb6,0xb1cd0bd5)}, {LL(0x61b6bc70,0x918b63d7),LL(0x8e1120f7,0x87014d45),LL(0x573c1ba1,0xf8c9a439),LL(0xa98c7a98,0x1a9f7fae)}},
+   {{LL(0x2b06878d,0xc0112706),LL(0xca0442ed,0x3288e420),LL(0xa5aad1b5,0x290cda85),LL(0x72ade109,0x29631b4e)}, {LL(0x4e3e760e,0x53094e67),LL(0x6a3c76da,0xc4ccb844),LL(0xd23f40ff,0xf473a45a),LL(0xf349c347,0xae7c4268)}},
+   {{LL(0x1bcba120,0xdfac00da),LL(0xf097dd6c,0x5fec0930),LL(0x9fd65893,0xffb68858),LL(0x2e08f7ef,0xb5804588)}, {LL(0x49ebc87f,0xbd538fa5),LL(0x39133423,0xb513ac49),LL(0x0156fc30,0xcbee3e8e),LL(0xff36d8a5,0x13f41f54)}},
+   {{LL(0x68fee788,0x93e7dca2),LL(0x931c13d1,0x875c2c9e),LL(0xe50c7c8c,0x0a45dab5),LL(0xe0f15aa6,0x777de866)}, {LL(0xe595546e,0x1e11c865),LL(0xe284a7fb,0x3f14dc6b),LL(0xfca3e02c,0x0168253e),LL(0x4eccb1a8,0x22a11c5c)}},
+   {{LL(0xb0c94efd,0x9f151110),LL(0xc3de198a,0x97f721d1),LL(0x7fbdd6ec,0x8222e058),LL(0x116418c9,0xf817cfee)}, {LL(0xe99718a2,0xea3d91cd),LL(0x282e5ee8,0x0a08b926),LL(0x6f480366,0x5b0a30d2),LL(0x0c356b1e,0xb64d8a3f)}},
+   {{LL(0x41b9300a,0x613e9062),LL(0xa293752a,0xb2c74b21),LL(0xb66bf32e,0x03b941d9),LL(0x784516c3,0x33acbbca)}, {LL(0x2ce114a1,0xa0f5cf6a),LL(0x0f976f81,0x4d51a26f),LL(0x82d95ee5,0xb073cbb2),LL(0xb5bb3115,0x164f7d54)}},
+   {{LL(0x5461aeae,0x7e43a14f),LL(0x852ebf0a,0xd8c00069),LL(0x0d65c094,0x2e898712),LL(0x95837550,0xe8e50320)}, {LL(0x63ee479b,0x885de3f0),LL(0xe10f13ed,0x6bd48b44),LL(0xe981aee7,0x2eae3432),LL(0xacffa159,0x8086e01a)}},
+   {{LL(0xf3e4b02f,0xb41a1b15),LL(0x60bbfa90,0xb84b2ac1),LL(0x4df85310,0x88541b8c),LL(0xf0b7bda6,0xb6215052)}, {LL(0x5969d63c,0xbd594613),LL(0x8668d22f,0xa38562c6),LL(0xfa02642f,0x9f006dec),LL(0x8820fa02,0xc4bfa360)}},
+   {{LL(0xbdc5ad71,0xfc5b776f),LL(0x985eb32a,0x65542b91),LL(0x0572e1ce,0xcacf2e0c),LL(0xc36bab49,0xd22452ad)}, {LL(0x4fe83e32,0x26cd44db),LL(0x310d6ee6,0xf3e0468c),LL(0xeeff57dd,0xc3bd373c),LL(0x90b4bba6,0xfd62daae)}},
+},
+/* digit=34 base_pwr=2^238 */
+{
+   {{LL(0x532a6ea6,0xf864e88b),LL(0x3b673480,0xfee47ad7),LL(0x4df42da4,0xb04a05b5),LL(0x7da26163,0x37b53510)}, {LL(0xbdd06aef,0x012aa5dc),LL(0x142e67ae,0x70a2fa71),LL(0xea7ddb62,0x3600dc14),LL(0x9a751d6c,0x014f4f01)}},
+   {{LL(0xadb5844f,0xc1dbd304),LL(0xf6d15bb7,0xe262b782),LL(0xf56a39fd,0xa0f75234),LL(0xd1952cd7,0x21f4b899)}, {LL(0x95bb73ec,0xa39cc4e7),LL(0xe5531d05,0xf970466b),LL(0xac6f43ce,0x54bcd9ba),LL(0xc9d0eaf8,0xdb6a18bb)}},
+   {{LL(0xe7d563f4,0x6924560e),LL(0xe25c978e,0xa860f687),LL(0x01f1634d,0x810bbf52),LL(0x72801ead,0xc81ca333)}, {LL(0xff26ee9b,0x32382043),LL(0xe8c9f307,0x3d13f63c),LL(0x144c2b15,0x365c5313),LL(0xffca4f87,0xd8de8b17)}},
+   {{LL(0x58a8aecc,0x2d63d363),LL(0x676a1840,0x393a5462),LL(0x4368ae8f,0xa2f08a93),LL(0xa611c3dd,0x36c2bb30)}, {LL(0xe44f6d6a,0x701f8653),LL(0x0fa19833,0x846ec478),LL(0x1921b4a8,0x54ab2b7e),LL(0xa6b88446,0x92d19021)}},
+   {{LL(0x31b1a7fe,0x370f2b8e),LL(0xb2e286b6,0xe54e25af),LL(0x795e1c25,0x8512296f),LL(0x08f5ec91,0x4910ad28)}, {LL(0x67c6afdd,0x8c2fd656),LL(0x6fc75221,0x055598d4),LL(0x36aff762,0xb03744e3),LL(0x70a4434f,0x975b4e19)}},
+   {{LL(0x5792a31a,0x2cc2a48d),LL(0x507adf41,0x8e679b92),LL(0x6fb5386b,0x5ee28557),LL(0x69974211,0xed810c51)}, {LL(0xa692d3f1,0x12f048b0),LL(0x0e2c6a29,0x6633edb5),LL(0x3856a2f0,0x2dd4dc23),LL(0xa3505774,0x35e4c852)}},
+   {{LL(0x5345eacc,0xcf70dd5e),LL(0x5b30468e,0x4b75af4c),LL(0xcb343dec,0xf9cb93bd),LL(0x9d98a86b,0x677282b4)}, {LL(0xf5df1d1d,0x9f77aa8e),LL(0x78275d65,0xa9ccaa3c),LL(0x2ec04975,0x1e219bce),LL(0x2524325a,0x407b2f51)}},
+   {{LL(0xdd09da64,0xb97f1163),LL(0x855f07e6,0x22a4e399),LL(0xf028904a,0x4810731c),LL(0x48a80513,0xf5d67327)}, {LL(0xf139875e,0xec9ac3e0),LL(0x4d56af2f,0x92011af0),LL(0x5e3b93de,0x6db7c2d1),LL(0x455bebe0,0x30763ea7)}},
+   {{LL(0xe9c2a874,0xab35863c),LL(0xc7566774,0x35812fc2),LL(0x40fe1e57,0xc9ce1337),LL(0x68a15793,0x085b7614)}, {LL(0x24ee25bd,0x8de31ffb),LL(0x0deecd0c,0xede6650c),LL(0x10ec0cb0,0x56897204),LL(0x891a6a5b,0x410dadb7)}},
+   {{LL(0xc6a4c890,0xf73d0cf2),LL(0xe3adc118,0x64a7ff23),LL(0xadc04449,0xb9e386ee),LL(0x912b45c6,0xc6798e89)}, {LL(0x162bd1f0,0xf7c0be54),LL(0xe073c886,0x4f820675),LL(0xefbd2368,0x4a2c104b),LL(0xd36c358e,0xa6a502b1)}},
+   {{LL(0xdbba171f,0x71dbcc38),LL(0x45d592b3,0x5374264d),LL(0x6be2be1f,0x79f613db),LL(0xb60ba12b,0x73d60425)}, {LL(0xd4168cf9,0xc4166068),LL(0xa7b9bdb4,0x0364a3e8),LL(0xb1a03ff6,0x92f760e9),LL(0xa0552cb1,0x1e98766e)}},
+   {{LL(0xdbc895f4,0x5551b17c),LL(0x8a21f081,0x7f5ecb2f),LL(0xe2b4f569,0x520715fa),LL(0xf7dcd9d2,0xc7051b37)}, {LL(0x27c8e319,0x76181b88),LL(0xe4fc1a12,0xfb6baad8),LL(0x61cfce76,0x8f81106c),LL(0x35008866,0xa021837d)}},
+   {{LL(0x61089651,0xda0f7bb8),LL(0x633604d7,0xad73974d),LL(0x64eacec7,0xd1615f38),LL(0x88f05f79,0xd8ac8a6f)}, {LL(0x49865b9e,0x5936578e),LL(0x46437de8,0x0900b94e),LL(0xbf72cc75,0xce5ead90),LL(0x6a4e92a0,0x0a727f6d)}},
+   {{LL(0x50d15beb,0x6670eb87),LL(0x12a4fd20,0xf964afbd),LL(0x05d674a9,0xab2737db),LL(0x25d61d97,0xd1dddcdf)}, {LL(0xa6ed1e68,0x25fcae9c),LL(0x714c98f5,0xf9fc3d33),LL(0x690a881d,0xf996e97d),LL(0x72bdf72a,0x64ab685e)}},
+   {{LL(0x3cb35e31,0x4b73c8d0),LL(0x34eab192,0x46e1a3c7),LL(0x241af146,0xa867388c),LL(0x110b5c39,0x65a1d208)}, {LL(0x99890d50,0xf83c58d4),LL(0x7d2a3f2a,0xdaa3d7f7),LL(0x1bd013be,0x1a124794),LL(0x28d0a946,0xddc66d0d)}},
+   {{LL(0xc4f8fcf1,0x65a09e59),LL(0x272ecd9c,0xffbd761d),LL(0x452e0fc2,0x6a5115a1),LL(0x56818b68,0xf069fcc7)}, {LL(0x899fe72d,0xd59b3e61),LL(0x3a361043,0x0435d4fe),LL(0xe6ef01a6,0xdc258d16),LL(0xc6e9e195,0x2630d853)}},
+   {{LL(0x289f8501,0xa8c99bb0),LL(0x8741994b,0x09b93cd9),LL(0xc4dc1e5e,0x4cb13c40),LL(0xd55a9601,0x64e6363f)}, {LL(0x1f5527ce,0xdd0ae5ca),LL(0xe8187b7d,0x847f17a3),LL(0x1f3a6f56,0xe96d9646),LL(0x00857865,0x45f3377d)}},
+   {{LL(0x5c2bf113,0xd363b5f7),LL(0xea33d631,0x8be249a3),LL(0xbdf3f7e2,0x5b95646c),LL(0x1a7f5b32,0x5d5edc3b)}, {LL(0xc5d286d7,0xad514247),LL(0x4c7e7ea3,0xaf1e255c),LL(0xc876998e,0xcb65b2f5),LL(0xb48a62bf,0xf3538eab)}},
+   {{LL(0x16db468b,0xcc6c2bb9),LL(0xc91332ed,0x068b2a06),LL(0xbd3ecf0c,0xa9d2145a),LL(0xfc64a94c,0x3fdd93d0)}, {LL(0x6c7bc157,0x5732f929),LL(0xde13b0c0,0xd5708408),LL(0x7bc64cdb,0xb006df33),LL(0x6b68eebf,0x9cf2a1a0)}},
+   {{LL(0x302513da,0x1cdf62df),LL(0xe4dc1668,0x64605506),LL(0x972be654,0xdee53189),LL(0x948afbf7,0x1519d30a)}, {LL(0x423acbe9,0x5b6cb34a),LL(0x495866f3,0xcbd96d42),LL(0xb27a8c3f,0x8af8c97e),LL(0x02405022,0xf4b87065)}},
+   {{LL(0x5c37ea9f,0xdfea39d7),LL(0xdced61c5,0x27ac60b1),LL(0x3ddb396f,0x90cf2ced),LL(0x6fe84157,0x34d04f57)}, {LL(0x4ff52b21,0xbcca291e),LL(0x5f802b8e,0xc7f91b33),LL(0xd0d60eea,0x753f0c68),LL(0x3a266126,0x06f65ffa)}},
+   {{LL(0xf094028c,0x40c4c5ce),LL(0xd858c573,0xcff933d7),LL(0xd26a503d,0xd884db50),LL(0xb84e4836,0x866edeb5)}, {LL(0x3f091038,0x47ec2b57),LL(0x17393656,0x7e9702e0),LL(0xc33cac3e,0x93474ae9),LL(0xbc90fb01,0xbb74a1b2)}},
+   {{LL(0x80faca19,0x54cd391a),LL(0xdf35e93e,0x25326b08),LL(0x9b16a610,0x63168ab1),LL(0x4ec57134,0x4223b618)}, {LL(0x0eae9e52,0x77c128b2),LL(0xdce93f6c,0x2120242e),LL(0xfd19badb,0x8807393d),LL(0xda8889b1,0x462d7372)}},
+   {{LL(0xcb98810e,0x96106aaa),LL(0xf5e4b4b3,0x40ba6754),LL(0xe92ec5a1,0x5c711b3e),LL(0x441a876e,0xb78ce790)}, {LL(0xa49c603d,0x1f0544b6),LL(0xf545894f,0x3715dcec),LL(0x54ba6c95,0x243454e3),LL(0x54895e73,0x2342ae4f)}},
+   {{LL(0xda69a157,0x41c8fa3d),LL(0x32776be5,0x3ccdf0fc),LL(0xa667beaa,0x7323a6b2),LL(0x0592370e,0x74fdd4ac)}, {LL(0xbb32aafa,0x0cf6c4e0),LL(0x6b8c6212,0xf7512717),LL(0x66cbdb6f,0x6756ffad),LL(0x1a2617f3,0x3856c842)}},
+   {{LL(0x57742a29,0xfcc26393),LL(0xdbe624bf,0xab089b0a),LL(0xf039525f,0x85702b0b),LL(0x0553284a,0x48067121)}, {LL(0x044ec1e6,0xf66a0140),LL(0xef942937,0x3486d21b),LL(0x1f0d520c,0xc643bfc1),LL(0xa45d2bb9,0xfd57ebb8)}},
+   {{LL(0x480c1d1d,0x27a016c9),LL(0x0cb66291,0x076ab966),LL(0x891e0386,0xa9ce1d06),LL(0x1c64f0ca,0x3a9e396c)}, {LL(0x82413b06,0x42ea7b8f),LL(0x4dcef0b9,0xe1d67242),LL(0xcf7d0f53,0x637ada7f),LL(0x2af473be,0x43cb4736)}},
+   {{LL(0x8e0376ec,0x31e24810),LL(0xe5d7a816,0x3abd9b67),LL(0x5e189d01,0xa7fc938a),LL(0x2fe13886,0xeee2e9f6)}, {LL(0x4bc5b96c,0x9d96c9e3),LL(0xa5b490d2,0x11b750f4),LL(0x3b718de7,0x63366b8b),LL(0x7b2b7291,0x3b2921b6)}},
+   {{LL(0x6aea3844,0x9ea9e6fc),LL(0x3179d2de,0x79e4d5a0),LL(0x51c8de14,0x094fd39d),LL(0xfa64024a,0xa184c48b)}, {LL(0x28b89e46,0x7d8517ed),LL(0x030422ff,0xf9fc19c3),LL(0xd915a5c6,0xa8119dcd),LL(0xf50a0f6d,0x0c406793)}},
+   {{LL(0xf9bc691a,0x967781f1),LL(0xb2810571,0x59eab009),LL(0x8ca773a6,0xc91f480e),LL(0x10684689,0xb32a6e52)}, {LL(0x834fefb7,0xed30de20),LL(0x0fe08620,0xd2fc8c46),LL(0xfec24bce,0xe5f9cf09),LL(0x7de7599d,0x007f17a6)}},
+   {{LL(0x043f7c6d,0x1388b0e7),LL(0x9f7b9c21,0x560ee7e5),LL(0x2a9433da,0x8cdef60e),LL(0x1a7725db,0xaaf335d4)}, {LL(0x50e8ca5a,0x5a047b59),LL(0xe716db4e,0x4ca86fd5),LL(0x3aec8b9d,0x37e494e0),LL(0x22002a2b,0xcd4cfd2e)}},
+   {{LL(0xa87b66ce,0x5e6469a5),LL(0x946d2536,0x75a2f4b1),LL(0x27b5e5a1,0x71ef9183),LL(0x29e52df0,0xc2f01d46)}, {LL(0x19f3e19f,0x0f28729f),LL(0x058097f7,0xa5e2d300),LL(0x24c2a91f,0xfefc21c6),LL(0x62ea2c7f,0xe57907eb)}},
+   {{LL(0x7c7fccfb,0xcdd265d0),LL(0x7575c60c,0x2b00dbf6),LL(0x1d741953,0xc4ceeb9c),LL(0x4c4426b2,0xb28a8016)}, {LL(0xcb445cae,0x4396ffaf),LL(0x1cbe3e32,0x8b289ac1),LL(0x6342698e,0x5c6b97cc),LL(0xdb2d3485,0xbe2e6786)}},
+   {{LL(0x1ebe9fb1,0x454c6c72),LL(0x2217ab8a,0x7ca323f1),LL(0xd3203b08,0xecbedcea),LL(0x77128b12,0xcd219b8e)}, {LL(0x5f5b2c33,0xd5cc1dc3),LL(0x0554c003,0x9f3096d7),LL(0xb2e1fbde,0x9e9230c5),LL(0x4f86d2d7,0x2edb3730)}},
+   {{LL(0x104a9e27,0x7c35b03e),LL(0x97e6a63b,0xfc543447),LL(0x18362ebb,0x8909de6c),LL(0xd30d0e45,0x75b59211)}, {LL(0x1333cf7e,0x14007efe),LL(0x9ee236f6,0x4a0e1105),LL(0x5f8910bf,0xfd026304),LL(0xa2d580d5,0x0a879cdd)}},
+   {{LL(0x233829cb,0x8d04c59c),LL(0x5d690f43,0x2831d2bf),LL(0xf1b6c60e,0xec32e4c3),LL(0x5f6578e5,0x8726e101)}, {LL(0x0d56e78e,0xb23be8ee),LL(0xd8e3987f,0xec2542dd),LL(0x3980ad13,0xe9ba8b16),LL(0x8942d6fb,0x1b37ba59)}},
+   {{LL(0xcf84d47c,0x61d5a24a),LL(0x0de87d4d,0xde87fe5c),LL(0xa033bc0b,0x2087011b),LL(0xb2f7b72e,0xf3cd292b)}, {LL(0x697e797c,0x57346a85),LL(0x13bc2b8e,0x7aeb8778),LL(0xc6177611,0x3daba70f),LL(0x673c937e,0xe72dea7f)}},
+   {{LL(0x23d40992,0x30d99e87),LL(0x9529c7a1,0x7f08cf6d),LL(0x0392e817,0xbb569485),LL(0xe7933166,0x1ed896dc)}, {LL(0x92d0dc24,0x2360d981),LL(0x34069541,0xf867a9b7),LL(0x1f549eeb,0xfffcbc61),LL(0x81ced4f7,0xece0dfa1)}},
+   {{LL(0x88d94b9e,0x6d1af3a7),LL(0x8a401e0d,0xece82314),LL(0x259a4e74,0xeb6968b8),LL(0xe03d40f7,0x54dd2d62)}, {LL(0x7d268981,0x957563c3),LL(0x3c8ab3a1,0x55487b75),LL(0xd2aaeeab,0x7300c266),LL(0x506f4bc6,0xb78a5331)}},
+   {{LL(0xd983b098,0x74c01d24),LL(0x0a50802f,0x1a786630),LL(0x3e4628fa,0xa6670695),LL(0x061784bd,0xf60a387d)}, {LL(0x0488905d,0x83be3a98),LL(0xf94ea0ba,0x726b85f2),LL(0x5a3593d5,0xd573238d),LL(0xa10d6a8a,0x8c214cc9)}},
+   {{LL(0x2069d2e7,0x95351fe5),LL(0x20976428,0x0dc6f194),LL(0xa33627be,0x8d4a2fa4),LL(0x4eb2d6b6,0x8c4d5534)}, {LL(0xffe7ce77,0x67ce7016),LL(0x5f05200f,0xe64f402b),LL(0xb5d9d56f,0x38652cd3),LL(0x2d999b7e,0x26a638cc)}},
+   {{LL(0xa0a0fe34,0x3bd4eb50),LL(0x2994c60b,0x657bd032),LL(0x046c2ef0,0x546fead5),LL(0xb9ba26f7,0x7c235330)}, {LL(0x137a3e95,0xd3b6567a),LL(0x2a30d0f4,0x02016415),LL(0x3f4498e6,0x43e1fd18),LL(0x0f612f7b,0x8d331147)}},
+   {{LL(0x18cb9ca4,0x1e05f626),LL(0xabc174db,0xaacd2c8c),LL(0x5fb30197,0x89448934),LL(0xdc4f4211,0x6e037f64)}, {LL(0xef7909bf,0xfe73c170),LL(0xa3382d33,0xb6cd9e34),LL(0x6b893bef,0x268b0fc4),LL(0x28201d55,0x00b36603)}},
+   {{LL(0xf0f2c574,0x24d786a1),LL(0xe189f236,0x6ec3d98c),LL(0x92daa6df,0x4e8f0a00),LL(0xa328ca87,0x32f4bdd0)}, {LL(0x647422f5,0x2ba38aef),LL(0xbc7d339c,0x442461a5),LL(0x8d5cdf0c,0xd32855e2),LL(0x575accb1,0x8e226c9f)}},
+   {{LL(0x34339439,0xb2a06e75),LL(0xca5bae3e,0xcf40637f),LL(0x88967064,0x0329c5d6),LL(0xf845a766,0x8164ba59)}, {LL(0x5441e0e3,0x5efcb4c8),LL(0xae5976cd,0xa5d75c30),LL(0xd09e257a,0xcd682b09),LL(0xbdf691f5,0x2c5918ac)}},
+   {{LL(0x809a6ee6,0x19a02373),LL(0x3c626f11,0xa80a5b84),LL(0xc97cf688,0xb40b2aa9),LL(0x90e31ace,0x2a0b1ce6)}, {LL(0x0416c576,0x1689a0db),LL(0xb54b7049,0xa5f1ef88),LL(0x563ff721,0xe0ef49f5),LL(0xbec55b40,0xf4741067)}},
+   {{LL(0x90f8dda9,0xdcf435a2),LL(0x6f9b4d6f,0x0ecfebd0),LL(0xd8d39122,0x068b0ef5),LL(0x7832b9b0,0x3f03424e)}, {LL(0xb352bc27,0x03937e30),LL(0x7d1b4015,0x8b212381),LL(0x37911ef1,0x54aebbc0),LL(0x8d8d80dd,0x3895cfee)}},
+   {{LL(0x241cf49f,0x9d8c4912),LL(0xd0e8364c,0x2e73a107),LL(0xc1290135,0xdea119c8),LL(0xff1f541e,0xf74817f8)}, {LL(0x9ba8c4af,0x29041d13),LL(0x17aede57,0x39c95c0f),LL(0x5fa832a0,0xb8588aad),LL(0x09d81fb4,0x9f373a39)}},
+   {{LL(0xf6e77b59,0x9c889154),LL(0x72765c61,0x87cabb48),LL(0x4a3faeb6,0xad3f13f9),LL(0xbd8234b5,0x773b915b)}, {LL(0xc17100e7,0xc0fd9f5e),LL(0x6d70803a,0x3d011948),LL(0xf564a565,0x7f0f6357),LL(0x742b57e5,0x2cf880cb)}},
+   {{LL(0x0d0513a6,0xafcf2737),LL(0x355522f8,0xa92e0719),LL(0x7f71c6e6,0x59a9d432),LL(0x72b5ab42,0x88d18ecc)}, {LL(0x876dc18f,0xf00f9d70),LL(0x8c3bbdd9,0xf8d983c9),LL(0xf1d993d0,0x06454934),LL(0xd151c23a,0xae75fd76)}},
+   {{LL(0x37222b63,0xd98fce30),LL(0xba3677bd,0x98c26504),LL(0x1792fb7c,0x3f5abf00),LL(0x3029b1ed,0x1e0da625)}, {LL(0x210bcbe9,0x1ec5c431),LL(0xec2d8c5c,0x87877212),LL(0x1cf003dc,0xbc052980),LL(0xeecb30de,0xcf644179)}},
+   {{LL(0x7f550cff,0xef3bd710),LL(0xf6716f3d,0xf90b7237),LL(0x32233cdb,0x071fff89),LL(0x40d58724,0x4c048cea)}, {LL(0x65e86924,0x20bfb310),LL(0xc48da998,0x94b7297b),LL(0x54f64297,0xc983b5f1),LL(0x4277ea8d,0x0f21384d)}},
+   {{LL(0x0266ec56,0x37bf0806),LL(0x3aa6865e,0xcb7a1520),LL(0x4a3d0572,0xe9b67e56),LL(0x3e8be9b7,0x1ae88dba)}, {LL(0xa1c03a8e,0x024e01db),LL(0x0fc59f26,0xd2186cd2),LL(0xf05bba5e,0xe7e57e44),LL(0xd19a0cbf,0x723394e6)}},
+   {{LL(0x080d743f,0x1aab6441),LL(0x2400f858,0x652c6316),LL(0x078d168f,0xd1a17573),LL(0x09df85c7,0x7ef2d88b)}, {LL(0x6e1be6b5,0xd5a67f60),LL(0x3f35722c,0x8f3cda1e),LL(0x87a1fcc7,0x86f410c3),LL(0xc2837a50,0x778188d0)}},
+   {{LL(0xbc3c60d8,0xcd0412a0),LL(0x36ca73c7,0xfd984ede),LL(0x7f93e4f8,0x53c8953e),LL(0x87309092,0xd163a078)}, {LL(0xebb028f8,0xce515fdf),LL(0x6e1f1c6a,0x93081ea2),LL(0x542c8ad8,0x17275a34),LL(0x8c7e8095,0xe42c90d6)}},
+   {{LL(0x3e5c0fe5,0x03c4bcca),LL(0xed057398,0xca7ec821),LL(0xbe8c6d75,0x8e1a4e6d),LL(0x034a9a99,0xc130eaa8)}, {LL(0xbf2c1aef,0x80ba14d0),LL(0x0553b0ae,0x80a7045f),LL(0x0f73a937,0xf7981537),LL(0x58d30d97,0x50861fe9)}},
+   {{LL(0x7d8720d7,0x6df63c72),LL(0x2d0969ea,0x2355be3e),LL(0x4c483ca4,0xf62885b3),LL(0x38fef708,0xeeb00d74)}, {LL(0x45b898a0,0xb51ae2a2),LL(0x820d989b,0x62fe0873),LL(0x9d58549f,0xee56547c),LL(0x941c97ce,0x6b3cee35)}},
+   {{LL(0x97cce6a0,0xdb6043b4),LL(0x46cf92f0,0x6f763ac7),LL(0x272a99b5,0x2d4d6e77),LL(0x2cb0433c,0x73fcf113)}, {LL(0x04885e92,0xfacb09c3),LL(0xf29c5f79,0xbabe9c01),LL(0x875be638,0x5a1d062e),LL(0x597b9d9e,0x643942b1)}},
+   {{LL(0x45828454,0xc5dde4c2),LL(0x509038c9,0xbbf1e76f),LL(0xdb6c36c9,0x2cc09b8a),LL(0x659729d5,0x1b58628d)}, {LL(0x322ad956,0xa6d8d61c),LL(0xd9851843,0xe7618c14),LL(0xdc087c9a,0xecb6d5b1),LL(0x1daa2b23,0x3ef5a06b)}},
+   {{LL(0x09a677dd,0x1c32326c),LL(0xacf84219,0x04007199),LL(0x36e0128b,0x927df402),LL(0x83459cf4,0x86054b76)}, {LL(0x48e0560b,0x28de82c1),LL(0x4bc4f69c,0x2cf5c21d),LL(0xe420c01a,0x22c15353),LL(0x4c1545fe,0x34c2f7d3)}},
+   {{LL(0xa9b9eebf,0x6c67187d),LL(0x5bf7253f,0x29f60464),LL(0x79726b7b,0x648dc98d),LL(0x88553105,0xbfac49a8)}, {LL(0x531ee50f,0xfac8080a),LL(0x867d182e,0x1c306125),LL(0x7120e45e,0x0d5c924a),LL(0x80563c41,0xd3a11734)}},
+   {{LL(0x81b035bd,0x0619d430),LL(0xf034e12b,0xbb69f157),LL(0x1c4ce8dd,0x037dcbda),LL(0x44555072,0xe4260ed8)}, {LL(0x95f25207,0x279933fb),LL(0x885e3834,0x73bda60a),LL(0x4a1c6b0e,0x59259f68),LL(0x54b99bae,0xa94ae1da)}},
+   {{LL(0xa2498764,0xbaeb19a8),LL(0x87bd4ad6,0xf794b5f3),LL(0x4617dec9,0x0230a1dd),LL(0x9ff59f22,0x147aed1d)}, {LL(0x33b9dd81,0xff185a75),LL(0xe4fafd24,0xcf8549ca),LL(0x803f0b7a,0x4a19a749),LL(0x7ae79132,0xedf04890)}},
+   {{LL(0x4d63744a,0x14a62343),LL(0xea69d91c,0xee299d67),LL(0x0a87b7b8,0x173ca980),LL(0x4e3c52e9,0x4fd8d4ee)}, {LL(0xcb5e964d,0x3f63f285),LL(0x33c29892,0xf84535bd),LL(0x9796c762,0x871517ad),LL(0xd1906b6a,0xeac1b195)}},
+},
+/* digit=35 base_pwr=2^245 */
+{
+   {{LL(0x22e6d938,0x25682ef1),LL(0xcdaf0c39,0x930697aa),LL(0xcee93bc7,0xfab5a955),LL(0xa20132b1,0x0c6c00c2)}, {LL(0x9b7cf9cf,0x9eec6ca4),LL(0x31ce8ad6,0x4a111c62),LL(0xa987713e,0xe04520c3),LL(0x90518566,0x8d0700f3)}},
+   {{LL(0x792ce794,0x41c22ed6),LL(0xe2df1d86,0xdc1a8163),LL(0xeffd19e7,0xc8dfe2a5),LL(0xcd7f0d80,0xd1852be6)}, {LL(0x49f4005b,0xa1d23f54),LL(0x4c6b2d55,0xb5a8237a),LL(0x32d62eff,0xd5e6c506),LL(0x5be6c80e,0x661f4095)}},
+   {{LL(0xcab64f0a,0x48fe1bcb),LL(0xada33f60,0xdcfca529),LL(0x84ff9455,0x232f18b8),LL(0x5d06a595,0xc095688e)}, {LL(0x8b935daf,0x186b9377),LL(0x4e0b7932,0x0fee16e4),LL(0x4d5e5305,0x8827fdd6),LL(0x6288a7cb,0xaf507d12)}},
+   {{LL(0xf47de484,0x2a5f69e9),LL(0xfbb82355,0x7aba671e),LL(0x6f252895,0x3c06b943),LL(0xa0cd8361,0xa6c3e44f)}, {LL(0x73fff468,0xc6f187be),LL(0x82f838d0,0x0b11ad56),LL(0xadcfaeb8,0x75e9f54e),LL(0x0a4a149d,0x654296a0)}},
+   {{LL(0x46bb8350,0xb3176f93),LL(0x49afcd10,0x293d1fda),LL(0xc057bf81,0x972b8bb2),LL(0x44ff6cf3,0x53a89e29)}, {LL(0x853b7c36,0x8daa9652),LL(0x5037af7f,0x4204e823),LL(0x54d74683,0x519b97d8),LL(0xfcdd0240,0x28c1b190)}},
+   {{LL(0xcad2b066,0xa8c759ae),LL(0xc9fcf99a,0x4e3c8061),LL(0xafe1b2ef,0x89200ecd),LL(0xd7bda93c,0x75a01a44)}, {LL(0x9fa217c2,0x5ff6ec0c),LL(0x0347b200,0xf1135c71),LL(0x6920b125,0x18d51c29),LL(0xf090f8cc,0x8d04cfa8)}},
+   {{LL(0x6ffbcc06,0x62de3984),LL(0xeaabc933,0xdfcc464e),LL(0x095d790e,0x3959acab),LL(0x646db65b,0x58d16a20)}, {LL(0xdcf586d6,0x21e4ba3e),LL(0x0849520c,0x54b2197e),LL(0x86d4a46e,0x97de0f3d),LL(0xfa6d1ddf,0x97c49494)}},
+   {{LL(0x9c2d5cfc,0x337059fc),LL(0xf5d4355d,0xe3544a1e),LL(0x78ac2a02,0xf137ac18),LL(0xe8cbe756,0xdf585dde)}, {LL(0xfb7d309c,0xbd1cf0bf),LL(0x6110ef25,0x52af123d),LL(0xa603c7a0,0x2bc7ddc6),LL(0x02f740ca,0x515411d5)}},
+   {{LL(0x1cff07bf,0x009b83a8),LL(0xf17e0b64,0x85eb6918),LL(0x2f019f19,0x21437a05),LL(0xdb22bbda,0xe1bd5fc2)}, {LL(0x7d619f0c,0xb1a9cefa),LL(0x71640ec0,0xb123979e),LL(0x838533c1,0x6a4d451a),LL(0x7cc32438,0x19add047)}},
+   {{LL(0xa4b169f1,0x5b3b8c70),LL(0x465fc52c,0x87f8272c),LL(0xa44aa39d,0xf0110358),LL(0x53e0be3c,0x6c85bd80)}, {LL(0xdc1ddb9d,0xce283400),LL(0x24b53c8f,0x37853972),LL(0x2e74cc27,0xe610abe9),LL(0xc211f839,0xfb7caa4f)}},
+   {{LL(0x3bcfd6fd,0xe7baa95f),LL(0xbb576ff5,0xfc707f67),LL(0xf643d375,0x3700d68b),LL(0xe944929d,0xcbcf7d06)}, {LL(0xa9583062,0xe91d7c54),LL(0x66c4bae2,0xb597d12c),LL(0x43794a95,0xd7449ab2),LL(0x303e3677,0x52fb504d)}},
+   {{LL(0xbd9cc38d,0x53529134),LL(0x0b4d9e4b,0x1b89e092),LL(0x3e0486cd,0x5282beb7),LL(0x211e9a7e,0x4cefcc99)}, {LL(0xcc1c229c,0xa80d3761),LL(0xf3b0d922,0xe67359bc),LL(0xdfed5bda,0x212c3b15),LL(0x33b0ff35,0xa2b13c18)}},
+   {{LL(0xeffb5688,0xd459d83f),LL(0xcc69eb8d,0xaa816306),LL(0x95c943b5,0x92fccc56),LL(0x069a0647,0x7ee8ef07)}, {LL(0xe4a6c07c,0xe6acae91),LL(0x3847114e,0xb35ce69c),LL(0xee461e9c,0x41153729),LL(0x2b28957a,0x55675d0e)}},
+   {{LL(0xebbd674e,0x63fbf0f6),LL(0x302b1485,0xb4e51f12),LL(0xc7d383a8,0x859d22e0),LL(0x3b818cad,0x44ab02ea)}, {LL(0x3ef08531,0x5adfbcc0),LL(0xb666a743,0x56defea3),LL(0x8570f27c,0x009f1472),LL(0x8320ac0e,0x0316ef30)}},
+   {{LL(0x23b1a3a9,0x4dcee17f),LL(0x4c751e8a,0x82ff2fb4),LL(0x9597c55e,0xbb406a2e),LL(0x92b13ba8,0xe214a1ca)}, {LL(0xd25f85ab,0x9882de21),LL(0xadf5b21c,0xa6ec899b),LL(0x59d7ed8e,0x4fb5497b),LL(0x63c351cf,0x68398218)}},
+   {{LL(0x9b4306d6,0xcc923794),LL(0xb6570363,0x6f09b405),LL(0xf0f61a26,0x52cc6c39),LL(0xb8e4b1a6,0x2b5537c9)}, {LL(0xcc3d02f1,0x20c368bc),LL(0x13658089,0x77717d8f),LL(0x5878301b,0x9e9fae85),LL(0xe1e19026,0x5af0fcfb)}},
+   {{LL(0x79a83498,0x1d6f88b2),LL(0x8f309c28,0x2250608b),LL(0x766e7058,0x760c2914),LL(0x917ee3a9,0xaa23cd7d)}, {LL(0xc459729b,0x0d6c2dd6),LL(0xbb4530a0,0xca2f9b3a),LL(0x378e43ad,0x7eae53f7),LL(0x8888e5e3,0x9323f557)}},
+   {{LL(0x04494896,0xef24588b),LL(0xc605a3eb,0xc4d4a3bc),LL(0x11221809,0x77bd025c),LL(0x00e87598,0x4c74a980)}, {LL(0xf2b2ade6,0xc39c46a1),LL(0x7370dac2,0x0c195b33),LL(0x3ad8e132,0xed5c2d1b),LL(0xdfb03256,0xba8c071c)}},
+   {{LL(0xaea6010e,0xf826842c),LL(0x327a695b,0xda0f35bf),LL(0xc7c538d9,0x6a2157c5),LL(0x43499508,0x068e8445)}, {LL(0x0bd4902d,0xfa7c3112),LL(0xcf03a33c,0xe7798f0a),LL(0xff0c46eb,0x786b7d97),LL(0x24f9bc6d,0x47e20029)}},
+   {{LL(0x232afb7c,0x9984f4e2),LL(0xcf25003d,0x8a9a5583),LL(0x4f8eed0d,0xe985e3fc),LL(0xf0109fcd,0xdc29a7b2)}, {LL(0xdb0c2748,0x96c0c89d),LL(0x9770f309,0xd8d36baa),LL(0x11c36c9b,0x7b5ba08b),LL(0xf3f15d32,0xf469a73d)}},
+   {{LL(0x18d11f8c,0xe35382c6),LL(0x0a804152,0x8911baa9),LL(0x0d4f2a01,0x67feba7a),LL(0xc28e0442,0xea2f8050)}, {LL(0x14f01c66,0x90ad7d37),LL(0x7cfc2510,0xfffb1a7c),LL(0x4cd89369,0x6cf6db30),LL(0xec062857,0xd5a1a498)}},
+   {{LL(0x46f02cf4,0x4f3b9a9e),LL(0xc9683122,0x4dd06c65),LL(0x2f4b1dd5,0xb95f8267),LL(0x8629caaa,0x0da1d3b9)}, {LL(0xfd67b3e9,0x912eb8fb),LL(0xe7c13840,0xb040b4d8),LL(0xdf10f64e,0xe697db10),LL(0xf01c44bc,0xcee8bd28)}},
+   {{LL(0x5f6a9d7a,0x74a8d871),LL(0x5c97fd17,0xf8ba0d87),LL(0xb01fd30f,0x094b3bd6),LL(0xf2ed63c6,0x70a1838f)}, {LL(0x27f5666a,0xca6d33e9),LL(0x5aecdf5e,0xa36661a1),LL(0x50871f14,0x457370fd),LL(0x9aa49595,0x1c944651)}},
+   {{LL(0x1eed0ac1,0x331f8e67),LL(0x0a3ae515,0x3aa82b93),LL(0xb60277d6,0xd35f3448),LL(0xf7caaa28,0x16c4f000)}, {LL(0x3a9ac023,0x93c754e1),LL(0x30543f9f,0x291d5182),LL(0x7842c791,0x7bf2bc2d),LL(0x41224319,0xa76c3034)}},
+   {{LL(0x9445e76c,0x28c619b3),LL(0x57e201f4,0xb6b356da),LL(0x06461d6d,0x4ded78c8),LL(0x86ce912d,0x3b609c36)}, {LL(0x151973e7,0xb67aed63),LL(0x29c9177a,0x27088607),LL(0x6527da74,0xd0e1f3bb),LL(0x40e9bf8a,0x4f5ae197)}},
+   {{LL(0xd54bc239,0x37f62cd2),LL(0xdfd78e03,0x4ae3b393),LL(0x5789ac65,0x659757c8),LL(0x52ad131d,0xca1406c3)}, {LL(0x0eed4ed1,0x9b4fde6f),LL(0x7b94bb35,0x0b22a9a1),LL(0x3998a3d3,0x03203c03),LL(0x6b90267f,0x435dea66)}},
+   {{LL(0xde4b517c,0x958aa8bd),LL(0x50953e5d,0x49c41bf9),LL(0x103dba65,0x344e5ff7),LL(0xbb4a3e34,0x1457840b)}, {LL(0xd4da3271,0x70cd93e9),LL(0x77a1f89d,0x3aadb99e),LL(0x281d49fa,0xc13660f9),LL(0xe7ca62b6,0x7f6c126d)}},
+   {{LL(0x0cc5cbca,0x2d3fd410),LL(0x11233bdf,0xd5355b3d),LL(0x92ee641c,0xc764a20d),LL(0x2583f7fc,0xf648c0ca)}, {LL(0xb73f4285,0x4fc2a225),LL(0xda36c48c,0x49dae57a),LL(0xdec4badc,0x156afe11),LL(0xd4642dd4,0x016caddc)}},
+   {{LL(0x86e2d105,0x9f1aec5a),LL(0xf0c7ca90,0xe35a7b92),LL(0xaca70a56,0x43bedbc8),LL(0xedacc9c1,0xd9c26904)}, {LL(0xb9efc666,0x9e8978b2),LL(0xef8886d2,0xe5961915),LL(0xdd58bde3,0x89f38222),LL(0xfd47f1fa,0xdd1aa329)}},
+   {{LL(0xdf0d6fc1,0x62f4156f),LL(0x51e96a24,0x75f60075),LL(0x81ec2cd1,0xc2449d9c),LL(0xdeb19146,0x988d271a)}, {LL(0x5fa5e922,0x93c4901d),LL(0x4dd9ba02,0xe6c32023),LL(0xd4e8db64,0xf2990ea1),LL(0x3bed9936,0x0f1c9a2b)}},
+   {{LL(0x634e2af5,0x0540f299),LL(0x86060ff9,0xf8280d65),LL(0x3738109e,0xd660bb6b),LL(0x013fc2d1,0x6fcc6d83)}, {LL(0x8bdbeecc,0xdc1811a8),LL(0xf86836ef,0x3ee20888),LL(0xa22996a8,0x57712a76),LL(0x3a1e38b2,0x51fc1fe4)}},
+   {{LL(0xf441ac64,0xa5ce7fe8),LL(0xf8cbe95b,0xce4b9a6f),LL(0xb4cf46a4,0x1a2bd334),LL(0x1204ca96,0x125ea717)}, {LL(0x251c6124,0x4b514210),LL(0x0639deb7,0x60bc1ca4),LL(0xd4951a8a,0x716c7eb1),LL(0x46c9f47a,0xf052592f)}},
+   {{LL(0x52c0a9db,0x567eecce),LL(0x582dc687,0x832280d6),LL(0x7edb52e2,0xe9da7b40),LL(0x2c4df46d,0x99b38201)}, {LL(0xfeabcd69,0xb7c49ee8),LL(0x7c51bb4a,0x01cd81a3),LL(0xa63a2ad0,0x24c02b84),LL(0x2576357d,0xb3b6847a)}},
+   {{LL(0x63a3dd41,0x0d1384e1),LL(0xe7fa9a7c,0x5c7296ca),LL(0x9d43429c,0x92d8c821),LL(0x9b9846c5,0x1ad23491)}, {LL(0x71630542,0xdc630340),LL(0x53906291,0xd2bc5c07),LL(0x868ec2e4,0xcc22eb3f),LL(0xe06f1359,0x2aed9209)}},
+   {{LL(0xc738bbb4,0xcccb25c3),LL(0xb7c1e407,0x9760bed9),LL(0xc303235b,0xbf7d1a4d),LL(0xaf0a0ac8,0x3d292724)}, {LL(0xda590d66,0x05a1cc40),LL(0x3a35ae4c,0xd875c292),LL(0xa67086de,0x7adb12ea),LL(0xc5934c73,0xe75bd766)}},
+   {{LL(0x9ee0efb6,0x46db787d),LL(0x399586f3,0xd52ad75b),LL(0xc7a0daef,0x2c545f2a),LL(0x5414bd2e,0xbb1fa685)}, {LL(0xe762e2de,0xfdc38cb0),LL(0xf3b9334f,0xaeebe97f),LL(0xcd4f2d6a,0x097ca622),LL(0xab66f7fd,0xbba0c28b)}},
+   {{LL(0xa5e7f94d,0x54198188),LL(0xef24ffce,0x8ed062f8),LL(0x22900a16,0xe9bf7d57),LL(0xcf5b3886,0xb5b907be)}, {LL(0xba2f6f61,0x1e2f3eba),LL(0xeefa9b41,0xc6c1b591),LL(0xd2dcb0a3,0x6c4e92cb),LL(0x493e31f9,0x1fda928e)}},
+   {{LL(0x855ed4b4,0x76a03fa7),LL(0xadb5bb02,0xf9be4119),LL(0x8a2203d3,0x9d6455f1),LL(0x86f10a08,0x70dfacab)}, {LL(0x0ea9c24f,0xd6b75d10),LL(0xe188ef8b,0xd2788d68),LL(0x854386ed,0xdfc28317),LL(0xb4c59082,0x23771c78)}},
+   {{LL(0x6fc14753,0x67e59bfa),LL(0x68f50f51,0x7747cb7b),LL(0x79935662,0xdbecfea5),LL(0x22c388aa,0xb6abbf49)}, {LL(0x763c60b9,0x67103501),LL(0x584cd5ab,0x4b41eef7),LL(0x3645494d,0x02564dbb),LL(0x11de8bf7,0xc49a6f18)}},
+   {{LL(0x4b2ee342,0xbf40d0a0),LL(0x3444890b,0x3ad10b43),LL(0x45f9d798,0x8c121e44),LL(0x0500fe8e,0xacc46a05)}, {LL(0xbe33f5b8,0xe4d0a241),LL(0xac35dd20,0xdea400e9),LL(0x587d8930,0x10f7698c),LL(0x2a7bed84,0xc332c0a1)}},
+   {{LL(0x50fb30d3,0x9220896b),LL(0xd66b8c73,0x9e104f81),LL(0x5bead621,0x055c0e8b),LL(0x24492681,0xa9def9cf)}, {LL(0x061fa624,0xdb6bdd9f),LL(0xd1b80446,0x3e57c391),LL(0x296842d4,0xa77d6493),LL(0xf4af7375,0xb73ea39a)}},
+   {{LL(0xd3eb25c1,0x2d7b0e90),LL(0x5c8bb5be,0x5a535266),LL(0x83016694,0xb6196439),LL(0x00306595,0x992a5c75)}, {LL(0xfcc745b5,0xac80aa80),LL(0x1ede916d,0x43a1eb38),LL(0x292a5d54,0xc9f8cf0e),LL(0x968961e7,0x44de3307)}},
+   {{LL(0xf9ea1bb2,0xef18f817),LL(0xcce93002,0xe1dff6f3),LL(0xd4c18c16,0xa2a3afe8),LL(0xce11a922,0x268dac12)}, {LL(0x5e19f4aa,0xde2cb5a0),LL(0x33944f86,0xee510403),LL(0xe589aefc,0xea8ff3ff),LL(0x2eb34bad,0xf50c5ca1)}},
+   {{LL(0x483a5697,0xe42e3eef),LL(0x45e7523e,0x6c92001b),LL(0x42a317cb,0x871877f4),LL(0x6cf1f288,0xff5be4d0)}, {LL(0xa4f726b2,0xb882642a),LL(0xac120643,0x8263dbc2),LL(0x2dea39ba,0x3130d0d4),LL(0x94e459fb,0xa45b8c52)}},
+   {{LL(0x14cd60a7,0xeba11bf7),LL(0xd8b4659e,0x2954899c),LL(0x90a9a5c0,0x0bbe7fb3),LL(0x56a0b005,0xc4721604)}, {LL(0x50402e43,0x5eab67f4),LL(0x7dbf55a8,0xead8224a),LL(0xa61067dd,0x7277c33a),LL(0x5ea11eb0,0x69f20204)}},
+   {{LL(0x42a44204,0x081c16a9),LL(0xa598677b,0x3b8f1a0c),LL(0xdb98a813,0x0f3cff3e),LL(0x71500627,0xe2d5282e)}, {LL(0x2b549dca,0x316156d7),LL(0xb7bfd926,0x47fe3687),LL(0x1bb0cb0e,0xbdc32dd4),LL(0x005985ab,0x7640636f)}},
+   {{LL(0xb1acaf4d,0xe376fc7f),LL(0x889a5042,0xd0577362),LL(0xd24b96b0,0x7b4736cd),LL(0xc64e6b7e,0x2d526993)}, {LL(0x1490caa9,0x9c1dc545),LL(0x3b33d599,0x47aca457),LL(0x9f7dfcb3,0x1b107e3c),LL(0x18e5cdc1,0x528e6376)}},
+   {{LL(0x734323f3,0x6d713a08),LL(0x593efbc0,0xfc73ff28),LL(0x4d774a67,0xae2a6b56),LL(0x96682f80,0x3dd5bdf8)}, {LL(0x21bd018b,0x698fb543),LL(0xa6527853,0x64e57462),LL(0x60f4399d,0x6e064219),LL(0xd11d2a9f,0x4cc6c512)}},
+   {{LL(0x2a4e7112,0xcab0e4c1),LL(0x05ce8bba,0xb4e3cc61),LL(0xd9c0561c,0x4c59cb25),LL(0xa3b7586b,0x52864cbf)}, {LL(0xe7c6328e,0x9440b161),LL(0x14a72dce,0x2cfe9341),LL(0xb26802db,0x635c3562),LL(0x9402cf75,0x57d9fccd)}},
+   {{LL(0xe7e4e273,0xe94fa1a0),LL(0xde8a2bc9,0x64f6975d),LL(0x348c0631,0x91ea49d6),LL(0xb6be385c,0x6febbac3)}, {LL(0x1e922f63,0xa73cf622),LL(0xe9cf7478,0x3a08e83d),LL(0x26e77089,0xa6b5d2f5),LL(0xf5903ef5,0x658d32dd)}},
+   {{LL(0x5e10f68e,0x13f3651e),LL(0x34e5c7f3,0xd37c3a28),LL(0x4b138119,0xcf602a59),LL(0x46c53afe,0x76083131)}, {LL(0xa11324aa,0xb6866e21),LL(0x9d66c609,0xa68c4b9c),LL(0x2e5453d1,0xa0f999e9),LL(0x132f4e6d,0x49a7a4ef)}},
+   {{LL(0xcc103d77,0x31430fc2),LL(0x2398fe0b,0x6e1367e6),LL(0xa021321d,0x75b48a52),LL(0x11023770,0xf4078089)}, {LL(0x6ddd5094,0x5edc1547),LL(0x5c24c392,0x0737cc98),LL(0x2f032ab4,0xefbc9292),LL(0x53d84c51,0xa36ff009)}},
+   {{LL(0x915d5e6c,0x5a5e6623),LL(0x1143882c,0x8713d55f),LL(0xeac8c0a1,0x056e4e97),LL(0xca9b935f,0xe7d7b447)}, {LL(0xfd73dc1b,0x52bf0711),LL(0xf9cbfb00,0x81f7e7e7),LL(0xa966b192,0xaf532e73),LL(0x0101b922,0x45d24267)}},
+   {{LL(0xa049629f,0xa6b174d9),LL(0x5f7983bf,0x1d10435b),LL(0x1eab27b9,0xb27fa44f),LL(0x860450b9,0x1160e17d)}, {LL(0xa789641f,0x89532588),LL(0x0b13e5cf,0x6bc5148f),LL(0x4ad8fef0,0x9d6e7af8),LL(0xbd5533a0,0xfa663443)}},
+   {{LL(0x6d244c1d,0x691a69c4),LL(0xb5a1804f,0x495017eb),LL(0x80a6473c,0x1c508746),LL(0x3eb9faf4,0xaf18ffa8)}, {LL(0x45aa8e44,0x8189c199),LL(0x85a97e92,0x55c2e7ae),LL(0x4ee8c5b6,0x38939719),LL(0xfca63e25,0x04852d75)}},
+   {{LL(0x6da23d4f,0x70c1ab62),LL(0xfecdf2e8,0x59b0ecd7),LL(0x26d72b4f,0xe648e7cc),LL(0x9ac57eaf,0x390c880a)}, {LL(0xa3320960,0x2b264f03),LL(0xb4bc6ed3,0xe08a1b3c),LL(0x5f74a2d9,0x6c4f448c),LL(0x02a5d6df,0x512ba20c)}},
+   {{LL(0x981abab9,0x7b8df502),LL(0x3b8db653,0xa16710ee),LL(0x053f6667,0xc94877d8),LL(0xc501e6b2,0xacf4dda4)}, {LL(0x2e691cde,0x1ccfe3aa),LL(0xeacd9974,0xd1dcb67c),LL(0x06ad9242,0x6d6136cf),LL(0x2bff20a0,0x51f163b8)}},
+   {{LL(0x7d7d25da,0xb5ab15b7),LL(0x8a41633f,0x600541b5),LL(0xf0759696,0x761b058c),LL(0x10cc769d,0x78c42477)}, {LL(0x419337cb,0x555e7de4),LL(0x6d092531,0x27cd2852),LL(0xae88528e,0x1062e8bc),LL(0xe24478aa,0xa945069a)}},
+   {{LL(0xccca3300,0xefaa0cb8),LL(0x16d740dd,0x9a80dd9f),LL(0xd106895f,0x7baf66ba),LL(0xddcdf546,0xafe05291)}, {LL(0xe9ea437d,0x688f62f5),LL(0x6da818f6,0x8141a0be),LL(0x493b1788,0xadaebe1e),LL(0xb15311ce,0xccb91d15)}},
+   {{LL(0x8cda09bc,0x837e7c57),LL(0x6a581757,0x472078ab),LL(0xa4fa9fdb,0x5b02b7f4),LL(0xf67e182e,0xb2c0f929)}, {LL(0xd7175216,0x99b4f2dc),LL(0xcefe818e,0xed493a6c),LL(0x900cef2d,0xfe628a20),LL(0xcd55891c,0x9abd30dd)}},
+   {{LL(0xe7492133,0x666332e7),LL(0xa0c6f9cb,0x43d3cfa3),LL(0x51f788e5,0xa6c52efc),LL(0xfd9b4386,0xfeb6eeb8)}, {LL(0x34c4450a,0x399d8cb5),LL(0x5623ae90,0xca9d1128),LL(0xfa203a9f,0xea0b3fe0),LL(0x1bfb84d1,0xb8a44d4b)}},
+   {{LL(0xfd62ad34,0x9f55abba),LL(0xeb3f8f24,0x10881b79),LL(0x0b6912ea,0x10f7c7ad),LL(0x674eb5be,0xe5aa65de)}, {LL(0x9f90a522,0x8b5c7305),LL(0x22cb1dc4,0x1eccf364),LL(0xff213f9b,0xb5411bbf),LL(0x85885f0e,0x483a3309)}},
+   {{LL(0xf3a3abed,0xad4b2a45),LL(0xa803e6bf,0x67fd6010),LL(0x7b7b9648,0xfb9cda50),LL(0xb6f54319,0xaf7ce5a9)}, {LL(0x06cf6a99,0x840db081),LL(0xb709101b,0xf518711b),LL(0x5d71d96a,0xf50a9b75),LL(0x0f5e4ea4,0xaaf10f02)}},
+   {{LL(0x82e814fd,0xfbb2e416),LL(0xa380f2ec,0x6ffeb2ac),LL(0xe61dfa89,0xa8a674c2),LL(0x808e4168,0x18ec5df2)}, {LL(0xf26b9ade,0x180fe9f2),LL(0xb8222fe2,0x981de86c),LL(0x008395c5,0x38393ffb),LL(0x6af46d92,0xc7926027)}},
+},
+/* digit=36 base_pwr=2^252 */
+{
+   {{LL(0xe9babde8,0xdf617ce3),LL(0xe3abb00d,0x6991275b),LL(0xd6bba665,0x2dac072d),LL(0x7e19efda,0x1add2339)}, {LL(0x21f58b27,0x72199937),LL(0x49552723,0x9e4ec35e),LL(0x5c4f8e12,0xa91d3363),LL(0xb733468e,0x04190e2c)}},
+   {{LL(0x675ce6d9,0xd73c1384),LL(0x14885193,0x8e4b2cc1),LL(0xcf8d48c2,0xf37f3a36),LL(0xcb9979bd,0x442c90dd)}, {LL(0x0b286749,0xa2287ab0),LL(0x765ffe2b,0x26e48da7),LL(0xe82ed040,0x76b296fd),LL(0xf807aab9,0xfda3336a)}},
+   {{LL(0x44045c30,0x01eae637),LL(0x5439aa4a,0x7bdfec37),LL(0xd1cf4fb6,0x1b01503e),LL(0x1a5d2286,0x83cc4aa3)}, {LL(0xe5ca2320,0x107653f1),LL(0xca8f71ec,0xd0fbf683),LL(0xfb588b56,0xf033315a),LL(0xd412ab93,0x7099c199)}},
+   {{LL(0x4392a7d1,0x8e3f4535),LL(0x262757f6,0xd44a38a7),LL(0x4ac50c17,0xe7e34de0),LL(0x4e4bc0b3,0xe3ea52f1)}, {LL(0x8cac974f,0x3d0a8a54),LL(0x238cb42c,0xdcf1b089),LL(0xd2bc7851,0x34b7f17c),LL(0xf117a3c5,0xe9085ab6)}},
+   {{LL(0xbcb24585,0xe563669d),LL(0xd378e8bc,0x838ec0b8),LL(0xf4781453,0x0a621868),LL(0x21ca7890,0xfc88da2a)}, {LL(0x31781b8b,0xe6b0e6c7),LL(0x41f9cbb3,0x8ef44a56),LL(0x8f49b992,0xc1f1f554),LL(0xa07ea702,0xe194c930)}},
+   {{LL(0xf5290f0c,0x3eed7556),LL(0xaedd3748,0x86196f2f),LL(0x698a1d1d,0xfa01beca),LL(0x56e44533,0xa6571d2b)}, {LL(0x73505201,0x36224aac),LL(0x5c2388c6,0xcb287140),LL(0xee50c656,0x2a173c5f),LL(0x2e008dc4,0xc7f071d7)}},
+   {{LL(0x5d673b40,0x0388d7f6),LL(0x70261ca1,0xe27359e9),LL(0x04484dbe,0xe824439e),LL(0x5bad7a6f,0xd2199835)}, {LL(0xe6352079,0x69d07609),LL(0xdfb14a4e,0x104a00b9),LL(0xe6d4e000,0x78f9f1fd),LL(0x188d7b77,0xbaa5f28a)}},
+   {{LL(0xaaf86fd0,0x2bcf5bae),LL(0x6d23b3b0,0x68f2776f),LL(0x43bfaf72,0xeb4ca6bc),LL(0xaecddc61,0x51f540a6)}, {LL(0x926b683a,0xafbedc2b),LL(0x83105534,0x6fa1b2db),LL(0xd1f855a4,0x3fa241d7),LL(0x802414cc,0x6fc22ed7)}},
+   {{LL(0x09c18bfe,0x2f2be7f6),LL(0xee966ca8,0xe294b72e),LL(0xb65a8914,0x653a405a),LL(0x1ec6e377,0x05911033)}, {LL(0xafe3f2ed,0x24cd460a),LL(0x41b992db,0x7b609f99),LL(0x58dd9d7d,0xf86d0f64),LL(0xc5f35088,0x92f15255)}},
+   {{LL(0xd0ad8c1e,0x49730856),LL(0x76d810ca,0x2a00388d),LL(0x41a1ae7b,0x67bb315d),LL(0xa7dfbd9d,0x0f10237e)}, {LL(0x8d38b294,0xb6a286d2),LL(0x9f84585c,0x7c8cbd7f),LL(0x83019709,0xacf1edb6),LL(0x72501074,0x7463a5a1)}},
+   {{LL(0xfcfb9509,0x0ea0522d),LL(0xd3538edf,0x1667f8ba),LL(0xb64b5664,0x674992f3),LL(0xd21a4bf9,0x1f9db6e5)}, {LL(0xad55b8f8,0xa3994bd8),LL(0x503b3186,0x32ae31ea),LL(0x48da6e07,0xe822c8e5),LL(0x9da91666,0xfa2a9b71)}},
+   {{LL(0x7c21d61a,0x55366e44),LL(0xcd3c4944,0xf448452d),LL(0xd19e65e7,0x2de786c9),LL(0xff755124,0x9cfb92cb)}, {LL(0x7d0ab9f9,0x153850c7),LL(0xd6038658,0xb9b2e33f),LL(0x7ed4a9d6,0x9f2d573e),LL(0x4bac7ec7,0x2993179f)}},
+   {{LL(0x9a88f3ea,0xd3260270),LL(0x3f7dd0ce,0xa1bc3962),LL(0xae3daeed,0x69bd1187),LL(0x234fddc6,0x2ef9aa44)}, {LL(0x334aed4d,0xebf81537),LL(0x9f9ef01b,0x0204c4fe),LL(0x1711f6e7,0xb63909fe),LL(0x95b12979,0x21a679d2)}},
+   {{LL(0x5668c217,0x34266e2b),LL(0x7e6d056a,0x0be323a9),LL(0x994f8c84,0x2957b356),LL(0xe70236c2,0xd723bae1)}, {LL(0x943c0879,0x13c8d45b),LL(0xacc3c557,0x4e819700),LL(0xb3cedd71,0x0035eabd),LL(0x29677c6e,0xa1b77b43)}},
+   {{LL(0x6d184454,0x8842ddc3),LL(0x6c2fa3fa,0x92cce4d1),LL(0x607ec08b,0x77f35495),LL(0x365d8550,0x68344cb3)}, {LL(0xe5181795,0xb62dfe08),LL(0xecc02a1c,0x1257e67f),LL(0x10aedcf5,0x3b1fad42),LL(0xd3f47808,0x1808bd76)}},
+   {{LL(0x64afd22e,0xab16dfa1),LL(0x91decd76,0x06f7c226),LL(0x5bccf2ac,0xf75a1650),LL(0xf115a732,0x2b02930b)}, {LL(0xa3be8b68,0xd44d58ae),LL(0xd4c46a7f,0x4a4baf0b),LL(0x24d967b7,0x75de6aac),LL(0x8a027f8a,0x49ca5f20)}},
+   {{LL(0x517bbe1e,0x1e95b377),LL(0x155110d6,0x6e132caa),LL(0x8342370a,0x8a79506e),LL(0x9302baca,0x0b318866)}, {LL(0x543fdfb1,0xe17ab86c),LL(0x7f380a20,0xad4546b3),LL(0xb1555bd9,0x2b43dc2a),LL(0x895f5032,0x71bba19e)}},
+   {{LL(0xe676fb31,0x7068f125),LL(0x22f3035e,0xdc1063db),LL(0x4c42818e,0x4874a49a),LL(0x91f151da,0xda3bf77f)}, {LL(0x338dbf4e,0xcdbfa362),LL(0xccd156d5,0x6a26d43e),LL(0xec5f4655,0xebaa765c),LL(0xcc6fa064,0x32a504a8)}},
+   {{LL(0xfe91e594,0x4b8b5599),LL(0x466bc2a7,0x4e8b3cba),LL(0xe5b47093,0x75e31294),LL(0x4d262d22,0x8d2102f2)}, {LL(0x5371f3c2,0x6b36ea4f),LL(0x9ce2065c,0x8f1424b0),LL(0x01139447,0x705fa33e),LL(0x6d83cce2,0xf0395d3a)}},
+   {{LL(0x006be57a,0x58bcb116),LL(0xfc3b979b,0x628ba43f),LL(0x94726aa1,0x7a5485b5),LL(0x4566255c,0xb5b553bb)}, {LL(0x02fcaca9,0x637b67a5),LL(0x946ba4a2,0xa7ccc997),LL(0xe2c7633a,0x364b7cde),LL(0xcaef3257,0x9b80fac9)}},
+   {{LL(0xff3f8fae,0x0b4bc391),LL(0x152492bf,0xd54a68cd),LL(0x86942415,0xbddfc742),LL(0x947fd111,0x76d5092d)}, {LL(0x2b6a0a90,0x0f40abd9),LL(0xdb3015e3,0x11aca6b3),LL(0x86938e5c,0x46679a41),LL(0xb55ffb4a,0xeeb3fcd1)}},
+   {{LL(0xbb95b7b8,0xe3e40455),LL(0xe83eed6e,0xe7540ce3),LL(0x6d0bd574,0x4fb32a69),LL(0xd68fdabd,0x0f0848f5)}, {LL(0x5391edb6,0x916ee72f),LL(0x62b70769,0x3a6fdeb9),LL(0x30f1d8f2,0x583c9bb3),LL(0x7da3fe6e,0xe9e07e20)}},
+   {{LL(0xceebf9ab,0x71f4d1f4),LL(0x66646e72,0xff293086),LL(0x89f66522,0x7794db8b),LL(0xbb3b56b9,0x1f3545bd)}, {LL(0x21429593,0x11bcde1e),LL(0x0cb74e13,0x03dda67e),LL(0xe623c16e,0x065833ad),LL(0xeb5f2d0b,0xee518bff)}},
+   {{LL(0xcd514d98,0x826f93db),LL(0xdbaa510a,0xaed363da),LL(0xf4267f85,0x53cf6c12),LL(0x7085a619,0xd52b75d4)}, {LL(0x1fe23b89,0x9e1e44b3),LL(0xb40ab581,0x3671af76),LL(0x827d1406,0x5f6b50e3),LL(0x9673ac7b,0xe6ee61e9)}},
+   {{LL(0xc50a7bd1,0x32feff93),LL(0x846844f2,0xdf891582),LL(0x83ed2958,0xd96926c6),LL(0x3080e042,0x6ac507ea)}, {LL(0x38bf97d7,0xe989e968),LL(0x73e37b86,0x1c238da7),LL(0xd8bb7de4,0x22e48666),LL(0x45f3e459,0x2aa95d65)}},
+   {{LL(0xcc905f3e,0xdf05d4b7),LL(0x8d94f255,0xfab3713d),LL(0x594250cc,0x0baf3939),LL(0x18f78768,0x19a22c60)}, {LL(0xdc083d17,0xba3c3e69),LL(0x3ed95de0,0x66bac646),LL(0xbe7eb101,0x8cf80760),LL(0xf2e91559,0x3162e7b6)}},
+   {{LL(0xe5e7bd05,0x8a113a01),LL(0x11c4f7a7,0xc4da9322),LL(0x8ba56389,0x757e6cf5),LL(0xab5dd164,0xfe1cf145)}, {LL(0x91ea945a,0x80a150ef),LL(0x99c6d6ee,0xb6b94e0d),LL(0x572db4f1,0xc7a07db6),LL(0xa9de10c4,0x5aea9d1b)}},
+   {{LL(0x74310753,0x3cd93555),LL(0xcdb146d4,0xde8edcee),LL(0xe0581937,0x1edce948),LL(0x3dc44ba7,0xb57971a0)}, {LL(0x7050a144,0x5ee46e2d),LL(0x7f0503c6,0x9c2b8255),LL(0x043c6d8e,0x4bb884b1),LL(0x9b3e37c4,0x623e28d1)}},
+   {{LL(0x626b8ce0,0x49029c75),LL(0x678bf34f,0x19b3ff06),LL(0x133bcd39,0x3cb57e77),LL(0xdc3e587a,0xec392ec6)}, {LL(0x49f2d739,0xc395a117),LL(0x9986861a,0xc0466ece),LL(0x62a66dd6,0x5c16016d),LL(0x9cad568d,0x1d9e8f87)}},
+   {{LL(0x23fb88cf,0x33f42479),LL(0x1cd3b870,0xeb4ab0ae),LL(0x7e110de7,0x3328c1f3),LL(0x4ae4b7f9,0x41ed9f54)}, {LL(0x78d09d06,0x1b7aa62d),LL(0xd62046b9,0x359ce654),LL(0x82609eaf,0x813bd45a),LL(0x13ab7afc,0xee43af92)}},
+   {{LL(0x3995e24e,0x3d4d9363),LL(0x87679156,0xcc4604d3),LL(0x307ad7cc,0x3273115c),LL(0x36f18978,0xced496e3)}, {LL(0x88899d94,0xbe7f5fea),LL(0xd8ab9bb2,0xec1dd1b9),LL(0xc7185a1e,0x169cba6e),LL(0xc2fe7cfb,0x5ebb5d74)}},
+   {{LL(0xaf93525e,0x7a15ca9c),LL(0x4baeb655,0xa4c275c7),LL(0x4fb6a3d5,0x66cc5670),LL(0xc7715ec7,0x00e475d4)}, {LL(0xeb1ee413,0x762e1416),LL(0x529669b3,0x37d71458),LL(0x33bc086a,0xbd218876),LL(0xfffb762b,0x30fb48d0)}},
+   {{LL(0x8e7984c4,0xdfe279d1),LL(0x6c90a729,0xba796d59),LL(0x21e6fe2c,0xded8483d),LL(0x9c1b1b65,0x4dd40df2)}, {LL(0x91f01901,0x20d4a0e0),LL(0x61797145,0x3270e8af),LL(0x3e6068c1,0x0c34b8b0),LL(0xd1d1191c,0x53c39625)}},
+   {{LL(0xdab8d8c1,0x1188b62d),LL(0xef938a3e,0x579859a5),LL(0x54b98ebc,0x2354f6df),LL(0x2277d699,0xba3dea63)}, {LL(0xc0d4f5be,0x93262f88),LL(0xb740f726,0x490eb46b),LL(0x00078cb5,0x468a23cc),LL(0xfb271ef1,0xffe486a8)}},
+   {{LL(0x424ee919,0xe9f7337e),LL(0x01181883,0x346913a1),LL(0x529f2732,0xeac27013),LL(0x29b1e343,0x2ac27b5f)}, {LL(0xb57f76eb,0xa99b294b),LL(0x103a8c00,0x2047e83b),LL(0xd4a09274,0xb7397400),LL(0x2e77eb0b,0xe0f7697b)}},
+   {{LL(0x5fb1af90,0x6722d242),LL(0xa1d43674,0xd9eba73c),LL(0xdae9a905,0x721697d9),LL(0xe707cc47,0xbddd6a0f)}, {LL(0xb180b17b,0xf9e1e9a4),LL(0xcc8472f1,0x3c59a82d),LL(0xd6c4fec7,0xb0c76db5),LL(0x3b5434e0,0xc2d509da)}},
+   {{LL(0x1d115475,0x55032234),LL(0xa9e39373,0xdfd2cbca),LL(0x55f9e902,0xe84dee9c),LL(0xdb311cb7,0xc7d125b9)}, {LL(0x2c27f7e8,0x75c82961),LL(0x0e07432d,0xc62ab3df),LL(0xd1144836,0xfaa87567),LL(0xa804a2b4,0x6250fc18)}},
+   {{LL(0xd4886373,0xdcfc9892),LL(0x809eb8ba,0x5e1701b4),LL(0xa720176b,0x40ca5f69),LL(0x23fa56ae,0xd0b8b50d)}, {LL(0x202c28f9,0xb327a76c),LL(0x56949acd,0x765ea4d5),LL(0xe6798d93,0xf9fb5c07),LL(0x7adc6c91,0x5c3c3a51)}},
+   {{LL(0xe244c8a9,0xf645c66a),LL(0x25b462ab,0x1a736c85),LL(0x2ec11347,0x7b213725),LL(0x0bd27419,0xe2ff44cb)}, {LL(0x0df26593,0x03abbef3),LL(0x36a220b1,0xa0035b92),LL(0xd2a170de,0x7473526e),LL(0x8abd53be,0xb9eb8232)}},
+   {{LL(0x8dbebaf9,0xb05aa09c),LL(0xa08c3acb,0x438ea5d7),LL(0x5b01559d,0x44f39f3d),LL(0x3f9932c3,0x6f30bd02)}, {LL(0x0a64c736,0xc20b7760),LL(0xf6d83bd4,0x3f608051),LL(0x55c50b97,0x63020c4f),LL(0x91da18b2,0x0cc912eb)}},
+   {{LL(0x786f9394,0x6c0b8164),LL(0xced2ab51,0x09091f1b),LL(0x4e7f5100,0xf17ec790),LL(0xa1d89307,0x4e18df09)}, {LL(0x8318afb6,0xa8eae341),LL(0x84ee40b6,0x8c990c68),LL(0x9c72e42a,0x3384becb),LL(0x72226960,0x71774ea4)}},
+   {{LL(0xf0786e7e,0xec5c9f83),LL(0xee8ccaef,0x82e16c7e),LL(0xfa6a181b,0xadfb6ac5),LL(0x5c9e86d2,0x7bd9cba2)}, {LL(0x024b1a88,0xe58392f4),LL(0xdd0a6b8c,0x89c423a1),LL(0xc4668560,0xad41f013),LL(0x7263036f,0x60ab99e0)}},
+   {{LL(0xec8779ce,0x15e05dee),LL(0x54de6b48,0xf95f48c3),LL(0x1b5c7ef4,0x09b22e51),LL(0x61713808,0x3123879c)}, {LL(0xd5913d0a,0xb91bcf85),LL(0xa91a7b1c,0x8f67fd4c),LL(0x0441faab,0x34f86107),LL(0xd2209971,0x9d3c3339)}},
+   {{LL(0x31fc88ea,0x2ac3f792),LL(0xef833e13,0xd40ebf43),LL(0xdb484160,0xe110446a),LL(0x98aa62d8,0x026f110e)}, {LL(0xe1366705,0x0fb9b490),LL(0xb4ad2363,0x4d121771),LL(0xb83acedc,0x3476d535),LL(0x1ccdbd9a,0x6ff4ff08)}},
+   {{LL(0xac961ef6,0xb058e569),LL(0xc66a355e,0x5428e29f),LL(0x68a5b0c3,0x370e47f3),LL(0xc1425d7c,0x1094970a)}, {LL(0x232a70f0,0xac191426),LL(0x39dc20db,0xddb70784),LL(0xcf72cc48,0x3e98b438),LL(0x61a48490,0x1523aa29)}},
+   {{LL(0x2845faea,0x109114ad),LL(0xf0da51ff,0x63c34378),LL(0xd1d90842,0x14cbabfb),LL(0x09e5e9d3,0xf649072f)}, {LL(0x69b2c034,0x0eb5e7a6),LL(0x51dd87d0,0x115bcf0d),LL(0x4d29b7c3,0x5c1fbc4a),LL(0x4ea5725f,0x1edc5e94)}},
+   {{LL(0xfd331811,0x3ce8f340),LL(0x1ea06cbd,0x64a8c2ed),LL(0x8aba2f05,0xe3ad4d05),LL(0xb4e9feea,0x872b3a5b)}, {LL(0x28600bee,0x810b3e1e),LL(0xf44f84de,0xa51351d1),LL(0x4604e530,0x17ebbb2a),LL(0xb1e4c14e,0xe92dee99)}},
+   {{LL(0xbd61026e,0x7cc74171),LL(0x66478b41,0xfca1c17b),LL(0x775c1a86,0x20360187),LL(0x97f2aae4,0x3f7016a5)}, {LL(0x1f202b1f,0x27f3dbee),LL(0x0d959d45,0x39bd5c20),LL(0xed81b019,0x1cb20f12),LL(0x00f58a22,0x210837c6)}},
+   {{LL(0xcec3da79,0x8deac303),LL(0x956a1fdf,0x0178d464),LL(0x8af66fc3,0x1a766146),LL(0x3fb0f74e,0x7749559e)}, {LL(0xa9077c1e,0x95130f65),LL(0xe913557b,0x117b1971),LL(0xf2a59c13,0xd949defb),LL(0x7ff97e9a,0x9a5c6aff)}},
+   {{LL(0xbb01b65f,0xb247dda3),LL(0x178966cf,0xb2e48709),LL(0xb1c86618,0xaa7ca99a),LL(0xd443884a,0x1264a376)}, {LL(0xd9181e7e,0x0c7a8c36),LL(0xf7e010b0,0xf7cf114a),LL(0x5048dcc6,0xcf1a1239),LL(0xef9a7351,0x351c936c)}},
+   {{LL(0x40589bcd,0x481e3b38),LL(0x029604ff,0x44f71fe6),LL(0xfaf77b64,0x3495872c),LL(0xa8394ecb,0x278a9021)}, {LL(0x71750c69,0xf1de236a),LL(0xc5f5edc4,0x6fcd8ec7),LL(0xf552e32e,0x1e7cd58b),LL(0xd439b5c3,0xcdb1fbd4)}},
+   {{LL(0x722d333c,0xd19b1218),LL(0x14cc15bc,0xc1c5545d),LL(0x2d6961f7,0x153fb069),LL(0x0bfae7d2,0xafbe861a)}, {LL(0x43c1f96f,0x73f6e3b5),LL(0xb464bf7f,0x0c2a19c7),LL(0x723c069e,0x4e136273),LL(0x73aa9c7e,0x7af33205)}},
+   {{LL(0xc04c1409,0xfe7bc499),LL(0x75656103,0x2b709cff),LL(0xb66287ae,0x992eccd5),LL(0xa495b252,0x609f4938)}, {LL(0x7f198ffa,0x95a54f68),LL(0x15cd5f2f,0x88d66d4a),LL(0x00fe8854,0xaf7add59),LL(0xda39f6b4,0x354ace25)}},
+   {{LL(0x231355da,0xb893c193),LL(0xc3a61b0d,0xd19692f4),LL(0x841bd084,0x1fb41900),LL(0x99fa623f,0x4c1328b3)}, {LL(0x315f55a2,0x34ac13bc),LL(0x4904ce04,0xe573caa7),LL(0x349a680a,0x2efb8212),LL(0x2321114e,0xfd99a1c0)}},
+   {{LL(0x37d2510a,0x6a8c60ff),LL(0xee4c14f9,0x7e733455),LL(0xeefc7307,0xeb787ce9),LL(0x37dd0c04,0x43bc32f0)}, {LL(0x4d89f9e8,0xfa9059b6),LL(0x01bbdb9a,0x65cb859a),LL(0x0c0f3386,0xb795f46e),LL(0x8a47db91,0x09ba1c0c)}},
+   {{LL(0xdd492207,0xcdbf0030),LL(0x48497323,0xd685e623),LL(0xea9918b9,0x2471773a),LL(0xb89770fb,0x3dd61be3)}, {LL(0x425f87f4,0x612428ec),LL(0x2029ebe0,0x8f2082fb),LL(0x5916c120,0xd27e0f6c),LL(0xecaefc8c,0xb948582c)}},
+   {{LL(0x94a8628e,0xe2dcfa12),LL(0x8889f9ea,0x601dc8f1),LL(0x94b50936,0x1c71f133),LL(0xfe553f41,0x764c7d7b)}, {LL(0x830f08d9,0x08dc3ceb),LL(0xf60de532,0x74408a61),LL(0x6cb9fc30,0x9d44f381),LL(0xd3741dc6,0x972ee9ea)}},
+   {{LL(0xd864cd3a,0x371f6d3b),LL(0xea94c6a2,0x1f628980),LL(0xafd61b4d,0xb62e5798),LL(0x8c535ee9,0x6348c340)}, {LL(0xcaeefb6d,0x175621ac),LL(0x8df327d2,0xaaa0950a),LL(0xc60ab390,0xcb46ed85),LL(0x3effb324,0xe21401b4)}},
+   {{LL(0x53e59c03,0x35acfc1f),LL(0x40e8d60c,0x825d2e68),LL(0x5c000ca5,0xd9ef7b48),LL(0x48ec5813,0x18581484)}, {LL(0xcefbe47e,0x15ddefea),LL(0xbf152440,0x05b82ee1),LL(0xf4649f36,0x4d7fb6ea),LL(0x84cadc5a,0xe84861b4)}},
+   {{LL(0xc959357a,0xd7fa9e3c),LL(0x385ecae1,0x5d60c2d4),LL(0x1bb06481,0x227f215b),LL(0x40cb2dcc,0xe1d35d20)}, {LL(0x7e1a3992,0x2e5b031b),LL(0xe4120939,0x322bdc12),LL(0x3e5d9f61,0x59b5f124),LL(0x3819354e,0xe78a19a0)}},
+   {{LL(0xbacafdae,0x9db50e44),LL(0x142efb5a,0xe8536e74),LL(0x58373a94,0xf04fb4e2),LL(0x092dc02c,0xcdd924ca)}, {LL(0xcbbcdb65,0x131a5e7a),LL(0x2d9405d9,0x203625aa),LL(0x89034b07,0x65129e0a),LL(0x11ae8d60,0x614c9cbb)}},
+   {{LL(0xa20c3c53,0xd3f6c8c9),LL(0x86a84ad8,0xe11c2fd6),LL(0x93bfe2d1,0xfe3aab71),LL(0x7e06d803,0xf90be7fc)}, {LL(0x153c1588,0x655c11f8),LL(0xd3e4228a,0x8fec9d8d),LL(0x996baf09,0xf9bff0c5),LL(0xb4f1fd53,0xd05f7c6a)}},
+   {{LL(0x9efe10b8,0x95568dc9),LL(0xf0282be7,0x0455a8aa),LL(0x038c6cce,0x4499d3ea),LL(0x2be4ebf9,0x637f15f0)}, {LL(0xf6896087,0x82aa3245),LL(0xbd672455,0x76bc04cf),LL(0x55de7e9d,0x9d1766ec),LL(0xd4df328f,0xae96c22b)}},
+   {{LL(0x8ac43533,0x68f04f9c),LL(0xdc71601f,0x8c25092b),LL(0x50f6a62f,0x6159b029),LL(0x2642d8ba,0x74f1e62e)}, {LL(0x0114b537,0x141b486f),LL(0x45370c40,0x62769038),LL(0x21052eda,0x6135b74f),LL(0x11962c1e,0x5e3949a7)}},
+}
+};
+#endif /* _DISABLE_ECP_256K1_HARDCODED_BP_TBL_ */
+#endif  /* _IPP_DATA */
+
+
+IPP_OWN_DEFN (const cpPrecompAP*, gfpec_precom_secp256k1_fun, (void))
+{
+   static cpPrecompAP t = {
+      /* w */                  7,
+      /* select function */    p256r1_select_ap_w7,
+      /* precomputed data */   (BNU_CHUNK_T*)ec_p256k1_precomputed
+   };
+   return &t;
+}
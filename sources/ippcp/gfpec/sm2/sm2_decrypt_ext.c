@@ -146,27 +146,12 @@ IPPFUN(IppStatus, ippsGFpECDecryptSM2_Ext, (Ipp8u *pOut, int maxOutLen,
          cpSM2KE_reverse_inplace((Ipp8u *)pX, elemBytes);
          cpSM2KE_reverse_inplace((Ipp8u *)pY, elemBytes);
 
-         /* step 4 (standard): t = KDF(x2 || y2, klen) */
-         KDF_sm3(pOut, ciph_msg_size, (Ipp8u *)pBuff, 2 * elemBytes);
-
-         /* step 5 (standard): M` = C2 (x) t */
-         for (int i = 0; i < ciph_msg_size; ++i) {
-            pOut[i] = pOut[i] ^ pC2[i];
-         }
-
-         /* step 6 (standard): u = Hash(x2 || M` || y2) */
-         static IppsHashState_rmf ctx;
-
+         /* step 4 (standard): t = KDF(x2 || y2, klen)
+          * step 5 (standard): M` = C2 (x) t
+          * step 6 (standard): u = Hash(x2 || M` || y2)
+          */
          Ipp8u u[IPP_SM3_DIGEST_BYTESIZE];
-         ippsHashInit_rmf(&ctx, ippsHashMethod_SM3());
-         /* x2 */
-         ippsHashUpdate_rmf((Ipp8u *)pX, elemBytes, &ctx);
-         /* M */
-         ippsHashUpdate_rmf(pOut, ciph_msg_size, &ctx);
-         /* y2 */
-         ippsHashUpdate_rmf((Ipp8u *)pY, elemBytes, &ctx);
-         /* C3 */
-         ippsHashFinal_rmf(u, &ctx);
+         KDF_xor_hash_sm3(pOut, pC2, ciph_msg_size, u, (Ipp8u *)pX, (Ipp8u *)pY, elemBytes, 1);
 
          if (0 == EquBlock(u, pC3, IPP_SM3_DIGEST_BYTESIZE)) {
             PurgeBlock(pOut, ciph_msg_size);
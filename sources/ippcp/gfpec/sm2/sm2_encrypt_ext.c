@@ -148,7 +148,6 @@ IPPFUN(IppStatus, ippsGFpECEncryptSM2_Ext, (Ipp8u *pOut, int maxOutLen,
 
       /* step 4: [k]Pb = (x2,y2) */
       ippsGFpECMulPoint(pPublicKey, pEphPrvKey, &R, pEC, pScratchBuffer);
-      /* step 5: t = KDF(x2||y2, klen) */
       BNU_CHUNK_T *pBuff = cpGFpGetPool(2, pME);
 
       pX = pBuff;
@@ -161,25 +160,11 @@ IPPFUN(IppStatus, ippsGFpECEncryptSM2_Ext, (Ipp8u *pOut, int maxOutLen,
       cpSM2KE_reverse_inplace((Ipp8u *)pX, elemBytes);
       cpSM2KE_reverse_inplace((Ipp8u *)pY, elemBytes);
 
-      KDF_sm3(pC2, ciph_msg_size, (Ipp8u *)pBuff, 2 * elemBytes);
-
-      /* step 6: C2 = M (x) t */
-      for (int i = 0; i < ciph_msg_size; ++i) {
-         pC2[i] = pC2[i] ^ pInp[i];
-      }
-
-      /* step 7: C3 = Hash(x2 || M || y2) */
-      static IppsHashState_rmf ctx;
-
-      ippsHashInit_rmf(&ctx, ippsHashMethod_SM3());
-      /* x2 */
-      ippsHashUpdate_rmf((Ipp8u *)pX, elemBytes, &ctx);
-      /* M */
-      ippsHashUpdate_rmf(pInp, ciph_msg_size, &ctx);
-      /* y2 */
-      ippsHashUpdate_rmf((Ipp8u *)pY, elemBytes, &ctx);
-      /* C3 */
-      ippsHashFinal_rmf(pC3, &ctx);
+      /* step 5: t = KDF(x2||y2, klen)
+       * step 6: C2 = M (x) t
+       * step 7: C3 = Hash(x2 || M || y2)
+       */
+      KDF_xor_hash_sm3(pC2, pInp, ciph_msg_size, pC3, (Ipp8u *)pX, (Ipp8u *)pY, elemBytes, 0);
 
       /* set output size data */
       if (sts == ippStsNoErr) {
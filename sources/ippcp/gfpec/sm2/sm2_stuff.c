@@ -20,6 +20,7 @@
 #include "hash/pcphash.h"
 #include "hash/pcphash_rmf.h"
 #include "pcptool.h"
+#include "hash/sm3/pcpsm3stuff.h"
 
 #include "gfpec/sm2/sm2_stuff.h"
 
@@ -105,6 +106,93 @@ __IPPCP_INLINE void convert_ct_to_big_endian(Ipp8u pCt[SIZE_CT], const Ipp32u ct
    return;
 }
 
+/* number of counter blocks of KDF computed at once */
+#define KDF_LANES (8)
+
+/* KDF precomputation: Hai = SM3(Z || ct) differ in the last block(s) only */
+typedef struct {
+   Ipp32u hash[IPP_SM3_DIGEST_BYTESIZE / sizeof(Ipp32u)]; /* SM3 state after the whole blocks of Z */
+   Ipp8u tail[2 * MBS_SM3];                               /* rest of Z || ct || padding */
+   int tailLen;                                           /* tail length: 1 or 2 message blocks */
+   int ctPos;                                             /* position of ct inside the tail */
+} sm2_kdf_ctx;
+
+__IPPCP_INLINE void sm2_kdf_init(sm2_kdf_ctx *pCtx, const Ipp8u *pZ, const int z_len)
+{
+   const int fullLen = z_len & ~(MBS_SM3 - 1);
+   const int restLen = z_len - fullLen;
+   const Ipp64u bitLen = (Ipp64u)(z_len + SIZE_CT) * 8;
+
+   CopyBlock(sm3_iv, pCtx->hash, (int)sizeof(pCtx->hash));
+   if (fullLen > 0) {
+#if (_IPP32E >= _IPP32E_L9)
+      if (IsFeatureEnabled(ippCPUID_AVX2SM3))
+         UpdateSM3ni(pCtx->hash, pZ, fullLen, sm3_cnt);
+      else
+#endif
+         UpdateSM3(pCtx->hash, pZ, fullLen, sm3_cnt);
+   }
+
+   /* tail = rest of Z || ct || 0x80 || 0..0 || bit length of (Z || ct) */
+   PadBlock(0, pCtx->tail, (int)sizeof(pCtx->tail));
+   CopyBlock(pZ + fullLen, pCtx->tail, restLen);
+   pCtx->ctPos                   = restLen;
+   pCtx->tail[restLen + SIZE_CT] = 0x80;
+   pCtx->tailLen                 = (restLen + SIZE_CT + 1 + MLR_SM3 <= MBS_SM3) ? MBS_SM3 : 2 * MBS_SM3;
+   ((Ipp64u *)(pCtx->tail + pCtx->tailLen - MLR_SM3))[0] = ENDIANNESS64(bitLen);
+}
+
+/**
+ * @brief compute nBlocks consecutive KDF blocks Ha(ct) || ... || Ha(ct + nBlocks - 1)
+ * @param [out] pKS     output (nBlocks * IPP_SM3_DIGEST_BYTESIZE bytes)
+ * @param [in]  ct      first counter
+ * @param [in]  nBlocks number of blocks (1 <= nBlocks <= KDF_LANES)
+ * @param [in]  pCtx    KDF precomputation
+ */
+static void sm2_kdf_blocks(Ipp8u *pKS, const Ipp32u ct, const int nBlocks, const sm2_kdf_ctx *pCtx)
+{
+   __ALIGN32 Ipp32u hash[KDF_LANES][IPP_SM3_DIGEST_BYTESIZE / sizeof(Ipp32u)];
+   __ALIGN32 Ipp8u msg[KDF_LANES * 2 * MBS_SM3];
+   const int tailLen = pCtx->tailLen;
+   int nLanes        = nBlocks;
+
+#if (_IPP32E >= _IPP32E_L9)
+   const int useSM3ni = IsFeatureEnabled(ippCPUID_AVX2SM3);
+   /* 8-lane processing costs the same for any number of blocks > 1 */
+   if (!useSM3ni && (nBlocks > 1))
+      nLanes = KDF_LANES;
+#endif
+
+   for (int n = 0; n < nLanes; ++n) {
+      CopyBlock(pCtx->hash, hash[n], (int)sizeof(hash[n]));
+      CopyBlock(pCtx->tail, msg + n * tailLen, tailLen);
+      convert_ct_to_big_endian(msg + n * tailLen + pCtx->ctPos, ct + (Ipp32u)n);
+   }
+
+#if (_IPP32E >= _IPP32E_L9)
+   if (useSM3ni) {
+      for (int n = 0; n < nBlocks; ++n)
+         UpdateSM3ni(hash[n], msg + n * tailLen, tailLen, sm3_cnt);
+   } else if (nLanes == KDF_LANES) {
+      UpdateSM3_mb8(hash[0], msg, tailLen, sm3_cnt);
+   } else
+#endif
+   {
+      for (int n = 0; n < nBlocks; ++n)
+         UpdateSM3(hash[n], msg + n * tailLen, tailLen, sm3_cnt);
+   }
+
+   /* convert hash into big endian */
+   for (int n = 0; n < nBlocks; ++n) {
+      for (int i = 0; i < (int)(IPP_SM3_DIGEST_BYTESIZE / sizeof(Ipp32u)); ++i)
+         ((Ipp32u *)pKS)[n * 8 + i] = ENDIANNESS32(hash[n][i]);
+   }
+
+   /* clear stack data */
+   PurgeBlock(hash, (int)sizeof(hash));
+   PurgeBlock(msg, (int)sizeof(msg));
+}
+
 /**
  * @brief compute KDF base by SM3 hash
  * @param [out] pKDF    pointer output KDF
@@ -130,35 +218,17 @@ IPP_OWN_DEFN(IppStatus, KDF_sm3, (Ipp8u * pKDF, int kdf_len, const Ipp8u *pZ, co
 
    /* if kdf > 0 */
    if (kdf_len > 0) {
+      sm2_kdf_ctx kdf;
       /* buffer */
-      Ipp8u buff[IPP_SM3_DIGEST_BYTESIZE];
-
-      // step (a)
-      Ipp8u pCt[SIZE_CT];
-
-      const Ipp32u n = (Ipp32u)((kdf_len + IPP_SM3_DIGEST_BYTESIZE - 1) / IPP_SM3_DIGEST_BYTESIZE) + 1u; /* add 1 - loop start 1 */
+      __ALIGN32 Ipp8u buff[KDF_LANES * IPP_SM3_DIGEST_BYTESIZE];
 
-      /* init copy output len */
-      int num_copy = IPP_SM3_DIGEST_BYTESIZE;
-
-      static IppsHashState_rmf ctx;
-      ippsHashInit_rmf(&ctx, ippsHashMethod_SM3());
+      sm2_kdf_init(&kdf, pZ, z_len);
 
       /* compute length K = Ha1 || Ha2 || ... */
-      // step (b)
-      for (Ipp32u i = 1u; i < n; ++i) {
-         // step (b.1) -> Hai = H(Z || ct)
-         /* Z */
-         ippsHashUpdate_rmf(pZ, z_len, &ctx);
-         /* ct */
-         convert_ct_to_big_endian(pCt, i);
-         ippsHashUpdate_rmf(pCt, sizeof(pCt), &ctx);
-         /* auto init of end function - no need call in start loop */
-         ippsHashFinal_rmf(buff, &ctx);
-         /* copy result */
-         if ((i == n - 1u) && (0 != kdf_len % IPP_SM3_DIGEST_BYTESIZE)) {
-            num_copy = kdf_len % IPP_SM3_DIGEST_BYTESIZE;
-         }
+      for (Ipp32u ct = 1u; kdf_len > 0; ct += KDF_LANES) {
+         const int num_copy = IPP_MIN(kdf_len, (int)sizeof(buff));
+
+         sm2_kdf_blocks(buff, ct, (num_copy + IPP_SM3_DIGEST_BYTESIZE - 1) / IPP_SM3_DIGEST_BYTESIZE, &kdf);
          cpSM2_CopyBlock(pKDF, buff, num_copy);
 
          /* update copy next result */
@@ -167,11 +237,65 @@ IPP_OWN_DEFN(IppStatus, KDF_sm3, (Ipp8u * pKDF, int kdf_len, const Ipp8u *pZ, co
       }
 
       /* clear stack data */
-      PurgeBlock(buff, sizeof(buff));
-      PurgeBlock(pCt, sizeof(pCt));
+      PurgeBlock(buff, (int)sizeof(buff));
+      PurgeBlock(&kdf, (int)sizeof(kdf));
    }
 
    return ippStsNoErr;
 }
 
+/**
+ * @brief SM2 encryption/decryption data pass:
+ * pOut = pInp (x) KDF(x2 || y2, len) and pDigest = SM3(x2 || M || y2),
+ * where M is the plain text (pInp if encrypt, pOut if decrypt)
+ * @param [out] pOut       output text
+ * @param [in]  pInp       input text
+ * @param [in]  len        length of the text
+ * @param [out] pDigest    digest C3
+ * @param [in]  pX2        x2, KDF input Z = x2 || y2 is 2*elemBytes starting from pX2
+ * @param [in]  pY2        y2
+ * @param [in]  elemBytes  length of x2 (y2)
+ * @param [in]  hashOutput 0 - M is pInp (encrypt), otherwise M is pOut (decrypt)
+ */
+IPP_OWN_DEFN(void, KDF_xor_hash_sm3, (Ipp8u * pOut, const Ipp8u *pInp, int len, Ipp8u *pDigest,
+                                      const Ipp8u *pX2, const Ipp8u *pY2, const int elemBytes,
+                                      const int hashOutput))
+{
+   sm2_kdf_ctx kdf;
+   IppsHashState_rmf ctx;
+   __ALIGN32 Ipp8u buff[KDF_LANES * IPP_SM3_DIGEST_BYTESIZE];
+
+   sm2_kdf_init(&kdf, pX2, 2 * elemBytes);
+
+   ippsHashInit_rmf(&ctx, ippsHashMethod_SM3());
+   /* x2 */
+   ippsHashUpdate_rmf(pX2, elemBytes, &ctx);
+
+   /* keystream, xor and M hashing of the same chunk while it is in cache */
+   for (Ipp32u ct = 1u; len > 0; ct += KDF_LANES) {
+      const int chunk = IPP_MIN(len, (int)sizeof(buff));
+
+      sm2_kdf_blocks(buff, ct, (chunk + IPP_SM3_DIGEST_BYTESIZE - 1) / IPP_SM3_DIGEST_BYTESIZE, &kdf);
+      if (!hashOutput)
+         ippsHashUpdate_rmf(pInp, chunk, &ctx);
+      XorBlock(pInp, buff, pOut, chunk);
+      if (hashOutput)
+         ippsHashUpdate_rmf(pOut, chunk, &ctx);
+
+      pInp += chunk;
+      pOut += chunk;
+      len -= chunk;
+   }
+
+   /* y2 */
+   ippsHashUpdate_rmf(pY2, elemBytes, &ctx);
+   ippsHashFinal_rmf(pDigest, &ctx);
+
+   /* clear stack data */
+   PurgeBlock(buff, (int)sizeof(buff));
+   PurgeBlock(&kdf, (int)sizeof(kdf));
+   PurgeBlock(&ctx, (int)sizeof(ctx));
+}
+
+#undef KDF_LANES
 #undef SIZE_CT
@@ -166,6 +166,12 @@ IPP_OWN_DECL(IppStatus, computeZa_user_id_hash_sm2, (Ipp8u * pZa_digest,
 IPP_OWN_DECL(IppStatus, KDF_sm3, (Ipp8u * pKDF, int kdf_len,
                                   const Ipp8u* pZ, const int z_len))
 
+/* fused KDF sm3 keystream xor and C3 = SM3(x2 || M || y2) */
+#define KDF_xor_hash_sm3 OWNAPI(KDF_xor_hash_sm3)
+IPP_OWN_DECL(void, KDF_xor_hash_sm3, (Ipp8u * pOut, const Ipp8u* pInp, int len, Ipp8u* pDigest,
+                                      const Ipp8u* pX2, const Ipp8u* pY2, const int elemBytes,
+                                      const int hashOutput))
+
 /* IFMA optimization SM2 Key Exchange Shared Key */
 #define gfec_key_exchange_sm2_shared_key_avx512 OWNAPI(gfec_key_exchange_sm2_shared_key_avx512)
 
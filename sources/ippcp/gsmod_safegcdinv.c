@@ -0,0 +1,61 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive. Modular Arithmetic Engine. General Functionality
+//
+//  Contents:
+//        sgcd_mont_inv()
+//        sgcd_mont_inv_ct()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbnumisc.h"
+#include "pcpbnuarith.h"
+#include "gsmodstuff.h"
+
+/*
+// divsteps (safegcd) inversion in the form of almost Montgomery Inverse
+//
+// returns (k,r), r = (1/a)*(2^k) mod m, k = 2*mLen*BNU_CHUNK_BITS,
+// so gs_mont_inv() needs the single multiplication to get mont(1/a)
+//
+// (constant-execution-time version)
+*/
+IPP_OWN_DEFN (int, sgcd_mont_inv_ct, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pME))
+{
+   int mLen = MOD_LEN(pME);
+   int found = cpSafeGcdInv_BNU_ct(pr, pa, mLen, MOD_MNT_R2(pME), MOD_MODULUS(pME), mLen);
+   /* zero k if inversion not found */
+   return (2*mLen*BNU_CHUNK_BITS) & (-found);
+}
+
+/*
+// divsteps (safegcd) inversion in the form of almost Montgomery Inverse
+//
+// returns (k,r), r = (1/a)*(2^k) mod m, k = 2*mLen*BNU_CHUNK_BITS
+*/
+IPP_OWN_DEFN (int, sgcd_mont_inv, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pME))
+{
+   int mLen = MOD_LEN(pME);
+   if(!cpSafeGcdInv_BNU(pr, pa, mLen, MOD_MNT_R2(pME), MOD_MODULUS(pME), mLen))
+      return 0; /* inversion not found */
+   return 2*mLen*BNU_CHUNK_BITS;
+}
@@ -254,6 +254,7 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_redX, (BNU_CHUNK_T* pr, BNU_CHUNK_T*
  *   Length of pa data buffer:   modLen
  *   Length of pb data buffer:   modLen
  *   Memory size from the pool:  modLen * sizeof(BNU_CHUNK_T) * 2
+ *                               (+ KARATSUBA_POOL_LENGTH if available, for modLen >= KARATSUBA_THRESHOLD)
  */
 #if ((_IPP <_IPP_W7) && (_IPP32E <_IPP32E_M7))
 IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_mul, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, const BNU_CHUNK_T* pb, gsModEngine* pME))
@@ -262,6 +263,25 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_mul, (BNU_CHUNK_T* pr, const BNU_CHUN
    BNU_CHUNK_T m0 = MOD_MNT_FACTOR(pME);
    int mLen = MOD_LEN(pME);
 
+   /* Karatsuba product and separate reduction for the long operands */
+   if(mLen >= KARATSUBA_THRESHOLD) {
+      const int prodLength  = 2;
+      BNU_CHUNK_T* pProduct = gsModPoolAlloc(pME, prodLength);
+      BNU_CHUNK_T* pScratch;
+      if(NULL == pProduct)
+         return NULL;
+
+      /* schoolbook if the pool is exhausted */
+      pScratch = gsModPoolAlloc(pME, KARATSUBA_POOL_LENGTH);
+      cpMulLarge_BNU(pProduct, pa,mLen, pb,mLen, pScratch, pScratch? KARATSUBA_POOL_LENGTH*mLen : 0);
+      if(pScratch)
+         gsModPoolFree(pME, KARATSUBA_POOL_LENGTH);
+      gs_mont_red(pr, pProduct, pME);
+
+      gsModPoolFree(pME, prodLength);
+      return pr;
+   }
+
    const int polLength  = 1;
    BNU_CHUNK_T* pBuffer = gsModPoolAlloc(pME, polLength);
    if(NULL == pBuffer)
@@ -333,7 +353,15 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_mul, (BNU_CHUNK_T* pr, const BNU_CHUN
    if(NULL == pProduct)
       return NULL;
 
-   cpMulAdc_BNU_school(pProduct, pa,mLen, pb,mLen);
+   if(mLen >= KARATSUBA_THRESHOLD) {
+      /* schoolbook if the pool is exhausted */
+      BNU_CHUNK_T* pScratch = gsModPoolAlloc(pME, KARATSUBA_POOL_LENGTH);
+      cpMulLarge_BNU(pProduct, pa,mLen, pb,mLen, pScratch, pScratch? KARATSUBA_POOL_LENGTH*mLen : 0);
+      if(pScratch)
+         gsModPoolFree(pME, KARATSUBA_POOL_LENGTH);
+   }
+   else
+      cpMulAdc_BNU_school(pProduct, pa,mLen, pb,mLen);
    cpMontRedAdc_BNU(pr, pProduct, pm, mLen, m0);
 
    gsModPoolFree(pME, polLength);
@@ -352,7 +380,15 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_mulX, (BNU_CHUNK_T* pr, const BNU_CHU
    if(NULL == pProduct)
       return NULL;
 
-   cpMulAdx_BNU_school(pProduct, pa,mLen, pb,mLen);
+   if(mLen >= KARATSUBA_THRESHOLD) {
+      /* schoolbook if the pool is exhausted */
+      BNU_CHUNK_T* pScratch = gsModPoolAlloc(pME, KARATSUBA_POOL_LENGTH);
+      cpMulLarge_BNU(pProduct, pa,mLen, pb,mLen, pScratch, pScratch? KARATSUBA_POOL_LENGTH*mLen : 0);
+      if(pScratch)
+         gsModPoolFree(pME, KARATSUBA_POOL_LENGTH);
+   }
+   else
+      cpMulAdx_BNU_school(pProduct, pa,mLen, pb,mLen);
    cpMontRedAdx_BNU(pr, pProduct, pm, mLen, m0);
 
    gsModPoolFree(pME, polLength);
@@ -366,7 +402,8 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_mulX, (BNU_CHUNK_T* pr, const BNU_CHU
  * Requirements:
  *   Length of pr data buffer:   modLen
  *   Length of pa data buffer:   modLen
- *   Memory size from the pool:  modLen * sizeof(BNU_CHUNK_T)
+ *   Memory size from the pool:  modLen * sizeof(BNU_CHUNK_T) * 2
+ *                               (+ KARATSUBA_POOL_LENGTH if available, for modLen >= KARATSUBA_SQR_THRESHOLD)
  */
 IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_sqr, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pME))
 {
@@ -380,7 +417,15 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_sqr, (BNU_CHUNK_T* pr, const BNU_CHUN
    if(NULL == pProduct)
       return NULL;
 
-   cpSqrAdc_BNU_school(pProduct, pa,mLen);
+   if(mLen >= KARATSUBA_SQR_THRESHOLD) {
+      /* schoolbook if the pool is exhausted */
+      BNU_CHUNK_T* pScratch = gsModPoolAlloc(pME, KARATSUBA_POOL_LENGTH);
+      cpSqrLarge_BNU(pProduct, pa,mLen, pScratch, pScratch? KARATSUBA_POOL_LENGTH*mLen : 0);
+      if(pScratch)
+         gsModPoolFree(pME, KARATSUBA_POOL_LENGTH);
+   }
+   else
+      cpSqrAdc_BNU_school(pProduct, pa,mLen);
    cpMontRedAdc_BNU(pr, pProduct, pm, mLen, m0);
 
    gsModPoolFree(pME, polLength);
@@ -399,7 +444,15 @@ IPP_OWN_DEFN (static BNU_CHUNK_T*, gs_mont_sqrX, (BNU_CHUNK_T* pr, const BNU_CHU
    if(NULL == pProduct)
       return NULL;
 
-   cpSqrAdx_BNU_school(pProduct, pa,mLen);
+   if(mLen >= KARATSUBA_SQR_THRESHOLD) {
+      /* schoolbook if the pool is exhausted */
+      BNU_CHUNK_T* pScratch = gsModPoolAlloc(pME, KARATSUBA_POOL_LENGTH);
+      cpSqrLarge_BNU(pProduct, pa,mLen, pScratch, pScratch? KARATSUBA_POOL_LENGTH*mLen : 0);
+      if(pScratch)
+         gsModPoolFree(pME, KARATSUBA_POOL_LENGTH);
+   }
+   else
+      cpSqrAdx_BNU_school(pProduct, pa,mLen);
    cpMontRedAdx_BNU(pr, pProduct, pm, mLen, m0);
 
    gsModPoolFree(pME, polLength);
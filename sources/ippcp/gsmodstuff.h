@@ -145,6 +145,10 @@ IPP_OWN_FUNPTR (int, alm_inv, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngi
    IPP_OWN_DECL (int, alm_mont_inv, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pMA))
 #define alm_mont_inv_ct OWNAPI(alm_mont_inv_ct)
    IPP_OWN_DECL (int, alm_mont_inv_ct, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pMA))
+#define sgcd_mont_inv OWNAPI(sgcd_mont_inv)
+   IPP_OWN_DECL (int, sgcd_mont_inv, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pMA))
+#define sgcd_mont_inv_ct OWNAPI(sgcd_mont_inv_ct)
+   IPP_OWN_DECL (int, sgcd_mont_inv_ct, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pMA))
 #define gs_mont_inv OWNAPI(gs_mont_inv)
    IPP_OWN_DECL (BNU_CHUNK_T*, gs_mont_inv, (BNU_CHUNK_T* pr, const BNU_CHUNK_T* pa, gsModEngine* pMA, alm_inv invf))
 #define gs_inv OWNAPI(gs_inv)
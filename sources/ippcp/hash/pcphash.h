@@ -226,6 +226,10 @@ __IPPCP_INLINE IppHashAlgId cpValidHashAlg(IppHashAlgId algID)
 #endif
 #define UpdateSM3ni    OWNAPI(UpdateSM3ni)
    IPP_OWN_DECL (void, UpdateSM3ni, (void* pHash, const Ipp8u* mblk, int mlen, const void* pParam))
+#if (_IPP32E>=_IPP32E_L9)
+#define UpdateSM3_mb8  OWNAPI(UpdateSM3_mb8)
+   IPP_OWN_DECL (void, UpdateSM3_mb8, (Ipp32u* pHash, const Ipp8u* pMsg, int mlen, const void* pParam))
+#endif
 
 /* general methods */
 #define cpInitHash OWNAPI(cpInitHash)
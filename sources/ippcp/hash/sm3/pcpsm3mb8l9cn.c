@@ -0,0 +1,175 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Message block processing according to SM3, 8 independent streams
+//
+//  Contents:
+//     UpdateSM3_mb8()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "hash/pcphash.h"
+#include "pcptool.h"
+
+#if defined(_ENABLE_ALG_SM3_)
+
+#if (_IPP32E>=_IPP32E_L9)
+
+#define SM3_MB8_LANES (8)
+
+/* AVX2 has no vector rotate */
+#define ROL32_MB8(x, n) (_mm256_or_si256(_mm256_slli_epi32((x), (n)), _mm256_srli_epi32((x), 32-(n))))
+
+// boolean functions (0<=nr<16)
+#define FF1_MB8(x,y,z) (_mm256_xor_si256(_mm256_xor_si256((x),(y)),(z)))
+#define GG1_MB8(x,y,z) (_mm256_xor_si256(_mm256_xor_si256((x),(y)),(z)))
+// boolean functions (16<=nr<64)
+#define FF2_MB8(x,y,z) (_mm256_or_si256(_mm256_and_si256((x),_mm256_or_si256((y),(z))), _mm256_and_si256((y),(z))))
+#define GG2_MB8(x,y,z) (_mm256_or_si256(_mm256_and_si256((x),(y)), _mm256_andnot_si256((x),(z))))
+
+// P0 permutation:
+#define P0_MB8(x) (_mm256_xor_si256(_mm256_xor_si256((x), ROL32_MB8((x),9)), ROL32_MB8((x),17)))
+// P1 permutation:
+#define P1_MB8(x) (_mm256_xor_si256(_mm256_xor_si256((x), ROL32_MB8((x),15)), ROL32_MB8((x),23)))
+
+#define SM3_STEP_MB8(A,B,C,D,E,F,G,H, FF,GG, W,Tj, r) { \
+   __m256i A12 = ROL32_MB8(A, 12); \
+   __m256i SS1 = ROL32_MB8(_mm256_add_epi32(_mm256_add_epi32(A12, E), _mm256_set1_epi32((Ipp32s)(Tj)[(r)])), 7); \
+   __m256i SS2 = _mm256_xor_si256(SS1, A12); \
+   __m256i TT1 = _mm256_add_epi32(_mm256_add_epi32(FF(A,B,C), D), \
+                                  _mm256_add_epi32(SS2, _mm256_xor_si256(W[(r)], W[(r)+4]))); \
+   __m256i TT2 = _mm256_add_epi32(_mm256_add_epi32(GG(E,F,G), H), \
+                                  _mm256_add_epi32(SS1, W[(r)])); \
+   D = C; \
+   C = ROL32_MB8(B, 9); \
+   B = A; \
+   A = TT1; \
+   H = G; \
+   G = ROL32_MB8(F, 19); \
+   F = E; \
+   E = P0_MB8(TT2); \
+}
+
+/* transpose 8x8 matrix of 32-bit words: X[i].dword[j] <-> X[j].dword[i] */
+__IPPCP_INLINE void sm3_transpose8x8(__m256i X[SM3_MB8_LANES])
+{
+   __m256i t0 = _mm256_unpacklo_epi32(X[0], X[1]);
+   __m256i t1 = _mm256_unpackhi_epi32(X[0], X[1]);
+   __m256i t2 = _mm256_unpacklo_epi32(X[2], X[3]);
+   __m256i t3 = _mm256_unpackhi_epi32(X[2], X[3]);
+   __m256i t4 = _mm256_unpacklo_epi32(X[4], X[5]);
+   __m256i t5 = _mm256_unpackhi_epi32(X[4], X[5]);
+   __m256i t6 = _mm256_unpacklo_epi32(X[6], X[7]);
+   __m256i t7 = _mm256_unpackhi_epi32(X[6], X[7]);
+
+   __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+   __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+   __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+   __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+   __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+   __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+   __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+   __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+   X[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+   X[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+   X[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+   X[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+   X[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+   X[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+   X[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+   X[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/*F*
+//    Name: UpdateSM3_mb8
+//
+// Purpose: Update 8 independent internal hashes, each by its own message stream.
+//
+// Parameters:
+//    pHash    pointer to in/out hashes (8 lanes, 8 words each, lane after lane)
+//    pMsg     pointer to message streams (8 lanes, mlen bytes each, lane after lane)
+//    mlen     length of every message stream (multiple by message block size)
+//    pParam   pointer to the SM3 additive constants
+//
+*F*/
+IPP_OWN_DEFN (void, UpdateSM3_mb8, (Ipp32u* pHash, const Ipp8u* pMsg, int mlen, const void* pParam))
+{
+   const Ipp32u* Tj = (const Ipp32u*)pParam;
+   const __m256i swapBytes = _mm256_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+                                              3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);
+   __m256i V[SM3_MB8_LANES];
+   __m256i W[68];
+   int lane, r, blk;
+
+   /* hash words across the lanes */
+   for(lane=0; lane<SM3_MB8_LANES; lane++)
+      V[lane] = _mm256_loadu_si256((const __m256i*)(pHash + lane*8));
+   sm3_transpose8x8(V);
+
+   for(blk=0; blk<mlen; blk+=MBS_SM3) {
+      __m256i A = V[0], B = V[1], C = V[2], D = V[3];
+      __m256i E = V[4], F = V[5], G = V[6], H = V[7];
+
+      /* load message words across the lanes (remember about endian) */
+      for(lane=0; lane<SM3_MB8_LANES; lane++) {
+         const Ipp8u* pBlk = pMsg + lane*mlen + blk;
+         W[lane]   = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(pBlk)), swapBytes);
+         W[lane+8] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(pBlk+32)), swapBytes);
+      }
+      sm3_transpose8x8(W);
+      sm3_transpose8x8(W+8);
+
+      /* expand message block */
+      for(r=16; r<68; r++) {
+         __m256i T = _mm256_xor_si256(_mm256_xor_si256(W[r-16], W[r-9]), ROL32_MB8(W[r-3], 15));
+         W[r] = _mm256_xor_si256(_mm256_xor_si256(P1_MB8(T), ROL32_MB8(W[r-13], 7)), W[r-6]);
+      }
+
+      for(r=0; r<16; r++)
+         SM3_STEP_MB8(A,B,C,D,E,F,G,H, FF1_MB8,GG1_MB8, W,Tj, r);
+      for(; r<64; r++)
+         SM3_STEP_MB8(A,B,C,D,E,F,G,H, FF2_MB8,GG2_MB8, W,Tj, r);
+
+      /* update hash */
+      V[0] = _mm256_xor_si256(V[0], A);
+      V[1] = _mm256_xor_si256(V[1], B);
+      V[2] = _mm256_xor_si256(V[2], C);
+      V[3] = _mm256_xor_si256(V[3], D);
+      V[4] = _mm256_xor_si256(V[4], E);
+      V[5] = _mm256_xor_si256(V[5], F);
+      V[6] = _mm256_xor_si256(V[6], G);
+      V[7] = _mm256_xor_si256(V[7], H);
+   }
+
+   sm3_transpose8x8(V);
+   for(lane=0; lane<SM3_MB8_LANES; lane++)
+      _mm256_storeu_si256((__m256i*)(pHash + lane*8), V[lane]);
+
+   /* clear stack data */
+   PurgeBlock(W, sizeof(W));
+}
+
+#endif /* _IPP32E>=_IPP32E_L9 */
+
+#endif /* _ENABLE_ALG_SM3_ */
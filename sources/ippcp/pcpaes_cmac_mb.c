@@ -0,0 +1,267 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-CMAC Functions
+//
+//  Contents:
+//        ippsAES_CMAC_MB()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpcmac.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "aes_cmac_mb.h"
+
+#if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+#  include "pcprijtables.h"
+#endif
+
+/* Work Load Size from Buffers */
+#define WORKLOAD_LINES_16 (AES_MB_MAX_KERNEL_SIZE)    /* size 16 */
+#define WORKLOAD_LINES_4 (AES_MB_MAX_KERNEL_SIZE / 4) /* size  4 */
+
+/*
+// Prepares the last block of the message (padded and masked by k1 or k2 subkey).
+// Returns length of the message part preceding the last block.
+*/
+static int cmac_last_block(Ipp8u pLast[MBS_RIJ128], const Ipp8u* pSrc, int len, const IppsAES_CMACState* pState)
+{
+   int bodyLen = len ? (len-1) & ~(MBS_RIJ128-1) : 0;
+   int tailLen = len - bodyLen;
+
+   /* message length is divided by MBS_RIJ128 */
+   if(MBS_RIJ128==tailLen) {
+      XorBlock16(pSrc+bodyLen, CMAC_K1(pState), pLast);
+   }
+   /* message length isn't divided by MBS_RIJ128 */
+   else {
+      if(tailLen)
+         CopyBlock(pSrc+bodyLen, pLast, tailLen);
+      PadBlock(0, pLast+tailLen, MBS_RIJ128-tailLen);
+      pLast[tailLen] = 0x80;
+      XorBlock16(pLast, CMAC_K2(pState), pLast);
+   }
+
+   return bodyLen;
+}
+
+static void cmac_processing(Ipp8u* pMac, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES)
+{
+   /* setup encoder method */
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+
+   for(; len>0; len-=MBS_RIJ128, pSrc+=MBS_RIJ128) {
+      XorBlock16(pSrc, pMac, pMac);
+
+      #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+      encoder(pMac, pMac, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+      #else
+      encoder(pMac, pMac, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+      #endif
+   }
+}
+
+/*F*
+//    Name: ippsAES_CMAC_MB
+//
+// Purpose: Computes AES-CMAC of a number of independent messages
+//          under the key of the CMAC context.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc == NULL
+//                            len == NULL
+//                            pMD == NULL
+//                            status == NULL
+//                            pState == NULL
+//    ippStsContextMatchErr   !VALID_AESCMAC_ID()
+//    ippStsLengthErr         MBS_RIJ128 < mdLen <1
+//                            numBuffers <1
+//    ippStsErr               one or more of the buffers are not valid,
+//                            check status array for details:
+//       ippStsNullPtrErr        pMD[i] == NULL
+//                               pSrc[i] == NULL and len[i] >0
+//       ippStsLengthErr         len[i] <0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        array of pointers to the messages
+//    len         array of the message lengths
+//    pMD         array of pointers to the output message digests
+//    mdLen       requested length of the message digests
+//    status      array of statuses of the buffers
+//    numBuffers  number of the messages
+//    pState      pointer to the CMAC context
+//
+// Note:
+//    The context is used as a prepared key (cipher and k1/k2 subkeys computed by
+//    ippsAES_CMACInit()) and is not modified, neither the data accumulated by
+//    ippsAES_CMACUpdate() is involved. No buffer is processed if any of them
+//    is not valid.
+//    The CBC chains of the messages are interleaved across the AES-NI/VAES
+//    pipelines, so the messages of equal length are processed most efficiently.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_CMAC_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pMD[], int mdLen,
+                                   IppStatus status[], int numBuffers, const IppsAES_CMACState* pState))
+{
+   int i;
+
+   /* test context pointer and ID */
+   IPP_BAD_PTR1_RET(pState);
+   IPP_BADARG_RET(!VALID_AESCMAC_ID(pState), ippStsContextMatchErr);
+   /* test buffers */
+   IPP_BAD_PTR4_RET(pSrc, len, pMD, status);
+   IPP_BADARG_RET((mdLen<1)||(MBS_RIJ128<mdLen), ippStsLengthErr);
+   IPP_BADARG_RET((numBuffers<1), ippStsLengthErr);
+
+   {
+      int isAllBuffersValid = 1;
+      for(i=0; i<numBuffers; i++) {
+         if(NULL==pMD[i] || (len[i]>0 && NULL==pSrc[i]))
+            status[i] = ippStsNullPtrErr;
+         else if(len[i]<0)
+            status[i] = ippStsLengthErr;
+         else
+            status[i] = ippStsNoErr;
+
+         isAllBuffersValid &= (ippStsNoErr==status[i]);
+      }
+      IPP_BADARG_RET(!isAllBuffersValid, ippStsErr);
+   }
+
+   {
+      const IppsAESSpec* pAES = &CMAC_CIPHER(pState);
+
+      Ipp8u locMac[AES_MB_MAX_KERNEL_SIZE][MBS_RIJ128];
+      Ipp8u locLast[AES_MB_MAX_KERNEL_SIZE][MBS_RIJ128];
+      int buffersProcessed = 0;
+
+      #if (_AES_PROB_NOISE == _FEATURE_ON_)
+      /* Mistletoe3 mitigation: process the messages one by one */
+      const cpAESNoiseParams* params = (const cpAESNoiseParams*)&AESCMAC_NOISE_PARAMS(pState);
+      Ipp32u noiseRnd = AES_NOISE_RAND(params);
+      int isNoise = AES_NOISE_LEVEL(params) > 0;
+      #else
+      int isNoise = 0;
+      #endif
+
+      #if (_IPP32E>=_IPP32E_Y8)
+      if(AES_NI_ENABLED==RIJ_AESNI(pAES) && !isNoise) {
+         Ipp8u* loc_mac[AES_MB_MAX_KERNEL_SIZE];
+         const Ipp8u* loc_src[AES_MB_MAX_KERNEL_SIZE];
+         int loc_len[AES_MB_MAX_KERNEL_SIZE];
+
+         while(numBuffers > buffersProcessed) {
+            int workLoadSize = WORKLOAD_LINES_4;
+            #if (_IPP32E>=_IPP32E_K1)
+            if(IsFeatureEnabled(ippCPUID_AVX512VAES) && (numBuffers-buffersProcessed) > WORKLOAD_LINES_4)
+               workLoadSize = WORKLOAD_LINES_16;
+            #endif
+
+            /* every group of buffers starts from zero MACs */
+            PadBlock(0, locMac, sizeof(locMac));
+
+            /* fill buffers: all but the last blocks of the messages */
+            for(i=0; i<workLoadSize; i++) {
+               loc_mac[i] = locMac[i];
+
+               if(i >= (numBuffers-buffersProcessed)) {
+                  loc_src[i] = NULL;
+                  loc_len[i] = 0;
+                  continue;
+               }
+               loc_src[i] = pSrc[i + buffersProcessed];
+               loc_len[i] = cmac_last_block(locLast[i], pSrc[i + buffersProcessed], len[i + buffersProcessed], pState);
+            }
+
+            for(int pass=0; pass<2; pass++) {
+               #if (_IPP32E>=_IPP32E_K1)
+               if(WORKLOAD_LINES_16==workLoadSize)
+                  aes_cmac_vaes_mb16(loc_mac, loc_src, loc_len, RIJ_NR(pAES), (const Ipp32u*)RIJ_EKEYS(pAES));
+               else
+               #endif
+                  aes_cmac_aesni_mb4(loc_mac, loc_src, loc_len, RIJ_NR(pAES), (const Ipp32u*)RIJ_EKEYS(pAES));
+
+               /* second pass: the last blocks */
+               for(i=0; i<workLoadSize && i<(numBuffers-buffersProcessed); i++) {
+                  loc_src[i] = locLast[i];
+                  loc_len[i] = MBS_RIJ128;
+               }
+            }
+
+            /* return truncated DAC */
+            for(i=0; i<workLoadSize && i<(numBuffers-buffersProcessed); i++)
+               CopyBlock(locMac[i], pMD[i + buffersProcessed], mdLen);
+
+            buffersProcessed += workLoadSize;
+         }
+      }
+      #endif // (_IPP32E>=_IPP32E_Y8)
+
+      for(i=buffersProcessed; i<numBuffers; i++) {
+         int bodyLen = cmac_last_block(locLast[0], pSrc[i], len[i], pState);
+         PadBlock(0, locMac[0], MBS_RIJ128);
+
+         #if (_AES_PROB_NOISE == _FEATURE_ON_)
+         if(isNoise) {
+            const Ipp8u* pBody = pSrc[i];
+            /* Number of bytes allowed for operation without adding noise */
+            int chunk_size;
+            /* Number of bytes remaining for operation */
+            int remaining_size = bodyLen;
+
+            do {
+               chunk_size = (remaining_size >= MISTLETOE3_MAX_CHUNK_SIZE) ? MISTLETOE3_MAX_CHUNK_SIZE : remaining_size;
+
+               cmac_processing(locMac[0], pBody, chunk_size, pAES);
+
+               cpAESRandomNoise(NULL,
+                        MISTLETOE3_BASE_NOISE_LEVEL + AES_NOISE_LEVEL(params),
+                        MISTLETOE3_NOISE_RATE,
+                        &noiseRnd);
+
+               pBody += chunk_size;
+               remaining_size -= chunk_size;
+            } while (remaining_size > 0);
+         } else
+         #endif
+         {
+            cmac_processing(locMac[0], pSrc[i], bodyLen, pAES);
+         }
+
+         cmac_processing(locMac[0], locLast[0], MBS_RIJ128, pAES);
+
+         /* return truncated DAC */
+         CopyBlock(locMac[0], pMD[i], mdLen);
+      }
+
+      /* the last blocks are masked by the secret subkeys */
+      PurgeBlock(locLast, sizeof(locLast));
+      PurgeBlock(locMac, sizeof(locMac));
+
+      return ippStsNoErr;
+   }
+}
+
+#undef WORKLOAD_LINES_16
+#undef WORKLOAD_LINES_4
@@ -24,8 +24,6 @@
 //
 */
 
-#if 0 // Not used
-
 #if !defined(_CP_AES_GCM_VAES512_H)
 #define _CP_AES_GCM_VAES512_H
 
@@ -141,5 +139,3 @@ __IPPCP_INLINE void AggregateKaratsubaPartialProducts(const __m512i * const pH,
 #endif /* #if (_IPP32E>=_IPP32E_K1) */
 
 #endif /* _CP_AES_GCM_VAES512_H*/
-
-#endif
@@ -28,8 +28,6 @@
 #pragma warning(disable: 4206) // empty translation unit in MSVC
 #endif
 
-#if 0 // Not used
-
 #include "owncp.h"
 #include "pcpaesm.h"
 #include "pcpaes_encrypt_vaes512.h"
@@ -136,6 +134,7 @@ IPP_OWN_DEFN (void, AesGcmAuth_vaes, (Ipp8u* pGHash, const Ipp8u* pSrc, int len,
       ghash512 = _mm512_castsi128_si512(ghash128);
 
       pSrc512 += 3;
+      blocks -= (3 * 4);
    }
 
    if ((4 * 2) <= blocks) {
@@ -162,6 +161,7 @@ IPP_OWN_DEFN (void, AesGcmAuth_vaes, (Ipp8u* pGHash, const Ipp8u* pSrc, int len,
       ghash512 = _mm512_castsi128_si512(ghash128);
 
       pSrc512 += 2;
+      blocks -= (4 * 2);
    }
 
    for (; blocks >= 4; blocks -= 4) {
@@ -226,5 +226,3 @@ IPP_OWN_DEFN (void, AesGcmAuth_vaes, (Ipp8u* pGHash, const Ipp8u* pSrc, int len,
 }
 
 #endif /* #if (_IPP32E>=_IPP32E_K1) */
-
-#endif
@@ -28,8 +28,6 @@
 #pragma warning(disable: 4206) // empty translation unit in MSVC
 #endif
 
-#if 0 // Not used
-
 #include "owncp.h"
 #include "pcpaesm.h"
 #include "pcpaes_encrypt_vaes512.h"
@@ -237,5 +235,3 @@ IPP_OWN_DEFN (void, AesGcmPrecompute_vaes, (Ipp8u* const pHtbl, const Ipp8u* con
 }
 
 #endif /* #if (_IPP32E>=_IPP32E_K1) */
-
-#endif
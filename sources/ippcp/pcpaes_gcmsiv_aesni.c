@@ -0,0 +1,93 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV (RFC 8452) AES-CTR by AES-NI
+//
+//  Contents:
+//        cpAESGCMSIV_CTR_aesni()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcmsivstuff.h"
+
+#if (_IPP32E>=_IPP32E_Y8)
+
+/* 8 blocks are processed in parallel */
+#define GCMSIV_NBLOCKS (8)
+
+#define AESENC8(b_, key_) { \
+   b_[0] = _mm_aesenc_si128(b_[0], key_); \
+   b_[1] = _mm_aesenc_si128(b_[1], key_); \
+   b_[2] = _mm_aesenc_si128(b_[2], key_); \
+   b_[3] = _mm_aesenc_si128(b_[3], key_); \
+   b_[4] = _mm_aesenc_si128(b_[4], key_); \
+   b_[5] = _mm_aesenc_si128(b_[5], key_); \
+   b_[6] = _mm_aesenc_si128(b_[6], key_); \
+   b_[7] = _mm_aesenc_si128(b_[7], key_); \
+}
+
+/*
+// AES-CTR of the full blocks, 32-bit little-endian counter
+*/
+IPP_OWN_DEFN (void, cpAESGCMSIV_CTR_aesni, (Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks, int nr, const Ipp8u* pKeys, Ipp8u* pCtr))
+{
+   const __m128i one = _mm_setr_epi32(1, 0, 0, 0);
+   __m128i rKeys[15];
+   __m128i ctr = _mm_loadu_si128((const __m128i*)pCtr);
+   __m128i b[GCMSIV_NBLOCKS];
+   int i, r;
+
+   for(r=0; r<=nr; r++)
+      rKeys[r] = _mm_loadu_si128((const __m128i*)pKeys + r);
+
+   for(; nBlocks>=GCMSIV_NBLOCKS; nBlocks-=GCMSIV_NBLOCKS) {
+      for(i=0; i<GCMSIV_NBLOCKS; i++) {
+         b[i] = _mm_xor_si128(ctr, rKeys[0]);
+         ctr = _mm_add_epi32(ctr, one);
+      }
+      for(r=1; r<nr; r++)
+         AESENC8(b, rKeys[r]);
+      for(i=0; i<GCMSIV_NBLOCKS; i++) {
+         b[i] = _mm_aesenclast_si128(b[i], rKeys[nr]);
+         _mm_storeu_si128((__m128i*)pDst, _mm_xor_si128(b[i], _mm_loadu_si128((const __m128i*)pSrc)));
+         pSrc += MBS_RIJ128;
+         pDst += MBS_RIJ128;
+      }
+   }
+
+   for(; nBlocks>0; nBlocks--) {
+      b[0] = _mm_xor_si128(ctr, rKeys[0]);
+      ctr = _mm_add_epi32(ctr, one);
+      for(r=1; r<nr; r++)
+         b[0] = _mm_aesenc_si128(b[0], rKeys[r]);
+      b[0] = _mm_aesenclast_si128(b[0], rKeys[nr]);
+      _mm_storeu_si128((__m128i*)pDst, _mm_xor_si128(b[0], _mm_loadu_si128((const __m128i*)pSrc)));
+      pSrc += MBS_RIJ128;
+      pDst += MBS_RIJ128;
+   }
+
+   _mm_storeu_si128((__m128i*)pCtr, ctr);
+}
+
+#endif /* #if (_IPP32E>=_IPP32E_Y8) */
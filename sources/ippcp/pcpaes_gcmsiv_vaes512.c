@@ -0,0 +1,101 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV (RFC 8452) AES-CTR by VAES-512
+//
+//  Contents:
+//        cpAESGCMSIV_CTR_vaes512()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_encrypt_vaes512.h"
+#include "pcpaes_gcmsivstuff.h"
+
+#if (_IPP32E>=_IPP32E_K1)
+
+/*
+// AES-CTR of the full blocks, 32-bit little-endian counter in the first word of the counter block;
+// 4 blocks per 512-bit register, 16 blocks per iteration
+*/
+IPP_OWN_DEFN (void, cpAESGCMSIV_CTR_vaes512, (Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks, int nr, const Ipp8u* pKeys, Ipp8u* pCtr))
+{
+   int cipherRounds = nr - 1;
+   const __m128i* pRkey = (const __m128i*)pKeys;
+
+   /* counters of the 4 blocks of a register: ctr, ctr+1, ctr+2, ctr+3 */
+   __m512i ctr = _mm512_add_epi32(_mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)pCtr)),
+                                  _mm512_set_epi32(0,0,0,3, 0,0,0,2, 0,0,0,1, 0,0,0,0));
+   const __m512i inc4 = _mm512_set_epi32(0,0,0,4, 0,0,0,4, 0,0,0,4, 0,0,0,4);
+
+   __m512i* pSrc512 = (__m512i*)pSrc;
+   __m512i* pDst512 = (__m512i*)pDst;
+
+   Ipp32u ctr32 = (Ipp32u)pCtr[0] | ((Ipp32u)pCtr[1]<<8) | ((Ipp32u)pCtr[2]<<16) | ((Ipp32u)pCtr[3]<<24);
+   ctr32 += (Ipp32u)nBlocks;
+
+   for(; nBlocks>=(4*4); nBlocks-=(4*4)) {
+      __m512i blk0 = ctr;
+      __m512i blk1 = _mm512_add_epi32(blk0, inc4);
+      __m512i blk2 = _mm512_add_epi32(blk1, inc4);
+      __m512i blk3 = _mm512_add_epi32(blk2, inc4);
+      ctr = _mm512_add_epi32(blk3, inc4);
+
+      cpAESEncrypt4_VAES_NI(&blk0, &blk1, &blk2, &blk3, pRkey, cipherRounds);
+
+      _mm512_storeu_si512(pDst512,   _mm512_xor_si512(blk0, _mm512_loadu_si512(pSrc512)));
+      _mm512_storeu_si512(pDst512+1, _mm512_xor_si512(blk1, _mm512_loadu_si512(pSrc512+1)));
+      _mm512_storeu_si512(pDst512+2, _mm512_xor_si512(blk2, _mm512_loadu_si512(pSrc512+2)));
+      _mm512_storeu_si512(pDst512+3, _mm512_xor_si512(blk3, _mm512_loadu_si512(pSrc512+3)));
+
+      pSrc512 += 4;
+      pDst512 += 4;
+   }
+
+   for(; nBlocks>=4; nBlocks-=4) {
+      __m512i blk0 = ctr;
+      ctr = _mm512_add_epi32(ctr, inc4);
+
+      cpAESEncrypt1_VAES_NI(&blk0, pRkey, cipherRounds);
+      _mm512_storeu_si512(pDst512, _mm512_xor_si512(blk0, _mm512_loadu_si512(pSrc512)));
+
+      pSrc512 += 1;
+      pDst512 += 1;
+   }
+
+   /* at most 3 blocks left */
+   if(nBlocks) {
+      __mmask8 k8 = (__mmask8)((1 << (nBlocks + nBlocks)) - 1);  /* 64-bit chunks */
+      __m512i blk0 = ctr;
+
+      cpAESEncrypt1_VAES_NI(&blk0, pRkey, cipherRounds);
+      _mm512_mask_storeu_epi64(pDst512, k8, _mm512_xor_si512(blk0, _mm512_maskz_loadu_epi64(k8, pSrc512)));
+   }
+
+   pCtr[0] = (Ipp8u)ctr32;
+   pCtr[1] = (Ipp8u)(ctr32>>8);
+   pCtr[2] = (Ipp8u)(ctr32>>16);
+   pCtr[3] = (Ipp8u)(ctr32>>24);
+}
+
+#endif /* #if (_IPP32E>=_IPP32E_K1) */
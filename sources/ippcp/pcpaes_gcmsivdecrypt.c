@@ -0,0 +1,125 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        ippsAES_GCMSIVDecrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcmsivstuff.h"
+
+/*F*
+//    Name: ippsAES_GCMSIVDecrypt
+//
+// Purpose: RFC 8452 nonce misuse-resistant authenticated decryption (open)
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pKey == NULL, pNonce == NULL
+//                            pTag == NULL, pAuthPassed == NULL
+//                            pSrc == NULL or pDst == NULL, and len>0
+//                            pAAD == NULL and aadLen>0
+//    ippStsLengthErr         keyLen != 16
+//                            keyLen != 32
+//                            len<0
+//                            aadLen<0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to ciphertext
+//    pDst        pointer to plaintext
+//    len         length (in bytes) of ciphertext/plaintext
+//    pAuthPassed pointer to the authentication result: 1 if tag is valid, 0 otherwise
+//    pKey        pointer to the key generating key
+//    keyLen      length of the key
+//    pNonce      pointer to the nonce (12 bytes)
+//    pAAD        pointer to the additional authenticated data
+//    aadLen      length (in bytes) of the additional authenticated data
+//    pTag        pointer to the input tag (16 bytes)
+//
+// Note:
+//    The plaintext is zeroed if authentication fails.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCMSIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                         int* pAuthPassed,
+                                         const Ipp8u* pKey, int keyLen,
+                                         const Ipp8u* pNonce,
+                                         const Ipp8u* pAAD, int aadLen,
+                                         const Ipp8u* pTag))
+{
+   /* test ciphertext, plaintext and length */
+   IPP_BADARG_RET(0>len, ippStsLengthErr);
+   IPP_BADARG_RET(len && (!pSrc || !pDst), ippStsNullPtrErr);
+
+   /* test key, keyLen and nonce */
+   IPP_BAD_PTR2_RET(pKey, pNonce);
+   IPP_BADARG_RET(keyLen!=16 && keyLen!=32, ippStsLengthErr);
+
+   /* test passed flag & tag */
+   IPP_BAD_PTR2_RET(pAuthPassed, pTag);
+
+   /* test AAD */
+   IPP_BADARG_RET(0>aadLen, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+
+   {
+      cpAES_GCMSIV ctx;
+      __ALIGN16 Ipp8u hash[MBS_RIJ128];
+      Ipp8u ctr[MBS_RIJ128];
+      Ipp8u tag[MBS_RIJ128];
+      int processedLen;
+
+      /* per-nonce keys */
+      cpAESGCMSIV_Init(&ctx, pKey, keyLen, pNonce);
+
+      /* POLYVAL(AAD || ...) */
+      PadBlock(0, hash, MBS_RIJ128);
+      cpAESGCMSIV_Polyval(hash, pAAD, aadLen, &ctx);
+
+      /* initial counter is tag with the most significant bit set */
+      CopyBlock16(pTag, ctr);
+      ctr[MBS_RIJ128-1] |= 0x80;
+
+      /* perform AES-CTR decryption, POLYVAL(... || plaintext || ...) of the chunk while it is in cache */
+      for(processedLen=0; processedLen<len; processedLen+=GCMSIV_CHUNK_SIZE) {
+         int chunkLen = IPP_MIN(len-processedLen, GCMSIV_CHUNK_SIZE);
+         cpAESGCMSIV_CTR(pDst+processedLen, pSrc+processedLen, chunkLen, ctr, &ctx);
+         cpAESGCMSIV_Polyval(hash, pDst+processedLen, chunkLen, &ctx);
+      }
+
+      /* re-compute tag */
+      cpAESGCMSIV_Tag(tag, hash, aadLen, len, pNonce, &ctx);
+
+      /* test */
+      *pAuthPassed = EquBlock(pTag, tag, MBS_RIJ128);
+      if(!*pAuthPassed && len)
+         PurgeBlock(pDst, len);
+
+      PurgeBlock(&ctx, sizeof(ctx));
+      PurgeBlock(hash, sizeof(hash));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,107 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        ippsAES_GCMSIVEncrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcmsivstuff.h"
+
+/*F*
+//    Name: ippsAES_GCMSIVEncrypt
+//
+// Purpose: RFC 8452 nonce misuse-resistant authenticated encryption (seal)
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pKey == NULL, pNonce == NULL, pTag == NULL
+//                            pSrc == NULL or pDst == NULL, and len>0
+//                            pAAD == NULL and aadLen>0
+//    ippStsLengthErr         keyLen != 16
+//                            keyLen != 32
+//                            len<0
+//                            aadLen<0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc     pointer to plaintext
+//    pDst     pointer to ciphertext
+//    len      length (in bytes) of plaintext/ciphertext
+//    pTag     pointer to the output tag (16 bytes)
+//    pKey     pointer to the key generating key
+//    keyLen   length of the key
+//    pNonce   pointer to the nonce (12 bytes)
+//    pAAD     pointer to the additional authenticated data
+//    aadLen   length (in bytes) of the additional authenticated data
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCMSIVEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                               Ipp8u* pTag,
+                                         const Ipp8u* pKey, int keyLen,
+                                         const Ipp8u* pNonce,
+                                         const Ipp8u* pAAD, int aadLen))
+{
+   /* test plaintext, ciphertext and length */
+   IPP_BADARG_RET(0>len, ippStsLengthErr);
+   IPP_BADARG_RET(len && (!pSrc || !pDst), ippStsNullPtrErr);
+
+   /* test key, keyLen and nonce */
+   IPP_BAD_PTR2_RET(pKey, pNonce);
+   IPP_BADARG_RET(keyLen!=16 && keyLen!=32, ippStsLengthErr);
+
+   /* test output tag */
+   IPP_BAD_PTR1_RET(pTag);
+
+   /* test AAD */
+   IPP_BADARG_RET(0>aadLen, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+
+   {
+      cpAES_GCMSIV ctx;
+      __ALIGN16 Ipp8u hash[MBS_RIJ128];
+      Ipp8u ctr[MBS_RIJ128];
+
+      /* per-nonce keys */
+      cpAESGCMSIV_Init(&ctx, pKey, keyLen, pNonce);
+
+      /* POLYVAL(AAD || plaintext || lengths) */
+      PadBlock(0, hash, MBS_RIJ128);
+      cpAESGCMSIV_Polyval(hash, pAAD, aadLen, &ctx);
+      cpAESGCMSIV_Polyval(hash, pSrc, len, &ctx);
+
+      /* tag */
+      cpAESGCMSIV_Tag(ctr, hash, aadLen, len, pNonce, &ctx);
+      CopyBlock16(ctr, pTag);
+
+      /* perform AES-CTR encryption, initial counter is tag with the most significant bit set */
+      ctr[MBS_RIJ128-1] |= 0x80;
+      cpAESGCMSIV_CTR(pDst, pSrc, len, ctr, &ctx);
+
+      PurgeBlock(&ctx, sizeof(ctx));
+      PurgeBlock(hash, sizeof(hash));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,316 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        Stuff()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcpaesauthgcm.h"
+#include "pcptool.h"
+
+#if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+#  include "pcprijtables.h"
+#endif
+
+#if !defined(_PCP_AES_GCMSIV_STUFF_H_)
+#define _PCP_AES_GCMSIV_STUFF_H_
+
+#define GCMSIV_NONCE_LEN   (12)                 /* nonce length (bytes)                               */
+#define GCMSIV_TAG_LEN     (MBS_RIJ128)         /* tag length (bytes)                                 */
+#define GCMSIV_CHUNK_SIZE  (MBS_RIJ128*256)     /* text processed per pass of CTR and POLYVAL (fits L1) */
+#define GCMSIV_REV_BLKS    (32)                 /* blocks byte-reversed per call of the GHASH kernel  */
+
+/* size of the GHASH pre-computed data */
+#if(_IPP32E>=_IPP32E_K1)
+#define GCMSIV_PRECOMP_SIZE (MBS_RIJ128*32)     /* AesGcmPrecompute_vaes()    */
+#elif(_IPP32E>=_IPP32E_K0)
+#define GCMSIV_PRECOMP_SIZE (MBS_RIJ128*4)      /* AesGcmPrecompute_avx()     */
+#else
+#define GCMSIV_PRECOMP_SIZE (MBS_RIJ128*128)    /* AesGcmPrecompute_table2K() */
+#endif
+
+#if(_IPP32E>=_IPP32E_K0)
+/*
+// GHASH primitives shared with AES-GCM
+// (AVX-512 build of AES-GCM does not use them from pcpaesauthgcm.h)
+*/
+#define AesGcmPrecompute_avx OWNAPI(AesGcmPrecompute_avx)
+   IPP_OWN_DECL (void, AesGcmPrecompute_avx, (Ipp8u* pPrecomputeData, const Ipp8u* pHKey))
+#define AesGcmAuth_avx OWNAPI(AesGcmAuth_avx)
+   IPP_OWN_DECL (void, AesGcmAuth_avx, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
+#endif
+
+/* GHASH prototype: GHash = (GHash^src[])*HKey mod G(), len is multiple of MBS_RIJ128 */
+IPP_OWN_FUNPTR (void, GcmSivAuth_, (Ipp8u* pHash, const Ipp8u* pSrc, int len, const Ipp8u* pHKey, const void* pParam))
+
+/*
+// per-nonce context: derived message authentication and encryption keys
+//
+// POLYVAL is computed by the GHASH kernels of AES-GCM (RFC 8452, Appendix A):
+//    POLYVAL(H, X_1, ..., X_n) =
+//       ByteReverse(GHASH(mulX_GHASH(ByteReverse(H)), ByteReverse(X_1), ..., ByteReverse(X_n)))
+// so the POLYVAL accumulator is kept byte-reversed (GHASH form) till the tag computation.
+*/
+typedef struct _cpAES_GCMSIV {
+   __ALIGN16
+   Ipp8u       hTbl[GCMSIV_PRECOMP_SIZE];  /* GHASH pre-computed data of mulX_GHASH(ByteReverse(hKey)) */
+   GcmSivAuth_ authFun;                    /* GHASH kernel                                         */
+   const void* authParam;                  /* GHASH kernel parameter                               */
+   int         aesNI;                      /* AES-NI based CTR is available                        */
+   IppsAESSpec cipher;                     /* message encryption key                               */
+} cpAES_GCMSIV;
+
+#if (_IPP32E>=_IPP32E_Y8)
+#define cpAESGCMSIV_CTR_aesni OWNAPI(cpAESGCMSIV_CTR_aesni)
+   IPP_OWN_DECL (void, cpAESGCMSIV_CTR_aesni, (Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks, int nr, const Ipp8u* pKeys, Ipp8u* pCtr))
+#endif
+#if (_IPP32E>=_IPP32E_K1)
+#define cpAESGCMSIV_CTR_vaes512 OWNAPI(cpAESGCMSIV_CTR_vaes512)
+   IPP_OWN_DECL (void, cpAESGCMSIV_CTR_vaes512, (Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks, int nr, const Ipp8u* pKeys, Ipp8u* pCtr))
+#endif
+
+/* use carry-less multiplication for GHASH */
+__IPPCP_INLINE int cpAESGCMSIV_IsClmul(void)
+{
+   #if(_IPP32E>=_IPP32E_K0)
+   return 1;
+   #elif (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   return IsFeatureEnabled(ippCPUID_AES|ippCPUID_CLMUL);
+   #else
+   return 0;
+   #endif
+}
+
+__IPPCP_INLINE void cpAESGCMSIV_encryptBlock(Ipp8u* pDst, const Ipp8u* pSrc, const IppsAESSpec* pAES)
+{
+   /* setup encoder method */
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   encoder(pSrc, pDst, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+   #else
+   encoder(pSrc, pDst, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+   #endif
+}
+
+/*
+// pDst[i] = ByteReverse(pSrc[i]), i = 0, ..., nBlocks-1
+*/
+__IPPCP_INLINE void cpAESGCMSIV_ReverseBlocks(Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks)
+{
+   #if (_IPP32E>=_IPP32E_Y8)
+   const __m128i swapBytes = _mm_setr_epi8(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0);
+   for(; nBlocks>0; nBlocks--, pSrc+=MBS_RIJ128, pDst+=MBS_RIJ128)
+      _mm_storeu_si128((__m128i*)pDst, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)pSrc), swapBytes));
+   #else
+   int i;
+   for(; nBlocks>0; nBlocks--, pSrc+=MBS_RIJ128, pDst+=MBS_RIJ128) {
+      for(i=0; i<MBS_RIJ128/2; i++) {
+         Ipp8u t = pSrc[i];
+         pDst[i] = pSrc[MBS_RIJ128-1-i];
+         pDst[MBS_RIJ128-1-i] = t;
+      }
+   }
+   #endif
+}
+
+/*
+// pDst = mulX_GHASH(ByteReverse(pSrc)) (RFC 8452, Appendix A):
+// multiplication by x in the GHASH field is the right shift of the big-endian string
+*/
+__IPPCP_INLINE void cpAESGCMSIV_MulX(Ipp8u* pDst, const Ipp8u* pSrc)
+{
+   /* the bit shifted out is the least significant bit of ByteReverse(pSrc) */
+   Ipp8u mask = (Ipp8u)(0 - (pSrc[0] & 1));
+   int i;
+
+   for(i=MBS_RIJ128-1; i>0; i--)
+      pDst[i] = (Ipp8u)((pSrc[MBS_RIJ128-1-i]>>1) | (pSrc[MBS_RIJ128-i]<<7));
+   pDst[0] = (Ipp8u)((pSrc[MBS_RIJ128-1]>>1) ^ (mask & 0xE1));
+}
+
+/*
+// derives the per-nonce keys (RFC 8452, 4.) and setups the context
+*/
+__IPPCP_INLINE void cpAESGCMSIV_Init(cpAES_GCMSIV* pCtx, const Ipp8u* pKey, int keyLen, const Ipp8u* pNonce)
+{
+   Ipp8u blocks[6*MBS_RIJ128];
+   Ipp8u keys[6*MBS_RIJ128/2];
+   Ipp8u hKey[MBS_RIJ128];
+   int nBlocks = (16==keyLen)? 4 : 6;
+   int n;
+
+   /* blocks[n] = LE32(n) || nonce */
+   for(n=0; n<nBlocks; n++) {
+      Ipp8u* pBlk = blocks + n*MBS_RIJ128;
+      pBlk[0] = (Ipp8u)n;
+      pBlk[1] = pBlk[2] = pBlk[3] = 0;
+      CopyBlock(pNonce, pBlk+4, GCMSIV_NONCE_LEN);
+   }
+
+   /* key generating key */
+   ippsAESInit(pKey, keyLen, &pCtx->cipher, sizeof(pCtx->cipher));
+   ippsAESEncryptECB(blocks, blocks, nBlocks*MBS_RIJ128, &pCtx->cipher);
+
+   /* first halves of the encrypted blocks */
+   for(n=0; n<nBlocks; n++)
+      CopyBlock(blocks + n*MBS_RIJ128, keys + n*(MBS_RIJ128/2), MBS_RIJ128/2);
+
+   /* message encryption key */
+   ippsAESInit(keys+MBS_RIJ128, keyLen, &pCtx->cipher, sizeof(pCtx->cipher));
+   pCtx->aesNI = (AES_NI_ENABLED==RIJ_AESNI(&pCtx->cipher));
+
+   /* message authentication key mapped to the GHASH key and GHASH methods */
+   cpAESGCMSIV_MulX(hKey, keys);
+   pCtx->authParam = NULL;
+   #if (_IPP32E>=_IPP32E_K1)
+   if(IsFeatureEnabled(ippCPUID_AVX512VAES) && IsFeatureEnabled(ippCPUID_AVX512VCLMUL)) {
+      AesGcmPrecompute_vaes(pCtx->hTbl, hKey);
+      pCtx->authFun = AesGcmAuth_vaes;
+   }
+   else
+   #endif
+   #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   if(cpAESGCMSIV_IsClmul()) {
+      AesGcmPrecompute_avx(pCtx->hTbl, hKey);
+      pCtx->authFun = AesGcmAuth_avx;
+   }
+   #if(_IPP32E<_IPP32E_K0)
+   else
+   #endif
+   #endif
+   #if(_IPP32E<_IPP32E_K0)
+   {
+      AesGcmPrecompute_table2K(pCtx->hTbl, hKey);
+      pCtx->authFun = AesGcmAuth_table2K_ct;
+      pCtx->authParam = AesGcmConst_table;
+   }
+   #endif
+
+   PurgeBlock(blocks, sizeof(blocks));
+   PurgeBlock(keys, sizeof(keys));
+   PurgeBlock(hKey, sizeof(hKey));
+}
+
+/*
+// pHash = POLYVAL(pHash, zero-padded pSrc[len]), pHash is in GHASH form
+*/
+__IPPCP_INLINE void cpAESGCMSIV_Polyval(Ipp8u* pHash, const Ipp8u* pSrc, int len, const cpAES_GCMSIV* pCtx)
+{
+   __ALIGN16 Ipp8u blocks[GCMSIV_REV_BLKS*MBS_RIJ128];
+   int processedLen;
+
+   for(; len>0; len-=processedLen, pSrc+=processedLen) {
+      int nBlocks, tailLen, n;
+
+      processedLen = IPP_MIN(len, (int)sizeof(blocks));
+      nBlocks = processedLen/MBS_RIJ128;
+      tailLen = processedLen & (MBS_RIJ128-1);
+
+      cpAESGCMSIV_ReverseBlocks(blocks, pSrc, nBlocks);
+
+      /* reversed zero-padded last block */
+      if(tailLen) {
+         Ipp8u* pBlk = blocks + nBlocks*MBS_RIJ128;
+         PadBlock(0, pBlk, MBS_RIJ128);
+         for(n=0; n<tailLen; n++)
+            pBlk[MBS_RIJ128-1-n] = pSrc[nBlocks*MBS_RIJ128+n];
+         nBlocks++;
+      }
+
+      pCtx->authFun(pHash, blocks, nBlocks*MBS_RIJ128, pCtx->hTbl, pCtx->authParam);
+   }
+
+   PurgeBlock(blocks, sizeof(blocks));
+}
+
+/*
+// completes POLYVAL by the length block and computes the tag
+*/
+__IPPCP_INLINE void cpAESGCMSIV_Tag(Ipp8u* pTag, Ipp8u* pHash, int aadLen, int len, const Ipp8u* pNonce, const cpAES_GCMSIV* pCtx)
+{
+   Ipp8u lenBlock[MBS_RIJ128];
+   Ipp8u s[MBS_RIJ128];
+
+   ((Ipp64u*)lenBlock)[0] = (Ipp64u)aadLen * BYTESIZE;
+   ((Ipp64u*)lenBlock)[1] = (Ipp64u)len * BYTESIZE;
+   cpAESGCMSIV_Polyval(pHash, lenBlock, MBS_RIJ128, pCtx);
+
+   /* POLYVAL form of the accumulator */
+   cpAESGCMSIV_ReverseBlocks(s, pHash, 1);
+
+   XorBlock(s, pNonce, s, GCMSIV_NONCE_LEN);
+   s[MBS_RIJ128-1] &= 0x7F;
+   cpAESGCMSIV_encryptBlock(pTag, s, &pCtx->cipher);
+
+   PurgeBlock(s, sizeof(s));
+}
+
+/*
+// AES-CTR with 32-bit little-endian counter in the first word of the counter block
+*/
+__IPPCP_INLINE void cpAESGCMSIV_CTR(Ipp8u* pDst, const Ipp8u* pSrc, int len, Ipp8u* pCtr, const cpAES_GCMSIV* pCtx)
+{
+   const IppsAESSpec* pAES = &pCtx->cipher;
+   Ipp8u keystream[MBS_RIJ128];
+
+   #if (_IPP32E>=_IPP32E_Y8)
+   if(pCtx->aesNI) {
+      int nBlocks = len/MBS_RIJ128;
+      #if (_IPP32E>=_IPP32E_K1)
+      if(IsFeatureEnabled(ippCPUID_AVX512VAES))
+         cpAESGCMSIV_CTR_vaes512(pDst, pSrc, nBlocks, RIJ_NR(pAES), RIJ_EKEYS(pAES), pCtr);
+      else
+      #endif
+      cpAESGCMSIV_CTR_aesni(pDst, pSrc, nBlocks, RIJ_NR(pAES), RIJ_EKEYS(pAES), pCtr);
+      pSrc += nBlocks*MBS_RIJ128;
+      pDst += nBlocks*MBS_RIJ128;
+      len &= MBS_RIJ128-1;
+   }
+   #endif
+
+   while(len) {
+      int processedLen = IPP_MIN(len, MBS_RIJ128);
+      Ipp32u ctr = (Ipp32u)pCtr[0] | ((Ipp32u)pCtr[1]<<8) | ((Ipp32u)pCtr[2]<<16) | ((Ipp32u)pCtr[3]<<24);
+
+      cpAESGCMSIV_encryptBlock(keystream, pCtr, pAES);
+      XorBlock(pSrc, keystream, pDst, processedLen);
+
+      ctr++;
+      pCtr[0] = (Ipp8u)ctr;
+      pCtr[1] = (Ipp8u)(ctr>>8);
+      pCtr[2] = (Ipp8u)(ctr>>16);
+      pCtr[3] = (Ipp8u)(ctr>>24);
+
+      pSrc += processedLen;
+      pDst += processedLen;
+      len  -= processedLen;
+   }
+
+   PurgeBlock(keystream, sizeof(keystream));
+}
+
+#endif /*_PCP_AES_GCMSIV_STUFF_H_*/
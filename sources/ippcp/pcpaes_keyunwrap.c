@@ -0,0 +1,96 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394)
+//
+//  Contents:
+//        ippsAES_KeyUnwrap()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyUnwrap
+//
+// Purpose: RFC 3394 AES key unwrapping
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//                            pAuthPassed == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         len <24
+//                            len is not multiple of 8
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the wrapped key
+//    len         length (in bytes) of the wrapped key
+//    pDst        pointer to the key data (len-8 bytes)
+//    pAuthPassed pointer to the integrity check result: 1 if passed, 0 otherwise
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    The key data is zeroed if the integrity check fails.
+//    The unwrapping can be done in-place (pDst == pSrc).
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyUnwrap,(const Ipp8u* pSrc, int len, Ipp8u* pDst, int* pAuthPassed, const IppsAESSpec* pCtx))
+{
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test source and target buffers */
+   IPP_BAD_PTR3_RET(pSrc, pDst, pAuthPassed);
+   /* test wrapped key length */
+   IPP_BADARG_RET((len<(AESKW_MIN_SEMIBLKS+1)*AESKW_SEMIBLOCK) || (len&(AESKW_SEMIBLOCK-1)), ippStsLengthErr);
+
+   {
+      Ipp8u iv[AESKW_SEMIBLOCK];
+      Ipp8u regA[AESKW_SEMIBLOCK];
+      Ipp8u* pA = regA;
+      Ipp8u* pR = pDst;
+      int n = len/AESKW_SEMIBLOCK - 1;
+      int isValid;
+
+      /* A = C[0], R = C[1..n] */
+      CopyBlock8(pSrc, regA);
+      CopyBlock(pSrc+AESKW_SEMIBLOCK, pR, n*AESKW_SEMIBLOCK);
+
+      cpAESKW_Unwrap(&pA, &pR, &n, 1, pCtx);
+
+      /* integrity check A == IV */
+      PadBlock(AESKW_IV_BYTE, iv, AESKW_SEMIBLOCK);
+      isValid = EquBlock(regA, iv, AESKW_SEMIBLOCK);
+
+      if(!isValid)
+         PadBlock(0, pDst, n*AESKW_SEMIBLOCK);
+      *pAuthPassed = isValid;
+
+      PurgeBlock(regA, sizeof(regA));
+      return ippStsNoErr;
+   }
+}
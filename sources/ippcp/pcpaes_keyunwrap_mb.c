@@ -0,0 +1,137 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394) Multi Buffer
+//
+//  Contents:
+//        ippsAES_KeyUnwrap_MB()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyUnwrap_MB
+//
+// Purpose: RFC 3394 AES key unwrapping of a number of keys under the same key encryption key
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            len == NULL
+//                            pDst == NULL
+//                            authPassed == NULL
+//                            status == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         numBuffers <1
+//    ippStsErr               one or more of the buffers are not valid,
+//                            check status array for details:
+//       ippStsNullPtrErr        pSrc[i] == NULL
+//                               pDst[i] == NULL
+//       ippStsLengthErr         len[i] <24
+//                               len[i] is not multiple of 8
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        array of pointers to the wrapped keys
+//    len         array of the wrapped key lengths
+//    pDst        array of pointers to the key data (len[i]-8 bytes)
+//    authPassed  array of the integrity check results: 1 if passed, 0 otherwise
+//    status      array of statuses of the buffers
+//    numBuffers  number of the keys
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    No buffer is processed if any of them is not valid.
+//    The key data is zeroed if its integrity check fails.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyUnwrap_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pDst[],
+                                        int authPassed[], IppStatus status[], int numBuffers, const IppsAESSpec* pCtx))
+{
+   int i;
+
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test buffers */
+   IPP_BAD_PTR4_RET(pSrc, len, pDst, status);
+   IPP_BAD_PTR1_RET(authPassed);
+   IPP_BADARG_RET((numBuffers<1), ippStsLengthErr);
+
+   {
+      int isAllBuffersValid = 1;
+      for(i=0; i<numBuffers; i++) {
+         if(NULL==pSrc[i] || NULL==pDst[i])
+            status[i] = ippStsNullPtrErr;
+         else if((len[i]<(AESKW_MIN_SEMIBLKS+1)*AESKW_SEMIBLOCK) || (len[i]&(AESKW_SEMIBLOCK-1)))
+            status[i] = ippStsLengthErr;
+         else
+            status[i] = ippStsNoErr;
+
+         isAllBuffersValid &= (ippStsNoErr==status[i]);
+      }
+      IPP_BADARG_RET(!isAllBuffersValid, ippStsErr);
+   }
+
+   {
+      Ipp8u locA[AES_MB_MAX_KERNEL_SIZE][AESKW_SEMIBLOCK];
+      Ipp8u* loc_a[AES_MB_MAX_KERNEL_SIZE];
+      Ipp8u* loc_r[AES_MB_MAX_KERNEL_SIZE];
+      int loc_n[AES_MB_MAX_KERNEL_SIZE];
+      Ipp8u iv[AESKW_SEMIBLOCK];
+      int buffersProcessed;
+
+      PadBlock(AESKW_IV_BYTE, iv, AESKW_SEMIBLOCK);
+
+      for(buffersProcessed=0; buffersProcessed<numBuffers; buffersProcessed+=AES_MB_MAX_KERNEL_SIZE) {
+         int workLoadSize = IPP_MIN(AES_MB_MAX_KERNEL_SIZE, numBuffers-buffersProcessed);
+
+         for(i=0; i<workLoadSize; i++) {
+            const Ipp8u* pWrapped = pSrc[i + buffersProcessed];
+
+            loc_a[i] = locA[i];
+            loc_r[i] = pDst[i + buffersProcessed];
+            loc_n[i] = len[i + buffersProcessed]/AESKW_SEMIBLOCK - 1;
+
+            /* A = C[0], R = C[1..n] */
+            CopyBlock8(pWrapped, loc_a[i]);
+            CopyBlock(pWrapped+AESKW_SEMIBLOCK, loc_r[i], loc_n[i]*AESKW_SEMIBLOCK);
+         }
+
+         cpAESKW_Unwrap(loc_a, loc_r, loc_n, workLoadSize, pCtx);
+
+         /* integrity check A == IV */
+         for(i=0; i<workLoadSize; i++) {
+            int isValid = EquBlock(loc_a[i], iv, AESKW_SEMIBLOCK);
+            if(!isValid)
+               PadBlock(0, loc_r[i], loc_n[i]*AESKW_SEMIBLOCK);
+            authPassed[i + buffersProcessed] = isValid;
+         }
+      }
+
+      PurgeBlock(locA, sizeof(locA));
+      return ippStsNoErr;
+   }
+}
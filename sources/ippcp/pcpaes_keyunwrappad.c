@@ -0,0 +1,127 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap with Padding (RFC 5649)
+//
+//  Contents:
+//        ippsAES_KeyUnwrapPad()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyUnwrapPad
+//
+// Purpose: RFC 5649 AES key unwrapping with padding
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//                            pDstLen == NULL
+//                            pAuthPassed == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         len <16
+//                            len is not multiple of 8
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the wrapped key
+//    len         length (in bytes) of the wrapped key
+//    pDst        pointer to the key data buffer (len-8 bytes)
+//    pDstLen     pointer to the length (in bytes) of the unwrapped key data
+//    pAuthPassed pointer to the integrity check result: 1 if passed, 0 otherwise
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    The check covers the AIV constant, the length indicator and the zero padding.
+//    The key data buffer is zeroed and *pDstLen is set to 0 if the check fails.
+//    The unwrapping can be done in-place (pDst == pSrc).
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyUnwrapPad,(const Ipp8u* pSrc, int len, Ipp8u* pDst, int* pDstLen, int* pAuthPassed, const IppsAESSpec* pCtx))
+{
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test source and target buffers */
+   IPP_BAD_PTR4_RET(pSrc, pDst, pDstLen, pAuthPassed);
+   /* test wrapped key length */
+   IPP_BADARG_RET((len<2*AESKW_SEMIBLOCK) || (len&(AESKW_SEMIBLOCK-1)), ippStsLengthErr);
+
+   {
+      Ipp8u aiv[AESKW_SEMIBLOCK];
+      Ipp8u regA[AESKW_SEMIBLOCK];
+      Ipp8u* pA = regA;
+      Ipp8u* pR = pDst;
+      int n = len/AESKW_SEMIBLOCK - 1;
+      int rLen = n*AESKW_SEMIBLOCK;
+      Ipp32u mli;
+      Ipp8u padding = 0;
+      int isValid;
+      int k;
+
+      if(1==n) {
+         /* single AES block AIV | P */
+         Ipp8u blk[MBS_RIJ128];
+         CopyBlock16(pSrc, blk);
+         cpAESKW_DecryptBlock(blk, pCtx);
+         CopyBlock8(blk, regA);
+         CopyBlock8(blk+AESKW_SEMIBLOCK, pR);
+         PurgeBlock(blk, sizeof(blk));
+      }
+      else {
+         /* A = C[0], R = C[1..n] */
+         CopyBlock8(pSrc, regA);
+         CopyBlock(pSrc+AESKW_SEMIBLOCK, pR, rLen);
+         cpAESKW_Unwrap(&pA, &pR, &n, 1, pCtx);
+      }
+
+      /* AIV constant part */
+      cpAESKW_SetAIV(aiv, 0);
+      isValid = EquBlock(regA, aiv, AESKW_SEMIBLOCK/2);
+
+      /* 8*(n-1) < MLI <= 8*n */
+      mli = ((Ipp32u)regA[4]<<24) | ((Ipp32u)regA[5]<<16) | ((Ipp32u)regA[6]<<8) | (Ipp32u)regA[7];
+      isValid &= (mli > (Ipp32u)(rLen-AESKW_SEMIBLOCK)) & (mli <= (Ipp32u)rLen);
+
+      /* zero padding: the bytes of the last semiblock at the positions >= MLI */
+      for(k=rLen-AESKW_SEMIBLOCK; k<rLen; k++) {
+         Ipp8u mask = (Ipp8u)cpIsMsb_ct((BNU_CHUNK_T)(Ipp32s)(mli-1-(Ipp32u)k));
+         padding |= pR[k] & mask;
+      }
+      isValid &= (0==padding);
+
+      if(!isValid) {
+         PadBlock(0, pDst, rLen);
+         mli = 0;
+      }
+      *pDstLen = (int)mli;
+      *pAuthPassed = isValid;
+
+      PurgeBlock(regA, sizeof(regA));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,86 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394)
+//
+//  Contents:
+//        ippsAES_KeyWrap()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyWrap
+//
+// Purpose: RFC 3394 AES key wrapping
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         len <16
+//                            len is not multiple of 8
+//                            len >IPP_MAX_32S-8
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the key data
+//    len         length (in bytes) of the key data
+//    pDst        pointer to the wrapped key (len+8 bytes)
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    The wrapping can be done in-place (pDst == pSrc).
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyWrap,(const Ipp8u* pSrc, int len, Ipp8u* pDst, const IppsAESSpec* pCtx))
+{
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test source and target buffers */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+   /* test key data length */
+   IPP_BADARG_RET((len<AESKW_MIN_SEMIBLKS*AESKW_SEMIBLOCK) || (len&(AESKW_SEMIBLOCK-1)), ippStsLengthErr);
+   IPP_BADARG_RET((len>IPP_MAX_32S-AESKW_SEMIBLOCK), ippStsLengthErr);
+
+   {
+      Ipp8u* pA = pDst;
+      Ipp8u* pR = pDst+AESKW_SEMIBLOCK;
+      int n = len/AESKW_SEMIBLOCK;
+      int i;
+
+      /* R = P, backward order allows in-place operation */
+      for(i=n-1; i>=0; i--)
+         CopyBlock8(pSrc+i*AESKW_SEMIBLOCK, pR+i*AESKW_SEMIBLOCK);
+      /* A = IV */
+      PadBlock(AESKW_IV_BYTE, pA, AESKW_SEMIBLOCK);
+
+      cpAESKW_Wrap(&pA, &pR, &n, 1, pCtx);
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,126 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394) Multi Buffer
+//
+//  Contents:
+//        ippsAES_KeyWrap_MB()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyWrap_MB
+//
+// Purpose: RFC 3394 AES key wrapping of a number of keys under the same key encryption key
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            len == NULL
+//                            pDst == NULL
+//                            status == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         numBuffers <1
+//    ippStsErr               one or more of the buffers are not valid,
+//                            check status array for details:
+//       ippStsNullPtrErr        pSrc[i] == NULL
+//                               pDst[i] == NULL
+//       ippStsLengthErr         len[i] <16
+//                               len[i] is not multiple of 8
+//                               len[i] >IPP_MAX_32S-8
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        array of pointers to the key data
+//    len         array of the key data lengths
+//    pDst        array of pointers to the wrapped keys (len[i]+8 bytes)
+//    status      array of statuses of the buffers
+//    numBuffers  number of the keys
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    No buffer is processed if any of them is not valid.
+//    The wrapping chains of the keys are interleaved across the AES-NI/VAES
+//    pipelines, so the keys of equal length are processed most efficiently.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyWrap_MB,(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pDst[],
+                                      IppStatus status[], int numBuffers, const IppsAESSpec* pCtx))
+{
+   int i;
+
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test buffers */
+   IPP_BAD_PTR4_RET(pSrc, len, pDst, status);
+   IPP_BADARG_RET((numBuffers<1), ippStsLengthErr);
+
+   {
+      int isAllBuffersValid = 1;
+      for(i=0; i<numBuffers; i++) {
+         if(NULL==pSrc[i] || NULL==pDst[i])
+            status[i] = ippStsNullPtrErr;
+         else if((len[i]<AESKW_MIN_SEMIBLKS*AESKW_SEMIBLOCK) || (len[i]&(AESKW_SEMIBLOCK-1)) || (len[i]>IPP_MAX_32S-AESKW_SEMIBLOCK))
+            status[i] = ippStsLengthErr;
+         else
+            status[i] = ippStsNoErr;
+
+         isAllBuffersValid &= (ippStsNoErr==status[i]);
+      }
+      IPP_BADARG_RET(!isAllBuffersValid, ippStsErr);
+   }
+
+   {
+      Ipp8u* loc_a[AES_MB_MAX_KERNEL_SIZE];
+      Ipp8u* loc_r[AES_MB_MAX_KERNEL_SIZE];
+      int loc_n[AES_MB_MAX_KERNEL_SIZE];
+      int buffersProcessed;
+
+      for(buffersProcessed=0; buffersProcessed<numBuffers; buffersProcessed+=AES_MB_MAX_KERNEL_SIZE) {
+         int workLoadSize = IPP_MIN(AES_MB_MAX_KERNEL_SIZE, numBuffers-buffersProcessed);
+
+         for(i=0; i<workLoadSize; i++) {
+            const Ipp8u* pKey = pSrc[i + buffersProcessed];
+            int k;
+
+            loc_a[i] = pDst[i + buffersProcessed];
+            loc_r[i] = loc_a[i] + AESKW_SEMIBLOCK;
+            loc_n[i] = len[i + buffersProcessed]/AESKW_SEMIBLOCK;
+
+            /* R = P, backward order allows in-place operation */
+            for(k=loc_n[i]-1; k>=0; k--)
+               CopyBlock8(pKey+k*AESKW_SEMIBLOCK, loc_r[i]+k*AESKW_SEMIBLOCK);
+            /* A = IV */
+            PadBlock(AESKW_IV_BYTE, loc_a[i], AESKW_SEMIBLOCK);
+         }
+
+         cpAESKW_Wrap(loc_a, loc_r, loc_n, workLoadSize, pCtx);
+      }
+
+      return ippStsNoErr;
+   }
+}
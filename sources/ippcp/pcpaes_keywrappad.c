@@ -0,0 +1,89 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap with Padding (RFC 5649)
+//
+//  Contents:
+//        ippsAES_KeyWrapPad()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+/*F*
+//    Name: ippsAES_KeyWrapPad
+//
+// Purpose: RFC 5649 AES key wrapping with padding
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pCtx == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//    ippStsContextMatchErr   !VALID_AES_ID()
+//    ippStsLengthErr         len <1
+//                            len >IPP_MAX_32S-15
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the key data
+//    len         length (in bytes) of the key data
+//    pDst        pointer to the wrapped key (len rounded up to multiple of 8, plus 8 bytes)
+//    pCtx        pointer to the AES context initialized by the key encryption key
+//
+// Note:
+//    The wrapping can be done in-place (pDst == pSrc).
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_KeyWrapPad,(const Ipp8u* pSrc, int len, Ipp8u* pDst, const IppsAESSpec* pCtx))
+{
+   /* test context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!VALID_AES_ID(pCtx), ippStsContextMatchErr);
+   /* test source and target buffers */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+   /* test key data length */
+   IPP_BADARG_RET((len<1) || (len>IPP_MAX_32S-(2*AESKW_SEMIBLOCK-1)), ippStsLengthErr);
+
+   {
+      Ipp8u* pA = pDst;
+      Ipp8u* pR = pDst+AESKW_SEMIBLOCK;
+      int n = (len+AESKW_SEMIBLOCK-1)/AESKW_SEMIBLOCK;
+      int i;
+
+      /* R = P | zero padding, backward order allows in-place operation */
+      for(i=len-1; i>=0; i--)
+         pR[i] = pSrc[i];
+      PadBlock(0, pR+len, n*AESKW_SEMIBLOCK-len);
+      /* A = AIV */
+      cpAESKW_SetAIV(pA, len);
+
+      /* the padded key data of one semiblock is encrypted as the single AES block AIV | P */
+      if(1==n)
+         cpAESKW_EncryptBlock(pDst, pCtx);
+      else
+         cpAESKW_Wrap(&pA, &pR, &n, 1, pCtx);
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,231 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394) internal functions
+//
+//  Contents:
+//        cpAESKW_Wrap()
+//        cpAESKW_Unwrap()
+//        cpAESKW_EncryptBlock()
+//        cpAESKW_DecryptBlock()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_kw.h"
+
+#if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+#  include "pcprijtables.h"
+#endif
+
+/* Work Load Size from Buffers */
+#define WORKLOAD_LINES_16 (AES_MB_MAX_KERNEL_SIZE)    /* size 16 */
+#define WORKLOAD_LINES_4 (AES_MB_MAX_KERNEL_SIZE / 4) /* size  4 */
+
+/*
+// W(): for j = 0..5, i = 1..n
+//    B = AES(K, A | R[i]), A = MSB(64, B) ^ t, R[i] = LSB(64, B), where t = (n*j)+i
+*/
+static void cpAESKW_wrap(Ipp8u* pA, Ipp8u* pR, int n, const IppsAESSpec* pAES)
+{
+   /* setup encoder method */
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+
+   Ipp64u B[2];
+   Ipp64u t = 1;
+   int j, i;
+
+   CopyBlock(pA, B, AESKW_SEMIBLOCK);
+   for(j=0; j<AESKW_NSTEPS; j++) {
+      for(i=0; i<n; i++, t++) {
+         Ipp8u* pRi = pR + i*AESKW_SEMIBLOCK;
+         CopyBlock(pRi, B+1, AESKW_SEMIBLOCK);
+
+         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+         encoder((Ipp8u*)B, (Ipp8u*)B, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+         #else
+         encoder((Ipp8u*)B, (Ipp8u*)B, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+         #endif
+
+         B[0] ^= cpAESKW_t(t);
+         CopyBlock(B+1, pRi, AESKW_SEMIBLOCK);
+      }
+   }
+   CopyBlock(B, pA, AESKW_SEMIBLOCK);
+   PurgeBlock(B, sizeof(B));
+}
+
+/*
+// W^-1(): for j = 5..0, i = n..1
+//    B = AES-1(K, (A ^ t) | R[i]), A = MSB(64, B), R[i] = LSB(64, B), where t = (n*j)+i
+*/
+static void cpAESKW_unwrap(Ipp8u* pA, Ipp8u* pR, int n, const IppsAESSpec* pAES)
+{
+   /* setup decoder method */
+   RijnCipher decoder = RIJ_DECODER(pAES);
+
+   Ipp64u B[2];
+   Ipp64u t = (Ipp64u)n*AESKW_NSTEPS;
+   int j, i;
+
+   CopyBlock(pA, B, AESKW_SEMIBLOCK);
+   for(j=0; j<AESKW_NSTEPS; j++) {
+      for(i=n-1; i>=0; i--, t--) {
+         Ipp8u* pRi = pR + i*AESKW_SEMIBLOCK;
+         B[0] ^= cpAESKW_t(t);
+         CopyBlock(pRi, B+1, AESKW_SEMIBLOCK);
+
+         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+         decoder((Ipp8u*)B, (Ipp8u*)B, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijDecSbox/*NULL*/);
+         #else
+         decoder((Ipp8u*)B, (Ipp8u*)B, RIJ_NR(pAES), RIJ_DKEYS(pAES), NULL);
+         #endif
+
+         CopyBlock(B+1, pRi, AESKW_SEMIBLOCK);
+      }
+   }
+   CopyBlock(B, pA, AESKW_SEMIBLOCK);
+   PurgeBlock(B, sizeof(B));
+}
+
+/*
+// The wrapping chains of the buffers are serial by nature,
+// so the chains of independent buffers are interleaved across the AES pipelines.
+*/
+static void cpAESKW_process(Ipp8u* const pA[], Ipp8u* const pR[], const int n[], int numBuffers, const IppsAESSpec* pAES, int isWrap)
+{
+   int buffersProcessed = 0;
+   int i;
+
+   #if (_AES_PROB_NOISE == _FEATURE_ON_)
+   /* Mistletoe3 mitigation: process the buffers one by one */
+   const cpAESNoiseParams* params = (const cpAESNoiseParams*)&RIJ_NOISE_PARAMS(pAES);
+   Ipp32u noiseRnd = AES_NOISE_RAND(params);
+   int isNoise = AES_NOISE_LEVEL(params) > 0;
+   #else
+   int isNoise = 0;
+   #endif
+
+   #if (_IPP32E>=_IPP32E_Y8)
+   if(AES_NI_ENABLED==RIJ_AESNI(pAES) && !isNoise) {
+      Ipp8u* loc_a[AES_MB_MAX_KERNEL_SIZE];
+      Ipp8u* loc_r[AES_MB_MAX_KERNEL_SIZE];
+      int loc_n[AES_MB_MAX_KERNEL_SIZE];
+
+      while(numBuffers > buffersProcessed) {
+         int workLoadSize = WORKLOAD_LINES_4;
+         #if (_IPP32E>=_IPP32E_K1)
+         if(IsFeatureEnabled(ippCPUID_AVX512VAES) && (numBuffers-buffersProcessed) > WORKLOAD_LINES_4)
+            workLoadSize = WORKLOAD_LINES_16;
+         #endif
+
+         /* fill buffers */
+         for(i=0; i<workLoadSize; i++) {
+            if(i >= (numBuffers-buffersProcessed)) {
+               loc_a[i] = NULL;
+               loc_r[i] = NULL;
+               loc_n[i] = 0;
+               continue;
+            }
+            loc_a[i] = pA[i + buffersProcessed];
+            loc_r[i] = pR[i + buffersProcessed];
+            loc_n[i] = n[i + buffersProcessed];
+         }
+
+         /* choosing a core for filled buffers */
+         #if (_IPP32E>=_IPP32E_K1)
+         if(WORKLOAD_LINES_16==workLoadSize) {
+            if(isWrap)
+               aes_kw_wrap_vaes_mb16(loc_a, loc_r, loc_n, RIJ_NR(pAES), RIJ_EKEYS(pAES));
+            else
+               aes_kw_unwrap_vaes_mb16(loc_a, loc_r, loc_n, RIJ_NR(pAES), RIJ_DKEYS(pAES));
+         }
+         else
+         #endif
+         {
+            if(isWrap)
+               aes_kw_wrap_aesni_mb4(loc_a, loc_r, loc_n, RIJ_NR(pAES), RIJ_EKEYS(pAES));
+            else
+               aes_kw_unwrap_aesni_mb4(loc_a, loc_r, loc_n, RIJ_NR(pAES), RIJ_DKEYS(pAES));
+         }
+
+         buffersProcessed += workLoadSize;
+      }
+   }
+   #else
+   IPP_UNREFERENCED_PARAMETER(isNoise);
+   #endif // (_IPP32E>=_IPP32E_Y8)
+
+   for(i=buffersProcessed; i<numBuffers; i++) {
+      if(isWrap)
+         cpAESKW_wrap(pA[i], pR[i], n[i], pAES);
+      else
+         cpAESKW_unwrap(pA[i], pR[i], n[i], pAES);
+
+      #if (_AES_PROB_NOISE == _FEATURE_ON_)
+      if(isNoise) {
+         cpAESRandomNoise(NULL,
+                  MISTLETOE3_BASE_NOISE_LEVEL + AES_NOISE_LEVEL(params),
+                  MISTLETOE3_NOISE_RATE,
+                  &noiseRnd);
+      }
+      #endif
+   }
+}
+
+IPP_OWN_DEFN (void, cpAESKW_Wrap, (Ipp8u* const pA[], Ipp8u* const pR[], const int n[], int numBuffers, const IppsAESSpec* pAES))
+{
+   cpAESKW_process(pA, pR, n, numBuffers, pAES, 1);
+}
+
+IPP_OWN_DEFN (void, cpAESKW_Unwrap, (Ipp8u* const pA[], Ipp8u* const pR[], const int n[], int numBuffers, const IppsAESSpec* pAES))
+{
+   cpAESKW_process(pA, pR, n, numBuffers, pAES, 0);
+}
+
+IPP_OWN_DEFN (void, cpAESKW_EncryptBlock, (Ipp8u* pBlk, const IppsAESSpec* pAES))
+{
+   /* setup encoder method */
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   encoder(pBlk, pBlk, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+   #else
+   encoder(pBlk, pBlk, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+   #endif
+}
+
+IPP_OWN_DEFN (void, cpAESKW_DecryptBlock, (Ipp8u* pBlk, const IppsAESSpec* pAES))
+{
+   /* setup decoder method */
+   RijnCipher decoder = RIJ_DECODER(pAES);
+
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   decoder(pBlk, pBlk, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijDecSbox/*NULL*/);
+   #else
+   decoder(pBlk, pBlk, RIJ_NR(pAES), RIJ_DKEYS(pAES), NULL);
+   #endif
+}
+
+#undef WORKLOAD_LINES_16
+#undef WORKLOAD_LINES_4
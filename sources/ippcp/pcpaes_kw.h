@@ -0,0 +1,88 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES Key Wrap (RFC 3394) and AES Key Wrap with Padding (RFC 5649)
+//     Internal Definitions and Internal Functions Prototypes
+//
+*/
+
+#if !defined(_PCP_AES_KW_H)
+#define _PCP_AES_KW_H
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+
+#define AESKW_SEMIBLOCK    (8)   /* semiblock size (bytes)               */
+#define AESKW_NSTEPS       (6)   /* number of the wrapping steps          */
+#define AESKW_MIN_SEMIBLKS (2)   /* min number of plaintext semiblocks    */
+
+/* default initial value (RFC 3394, 2.2.3.1) */
+#define AESKW_IV_BYTE      (0xA6)
+/* alternative initial value constant part (RFC 5649, 3.) */
+#define AESKW_AIV_HI       (0xA65959A6)
+
+/*
+// Wrapping of a number of buffers under the same key, W() and W^-1() of RFC 3394:
+//    pA[i] - integrity check register (AESKW_SEMIBLOCK bytes), input and output
+//    pR[i] - n[i] semiblocks of the register R, input and output
+*/
+#define cpAESKW_Wrap OWNAPI(cpAESKW_Wrap)
+   IPP_OWN_DECL (void, cpAESKW_Wrap, (Ipp8u* const pA[], Ipp8u* const pR[], const int n[], int numBuffers, const IppsAESSpec* pAES))
+#define cpAESKW_Unwrap OWNAPI(cpAESKW_Unwrap)
+   IPP_OWN_DECL (void, cpAESKW_Unwrap, (Ipp8u* const pA[], Ipp8u* const pR[], const int n[], int numBuffers, const IppsAESSpec* pAES))
+
+/* single block AES encryption/decryption: the RFC 5649 wrapping of up to AESKW_SEMIBLOCK bytes */
+#define cpAESKW_EncryptBlock OWNAPI(cpAESKW_EncryptBlock)
+   IPP_OWN_DECL (void, cpAESKW_EncryptBlock, (Ipp8u* pBlk, const IppsAESSpec* pAES))
+#define cpAESKW_DecryptBlock OWNAPI(cpAESKW_DecryptBlock)
+   IPP_OWN_DECL (void, cpAESKW_DecryptBlock, (Ipp8u* pBlk, const IppsAESSpec* pAES))
+
+#if (_IPP32E>=_IPP32E_Y8)
+#define aes_kw_wrap_aesni_mb4 OWNAPI(aes_kw_wrap_aesni_mb4)
+   IPP_OWN_DECL (void, aes_kw_wrap_aesni_mb4, (Ipp8u* const a_pa[4], Ipp8u* const r_pa[4], const int n[4], const int num_of_rounds, const Ipp8u* enc_keys))
+#define aes_kw_unwrap_aesni_mb4 OWNAPI(aes_kw_unwrap_aesni_mb4)
+   IPP_OWN_DECL (void, aes_kw_unwrap_aesni_mb4, (Ipp8u* const a_pa[4], Ipp8u* const r_pa[4], const int n[4], const int num_of_rounds, const Ipp8u* dec_keys))
+#endif
+
+#if (_IPP32E>=_IPP32E_K1)
+#define aes_kw_wrap_vaes_mb16 OWNAPI(aes_kw_wrap_vaes_mb16)
+   IPP_OWN_DECL (void, aes_kw_wrap_vaes_mb16, (Ipp8u* const a_pa[16], Ipp8u* const r_pa[16], const int n[16], const int num_of_rounds, const Ipp8u* enc_keys))
+#define aes_kw_unwrap_vaes_mb16 OWNAPI(aes_kw_unwrap_vaes_mb16)
+   IPP_OWN_DECL (void, aes_kw_unwrap_vaes_mb16, (Ipp8u* const a_pa[16], Ipp8u* const r_pa[16], const int n[16], const int num_of_rounds, const Ipp8u* dec_keys))
+#endif
+
+/* big-endian 64-bit step counter t */
+__IPPCP_INLINE Ipp64u cpAESKW_t(Ipp64u t)
+{
+   return ENDIANNESS64(t);
+}
+
+/* RFC 5649 alternative initial value: A65959A6 | MLI (32-bit big-endian length of the key data) */
+__IPPCP_INLINE void cpAESKW_SetAIV(Ipp8u* pA, int len)
+{
+   Ipp32u aiv[2];
+   aiv[0] = ENDIANNESS32((Ipp32u)AESKW_AIV_HI);
+   aiv[1] = ENDIANNESS32((Ipp32u)len);
+   CopyBlock8(aiv, pA);
+}
+
+#endif /* _PCP_AES_KW_H */
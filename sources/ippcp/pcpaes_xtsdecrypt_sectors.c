@@ -0,0 +1,144 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-XTS Functions (IEEE P1619)
+//
+//  Contents:
+//        ippsAES_XTSDecryptSectors()
+//
+*/
+
+#include "owncp.h"
+#include "pcpaesmxts.h"
+#include "pcptool.h"
+#include "pcpaesmxtsstuff.h"
+
+static void cpAES_XTS_DecSector(Ipp8u* pDst, const Ipp8u* pSrc, int nBlocks, Ipp8u* tweakCT, const IppsAESSpec* pdatAES)
+{
+   #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   /* use Intel(R) AES New Instructions version if possible */
+   if(AES_NI_ENABLED==RIJ_AESNI(pdatAES)) {
+      #if(_IPP32E>=_IPP32E_K1)
+      if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
+         cpAESDecryptXTS_VAES(pDst, pSrc, nBlocks, RIJ_DKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+      }
+      else
+      #endif
+      cpAESDecryptXTS_AES_NI(pDst, pSrc, nBlocks, RIJ_DKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+   }
+   else
+   #endif
+   {
+      for(; nBlocks>0; nBlocks--) {
+         /* pre-whitening */
+         XorBlock16(pSrc, tweakCT, pDst);
+         /* decryption */
+         ippsAESDecryptECB(pDst, pDst, AES_BLK_SIZE, pdatAES);
+         /* post-whitening */
+         XorBlock16(pDst, tweakCT, pDst);
+
+         gf_mul_by_primitive(tweakCT);
+         pSrc += AES_BLK_SIZE;
+         pDst += AES_BLK_SIZE;
+      }
+   }
+}
+
+/*F*
+//    Name: ippsAES_XTSDecryptSectors
+//
+// Purpose: AES-XTS decryption of series of consecutive data units (sectors).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc == NULL
+//                            pDst == NULL
+//                            pCtx == NULL
+//    ippStsContextMatchErr   !VALID_AES_XTS_ID(pCtx)
+//    ippStsLengthErr         sectorSize <16
+//                            sectorSize is not multiple of 16
+//                            nSectors <1
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc              points input buffer (nSectors*sectorSize bytes)
+//    pDst              points output buffer (nSectors*sectorSize bytes)
+//    sectorSize        size of the sector (data unit) in bytes
+//    nSectors          number of sectors
+//    startSectorNo     number of the first sector
+//    pCtx              points AES_XTS context
+//
+// Note:
+//    Tweak of the sector is its number represented as 128-bit
+//    little-endian integer. Tweaks of all sectors are encrypted
+//    in batches, AES_BLKS_PER_BUFFER at once.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsAES_XTSDecryptSectors,(const Ipp8u* pSrc, Ipp8u* pDst,
+                                             int sectorSize, int nSectors,
+                                             Ipp64u startSectorNo,
+                                             const IppsAES_XTSSpec* pCtx))
+{
+   /* test pointers */
+   IPP_BAD_PTR1_RET(pCtx);
+   /* test the context ID */
+   IPP_BADARG_RET(!VALID_AES_XTS_ID(pCtx), ippStsContextMatchErr);
+
+   /* test data pointers */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+
+   /* test sector geometry */
+   IPP_BADARG_RET(sectorSize < AES_BLK_SIZE, ippStsLengthErr);
+   IPP_BADARG_RET(sectorSize % AES_BLK_SIZE, ippStsLengthErr);
+   IPP_BADARG_RET(nSectors < 1, ippStsLengthErr);
+
+   {
+      const IppsAESSpec* pdatAES = &pCtx->datumAES;
+      int sectorBlocks = sectorSize/AES_BLK_SIZE;
+
+      __ALIGN16 Ipp8u tweaksCT[AES_BLKS_PER_BUFFER*AES_BLK_SIZE];
+      __ALIGN16 Ipp8u duNo[AES_BLK_SIZE];
+      int i;
+
+      /* data unit number as 128-bit LE integer */
+      for(i=0; i<AES_BLK_SIZE; i++)
+         duNo[i] = (Ipp8u)(i<(int)sizeof(Ipp64u)? startSectorNo>>(i*BYTESIZE) : 0);
+
+      while(nSectors>0) {
+         int n, batch = IPP_MIN(AES_BLKS_PER_BUFFER, nSectors);
+
+         /* encrypt tweaks of the batch */
+         cpXTSsectorTweaks(tweaksCT, batch, duNo, &pCtx->tweakAES);
+
+         /* decrypt sectors of the batch */
+         for(n=0; n<batch; n++) {
+            cpAES_XTS_DecSector(pDst, pSrc, sectorBlocks, tweaksCT+n*AES_BLK_SIZE, pdatAES);
+            pSrc += sectorSize;
+            pDst += sectorSize;
+         }
+
+         nSectors -= batch;
+      }
+
+      PurgeBlock(tweaksCT, sizeof(tweaksCT));
+      return ippStsNoErr;
+   }
+}
@@ -182,12 +182,6 @@ __IPPCP_INLINE void IncrementCounter32(Ipp8u* pCtr)
 #endif
 
 #if(_IPP32E>=_IPP32E_K0)
-#define AesGcmPrecompute_vaes OWNAPI(AesGcmPrecompute_vaes)
-   IPP_OWN_DECL (void, AesGcmPrecompute_vaes, (Ipp8u* const pPrecomputeData, const Ipp8u* const pHKey))
-#define AesGcmMulGcm_vaes OWNAPI(AesGcmMulGcm_vaes)
-   IPP_OWN_DECL (void, AesGcmMulGcm_vaes, (Ipp8u* pGhash, const Ipp8u* pHkey, const void* pParam))
-#define AesGcmAuth_vaes OWNAPI(AesGcmAuth_vaes)
-   IPP_OWN_DECL (void, AesGcmAuth_vaes, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
 #define AesGcmEnc_vaes OWNAPI(AesGcmEnc_vaes)
    IPP_OWN_DECL (void, AesGcmEnc_vaes, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
 #define AesGcmDec_vaes OWNAPI(AesGcmDec_vaes)
@@ -244,4 +238,14 @@ static int cpSizeofCtx_AESGCM(void)
 
 #endif // (_IPP32E < _IPP32E_K0)
 
+#if(_IPP32E>=_IPP32E_K1)
+/* VAES-512 GHASH kernels (used by AES-GCM-SIV) */
+#define AesGcmPrecompute_vaes OWNAPI(AesGcmPrecompute_vaes)
+   IPP_OWN_DECL (void, AesGcmPrecompute_vaes, (Ipp8u* const pPrecomputeData, const Ipp8u* const pHKey))
+#define AesGcmMulGcm_vaes OWNAPI(AesGcmMulGcm_vaes)
+   IPP_OWN_DECL (void, AesGcmMulGcm_vaes, (Ipp8u* pGhash, const Ipp8u* pHkey, const void* pParam))
+#define AesGcmAuth_vaes OWNAPI(AesGcmAuth_vaes)
+   IPP_OWN_DECL (void, AesGcmAuth_vaes, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
+#endif /* _IPP32E>=_IPP32E_K1 */
+
 #endif /* _CP_AESAUTH_GCM_H*/
@@ -58,7 +58,7 @@ __IPPCP_INLINE int cpSizeof_AES_XTS_Ctx(void)
    return sizeof(IppsAES_XTSSpec);
 }
 
-static int IsLegalGeometry(int startCipherBlkNo, int bitLen, int duBitsize)
+__IPPCP_INLINE int IsLegalGeometry(int startCipherBlkNo, int bitLen, int duBitsize)
 {
    int duBlocks = (duBitsize+IPP_AES_BLOCK_BITSIZE-1)/IPP_AES_BLOCK_BITSIZE;
    int legalBlk = (0<=startCipherBlkNo && startCipherBlkNo<duBlocks) && ((startCipherBlkNo*IPP_AES_BLOCK_BITSIZE+bitLen)<=duBitsize);
@@ -28,6 +28,7 @@
 
 #include "owncp.h"
 #include "pcpaesm.h"
+#include "pcptool.h"
 
 /*
    multiplication by primirive element alpha (==2)
@@ -78,4 +79,25 @@ static void cpXTSxor16(Ipp8u* pDst, const Ipp8u* pSrc1, const Ipp8u* pSrc2, int
    }
 }
 
+/*
+   encrypted tweaks of nblk consecutive data units (sectors),
+   pDuNo is the number of the first data unit represented as 128-bit LE integer (IEEE P1619),
+   on return it is advanced by nblk
+*/
+static void cpXTSsectorTweaks(Ipp8u* buffer, int nblk, Ipp8u* pDuNo, const IppsAESSpec* ptwkAES)
+{
+   Ipp8u* pbuf = buffer;
+   for(; nblk>0; nblk--, pbuf+=MBS_RIJ128) {
+      int i, carry = 1;
+      CopyBlock16(pDuNo, pbuf);
+      for(i=0; i<MBS_RIJ128; i++) {
+         carry += pDuNo[i];
+         pDuNo[i] = (Ipp8u)carry;
+         carry >>= 8;
+      }
+   }
+   /* all tweaks are encrypted in one (pipelined) pass */
+   ippsAESEncryptECB(buffer, buffer, (int)(pbuf-buffer), ptwkAES);
+}
+
 #endif /* _PCP_AES_XTS_STUFF_H */
@@ -66,6 +66,27 @@ IPPFUN(IppStatus, ippsModInv_BN, (IppsBigNumState* pA, IppsBigNumState* pM, Ipps
     IPP_BADARG_RET(BN_NEGATIVE(pM) || (BN_SIZE(pM)==1 && BN_NUMBER(pM)[0]==0), ippStsBadModulusErr);
     IPP_BADARG_RET(cpCmp_BNU(BN_NUMBER(pA), BN_SIZE(pA), BN_NUMBER(pM), BN_SIZE(pM)) >= 0, ippStsScaleRangeErr);
 
+   /* odd modulus: constant-time divsteps inversion */
+   if(BN_NUMBER(pM)[0] & 1) {
+      BNU_CHUNK_T* pR = BN_NUMBER(pInv);
+      BNU_CHUNK_T* pOne = BN_BUFFER(pInv);
+      cpSize nsM = BN_SIZE(pM);
+      cpSize nsR = nsM;
+
+      /* R = 1/A
+         (pInv may alias pA or pM: the constant is kept in the buffer,
+          the result is written once A and M have been consumed) */
+      ZEXPAND_BNU(pOne, 0, nsM);
+      pOne[0] = 1;
+      if(!cpSafeGcdInv_BNU_ct(pR, BN_NUMBER(pA), BN_SIZE(pA), pOne, BN_NUMBER(pM), nsM))
+         return ippStsBadModulusErr;
+
+      FIX_BNU(pR, nsR);
+      BN_SIGN(pInv) = ippBigNumPOS;
+      BN_SIZE(pInv) = nsR;
+      return ippStsNoErr;
+   }
+
    {
       cpSize nsR = cpModInv_BNU(BN_NUMBER(pInv),
                                 BN_NUMBER(pA), BN_SIZE(pA),
@@ -96,10 +96,16 @@ IPPFUN(IppStatus, ippsMul_BN, (IppsBigNumState* pA, IppsBigNumState* pB, IppsBig
          /* clear result */
          ZEXPAND_BNU(pDataR, 0, nsR+1);
 
-         if(pA==pB)
-            cpSqr_BNU_school(pDataR, aData, nsA);
-         else
-            cpMul_BNU_school(pDataR, aData, nsA, bData, nsB);
+         {
+            /* the Karatsuba scratch is the buffer of R unless it keeps a copy of the operand */
+            BNU_CHUNK_T* pScratch = (pA==pR || pB==pR)? NULL : BN_BUFFER(pR);
+            cpSize scratchLen = (pA==pR || pB==pR)? 0 : BN_ROOM(pR)+1;
+
+            if(pA==pB)
+               cpSqrLarge_BNU(pDataR, aData, nsA, pScratch, scratchLen);
+            else
+               cpMulLarge_BNU(pDataR, aData, nsA, bData, nsB, pScratch, scratchLen);
+         }
 
          nsR = (bitSizeA + bitSizeB + BNU_CHUNK_BITS - 1) /BNU_CHUNK_BITS;
          FIX_BNU(pDataR, nsR);
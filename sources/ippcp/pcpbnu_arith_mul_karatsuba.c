@@ -0,0 +1,321 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Internal Unsigned arithmetic
+//
+//  Contents:
+//     cpKaratsubaBufferSize()
+//     cpMulKaratsuba_BNU()
+//     cpSqrKaratsuba_BNU()
+//     cpMulLargeBufferSize()
+//     cpMulLarge_BNU()
+//     cpSqrLarge_BNU()
+//
+*/
+
+#include "owncp.h"
+#include "pcpbnuarith.h"
+#include "pcpbnumisc.h"
+#include "pcpmask_ct.h"
+#include "pcptool.h"
+
+/*
+// Karatsuba multiplication of ns-chunk numbers, A = A1*B^m + A0, m = (ns+1)/2:
+//
+//    A*B = Z2*B^(2m) + (Z0 + Z2 - (A0-A1)*(B0-B1))*B^m + Z0
+//    Z0 = A0*B0, Z2 = A1*B1
+//
+// The middle product is computed from |A0-A1| and |B0-B1|, the sign is applied
+// by masks, so the execution flow depends on the operand lengths only.
+// Schoolbook multiplication (squaring) is used below KARATSUBA_THRESHOLD
+// (KARATSUBA_SQR_THRESHOLD) chunks.
+*/
+
+/* R[] += c over all ns chunks */
+static BNU_CHUNK_T kara_inc(BNU_CHUNK_T* pR, cpSize ns, BNU_CHUNK_T c)
+{
+   cpSize i;
+   for(i=0; i<ns; i++)
+      ADD_AB(c, pR[i], pR[i], c);
+   return c;
+}
+
+/*
+// R = |A - B|, A is ns chunks, B is nsB<=ns chunks
+// returns all ones mask if A<B, zero otherwise
+// pT is ns chunks temporary
+*/
+static BNU_CHUNK_T kara_absdiff(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, cpSize nsB, cpSize ns, BNU_CHUNK_T* pT)
+{
+   BNU_CHUNK_T borrowR = cpSub_BNU(pR, pA, pB, nsB);
+   BNU_CHUNK_T borrowT = cpSub_BNU(pT, pB, pA, nsB);
+   BNU_CHUNK_T mask;
+   cpSize i;
+
+   for(i=nsB; i<ns; i++) {
+      BNU_CHUNK_T a = pA[i];
+      BNU_CHUNK_T b;
+      SUB_AB(b, pR[i], a, borrowR);
+      borrowR = b;
+      SUB_ABC(b, pT[i], 0, a, borrowT);
+      borrowT = b;
+   }
+
+   mask = (BNU_CHUNK_T)0 - borrowR;
+   cpMaskedReplace_ct(pR, pT, ns, mask);
+   return mask;
+}
+
+/*
+// Size (chunks) of the scratch buffer of cpMulKaratsuba_BNU() and cpSqrKaratsuba_BNU(),
+// it is less than 2*ns for any ns
+*/
+IPP_OWN_DEFN (cpSize, cpKaratsubaBufferSize, (cpSize ns))
+{
+   cpSize size = 0;
+   while(ns >= KARATSUBA_THRESHOLD) {
+      cpSize m = (ns+1)/2;
+      size += 2*m +1;
+      ns = m;
+   }
+   return size;
+}
+
+/*F*
+//    Name: cpMulKaratsuba_BNU
+//
+// Purpose: Multiply 2 BigNums of the same size.
+//
+// Returns:
+//    extension of result of multiply 2 BigNums
+//
+// Parameters:
+//    pR       resultant BigNum, 2*ns chunks
+//    pA       source BigNum A
+//    pB       source BigNum B
+//    ns       size of A and B
+//    pBuffer  scratch buffer of cpKaratsubaBufferSize(ns) chunks
+//
+*F*/
+IPP_OWN_DEFN (BNU_CHUNK_T, cpMulKaratsuba_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, cpSize ns, BNU_CHUNK_T* pBuffer))
+{
+   if(ns < KARATSUBA_THRESHOLD)
+      return cpMul_BNU_school(pR, pA,ns, pB,ns);
+
+   {
+      cpSize m = (ns+1)/2;
+      cpSize k = ns - m;
+
+      BNU_CHUNK_T* pDa = pR;           /* |A0-A1|, m chunks, until Z0 is computed */
+      BNU_CHUNK_T* pDb = pR + m;       /* |B0-B1|, m chunks, until Z0 is computed */
+      BNU_CHUNK_T* pM  = pBuffer;      /* |A0-A1|*|B0-B1|, then middle product, 2m+1 */
+      BNU_CHUNK_T* pNext = pM + 2*m+1;
+
+      BNU_CHUNK_T sign, carry;
+      cpSize i;
+
+      sign  = kara_absdiff(pDa, pA, pA+m, k, m, pM);
+      sign ^= kara_absdiff(pDb, pB, pB+m, k, m, pM);
+
+      cpMulKaratsuba_BNU(pM, pDa, pDb, m, pNext);
+      pM[2*m] = 0;
+      cpMulKaratsuba_BNU(pR, pA, pB, m, pNext);
+      cpMulKaratsuba_BNU(pR+2*m, pA+m, pB+m, k, pNext);
+
+      /* M = -P if signs of (A0-A1) and (B0-B1) are equal, M = P otherwise */
+      for(i=0; i<2*m+1; i++)
+         pM[i] ^= ~sign;
+      kara_inc(pM, 2*m+1, ~sign & 1);
+
+      /* M += Z0 + Z2 */
+      carry = cpAdd_BNU(pM, pM, pR, 2*m);
+      pM[2*m] += carry;
+      carry = cpAdd_BNU(pM, pM, pR+2*m, 2*k);
+      kara_inc(pM+2*k, 2*m+1-2*k, carry);
+
+      /* R += M*B^m */
+      carry = cpAdd_BNU(pR+m, pR+m, pM, 2*m+1);
+      kara_inc(pR+3*m+1, 2*ns-3*m-1, carry);
+
+      return pR[2*ns-1];
+   }
+}
+
+/*F*
+//    Name: cpSqrKaratsuba_BNU
+//
+// Purpose: Square BigNum.
+//
+// Returns:
+//    extension of result of square BigNum
+//
+// Parameters:
+//    pR       resultant BigNum, 2*ns chunks
+//    pA       source BigNum
+//    ns       size of A
+//    pBuffer  scratch buffer of cpKaratsubaBufferSize(ns) chunks
+//
+*F*/
+IPP_OWN_DEFN (BNU_CHUNK_T, cpSqrKaratsuba_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize ns, BNU_CHUNK_T* pBuffer))
+{
+   if(ns < KARATSUBA_SQR_THRESHOLD)
+      return cpSqr_BNU_school(pR, pA,ns);
+
+   {
+      cpSize m = (ns+1)/2;
+      cpSize k = ns - m;
+
+      BNU_CHUNK_T* pDa = pR;           /* |A0-A1|, m chunks, until Z0 is computed */
+      BNU_CHUNK_T* pM  = pBuffer;      /* |A0-A1|^2, then middle product, 2m+1 */
+      BNU_CHUNK_T* pNext = pM + 2*m+1;
+
+      BNU_CHUNK_T carry;
+      cpSize i;
+
+      kara_absdiff(pDa, pA, pA+m, k, m, pM);
+
+      cpSqrKaratsuba_BNU(pM, pDa, m, pNext);
+      pM[2*m] = 0;
+      cpSqrKaratsuba_BNU(pR, pA, m, pNext);
+      cpSqrKaratsuba_BNU(pR+2*m, pA+m, k, pNext);
+
+      /* M = Z0 + Z2 - P */
+      for(i=0; i<2*m+1; i++)
+         pM[i] = ~pM[i];
+      kara_inc(pM, 2*m+1, 1);
+      carry = cpAdd_BNU(pM, pM, pR, 2*m);
+      pM[2*m] += carry;
+      carry = cpAdd_BNU(pM, pM, pR+2*m, 2*k);
+      kara_inc(pM+2*k, 2*m+1-2*k, carry);
+
+      /* R += M*B^m */
+      carry = cpAdd_BNU(pR+m, pR+m, pM, 2*m+1);
+      kara_inc(pR+3*m+1, 2*ns-3*m-1, carry);
+
+      return pR[2*ns-1];
+   }
+}
+
+/*
+// Size (chunks) of the scratch buffer of cpMulLarge_BNU()
+*/
+IPP_OWN_DEFN (cpSize, cpMulLargeBufferSize, (cpSize nsA, cpSize nsB))
+{
+   cpSize ns = IPP_MIN(nsA, nsB);
+   /* unbalanced operands need the product of nsB x nsB block */
+   return cpKaratsubaBufferSize(ns) + ((nsA==nsB)? 0 : 2*ns);
+}
+
+/*F*
+//    Name: cpMulLarge_BNU
+//
+// Purpose: Multiply 2 BigNums, Karatsuba method is applied
+//          to the operands of KARATSUBA_THRESHOLD or more chunks
+//          if the scratch buffer is large enough.
+//
+// Returns:
+//    extension of result of multiply 2 BigNums
+//
+// Parameters:
+//    pR          resultant BigNum, nsA+nsB chunks
+//    pA          source BigNum A
+//    nsA         size of A
+//    pB          source BigNum B
+//    nsB         size of B
+//    pBuffer     scratch buffer (may be NULL)
+//    bufferLen   size of scratch buffer (chunks)
+//
+// Note:
+//    schoolbook multiplication is used if bufferLen < cpMulLargeBufferSize(nsA, nsB)
+//
+*F*/
+IPP_OWN_DEFN (BNU_CHUNK_T, cpMulLarge_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pB, cpSize nsB,
+                                            BNU_CHUNK_T* pBuffer, cpSize bufferLen))
+{
+   /* A is the longer one */
+   if(nsA < nsB) {
+      const BNU_CHUNK_T* pT = pA; cpSize nsT = nsA;
+      pA = pB; nsA = nsB;
+      pB = pT; nsB = nsT;
+   }
+
+   if(nsB < KARATSUBA_THRESHOLD || NULL == pBuffer || bufferLen < cpMulLargeBufferSize(nsA, nsB))
+      return cpMul_BNU_school(pR, pA,nsA, pB,nsB);
+
+   if(nsA == nsB)
+      cpMulKaratsuba_BNU(pR, pA, pB, nsB, pBuffer);
+
+   /* unbalanced: nsB x nsB blocks of A */
+   else {
+      BNU_CHUNK_T* product = pBuffer;
+      cpSize offset;
+
+      ZEXPAND_BNU(pR, 0, nsA+nsB);
+      for(offset=0; offset<nsA; offset+=nsB) {
+         cpSize len = IPP_MIN(nsB, nsA-offset);
+         BNU_CHUNK_T carry;
+
+         if(len == nsB)
+            cpMulKaratsuba_BNU(product, pA+offset, pB, nsB, product+2*nsB);
+         else
+            cpMul_BNU_school(product, pB,nsB, pA+offset,len);
+
+         carry = cpAdd_BNU(pR+offset, pR+offset, product, len+nsB);
+         kara_inc(pR+offset+len+nsB, nsA-offset-len, carry);
+      }
+   }
+
+   /* clear the used part of the scratch */
+   PurgeBlock(pBuffer, (int)sizeof(BNU_CHUNK_T)*cpMulLargeBufferSize(nsA, nsB));
+   return pR[nsA+nsB-1];
+}
+
+/*F*
+//    Name: cpSqrLarge_BNU
+//
+// Purpose: Square BigNum, Karatsuba method is applied
+//          to the operands of KARATSUBA_SQR_THRESHOLD or more chunks
+//          if the scratch buffer is large enough.
+//
+// Returns:
+//    extension of result of square BigNum
+//
+// Parameters:
+//    pR          resultant BigNum, 2*nsA chunks
+//    pA          source BigNum
+//    nsA         size of A
+//    pBuffer     scratch buffer (may be NULL)
+//    bufferLen   size of scratch buffer (chunks)
+//
+// Note:
+//    schoolbook squaring is used if bufferLen < cpKaratsubaBufferSize(nsA)
+//
+*F*/
+IPP_OWN_DEFN (BNU_CHUNK_T, cpSqrLarge_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA,
+                                            BNU_CHUNK_T* pBuffer, cpSize bufferLen))
+{
+   if(nsA < KARATSUBA_SQR_THRESHOLD || NULL == pBuffer || bufferLen < cpKaratsubaBufferSize(nsA))
+      return cpSqr_BNU_school(pR, pA,nsA);
+
+   cpSqrKaratsuba_BNU(pR, pA, nsA, pBuffer);
+
+   /* clear the used part of the scratch */
+   PurgeBlock(pBuffer, (int)sizeof(BNU_CHUNK_T)*cpKaratsubaBufferSize(nsA));
+   return pR[2*nsA-1];
+}
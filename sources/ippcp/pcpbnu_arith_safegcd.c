@@ -0,0 +1,394 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Internal Unsigned arithmetic
+//
+//  Contents:
+//     cpSafeGcdInv_BNU()
+//     cpSafeGcdInv_BNU_ct()
+//
+*/
+
+#include "owncp.h"
+#include "pcpbnuarith.h"
+#include "pcpbnumisc.h"
+#include "pcptool.h"
+
+/*
+// Modular inversion by divsteps (D.J. Bernstein, B.-Y. Yang, "Fast constant-time gcd
+// computation and modular inversion").
+//
+// The numbers are kept in signed 62-bit limbs: the low limbs are in [0, 2^62),
+// the top limb is signed. Divsteps are processed in batches of 62: a batch runs on
+// the low words of f and g only and produces the 2x2 transition matrix scaled by 2^62,
+// which is applied to the full-length (f,g) and (d,e) afterwards.
+//
+// Invariants: f = d*A/C, g = e*A/C (mod M). The loop starts with (f,g,d,e) = (M,A,0,C)
+// and ends with g = 0, f = +/-gcd(M,A), so d = +/-C/A (mod M).
+*/
+
+#define SGCD_LIMB_BITS     (62)
+#define SGCD_LIMB_MASK     ((Ipp64u)0x3FFFFFFFFFFFFFFF)
+#define SGCD_LEN(bitsize)  ((bitsize)/SGCD_LIMB_BITS +1)
+#define SGCD_MAX_LEN       SGCD_LEN(BN_MAXBITSIZE)
+
+/* signed 128-bit accumulator */
+typedef struct {
+   Ipp64u lo;
+   Ipp64u hi;
+} sgcd_acc;
+
+/* acc += a*b */
+__IPPCP_INLINE void sgcd_mac(sgcd_acc* acc, Ipp64s a, Ipp64s b)
+{
+#if defined(__SIZEOF_INT128__)
+   unsigned __int128 p = (unsigned __int128)((__int128)a * b);
+   Ipp64u lo = (Ipp64u)p;
+   Ipp64u hi = (Ipp64u)(p >> 64);
+#else
+   Ipp64u ua = (Ipp64u)a;
+   Ipp64u ub = (Ipp64u)b;
+   Ipp64u x0 = (ua & 0xFFFFFFFF) * (ub & 0xFFFFFFFF);
+   Ipp64u x1 = (ua & 0xFFFFFFFF) * (ub >> 32);
+   Ipp64u x2 = (ua >> 32) * (ub & 0xFFFFFFFF);
+   Ipp64u x3 = (ua >> 32) * (ub >> 32);
+   Ipp64u lo, hi;
+   x1 += x0 >> 32;
+   x1 += x2;
+   x3 += (Ipp64u)(x1 < x2) << 32;
+   hi = x3 + (x1 >> 32);
+   lo = (x1 << 32) + (x0 & 0xFFFFFFFF);
+   /* signed correction of the high part */
+   hi -= (ub & (Ipp64u)(a >> 63)) + (ua & (Ipp64u)(b >> 63));
+#endif
+   acc->lo += lo;
+   acc->hi += hi + (Ipp64u)(acc->lo < lo);
+}
+
+/* acc >>= 62 (arithmetic) */
+__IPPCP_INLINE void sgcd_shr(sgcd_acc* acc)
+{
+   acc->lo = (acc->lo >> SGCD_LIMB_BITS) | (acc->hi << (64-SGCD_LIMB_BITS));
+   acc->hi = (Ipp64u)((Ipp64s)acc->hi >> SGCD_LIMB_BITS);
+}
+
+/* signed 62-bit limbs from BNU */
+static void sgcd_from_bnu(Ipp64s* pR, int len, const BNU_CHUNK_T* pA, cpSize nsA)
+{
+   int i;
+   for(i=0; i<len; i++) {
+      int pos = i*SGCD_LIMB_BITS;
+      int got = 0;
+      Ipp64u x = 0;
+      while(got < SGCD_LIMB_BITS) {
+         int idx = (pos+got) / BNU_CHUNK_BITS;
+         int off = (pos+got) % BNU_CHUNK_BITS;
+         Ipp64u w = (idx < nsA)? (Ipp64u)(pA[idx] >> off) : 0;
+         x |= w << got;
+         got += BNU_CHUNK_BITS - off;
+      }
+      pR[i] = (Ipp64s)(x & SGCD_LIMB_MASK);
+   }
+}
+
+/* BNU from normalized signed 62-bit limbs */
+static void sgcd_to_bnu(BNU_CHUNK_T* pR, cpSize nsR, const Ipp64s* pA, int len)
+{
+   cpSize j;
+   for(j=0; j<nsR; j++) {
+      int pos = j*BNU_CHUNK_BITS;
+      int got = 0;
+      Ipp64u x = 0;
+      while(got < BNU_CHUNK_BITS) {
+         int idx = (pos+got) / SGCD_LIMB_BITS;
+         int off = (pos+got) % SGCD_LIMB_BITS;
+         Ipp64u w = (idx < len)? ((Ipp64u)pA[idx] & SGCD_LIMB_MASK) >> off : 0;
+         x |= w << got;
+         got += SGCD_LIMB_BITS - off;
+      }
+      pR[j] = (BNU_CHUNK_T)x;
+   }
+}
+
+/*
+// 62 divsteps on the low words of f and g
+// returns updated delta, pT[] = {u,v,q,r} such that
+//    2^62*(f',g') = (u*f + v*g, q*f + r*g)
+*/
+static Ipp64s sgcd_divsteps_62(Ipp64s delta, Ipp64u f, Ipp64u g, Ipp64s pT[4])
+{
+   Ipp64u u = 1, v = 0, q = 0, r = 1;
+   int i;
+
+   for(i=0; i<SGCD_LIMB_BITS; i++) {
+      /* if(delta>0 && isOdd(g)) { (delta,f,g) = (-delta,g,-f); } */
+      Ipp64u swap = (Ipp64u)((-delta) >> 63) & ((Ipp64u)0 - (g & 1));
+      Ipp64u odd;
+      Ipp64u x;
+      x = (f ^ g) & swap; f ^= x; g ^= x; g = (g ^ swap) - swap;
+      x = (u ^ q) & swap; u ^= x; q ^= x; q = (q ^ swap) - swap;
+      x = (v ^ r) & swap; v ^= x; r ^= x; r = (r ^ swap) - swap;
+      delta = (delta ^ (Ipp64s)swap) - (Ipp64s)swap + 1;
+
+      /* g = (g + isOdd(g)*f)/2 */
+      odd = (Ipp64u)0 - (g & 1);
+      g += f & odd;
+      q += u & odd;
+      r += v & odd;
+      g >>= 1;
+      u <<= 1;
+      v <<= 1;
+   }
+
+   pT[0] = (Ipp64s)u;
+   pT[1] = (Ipp64s)v;
+   pT[2] = (Ipp64s)q;
+   pT[3] = (Ipp64s)r;
+   return delta;
+}
+
+/* (f,g) = T*(f,g)/2^62 */
+static void sgcd_update_fg(Ipp64s* pF, Ipp64s* pG, int len, const Ipp64s pT[4])
+{
+   const Ipp64s u = pT[0], v = pT[1], q = pT[2], r = pT[3];
+   sgcd_acc cf = {0,0};
+   sgcd_acc cg = {0,0};
+   int i;
+
+   sgcd_mac(&cf, u, pF[0]); sgcd_mac(&cf, v, pG[0]);
+   sgcd_mac(&cg, q, pF[0]); sgcd_mac(&cg, r, pG[0]);
+   sgcd_shr(&cf);
+   sgcd_shr(&cg);
+
+   for(i=1; i<len; i++) {
+      sgcd_mac(&cf, u, pF[i]); sgcd_mac(&cf, v, pG[i]);
+      sgcd_mac(&cg, q, pF[i]); sgcd_mac(&cg, r, pG[i]);
+      pF[i-1] = (Ipp64s)(cf.lo & SGCD_LIMB_MASK);
+      pG[i-1] = (Ipp64s)(cg.lo & SGCD_LIMB_MASK);
+      sgcd_shr(&cf);
+      sgcd_shr(&cg);
+   }
+   pF[len-1] = (Ipp64s)cf.lo;
+   pG[len-1] = (Ipp64s)cg.lo;
+}
+
+/*
+// (d,e) = T*(d,e)/2^62 mod M
+// d and e are in (-2M,M) on input and output
+*/
+static void sgcd_update_de(Ipp64s* pD, Ipp64s* pE, int len, const Ipp64s pT[4], const Ipp64s* pM, Ipp64u mInv62)
+{
+   const Ipp64s u = pT[0], v = pT[1], q = pT[2], r = pT[3];
+   Ipp64s sd = pD[len-1] >> 63;
+   Ipp64s se = pE[len-1] >> 63;
+   /* the multiples of M to add: compensate negative d,e first */
+   Ipp64s md = (u & sd) + (v & se);
+   Ipp64s me = (q & sd) + (r & se);
+   sgcd_acc cd = {0,0};
+   sgcd_acc ce = {0,0};
+   int i;
+
+   sgcd_mac(&cd, u, pD[0]); sgcd_mac(&cd, v, pE[0]);
+   sgcd_mac(&ce, q, pD[0]); sgcd_mac(&ce, r, pE[0]);
+
+   /* make the low 62 bits of T*(d,e) + M*(md,me) zero */
+   md -= (Ipp64s)((mInv62 * cd.lo + (Ipp64u)md) & SGCD_LIMB_MASK);
+   me -= (Ipp64s)((mInv62 * ce.lo + (Ipp64u)me) & SGCD_LIMB_MASK);
+
+   sgcd_mac(&cd, pM[0], md);
+   sgcd_mac(&ce, pM[0], me);
+   sgcd_shr(&cd);
+   sgcd_shr(&ce);
+
+   for(i=1; i<len; i++) {
+      sgcd_mac(&cd, u, pD[i]); sgcd_mac(&cd, v, pE[i]); sgcd_mac(&cd, pM[i], md);
+      sgcd_mac(&ce, q, pD[i]); sgcd_mac(&ce, r, pE[i]); sgcd_mac(&ce, pM[i], me);
+      pD[i-1] = (Ipp64s)(cd.lo & SGCD_LIMB_MASK);
+      pE[i-1] = (Ipp64s)(ce.lo & SGCD_LIMB_MASK);
+      sgcd_shr(&cd);
+      sgcd_shr(&ce);
+   }
+   pD[len-1] = (Ipp64s)cd.lo;
+   pE[len-1] = (Ipp64s)ce.lo;
+}
+
+/* limbs back to [0,2^62), the carry goes to the top limb */
+static void sgcd_carry(Ipp64s* pR, int len)
+{
+   int i;
+   for(i=0; i<len-1; i++) {
+      pR[i+1] += pR[i] >> SGCD_LIMB_BITS;
+      pR[i] &= (Ipp64s)SGCD_LIMB_MASK;
+   }
+}
+
+/*
+// R = sign*R mod M, R in (-2M,M) on input, [0,M) on output
+// sign is the top limb of a +/-1 value
+*/
+static void sgcd_normalize(Ipp64s* pR, int len, Ipp64s sign, const Ipp64s* pM)
+{
+   Ipp64s add = pR[len-1] >> 63;
+   Ipp64s neg = sign >> 63;
+   int i;
+
+   for(i=0; i<len; i++)
+      pR[i] += pM[i] & add;
+   for(i=0; i<len; i++)
+      pR[i] = (pR[i] ^ neg) - neg;
+   sgcd_carry(pR, len);
+
+   add = pR[len-1] >> 63;
+   for(i=0; i<len; i++)
+      pR[i] += pM[i] & add;
+   sgcd_carry(pR, len);
+}
+
+/* returns all ones if F = +1 or F = -1, zero otherwise */
+static Ipp64u sgcd_is_unit(const Ipp64s* pF, int len)
+{
+   Ipp64u neg = (Ipp64u)(pF[len-1] >> 63);
+   Ipp64u diff = 0;
+   int i;
+   /* -1 is all ones in the low limbs and in the top one */
+   for(i=0; i<len; i++) {
+      Ipp64u expected = (i<len-1)? (SGCD_LIMB_MASK & neg) : neg;
+      if(0==i)
+         expected |= (Ipp64u)1 & ~neg;
+      diff |= (Ipp64u)pF[i] ^ expected;
+   }
+   /* diff==0 ? all ones : 0 */
+   return (Ipp64u)0 - (Ipp64u)(((diff | ((Ipp64u)0 - diff)) >> 63) ^ 1);
+}
+
+/*
+// number of divsteps sufficient for the bitsize-bit modulus
+// (theorem 11.2 of the paper)
+*/
+static int sgcd_iterations(int bitsize)
+{
+   return (bitsize < 46)? (49*bitsize +57)/17 : (49*bitsize +80)/17;
+}
+
+static int sgcd_inv(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pC, const BNU_CHUNK_T* pM, cpSize nsM, int ct)
+{
+   __ALIGN64 Ipp64s buffer[5*SGCD_MAX_LEN];
+
+   int bitsize = BITSIZE_BNU(pM, nsM);
+   int len = SGCD_LEN(bitsize);
+   int nBatches = (sgcd_iterations(bitsize) + SGCD_LIMB_BITS-1) / SGCD_LIMB_BITS;
+
+   Ipp64s* pF = buffer;
+   Ipp64s* pG = pF + len;
+   Ipp64s* pD = pG + len;
+   Ipp64s* pE = pD + len;
+   Ipp64s* pMod = pE + len;
+
+   Ipp64s delta = 1;
+   Ipp64s t[4];
+   Ipp64u mInv62;
+   Ipp64u isUnit;
+   int n, i;
+
+   sgcd_from_bnu(pMod, len, pM, nsM);
+   sgcd_from_bnu(pF, len, pM, nsM);
+   sgcd_from_bnu(pG, len, pA, nsA);
+   sgcd_from_bnu(pE, len, pC, nsM);
+   for(i=0; i<len; i++) pD[i] = 0;
+
+   /* mInv62 = 1/M mod 2^62 (Newton iterations double the number of the correct bits) */
+   mInv62 = (Ipp64u)pMod[0];
+   for(i=0; i<5; i++)
+      mInv62 *= 2 - (Ipp64u)pMod[0]*mInv62;
+   mInv62 &= SGCD_LIMB_MASK;
+
+   for(n=0; n<nBatches; n++) {
+      delta = sgcd_divsteps_62(delta, (Ipp64u)pF[0], (Ipp64u)pG[0], t);
+      sgcd_update_fg(pF, pG, len, t);
+      sgcd_update_de(pD, pE, len, t, pMod, mInv62);
+
+      /* variable-time version stops once g=0 */
+      if(!ct) {
+         Ipp64s z = 0;
+         for(i=0; i<len; i++) z |= pG[i];
+         if(0==z)
+            break;
+      }
+   }
+
+   /* g=0 here and f = +/-gcd(M,A) */
+   isUnit = sgcd_is_unit(pF, len);
+
+   sgcd_normalize(pD, len, pF[len-1], pMod);
+   sgcd_to_bnu(pR, nsM, pD, len);
+
+   PurgeBlock(buffer, 5*len*(int)sizeof(Ipp64s));
+   return (int)(isUnit & 1);
+}
+
+/*F*
+//    Name: cpSafeGcdInv_BNU_ct
+//
+// Purpose: Modular inversion, odd modulus.
+//          R = C/A mod M
+//
+// Returns:
+//    1     A is invertible
+//    0     gcd(A,M) != 1
+//
+// Parameters:
+//    pR    resultant BigNum, nsM chunks
+//    pA    source BigNum A, A < M
+//    nsA   size of A
+//    pC    source BigNum C, nsM chunks, C < M
+//    pM    odd modulus
+//    nsM   size of modulus
+//
+// Note:
+//    execution time depends on the bitsize of the modulus only
+//    inplace mode (pR==pA or pR==pC) is supported
+*F*/
+IPP_OWN_DEFN (int, cpSafeGcdInv_BNU_ct, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pC, const BNU_CHUNK_T* pM, cpSize nsM))
+{
+   return sgcd_inv(pR, pA, nsA, pC, pM, nsM, 1);
+}
+
+/*F*
+//    Name: cpSafeGcdInv_BNU
+//
+// Purpose: Modular inversion, odd modulus.
+//          R = C/A mod M
+//          (variable-time version of cpSafeGcdInv_BNU_ct)
+//
+// Returns:
+//    1     A is invertible
+//    0     gcd(A,M) != 1
+//
+// Parameters:
+//    pR    resultant BigNum, nsM chunks
+//    pA    source BigNum A, A < M
+//    nsA   size of A
+//    pC    source BigNum C, nsM chunks, C < M
+//    pM    odd modulus
+//    nsM   size of modulus
+*F*/
+IPP_OWN_DEFN (int, cpSafeGcdInv_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pC, const BNU_CHUNK_T* pM, cpSize nsM))
+{
+   return sgcd_inv(pR, pA, nsA, pC, pM, nsM, 0);
+}
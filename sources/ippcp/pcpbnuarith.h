@@ -106,6 +106,35 @@ __IPPCP_INLINE BNU_CHUNK_T cpSqr_BNU_school(BNU_CHUNK_T * pR, const BNU_CHUNK_T
 #endif
 }
 
+/*
+// Karatsuba multiplication/squaring
+//    KARATSUBA_THRESHOLD     - min size (chunks) of operands processed by Karatsuba step of multiplication
+//    KARATSUBA_SQR_THRESHOLD - the same for squaring
+//    KARATSUBA_POOL_LENGTH   - number of modLen-size pool elements taken by Montgomery mul/sqr
+//                              for the scratch (cpKaratsubaBufferSize(modLen) < 2*modLen)
+*/
+#define KARATSUBA_THRESHOLD      (32)
+#define KARATSUBA_SQR_THRESHOLD  (48)
+#define KARATSUBA_POOL_LENGTH    (2)
+
+#define cpKaratsubaBufferSize OWNAPI(cpKaratsubaBufferSize)
+   IPP_OWN_DECL (cpSize, cpKaratsubaBufferSize, (cpSize ns))
+#define cpMulKaratsuba_BNU OWNAPI(cpMulKaratsuba_BNU)
+   IPP_OWN_DECL (BNU_CHUNK_T, cpMulKaratsuba_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, cpSize ns, BNU_CHUNK_T* pBuffer))
+#define cpSqrKaratsuba_BNU OWNAPI(cpSqrKaratsuba_BNU)
+   IPP_OWN_DECL (BNU_CHUNK_T, cpSqrKaratsuba_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize ns, BNU_CHUNK_T* pBuffer))
+#define cpMulLargeBufferSize OWNAPI(cpMulLargeBufferSize)
+   IPP_OWN_DECL (cpSize, cpMulLargeBufferSize, (cpSize nsA, cpSize nsB))
+#define cpMulLarge_BNU OWNAPI(cpMulLarge_BNU)
+   IPP_OWN_DECL (BNU_CHUNK_T, cpMulLarge_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pB, cpSize nsB, BNU_CHUNK_T* pBuffer, cpSize bufferLen))
+#define cpSqrLarge_BNU OWNAPI(cpSqrLarge_BNU)
+   IPP_OWN_DECL (BNU_CHUNK_T, cpSqrLarge_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, BNU_CHUNK_T* pBuffer, cpSize bufferLen))
+
+#define cpSafeGcdInv_BNU OWNAPI(cpSafeGcdInv_BNU)
+   IPP_OWN_DECL (int, cpSafeGcdInv_BNU, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pC, const BNU_CHUNK_T* pM, cpSize nsM))
+#define cpSafeGcdInv_BNU_ct OWNAPI(cpSafeGcdInv_BNU_ct)
+   IPP_OWN_DECL (int, cpSafeGcdInv_BNU_ct, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, cpSize nsA, const BNU_CHUNK_T* pC, const BNU_CHUNK_T* pM, cpSize nsM))
+
 #define cpGcd_BNU OWNAPI(cpGcd_BNU)
    IPP_OWN_DECL (BNU_CHUNK_T, cpGcd_BNU, (BNU_CHUNK_T a, BNU_CHUNK_T b))
 #define cpModInv_BNU OWNAPI(cpModInv_BNU)
@@ -48,6 +48,7 @@ struct _cpDLP {
    int               bitSizeR;   /* DH bitsize (R) */
 
    int               method;     /* exponentiation method: binary/window */
+   int               stdGroup;   /* RFC 7919 named group (0 if arbitrary) */
    gsModEngine*      pMontP0;    /* Montgomery P-engine */
    gsModEngine*      pMontP1;    /* Montgomery P-engine (for multithread version) */
    gsModEngine*      pMontR;     /* Montgomery R-engine */
@@ -84,6 +85,7 @@ struct _cpDLP {
 #define DLP_BITSIZEP(ctx)  ((ctx)->bitSizeP)
 #define DLP_BITSIZER(ctx)  ((ctx)->bitSizeR)
 #define DLP_EXPMETHOD(ctx) ((ctx)->method)
+#define DLP_STDGROUP(ctx)  ((ctx)->stdGroup)
 
 #define DLP_MONTP0(ctx)    ((ctx)->pMontP0)
 #define DLP_MONTP1(ctx)    ((ctx)->pMontP1)
@@ -111,7 +113,56 @@ struct _cpDLP {
 #define DLP_ALIGNMENT ((int)(sizeof(void*)))
 
 /* pool size for gsModEngine */
-#define DLP_MONT_POOL_LENGTH (6)
+#define DLP_MONT_POOL_LENGTH (6 + KARATSUBA_POOL_LENGTH)
+
+/*
+// RFC 7919 named groups: p = 2^b - 2^(b-64) + {[2^(b-130) e] + X} * 2^64 - 1,
+// q = (p-1)/2, g = 2
+*/
+extern const BNU_CHUNK_T ffdhe2048_p[];
+extern const BNU_CHUNK_T ffdhe3072_p[];
+extern const BNU_CHUNK_T ffdhe4096_p[];
+extern const BNU_CHUNK_T ffdhe6144_p[];
+extern const BNU_CHUNK_T ffdhe8192_p[];
+
+/* returns bitsize of the named group modulus (0 if group is unknown) */
+__IPPCP_INLINE int cpDLPStdGroupBitSize(IppDLPStdGroup group, const BNU_CHUNK_T** ppP)
+{
+   const BNU_CHUNK_T* pP = NULL;
+   int bitSize = 0;
+   switch(group) {
+      case ippDLPffdhe2048: pP = ffdhe2048_p; bitSize = 2048; break;
+      case ippDLPffdhe3072: pP = ffdhe3072_p; bitSize = 3072; break;
+      case ippDLPffdhe4096: pP = ffdhe4096_p; bitSize = 4096; break;
+      case ippDLPffdhe6144: pP = ffdhe6144_p; bitSize = 6144; break;
+      case ippDLPffdhe8192: pP = ffdhe8192_p; bitSize = 8192; break;
+      default: break;
+   }
+   if(ppP)
+      *ppP = pP;
+   return bitSize;
+}
+
+/* window size of the 2^E exponentiation */
+#define DLP_EXPG2_WINSIZE (6)
+
+#define cpDLPMontExpG2_BNU OWNAPI(cpDLPMontExpG2_BNU)
+   IPP_OWN_DECL (cpSize, cpDLPMontExpG2_BNU, (BNU_CHUNK_T* pY, const BNU_CHUNK_T* pE, cpSize nsE, gsModEngine* pMont))
+
+/* returns ippStsMemAllocErr if the Montgomery engine pool is exhausted */
+__IPPCP_INLINE IppStatus cpDLPMontExpG2_BN(IppsBigNumState* pYbn,
+                               const IppsBigNumState* pEbn,
+                                     gsModEngine*     pMont)
+{
+   BNU_CHUNK_T* pY = BN_NUMBER(pYbn);
+   cpSize nsY = cpDLPMontExpG2_BNU(pY, BN_NUMBER(pEbn), BN_SIZE(pEbn), pMont);
+   if(nsY < 0)
+      return ippStsMemAllocErr;
+   FIX_BNU(pY, nsY);
+   BN_SIZE(pYbn) = nsY;
+   BN_SIGN(pYbn) = ippBigNumPOS;
+   return ippStsNoErr;
+}
 
 #define cpPackDLPCtx OWNAPI(cpPackDLPCtx)
    IPP_OWN_DECL (void, cpPackDLPCtx, (const IppsDLPState* pDLP, Ipp8u* pBuffer))
@@ -0,0 +1,124 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Finite Field (named groups)
+//
+//  Contents:
+//     cpDLPMontExpG2_BNU()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+#include "pcpmask_ct.h"
+
+/* extract w-bit digit of E starting at bit position bitPos */
+__IPPCP_INLINE BNU_CHUNK_T dlpGetDigit(const BNU_CHUNK_T* pE, cpSize nsE, int bitPos, int w)
+{
+   int idx = bitPos / BNU_CHUNK_BITS;
+   int shift = bitPos % BNU_CHUNK_BITS;
+   BNU_CHUNK_T digit = pE[idx] >> shift;
+   if((shift+w)>BNU_CHUNK_BITS && (idx+1)<nsE)
+      digit |= pE[idx+1] << (BNU_CHUNK_BITS-shift);
+   return digit & (((BNU_CHUNK_T)1<<w) -1);
+}
+
+/*
+// Y = Y*2^d mod P, 0 <= d < BNU_CHUNK_BITS
+//
+// Y*2^d = H*2^N + L, where N = BNU_CHUNK_BITS*nsM and H < 2^d.
+// Since 2^N = MOD_MNT_R (mod P), Y*2^d = H*MOD_MNT_R + L (mod P).
+//
+// The upper chunk of the named group modulus is all ones,
+// so MOD_MNT_R < 2^(N-BNU_CHUNK_BITS) and H*MOD_MNT_R + L < 2*P:
+// a single (constant time) conditional subtraction is enough.
+*/
+static void dlpMulPow2(BNU_CHUNK_T* pY, BNU_CHUNK_T d, BNU_CHUNK_T* pT, gsModEngine* pMont)
+{
+   const BNU_CHUNK_T* pM = MOD_MODULUS(pMont);
+   cpSize nsM = MOD_LEN(pMont);
+   int rshift = (int)(BNU_CHUNK_BITS-1 -d);
+   BNU_CHUNK_T hi, extension;
+   cpSize n;
+
+   /* (y>>1)>>(BNU_CHUNK_BITS-1-d) avoids the shift by BNU_CHUNK_BITS if d==0 */
+   hi = (pY[nsM-1]>>1) >> rshift;
+   for(n=nsM-1; n>0; n--)
+      pY[n] = (pY[n]<<d) | ((pY[n-1]>>1) >> rshift);
+   pY[0] <<= d;
+
+   extension = cpAddMulDgt_BNU(pY, MOD_MNT_R(pMont), nsM, hi);
+   extension -= cpSub_BNU(pT, pY, pM, nsM);
+   cpMaskedReplace_ct(pY, pT, nsM, cpIsZero_ct(extension));
+}
+
+/*F*
+// Name: cpDLPMontExpG2_BNU
+//
+// Purpose: computes the Montgomery exponentiation 2^E
+//          over the RFC 7919 named group modulus.
+//
+// Returns:
+//      Length of modulus
+//      -1 if Montgomery engine pool is exhausted
+//
+// Parameters:
+//      pY        the Montgomery exponentiation result (Montgomery domain)
+//      pE        big number exponent
+//      nsE       length of the exponent
+//      pMont     Montgomery engine of the named group modulus
+//
+// Note:
+//    - exponent is processed by fixed size windows to the whole nsE length,
+//      so the running time depends on nsE only
+//    - multiplication by the base g=2 is replaced by shift
+//
+*F*/
+IPP_OWN_DEFN (cpSize, cpDLPMontExpG2_BNU, (BNU_CHUNK_T* pY, const BNU_CHUNK_T* pE, cpSize nsE, gsModEngine* pMont))
+{
+   cpSize nsM = MOD_LEN(pMont);
+
+   const int usedPoolLen = 1;
+   BNU_CHUNK_T* pT = gsModPoolAlloc(pMont, usedPoolLen);
+   if(NULL == pT)
+      return -1;
+
+   {
+      const int winSize = DLP_EXPG2_WINSIZE;
+      int bitSizeE = ((nsE*BNU_CHUNK_BITS + winSize-1)/winSize) * winSize;
+      int eBit = bitSizeE - winSize;
+      int n;
+
+      /* Y = mont(1) * 2^(first window) */
+      COPY_BNU(pY, MOD_MNT_R(pMont), nsM);
+      dlpMulPow2(pY, dlpGetDigit(pE, nsE, eBit, winSize), pT, pMont);
+
+      for(eBit-=winSize; eBit>=0; eBit-=winSize) {
+         for(n=0; n<winSize; n++)
+            MOD_METHOD(pMont)->sqr(pY, pY, pMont);
+         dlpMulPow2(pY, dlpGetDigit(pE, nsE, eBit, winSize), pT, pMont);
+      }
+   }
+
+   gsModPoolFree(pMont, usedPoolLen);
+   return nsM;
+}
@@ -32,6 +32,27 @@
 #include "pcpdlp.h"
 #include "hash/pcphashmethod_rmf.h"
 
+/*
+// Primality test of the DH domain parameter candidates.
+// Candidates are derived from SEED, so the sieve is not applicable, but
+// Miller-Rabin rounds are evaluated by the workers of the prime generator (if any).
+// Domain parameters are public, so the exponentiation is not constant time.
+*/
+static int dlpPrimeTest(const BNU_CHUNK_T* pPrime, cpSize ns, int nTrials,
+                        IppsPrimeState* pPrimeGen,
+                        IppBitSupplier rndFunc, void* pRndParam)
+{
+   cpPrimeMRSlot localSlot;
+   cpPrimeWorkers workers;
+
+   FIX_BNU(pPrime, ns);
+   if(0==cpMimimalPrimeTest((Ipp32u*)pPrime, BITS2WORD32_SIZE(BITSIZE_BNU(pPrime, ns))))
+      return 0;
+
+   cpPrimeGetWorkers(&workers, &localSlot, pPrimeGen, 0);
+   return cpPrimeTestMR(pPrime, ns, nTrials, &workers, rndFunc, pRndParam);
+}
+
 /*F*
 //    Name: ippsDLPGenerateDH
 //
@@ -57,6 +78,8 @@
 //    ippStsInsufficientEntropy
 //                            generation failure due to poor random generator
 //
+//    ippStsErr               internal error of the primality test
+//
 //    ippStsNoErr             no errors
 //
 // Parameters:
@@ -71,6 +94,7 @@
 // Note:
 //    1) pSeedIn==NULL means, that rndFunc will be used for input seed generation
 //    2) PseedIn!=NULL limited by DL bitsizeP parameter!
+//    3) primality tests use the workers set up by ippsDLPSetWorkers()
 *F*/
 #define MAXLOOP (4096)
 
@@ -108,6 +132,7 @@ IPPFUN(IppStatus, ippsDLPGenerateDH,(const IppsBigNumState* pSeedIn,
       int seedBitSize = DLP_BITSIZER(pDL);
 
       DLP_FLAG(pDL) = 0;
+      DLP_STDGROUP(pDL) = 0;
       /*
       // DH generator uses input SEED
       // either defined by user or generated internally
@@ -235,7 +260,9 @@ IPPFUN(IppStatus, ippsDLPGenerateDH,(const IppsBigNumState* pSeedIn,
             /* perform primality test on Q */
             //ippsPrimeSet_BN(pR, pPrimeGen);
             //ippsPrimeTest(nTrials, &result, pPrimeGen, rndFunc, pRndParam);
-            primeGenerated = cpPrimeTest(BN_NUMBER(pR), BN_SIZE(pR), nTrials, pPrimeGen, rndFunc, pRndParam);
+            primeGenerated = dlpPrimeTest(BN_NUMBER(pR), BN_SIZE(pR), nTrials, pPrimeGen, rndFunc, pRndParam);
+            if(0>primeGenerated)
+               return ippStsErr;
             if(!primeGenerated)
                seed_is_random = ippTrue;
          }
@@ -295,7 +322,9 @@ IPPFUN(IppStatus, ippsDLPGenerateDH,(const IppsBigNumState* pSeedIn,
                //ippsPrimeTest(nTrials, &result, pPrimeGen, rndFunc, pRndParam);
                //if(IS_PRIME==result)
                //   break;
-               primeGenerated = cpPrimeTest(BN_NUMBER(pP), BN_SIZE(pP), nTrials, pPrimeGen, rndFunc, pRndParam);
+               primeGenerated = dlpPrimeTest(BN_NUMBER(pP), BN_SIZE(pP), nTrials, pPrimeGen, rndFunc, pRndParam);
+               if(0>primeGenerated)
+                  return ippStsErr;
                if(primeGenerated)
                   break;
             }
@@ -115,6 +115,7 @@ IPPFUN(IppStatus, ippsDLPGenerateDSA,(const IppsBigNumState* pSeedIn,
       IppBool seed_is_random = ippTrue;
 
       DLP_FLAG(pDL) = 0;
+      DLP_STDGROUP(pDL) = 0;
       /*
       // DSA generator uses input SEED
       // either defined by user or generated internally
@@ -51,6 +51,8 @@
 //                               pPrivate,
 //                               pPublic
 //
+//    ippStsMemAllocErr          Montgomery engine pool is exhausted (named group)
+//
 //    ippStsNoErr                no error
 //
 // Parameters:
@@ -105,7 +107,12 @@ IPPFUN(IppStatus, ippsDLPGenKeyPair,(IppsBigNumState* pPrvKey, IppsBigNumState*
       /*
       // compute public key: G^prvKey (mod P)
       */
-      cpMontExpBin_BN_sscm(pPubKey, DLP_GENC(pDL), pPrvKey, DLP_MONTP0(pDL));
+      if(DLP_STDGROUP(pDL)) {
+         IppStatus sts = cpDLPMontExpG2_BN(pPubKey, pPrvKey, DLP_MONTP0(pDL));
+         IPP_BADARG_RET(ippStsNoErr!=sts, sts);
+      }
+      else
+         cpMontExpBin_BN_sscm(pPubKey, DLP_GENC(pDL), pPrvKey, DLP_MONTP0(pDL));
       cpMontDec_BN(pPubKey, pPubKey, DLP_MONTP0(pDL));
 
       return ippStsNoErr;
@@ -0,0 +1,62 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Field (initialization)
+//
+//  Contents:
+//        ippsDLPGetSizeStd()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+
+/*F*
+//    Name: ippsDLPGetSizeStd
+//
+// Purpose: Returns size of DL context (bytes) of the RFC 7919 named group.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pSize
+//
+//    ippStsBadArgErr            unknown group
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    group       named group (ippDLPffdhe2048, ..., ippDLPffdhe8192)
+//    pSize       pointer to the size of DLP context (bytes)
+//
+*F*/
+IPPFUN(IppStatus, ippsDLPGetSizeStd,(IppDLPStdGroup group, int* pSize))
+{
+   /* test size's pointer */
+   IPP_BAD_PTR1_RET(pSize);
+
+   {
+      int feBitSize = cpDLPStdGroupBitSize(group, NULL);
+      IPP_BADARG_RET(0==feBitSize, ippStsBadArgErr);
+
+      /* order of the generator is q = (p-1)/2 */
+      return ippsDLPGetSize(feBitSize, feBitSize-1, pSize);
+   }
+}
@@ -67,6 +67,7 @@ IPPFUN(IppStatus, ippsDLPInit,(int feBitSize, int ordBitSize, IppsDLPState* pDL)
    DLP_BITSIZEP(pDL) = feBitSize;
    DLP_BITSIZER(pDL) = ordBitSize;
    DLP_EXPMETHOD(pDL)= BINARY;
+   DLP_STDGROUP(pDL) = 0;
 
    /*
    // init other context fields
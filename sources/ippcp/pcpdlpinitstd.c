@@ -0,0 +1,95 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Field (initialization)
+//
+//  Contents:
+//        ippsDLPInitStd()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsDLPInitStd
+//
+// Purpose: Init DL context by the RFC 7919 named group domain parameters:
+//          P, R = (P-1)/2 and G = 2.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pDL
+//
+//    ippStsBadArgErr            unknown group
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    group       named group (ippDLPffdhe2048, ..., ippDLPffdhe8192)
+//    pDL         pointer to the DL context
+//
+// Note:
+//    Size of the context must be obtained by ippsDLPGetSizeStd() for the same group.
+//    Key generation and public key computation of the initialized context
+//    use the dedicated G = 2 exponentiation.
+//
+*F*/
+IPPFUN(IppStatus, ippsDLPInitStd,(IppDLPStdGroup group, IppsDLPState* pDL))
+{
+   const BNU_CHUNK_T* pP;
+   int feBitSize;
+
+   /* test DL context */
+   IPP_BAD_PTR1_RET(pDL);
+
+   feBitSize = cpDLPStdGroupBitSize(group, &pP);
+   IPP_BADARG_RET(0==feBitSize, ippStsBadArgErr);
+
+   {
+      IppStatus sts = ippsDLPInit(feBitSize, feBitSize-1, pDL);
+      if(ippStsNoErr!=sts)
+         return sts;
+   }
+
+   {
+      cpSize nsP = BITS_BNU_CHUNK(feBitSize);
+
+      BigNumNode* pList = DLP_BNCTX(pDL);
+      IppsBigNumState* pR = cpBigNumListGet(&pList);
+
+      /* P */
+      gsModEngineInit(DLP_MONTP0(pDL), (const Ipp32u*)pP, feBitSize, DLP_MONT_POOL_LENGTH, gsModArithDLP());
+
+      /* R = (P-1)/2 */
+      cpLSR_BNU(BN_NUMBER(pR), pP, nsP, 1);
+      gsModEngineInit(DLP_MONTR(pDL), (Ipp32u*)BN_NUMBER(pR), feBitSize-1, DLP_MONT_POOL_LENGTH, gsModArithDLP());
+
+      /* G = 2 */
+      cpMontEnc_BN(DLP_GENC(pDL), cpBN_TwoRef(), DLP_MONTP0(pDL));
+
+      DLP_FLAG(pDL) = ippDLPkeyP|ippDLPkeyR|ippDLPkeyG;
+      DLP_STDGROUP(pDL) = (int)group;
+
+      return ippStsNoErr;
+   }
+}
@@ -50,6 +50,8 @@
 //
 //    ippStsRangeErr             not enough room for pPubKey
 //
+//    ippStsMemAllocErr          Montgomery engine pool is exhausted (named group)
+//
 //    ippStsNoErr                no error
 //
 // Parameters:
@@ -94,7 +96,12 @@ IPPFUN(IppStatus, ippsDLPPublicKey,(const IppsBigNumState* pPrvKey,
       BN_SIZE(pTmpPrivKey) = ordLen;
 
       /* compute public key:  G^prvKey (mod P) */
-      cpMontExpBin_BN_sscm(pPubKey, DLP_GENC(pDL), pTmpPrivKey, pME);
+      if(DLP_STDGROUP(pDL)) {
+         IppStatus sts = cpDLPMontExpG2_BN(pPubKey, pTmpPrivKey, pME);
+         IPP_BADARG_RET(ippStsNoErr!=sts, sts);
+      }
+      else
+         cpMontExpBin_BN_sscm(pPubKey, DLP_GENC(pDL), pTmpPrivKey, pME);
       cpMontDec_BN(pPubKey, pPubKey, pME);
 
       return ippStsNoErr;
@@ -89,6 +89,7 @@ IPPFUN(IppStatus, ippsDLPSet,(const IppsBigNumState* pP,
       IppStatus sts;
 
       DLP_FLAG(pDL) = 0;
+      DLP_STDGROUP(pDL) = 0;
 
       cpBN_zero(DLP_X(pDL));
       cpBN_zero(DLP_YENC(pDL));
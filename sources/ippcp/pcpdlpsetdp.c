@@ -72,6 +72,7 @@ IPPFUN(IppStatus, ippsDLPSetDP,(const IppsBigNumState* pDP, IppDLPKeyTag tag, Ip
 
       cpBN_zero(DLP_X(pDL));
       cpBN_zero(DLP_YENC(pDL));
+      DLP_STDGROUP(pDL) = 0;
 
       switch(tag) {
          case ippDLPkeyP:
@@ -0,0 +1,65 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Finite Field (generate domain parameters)
+//
+//  Contents:
+//        ippsDLPSetWorkers()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+
+/*F*
+//    Name: ippsDLPSetWorkers
+//
+// Purpose: Sets up the workers evaluating Miller-Rabin rounds
+//          of ippsDLPGenerateDH()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pDL
+//                               NULL == pWorkBuffer, if 0 < nWorkers
+//
+//    ippStsContextMatchErr      illegal pDL->idCtx
+//
+//    ippStsBadArgErr            0 > nWorkers
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    runFunc     external task runner (NULL for the sequential evaluation)
+//    pRunParam   pointer to the task runner parameters
+//    nWorkers    number of the workers (0 resets the workers)
+//    pWorkBuffer buffer of ippsDLPWorkBufferSize() bytes
+//    pDL         pointer to the DL context
+//
+*F*/
+IPPFUN(IppStatus, ippsDLPSetWorkers,(IppTaskRunner runFunc, void* pRunParam,
+                                     int nWorkers, Ipp8u* pWorkBuffer,
+                                     IppsDLPState* pDL))
+{
+   IPP_BAD_PTR1_RET(pDL);
+   IPP_BADARG_RET(!DLP_VALID_ID(pDL), ippStsContextMatchErr);
+
+   return ippsPrimeSetWorkers(runFunc, pRunParam, nWorkers, pWorkBuffer, DLP_PRIMEGEN(pDL));
+}
@@ -166,7 +166,7 @@ IPPFUN(IppStatus, ippsDLPSignDSA,(const IppsBigNumState* pMsgDigest,
 
                ZEXPAND_COPY_BNU(buffS, ordLen, BN_NUMBER(DLP_X(pDL)), BN_SIZE(DLP_X(pDL)));
                /* (1/eX) in Montgomery domain  */
-               gs_mont_inv(buffS, buffS, pMontR, alm_mont_inv_ct);
+               gs_mont_inv(buffS, buffS, pMontR, sgcd_mont_inv_ct);
 
                /* signS = (1/eX)*(MsgDigest + X*signR) */
                MOD_METHOD(pMontR)->mul(dataS, dataS, buffS, pMontR);
@@ -0,0 +1,145 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Finite Field (RFC 7919 named groups)
+//
+//  Contents:
+//     ffdhe2048, ffdhe3072, ffdhe4096, ffdhe6144, ffdhe8192
+//
+//  Note:
+//     p = 2^b - 2^(b-64) + {[2^(b-130) e] + X} * 2^64 - 1,
+//     q = (p-1)/2 and the generator g = 2
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+
+#if defined( _IPP_DATA )
+
+/* ffdhe2048 (X = 560316) */
+const BNU_CHUNK_T ffdhe2048_p[] = {
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0x61285C97, 0x886B4238), LL(0xC1B2EFFA, 0xC6F34A26), LL(0x7D1683B2, 0xC58EF183),
+   LL(0x2EC22005, 0x3BB5FCBC), LL(0x4C6FAD73, 0xC3FE3B1B), LL(0xEEF28183, 0x8E4F1232), LL(0xE98583FF, 0x9172FE9C),
+   LL(0x28342F61, 0xC03404CD), LL(0xCDF7E2EC, 0x9E02FCE1), LL(0xEE0A6D70, 0x0B07A7C8), LL(0x6372BB19, 0xAE56EDE7),
+   LL(0xDE394DF4, 0x1D4F42A3), LL(0x60D7F468, 0xB96ADAB7), LL(0xB2C8E3FB, 0xD108A94B), LL(0xB324FB61, 0xBC0AB182),
+   LL(0x483A797A, 0x30ACCA4F), LL(0x36ADE735, 0x1DF158A1), LL(0xF3EFE872, 0xE2A689DA), LL(0xE0E68B77, 0x984F0C70),
+   LL(0x7F57C935, 0xB557135E), LL(0x3DED1AF3, 0x85636555), LL(0x5F066ED0, 0x2433F51F), LL(0xD5FD6561, 0xD3DF1ED5),
+   LL(0xAEC4617A, 0xF681B202), LL(0x630C75D8, 0x7D2FE363), LL(0x249B3EF9, 0xCC939DCE), LL(0x146433FB, 0xA9E13641),
+   LL(0xCE2D3695, 0xD8B9C583), LL(0x273D3CF1, 0xAFDC5620), LL(0xA2BB4A9A, 0xADF85458), LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+/* ffdhe3072 (X = 2625351) */
+const BNU_CHUNK_T ffdhe3072_p[] = {
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0x66C62E37, 0x25E41D2B), LL(0x3FD59D7C, 0x3C1B20EE), LL(0xFA53DDEF, 0x0ABCD06B),
+   LL(0xD5C4484E, 0x1DBF9A42), LL(0x9B0DEADA, 0xABC52197), LL(0x22363A0D, 0xE86D2BC5), LL(0x9C9DF69E, 0x5CAE82AB),
+   LL(0x71F54BFF, 0x64F2E21E), LL(0xE2D74DD3, 0xF4FD4452), LL(0xBC437944, 0xB4130C93), LL(0x85139270, 0xAEFE1309),
+   LL(0xC186D91C, 0x598CB0FA), LL(0x91F7F7EE, 0x7AD91D26), LL(0xD6E6C907, 0x61B46FC9), LL(0xF99C0238, 0xBC34F4DE),
+   LL(0x6519035B, 0xDE355B3B), LL(0x611FCFDC, 0x886B4238), LL(0xC1B2EFFA, 0xC6F34A26), LL(0x7D1683B2, 0xC58EF183),
+   LL(0x2EC22005, 0x3BB5FCBC), LL(0x4C6FAD73, 0xC3FE3B1B), LL(0xEEF28183, 0x8E4F1232), LL(0xE98583FF, 0x9172FE9C),
+   LL(0x28342F61, 0xC03404CD), LL(0xCDF7E2EC, 0x9E02FCE1), LL(0xEE0A6D70, 0x0B07A7C8), LL(0x6372BB19, 0xAE56EDE7),
+   LL(0xDE394DF4, 0x1D4F42A3), LL(0x60D7F468, 0xB96ADAB7), LL(0xB2C8E3FB, 0xD108A94B), LL(0xB324FB61, 0xBC0AB182),
+   LL(0x483A797A, 0x30ACCA4F), LL(0x36ADE735, 0x1DF158A1), LL(0xF3EFE872, 0xE2A689DA), LL(0xE0E68B77, 0x984F0C70),
+   LL(0x7F57C935, 0xB557135E), LL(0x3DED1AF3, 0x85636555), LL(0x5F066ED0, 0x2433F51F), LL(0xD5FD6561, 0xD3DF1ED5),
+   LL(0xAEC4617A, 0xF681B202), LL(0x630C75D8, 0x7D2FE363), LL(0x249B3EF9, 0xCC939DCE), LL(0x146433FB, 0xA9E13641),
+   LL(0xCE2D3695, 0xD8B9C583), LL(0x273D3CF1, 0xAFDC5620), LL(0xA2BB4A9A, 0xADF85458), LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+/* ffdhe4096 (X = 5736041) */
+const BNU_CHUNK_T ffdhe4096_p[] = {
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0x5E655F6A, 0xC68A007E), LL(0xF44182E1, 0x4DB5A851), LL(0x7F88A46B, 0x8EC9B55A),
+   LL(0xCEC97DCF, 0x0A8291CD), LL(0xF98D0ACC, 0x2A4ECEA9), LL(0x7140003C, 0x1A1DB93D), LL(0x33CB8B7A, 0x092999A3),
+   LL(0x71AD0038, 0x6DC778F9), LL(0x918130C4, 0xA907600A), LL(0x2D9E6832, 0xED6A1E01), LL(0xEFB4318A, 0x7135C886),
+   LL(0x7E31CC7A, 0x87F55BA5), LL(0x55034004, 0x7763CF1D), LL(0xD69F6D18, 0xAC7D5F42), LL(0xE58857B6, 0x7930E9E4),
+   LL(0x164DF4FB, 0x6E6F52C3), LL(0x669E1EF1, 0x25E41D2B), LL(0x3FD59D7C, 0x3C1B20EE), LL(0xFA53DDEF, 0x0ABCD06B),
+   LL(0xD5C4484E, 0x1DBF9A42), LL(0x9B0DEADA, 0xABC52197), LL(0x22363A0D, 0xE86D2BC5), LL(0x9C9DF69E, 0x5CAE82AB),
+   LL(0x71F54BFF, 0x64F2E21E), LL(0xE2D74DD3, 0xF4FD4452), LL(0xBC437944, 0xB4130C93), LL(0x85139270, 0xAEFE1309),
+   LL(0xC186D91C, 0x598CB0FA), LL(0x91F7F7EE, 0x7AD91D26), LL(0xD6E6C907, 0x61B46FC9), LL(0xF99C0238, 0xBC34F4DE),
+   LL(0x6519035B, 0xDE355B3B), LL(0x611FCFDC, 0x886B4238), LL(0xC1B2EFFA, 0xC6F34A26), LL(0x7D1683B2, 0xC58EF183),
+   LL(0x2EC22005, 0x3BB5FCBC), LL(0x4C6FAD73, 0xC3FE3B1B), LL(0xEEF28183, 0x8E4F1232), LL(0xE98583FF, 0x9172FE9C),
+   LL(0x28342F61, 0xC03404CD), LL(0xCDF7E2EC, 0x9E02FCE1), LL(0xEE0A6D70, 0x0B07A7C8), LL(0x6372BB19, 0xAE56EDE7),
+   LL(0xDE394DF4, 0x1D4F42A3), LL(0x60D7F468, 0xB96ADAB7), LL(0xB2C8E3FB, 0xD108A94B), LL(0xB324FB61, 0xBC0AB182),
+   LL(0x483A797A, 0x30ACCA4F), LL(0x36ADE735, 0x1DF158A1), LL(0xF3EFE872, 0xE2A689DA), LL(0xE0E68B77, 0x984F0C70),
+   LL(0x7F57C935, 0xB557135E), LL(0x3DED1AF3, 0x85636555), LL(0x5F066ED0, 0x2433F51F), LL(0xD5FD6561, 0xD3DF1ED5),
+   LL(0xAEC4617A, 0xF681B202), LL(0x630C75D8, 0x7D2FE363), LL(0x249B3EF9, 0xCC939DCE), LL(0x146433FB, 0xA9E13641),
+   LL(0xCE2D3695, 0xD8B9C583), LL(0x273D3CF1, 0xAFDC5620), LL(0xA2BB4A9A, 0xADF85458), LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+/* ffdhe6144 (X = 15705020) */
+const BNU_CHUNK_T ffdhe6144_p[] = {
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0xD0E40E65, 0xA40E329C), LL(0x7938DAD4, 0xA41D570D), LL(0xD43161C1, 0x62A69526),
+   LL(0x9ADB1E69, 0x3FDD4A8E), LL(0xDC6B80D6, 0x5B3B71F9), LL(0xC6272B04, 0xEC9D1810), LL(0xCACEF403, 0x8CCF2DD5),
+   LL(0xC95B9117, 0xE49F5235), LL(0xB854338A, 0x505DC82D), LL(0x1562A846, 0x62292C31), LL(0x6AE77F5E, 0xD72B0374),
+   LL(0x462D538C, 0xF9C9091B), LL(0x47A67CBE, 0x0AE8DB58), LL(0x22611682, 0xB3A739C1), LL(0x2A281BF6, 0xEEAAC023),
+   LL(0x77CAF992, 0x94C6651E), LL(0x94B2BBC1, 0x763E4E4B), LL(0x0077D9B4, 0x587E38DA), LL(0x183023C3, 0x7FB29F8C),
+   LL(0xF9E3A26E, 0x0ABEC1FF), LL(0x350511E3, 0xA00EF092), LL(0xDB6340D8, 0xB855322E), LL(0xA9A96910, 0xA52471F7),
+   LL(0x4CFDB477, 0x388147FB), LL(0x4E46041F, 0x9B1F5C3E), LL(0xFCCFEC71, 0xCDAD0657), LL(0x4C701C3A, 0xB38E8C33),
+   LL(0xB1C0FD4C, 0x917BDD64), LL(0x9B7624C8, 0x3BB45432), LL(0xCAF53EA6, 0x23BA4442), LL(0x38532A3A, 0x4E677D2C),
+   LL(0x45036C7A, 0x0BFD64B6), LL(0x5E0DD902, 0xC68A007E), LL(0xF44182E1, 0x4DB5A851), LL(0x7F88A46B, 0x8EC9B55A),
+   LL(0xCEC97DCF, 0x0A8291CD), LL(0xF98D0ACC, 0x2A4ECEA9), LL(0x7140003C, 0x1A1DB93D), LL(0x33CB8B7A, 0x092999A3),
+   LL(0x71AD0038, 0x6DC778F9), LL(0x918130C4, 0xA907600A), LL(0x2D9E6832, 0xED6A1E01), LL(0xEFB4318A, 0x7135C886),
+   LL(0x7E31CC7A, 0x87F55BA5), LL(0x55034004, 0x7763CF1D), LL(0xD69F6D18, 0xAC7D5F42), LL(0xE58857B6, 0x7930E9E4),
+   LL(0x164DF4FB, 0x6E6F52C3), LL(0x669E1EF1, 0x25E41D2B), LL(0x3FD59D7C, 0x3C1B20EE), LL(0xFA53DDEF, 0x0ABCD06B),
+   LL(0xD5C4484E, 0x1DBF9A42), LL(0x9B0DEADA, 0xABC52197), LL(0x22363A0D, 0xE86D2BC5), LL(0x9C9DF69E, 0x5CAE82AB),
+   LL(0x71F54BFF, 0x64F2E21E), LL(0xE2D74DD3, 0xF4FD4452), LL(0xBC437944, 0xB4130C93), LL(0x85139270, 0xAEFE1309),
+   LL(0xC186D91C, 0x598CB0FA), LL(0x91F7F7EE, 0x7AD91D26), LL(0xD6E6C907, 0x61B46FC9), LL(0xF99C0238, 0xBC34F4DE),
+   LL(0x6519035B, 0xDE355B3B), LL(0x611FCFDC, 0x886B4238), LL(0xC1B2EFFA, 0xC6F34A26), LL(0x7D1683B2, 0xC58EF183),
+   LL(0x2EC22005, 0x3BB5FCBC), LL(0x4C6FAD73, 0xC3FE3B1B), LL(0xEEF28183, 0x8E4F1232), LL(0xE98583FF, 0x9172FE9C),
+   LL(0x28342F61, 0xC03404CD), LL(0xCDF7E2EC, 0x9E02FCE1), LL(0xEE0A6D70, 0x0B07A7C8), LL(0x6372BB19, 0xAE56EDE7),
+   LL(0xDE394DF4, 0x1D4F42A3), LL(0x60D7F468, 0xB96ADAB7), LL(0xB2C8E3FB, 0xD108A94B), LL(0xB324FB61, 0xBC0AB182),
+   LL(0x483A797A, 0x30ACCA4F), LL(0x36ADE735, 0x1DF158A1), LL(0xF3EFE872, 0xE2A689DA), LL(0xE0E68B77, 0x984F0C70),
+   LL(0x7F57C935, 0xB557135E), LL(0x3DED1AF3, 0x85636555), LL(0x5F066ED0, 0x2433F51F), LL(0xD5FD6561, 0xD3DF1ED5),
+   LL(0xAEC4617A, 0xF681B202), LL(0x630C75D8, 0x7D2FE363), LL(0x249B3EF9, 0xCC939DCE), LL(0x146433FB, 0xA9E13641),
+   LL(0xCE2D3695, 0xD8B9C583), LL(0x273D3CF1, 0xAFDC5620), LL(0xA2BB4A9A, 0xADF85458), LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+/* ffdhe8192 (X = 10965728) */
+const BNU_CHUNK_T ffdhe8192_p[] = {
+   LL(0xFFFFFFFF, 0xFFFFFFFF), LL(0xC5C6424C, 0xD68C8BB7), LL(0x838FF88C, 0x011E2A94), LL(0xA9F4614E, 0x0822E506),
+   LL(0xF7A8443D, 0x97D11D49), LL(0x30677F0D, 0xA6BBFDE5), LL(0xC1FE86FE, 0x2F741EF8), LL(0x5D71A87E, 0xFAFABE1C),
+   LL(0xFBE58A30, 0xDED2FBAB), LL(0x72B0A66E, 0xB6855DFE), LL(0xBA8A4FE8, 0x1EFC8CE0), LL(0x3F2FA457, 0x83F81D4A),
+   LL(0xA577E231, 0xA1FE3075), LL(0x88D9C0A0, 0xD5B80194), LL(0xAD9A95F9, 0x624816CD), LL(0x50C1217B, 0x99E9E316),
+   LL(0x0E423CFC, 0x51AA691E), LL(0x3826E52C, 0x1C217E6C), LL(0x09703FEE, 0x51A8A931), LL(0x6A460E74, 0xBB709987),
+   LL(0x9C86B022, 0x541FC68C), LL(0x46FD8251, 0x59160CC0), LL(0x35C35F5C, 0x2846C0BA), LL(0x8B758282, 0x54504AC7),
+   LL(0xD2AF05E4, 0x29388839), LL(0xC01BD702, 0xCB2C0F1C), LL(0x7C932665, 0x555B2F74), LL(0xA3AB8829, 0x86B63142),
+   LL(0xF64B10EF, 0x0B8CC3BD), LL(0xEDD1CC5E, 0x687FEB69), LL(0xC9509D43, 0xFDB23FCE), LL(0xD951AE64, 0x1E425A31),
+   LL(0xF600C838, 0x36AD004C), LL(0xCFF46AAA, 0xA40E329C), LL(0x7938DAD4, 0xA41D570D), LL(0xD43161C1, 0x62A69526),
+   LL(0x9ADB1E69, 0x3FDD4A8E), LL(0xDC6B80D6, 0x5B3B71F9), LL(0xC6272B04, 0xEC9D1810), LL(0xCACEF403, 0x8CCF2DD5),
+   LL(0xC95B9117, 0xE49F5235), LL(0xB854338A, 0x505DC82D), LL(0x1562A846, 0x62292C31), LL(0x6AE77F5E, 0xD72B0374),
+   LL(0x462D538C, 0xF9C9091B), LL(0x47A67CBE, 0x0AE8DB58), LL(0x22611682, 0xB3A739C1), LL(0x2A281BF6, 0xEEAAC023),
+   LL(0x77CAF992, 0x94C6651E), LL(0x94B2BBC1, 0x763E4E4B), LL(0x0077D9B4, 0x587E38DA), LL(0x183023C3, 0x7FB29F8C),
+   LL(0xF9E3A26E, 0x0ABEC1FF), LL(0x350511E3, 0xA00EF092), LL(0xDB6340D8, 0xB855322E), LL(0xA9A96910, 0xA52471F7),
+   LL(0x4CFDB477, 0x388147FB), LL(0x4E46041F, 0x9B1F5C3E), LL(0xFCCFEC71, 0xCDAD0657), LL(0x4C701C3A, 0xB38E8C33),
+   LL(0xB1C0FD4C, 0x917BDD64), LL(0x9B7624C8, 0x3BB45432), LL(0xCAF53EA6, 0x23BA4442), LL(0x38532A3A, 0x4E677D2C),
+   LL(0x45036C7A, 0x0BFD64B6), LL(0x5E0DD902, 0xC68A007E), LL(0xF44182E1, 0x4DB5A851), LL(0x7F88A46B, 0x8EC9B55A),
+   LL(0xCEC97DCF, 0x0A8291CD), LL(0xF98D0ACC, 0x2A4ECEA9), LL(0x7140003C, 0x1A1DB93D), LL(0x33CB8B7A, 0x092999A3),
+   LL(0x71AD0038, 0x6DC778F9), LL(0x918130C4, 0xA907600A), LL(0x2D9E6832, 0xED6A1E01), LL(0xEFB4318A, 0x7135C886),
+   LL(0x7E31CC7A, 0x87F55BA5), LL(0x55034004, 0x7763CF1D), LL(0xD69F6D18, 0xAC7D5F42), LL(0xE58857B6, 0x7930E9E4),
+   LL(0x164DF4FB, 0x6E6F52C3), LL(0x669E1EF1, 0x25E41D2B), LL(0x3FD59D7C, 0x3C1B20EE), LL(0xFA53DDEF, 0x0ABCD06B),
+   LL(0xD5C4484E, 0x1DBF9A42), LL(0x9B0DEADA, 0xABC52197), LL(0x22363A0D, 0xE86D2BC5), LL(0x9C9DF69E, 0x5CAE82AB),
+   LL(0x71F54BFF, 0x64F2E21E), LL(0xE2D74DD3, 0xF4FD4452), LL(0xBC437944, 0xB4130C93), LL(0x85139270, 0xAEFE1309),
+   LL(0xC186D91C, 0x598CB0FA), LL(0x91F7F7EE, 0x7AD91D26), LL(0xD6E6C907, 0x61B46FC9), LL(0xF99C0238, 0xBC34F4DE),
+   LL(0x6519035B, 0xDE355B3B), LL(0x611FCFDC, 0x886B4238), LL(0xC1B2EFFA, 0xC6F34A26), LL(0x7D1683B2, 0xC58EF183),
+   LL(0x2EC22005, 0x3BB5FCBC), LL(0x4C6FAD73, 0xC3FE3B1B), LL(0xEEF28183, 0x8E4F1232), LL(0xE98583FF, 0x9172FE9C),
+   LL(0x28342F61, 0xC03404CD), LL(0xCDF7E2EC, 0x9E02FCE1), LL(0xEE0A6D70, 0x0B07A7C8), LL(0x6372BB19, 0xAE56EDE7),
+   LL(0xDE394DF4, 0x1D4F42A3), LL(0x60D7F468, 0xB96ADAB7), LL(0xB2C8E3FB, 0xD108A94B), LL(0xB324FB61, 0xBC0AB182),
+   LL(0x483A797A, 0x30ACCA4F), LL(0x36ADE735, 0x1DF158A1), LL(0xF3EFE872, 0xE2A689DA), LL(0xE0E68B77, 0x984F0C70),
+   LL(0x7F57C935, 0xB557135E), LL(0x3DED1AF3, 0x85636555), LL(0x5F066ED0, 0x2433F51F), LL(0xD5FD6561, 0xD3DF1ED5),
+   LL(0xAEC4617A, 0xF681B202), LL(0x630C75D8, 0x7D2FE363), LL(0x249B3EF9, 0xCC939DCE), LL(0x146433FB, 0xA9E13641),
+   LL(0xCE2D3695, 0xD8B9C583), LL(0x273D3CF1, 0xAFDC5620), LL(0xA2BB4A9A, 0xADF85458), LL(0xFFFFFFFF, 0xFFFFFFFF)};
+
+#endif /* _IPP_DATA */
@@ -46,6 +46,8 @@
 //    ippStsIncompleteContextErr
 //                               incomplete context
 //
+//    ippStsMemAllocErr          Montgomery engine pool is exhausted (named group)
+//
 //    ippStsNoErr                no error
 //
 // Parameters:
@@ -112,7 +114,12 @@ IPPFUN(IppStatus, ippsDLPValidateKeyPair,(const IppsBigNumState* pPrvKey,
             BN_SIZE(pTmpPrivate) = ordLen;
 
             /* recompute public key */
-            cpMontExpBin_BN_sscm(pTmp, DLP_GENC(pDL), pTmpPrivate, DLP_MONTP0(pDL));
+            if(DLP_STDGROUP(pDL)) {
+               IppStatus sts = cpDLPMontExpG2_BN(pTmp, pTmpPrivate, DLP_MONTP0(pDL));
+               IPP_BADARG_RET(ippStsNoErr!=sts, sts);
+            }
+            else
+               cpMontExpBin_BN_sscm(pTmp, DLP_GENC(pDL), pTmpPrivate, DLP_MONTP0(pDL));
             cpMontDec_BN(pTmp, pTmp, DLP_MONTP0(pDL));
 
             /* and compare */
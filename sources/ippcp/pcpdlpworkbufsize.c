@@ -0,0 +1,62 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DL over Prime Finite Field (generate domain parameters)
+//
+//  Contents:
+//        ippsDLPWorkBufferSize()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdlp.h"
+
+/*F*
+//    Name: ippsDLPWorkBufferSize
+//
+// Purpose: Returns size of the buffer of the Miller-Rabin workers
+//          used by ippsDLPGenerateDH() (bytes).
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pDL
+//                               NULL == pSize
+//
+//    ippStsContextMatchErr      illegal pDL->idCtx
+//
+//    ippStsBadArgErr            1 > nWorkers
+//                               nWorkers is too big
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    nWorkers    number of the workers
+//    pDL         pointer to the DL context
+//    pSize       pointer to the size of the buffer (bytes)
+//
+*F*/
+IPPFUN(IppStatus, ippsDLPWorkBufferSize,(int nWorkers, const IppsDLPState* pDL, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pDL, pSize);
+   IPP_BADARG_RET(!DLP_VALID_ID(pDL), ippStsContextMatchErr);
+
+   return ippsPrimeWorkBufferSize(nWorkers, DLP_PRIMEGEN(pDL), pSize);
+}
@@ -0,0 +1,96 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Internal Definitions and
+//     Internal Deterministic Random Bit Generator (SP 800-90A) Function Prototypes
+//
+*/
+
+#if !defined(_CP_DRBG_H)
+#define _CP_DRBG_H
+
+#include "pcpaesm.h"
+
+/*
+// CTR_DRBG (AES-256, no derivation function)
+*/
+#define DRBG_CTR_KEYLEN       (32)                                /* key length (bytes)    */
+#define DRBG_CTR_SEEDLEN      (DRBG_CTR_KEYLEN+MBS_RIJ128)        /* seed length (bytes)   */
+#define DRBG_CTR_MAX_REQUEST  (1<<16)                             /* max bytes per request */
+
+/*
+// Hash_DRBG (SHA-256)
+*/
+#define DRBG_HASH_OUTLEN      (IPP_SHA256_DIGEST_BITSIZE/8)       /* hash length (bytes)   */
+#define DRBG_HASH_SEEDLEN     (440/8)                             /* seed length (bytes)   */
+#define DRBG_HASH_MAX_REQUEST (1<<16)                             /* max bytes per request */
+
+/*
+// entropy input: security strength 256 bits,
+// instantiation takes 1/2 strength more as the nonce
+*/
+#define DRBG_ENTROPY_LEN      (32)
+#define DRBG_NONCE_LEN        (16)
+
+/* max number of requests between reseeds */
+#define DRBG_RESEED_INTERVAL  ((Ipp64u)1<<32)
+
+/*
+// Deterministic random bit generator context
+*/
+struct _cpDRBG {
+   Ipp32u         idCtx;                        /* DRBG identifier                          */
+   IppDRBGAlgId   alg;                          /* mechanism                                */
+   Ipp64u         reseedCounter;                /* number of requests since (re)seed        */
+   IppBitSupplier entropyFunc;                  /* entropy source                           */
+   void*          pEntropyParam;                /* entropy source parameter                 */
+   Ipp8u          V[DRBG_HASH_SEEDLEN];         /* Hash_DRBG: V,  CTR_DRBG: V+1 (16 bytes)  */
+   Ipp8u          C[DRBG_HASH_SEEDLEN];         /* Hash_DRBG: C                             */
+   IppsAESSpec    cipher;                       /* CTR_DRBG: AES-256 keyed by Key           */
+};
+
+/* alignment */
+#define DRBG_ALIGNMENT ((int)(sizeof(void*)))
+
+#define DRBG_SET_ID(ctx)      ((ctx)->idCtx = (Ipp32u)idCtxDRBG ^ (Ipp32u)IPP_UINT_PTR(ctx))
+#define DRBG_ALG(ctx)         ((ctx)->alg)
+#define DRBG_RESEED_CNT(ctx)  ((ctx)->reseedCounter)
+#define DRBG_ENTROPY(ctx)     ((ctx)->entropyFunc)
+#define DRBG_ENTROPY_PRM(ctx) ((ctx)->pEntropyParam)
+#define DRBG_V(ctx)           ((ctx)->V)
+#define DRBG_C(ctx)           ((ctx)->C)
+#define DRBG_CIPHER(ctx)      (&(ctx)->cipher)
+
+#define DRBG_VALID_ID(ctx)    ((((ctx)->idCtx) ^ (Ipp32u)IPP_UINT_PTR((ctx))) == (Ipp32u)idCtxDRBG)
+
+#define cpDRBG_CTR_Seed OWNAPI(cpDRBG_CTR_Seed)
+   IPP_OWN_DECL (void, cpDRBG_CTR_Seed, (const Ipp8u* pEntropy, const Ipp8u* pAddIn, int addInLen, int reseed, IppsDRBGState* pCtx))
+#define cpDRBG_CTR_Gen OWNAPI(cpDRBG_CTR_Gen)
+   IPP_OWN_DECL (void, cpDRBG_CTR_Gen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+#define cpDRBG_Hash_Seed OWNAPI(cpDRBG_Hash_Seed)
+   IPP_OWN_DECL (void, cpDRBG_Hash_Seed, (const Ipp8u* pEntropy, int entropyLen, const Ipp8u* pAddIn, int addInLen, int reseed, IppsDRBGState* pCtx))
+#define cpDRBG_Hash_Gen OWNAPI(cpDRBG_Hash_Gen)
+   IPP_OWN_DECL (void, cpDRBG_Hash_Gen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+#define cpDRBGReseed OWNAPI(cpDRBGReseed)
+   IPP_OWN_DECL (IppStatus, cpDRBGReseed, (const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+#define cpDRBGen OWNAPI(cpDRBGen)
+   IPP_OWN_DECL (IppStatus, cpDRBGen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+
+#endif /* _CP_DRBG_H */
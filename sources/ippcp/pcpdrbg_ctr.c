@@ -0,0 +1,130 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     CTR_DRBG (SP 800-90A, AES-256, no derivation function)
+//
+//  Contents:
+//     cpDRBG_CTR_Seed()
+//     cpDRBG_CTR_Gen()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcpdrbg.h"
+#include "pcptool.h"
+
+/*
+// The context keeps V+1 (the next counter block) rather than V,
+// so AES-CTR over the zero stream produces the DRBG output directly
+// and leaves the counter in the state expected by the update.
+*/
+
+/* keystream: pOut = AES(Key, V+1) || AES(Key, V+2) || ..., V += number of blocks */
+static void drbg_ctr_keystream(Ipp8u* pOut, int outLen, IppsDRBGState* pCtx)
+{
+   int fullLen = outLen & ~(MBS_RIJ128-1);
+
+   if(fullLen) {
+      PadBlock(0, pOut, fullLen);
+      ippsAESEncryptCTR(pOut, pOut, fullLen, DRBG_CIPHER(pCtx), DRBG_V(pCtx), MBS_RIJ128*8);
+   }
+   if(outLen > fullLen) {
+      Ipp8u block[MBS_RIJ128];
+      PadBlock(0, block, MBS_RIJ128);
+      ippsAESEncryptCTR(block, block, MBS_RIJ128, DRBG_CIPHER(pCtx), DRBG_V(pCtx), MBS_RIJ128*8);
+      CopyBlock(block, pOut+fullLen, outLen-fullLen);
+      PurgeBlock(block, MBS_RIJ128);
+   }
+}
+
+/* CTR_DRBG_Update(provided_data) */
+static void drbg_ctr_update(const Ipp8u* pData, IppsDRBGState* pCtx)
+{
+   Ipp8u temp[DRBG_CTR_SEEDLEN];
+
+   drbg_ctr_keystream(temp, DRBG_CTR_SEEDLEN, pCtx);
+   XorBlock(temp, pData, temp, DRBG_CTR_SEEDLEN);
+
+   /* Key = leftmost(temp), V = rightmost(temp) */
+   ippsAESInit(temp, DRBG_CTR_KEYLEN, DRBG_CIPHER(pCtx), sizeof(IppsAESSpec));
+   CopyBlock16(temp+DRBG_CTR_KEYLEN, DRBG_V(pCtx));
+   StdIncrement(DRBG_V(pCtx), MBS_RIJ128*8, MBS_RIJ128*8);
+
+   PurgeBlock(temp, DRBG_CTR_SEEDLEN);
+}
+
+/* provided_data = data || 0^(seedlen-len) */
+__IPPCP_INLINE void drbg_ctr_pad(Ipp8u* pData, const Ipp8u* pAddIn, int addInLen)
+{
+   PadBlock(0, pData, DRBG_CTR_SEEDLEN);
+   if(addInLen)
+      CopyBlock(pAddIn, pData, addInLen);
+}
+
+/*
+// Instantiate (reseed==0) or reseed:
+//    seed_material = entropy_input XOR (personalization/additional input)
+//
+// Parameters:
+//    pEntropy    DRBG_CTR_SEEDLEN bytes of full entropy
+//    pAddIn      personalization string or additional input, addInLen <= DRBG_CTR_SEEDLEN
+*/
+IPP_OWN_DEFN (void, cpDRBG_CTR_Seed, (const Ipp8u* pEntropy, const Ipp8u* pAddIn, int addInLen, int reseed, IppsDRBGState* pCtx))
+{
+   Ipp8u seed[DRBG_CTR_SEEDLEN];
+
+   if(!reseed) {
+      /* Key = 0, V = 0 */
+      PadBlock(0, seed, DRBG_CTR_KEYLEN);
+      ippsAESInit(seed, DRBG_CTR_KEYLEN, DRBG_CIPHER(pCtx), sizeof(IppsAESSpec));
+      PadBlock(0, DRBG_V(pCtx), MBS_RIJ128);
+      DRBG_V(pCtx)[MBS_RIJ128-1] = 1;
+   }
+
+   drbg_ctr_pad(seed, pAddIn, addInLen);
+   XorBlock(seed, pEntropy, seed, DRBG_CTR_SEEDLEN);
+   drbg_ctr_update(seed, pCtx);
+
+   PurgeBlock(seed, DRBG_CTR_SEEDLEN);
+}
+
+/*
+// Generate outLen (<=DRBG_CTR_MAX_REQUEST) bytes
+//
+// Parameters:
+//    pAddIn      additional input, addInLen <= DRBG_CTR_SEEDLEN
+*/
+IPP_OWN_DEFN (void, cpDRBG_CTR_Gen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   Ipp8u addIn[DRBG_CTR_SEEDLEN];
+   drbg_ctr_pad(addIn, pAddIn, addInLen);
+
+   if(addInLen)
+      drbg_ctr_update(addIn, pCtx);
+
+   drbg_ctr_keystream(pOut, outLen, pCtx);
+
+   drbg_ctr_update(addIn, pCtx);
+   DRBG_RESEED_CNT(pCtx)++;
+
+   PurgeBlock(addIn, DRBG_CTR_SEEDLEN);
+}
@@ -0,0 +1,89 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DRBG Functions
+//
+//  Contents:
+//     cpDRBGReseed()
+//     cpDRBGen()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdrbg.h"
+#include "pcptool.h"
+
+/*
+// Reseeds the DRBG with fresh entropy from the entropy source
+//
+// Returns:
+//    status of the entropy source
+*/
+IPP_OWN_DEFN (IppStatus, cpDRBGReseed, (const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   Ipp32u entropy[(DRBG_ENTROPY_LEN+DRBG_NONCE_LEN)/sizeof(Ipp32u)];
+   int entropyLen = (ippDRBG_CTR_AES256==DRBG_ALG(pCtx))? DRBG_CTR_SEEDLEN : DRBG_ENTROPY_LEN;
+
+   IppStatus sts = DRBG_ENTROPY(pCtx)(entropy, entropyLen*8, DRBG_ENTROPY_PRM(pCtx));
+   if(ippStsNoErr==sts) {
+      if(ippDRBG_CTR_AES256==DRBG_ALG(pCtx))
+         cpDRBG_CTR_Seed((Ipp8u*)entropy, pAddIn, addInLen, 1, pCtx);
+      else
+         cpDRBG_Hash_Seed((Ipp8u*)entropy, entropyLen, pAddIn, addInLen, 1, pCtx);
+      DRBG_RESEED_CNT(pCtx) = 1;
+   }
+
+   PurgeBlock(entropy, (int)sizeof(entropy));
+   return sts;
+}
+
+/*
+// Generates outLen bytes.
+// Long requests are split into several generate requests of the mechanism,
+// the DRBG is reseeded once the reseed interval is exhausted.
+//
+// Returns:
+//    status of the entropy source (if reseed was required)
+*/
+IPP_OWN_DEFN (IppStatus, cpDRBGen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   int isCTR = (ippDRBG_CTR_AES256==DRBG_ALG(pCtx));
+   int maxRequest = isCTR? DRBG_CTR_MAX_REQUEST : DRBG_HASH_MAX_REQUEST;
+
+   while(outLen) {
+      int reqLen = IPP_MIN(outLen, maxRequest);
+
+      if(DRBG_RESEED_CNT(pCtx) > DRBG_RESEED_INTERVAL) {
+         IppStatus sts = cpDRBGReseed(NULL, 0, pCtx);
+         if(ippStsNoErr!=sts)
+            return sts;
+      }
+
+      if(isCTR)
+         cpDRBG_CTR_Gen(pOut, reqLen, pAddIn, addInLen, pCtx);
+      else
+         cpDRBG_Hash_Gen(pOut, reqLen, pAddIn, addInLen, pCtx);
+
+      pOut += reqLen;
+      outLen -= reqLen;
+   }
+   return ippStsNoErr;
+}
@@ -0,0 +1,164 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Hash_DRBG (SP 800-90A, SHA-256)
+//
+//  Contents:
+//     cpDRBG_Hash_Seed()
+//     cpDRBG_Hash_Gen()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "hash/pcphash_rmf.h"
+#include "pcpdrbg.h"
+#include "pcptool.h"
+
+/* V = (V + X) mod 2^seedlen, X is big endian number of xLen bytes */
+static void drbg_hash_add(Ipp8u* pV, const Ipp8u* pX, int xLen)
+{
+   Ipp32u carry = 0;
+   int i, j;
+   for(i=DRBG_HASH_SEEDLEN-1, j=xLen-1; i>=0; i--, j--) {
+      carry += pV[i];
+      if(j>=0) carry += pX[j];
+      pV[i] = (Ipp8u)carry;
+      carry >>= 8;
+   }
+}
+
+/*
+// Hash_df(prefix || inp1 || inp2 || inp3, seedlen)
+// the prefix byte is omitted if negative
+*/
+static void drbg_hash_df(Ipp8u* pOut, int prefix,
+                         const Ipp8u* pInp1, int inp1Len,
+                         const Ipp8u* pInp2, int inp2Len,
+                         const Ipp8u* pInp3, int inp3Len)
+{
+   __ALIGN8 IppsHashState_rmf ctx;
+   const IppsHashMethod* pMethod = ippsHashMethod_SHA256_TT();
+
+   /* counter || no_of_bits_to_return */
+   Ipp8u hdr[1+4] = {1, 0x00, 0x00, (Ipp8u)((DRBG_HASH_SEEDLEN*8)>>8), (Ipp8u)(DRBG_HASH_SEEDLEN*8)};
+   Ipp8u pfx = (Ipp8u)prefix;
+   Ipp8u md[DRBG_HASH_OUTLEN];
+   int len;
+
+   for(len=0; len<DRBG_HASH_SEEDLEN; len+=DRBG_HASH_OUTLEN, hdr[0]++) {
+      ippsHashInit_rmf(&ctx, pMethod);
+      ippsHashUpdate_rmf(hdr, sizeof(hdr), &ctx);
+      if(0<=prefix)
+         ippsHashUpdate_rmf(&pfx, 1, &ctx);
+      ippsHashUpdate_rmf(pInp1, inp1Len, &ctx);
+      ippsHashUpdate_rmf(pInp2, inp2Len, &ctx);
+      ippsHashUpdate_rmf(pInp3, inp3Len, &ctx);
+      ippsHashFinal_rmf(md, &ctx);
+      CopyBlock(md, pOut+len, IPP_MIN(DRBG_HASH_OUTLEN, DRBG_HASH_SEEDLEN-len));
+   }
+
+   PurgeBlock(md, DRBG_HASH_OUTLEN);
+   PurgeBlock(&ctx, sizeof(ctx));
+}
+
+/* Hash(prefix || V || inp) */
+static void drbg_hash_v(Ipp8u* pMD, Ipp8u prefix, const Ipp8u* pV, const Ipp8u* pInp, int inpLen)
+{
+   __ALIGN8 IppsHashState_rmf ctx;
+   ippsHashInit_rmf(&ctx, ippsHashMethod_SHA256_TT());
+   ippsHashUpdate_rmf(&prefix, 1, &ctx);
+   ippsHashUpdate_rmf(pV, DRBG_HASH_SEEDLEN, &ctx);
+   ippsHashUpdate_rmf(pInp, inpLen, &ctx);
+   ippsHashFinal_rmf(pMD, &ctx);
+   PurgeBlock(&ctx, sizeof(ctx));
+}
+
+/*
+// Instantiate (reseed==0):
+//    V = Hash_df(entropy_input || nonce || personalization_string)
+// Reseed:
+//    V = Hash_df(0x01 || V || entropy_input || additional_input)
+// Both:
+//    C = Hash_df(0x00 || V)
+*/
+IPP_OWN_DEFN (void, cpDRBG_Hash_Seed, (const Ipp8u* pEntropy, int entropyLen, const Ipp8u* pAddIn, int addInLen, int reseed, IppsDRBGState* pCtx))
+{
+   Ipp8u* pV = DRBG_V(pCtx);
+
+   if(!reseed)
+      drbg_hash_df(pV, -1, pEntropy, entropyLen, pAddIn, addInLen, NULL, 0);
+   else {
+      Ipp8u V[DRBG_HASH_SEEDLEN];
+      CopyBlock(pV, V, DRBG_HASH_SEEDLEN);
+      drbg_hash_df(pV, 0x01, V, DRBG_HASH_SEEDLEN, pEntropy, entropyLen, pAddIn, addInLen);
+      PurgeBlock(V, DRBG_HASH_SEEDLEN);
+   }
+   drbg_hash_df(DRBG_C(pCtx), 0x00, pV, DRBG_HASH_SEEDLEN, NULL, 0, NULL, 0);
+}
+
+/*
+// Generate outLen (<=DRBG_HASH_MAX_REQUEST) bytes
+*/
+IPP_OWN_DEFN (void, cpDRBG_Hash_Gen, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   const IppsHashMethod* pMethod = ippsHashMethod_SHA256_TT();
+   Ipp8u* pV = DRBG_V(pCtx);
+   Ipp8u md[DRBG_HASH_OUTLEN];
+   Ipp8u data[DRBG_HASH_SEEDLEN];
+   Ipp8u one = 1;
+
+   /* V = V + Hash(0x02 || V || additional_input) */
+   if(addInLen) {
+      drbg_hash_v(md, 0x02, pV, pAddIn, addInLen);
+      drbg_hash_add(pV, md, DRBG_HASH_OUTLEN);
+   }
+
+   /*
+   // Hashgen: data = V, output Hash(data), data = data+1, ...
+   // seedlen+9 bytes of padding fits one SHA-256 block, so every output block costs one compression
+   */
+   CopyBlock(pV, data, DRBG_HASH_SEEDLEN);
+   for(; outLen>=DRBG_HASH_OUTLEN; outLen-=DRBG_HASH_OUTLEN, pOut+=DRBG_HASH_OUTLEN) {
+      ippsHashMessage_rmf(data, DRBG_HASH_SEEDLEN, pOut, pMethod);
+      drbg_hash_add(data, &one, 1);
+   }
+   if(outLen) {
+      ippsHashMessage_rmf(data, DRBG_HASH_SEEDLEN, md, pMethod);
+      CopyBlock(md, pOut, outLen);
+   }
+
+   /* V = V + Hash(0x03 || V) + C + reseed_counter */
+   drbg_hash_v(md, 0x03, pV, NULL, 0);
+   drbg_hash_add(pV, md, DRBG_HASH_OUTLEN);
+   drbg_hash_add(pV, DRBG_C(pCtx), DRBG_HASH_SEEDLEN);
+   {
+      Ipp64u cnt = DRBG_RESEED_CNT(pCtx);
+      Ipp8u cntBE[sizeof(Ipp64u)];
+      int i;
+      for(i=(int)sizeof(Ipp64u)-1; i>=0; i--, cnt>>=8)
+         cntBE[i] = (Ipp8u)cnt;
+      drbg_hash_add(pV, cntBE, (int)sizeof(Ipp64u));
+   }
+   DRBG_RESEED_CNT(pCtx)++;
+
+   PurgeBlock(md, DRBG_HASH_OUTLEN);
+   PurgeBlock(data, DRBG_HASH_SEEDLEN);
+}
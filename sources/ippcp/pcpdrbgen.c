@@ -0,0 +1,77 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DRBG Functions
+//
+//  Contents:
+//     ippsDRBGGen()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdrbg.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsDRBGGen
+//
+// Purpose: Generates a pseudorandom bit sequence of the specified nBits length.
+//          The function matches IppBitSupplier and can be passed as rndFunc
+//          with the DRBG context as pRndParam.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pRand
+//
+//    ippStsContextMatchErr      illegal pCtx->idCtx
+//
+//    ippStsLengthErr            1 > nBits
+//
+//    ippStsErr                  reseed was required and entropy input can't be obtained
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    pRand    pointer to the buffer
+//    nBits    number of bits be requested
+//    pCtx     pointer to the DRBG context
+*F*/
+IPPFUN(IppStatus, ippsDRBGGen,(Ipp32u* pRand, int nBits, void* pCtx))
+{
+   IppsDRBGState* pDrbgCtx = (IppsDRBGState*)pCtx;
+
+   /* test DRBG context */
+   IPP_BAD_PTR2_RET(pRand, pCtx);
+   IPP_BADARG_RET(!DRBG_VALID_ID(pDrbgCtx), ippStsContextMatchErr);
+
+   /* test sizes */
+   IPP_BADARG_RET(nBits< 1, ippStsLengthErr);
+
+   {
+      cpSize rndSize = BITS2WORD32_SIZE(nBits);
+      Ipp32u rndMask = MAKEMASK32(nBits);
+
+      IppStatus sts = cpDRBGen((Ipp8u*)pRand, rndSize*(cpSize)sizeof(Ipp32u), NULL, 0, pDrbgCtx);
+      if(ippStsNoErr==sts)
+         pRand[rndSize-1] &= rndMask;
+      return sts;
+   }
+}
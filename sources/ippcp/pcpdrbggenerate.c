@@ -0,0 +1,75 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DRBG Functions
+//
+//  Contents:
+//     ippsDRBGGenerate()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdrbg.h"
+
+/*F*
+// Name: ippsDRBGGenerate
+//
+// Purpose: Generates pseudorandom bytes.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pOut
+//                               NULL == pAddIn and addInLen>0
+//
+//    ippStsContextMatchErr      illegal pCtx->idCtx
+//
+//    ippStsLengthErr            1 > outLen
+//                               addInLen < 0
+//                               addInLen > 48 (ippDRBG_CTR_AES256)
+//
+//    ippStsErr                  reseed was required and entropy input can't be obtained
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    pOut        pointer to the output buffer
+//    outLen      number of bytes to be generated
+//    pAddIn      additional input
+//    addInLen    length of additional input (bytes)
+//    pCtx        pointer to the DRBG context
+*F*/
+IPPFUN(IppStatus, ippsDRBGGenerate, (Ipp8u* pOut, int outLen, const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   /* test DRBG context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!DRBG_VALID_ID(pCtx), ippStsContextMatchErr);
+
+   /* test output */
+   IPP_BAD_PTR1_RET(pOut);
+   IPP_BADARG_RET(outLen<1, ippStsLengthErr);
+
+   /* test additional input */
+   IPP_BADARG_RET(addInLen<0, ippStsLengthErr);
+   IPP_BADARG_RET(addInLen && !pAddIn, ippStsNullPtrErr);
+   IPP_BADARG_RET((ippDRBG_CTR_AES256==DRBG_ALG(pCtx)) && (addInLen>DRBG_CTR_SEEDLEN), ippStsLengthErr);
+
+   return cpDRBGen(pOut, outLen, pAddIn, addInLen, pCtx);
+}
@@ -0,0 +1,104 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DRBG Functions
+//
+//  Contents:
+//     ippsDRBGInit()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdrbg.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsDRBGInit
+//
+// Purpose: Instantiates SP 800-90A DRBG (security strength 256 bits).
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pPers and persLen>0
+//
+//    ippStsBadArgErr            unknown alg
+//
+//    ippStsLengthErr            persLen < 0
+//                               persLen > 48 (ippDRBG_CTR_AES256)
+//
+//    ippStsNotSupportedModeErr  entropyFunc == NULL and RDSEED is not supported
+//
+//    ippStsErr                  entropy input can't be obtained
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    alg            DRBG mechanism
+//    pPers          personalization string
+//    persLen        length of personalization string (bytes)
+//    entropyFunc    entropy source (ippsTRNGenRDSEED if NULL)
+//    pEntropyParam  entropy source parameter
+//    pCtx           pointer to the context to be initialized
+//
+// Note:
+//    The entropy source must provide full entropy output.
+//    The context holds no locks: a thread should use its own instance.
+*F*/
+IPPFUN(IppStatus, ippsDRBGInit, (IppDRBGAlgId alg, const Ipp8u* pPers, int persLen,
+                                 IppBitSupplier entropyFunc, void* pEntropyParam, IppsDRBGState* pCtx))
+{
+   /* test DRBG context */
+   IPP_BAD_PTR1_RET(pCtx);
+
+   /* test mechanism */
+   IPP_BADARG_RET((ippDRBG_CTR_AES256!=alg) && (ippDRBG_Hash_SHA256!=alg), ippStsBadArgErr);
+
+   /* test personalization string */
+   IPP_BADARG_RET(persLen<0, ippStsLengthErr);
+   IPP_BADARG_RET(persLen && !pPers, ippStsNullPtrErr);
+   IPP_BADARG_RET((ippDRBG_CTR_AES256==alg) && (persLen>DRBG_CTR_SEEDLEN), ippStsLengthErr);
+
+   {
+      /* entropy_input || nonce */
+      Ipp32u entropy[(DRBG_ENTROPY_LEN+DRBG_NONCE_LEN)/sizeof(Ipp32u)];
+      IppStatus sts;
+
+      /* cleanup context */
+      PadBlock(0, pCtx, (cpSize)(sizeof(IppsDRBGState)));
+
+      DRBG_ALG(pCtx) = alg;
+      DRBG_ENTROPY(pCtx) = entropyFunc? entropyFunc : ippsTRNGenRDSEED;
+      DRBG_ENTROPY_PRM(pCtx) = pEntropyParam;
+
+      sts = DRBG_ENTROPY(pCtx)(entropy, (int)sizeof(entropy)*8, DRBG_ENTROPY_PRM(pCtx));
+      if(ippStsNoErr==sts) {
+         if(ippDRBG_CTR_AES256==alg)
+            cpDRBG_CTR_Seed((Ipp8u*)entropy, pPers, persLen, 0, pCtx);
+         else
+            cpDRBG_Hash_Seed((Ipp8u*)entropy, (int)sizeof(entropy), pPers, persLen, 0, pCtx);
+         DRBG_RESEED_CNT(pCtx) = 1;
+         DRBG_SET_ID(pCtx);
+      }
+
+      PurgeBlock(entropy, (int)sizeof(entropy));
+      return sts;
+   }
+}
@@ -0,0 +1,67 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     DRBG Functions
+//
+//  Contents:
+//     ippsDRBGReseed()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpdrbg.h"
+
+/*F*
+// Name: ippsDRBGReseed
+//
+// Purpose: Reseeds DRBG with entropy input of the entropy source.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pAddIn and addInLen>0
+//
+//    ippStsContextMatchErr      illegal pCtx->idCtx
+//
+//    ippStsLengthErr            addInLen < 0
+//                               addInLen > 48 (ippDRBG_CTR_AES256)
+//
+//    ippStsErr                  entropy input can't be obtained
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    pAddIn      additional input
+//    addInLen    length of additional input (bytes)
+//    pCtx        pointer to the DRBG context
+*F*/
+IPPFUN(IppStatus, ippsDRBGReseed, (const Ipp8u* pAddIn, int addInLen, IppsDRBGState* pCtx))
+{
+   /* test DRBG context */
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!DRBG_VALID_ID(pCtx), ippStsContextMatchErr);
+
+   /* test additional input */
+   IPP_BADARG_RET(addInLen<0, ippStsLengthErr);
+   IPP_BADARG_RET(addInLen && !pAddIn, ippStsNullPtrErr);
+   IPP_BADARG_RET((ippDRBG_CTR_AES256==DRBG_ALG(pCtx)) && (addInLen>DRBG_CTR_SEEDLEN), ippStsLengthErr);
+
+   return cpDRBGReseed(pAddIn, addInLen, pCtx);
+}
@@ -0,0 +1,154 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Modular Exponentiation (fixed-base version)
+//
+//  Contents:
+//        cpMontExpFixedBaseInitTable()
+//        cpMontExpFixedBase_BNU_sscm()
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcpmontgomery.h"
+#include "gsscramble.h"
+
+/*F*
+// Name: cpMontExpFixedBaseInitTable
+//
+// Purpose: computes the comb table of the fixed base:
+//          pTable[idx] = prod( X^(2^(i*nCols)) ), for all bits i set in idx
+//
+// Returns:
+//      1 on success
+//      0 if Montgomery engine pool is exhausted
+//
+// Parameters:
+//      pTable       scrambled table of 2^combSize entries
+//      pX           base of Montgomery form within the range [0,m-1]
+//      nsX          length of the base
+//      combSize     number of comb rows
+//      nCols        number of comb columns
+//      pMont        Montgomery engine
+//
+*F*/
+IPP_OWN_DEFN (int, cpMontExpFixedBaseInitTable, (BNU_CHUNK_T* pTable, const BNU_CHUNK_T* pX, cpSize nsX, int combSize, int nCols, gsModEngine* pMont))
+{
+   cpSize nsM = MOD_LEN(pMont);
+
+   const int usedPoolLen = 2;
+   BNU_CHUNK_T* pB = gsModPoolAlloc(pMont, usedPoolLen);
+   if(NULL == pB)
+      return 0;
+
+   {
+      BNU_CHUNK_T* pT = pB + nsM;
+      int i, j, n;
+
+      /* B = X, T[0] = mont(1), T[1] = X */
+      ZEXPAND_COPY_BNU(pB, nsM, pX, nsX);
+      gsScramblePut(pTable, 0, MOD_MNT_R(pMont), nsM, combSize);
+      gsScramblePut(pTable, 1, pB, nsM, combSize);
+
+      for(i=1; i<combSize; i++) {
+         int rowIdx = 1<<i;
+
+         /* B = X^(2^(i*nCols)) */
+         for(n=0; n<nCols; n++)
+            MOD_METHOD(pMont)->sqr(pB, pB, pMont);
+
+         /* T[rowIdx+j] = T[j] * B */
+         for(j=0; j<rowIdx; j++) {
+            gsScrambleGet(pT, nsM, pTable, j, combSize);
+            MOD_METHOD(pMont)->mul(pT, pT, pB, pMont);
+            gsScramblePut(pTable, rowIdx+j, pT, nsM, combSize);
+         }
+      }
+   }
+
+   gsModPoolFree(pMont, usedPoolLen);
+   return 1;
+}
+
+/* bit of E at the position pos */
+__IPPCP_INLINE BNU_CHUNK_T cpExpBit(const BNU_CHUNK_T* pE, cpSize nsE, int pos)
+{
+   int idx = pos / BNU_CHUNK_BITS;
+   return (idx<nsE)? (pE[idx] >> (pos % BNU_CHUNK_BITS)) & 1 : 0;
+}
+
+/*F*
+// Name: cpMontExpFixedBase_BNU_sscm
+//
+// Purpose: computes the Montgomery exponentiation X^E
+//          using the precomputed comb table of the base X.
+//
+// Returns:
+//      Length of modulus
+//      -1 if Montgomery engine pool is exhausted
+//
+// Parameters:
+//      pY           the Montgomery exponentiation result
+//      pE           big number exponent
+//      nsE          length of the exponent
+//      pTable       comb table computed by cpMontExpFixedBaseInitTable()
+//      combSize     number of comb rows
+//      nCols        number of comb columns
+//      pMont        Montgomery engine
+//
+// Note:
+//    exponent is processed to the whole combSize*nCols bits,
+//    table entries are extracted by constant time scanning
+//
+*F*/
+IPP_OWN_DEFN (cpSize, cpMontExpFixedBase_BNU_sscm, (BNU_CHUNK_T* pY, const BNU_CHUNK_T* pE, cpSize nsE, const BNU_CHUNK_T* pTable, int combSize, int nCols, gsModEngine* pMont))
+{
+   cpSize nsM = MOD_LEN(pMont);
+
+   const int usedPoolLen = 1;
+   BNU_CHUNK_T* pT = gsModPoolAlloc(pMont, usedPoolLen);
+   if(NULL == pT)
+      return -1;
+
+   {
+      int col, i;
+
+      /* Y = mont(1) */
+      COPY_BNU(pY, MOD_MNT_R(pMont), nsM);
+
+      for(col=nCols-1; col>=0; col--) {
+         /* extract comb column value */
+         BNU_CHUNK_T idx = 0;
+         for(i=0; i<combSize; i++)
+            idx |= cpExpBit(pE, nsE, col + i*nCols) << i;
+
+         if(col<nCols-1)
+            MOD_METHOD(pMont)->sqr(pY, pY, pMont);
+
+         gsScrambleGet_sscm(pT, nsM, pTable, (int)idx, combSize);
+         MOD_METHOD(pMont)->mul(pY, pY, pT, pMont);
+      }
+   }
+
+   gsModPoolFree(pMont, usedPoolLen);
+   return nsM;
+}
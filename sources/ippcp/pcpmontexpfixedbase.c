@@ -0,0 +1,96 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//               Intel(R) Cryptography Primitives Library
+//
+//  Contents:
+//        ippsMontExpFixedBase()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcpmontgomery.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsMontExpFixedBase
+//
+// Purpose: computes the Montgomery exponentiation with exponent
+//          IppsBigNumState *pE to the fixed base of Montgomery form
+//          precomputed in IppsMontExpFixedBaseState *pTable
+//          with respect to the modulus IppsMontState *pCtx.
+//
+// Returns:                Reason:
+//      ippStsNullPtrErr      pE == NULL
+//                            pTable == NULL
+//                            pCtx == NULL
+//                            pR == NULL
+//      ippStsContextMatchErr pCtx is not a valid IppsMontState
+//                            pTable is not a valid IppsMontExpFixedBaseState
+//                            pE or pR is not a valid IppsBigNumState
+//                            pTable was not computed for the modulus of pCtx
+//      ippStsBadArgErr       pE is a negative integer
+//      ippStsRangeErr        bitsize of pE is more than bitSizeE of the table
+//      ippStsOutOfRangeErr   pR is not large enough to hold the result
+//      ippStsNoErr           no error
+//
+// Parameters:
+//      pE          big number exponent
+//      pTable      pointer to the fixed-base table
+//      pCtx        Montgomery modulus of IppsMontState
+//      pR          the Montgomery exponentiation result.
+//
+// Note:
+//    Running time depends on the bitSizeE of the table only,
+//    table entries are extracted by constant time scanning.
+//
+*F*/
+IPPFUN(IppStatus, ippsMontExpFixedBase,(const IppsBigNumState* pE, const IppsMontExpFixedBaseState* pTable, IppsMontState* pCtx, IppsBigNumState* pR))
+{
+   IPP_BAD_PTR4_RET(pE, pTable, pCtx, pR);
+
+   IPP_BADARG_RET(!MNT_VALID_ID(pCtx), ippStsContextMatchErr);
+   IPP_BADARG_RET(!MEFB_VALID_ID(pTable), ippStsContextMatchErr);
+   IPP_BADARG_RET(!BN_VALID_ID(pE), ippStsContextMatchErr);
+   IPP_BADARG_RET(!BN_VALID_ID(pR), ippStsContextMatchErr);
+
+   /* check the table was computed for this modulus */
+   IPP_BADARG_RET(MEFB_MODLEN(pTable) != MOD_LEN( MNT_ENGINE(pCtx) ), ippStsContextMatchErr);
+   IPP_BADARG_RET(cpCmp_BNU(MEFB_MODULUS(pTable), MEFB_MODLEN(pTable), MOD_MODULUS( MNT_ENGINE(pCtx) ), MOD_LEN( MNT_ENGINE(pCtx) )), ippStsContextMatchErr);
+
+   IPP_BADARG_RET(BN_ROOM(pR) <  MOD_LEN( MNT_ENGINE(pCtx) ), ippStsOutOfRangeErr);
+   /* check e */
+   IPP_BADARG_RET(BN_NEGATIVE(pE), ippStsBadArgErr);
+   IPP_BADARG_RET(cpBN_bitsize(pE) > MEFB_BITSIZEE(pTable), ippStsRangeErr);
+
+   {
+      BNU_CHUNK_T* pY = BN_NUMBER(pR);
+      cpSize nsY = cpMontExpFixedBase_BNU_sscm(pY, BN_NUMBER(pE), BN_SIZE(pE),
+                                               MEFB_TABLE(pTable), MEFB_COMBSIZE(pTable), MEFB_NCOLS(pTable),
+                                               MNT_ENGINE(pCtx));
+      IPP_BADARG_RET(0>nsY, ippStsErr);
+
+      FIX_BNU(pY, nsY);
+      BN_SIZE(pR) = nsY;
+      BN_SIGN(pR) = ippBigNumPOS;
+
+      return ippStsNoErr;
+   }
+}
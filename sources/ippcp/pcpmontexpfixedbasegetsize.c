@@ -0,0 +1,67 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//               Intel(R) Cryptography Primitives Library
+//
+//  Contents:
+//        ippsMontExpFixedBaseGetSize()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcpmontgomery.h"
+
+/*F*
+// Name: ippsMontExpFixedBaseGetSize
+//
+// Purpose: Returns size of the fixed-base exponentiation table (bytes).
+//
+// Returns:                Reason:
+//      ippStsNullPtrErr      pCtx == NULL
+//                            pSize == NULL
+//      ippStsContextMatchErr pCtx is not a valid IppsMontState
+//      ippStsBadArgErr       1 > bitSizeE
+//                            BN_MAXBITSIZE < bitSizeE
+//      ippStsNoErr           no error
+//
+// Parameters:
+//      bitSizeE    max bitsize of the exponent
+//      pCtx        Montgomery modulus of IppsMontState
+//      pSize       pointer to the size of the table (bytes)
+//
+*F*/
+IPPFUN(IppStatus, ippsMontExpFixedBaseGetSize,(int bitSizeE, const IppsMontState* pCtx, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pCtx, pSize);
+   IPP_BADARG_RET(!MNT_VALID_ID(pCtx), ippStsContextMatchErr);
+   IPP_BADARG_RET((1>bitSizeE) || (BN_MAXBITSIZE<bitSizeE), ippStsBadArgErr);
+
+   {
+      cpSize nsM = MOD_LEN( MNT_ENGINE(pCtx) );
+      int combSize = cpMontExpFixedBase_CombSize(bitSizeE);
+
+      *pSize = (Ipp32s)sizeof(IppsMontExpFixedBaseState)
+             + nsM*(Ipp32s)sizeof(BNU_CHUNK_T)
+             + gsGetScrambleBufferSize(nsM, combSize)*(Ipp32s)sizeof(BNU_CHUNK_T)
+             + (CACHE_LINE_SIZE-1);
+
+      return ippStsNoErr;
+   }
+}
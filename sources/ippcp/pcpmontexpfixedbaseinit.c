@@ -0,0 +1,96 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//               Intel(R) Cryptography Primitives Library
+//
+//  Contents:
+//        ippsMontExpFixedBaseInit()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcpmontgomery.h"
+
+/*F*
+// Name: ippsMontExpFixedBaseInit
+//
+// Purpose: Precomputes the table for the repeated exponentiation
+//          of the fixed base IppsBigNumState *pA of Montgomery form
+//          with respect to the modulus IppsMontState *pCtx.
+//
+// Returns:                Reason:
+//      ippStsNullPtrErr      pA == NULL
+//                            pTable == NULL
+//                            pCtx == NULL
+//      ippStsContextMatchErr pCtx is not a valid IppsMontState
+//                            pA is not a valid IppsBigNumState
+//      ippStsBadArgErr       1 > bitSizeE
+//                            BN_MAXBITSIZE < bitSizeE
+//                            pA is a negative integer
+//      ippStsScaleRangeErr   pA is more than modulus
+//      ippStsNoErr           no error
+//
+// Parameters:
+//      pA          base of Montgomery form within the range [0,m-1]
+//      bitSizeE    max bitsize of the exponent
+//      pTable      pointer to the fixed-base table
+//      pCtx        Montgomery modulus of IppsMontState
+//
+// Note:
+//    Size of the table must be obtained by ippsMontExpFixedBaseGetSize()
+//    for the same bitSizeE and modulus.
+//
+*F*/
+IPPFUN(IppStatus, ippsMontExpFixedBaseInit,(const IppsBigNumState* pA, int bitSizeE, IppsMontExpFixedBaseState* pTable, IppsMontState* pCtx))
+{
+   IPP_BAD_PTR3_RET(pA, pTable, pCtx);
+
+   IPP_BADARG_RET(!MNT_VALID_ID(pCtx), ippStsContextMatchErr);
+   IPP_BADARG_RET(!BN_VALID_ID(pA), ippStsContextMatchErr);
+   IPP_BADARG_RET((1>bitSizeE) || (BN_MAXBITSIZE<bitSizeE), ippStsBadArgErr);
+
+   /* check a */
+   IPP_BADARG_RET(BN_NEGATIVE(pA), ippStsBadArgErr);
+   IPP_BADARG_RET(cpCmp_BNU(BN_NUMBER(pA), BN_SIZE(pA), MOD_MODULUS( MNT_ENGINE(pCtx) ), MOD_LEN( MNT_ENGINE(pCtx) )) >= 0, ippStsScaleRangeErr);
+
+   {
+      gsModEngine* pME = MNT_ENGINE(pCtx);
+      cpSize nsM = MOD_LEN(pME);
+      int combSize = cpMontExpFixedBase_CombSize(bitSizeE);
+
+      Ipp8u* ptr = (Ipp8u*)pTable + sizeof(IppsMontExpFixedBaseState);
+
+      MEFB_MODLEN(pTable)   = nsM;
+      MEFB_BITSIZEE(pTable) = bitSizeE;
+      MEFB_COMBSIZE(pTable) = combSize;
+      MEFB_NCOLS(pTable)    = (bitSizeE + combSize-1)/combSize;
+      MEFB_MODULUS(pTable)  = (BNU_CHUNK_T*)ptr;
+      ptr += nsM*(Ipp32s)sizeof(BNU_CHUNK_T);
+      MEFB_TABLE(pTable)    = (BNU_CHUNK_T*)( IPP_ALIGNED_PTR(ptr, CACHE_LINE_SIZE) );
+
+      COPY_BNU(MEFB_MODULUS(pTable), MOD_MODULUS(pME), nsM);
+
+      if(!cpMontExpFixedBaseInitTable(MEFB_TABLE(pTable), BN_NUMBER(pA), BN_SIZE(pA), combSize, MEFB_NCOLS(pTable), pME))
+         return ippStsErr;
+
+      MEFB_SET_ID(pTable);
+      return ippStsNoErr;
+   }
+}
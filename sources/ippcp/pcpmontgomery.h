@@ -25,8 +25,9 @@
 
 #include "pcpbn.h"
 #include "gsmodstuff.h"
+#include "gsscramble.h"
 
-#define MONT_DEFAULT_POOL_LENGTH (6)
+#define MONT_DEFAULT_POOL_LENGTH (6 + KARATSUBA_POOL_LENGTH)
 
 /*
 // Montgomery spec structure
@@ -262,6 +263,46 @@ __IPPCP_INLINE void cpMontExpBin_BN(IppsBigNumState* pYbn,
 #define cpFastMontMultiExp OWNAPI(cpFastMontMultiExp)
    IPP_OWN_DECL (void, cpFastMontMultiExp, (BNU_CHUNK_T* pY, const BNU_CHUNK_T* pPrecomTbl, const Ipp8u** ppE, cpSize eItemBitSize, cpSize numItems, gsModEngine* pMont))
 /*
+// Fixed-base exponentiation (comb method)
+//
+// The exponent of bitSizeE bits is split into combSize rows of nCols bits;
+// the table contains 2^combSize products of X^(2^(i*nCols)), i=0..combSize-1,
+// stored in scrambled form.
+*/
+struct _cpMontExpFixedBase
+{
+   Ipp32u         idCtx;      /* fixed-base table identifier   */
+   cpSize         modLen;     /* length of modulus             */
+   int            bitSizeE;   /* max bitsize of the exponent   */
+   int            combSize;   /* comb size (number of rows)    */
+   int            nCols;      /* number of comb columns        */
+   BNU_CHUNK_T*   pModulus;   /* copy of the modulus           */
+   BNU_CHUNK_T*   pTable;     /* scrambled table of multipliers */
+};
+
+/* accessory macros */
+#define MEFB_SET_ID(ctx)    ((ctx)->idCtx = (Ipp32u)idCtxMontExpFixedBase ^ (Ipp32u)IPP_UINT_PTR(ctx))
+#define MEFB_MODLEN(ctx)    ((ctx)->modLen)
+#define MEFB_BITSIZEE(ctx)  ((ctx)->bitSizeE)
+#define MEFB_COMBSIZE(ctx)  ((ctx)->combSize)
+#define MEFB_NCOLS(ctx)     ((ctx)->nCols)
+#define MEFB_MODULUS(ctx)   ((ctx)->pModulus)
+#define MEFB_TABLE(ctx)     ((ctx)->pTable)
+
+#define MEFB_VALID_ID(ctx)  ((((ctx)->idCtx) ^ (Ipp32u)IPP_UINT_PTR((ctx))) == (Ipp32u)idCtxMontExpFixedBase)
+
+/* comb size for the exponent of bitSizeE bits (limited by scramble table width) */
+__IPPCP_INLINE int cpMontExpFixedBase_CombSize(int bitSizeE)
+{
+   return IPP_MIN(MAX_W, bitSizeE);
+}
+
+#define cpMontExpFixedBaseInitTable OWNAPI(cpMontExpFixedBaseInitTable)
+   IPP_OWN_DECL (int, cpMontExpFixedBaseInitTable, (BNU_CHUNK_T* pTable, const BNU_CHUNK_T* pX, cpSize nsX, int combSize, int nCols, gsModEngine* pMont))
+#define cpMontExpFixedBase_BNU_sscm OWNAPI(cpMontExpFixedBase_BNU_sscm)
+   IPP_OWN_DECL (cpSize, cpMontExpFixedBase_BNU_sscm, (BNU_CHUNK_T* pY, const BNU_CHUNK_T* pE, cpSize nsE, const BNU_CHUNK_T* pTable, int combSize, int nCols, gsModEngine* pMont))
+
+/*
 // Montgomery inversion
 */
 #define cpMontInv_BNU OWNAPI(cpMontInv_BNU)
@@ -101,7 +101,7 @@ struct _cpRSA_private_key {
 /* alignment */
 #define RSA_PRIVATE_KEY_ALIGNMENT ((int)(sizeof(void*)))
 
-#define MOD_ENGINE_RSA_POOL_SIZE    (2)
+#define MOD_ENGINE_RSA_POOL_SIZE    (2 + KARATSUBA_POOL_LENGTH)
 
 /*
 // Montgomery engine preparation (GetSize/init/Set)
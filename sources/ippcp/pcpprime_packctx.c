@@ -47,6 +47,12 @@ IPP_OWN_DEFN (void, cpPackPrimeCtx, (const IppsPrimeState* pCtx, Ipp8u* pBuffer)
 
    CopyBlock(pCtx, pB, sizeof(IppsPrimeState));
 
+   /* workers refer to the external resources and are not serialized */
+   PRIME_RUNNER(pB) = NULL;
+   PRIME_RUNPARAM(pB) = NULL;
+   PRIME_WORKERS(pB) = 0;
+   PRIME_SLOTS(pB) = NULL;
+
    cpSize dataAlignment = (cpSize)(IPP_INT_PTR(PRIME_NUMBER(pCtx)) - IPP_INT_PTR(pCtx) - (IPP_INT64)sizeof(IppsPrimeState));
    cpSize gsMontOffset = (cpSize)(IPP_INT_PTR(PRIME_MONT(pCtx)) - IPP_INT_PTR(pCtx) - dataAlignment);
 
@@ -0,0 +1,367 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Prime Number Primitives.
+//
+//  Contents:
+//        cpPrimeMRSlotSize()
+//        cpPrimeMRSlotInit()
+//        cpPrimeGetWorkers()
+//        cpPrimeTestMR()
+//        cpPrimeSearch()
+//
+*/
+
+#include "owncp.h"
+#include "pcpprimeg.h"
+#include "pcpprng.h"
+#include "pcpngmontexpstuff.h"
+#include "pcptool.h"
+
+/*
+// worker resources: the engine followed by candidate, witness and two temporary values
+*/
+IPP_OWN_DEFN (int, cpPrimeMRSlotSize, (int maxBitSize))
+{
+   cpSize ns = BITS_BNU_CHUNK(maxBitSize);
+   int engineSize;
+   gsModEngineGetSize(maxBitSize, MONT_DEFAULT_POOL_LENGTH, &engineSize);
+
+   /* resources of the workers are kept on separate cache lines */
+   return IPP_ALIGNED_SIZE(engineSize + 4*ns*(Ipp32s)sizeof(BNU_CHUNK_T), CACHE_LINE_SIZE);
+}
+
+IPP_OWN_DEFN (void, cpPrimeMRSlotInit, (cpPrimeMRSlot* pSlot, int maxBitSize, Ipp8u* pBuffer))
+{
+   cpSize ns = BITS_BNU_CHUNK(maxBitSize);
+   int engineSize;
+   gsModEngineGetSize(maxBitSize, MONT_DEFAULT_POOL_LENGTH, &engineSize);
+
+   pSlot->pME = (gsModEngine*)pBuffer;
+   pSlot->poolLen = MONT_DEFAULT_POOL_LENGTH;
+   pSlot->sscm = 1;
+   pSlot->pPrime = NULL;
+   pSlot->ns = 0;
+   pSlot->pCand    = (BNU_CHUNK_T*)(IPP_ALIGNED_PTR(pBuffer + engineSize, (int)sizeof(BNU_CHUNK_T)));
+   pSlot->pWitness = pSlot->pCand + ns;
+   pSlot->pOdd     = pSlot->pWitness + ns;
+   pSlot->pPrime1  = pSlot->pOdd + ns;
+   pSlot->pScratch = NULL;
+   pSlot->result = 0;
+}
+
+/*
+// Sets up the workers of the prime context.
+// If no workers have been set up, single worker using the context resources is used.
+*/
+IPP_OWN_DEFN (void, cpPrimeGetWorkers, (cpPrimeWorkers* pWorkers, cpPrimeMRSlot* pLocalSlot, IppsPrimeState* pCtx, int sscm))
+{
+   int n;
+
+   if(PRIME_WORKERS(pCtx)) {
+      pWorkers->runFunc = PRIME_RUNNER(pCtx);
+      pWorkers->pRunParam = PRIME_RUNPARAM(pCtx);
+      pWorkers->nSlots = PRIME_WORKERS(pCtx);
+      pWorkers->pSlots = PRIME_SLOTS(pCtx);
+   }
+   else {
+      pLocalSlot->pME = PRIME_MONT(pCtx);
+      pLocalSlot->poolLen = MONT_DEFAULT_POOL_LENGTH;
+      pLocalSlot->pPrime = NULL;
+      pLocalSlot->ns = 0;
+      pLocalSlot->pCand = PRIME_NUMBER(pCtx);
+      pLocalSlot->pWitness = PRIME_TEMP1(pCtx);
+      pLocalSlot->pOdd = PRIME_TEMP2(pCtx);
+      pLocalSlot->pPrime1 = PRIME_TEMP3(pCtx);
+      pLocalSlot->pScratch = NULL;
+      pLocalSlot->result = 0;
+
+      pWorkers->runFunc = NULL;
+      pWorkers->pRunParam = NULL;
+      pWorkers->nSlots = 1;
+      pWorkers->pSlots = pLocalSlot;
+   }
+
+   for(n=0; n<pWorkers->nSlots; n++)
+      pWorkers->pSlots[n].sscm = sscm;
+}
+
+/*
+// Single round of Miller-Rabin test of pSlot->pPrime against pSlot->pWitness
+//
+// returns:
+//    1 - probable prime
+//    0 - composite
+//   -1 - internal error
+*/
+static int cpPrimeMRRound(cpPrimeMRSlot* pSlot)
+{
+   gsModEngine* pME = pSlot->pME;
+   const BNU_CHUNK_T* pPrime = pSlot->pPrime;
+   cpSize ns = pSlot->ns;
+   BNU_CHUNK_T* pW = pSlot->pWitness;
+   BNU_CHUNK_T* pOdd = pSlot->pOdd;
+   BNU_CHUNK_T* pPrime1 = pSlot->pPrime1;
+   cpSize k, a, nsOdd;
+
+   gsModEngineInit(pME, (Ipp32u*)pPrime, BITSIZE_BNU(pPrime, ns), pSlot->poolLen, gsModArithMont());
+
+   /* prime-1 = odd*2^a */
+   cpDec_BNU(pOdd, pPrime, ns, 1);
+   for(k=0, a=0; k<ns; k++) {
+      cpSize da = cpNTZ_BNU(pOdd[k]);
+      a += da;
+      if(BNU_CHUNK_BITS != da)
+         break;
+   }
+   nsOdd = cpLSR_BNU(pOdd, pOdd, ns, a);
+   FIX_BNU(pOdd, nsOdd);
+
+   /* prime-1 (Montgomery Domain) */
+   cpSub_BNU(pPrime1, pPrime, MOD_MNT_R(pME), ns);
+
+   /* w = witness^odd */
+   cpMontEnc_BNU_EX(pW, pW, ns, pME);
+   if(pSlot->sscm && pSlot->pScratch)
+      gsMontExpBin_BNU_sscm(pW, pW, ns, pOdd, BITSIZE_BNU(pOdd, nsOdd), pME, pSlot->pScratch);
+   else if(0 > (pSlot->sscm? cpMontExpBin_BNU_sscm(pW, pW, ns, pOdd, nsOdd, pME)
+                           : cpMontExpBin_BNU(pW, pW, ns, pOdd, nsOdd, pME)))
+      return -1;
+
+   /* if (w==1) ||(w==prime-1) => probably prime */
+   if((0 == cpCmp_BNU(pW, ns, MOD_MNT_R(pME), ns))
+    ||(0 == cpCmp_BNU(pW, ns, pPrime1, ns)))
+      return 1;
+
+   while(--a) {
+      cpMontSqr_BNU(pW, pW, pME);
+      if(0 == cpCmp_BNU(pW, ns, MOD_MNT_R(pME), ns))
+         return 0;   /* witness of the compositeness */
+      if(0 == cpCmp_BNU(pW, ns, pPrime1, ns))
+         return 1;   /* witness of the primality */
+   }
+   return 0;
+}
+
+static void IPP_CALL cpPrimeMRTask(void* pTaskParam, int taskIdx)
+{
+   cpPrimeMRSlot* pSlot = (cpPrimeMRSlot*)pTaskParam + taskIdx;
+   pSlot->result = cpPrimeMRRound(pSlot);
+}
+
+/*
+// Draws witnesses (1 < w < prime-1) of the first nTasks workers and evaluates them.
+// Witnesses are generated here, so rndFunc is never called by the workers.
+//
+// returns:
+//    1 - rounds have been evaluated
+//    0 - witness has not been generated
+//   -1 - internal error
+*/
+static int cpPrimeRunMR(const cpPrimeWorkers* pWorkers, int nTasks, IppBitSupplier rndFunc, void* pRndParam)
+{
+   cpPrimeMRSlot* pSlots = pWorkers->pSlots;
+   int n;
+
+   for(n=0; n<nTasks; n++) {
+      BNU_CHUNK_T one = 1;
+      int ret;
+      cpDec_BNU(pSlots[n].pPrime1, pSlots[n].pPrime, pSlots[n].ns, 1);
+      ret = cpPRNGenRange(pSlots[n].pWitness, &one, 1, pSlots[n].pPrime1, pSlots[n].ns, rndFunc, pRndParam);
+      if(1 != ret)
+         return ret;
+   }
+
+   if(pWorkers->runFunc && nTasks>1) {
+      if(ippStsNoErr != pWorkers->runFunc(cpPrimeMRTask, pSlots, nTasks, pWorkers->pRunParam))
+         return -1;
+   }
+   else {
+      for(n=0; n<nTasks; n++)
+         cpPrimeMRTask(pSlots, n);
+   }
+   return 1;
+}
+
+/*F*
+// Name: cpPrimeTestMR
+//
+// Purpose: Miller-Rabin test of odd value (pre-tested by trial division),
+//          rounds are distributed over the workers.
+//
+// Returns:
+//    1 - probable prime
+//    0 - composite
+//   -1 - internal error
+//
+// Parameters:
+//    pPrime      value under the test
+//    ns          length of the value
+//    nTrials     number of the rounds
+//    pWorkers    workers
+//    rndFunc     external PRNG
+//    pRndParam   pointer to the external PRNG parameters
+*F*/
+IPP_OWN_DEFN (int, cpPrimeTestMR, (const BNU_CHUNK_T* pPrime, cpSize ns, int nTrials, const cpPrimeWorkers* pWorkers, IppBitSupplier rndFunc, void* pRndParam))
+{
+   int k, n;
+
+   FIX_BNU(pPrime, ns);
+
+   for(k=0; k<nTrials; k+=pWorkers->nSlots) {
+      int nTasks = IPP_MIN(pWorkers->nSlots, nTrials-k);
+      int ret;
+
+      for(n=0; n<nTasks; n++) {
+         pWorkers->pSlots[n].pPrime = pPrime;
+         pWorkers->pSlots[n].ns = ns;
+      }
+
+      ret = cpPrimeRunMR(pWorkers, nTasks, rndFunc, pRndParam);
+      if(1 != ret)
+         return ret<0? -1 : 0;
+
+      for(n=0; n<nTasks; n++) {
+         if(1 != pWorkers->pSlots[n].result)
+            return pWorkers->pSlots[n].result;
+      }
+   }
+   return 1;
+}
+
+/*F*
+// Name: cpPrimeSearch
+//
+// Purpose: Generates a probable prime of the specified bitlength.
+//
+// Returns:
+//    1 - prime has been found
+//    0 - prime has not been found within maxCandidates odd candidates
+//   -1 - internal error
+//
+// Parameters:
+//    pPrime         generated prime
+//    nBits          bitlength of the prime
+//    nTrials        number of Miller-Rabin rounds
+//    maxCandidates  max number of odd candidates
+//    pBase          temporary of the prime length
+//    filterFunc     additional candidate test (optional)
+//    pFilterParam   parameters of the filter
+//    pWorkers       Miller-Rabin workers
+//    rndFunc        external PRNG
+//    pRndParam      pointer to the external PRNG parameters
+//
+// Note:
+//    Random odd start value of nBits is drawn, the consecutive odd numbers
+//    having no small factors (see cpPrimeSieve) are filtered and tested.
+//    First Miller-Rabin round is applied to a batch of candidates
+//    (one candidate per worker, at most PRIME_MR_MAXBATCH), the passed candidates
+//    are tested in order by remaining nTrials-1 rounds.
+*F*/
+IPP_OWN_DEFN (int, cpPrimeSearch, (BNU_CHUNK_T* pPrime, int nBits, int nTrials, int maxCandidates,
+                                   BNU_CHUNK_T* pBase,
+                                   cpPrimeFilter filterFunc, void* pFilterParam,
+                                   const cpPrimeWorkers* pWorkers,
+                                   IppBitSupplier rndFunc, void* pRndParam))
+{
+   cpSize ns = BITS_BNU_CHUNK(nBits);
+   BNU_CHUNK_T topPattern = (BNU_CHUNK_T)1 << ((nBits-1)&(BNU_CHUNK_BITS-1));
+   cpPrimeMRSlot* pSlots = pWorkers->pSlots;
+   int maxTasks = IPP_MIN(pWorkers->nSlots, PRIME_MR_MAXBATCH);
+   int count = 0;
+
+   cpPrimeSieve sieve;
+
+   /* Miller-Rabin witness does not exist */
+   if(nBits < 3)
+      return 0;
+
+   while(count<maxCandidates) {
+      int exhausted = 0;
+
+      int ret = cpPRNGenPattern(pBase, nBits, (BNU_CHUNK_T)1, topPattern, rndFunc, pRndParam);
+      if(1 != ret)
+         return ret<0? -1 : 0;
+
+      cpPrimeSieveInit(&sieve, pBase, ns);
+
+      while(count<maxCandidates && !exhausted) {
+         int nTasks, n;
+         /* first round results: the slots are reused by the remaining rounds */
+         int isProbable[PRIME_MR_MAXBATCH];
+
+         /* collect a batch of candidates */
+         for(nTasks=0; nTasks<maxTasks && count<maxCandidates; ) {
+            BNU_CHUNK_T* pCand = pSlots[nTasks].pCand;
+            int passed = cpPrimeSieveNext(&sieve, pCand);
+
+            /* out of nBits range, draw the new start value */
+            if(0==passed || nBits!=BITSIZE_BNU(pCand, ns)) {
+               exhausted = 1;
+               break;
+            }
+            count += passed;
+
+            if(filterFunc) {
+               int filter = filterFunc(pCand, ns, pFilterParam);
+               /* start value is not suitable */
+               if(0 > filter) {
+                  exhausted = 1;
+                  break;
+               }
+               if(0 == filter)
+                  continue;
+            }
+
+            pSlots[nTasks].pPrime = pCand;
+            pSlots[nTasks].ns = ns;
+            nTasks++;
+         }
+         if(0==nTasks)
+            continue;
+
+         /* first round */
+         ret = cpPrimeRunMR(pWorkers, nTasks, rndFunc, pRndParam);
+         if(1 != ret)
+            return ret<0? -1 : 0;
+
+         for(n=0; n<nTasks; n++) {
+            if(0 > pSlots[n].result)
+               return -1;
+            isProbable[n] = pSlots[n].result;
+         }
+
+         for(n=0; n<nTasks; n++) {
+            if(isProbable[n]) {
+               /* remaining rounds (the candidate is kept in n-th slot storage) */
+               const BNU_CHUNK_T* pCand = pSlots[n].pCand;
+               ret = (nTrials>1)? cpPrimeTestMR(pCand, ns, nTrials-1, pWorkers, rndFunc, pRndParam) : 1;
+               if(0 > ret)
+                  return -1;
+               if(ret) {
+                  COPY_BNU(pPrime, pCand, ns);
+                  return 1;
+               }
+            }
+         }
+      }
+   }
+   return 0;
+}
@@ -0,0 +1,170 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Prime Number Primitives.
+//
+//  Contents:
+//        cpPrimeSieveInit()
+//        cpPrimeSieveNext()
+//
+*/
+
+#include "owncp.h"
+#include "pcpprimeg.h"
+#include "pcptool.h"
+
+static Ipp32u sieveMod32(const Ipp32u* pX, cpSize len32, Ipp32u divider)
+{
+   cpSize n;
+   Ipp32u r;
+   for(n=len32, r=0; n>0; n--) {
+      Ipp64u tmp = IPP_MAKEDWORD(pX[n-1],r);
+      r = (Ipp32u)(tmp%divider);
+   }
+   return r;
+}
+
+/* odd primes below PRIME_SIEVE_BOUND (sieve of Eratosthenes) */
+static int sievePrimes(Ipp16u* pPrime)
+{
+   /* bit k corresponds to 2*k+1 */
+   Ipp32u composite[PRIME_SIEVE_BOUND/64];
+   int k, n;
+
+   PadBlock(0, composite, sizeof(composite));
+   for(k=1, n=0; k<PRIME_SIEVE_BOUND/2; k++) {
+      if(composite[k/32] & ((Ipp32u)1<<(k%32)))
+         continue;
+      else {
+         int p = 2*k+1;
+         int j;
+         for(j=(p*p)/2; j<PRIME_SIEVE_BOUND/2; j+=p)
+            composite[j/32] |= (Ipp32u)1<<(j%32);
+         if(n<PRIME_SIEVE_NPRIMES)
+            pPrime[n++] = (Ipp16u)p;
+      }
+   }
+   return n;
+}
+
+/* marks the positions of the window divisible by the sieving primes */
+static void sieveWindow(cpPrimeSieve* pSieve)
+{
+   int n;
+
+   PadBlock(0xFF, pSieve->survivor, sizeof(pSieve->survivor));
+
+   for(n=0; n<pSieve->nPrimes; n++) {
+      int p = pSieve->prime[n];
+      int r = pSieve->residue[n];
+
+      /* first i: base+2*i == 0 (mod p) */
+      int i = (p - r) % p;
+      i = (i & 1)? (i+p)/2 : i/2;
+
+      for(; i<PRIME_SIEVE_WINDOW; i+=p)
+         pSieve->survivor[i/32] &= ~((Ipp32u)1<<(i%32));
+   }
+   pSieve->pos = 0;
+}
+
+/*F*
+// Name: cpPrimeSieveInit
+//
+// Purpose: Sets up the sieve of the odd candidates starting from the base.
+//
+// Parameters:
+//    pSieve      pointer to the sieve
+//    pBase       odd base value (most significant bit of the candidates set),
+//                updated when the window slides
+//    ns          length of the base
+*F*/
+IPP_OWN_DEFN (void, cpPrimeSieveInit, (cpPrimeSieve* pSieve, BNU_CHUNK_T* pBase, cpSize ns))
+{
+   const Ipp32u* pBase32 = (const Ipp32u*)pBase;
+   cpSize len32 = ns*(cpSize)(sizeof(BNU_CHUNK_T)/sizeof(Ipp32u));
+   int n;
+
+   pSieve->pBase = pBase;
+   pSieve->nsBase = ns;
+   pSieve->nPrimes = sievePrimes(pSieve->prime);
+
+   /* sieving primes have to be less than any candidate */
+   {
+      int bitSize = BITSIZE_BNU(pBase, ns);
+      if(bitSize <= 16) {
+         while(pSieve->nPrimes && pSieve->prime[pSieve->nPrimes-1] >= ((Ipp32u)1<<(bitSize-1)))
+            pSieve->nPrimes--;
+      }
+   }
+
+   /* residues of the base, two primes per division (p0*p1 < 2^32) */
+   for(n=0; n+1<pSieve->nPrimes; n+=2) {
+      Ipp32u p0 = pSieve->prime[n];
+      Ipp32u p1 = pSieve->prime[n+1];
+      Ipp32u r = sieveMod32(pBase32, len32, p0*p1);
+      pSieve->residue[n]   = (Ipp16u)(r % p0);
+      pSieve->residue[n+1] = (Ipp16u)(r % p1);
+   }
+   if(n<pSieve->nPrimes)
+      pSieve->residue[n] = (Ipp16u)sieveMod32(pBase32, len32, pSieve->prime[n]);
+
+   sieveWindow(pSieve);
+}
+
+/*F*
+// Name: cpPrimeSieveNext
+//
+// Purpose: Gets the next candidate having no small factors.
+//
+// Returns:
+//    number of the odd positions passed (including the candidate one)
+//    0 if the candidate exceeds the length of the base
+//
+// Parameters:
+//    pSieve      pointer to the sieve
+//    pCandidate  pointer to the candidate
+*F*/
+IPP_OWN_DEFN (int, cpPrimeSieveNext, (cpPrimeSieve* pSieve, BNU_CHUNK_T* pCandidate))
+{
+   int passed = 0;
+
+   for(;;) {
+      int i;
+      for(i=pSieve->pos; i<PRIME_SIEVE_WINDOW; i++) {
+         if(pSieve->survivor[i/32] & ((Ipp32u)1<<(i%32))) {
+            passed += i - pSieve->pos + 1;
+            pSieve->pos = i+1;
+            return cpInc_BNU(pCandidate, pSieve->pBase, pSieve->nsBase, (BNU_CHUNK_T)(2*i))? 0 : passed;
+         }
+      }
+      passed += PRIME_SIEVE_WINDOW - pSieve->pos;
+
+      /* slide the window: base += 2*PRIME_SIEVE_WINDOW */
+      if(cpInc_BNU(pSieve->pBase, pSieve->pBase, pSieve->nsBase, (BNU_CHUNK_T)(2*PRIME_SIEVE_WINDOW)))
+         return 0;
+      {
+         int n;
+         for(n=0; n<pSieve->nPrimes; n++)
+            pSieve->residue[n] = (Ipp16u)((pSieve->residue[n] + 2*PRIME_SIEVE_WINDOW) % pSieve->prime[n]);
+      }
+      sieveWindow(pSieve);
+   }
+}
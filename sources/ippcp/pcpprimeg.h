@@ -40,6 +40,10 @@ struct _cpPrime {
    BNU_CHUNK_T*      pT2;        /* temporary BNU */
    BNU_CHUNK_T*      pT3;        /* temporary BNU */
    gsModEngine*      pMont;      /* montgomery engine        */
+   IppTaskRunner     runFunc;    /* external task runner (optional) */
+   void*             pRunParam;  /* task runner parameters          */
+   int               nWorkers;   /* number of Miller-Rabin workers  */
+   struct _cpPrimeMRSlot* pSlots;/* workers' resources              */
 };
 
 /* alignment */
@@ -53,6 +57,10 @@ struct _cpPrime {
 #define PRIME_TEMP2(ctx)      ((ctx)->pT2)
 #define PRIME_TEMP3(ctx)      ((ctx)->pT3)
 #define PRIME_MONT(ctx)       ((ctx)->pMont)
+#define PRIME_RUNNER(ctx)     ((ctx)->runFunc)
+#define PRIME_RUNPARAM(ctx)   ((ctx)->pRunParam)
+#define PRIME_WORKERS(ctx)    ((ctx)->nWorkers)
+#define PRIME_SLOTS(ctx)      ((ctx)->pSlots)
 
 #define PRIME_VALID_ID(ctx)   ((((ctx)->idCtx) ^ (Ipp32u)IPP_UINT_PTR((ctx))) == (Ipp32u)idCtxPrimeNumber)
 
@@ -81,6 +89,83 @@ struct _cpPrime {
 #define cpPrimeTest OWNAPI(cpPrimeTest)
    IPP_OWN_DECL (int, cpPrimeTest, (const BNU_CHUNK_T* pPrime, cpSize primeLen, cpSize nTrials, IppsPrimeState* pCtx, IppBitSupplier rndFunc, void* pRndParam))
 
+/*
+// Incremental sieve of the odd candidates base, base+2, base+4, ...
+// residues of the base modulo small odd primes are updated by addition
+// when the window slides
+*/
+#define PRIME_SIEVE_BOUND    (1<<14)  /* odd primes below the bound are used for sieving */
+#define PRIME_SIEVE_NPRIMES  (1899)   /* number of odd primes below PRIME_SIEVE_BOUND    */
+#define PRIME_SIEVE_WINDOW   (2048)   /* number of odd candidates in the window          */
+#define PRIME_SIEVE_MINBITS  (64)     /* smaller numbers are generated directly           */
+
+/* max number of odd candidates examined by the search
+   (the expected distance between primes of nBits is about 0.35*nBits odd numbers) */
+#define PRIME_SIEVE_MAXCOUNT(nBits)  (20*(nBits))
+
+typedef struct _cpPrimeSieve {
+   BNU_CHUNK_T* pBase;     /* first candidate of the window */
+   cpSize       nsBase;    /* length of the candidate */
+   int          nPrimes;   /* number of sieving primes */
+   int          pos;       /* next position to look at */
+   Ipp16u       prime[PRIME_SIEVE_NPRIMES];
+   Ipp16u       residue[PRIME_SIEVE_NPRIMES];      /* base mod prime[] */
+   Ipp32u       survivor[PRIME_SIEVE_WINDOW/32];   /* bit i is set if base+2*i has no small factor */
+} cpPrimeSieve;
+
+#define cpPrimeSieveInit OWNAPI(cpPrimeSieveInit)
+   IPP_OWN_DECL (void, cpPrimeSieveInit, (cpPrimeSieve* pSieve, BNU_CHUNK_T* pBase, cpSize ns))
+#define cpPrimeSieveNext OWNAPI(cpPrimeSieveNext)
+   IPP_OWN_DECL (int, cpPrimeSieveNext, (cpPrimeSieve* pSieve, BNU_CHUNK_T* pCandidate))
+
+/*
+// Miller-Rabin worker resources
+// (a worker evaluates a single round of the test)
+*/
+typedef struct _cpPrimeMRSlot {
+   gsModEngine*       pME;       /* montgomery engine */
+   int                poolLen;   /* length of the engine pool */
+   int                sscm;      /* constant time exponentiation */
+   const BNU_CHUNK_T* pPrime;    /* value under the test */
+   cpSize             ns;        /* length of the value */
+   BNU_CHUNK_T*       pCand;     /* candidate storage */
+   BNU_CHUNK_T*       pWitness;  /* witness of the round */
+   BNU_CHUNK_T*       pOdd;      /* temporary */
+   BNU_CHUNK_T*       pPrime1;   /* temporary */
+   BNU_CHUNK_T*       pScratch;  /* exponentiation scratch (optional, 2 values) */
+   int                result;    /* 1/0/-1: probable prime/composite/error */
+} cpPrimeMRSlot;
+
+/* max number of candidates tested by the first Miller-Rabin round at once */
+#define PRIME_MR_MAXBATCH  (64)
+
+typedef struct _cpPrimeWorkers {
+   IppTaskRunner   runFunc;
+   void*           pRunParam;
+   int             nSlots;
+   cpPrimeMRSlot*  pSlots;
+} cpPrimeWorkers;
+
+/* size (bytes) of resources of single worker */
+#define cpPrimeMRSlotSize OWNAPI(cpPrimeMRSlotSize)
+   IPP_OWN_DECL (int, cpPrimeMRSlotSize, (int maxBitSize))
+#define cpPrimeMRSlotInit OWNAPI(cpPrimeMRSlotInit)
+   IPP_OWN_DECL (void, cpPrimeMRSlotInit, (cpPrimeMRSlot* pSlot, int maxBitSize, Ipp8u* pBuffer))
+#define cpPrimeGetWorkers OWNAPI(cpPrimeGetWorkers)
+   IPP_OWN_DECL (void, cpPrimeGetWorkers, (cpPrimeWorkers* pWorkers, cpPrimeMRSlot* pLocalSlot, IppsPrimeState* pCtx, int sscm))
+
+/* candidate filter returns:
+      1 - candidate is accepted
+      0 - candidate is rejected
+     -1 - candidate is rejected, new start value has to be drawn
+*/
+IPP_OWN_FUNPTR (int, cpPrimeFilter, (const BNU_CHUNK_T* pCandidate, cpSize ns, void* pParam))
+
+#define cpPrimeTestMR OWNAPI(cpPrimeTestMR)
+   IPP_OWN_DECL (int, cpPrimeTestMR, (const BNU_CHUNK_T* pPrime, cpSize ns, int nTrials, const cpPrimeWorkers* pWorkers, IppBitSupplier rndFunc, void* pRndParam))
+#define cpPrimeSearch OWNAPI(cpPrimeSearch)
+   IPP_OWN_DECL (int, cpPrimeSearch, (BNU_CHUNK_T* pPrime, int nBits, int nTrials, int maxCandidates, BNU_CHUNK_T* pBase, cpPrimeFilter filterFunc, void* pFilterParam, const cpPrimeWorkers* pWorkers, IppBitSupplier rndFunc, void* pRndParam))
+
 #define cpPackPrimeCtx OWNAPI(cpPackPrimeCtx)
    IPP_OWN_DECL (void, cpPackPrimeCtx, (const IppsPrimeState* pCtx, Ipp8u* pBuffer))
 #define cpUnpackPrimeCtx OWNAPI(cpUnpackPrimeCtx)
@@ -99,24 +99,41 @@ IPPFUN(IppStatus, ippsPrimeGen_BN, (IppsBigNumState* pPrime, int nBits,
       if (nTrials < 1)
          nTrials = MR_rounds_p80(nBits);
 
-      #define MAX_COUNT (1000)
-      for(count=0; count<MAX_COUNT && result!=IPP_IS_PRIME; count++) {
-         /* get trial number */
-         IppStatus sts = rndFunc((Ipp32u*)pRand, nBits, pRndParam);
-         if(ippStsNoErr!=sts)
-            return sts;
-
-         /* set up top and bottom bit to 1 */
-         pRand[0] |= botPattern;
-         pRand[randLen-1] &= topMask;
-         pRand[randLen-1] |= topPattern;
-
-         /* test trial number */
-         sts = ippsPrimeTest_BN(pPrime, nTrials, &result, pCtx, rndFunc, pRndParam);
-         if(ippStsNoErr!=sts)
-            return sts;
+      /* incremental sieve search */
+      if(nBits >= PRIME_SIEVE_MINBITS) {
+         cpPrimeMRSlot localSlot;
+         cpPrimeWorkers workers;
+         int ret;
+
+         /* the prime is stored into pRand when found, so pRand is used as the base */
+         cpPrimeGetWorkers(&workers, &localSlot, pCtx, 0);
+         ret = cpPrimeSearch(pRand, nBits, nTrials, PRIME_SIEVE_MAXCOUNT(nBits), pRand,
+                             NULL, NULL, &workers, rndFunc, pRndParam);
+         if(0 > ret)
+            return ippStsErr;
+         result = ret? IPP_IS_PRIME : IPP_IS_COMPOSITE;
+      }
+
+      else {
+         #define MAX_COUNT (1000)
+         for(count=0; count<MAX_COUNT && result!=IPP_IS_PRIME; count++) {
+            /* get trial number */
+            IppStatus sts = rndFunc((Ipp32u*)pRand, nBits, pRndParam);
+            if(ippStsNoErr!=sts)
+               return sts;
+
+            /* set up top and bottom bit to 1 */
+            pRand[0] |= botPattern;
+            pRand[randLen-1] &= topMask;
+            pRand[randLen-1] |= topPattern;
+
+            /* test trial number */
+            sts = ippsPrimeTest_BN(pPrime, nTrials, &result, pCtx, rndFunc, pRndParam);
+            if(ippStsNoErr!=sts)
+               return sts;
+         }
+         #undef MAX_COUNT
       }
-      #undef MAX_COUNT
 
       return result==IPP_IS_PRIME? ippStsNoErr : ippStsInsufficientEntropy;
    }
@@ -72,6 +72,12 @@ IPPFUN(IppStatus, ippsPrimeInit, (int nMaxBits, IppsPrimeState* pCtx))
       PRIME_MONT(pCtx) = (gsModEngine*)(ptr);
       gsModEngineInit(PRIME_MONT(pCtx), NULL, nMaxBits, MONT_DEFAULT_POOL_LENGTH, gsModArithMont());
 
+      /* no Miller-Rabin workers by default */
+      PRIME_RUNNER(pCtx) = NULL;
+      PRIME_RUNPARAM(pCtx) = NULL;
+      PRIME_WORKERS(pCtx) = 0;
+      PRIME_SLOTS(pCtx) = NULL;
+
       return ippStsNoErr;
    }
 }
@@ -0,0 +1,93 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Prime Number Primitives.
+//
+//  Contents:
+//        ippsPrimeSetWorkers()
+//
+*/
+
+#include "owncp.h"
+#include "pcpprimeg.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsPrimeSetWorkers
+//
+// Purpose: Sets up the workers evaluating Miller-Rabin rounds
+//          of ippsPrimeGen_BN(), ippsRSA_GenerateKeys() and ippsDLPGenerateDH()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pWorkBuffer, if 0 < nWorkers
+//    ippStsContextMatchErr      !PRIME_VALID_ID()
+//    ippStsBadArgErr            0 > nWorkers
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    runFunc     external task runner (NULL for the sequential evaluation)
+//    pRunParam   pointer to the task runner parameters
+//    nWorkers    number of the workers (0 resets the workers)
+//    pWorkBuffer buffer of ippsPrimeWorkBufferSize() bytes
+//    pCtx        pointer to the context
+//
+// Note:
+//    pWorkBuffer is used by the context until the workers are reset
+//    or the context is initialized again. The context does not own
+//    the runner and the buffer, so ippsPrimePack() does not save them.
+*F*/
+IPPFUN(IppStatus, ippsPrimeSetWorkers, (IppTaskRunner runFunc, void* pRunParam,
+                                        int nWorkers, Ipp8u* pWorkBuffer,
+                                        IppsPrimeState* pCtx))
+{
+   IPP_BAD_PTR1_RET(pCtx);
+   IPP_BADARG_RET(!PRIME_VALID_ID(pCtx), ippStsContextMatchErr);
+   IPP_BADARG_RET(nWorkers<0, ippStsBadArgErr);
+
+   if(0==nWorkers) {
+      PRIME_RUNNER(pCtx) = NULL;
+      PRIME_RUNPARAM(pCtx) = NULL;
+      PRIME_WORKERS(pCtx) = 0;
+      PRIME_SLOTS(pCtx) = NULL;
+      return ippStsNoErr;
+   }
+
+   IPP_BAD_PTR1_RET(pWorkBuffer);
+
+   {
+      int maxBits = PRIME_MAXBITSIZE(pCtx);
+      int slotSize = cpPrimeMRSlotSize(maxBits);
+      int n;
+
+      /* slot descriptors are followed by the slots resources */
+      cpPrimeMRSlot* pSlots = (cpPrimeMRSlot*)(IPP_ALIGNED_PTR(pWorkBuffer, CACHE_LINE_SIZE));
+      Ipp8u* ptr = (Ipp8u*)(IPP_ALIGNED_PTR(pSlots+nWorkers, CACHE_LINE_SIZE));
+
+      for(n=0; n<nWorkers; n++, ptr+=slotSize)
+         cpPrimeMRSlotInit(pSlots+n, maxBits, ptr);
+
+      PRIME_RUNNER(pCtx) = runFunc;
+      PRIME_RUNPARAM(pCtx) = pRunParam;
+      PRIME_WORKERS(pCtx) = nWorkers;
+      PRIME_SLOTS(pCtx) = pSlots;
+      return ippStsNoErr;
+   }
+}
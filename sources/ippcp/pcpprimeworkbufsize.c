@@ -0,0 +1,66 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//  Purpose:
+//     Intel(R) Cryptography Primitives Library
+//     Prime Number Primitives.
+//
+//  Contents:
+//        ippsPrimeWorkBufferSize()
+//
+*/
+
+#include "owncp.h"
+#include "pcpprimeg.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsPrimeWorkBufferSize
+//
+// Purpose: Returns size of the buffer of the Miller-Rabin workers (bytes).
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pCtx
+//                               NULL == pSize
+//    ippStsContextMatchErr      !PRIME_VALID_ID()
+//    ippStsBadArgErr            1 > nWorkers
+//                               nWorkers is too big
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    nWorkers number of the workers
+//    pCtx     pointer to the context
+//    pSize    pointer to the size of the buffer
+*F*/
+IPPFUN(IppStatus, ippsPrimeWorkBufferSize, (int nWorkers, const IppsPrimeState* pCtx, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pCtx, pSize);
+   IPP_BADARG_RET(!PRIME_VALID_ID(pCtx), ippStsContextMatchErr);
+   IPP_BADARG_RET(nWorkers<1, ippStsBadArgErr);
+
+   {
+      int slotSize = cpPrimeMRSlotSize(PRIME_MAXBITSIZE(pCtx));
+      IPP_BADARG_RET(nWorkers > (IPP_MAX_32S/2)/(slotSize + (Ipp32s)sizeof(cpPrimeMRSlot)), ippStsBadArgErr);
+
+      /* slot descriptors followed by the slots resources */
+      *pSize = IPP_ALIGNED_SIZE(nWorkers*(Ipp32s)sizeof(cpPrimeMRSlot), CACHE_LINE_SIZE)
+              +nWorkers*slotSize
+              +CACHE_LINE_SIZE-1;
+      return ippStsNoErr;
+   }
+}
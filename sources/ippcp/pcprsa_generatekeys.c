@@ -33,7 +33,62 @@
 #include "pcpngrsa.h"
 
 #include "pcpprime_isco.h"
-#include "pcpprime_isprob.h"
+
+/*
+// RSA factor candidate filters
+*/
+typedef struct {
+   BNU_CHUNK_T*       pE;             /* public exponent */
+   cpSize             nsE;
+   BNU_CHUNK_T*       pFactor1;       /* factor-1 */
+   BNU_CHUNK_T*       pBuffer;        /* temporary buffer */
+   const BNU_CHUNK_T* pFactorP;       /* P factor (Q filter only) */
+   int                factorPbitSize;
+   BNU_CHUNK_T*       pProdN;         /* P*Q      (Q filter only) */
+   cpSize             nsN;
+   int                modulusBitSize;
+} rsaFactorFilterParam;
+
+/* E and (P-1) are co-prime */
+static int rsaFactorFilterP(const BNU_CHUNK_T* pFactor, cpSize ns, void* pParam)
+{
+   rsaFactorFilterParam* pFilter = (rsaFactorFilterParam*)pParam;
+
+   cpDec_BNU(pFilter->pFactor1, pFactor, ns, 1);
+   return cpIsCoPrime(pFilter->pE, pFilter->nsE, pFilter->pFactor1, ns, pFilter->pBuffer);
+}
+
+static int rsaFactorFilterQ(const BNU_CHUNK_T* pFactor, cpSize ns, void* pParam)
+{
+   rsaFactorFilterParam* pFilter = (rsaFactorFilterParam*)pParam;
+   cpSize nsP = BITS_BNU_CHUNK(pFilter->factorPbitSize);
+
+   /* test if P and Q are close each other */
+   if(pFilter->factorPbitSize==BITSIZE_BNU(pFactor, ns)) {
+      int cmp_res = cpCmp_BNU(pFilter->pFactorP, nsP, pFactor, nsP);
+
+      if(0==cmp_res) return 0;    /* P==Q */
+      else {
+         if(cmp_res<0)
+            cpSub_BNU(pFilter->pBuffer, pFactor, pFilter->pFactorP, nsP);
+         else
+            cpSub_BNU(pFilter->pBuffer, pFilter->pFactorP, pFactor, nsP);
+
+         if(pFilter->factorPbitSize>=512) {
+            int bitsize = BITSIZE_BNU(pFilter->pBuffer, nsP);
+            if(bitsize < (pFilter->factorPbitSize-100)) return -1; /* abs(P-Q) <=2^(factorPbitSize-100)*/
+         }
+      }
+   }
+
+   /* test if bitsize(N) = bitsize(P)+bitsize(Q),
+      neighbouring candidates would fail too, so new start value is requested */
+   cpMul_BNU_school(pFilter->pProdN, pFilter->pFactorP, nsP, pFactor, ns);
+   if(pFilter->modulusBitSize != BITSIZE_BNU(pFilter->pProdN, pFilter->nsN)) return -1;
+
+   /* E and (Q-1) are co-prime */
+   return rsaFactorFilterP(pFactor, ns, pParam);
+}
 
 /*F*
 // Name: ippsRSA_GenerateKeys
@@ -45,7 +100,6 @@
 //                               NULL == pPublicExp
 //                               NULL == pModulus
 //                               NULL == pPrivateKeyType2
-//                               NULL == pPrimeGen
 //                               NULL == pBuffer
 //                               NULL == rndFunc
 //
@@ -74,9 +128,14 @@
 //    pPrivateKeyType1  (optional) pointer to the private key type1 context
 //    pBuffer           pointer to the temporary buffer
 //    nTrials           parameter of Miller-Rabin Test
-//    pPrimeGen         pointer to the Prime generator context
+//    pPrimeGen         (optional) pointer to the Prime generator context
 //    rndFunc           external PRNG
 //    pRndParam         pointer to the external PRNG parameters
+//
+// Note:
+//    Factor candidates are consecutive odd numbers sieved by the small primes.
+//    If the workers of pPrimeGen have been set up by ippsPrimeSetWorkers(),
+//    Miller-Rabin rounds are evaluated by the workers concurrently.
 *F*/
 IPPFUN(IppStatus, ippsRSA_GenerateKeys,(const IppsBigNumState* pSrcPublicExp,
                                         IppsBigNumState* pModulus,
@@ -111,7 +170,9 @@ IPPFUN(IppStatus, ippsRSA_GenerateKeys,(const IppsBigNumState* pSrcPublicExp,
 
    IPP_BAD_PTR2_RET(pBuffer, rndFunc);
 
-   IPP_UNREFERENCED_PARAMETER(pPrimeGen);
+   if(pPrimeGen) {
+      IPP_BADARG_RET(!PRIME_VALID_ID(pPrimeGen), ippStsContextMatchErr);
+   }
 
    {
       int factorPbitSize = RSA_PRV_KEY_BITSIZE_P(pPrivateKeyType2);
@@ -125,6 +186,8 @@ IPPFUN(IppStatus, ippsRSA_GenerateKeys,(const IppsBigNumState* pSrcPublicExp,
       cpBN_copy(pPublicExp, pSrcPublicExp);
 
       IPP_BADARG_RET(BN_ROOM(pModulus)<BITS_BNU_CHUNK(rsaModulusBitSize), ippStsSizeErr);
+      if(pPrimeGen && PRIME_WORKERS(pPrimeGen))
+         IPP_BADARG_RET(PRIME_MAXBITSIZE(pPrimeGen)<IPP_MAX(factorPbitSize, factorQbitSize), ippStsSizeErr);
       if(pPrivateExp)
          IPP_BADARG_RET(BN_ROOM(pPrivateExp)<BITS_BNU_CHUNK(rsaModulusBitSize), ippStsSizeErr);
 
@@ -150,89 +213,62 @@ IPPFUN(IppStatus, ippsRSA_GenerateKeys,(const IppsBigNumState* pSrcPublicExp,
          int ret = -1;
 
          /*
-         // generate prime P
+         // candidates search resources
          */
-         BNU_CHUNK_T topPattern = (BNU_CHUNK_T)1 << ((factorPbitSize-1)&(BNU_CHUNK_BITS-1));
-         int nRounds = 5*factorPbitSize;
-         int found;
-         int r;
-
-         for(r=0,found=0; r<nRounds && !found; r++) {
-            ret = cpPRNGenPattern(pFactorP, factorPbitSize, (BNU_CHUNK_T)1, topPattern, rndFunc, pRndParam);
-            if(1!=ret) break; /* internal error */;
+         cpSize ns = IPP_MAX(nsP, nsQ);
+         cpPrimeMRSlot localSlot;
+         cpPrimeWorkers workers;
+         rsaFactorFilterParam filterParam;
+         BNU_CHUNK_T* pBase = pFreeBuffer + ns;
+         /* buffer of the filter overlaps local slot temporaries */
+         BNU_CHUNK_T* pFilterBuffer = pBase + ns;
+
+         if(pPrimeGen && PRIME_WORKERS(pPrimeGen))
+            cpPrimeGetWorkers(&workers, &localSlot, pPrimeGen, 1);
+         else {
+            localSlot.poolLen = MOD_ENGINE_RSA_POOL_SIZE;
+            localSlot.pCand    = pFreeBuffer;
+            localSlot.pWitness = pFilterBuffer;
+            localSlot.pOdd     = localSlot.pWitness + ns;
+            localSlot.pPrime1  = localSlot.pOdd + ns;
+            localSlot.pScratch = localSlot.pPrime1 + ns;
+            localSlot.sscm = 1;
+
+            workers.runFunc = NULL;
+            workers.pRunParam = NULL;
+            workers.nSlots = 1;
+            workers.pSlots = &localSlot;
+         }
 
-            /* check if E and (P-1) co-prime */
-            cpDec_BNU(pFactorP, pFactorP, nsP, 1);
-            if(0 == cpIsCoPrime(BN_NUMBER(pPublicExp), BN_SIZE(pPublicExp), pFactorP, nsP, pFreeBuffer)) continue;
+         filterParam.pE = BN_NUMBER(pPublicExp);
+         filterParam.nsE = BN_SIZE(pPublicExp);
+         filterParam.pBuffer = pFilterBuffer;
 
-            /* test P for primality */
-            cpInc_BNU(pFactorP, pFactorP, nsP, 1);
-            gsModEngineInit(pMontP, (Ipp32u*)pFactorP, factorPbitSize, MOD_ENGINE_RSA_POOL_SIZE, gsModArithRSA());
-          //if(0==cpIsProbablyPrime(pFactorP, factorPbitSize, mrTrials,
-          //                        rndFunc, pRndParam,
-          //                        pMontP, pFreeBuffer)) continue;
-          //found = 1;
-            ret = cpIsProbablyPrime(pFactorP, factorPbitSize, mrTrials,
-                                    rndFunc, pRndParam,
-                                    pMontP, pFreeBuffer);
-            if(0 > ret) break;    /* internal error */
-            if(0 ==ret) continue; /* composite factor */
-            found = 1;
-         }
-         if(!found)
+         /*
+         // generate prime P
+         */
+         localSlot.pME = pMontP;
+         filterParam.pFactor1 = pFactorP;
+         ret = cpPrimeSearch(pFactorP, factorPbitSize, mrTrials, PRIME_SIEVE_MAXCOUNT(factorPbitSize), pBase,
+                             rsaFactorFilterP, &filterParam,
+                             &workers, rndFunc, pRndParam);
+         if(1!=ret)
             goto err; /* internal error or ippStsInsufficientEntropy */
 
          /*
          // generate prime Q
          */
-         topPattern = (BNU_CHUNK_T)1 << ((factorQbitSize-1)&(BNU_CHUNK_BITS-1));
-         nRounds = 5*factorQbitSize;
-
-         for(r=0,found=0; r<nRounds && !found; r++) {
-            ret = cpPRNGenPattern(pFactorQ, factorQbitSize, (BNU_CHUNK_T)1, topPattern, rndFunc, pRndParam);
-            if(1!=ret) break; /* internal error */;
-
-            /* test if P and Q are close each other */
-            if(factorPbitSize==factorQbitSize) {
-               int cmp_res = cpCmp_BNU(pFactorP,nsP, pFactorQ, nsP);
-
-               if(0==cmp_res) continue;    /* P==Q */
-               else {
-                  if(cmp_res<0)
-                     cpSub_BNU(pFreeBuffer, pFactorQ, pFactorP, nsP);
-                  else
-                     cpSub_BNU(pFreeBuffer, pFactorP, pFactorQ, nsP);
-
-                  if(factorPbitSize>=512) {
-                     int bitsize = BITSIZE_BNU(pFreeBuffer, nsP);
-                     if(bitsize < (factorPbitSize-100)) continue; /* abs(P-Q) <=2^(factorPbitSize-100)*/
-                  }
-               }
-            }
-
-            /* test if bitsize(N) = bitsize(P)+bitsize(Q) */
-            cpMul_BNU_school(pProdN, pFactorP, nsP, pFactorQ, nsQ);
-            if(rsaModulusBitSize != BITSIZE_BNU(pProdN, nsN)) continue;
-
-            /* check if E and (Q-1) co-prime */
-            cpDec_BNU(pFactorQ, pFactorQ, nsQ, 1);
-            if(0 == cpIsCoPrime(BN_NUMBER(pPublicExp), BN_SIZE(pPublicExp), pFactorQ, nsQ, pFreeBuffer)) continue;
-
-            /* test Q for primality */
-            cpInc_BNU(pFactorQ, pFactorQ, nsQ, 1);
-            gsModEngineInit(pMontQ, (Ipp32u*)pFactorQ, factorQbitSize, MOD_ENGINE_RSA_POOL_SIZE, gsModArithRSA());
-          //if(0==cpIsProbablyPrime(pFactorQ, factorQbitSize, mrTrials,
-          //                        rndFunc, pRndParam,
-          //                        pMontQ, pFreeBuffer)) continue;
-          //found = 1;
-            ret = cpIsProbablyPrime(pFactorQ, factorQbitSize, mrTrials,
-                                    rndFunc, pRndParam,
-                                    pMontQ, pFreeBuffer);
-            if(0 > ret) break;    /* internal error */
-            if(0 ==ret) continue; /* composite factor */
-            found = 1;
-         }
-         if(!found)
+         localSlot.pME = pMontQ;
+         filterParam.pFactor1 = pFactorQ;
+         filterParam.pFactorP = pFactorP;
+         filterParam.factorPbitSize = factorPbitSize;
+         filterParam.pProdN = pProdN;
+         filterParam.nsN = nsN;
+         filterParam.modulusBitSize = rsaModulusBitSize;
+         ret = cpPrimeSearch(pFactorQ, factorQbitSize, mrTrials, PRIME_SIEVE_MAXCOUNT(factorQbitSize), pBase,
+                             rsaFactorFilterQ, &filterParam,
+                             &workers, rndFunc, pRndParam);
+         if(1!=ret)
             goto err; /* internal error or ippStsInsufficientEntropy */
 
          {
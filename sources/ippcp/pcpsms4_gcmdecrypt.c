@@ -0,0 +1,133 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM implementation.
+//
+//     Content:
+//        ippsSMS4_GCMDecrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4authgcm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_GCMDecrypt
+//
+// Purpose: SMS4-GCM authentication and decryption.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//    ippStsContextMatchErr   !VALID_SMS4GCM_ID()
+//    ippStsBadArgErr         ippsSMS4_GCMStart() has not been called
+//    ippStsLengthErr         len < 0
+//    ippStsScaleRangeErr     overall text length exceeds 2^39-256 bits
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the source text
+//    pDst        pointer to the target text
+//    len         length of the text (in bytes)
+//    pState      pointer to the SMS4-GCM context
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_GCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                       IppsSMS4_GCMState* pState))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+   /* use aligned context */
+   pState = (IppsSMS4_GCMState*)( IPP_ALIGNED_PTR(pState, SMS4GCM_ALIGNMENT) );
+   /* test state ID */
+   IPP_BADARG_RET(!VALID_SMS4GCM_ID(pState), ippStsContextMatchErr);
+   /* test context validity */
+   IPP_BADARG_RET(SMS4GcmTXTprocessing!=SMS4GCM_STATE(pState), ippStsBadArgErr);
+
+   /* test text pointers and length */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+   IPP_BADARG_RET(len<0, ippStsLengthErr);
+
+   /* According to the NIST Special Publication 800-38D (Recommendation for GCM
+    * mode, p.5.2.1.1 Input Data) the input text shall be between 0 and 2^39-256
+    * bits. */
+   const Ipp64u MAX_TXT_LEN = ((Ipp64u)1 << 36) - 32; /* length in bytes */
+   IPP_BADARG_RET(((SMS4GCM_TXT_LEN(pState) > MAX_TXT_LEN - (Ipp64u)len) ||
+                  ((SMS4GCM_TXT_LEN(pState) + (Ipp64u)len) < (Ipp64u)len)),
+                  ippStsScaleRangeErr);
+
+   {
+      const IppsSMS4Spec* pSMS4 = SMS4GCM_CIPHER(pState);
+      SMS4GcmMul_ hashFunc = SMS4GCM_HASH(pState);
+      SMS4GcmAuth_ authFunc = SMS4GCM_AUTH(pState);
+
+      SMS4GCM_TXT_LEN(pState) += (Ipp64u)len;
+
+      /* process partial block */
+      if(SMS4GCM_BUFLEN(pState)) {
+         int locLen = IPP_MIN(len, MBS_SMS4-SMS4GCM_BUFLEN(pState));
+         /* authentication */
+         XorBlock(pSrc, SMS4GCM_GHASH(pState)+SMS4GCM_BUFLEN(pState), SMS4GCM_GHASH(pState)+SMS4GCM_BUFLEN(pState), locLen);
+         /* ctr decryption */
+         XorBlock(pSrc, SMS4GCM_ECOUNTER(pState)+SMS4GCM_BUFLEN(pState), pDst, locLen);
+
+         SMS4GCM_BUFLEN(pState) += locLen;
+         pSrc += locLen;
+         pDst += locLen;
+         len -= locLen;
+
+         /* if buffer full */
+         if(MBS_SMS4==SMS4GCM_BUFLEN(pState)) {
+            hashFunc(SMS4GCM_GHASH(pState), SMS4GCM_HKEY(pState), AesGcmConst_table);
+            SMS4GCM_BUFLEN(pState) = 0;
+         }
+      }
+
+      /* process the main part of text: CTR and GHASH over L1-resident chunks */
+      {
+         int lenBlks = len & (-MBS_SMS4);
+         while(lenBlks) {
+            int chunk = IPP_MIN(lenBlks, SMS4GCM_CHUNK_SIZE);
+            authFunc(SMS4GCM_GHASH(pState), pSrc, chunk, SMS4GCM_HKEY(pState), AesGcmConst_table);
+            cpProcessSMS4_ctr(pSrc, pDst, chunk, pSMS4, SMS4GCM_COUNTER(pState), 32);
+            pSrc += chunk;
+            pDst += chunk;
+            len -= chunk;
+            lenBlks -= chunk;
+         }
+      }
+
+      /* process the rest of text */
+      if(len) {
+         cpSMS4_Cipher(SMS4GCM_ECOUNTER(pState), SMS4GCM_COUNTER(pState), SMS4_RK(pSMS4));
+         SMS4GcmIncrementCounter32(SMS4GCM_COUNTER(pState));
+
+         XorBlock(pSrc, SMS4GCM_GHASH(pState), SMS4GCM_GHASH(pState), len);
+         XorBlock(pSrc, SMS4GCM_ECOUNTER(pState), pDst, len);
+         SMS4GCM_BUFLEN(pState) = len;
+      }
+
+      return ippStsNoErr;
+   }
+}
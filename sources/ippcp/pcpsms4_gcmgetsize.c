@@ -0,0 +1,55 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM implementation.
+//
+//     Content:
+//        ippsSMS4_GCMGetSize()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4authgcm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_GCMGetSize
+//
+// Purpose: Returns size of SMS4-GCM state (in bytes).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize       pointer to size of context
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_GCMGetSize,(int* pSize))
+{
+   /* test size's pointer */
+   IPP_BAD_PTR1_RET(pSize);
+
+   *pSize = cpSizeofCtx_SMS4GCM();
+
+   return ippStsNoErr;
+}
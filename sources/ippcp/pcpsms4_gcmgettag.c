@@ -0,0 +1,102 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM implementation.
+//
+//     Content:
+//        ippsSMS4_GCMGetTag()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4authgcm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_GCMGetTag
+//
+// Purpose: Generates authentication tag in the SMS4-GCM mode.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pDstTag == NULL
+//                            pState == NULL
+//    ippStsLengthErr         tagLen<=0 || tagLen>16
+//    ippStsContextMatchErr   !VALID_SMS4GCM_ID()
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pDstTag     pointer to the authentication tag.
+//    tagLen      length of the authentication tag *pDstTag in bytes
+//    pState      pointer to the SMS4-GCM context
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_GCMGetTag,(Ipp8u* pDstTag, int tagLen, const IppsSMS4_GCMState* pState))
+{
+   /* test State pointer */
+   IPP_BAD_PTR1_RET(pState);
+   /* use aligned context */
+   pState = (IppsSMS4_GCMState*)( IPP_ALIGNED_PTR(pState, SMS4GCM_ALIGNMENT) );
+   /* test state ID */
+   IPP_BADARG_RET(!VALID_SMS4GCM_ID(pState), ippStsContextMatchErr);
+
+   /* test tag pointer and length */
+   IPP_BAD_PTR1_RET(pDstTag);
+   IPP_BADARG_RET(tagLen<=0 || tagLen>MBS_SMS4, ippStsLengthErr);
+
+   {
+      /* get method */
+      SMS4GcmMul_ hashFunc = SMS4GCM_HASH(pState);
+
+      __ALIGN16 Ipp8u tmpHash[MBS_SMS4];
+      Ipp8u tmpCntr[MBS_SMS4];
+
+      /* local copy of AAD and text counters (in bits) */
+      Ipp64u aadBitLen = SMS4GCM_AAD_LEN(pState)*BYTESIZE;
+      Ipp64u txtBitLen = SMS4GCM_TXT_LEN(pState)*BYTESIZE;
+
+      /* do local copy of ghash */
+      CopyBlock16(SMS4GCM_GHASH(pState), tmpHash);
+
+      /* complete text processing */
+      if(SMS4GCM_BUFLEN(pState)) {
+         hashFunc(tmpHash, SMS4GCM_HKEY(pState), AesGcmConst_table);
+      }
+
+      /* process lengths of AAD and text */
+      U32_TO_HSTRING(tmpCntr,   IPP_HIDWORD(aadBitLen));
+      U32_TO_HSTRING(tmpCntr+4, IPP_LODWORD(aadBitLen));
+      U32_TO_HSTRING(tmpCntr+8, IPP_HIDWORD(txtBitLen));
+      U32_TO_HSTRING(tmpCntr+12,IPP_LODWORD(txtBitLen));
+
+      XorBlock16(tmpHash, tmpCntr, tmpHash);
+      hashFunc(tmpHash, SMS4GCM_HKEY(pState), AesGcmConst_table);
+
+      /* add encrypted initial counter */
+      XorBlock16(tmpHash, SMS4GCM_ECOUNTER0(pState), tmpHash);
+
+      /* return tag of required length */
+      CopyBlock(tmpHash, pDstTag, tagLen);
+
+      PurgeBlock(tmpHash, sizeof(tmpHash));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,108 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM implementation.
+//
+//     Content:
+//        ippsSMS4_GCMInit()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4authgcm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_GCMInit
+//
+// Purpose: Init SMS4-GCM state.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pKey == NULL
+//    ippStsMemAllocErr       size of buffer is not match for operation
+//    ippStsLengthErr         keyLen < 16
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pKey        pointer to the secret key
+//    keyLen      length of secret key (in bytes)
+//    pState      pointer to initialized as SMS4-GCM context
+//    ctxSize     available size (in bytes) of buffer above
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_GCMInit,(const Ipp8u* pKey, int keyLen,
+                                    IppsSMS4_GCMState* pState, int ctxSize))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+
+   /* test available size of context buffer */
+   IPP_BADARG_RET(ctxSize<cpSizeofCtx_SMS4GCM(), ippStsMemAllocErr);
+
+   /* use aligned context */
+   pState = (IppsSMS4_GCMState*)( IPP_ALIGNED_PTR(pState, SMS4GCM_ALIGNMENT) );
+
+   /* init cipher */
+   {
+      IppStatus sts = ippsSMS4Init(pKey, keyLen, SMS4GCM_CIPHER(pState), cpSizeofCtx_SMS4());
+      if(ippStsNoErr!=sts)
+         return sts;
+   }
+
+   /* set and clear GCM context */
+   SMS4GCM_SET_ID(pState);
+   SMS4GCM_STATE(pState) = SMS4GcmInit;
+   SMS4GCM_AAD_LEN(pState) = CONST_64(0);
+   SMS4GCM_TXT_LEN(pState) = CONST_64(0);
+   SMS4GCM_BUFLEN(pState) = 0;
+   PadBlock(0, SMS4GCM_COUNTER(pState), MBS_SMS4);
+   PadBlock(0, SMS4GCM_ECOUNTER0(pState), MBS_SMS4);
+   PadBlock(0, SMS4GCM_ECOUNTER(pState), MBS_SMS4);
+   PadBlock(0, SMS4GCM_GHASH(pState), MBS_SMS4);
+
+   /* multiplier c = Enc({0}) */
+   PadBlock(0, SMS4GCM_HKEY(pState), MBS_SMS4);
+   cpSMS4_Cipher(SMS4GCM_HKEY(pState), SMS4GCM_HKEY(pState), SMS4_RK(SMS4GCM_CIPHER(pState)));
+
+   /* precomputations (for constant multiplier(s)) and GHASH methods */
+   #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   if(cpSMS4GCM_IsClmul()) {
+      /* pre-compute reflect(hkey) and hKey<<1, (hKey<<1)^2 and (hKey<<1)^4 powers of hKey */
+      AesGcmPrecompute_avx(SMS4GCM_HKEY(pState), SMS4GCM_HKEY(pState));
+      SMS4GCM_HASH(pState) = AesGcmMulGcm_avx;
+      SMS4GCM_AUTH(pState) = AesGcmAuth_avx;
+   }
+   #if(_IPP32E<_IPP32E_K0)
+   else
+   #endif
+   #endif
+   #if(_IPP32E<_IPP32E_K0)
+   {
+      AesGcmPrecompute_table2K(SMS4GCM_HKEY(pState), SMS4GCM_HKEY(pState));
+      SMS4GCM_HASH(pState) = AesGcmMulGcm_table2K_ct;
+      SMS4GCM_AUTH(pState) = AesGcmAuth_table2K_ct;
+   }
+   #endif
+
+   return ippStsNoErr;
+}
@@ -0,0 +1,140 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM implementation.
+//
+//     Content:
+//        ippsSMS4_GCMStart()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4authgcm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_GCMStart
+//
+// Purpose: Start the process of encryption or decryption and
+//          authentication with new IV and AAD.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pIV == NULL
+//                            pAAD == NULL, aadLen>0
+//    ippStsContextMatchErr   !VALID_SMS4GCM_ID()
+//    ippStsLengthErr         ivLen < 1
+//                            aadLen < 0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pIV         pointer to the IV
+//    ivLen       length of IV (in bytes)
+//    pAAD        pointer to the additional authenticated data
+//    aadLen      length of AAD (in bytes)
+//    pState      pointer to the SMS4-GCM context
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_GCMStart,(const Ipp8u* pIV,  int ivLen,
+                                     const Ipp8u* pAAD, int aadLen,
+                                     IppsSMS4_GCMState* pState))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+   /* use aligned context */
+   pState = (IppsSMS4_GCMState*)( IPP_ALIGNED_PTR(pState, SMS4GCM_ALIGNMENT) );
+   /* test state ID */
+   IPP_BADARG_RET(!VALID_SMS4GCM_ID(pState), ippStsContextMatchErr);
+
+   /* test IV and AAD */
+   IPP_BAD_PTR1_RET(pIV);
+   IPP_BADARG_RET(ivLen<1, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen<0, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+
+   {
+      SMS4GcmMul_ hashFunc = SMS4GCM_HASH(pState);
+      SMS4GcmAuth_ authFunc = SMS4GCM_AUTH(pState);
+      const Ipp32u* pRKey = SMS4_RK(SMS4GCM_CIPHER(pState));
+
+      Ipp8u* pCounter = SMS4GCM_COUNTER(pState);
+      Ipp8u* pGhash = SMS4GCM_GHASH(pState);
+
+      /*
+      // J0 = IV || 0^31 || 1 if len(IV) == 96
+      // J0 = GHASH(IV || 0^(s+64) || [len(IV)]64) otherwise
+      */
+      PadBlock(0, pCounter, MBS_SMS4);
+      if(12==ivLen) {
+         CopyBlock(pIV, pCounter, 12);
+         pCounter[MBS_SMS4-1] = 1;
+      }
+      else {
+         Ipp64u ivBitLen = (Ipp64u)ivLen*BYTESIZE;
+         Ipp8u tmpLen[MBS_SMS4];
+         int lenBlks = ivLen & (-MBS_SMS4);
+
+         if(lenBlks) {
+            authFunc(pCounter, pIV, lenBlks, SMS4GCM_HKEY(pState), AesGcmConst_table);
+            pIV += lenBlks;
+            ivLen -= lenBlks;
+         }
+         if(ivLen) {
+            XorBlock(pIV, pCounter, pCounter, ivLen);
+            hashFunc(pCounter, SMS4GCM_HKEY(pState), AesGcmConst_table);
+         }
+
+         PadBlock(0, tmpLen, MBS_SMS4);
+         U32_TO_HSTRING(tmpLen+8, IPP_HIDWORD(ivBitLen));
+         U32_TO_HSTRING(tmpLen+12,IPP_LODWORD(ivBitLen));
+         XorBlock16(pCounter, tmpLen, pCounter);
+         hashFunc(pCounter, SMS4GCM_HKEY(pState), AesGcmConst_table);
+      }
+
+      /* encrypt initial counter and set up the first counter of text */
+      cpSMS4_Cipher(SMS4GCM_ECOUNTER0(pState), pCounter, pRKey);
+      SMS4GcmIncrementCounter32(pCounter);
+
+      /* hash AAD */
+      PadBlock(0, pGhash, MBS_SMS4);
+      SMS4GCM_AAD_LEN(pState) = (Ipp64u)aadLen;
+      {
+         int lenBlks = aadLen & (-MBS_SMS4);
+         if(lenBlks) {
+            authFunc(pGhash, pAAD, lenBlks, SMS4GCM_HKEY(pState), AesGcmConst_table);
+            pAAD += lenBlks;
+            aadLen -= lenBlks;
+         }
+         if(aadLen) {
+            XorBlock(pAAD, pGhash, pGhash, aadLen);
+            hashFunc(pGhash, SMS4GCM_HKEY(pState), AesGcmConst_table);
+         }
+      }
+
+      /* switch to text processing */
+      SMS4GCM_STATE(pState) = SMS4GcmTXTprocessing;
+      SMS4GCM_TXT_LEN(pState) = CONST_64(0);
+      SMS4GCM_BUFLEN(pState) = 0;
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,160 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-XTS Functions (IEEE P1619)
+//
+//  Contents:
+//     ippsSMS4_XTSEncrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4xts.h"
+#include "pcptool.h"
+#include "pcpaesmxtsstuff.h"
+
+static void cpSMS4_XTS_EncBlock(Ipp8u* pOut, const Ipp8u* pInp, const Ipp8u* tweak, const IppsSMS4Spec* pCtx)
+{
+   /* pre-whitening */
+   XorBlock16(pInp, tweak, pOut);
+   /* encryption */
+   cpSMS4_Cipher(pOut, pOut, SMS4_ERK(pCtx));
+   /* post-whitening */
+   XorBlock16(pOut, tweak, pOut);
+}
+
+/*F*
+//    Name: ippsSMS4_XTSEncrypt
+//
+// Purpose: SMS4-XTS encryption.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc == NULL
+//                            pDst == NULL
+//                            pTweak ==NULL
+//                            pCtx == NULL
+//    ippStsLengthErr         bitLen <128
+//    ippStsContextMatchErr   !VALID_SMS4_XTS_ID(pCtx)
+//    ippStsBadArgErr         !IsLegalGeometry(startCipherBlkNo,
+//                               bitLen, pCtx->duBitsize)
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc              points input buffer
+//    pDst              points output buffer
+//    bitLen            length of the input buffer in bits
+//    pCtx              points SMS4_XTS context
+//    pTweak            points tweak value
+//    startCipherBlkNo  number of the first block for data unit
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen,
+                                       const IppsSMS4_XTSSpec* pCtx,
+                                       const Ipp8u* pTweak,
+                                       int startCipherBlkNo))
+{
+   /* test pointers */
+   IPP_BAD_PTR1_RET(pCtx);
+   /* test the context ID */
+   IPP_BADARG_RET(!VALID_SMS4_XTS_ID(pCtx), ippStsContextMatchErr);
+
+   /* test data pointers */
+   IPP_BAD_PTR3_RET(pSrc, pDst, pTweak);
+
+   /* test startCipherBlkNo and bitLen */
+   IPP_BADARG_RET(bitLen < MBS_SMS4*BYTESIZE, ippStsLengthErr);
+   IPP_BADARG_RET(!IsLegalGeometry(startCipherBlkNo, bitLen, pCtx->duBitsize), ippStsBadArgErr);
+
+   {
+      __ALIGN16 Ipp8u tweakCT[MBS_SMS4];
+
+      /* encrypt tweak */
+      cpSMS4_Cipher(tweakCT, pTweak, SMS4_ERK(&pCtx->tweakSMS4));
+
+      /* update tweakCT */
+      for(; startCipherBlkNo>0; startCipherBlkNo--)
+         gf_mul_by_primitive(tweakCT);
+
+      /* XTS encryption */
+      {
+         const IppsSMS4Spec* pdatSMS4 = &pCtx->datumSMS4;
+
+         int encBlocks = bitLen/(MBS_SMS4*BYTESIZE);
+         int encBlocklast = bitLen%(MBS_SMS4*BYTESIZE);
+         if(encBlocklast) encBlocks--;
+
+         /* encrypt data blocks: whitening vectors are prepared per buffer,
+            the cipher pass goes through the (pipelined) SMS4-ECB */
+         if(encBlocks>0) {
+            __ALIGN16 Ipp8u tweakBuffer[MBS_SMS4*SMS4_XTS_BLKS_PER_BUFFER];
+
+            while(encBlocks>0) {
+               int nBlk = IPP_MIN(encBlocks, SMS4_XTS_BLKS_PER_BUFFER);
+               int nLen = nBlk*MBS_SMS4;
+
+               cpXTSwhitening(tweakBuffer, nBlk, tweakCT);
+               cpXTSxor16(pDst, pSrc, tweakBuffer, nBlk);
+               ippsSMS4EncryptECB(pDst, pDst, nLen, pdatSMS4);
+               cpXTSxor16(pDst, pDst, tweakBuffer, nBlk);
+
+               pSrc += nLen;
+               pDst += nLen;
+               encBlocks -= nBlk;
+            }
+
+            /* clear whitening vectors */
+            PurgeBlock(tweakBuffer, sizeof(tweakBuffer));
+         }
+
+         /* "stealing" - encrypt last partial block if is */
+         if(encBlocklast) {
+            int partBlockSize = encBlocklast/BYTESIZE;
+
+            __ALIGN16 Ipp8u cc[MBS_SMS4];
+            __ALIGN16 Ipp8u pp[MBS_SMS4];
+            cpSMS4_XTS_EncBlock(cc, pSrc, tweakCT, pdatSMS4);
+            gf_mul_by_primitive(tweakCT);
+
+            CopyBlock16(cc, pp);
+            CopyBlock(pSrc+MBS_SMS4, pp, partBlockSize);
+
+            encBlocklast %= BYTESIZE;
+            if(encBlocklast) {
+               Ipp8u partBlockMask = (Ipp8u)((0xFF)<<((BYTESIZE -encBlocklast) %BYTESIZE));
+               Ipp8u x = pSrc[MBS_SMS4+partBlockSize];
+               Ipp8u y = cc[partBlockSize];
+               x = (x & partBlockMask) | (y & ~partBlockMask);
+               pp[partBlockSize] = x;
+               cc[partBlockSize] &= partBlockMask;
+               partBlockSize++;
+            }
+            cpSMS4_XTS_EncBlock(pDst, pp, tweakCT, pdatSMS4);
+
+            CopyBlock(cc, pDst+MBS_SMS4, partBlockSize);
+
+            /* clear secret data */
+            PurgeBlock(pp, sizeof(pp));
+         }
+         return ippStsNoErr;
+      }
+   }
+}
@@ -0,0 +1,115 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-XTS Functions (IEEE P1619)
+//
+//  Contents:
+//     ippsSMS4_XTSGetSize()
+//     ippsSMS4_XTSInit()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpsms4xts.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsSMS4_XTSGetSize
+//
+// Purpose: Returns size of SMS4_XTS state (in bytes).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize       pointer to size of context
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_XTSGetSize,(int* pSize))
+{
+   /* test size's pointer */
+   IPP_BAD_PTR1_RET(pSize);
+
+   *pSize = cpSizeof_SMS4_XTS_Ctx();
+   return ippStsNoErr;
+}
+
+/*F*
+//    Name: ippsSMS4_XTSInit
+//
+// Purpose: Init SMS4_XTS context for future usage.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pKey == NULL
+//                            pCtx == NULL
+//    ippStsMemAllocErr       size of buffer is not match for operation
+//    ippStsLengthErr         keyLen != 16*8*2
+//                            duBitsize < 128
+//    ippStsBadArgErr         [Only in FIPS-compliance mode]: Indicates an error
+//                            condition if tweak key is equal to the data key
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pKey        pointer to the secret key (data key || tweak key)
+//    keyLen      length of the secret key in bits
+//    duBitsize   length of Data Unit in bits
+//    pCtx        pointer to the SMS4-XTS context
+//    ctxSize     available size (in bytes) of buffer above
+//
+*F*/
+IPPFUN(IppStatus, ippsSMS4_XTSInit,(const Ipp8u* pKey, int keyLen,
+                                     int duBitsize,
+                                     IppsSMS4_XTSSpec* pCtx, int ctxSize))
+{
+   /* test key and keyLenBits */
+   IPP_BAD_PTR1_RET(pKey);
+   IPP_BADARG_RET(keyLen!=MBS_SMS4*BYTESIZE*2, ippStsLengthErr);
+
+   /* test DU parameters */
+   IPP_BADARG_RET(duBitsize<MBS_SMS4*BYTESIZE, ippStsLengthErr);
+
+   /* test context pointer */
+   IPP_BAD_PTR1_RET(pCtx);
+   /* test available size of context buffer */
+   IPP_BADARG_RET((int)sizeof(IppsSMS4_XTSSpec) > ctxSize, ippStsMemAllocErr);
+
+   const Ipp8u* pdatKey = pKey;
+   const Ipp8u* ptwkKey = pKey+MBS_SMS4;
+#ifdef IPPCP_FIPS_MODE
+   /* test FIPS-compliance requirement pdatKey != ptwkKey */
+   int isEqu = cpIsEquBlock_ct(pdatKey, ptwkKey, MBS_SMS4) & 1;
+   IPP_BADARG_RET(isEqu, ippStsBadArgErr);
+#endif
+
+   {
+      IppStatus sts = ippsSMS4Init(pdatKey, MBS_SMS4, &pCtx->datumSMS4, sizeof(IppsSMS4Spec));
+      if(ippStsNoErr!=sts) return sts;
+
+      sts = ippsSMS4Init(ptwkKey, MBS_SMS4, &pCtx->tweakSMS4, sizeof(IppsSMS4Spec));
+      if(ippStsNoErr!=sts) return sts;
+
+      SMS4_XTS_SET_ID(pCtx);
+      pCtx->duBitsize = duBitsize;
+      return sts;
+   }
+}
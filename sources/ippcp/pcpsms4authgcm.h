@@ -0,0 +1,143 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-GCM Internal Definitions and Internal Functions Prototypes
+//
+//
+*/
+
+#if !defined(_CP_SMS4_GCM_H)
+#define _CP_SMS4_GCM_H
+
+#include "owncp.h"
+#include "pcpsms4.h"
+
+#if(_IPP32E<_IPP32E_K0)
+#include "pcpaesauthgcm.h"
+#else
+/*
+// GHASH primitives shared with AES-GCM
+// (AVX-512 build of AES-GCM does not use pcpaesauthgcm.h)
+*/
+#define AesGcmPrecompute_avx OWNAPI(AesGcmPrecompute_avx)
+   IPP_OWN_DECL (void, AesGcmPrecompute_avx, (Ipp8u* pPrecomputeData, const Ipp8u* pHKey))
+#define AesGcmMulGcm_avx OWNAPI(AesGcmMulGcm_avx)
+   IPP_OWN_DECL (void, AesGcmMulGcm_avx, (Ipp8u* pGhash, const Ipp8u* pHkey, const void* pParam))
+#define AesGcmAuth_avx OWNAPI(AesGcmAuth_avx)
+   IPP_OWN_DECL (void, AesGcmAuth_avx, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
+
+extern const Ipp16u AesGcmConst_table[256];            /* precomputed reduction table */
+#endif
+
+/* GHASH prototype: GHash = GHash*HKey mod G() */
+IPP_OWN_FUNPTR (void, SMS4GcmMul_, (Ipp8u* pGHash, const Ipp8u* pHKey, const void* pParam))
+
+/* GHASH prototype: GHash = (GHash^src[])*HKey mod G(), len is multiple of MBS_SMS4 */
+IPP_OWN_FUNPTR (void, SMS4GcmAuth_, (Ipp8u* pHash, const Ipp8u* pSrc, int len, const Ipp8u* pHKey, const void* pParam))
+
+typedef enum {
+   SMS4GcmInit,
+   SMS4GcmTXTprocessing
+} SMS4GcmState;
+
+struct _cpSMS4_GCM {
+   Ipp32u       idCtx;                 /* SMS4-GCM id                   */
+   SMS4GcmState state;                 /* GCM state: Init, TXT processing */
+   Ipp64u       aadLen;                /* header length (bytes)         */
+   Ipp64u       txtLen;                /* text length (bytes)           */
+
+   int          bufLen;                /* stuff buffer length           */
+   __ALIGN16                           /* aligned buffers               */
+   Ipp8u        counter[MBS_SMS4];     /* counter                       */
+   Ipp8u        ecounter0[MBS_SMS4];   /* encrypted initial counter     */
+   Ipp8u        ecounter[MBS_SMS4];    /* encrypted counter             */
+   Ipp8u        ghash[MBS_SMS4];       /* ghash accumulator             */
+
+   SMS4GcmMul_  hashFun;               /* GHASH mul function            */
+   SMS4GcmAuth_ authFun;               /* GHASH authentication function */
+
+   __ALIGN16
+   Ipp8u        cipher[sizeof(IppsSMS4Spec)];
+
+   __ALIGN16                           /* aligned pre-computed data:    */
+   Ipp8u        multiplier[MBS_SMS4];  /* - (clmul) hKey*t, (hKey*t)^2, (hKey*t)^4 */
+                                       /* - (safe)  hKey*(t^i), i=0,...,127        */
+};
+
+/* alignment */
+#define SMS4GCM_ALIGNMENT   (16)
+
+#define SMS4GCM_PRECOMP_CLMUL    (MBS_SMS4*4)
+#define SMS4GCM_PRECOMP_TBL2K    (MBS_SMS4*128)
+
+/* text processed per pass of CTR and GHASH (fits L1) */
+#define SMS4GCM_CHUNK_SIZE       (MBS_SMS4*256)
+
+/*
+// Useful macros
+*/
+#define SMS4GCM_SET_ID(ctx)      ((ctx)->idCtx = (Ipp32u)idCtxSMS4GCM ^ (Ipp32u)IPP_UINT_PTR(ctx))
+#define SMS4GCM_STATE(ctx)       ((ctx)->state)
+#define SMS4GCM_AAD_LEN(ctx)     ((ctx)->aadLen)
+#define SMS4GCM_TXT_LEN(ctx)     ((ctx)->txtLen)
+#define SMS4GCM_BUFLEN(ctx)      ((ctx)->bufLen)
+#define SMS4GCM_COUNTER(ctx)     ((ctx)->counter)
+#define SMS4GCM_ECOUNTER0(ctx)   ((ctx)->ecounter0)
+#define SMS4GCM_ECOUNTER(ctx)    ((ctx)->ecounter)
+#define SMS4GCM_GHASH(ctx)       ((ctx)->ghash)
+#define SMS4GCM_HASH(ctx)        ((ctx)->hashFun)
+#define SMS4GCM_AUTH(ctx)        ((ctx)->authFun)
+#define SMS4GCM_CIPHER(ctx)      (IppsSMS4Spec*)(&((ctx)->cipher))
+#define SMS4GCM_HKEY(ctx)        ((ctx)->multiplier)
+
+#define VALID_SMS4GCM_ID(ctx)    ((((ctx)->idCtx) ^ (Ipp32u)IPP_UINT_PTR((ctx))) == (Ipp32u)idCtxSMS4GCM)
+
+/* use carry-less multiplication for GHASH */
+__IPPCP_INLINE int cpSMS4GCM_IsClmul(void)
+{
+   #if(_IPP32E>=_IPP32E_K0)
+   return 1;
+   #elif (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   return IsFeatureEnabled(ippCPUID_AES|ippCPUID_CLMUL);
+   #else
+   return 0;
+   #endif
+}
+
+static int cpSizeofCtx_SMS4GCM(void)
+{
+   int precomp_size = cpSMS4GCM_IsClmul()? SMS4GCM_PRECOMP_CLMUL : SMS4GCM_PRECOMP_TBL2K;
+
+   /* decrease precomp_size as soon as MBS_SMS4 bytes already reserved in context */
+   precomp_size -= MBS_SMS4;
+
+   return (Ipp32s)sizeof(IppsSMS4_GCMState)
+         +precomp_size
+         +SMS4GCM_ALIGNMENT-1;
+}
+
+__IPPCP_INLINE void SMS4GcmIncrementCounter32(Ipp8u* pCtr)
+{
+   int i;
+   for(i=MBS_SMS4-1; i>=MBS_SMS4-4 && 0==(Ipp8u)(++pCtr[i]); i--) ;
+}
+
+#endif /* _CP_SMS4_GCM_H */
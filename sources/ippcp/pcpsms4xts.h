@@ -0,0 +1,61 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     SMS4-XTS Internal Definitions
+//
+//
+*/
+
+#if !defined(_CP_SMS4_XTS_H)
+#define _CP_SMS4_XTS_H
+
+#include "owncp.h"
+#include "pcpsms4.h"
+#include "pcpaesmxts.h"
+
+/* number of blocks whitened and ciphered per pass */
+#define SMS4_XTS_BLKS_PER_BUFFER (32)
+
+/*
+// SMS4-XTS State
+*/
+struct _cpSMS4_XTS
+{
+   Ipp32u       idCtx;
+   int          duBitsize;      /* size of data unit (in bits) */
+   IppsSMS4Spec datumSMS4;      /* datum SMS4 context */
+   IppsSMS4Spec tweakSMS4;      /* tweak SMS4 context */
+};
+
+#define SMS4_XTS_SET_ID(ctx)     ((ctx)->idCtx = (Ipp32u)idCtxSMS4XTS ^ (Ipp32u)IPP_UINT_PTR(ctx))
+/* valid SMS4_XTS context ID */
+#define VALID_SMS4_XTS_ID(ctx)   ((((ctx)->idCtx) ^ (Ipp32u)IPP_UINT_PTR((ctx))) == (Ipp32u)idCtxSMS4XTS)
+
+/* size of SMS4-XTS context */
+__IPPCP_INLINE int cpSizeof_SMS4_XTS_Ctx(void)
+{
+   return sizeof(IppsSMS4_XTSSpec);
+}
+
+/* SMS4 and AES share the 128-bit block, so the data unit geometry is checked
+   by IsLegalGeometry() of AES-XTS */
+
+#endif /* _CP_SMS4_XTS_H */